@@ -0,0 +1,585 @@
+/*!
+@file bench/micro/micro_bench.cpp
+@ingroup TrickHLA
+@brief Standalone microbenchmark harness for the TrickHLA encode/decode and
+byteswap kernels.
+
+This harness times the data-conversion hot paths that sit under
+Attribute::pack_attribute_buffer()/unpack_attribute_buffer() in tight loops
+without a running Trick simulation or an RTI federation:
+
+- The TrickHLA::Utilities scalar byteswap kernels (short, int, long, long
+  long, float and double) applied element-wise over arrays, which is the
+  inner loop of the byteswap_buffer_copy() transmission-byteswap path.
+- The TrickHLA::Utilities::byteswap_2/4/8_byte_array() bulk kernels.
+- A straight memcpy() of the same payload as the no-byteswap baseline.
+- The TrickHLA::OpaqueBuffer push_to_buffer()/pull_from_buffer() API with
+  and without a transmission byteswap encoding, which is the pack/unpack
+  path used by the lag compensation and packing data buffers.
+
+Each benchmark is run for a number of timed repetitions after a warmup pass
+and the median time per operation is reported in nanoseconds along with the
+effective throughput. On x86_64 the elapsed TSC cycles per operation are
+reported as well. The results can be saved to a CSV baseline file with
+--save and a later run can be gated against that baseline with --compare,
+which exits with a non-zero status when any benchmark regresses by more
+than the allowed threshold.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <time.h>
+#include <vector>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/OpaqueBuffer.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// The Trick Memory Manager instance for this process. Constructing it sets
+// the trick_MM global used by the OpaqueBuffer TMM allocation calls.
+static Trick::MemoryManager *memory_manager = NULL;
+
+/*! @brief Get a monotonic wall-clock timestamp.
+ *  @return Time in nanoseconds. */
+static inline long long get_time_ns()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ( (long long)ts.tv_sec * 1000000000LL ) + (long long)ts.tv_nsec;
+}
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#define MICRO_BENCH_HAVE_TSC 1
+/*! @brief Read the CPU time-stamp counter.
+ *  @return Current TSC value. */
+static inline unsigned long long get_tsc_cycles()
+{
+   unsigned int lo, hi;
+   __asm__ __volatile__( "rdtsc" : "=a"( lo ), "=d"( hi ) );
+   return ( (unsigned long long)hi << 32 ) | (unsigned long long)lo;
+}
+#else
+#define MICRO_BENCH_HAVE_TSC 0
+static inline unsigned long long get_tsc_cycles()
+{
+   return 0ULL;
+}
+#endif
+
+/*! @brief Keep the compiler from optimizing away a benchmarked buffer. */
+static inline void do_not_optimize( void const *data )
+{
+   __asm__ __volatile__( "" : : "r"( data ) : "memory" );
+}
+
+/*! @brief The timing result for one benchmark. */
+class BenchResult
+{
+  public:
+   string name;         //!< Unique benchmark name.
+   size_t bytes;        //!< Payload bytes processed per operation.
+   double ns_per_op;    //!< Median time per operation in nanoseconds.
+   double cycles_per_op; //!< Median TSC cycles per operation (0 when unavailable).
+   double mbytes_per_sec; //!< Effective throughput in MB/s.
+};
+
+// All results gathered by this run, in execution order.
+static vector< BenchResult > results;
+
+// Benchmark tuning knobs, adjustable from the command line.
+static int    warmup_reps    = 3;     //!< Untimed warmup repetitions per benchmark.
+static int    timed_reps     = 15;    //!< Timed repetitions used for the median.
+static double min_rep_time_s = 0.01;  //!< Minimum wall-clock time per repetition.
+
+/*! @brief Time the supplied operation and record the median result.
+ *  @param name  Unique benchmark name.
+ *  @param bytes Payload bytes processed by one call of the operation.
+ *  @param op    Operation to time.
+ *  @param arg   Opaque argument passed to the operation. */
+static void run_benchmark( string const &name,
+                           size_t const  bytes,
+                           void ( *op )( void *arg ),
+                           void *arg )
+{
+   // Determine how many operations are needed per timed repetition so that
+   // each repetition runs long enough for a stable clock reading.
+   long long ops_per_rep = 1;
+   for ( ;; ) {
+      long long const t_start = get_time_ns();
+      for ( long long i = 0; i < ops_per_rep; ++i ) {
+         op( arg );
+      }
+      long long const elapsed = get_time_ns() - t_start;
+      if ( ( (double)elapsed * 1.0e-9 ) >= min_rep_time_s ) {
+         break;
+      }
+      ops_per_rep *= 2;
+   }
+
+   for ( int rep = 0; rep < warmup_reps; ++rep ) {
+      for ( long long i = 0; i < ops_per_rep; ++i ) {
+         op( arg );
+      }
+   }
+
+   vector< double > ns_samples;
+   vector< double > cycle_samples;
+   for ( int rep = 0; rep < timed_reps; ++rep ) {
+      unsigned long long const c_start = get_tsc_cycles();
+      long long const          t_start = get_time_ns();
+      for ( long long i = 0; i < ops_per_rep; ++i ) {
+         op( arg );
+      }
+      long long const          t_end = get_time_ns();
+      unsigned long long const c_end = get_tsc_cycles();
+      ns_samples.push_back( (double)( t_end - t_start ) / (double)ops_per_rep );
+      cycle_samples.push_back( (double)( c_end - c_start ) / (double)ops_per_rep );
+   }
+   sort( ns_samples.begin(), ns_samples.end() );
+   sort( cycle_samples.begin(), cycle_samples.end() );
+
+   BenchResult result;
+   result.name          = name;
+   result.bytes         = bytes;
+   result.ns_per_op     = ns_samples[ns_samples.size() / 2];
+   result.cycles_per_op = MICRO_BENCH_HAVE_TSC ? cycle_samples[cycle_samples.size() / 2] : 0.0;
+   result.mbytes_per_sec = ( result.ns_per_op > 0.0 )
+                              ? ( ( (double)bytes / result.ns_per_op ) * 1000.0 )
+                              : 0.0;
+   results.push_back( result );
+
+   cout << left << setw( 44 ) << result.name
+        << right << fixed << setprecision( 1 )
+        << setw( 14 ) << result.ns_per_op << " ns/op"
+        << setw( 14 ) << result.cycles_per_op << " cyc/op"
+        << setw( 12 ) << setprecision( 0 ) << result.mbytes_per_sec << " MB/s"
+        << endl;
+}
+
+// -----------------------------------------------------------------------
+// Scalar byteswap kernel benchmarks. Each operation swaps every element of
+// the array, which mirrors the inner loop of the transmission-byteswap
+// copy in Attribute::pack_attribute_buffer()/unpack_attribute_buffer().
+// -----------------------------------------------------------------------
+
+/*! @brief Array payload for the element-wise byteswap kernels. */
+template < typename T >
+class SwapArray
+{
+  public:
+   vector< T > src;  //!< Source elements.
+   vector< T > dest; //!< Destination elements.
+
+   explicit SwapArray( size_t const count )
+      : src( count ),
+        dest( count )
+   {
+      for ( size_t i = 0; i < count; ++i ) {
+         src[i] = (T)( ( i * 2654435761UL ) & 0xFF );
+      }
+   }
+};
+
+static void op_swap_short( void *arg )
+{
+   SwapArray< short > *a = static_cast< SwapArray< short > * >( arg );
+   size_t const count = a->src.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      a->dest[i] = Utilities::byteswap_short( a->src[i] );
+   }
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_int( void *arg )
+{
+   SwapArray< int > *a = static_cast< SwapArray< int > * >( arg );
+   size_t const count = a->src.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      a->dest[i] = Utilities::byteswap_int( a->src[i] );
+   }
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_long_long( void *arg )
+{
+   SwapArray< long long > *a = static_cast< SwapArray< long long > * >( arg );
+   size_t const count = a->src.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      a->dest[i] = Utilities::byteswap_long_long( a->src[i] );
+   }
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_float( void *arg )
+{
+   SwapArray< float > *a = static_cast< SwapArray< float > * >( arg );
+   size_t const count = a->src.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      a->dest[i] = Utilities::byteswap_float( a->src[i] );
+   }
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_double( void *arg )
+{
+   SwapArray< double > *a = static_cast< SwapArray< double > * >( arg );
+   size_t const count = a->src.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      a->dest[i] = Utilities::byteswap_double( a->src[i] );
+   }
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_2_byte_array( void *arg )
+{
+   SwapArray< short > *a = static_cast< SwapArray< short > * >( arg );
+   Utilities::byteswap_2_byte_array( &a->dest[0], &a->src[0], a->src.size() );
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_4_byte_array( void *arg )
+{
+   SwapArray< int > *a = static_cast< SwapArray< int > * >( arg );
+   Utilities::byteswap_4_byte_array( &a->dest[0], &a->src[0], a->src.size() );
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_swap_8_byte_array( void *arg )
+{
+   SwapArray< double > *a = static_cast< SwapArray< double > * >( arg );
+   Utilities::byteswap_8_byte_array( &a->dest[0], &a->src[0], a->src.size() );
+   do_not_optimize( &a->dest[0] );
+}
+
+static void op_memcpy_double( void *arg )
+{
+   SwapArray< double > *a = static_cast< SwapArray< double > * >( arg );
+   memcpy( &a->dest[0], &a->src[0], a->src.size() * sizeof( double ) );
+   do_not_optimize( &a->dest[0] );
+}
+
+/*! @brief Run the scalar and bulk byteswap kernels for one element count.
+ *  @param count Number of array elements. */
+static void run_byteswap_benchmarks( size_t const count )
+{
+   ostringstream tag;
+   tag << count;
+
+   SwapArray< short >     short_array( count );
+   SwapArray< int >       int_array( count );
+   SwapArray< long long > long_long_array( count );
+   SwapArray< float >     float_array( count );
+   SwapArray< double >    double_array( count );
+
+   run_benchmark( "byteswap_short[" + tag.str() + "]", count * sizeof( short ), op_swap_short, &short_array );
+   run_benchmark( "byteswap_int[" + tag.str() + "]", count * sizeof( int ), op_swap_int, &int_array );
+   run_benchmark( "byteswap_long_long[" + tag.str() + "]", count * sizeof( long long ), op_swap_long_long, &long_long_array );
+   run_benchmark( "byteswap_float[" + tag.str() + "]", count * sizeof( float ), op_swap_float, &float_array );
+   run_benchmark( "byteswap_double[" + tag.str() + "]", count * sizeof( double ), op_swap_double, &double_array );
+   run_benchmark( "byteswap_2_byte_array[" + tag.str() + "]", count * sizeof( short ), op_swap_2_byte_array, &short_array );
+   run_benchmark( "byteswap_4_byte_array[" + tag.str() + "]", count * sizeof( int ), op_swap_4_byte_array, &int_array );
+   run_benchmark( "byteswap_8_byte_array[" + tag.str() + "]", count * sizeof( double ), op_swap_8_byte_array, &double_array );
+   run_benchmark( "memcpy_double[" + tag.str() + "]", count * sizeof( double ), op_memcpy_double, &double_array );
+}
+
+// -----------------------------------------------------------------------
+// OpaqueBuffer push/pull benchmarks. These exercise the same buffer code
+// the lag compensation and packing data buffers use, with and without a
+// transmission byteswap.
+// -----------------------------------------------------------------------
+
+/*! @brief Payload and buffer state for the OpaqueBuffer benchmarks. */
+class PushPullPayload
+{
+  public:
+   OpaqueBuffer     opaque_buffer; //!< Buffer under test.
+   vector< double > data;          //!< Push source / pull destination payload.
+   EncodingEnum     encoding;      //!< Encoding used for the push/pull calls.
+
+   /*! @param bytes Payload size in bytes.
+    *  @param enc   Push/pull encoding. */
+   PushPullPayload( size_t const bytes, EncodingEnum const enc )
+      : data( bytes / sizeof( double ) ),
+        encoding( enc )
+   {
+      for ( size_t i = 0; i < data.size(); ++i ) {
+         data[i] = (double)i;
+      }
+      opaque_buffer.ensure_buffer_capacity( bytes );
+   }
+};
+
+static void op_push_bulk( void *arg )
+{
+   PushPullPayload *p = static_cast< PushPullPayload * >( arg );
+   p->opaque_buffer.reset_push_position();
+   p->opaque_buffer.push_to_buffer( &p->data[0], p->data.size() * sizeof( double ), p->encoding );
+}
+
+static void op_pull_bulk( void *arg )
+{
+   PushPullPayload *p = static_cast< PushPullPayload * >( arg );
+   p->opaque_buffer.reset_pull_position();
+   p->opaque_buffer.pull_from_buffer( &p->data[0], p->data.size() * sizeof( double ), p->encoding );
+   do_not_optimize( &p->data[0] );
+}
+
+// The byteswap in byteswap_buffer_copy() only applies to the scalar sizes
+// (1, 2, 4 and 8 bytes), so the byteswap path is exercised the way the
+// pack code uses it: one push/pull call per element.
+static void op_push_per_element( void *arg )
+{
+   PushPullPayload *p = static_cast< PushPullPayload * >( arg );
+   p->opaque_buffer.reset_push_position();
+   size_t const count = p->data.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      p->opaque_buffer.push_to_buffer( &p->data[i], sizeof( double ), p->encoding );
+   }
+}
+
+static void op_pull_per_element( void *arg )
+{
+   PushPullPayload *p = static_cast< PushPullPayload * >( arg );
+   p->opaque_buffer.reset_pull_position();
+   size_t const count = p->data.size();
+   for ( size_t i = 0; i < count; ++i ) {
+      p->opaque_buffer.pull_from_buffer( &p->data[i], sizeof( double ), p->encoding );
+   }
+   do_not_optimize( &p->data[0] );
+}
+
+/*! @brief Run the OpaqueBuffer push/pull benchmarks for one payload size.
+ *  @param bytes Payload size in bytes. */
+static void run_opaque_buffer_benchmarks( size_t const bytes )
+{
+   ostringstream tag;
+   tag << bytes;
+
+   // ENCODING_NONE is the straight copy path, while ENCODING_BIG_ENDIAN
+   // byteswaps on little-endian hosts (and ENCODING_LITTLE_ENDIAN is
+   // used so that the byteswap path is also timed on big-endian hosts).
+   EncodingEnum const swap_encoding =
+      Utilities::is_transmission_byteswap( ENCODING_BIG_ENDIAN )
+         ? ENCODING_BIG_ENDIAN
+         : ENCODING_LITTLE_ENDIAN;
+
+   PushPullPayload raw_payload( bytes, ENCODING_NONE );
+   PushPullPayload swap_payload( bytes, swap_encoding );
+
+   // Fill the buffer once so that the pull benchmarks read valid data.
+   op_push_bulk( &raw_payload );
+   op_push_per_element( &swap_payload );
+
+   run_benchmark( "opaque_push_bulk_raw[" + tag.str() + "]", bytes, op_push_bulk, &raw_payload );
+   run_benchmark( "opaque_pull_bulk_raw[" + tag.str() + "]", bytes, op_pull_bulk, &raw_payload );
+   run_benchmark( "opaque_push_per_double_raw[" + tag.str() + "]", bytes, op_push_per_element, &raw_payload );
+   run_benchmark( "opaque_pull_per_double_raw[" + tag.str() + "]", bytes, op_pull_per_element, &raw_payload );
+   run_benchmark( "opaque_push_per_double_byteswap[" + tag.str() + "]", bytes, op_push_per_element, &swap_payload );
+   run_benchmark( "opaque_pull_per_double_byteswap[" + tag.str() + "]", bytes, op_pull_per_element, &swap_payload );
+}
+
+// -----------------------------------------------------------------------
+// Baseline save/compare support for regression gating.
+// -----------------------------------------------------------------------
+
+/*! @brief Write the results of this run to a CSV baseline file.
+ *  @param filename Baseline file to write.
+ *  @return True on success. */
+static bool save_baseline( string const &filename )
+{
+   ofstream file( filename.c_str() );
+   if ( !file.is_open() ) {
+      cerr << "micro_bench: ERROR: Could not write baseline file '"
+           << filename << "'." << endl;
+      return false;
+   }
+   file << "name,bytes,ns_per_op,cycles_per_op" << endl;
+   for ( size_t i = 0; i < results.size(); ++i ) {
+      file << results[i].name << ','
+           << results[i].bytes << ','
+           << results[i].ns_per_op << ','
+           << results[i].cycles_per_op << endl;
+   }
+   cout << endl
+        << "Saved baseline for " << results.size()
+        << " benchmarks to '" << filename << "'." << endl;
+   return true;
+}
+
+/*! @brief Compare the results of this run against a CSV baseline file.
+ *  @param filename      Baseline file to compare against.
+ *  @param threshold_pct Allowed per-benchmark regression in percent.
+ *  @return True when no benchmark regressed beyond the threshold. */
+static bool compare_baseline( string const &filename, double const threshold_pct )
+{
+   ifstream file( filename.c_str() );
+   if ( !file.is_open() ) {
+      cerr << "micro_bench: ERROR: Could not read baseline file '"
+           << filename << "'." << endl;
+      return false;
+   }
+
+   map< string, double > baseline_ns;
+   string                line;
+   getline( file, line ); // Skip the header line.
+   while ( getline( file, line ) ) {
+      istringstream fields( line );
+      string        name, bytes_str, ns_str;
+      if ( getline( fields, name, ',' )
+           && getline( fields, bytes_str, ',' )
+           && getline( fields, ns_str, ',' ) ) {
+         baseline_ns[name] = atof( ns_str.c_str() );
+      }
+   }
+
+   cout << endl
+        << "Comparison against baseline '" << filename
+        << "' (threshold " << threshold_pct << "%):" << endl;
+
+   int regressions = 0;
+   for ( size_t i = 0; i < results.size(); ++i ) {
+      map< string, double >::const_iterator iter = baseline_ns.find( results[i].name );
+      if ( iter == baseline_ns.end() ) {
+         cout << left << setw( 44 ) << results[i].name
+              << "not in baseline, skipped" << endl;
+         continue;
+      }
+      double const base_ns = iter->second;
+      double const delta_pct = ( base_ns > 0.0 )
+                                  ? ( ( ( results[i].ns_per_op - base_ns ) / base_ns ) * 100.0 )
+                                  : 0.0;
+      bool const regressed = ( delta_pct > threshold_pct );
+      cout << left << setw( 44 ) << results[i].name
+           << right << fixed << setprecision( 1 )
+           << setw( 12 ) << base_ns << " ns/op base"
+           << setw( 10 ) << showpos << delta_pct << noshowpos << " %"
+           << ( regressed ? "  REGRESSION" : "" ) << endl;
+      if ( regressed ) {
+         ++regressions;
+      }
+   }
+
+   if ( regressions > 0 ) {
+      cout << endl
+           << "FAILED: " << regressions << " benchmark"
+           << ( ( regressions == 1 ) ? "" : "s" )
+           << " regressed beyond the " << threshold_pct << "% threshold." << endl;
+      return false;
+   }
+   cout << endl
+        << "PASSED: No benchmark regressed beyond the "
+        << threshold_pct << "% threshold." << endl;
+   return true;
+}
+
+/*! @brief Print the command line usage. */
+static void print_usage()
+{
+   cout << "Usage: micro_bench [options]" << endl
+        << "Options:" << endl
+        << "  --save <file>      Save the results as a CSV baseline file." << endl
+        << "  --compare <file>   Compare against a CSV baseline file and exit" << endl
+        << "                     non-zero when a benchmark regresses beyond" << endl
+        << "                     the threshold." << endl
+        << "  --threshold <pct>  Allowed regression percentage for --compare," << endl
+        << "                     default: 10." << endl
+        << "  --reps <count>     Timed repetitions per benchmark, default: 15." << endl
+        << "  --help             Show this usage message." << endl;
+}
+
+int main( int argc, char *argv[] )
+{
+   string save_file;
+   string compare_file;
+   double threshold_pct = 10.0;
+
+   for ( int i = 1; i < argc; ++i ) {
+      string const arg = argv[i];
+      if ( ( arg == "--save" ) && ( ( i + 1 ) < argc ) ) {
+         save_file = argv[++i];
+      } else if ( ( arg == "--compare" ) && ( ( i + 1 ) < argc ) ) {
+         compare_file = argv[++i];
+      } else if ( ( arg == "--threshold" ) && ( ( i + 1 ) < argc ) ) {
+         threshold_pct = atof( argv[++i] );
+      } else if ( ( arg == "--reps" ) && ( ( i + 1 ) < argc ) ) {
+         timed_reps = atoi( argv[++i] );
+         if ( timed_reps < 1 ) {
+            timed_reps = 1;
+         }
+      } else if ( arg == "--help" ) {
+         print_usage();
+         return 0;
+      } else {
+         cerr << "micro_bench: ERROR: Unknown option '" << arg << "'." << endl;
+         print_usage();
+         return 1;
+      }
+   }
+
+   // The OpaqueBuffer allocations go through the Trick Memory Manager, so
+   // bring one up for this process.
+   memory_manager = new Trick::MemoryManager();
+
+   cout << "TrickHLA encode/decode microbenchmarks ("
+        << timed_reps << " timed repetitions, median reported"
+        << ( MICRO_BENCH_HAVE_TSC ? ", TSC cycle counts" : ", no TSC on this host" )
+        << "):" << endl
+        << endl;
+
+   // Element counts spanning small scalar attributes up to large arrays.
+   size_t const element_counts[] = { 16, 1024, 65536, 1048576 };
+   for ( size_t i = 0; i < sizeof( element_counts ) / sizeof( element_counts[0] ); ++i ) {
+      run_byteswap_benchmarks( element_counts[i] );
+   }
+   cout << endl;
+
+   // Payload sizes spanning typical object update sizes.
+   size_t const payload_sizes[] = { 64, 4096, 65536, 1048576 };
+   for ( size_t i = 0; i < sizeof( payload_sizes ) / sizeof( payload_sizes[0] ); ++i ) {
+      run_opaque_buffer_benchmarks( payload_sizes[i] );
+   }
+
+   bool success = true;
+   if ( !compare_file.empty() ) {
+      success = compare_baseline( compare_file, threshold_pct );
+   }
+   if ( !save_file.empty() && !save_baseline( save_file ) ) {
+      success = false;
+   }
+
+   delete memory_manager;
+   return success ? 0 : 1;
+}
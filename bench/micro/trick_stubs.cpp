@@ -0,0 +1,71 @@
+/*!
+@file bench/micro/trick_stubs.cpp
+@ingroup TrickHLA
+@brief Minimal Trick executive and messaging stubs for the standalone
+microbenchmark harness.
+
+The benchmarked TrickHLA translation units call the Trick messaging and
+executive C interfaces, which are normally provided by a running Trick
+simulation. The harness links the Trick Memory Manager library for the
+TMM allocation calls and provides these process-level stand-ins for the
+rest: messages go straight to the standard streams and a terminate
+request exits the process.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" {
+
+int send_hs( FILE *fp, char const *format, ... )
+{
+   va_list args;
+   va_start( args, format );
+   int const status = vfprintf( fp, format, args );
+   va_end( args );
+   return status;
+}
+
+int message_publish( int level, char const *format, ... )
+{
+   va_list args;
+   va_start( args, format );
+   int const status = vfprintf( ( level > 0 ) ? stderr : stdout, format, args );
+   va_end( args );
+   return status;
+}
+
+int exec_terminate( char const *file_name, char const *error )
+{
+   fprintf( stderr, "TERMINATE from %s: %s\n", file_name, error );
+   exit( 1 );
+   return 1;
+}
+
+int exec_terminate_with_return( int ret_code, char const *file_name, int line, char const *error )
+{
+   fprintf( stderr, "TERMINATE from %s:%d: %s\n", file_name, line, error );
+   exit( ret_code );
+   return ret_code;
+}
+
+} // extern "C"
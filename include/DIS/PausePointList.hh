@@ -92,6 +92,27 @@ class PausePointList : public TrickHLA::TimedSyncPntList
     *  @param label The synchronization point label. */
    virtual bool clear_sync_point( std::wstring const &label );
 
+   // Bring the label based achieve overloads into scope alongside the
+   // override below.
+   using TrickHLA::SyncPntListBase::achieve_sync_point;
+
+   /*! @brief Achieve the given pause point, maintaining the achieved count
+    *  so check_state() does not have to scan the list.
+    *  @return True if achieved, false otherwise.
+    *  @param RTI_amb  Reference to RTI Ambassador.
+    *  @param sync_pnt Specified synchronization point. */
+   virtual bool achieve_sync_point( RTI1516_NAMESPACE::RTIambassador &RTI_amb,
+                                    TrickHLA::SyncPnt                *sync_pnt );
+
+   /*! @brief Mark the given pause point as synchronized in the federation,
+    *  maintaining the achieved count.
+    *  @return True if synchronization point label is valid.
+    *  @param label The synchronization point label. */
+   virtual bool mark_synchronized( std::wstring const &label );
+
+   /*! @brief Clear out the list of pause points. */
+   virtual void reset();
+
    /*! @brief Check the state of the sync-points to determine if the state
     * needs to go to Freeze or Run. */
    void check_state();
@@ -137,6 +158,8 @@ class PausePointList : public TrickHLA::TimedSyncPntList
   private:
    PausePointStateEnum state; ///< @trick_units{--} State of the pause points.
 
+   int achieved_count; ///< @trick_units{--} Count of the pause points in the achieved state, maintained so check_state() is constant time.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for PausePointList class.
@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../source/TrickHLA/Parameter.cpp}
 @trick_link_dependency{../../source/IMSim/FreezeInteractionHandler.cpp}
 
 @revs_title
@@ -50,6 +51,11 @@ NASA, Johnson Space Center\n
 #include RTI1516_HEADER
 #pragma GCC diagnostic pop
 
+namespace TrickHLA
+{
+class Parameter;
+}
+
 namespace IMSim
 {
 
@@ -99,6 +105,13 @@ class FreezeInteractionHandler : public TrickHLA::InteractionHandler
    double time; /**< @trick_units{s} Scenario Time on which to freeze
                      simulation execution on a major frame boundary. */
 
+   TrickHLA::Parameter *time_parameter; /**< @trick_io{**} Parameter bound to the
+                     freeze time variable, resolved once for the preencoded payload. */
+
+   RTI1516_NAMESPACE::ParameterHandleValueMap preencoded_parameters; /**< @trick_io{**}
+                     Preencoded freeze interaction payload template, only the
+                     freeze time is patched in at send time. */
+
    //
    // Private methods
    //
@@ -111,6 +124,17 @@ class FreezeInteractionHandler : public TrickHLA::InteractionHandler
       return ( ( v1 == v2 ) || ( ( v2 > v1 ) ? ( ( v2 - v1 ) < 0.000001 ) : ( ( v1 - v2 ) < 0.000001 ) ) );
    }
 
+   /*! @brief Build the preencoded freeze interaction payload template, which
+    *  resolves the parameter handles and any fixed fields, on the first send.
+    *  @return True if the preencoded payload is ready to use. */
+   bool prepare_preencoded_payload();
+
+   /*! @brief Patch the freeze time into the preencoded payload and send the
+    *  interaction using Timestamp Order.
+    *  @return True if the interaction was sent; False otherwise.
+    *  @param send_HLA_time The HLA logical time to send the interaction. */
+   bool send_preencoded_freeze_interaction( double const send_HLA_time );
+
   private:
    // Do not allow the copy constructor or assignment operator.
    FreezeInteractionHandler( FreezeInteractionHandler const &rhs );
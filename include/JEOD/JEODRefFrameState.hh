@@ -113,6 +113,16 @@ class JEODRefFrameState : public SpaceFOM::RefFrameBase
    jeod::TimeTT        *time_tt;         ///< trick_units{--}  JEOD TT time standard.
    jeod::RefFrameState *ref_frame_state; ///< @trick_units{--} JEOD reference frame state.
 
+   bool direct_copy_compatible; ///< @trick_io{**} True when the JEOD and SpaceFOM state layouts allow bulk span copies, determined once in initialize().
+
+   /*! @brief Determine if the JEOD reference frame state and the SpaceFOM
+    *  packing data layouts are compatible with direct bulk span copies.
+    *  @details Both sides use SI units with no conversions, so compatibility
+    *  reduces to the attitude quaternion scalar and vector being contiguous
+    *  doubles in both representations.
+    *  @return True if bulk span copies can be used, false otherwise. */
+   bool is_direct_copy_compatible() const;
+
   private:
    // This object is not copyable
    /*! @brief Copy constructor for JEODRefFrameState class.
@@ -114,6 +114,21 @@ class DynamicalEntityBase : virtual public SpaceFOM::PhysicalEntityBase
     *  pe_packing_data object into the working data object(s). */
    virtual void unpack_into_working_data() = 0;
 
+  public:
+   bool use_dirty_flags; ///< @trick_units{--} True to only re-derive the packing fields flagged dirty by the dynamics model; false (default) to re-derive every field each pack.
+
+   // Dirty flags set by the dynamics model when it updates the corresponding
+   // working data. The pack path only re-derives flagged fields and the
+   // conditional send logic consumes and clears the flags, so a coasting
+   // entity with constant forces costs neither the derivation nor the send.
+   // All the flags start dirty so the first pack publishes every field.
+   bool force_dirty;        ///< @trick_units{--} Force working data changed since the last send.
+   bool torque_dirty;       ///< @trick_units{--} Torque working data changed since the last send.
+   bool mass_dirty;         ///< @trick_units{--} Mass working data changed since the last send.
+   bool mass_rate_dirty;    ///< @trick_units{--} Mass rate working data changed since the last send.
+   bool inertia_dirty;      ///< @trick_units{--} Inertia matrix working data changed since the last send.
+   bool inertia_rate_dirty; ///< @trick_units{--} Inertia rate matrix working data changed since the last send.
+
   protected:
    // Setup Object Attribute references. These are set in initialize_callback
    // routine and used for efficiency and ownership transfer in unpack routines.
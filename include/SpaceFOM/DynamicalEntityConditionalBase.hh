@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
+@trick_link_dependency{../../source/TrickHLA/ConditionalBatch.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../../source/SpaceFOM/DynamicalEntityConditionalBase.cpp}
 
@@ -82,8 +83,7 @@ class DynamicalEntityConditionalBase : public SpaceFOM::PhysicalEntityConditiona
    virtual bool should_send( TrickHLA::Attribute *attr );
 
   protected:
-   DynamicalEntityBase &de_entity;    ///< @trick_units{--} @trick_io{**} Associated DynamicalEntity.
-   DynamicalEntityData  prev_de_data; ///< @trick_units{--} @trick_io{**} Previous comparison data.
+   DynamicalEntityBase &de_entity; ///< @trick_units{--} @trick_io{**} Associated DynamicalEntity.
 
    // Setup Object Attribute references. These are set in initialize_callback
    // routine and used for efficiency and ownership transfer in unpack routines.
@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 @python_module{SpaceFOM}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
 @trick_link_dependency{../../source/TrickHLA/ExecutionControlBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
@@ -48,6 +49,7 @@ NASA, Johnson Space Center\n
 // HLA include files.
 
 // TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/Types.hh"
@@ -242,6 +244,10 @@ class ExecutionControl : public TrickHLA::ExecutionControlBase
     * freeze, tell other federates to run. */
    virtual void exit_freeze();
 
+   /*! @brief Set the mode transition requested flag, stamping the request
+    * time for the request-to-transition latency statistics. */
+   virtual void set_mode_transition_requested();
+
    // SpaceFOM extensions.
    virtual bool set_pending_mtr( MTREnum mtr_value );
    /*! @brief Determine if the Mode Transition Request (MTR) is valid given the current mode.
@@ -297,6 +303,15 @@ class ExecutionControl : public TrickHLA::ExecutionControlBase
    TrickHLA::Interaction *mtr_interaction;         ///< @trick_units{--} SpaceFOM Mode Transition Request (MTR) interaction.
    MTRInteractionHandler  mtr_interaction_handler; ///< @trick_units{--} SpaceFOM MTR interaction handler.
 
+   int64_t mtr_request_time; ///< @trick_io{**} Wall-clock time in microseconds when the last mode transition request was registered, zero when none pending.
+
+   TrickHLA::ElapsedTimeStats mode_transition_stats; ///< @trick_units{--} Statistics of the latency from mode transition request to mode transition execution.
+
+   /*! @brief Sample the request-to-transition latency when the pending
+    * mode transition was commanded by a mode transition request.
+    *  @param label Mode transition label for the debug report. */
+   void sample_mode_transition_latency( char const *label );
+
    /*! @brief Return the relevant SpaceFOM::ExecutionConfiguration object.
     *  @return Pointer to the relevant SpaceFOM::ExecutionConfiguration object. */
    ExecutionConfiguration *get_execution_configuration();
@@ -0,0 +1,165 @@
+/*!
+@file SpaceFOM/GpuBatchCompute.hh
+@ingroup SpaceFOM
+@brief GPU offload facade for the embarrassingly-parallel batch kernels.
+
+This facade fronts an optional GPU compute path for the two batch loops
+that dominate large constellation scenarios: the batched reference frame
+transform of entity state arrays and the batched lag compensation
+propagation. The facade itself always compiles; the device layer behind it
+is only built when SPACEFOM_GPU_OFFLOAD is defined and the sim's
+S_overrides.mk compiles source/SpaceFOM/GpuBatchComputeKernels.cu with
+nvcc (or hipcc) and links it in. Without the define, or when no device is
+present at run time, every offload entry point reports failure so the
+callers fall back to their vectorized CPU loops, and batches smaller than
+the configurable offload threshold stay on the CPU where the kernel
+launch and transfer overhead would dominate.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/GpuBatchCompute.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_GPU_BATCH_COMPUTE_HH
+#define SPACEFOM_GPU_BATCH_COMPUTE_HH
+
+// System include files.
+#include <cstddef>
+
+// SpaceFOM include files.
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace SpaceFOM
+{
+
+class GpuBatchCompute
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__GpuBatchCompute();
+
+  public:
+   /*! @brief Determine if a GPU compute device is available.
+    *  @details The device is probed once on the first call and the result
+    *  is cached. Always false when the library was built without
+    *  SPACEFOM_GPU_OFFLOAD.
+    *  @return True if a GPU compute device is available. */
+   static bool is_available();
+
+   /*! @brief Set the minimum batch size offloaded to the GPU.
+    *  @details Batches smaller than the threshold are processed by the
+    *  vectorized CPU loops, where the kernel launch and host-device
+    *  transfer overhead would exceed the compute time.
+    *  @param count Minimum batch size offloaded to the GPU. */
+   static void set_offload_threshold( int const count );
+
+   /*! @brief Get the minimum batch size offloaded to the GPU.
+    *  @return Minimum batch size offloaded to the GPU. */
+   static int get_offload_threshold();
+
+   /*! @brief Determine if a batch of the given size should be offloaded.
+    *  @param count Batch size.
+    *  @return True if a device is available and the batch meets the
+    *  offload threshold. */
+   static bool should_offload( int const count );
+
+   /*! @brief Allocate a staging buffer of doubles for host-device transfers.
+    *  @details When a device is available the buffer is page-locked
+    *  (pinned) host memory so the transfers can use DMA; otherwise it is
+    *  ordinary heap memory, so the callers can stage through the same
+    *  buffer either way. Release with free_staging().
+    *  @param count Number of doubles to allocate.
+    *  @return Staging buffer, or NULL if count is zero. */
+   static double *allocate_staging( size_t const count );
+
+   /*! @brief Free a staging buffer returned by allocate_staging().
+    *  @param ptr Staging buffer to free. */
+   static void free_staging( double *ptr );
+
+   /*! @brief Apply a composed frame transform to an array of states on the GPU.
+    *  @details Applies the same math as RefFrameTree::transform_to_parent()
+    *  with one device thread per state.
+    *  @param frame_state Composed frame-to-frame transform to apply.
+    *  @param states_in   Array of states expressed in the 'from' frame.
+    *  @param states_out  Array of states expressed in the 'to' frame.
+    *  @param count       Number of states in the arrays.
+    *  @return True if the transform ran on the GPU, false if the caller
+    *  must fall back to the CPU loop. */
+   static bool transform_states( SpaceTimeCoordinateData const &frame_state,
+                                 SpaceTimeCoordinateData const *states_in,
+                                 SpaceTimeCoordinateData       *states_out,
+                                 unsigned int const             count );
+
+   /*! @brief Propagate a batch of entity lag compensation states on the GPU.
+    *  @details Steps the constant-acceleration plus quaternion-rate
+    *  derivative model used by the batch lag compensation engines, with
+    *  one device thread per entity per step and the attitude quaternion
+    *  normalized after each step. The whole sub-step loop runs against
+    *  device-resident state so the states cross the bus once each way.
+    *  @param compensate_dt Total compensation time span.
+    *  @param integ_dt      Integration time step.
+    *  @param integ_tol     Integration time tolerance.
+    *  @param use_rk2       True for midpoint (RK2) steps, false for Euler.
+    *  @param num_instances Number of entity instances.
+    *  @param states        Entity states, component major, thirteen
+    *                       components per entity in the Stand-Alone state
+    *                       order (IN/OUT).
+    *  @param acc           Entity translational accelerations, component major.
+    *  @param ang_acc       Entity rotational accelerations, component major.
+    *  @return True if the propagation ran on the GPU, false if the caller
+    *  must fall back to the CPU batch integrator. */
+   static bool propagate_entities( double const  compensate_dt,
+                                   double const  integ_dt,
+                                   double const  integ_tol,
+                                   bool const    use_rk2,
+                                   int const     num_instances,
+                                   double       *states,
+                                   double const *acc,
+                                   double const *ang_acc );
+
+  private:
+   static int offload_threshold; ///< @trick_io{**} Minimum batch size offloaded to the GPU.
+   static int device_available;  ///< @trick_io{**} Cached device probe result: -1 not yet probed, 0 no device, 1 device available.
+
+  private:
+   // Do not allow an instance of this all-static class.
+   /*! @brief Constructor for the GpuBatchCompute class.
+    *  @details This constructor is private to prevent instances. */
+   GpuBatchCompute();
+   /*! @brief Copy constructor for GpuBatchCompute class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   GpuBatchCompute( GpuBatchCompute const &rhs );
+   /*! @brief Assignment operator for GpuBatchCompute class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   GpuBatchCompute &operator=( GpuBatchCompute const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_GPU_BATCH_COMPUTE_HH: Do NOT put anything after this line!
@@ -121,6 +121,8 @@ class MTRInteractionHandler : public TrickHLA::InteractionHandler
    int send_cnt;    ///< @trick_units{count} The number of times an interaction is sent.
    int receive_cnt; ///< @trick_units{count} The number of times an interaction was received.
 
+   RTI1516_USERDATA user_supplied_tag; ///< @trick_io{**} Preencoded user-supplied tag for the outgoing interaction, rebuilt when the name is set so the mode-change critical path does not encode it at send time.
+
   private:
    // Do not allow these constructors or assignment operator.
    /*! @brief Default constructor for MTRInteractionHandler class.
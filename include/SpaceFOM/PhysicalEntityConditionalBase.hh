@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
+@trick_link_dependency{../../source/TrickHLA/ConditionalBatch.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../../source/SpaceFOM/PhysicalEntityConditionalBase.cpp}
 
@@ -37,7 +38,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/Attribute.hh"
-#include "TrickHLA/Conditional.hh"
+#include "TrickHLA/ConditionalBatch.hh"
 #include "TrickHLA/Object.hh"
 
 // SpaceFOM include files.
@@ -46,7 +47,7 @@ NASA, Johnson Space Center\n
 namespace SpaceFOM
 {
 
-class PhysicalEntityConditionalBase : public TrickHLA::Conditional
+class PhysicalEntityConditionalBase : public TrickHLA::ConditionalBatch
 {
    // Let the Trick input processor access protected and private data.
    // InputProcessor is really just a marker class (does not really
@@ -69,9 +69,21 @@ class PhysicalEntityLagComp : public PhysicalEntityLagCompInteg
    /*! @brief Entity instance initialization routine. */
    virtual void initialize();
 
+  public:
+   bool use_unrolled_integ;    ///< @trick_units{--} True (default) to propagate with the compile-time unrolled Runge-Kutta kernels; set false to use the generic Trick integrator path, which is needed when a subclass overrides the derivative model.
+   int  unrolled_integ_stages; ///< @trick_units{--} Runge-Kutta stage count for the unrolled kernels, either 2 or 4, default: 4.
+
   protected:
    double *integ_states[13]; ///< @trick_units{--} @trick_io{**} Integration states.
 
+   /*! @brief Compensate the state data from the data time to the current
+    * scenario time using the compile-time unrolled fixed-dimension
+    * Runge-Kutta kernels, falling back to the generic Trick integrator
+    * path when the unrolled kernels are disabled.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int integrate( double const t_begin, double const t_end );
+
    /*! @brief Update the latency compensation time from the integrator. */
    virtual void update_time();
 
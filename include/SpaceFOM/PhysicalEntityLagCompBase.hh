@@ -65,6 +65,11 @@ class PhysicalEntityLagCompBase : public TrickHLA::LagCompensation
    // Syntax: friend void init_attr<namespace>__<class name>();
    friend void init_attrSpaceFOM__PhysicalEntityLagCompBase();
 
+   // Make the batched lag compensation integration engines friends so
+   // they can gather and scatter the compensation state data.
+   friend class PhysicalEntityLagCompBatchInteg;
+   friend class PhysicalEntityLagCompBatchSA;
+
   public:
    // Public constructors and destructors.
    explicit PhysicalEntityLagCompBase( PhysicalEntityBase &entity_ref ); // Initialization constructor.
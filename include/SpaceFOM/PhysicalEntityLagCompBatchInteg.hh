@@ -0,0 +1,150 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompBatchInteg.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM physical entity batched
+latency/lag compensation integration engine.
+
+Instead of each entity stepping its own integrator with cold caches, the
+registered entities' states are gathered into structure-of-arrays working
+arrays (positions, velocities, attitude quaternions and their rates) and
+integrated together, so each Euler step is a set of flat loops over all
+the entities that the compiler can vectorize.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBatchInteg.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_INTEG_HH
+#define SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_INTEG_HH
+
+// System include files.
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/LagCompensationIntegBase.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+
+namespace SpaceFOM
+{
+
+class PhysicalEntityLagCompBatchInteg : public TrickHLA::LagCompensationIntegBase
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalEntityLagCompBatchInteg();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the SpaceFOM PhysicalEntityLagCompBatchInteg class. */
+   PhysicalEntityLagCompBatchInteg();
+   /*! @brief Destructor for the SpaceFOM PhysicalEntityLagCompBatchInteg class. */
+   virtual ~PhysicalEntityLagCompBatchInteg();
+
+   /*! @brief Register an entity lag compensation instance with the batch
+    *  integration engine.
+    *  @param lag_comp Entity lag compensation instance to register. */
+   void add_entity( PhysicalEntityLagCompBase &lag_comp );
+
+   /*! @brief Get the number of registered entities.
+    *  @return Number of registered entities. */
+   unsigned int get_entity_count() const
+   {
+      return ( (unsigned int)entities.size() );
+   }
+
+   /*! @brief Compensate all the registered entities' states from the data
+    *  time to the current scenario time in one batched integration pass.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step.
+    *  @return Always returns 0. */
+   int compensate( double const t_begin, double const t_end )
+   {
+      return ( integrate( t_begin, t_end ) );
+   }
+
+  protected:
+   /*! @brief Update the latency compensation time for all the registered
+    *  entities from the integrator. */
+   virtual void update_time();
+
+   /*! @brief Gather the registered entities' states into the
+    *  structure-of-arrays working arrays. */
+   virtual void load();
+
+   /*! @brief Scatter the structure-of-arrays working arrays back into the
+    *  registered entities' states. */
+   virtual void unload();
+
+   /*! @brief Compute the attitude quaternion rates for all the registered
+    *  entities.
+    *  @param user_data Any special user data needed to compute the derivative values. */
+   virtual void derivative_first( void *user_data = NULL );
+
+   /*! @brief Second time derivatives are not used by the first order
+    *  batched propagation.
+    *  @param user_data Any special user data needed to compute the derivative values. */
+   virtual void derivative_second( void *user_data = NULL );
+
+   /*! @brief Propagate all the registered entities' states from the data
+    *  time to the current scenario time.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int integrate( double const t_begin, double const t_end );
+
+  protected:
+   std::vector< PhysicalEntityLagCompBase * > entities; ///< @trick_io{**} Registered entity lag compensation instances.
+
+   // Structure-of-arrays working state, one entry per registered entity.
+   std::vector< double > pos[3];      ///< @trick_io{**} Entity positions.
+   std::vector< double > vel[3];      ///< @trick_io{**} Entity velocities.
+   std::vector< double > acc[3];      ///< @trick_io{**} Entity accelerations.
+   std::vector< double > att_s;       ///< @trick_io{**} Entity attitude quaternion scalars.
+   std::vector< double > att_v[3];    ///< @trick_io{**} Entity attitude quaternion vectors.
+   std::vector< double > qdot_s;      ///< @trick_io{**} Entity attitude quaternion rate scalars.
+   std::vector< double > qdot_v[3];   ///< @trick_io{**} Entity attitude quaternion rate vectors.
+   std::vector< double > ang_vel[3];  ///< @trick_io{**} Entity angular velocities.
+   std::vector< double > ang_acc[3];  ///< @trick_io{**} Entity angular accelerations.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalEntityLagCompBatchInteg class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompBatchInteg( PhysicalEntityLagCompBatchInteg const &rhs );
+   /*! @brief Assignment operator for PhysicalEntityLagCompBatchInteg class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompBatchInteg &operator=( PhysicalEntityLagCompBatchInteg const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_INTEG_HH: Do NOT put anything after this line!
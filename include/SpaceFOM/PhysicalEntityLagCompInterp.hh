@@ -0,0 +1,121 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompInterp.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM physical entity latency/lag
+compensation class that interpolates a history of received states.
+
+Instead of numerically integrating the latest received state forward, a
+small ring buffer of timestamped received states is kept and the
+compensated state is evaluated with cubic Hermite interpolation between
+the bracketing samples, or Hermite extrapolation beyond the newest one.
+This replaces the per-entity integrator with a few multiply-adds per
+state channel and degrades gracefully when updates arrive with jitter or
+are dropped, at the cost of the smoothing inherent to interpolation. Use
+it where that physical fidelity trade is acceptable.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompInterp.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH
+#define SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH
+
+// System include files.
+
+// Trick includes.
+
+// TrickHLA include files.
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace SpaceFOM
+{
+
+class PhysicalEntityLagCompInterp : public PhysicalEntityLagCompBase
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalEntityLagCompInterp();
+
+  public:
+   // Public constructors and destructors.
+   explicit PhysicalEntityLagCompInterp( PhysicalEntityBase &entity_ref ); // Initialization constructor.
+   virtual ~PhysicalEntityLagCompInterp();                                 // Destructor.
+
+   /*! @brief Entity instance initialization routine. */
+   virtual void initialize();
+
+  protected:
+   /*! @brief Compensate the state data from the data time to the current
+    * scenario time by interpolating the state history.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int compensate(
+      const double t_begin,
+      const double t_end );
+
+   /*! @brief Record the currently loaded state as a timestamped sample in
+    * the state history ring buffer.
+    *  @param time Scenario time of the state sample. */
+   void record_state_sample( double const time );
+
+   /*! @brief Evaluate the compensated state at the given time with cubic
+    * Hermite interpolation between the bracketing history samples, or
+    * Hermite extrapolation beyond the newest one.
+    *  @param time Scenario time to evaluate the state at. */
+   void interpolate_state( double const time );
+
+  protected:
+   enum {
+      STATE_HISTORY_SIZE = 8 ///< Capacity of the state history ring buffer.
+   };
+
+   SpaceTimeCoordinateData state_history[STATE_HISTORY_SIZE];              ///< @trick_io{**} Ring buffer of timestamped received states.
+   double                  state_history_accel[STATE_HISTORY_SIZE][3];     ///< @trick_io{**} Acceleration vector of each history sample.
+   double                  state_history_ang_accel[STATE_HISTORY_SIZE][3]; ///< @trick_io{**} Rotational acceleration vector of each history sample.
+   int                     state_history_head;                             ///< @trick_io{**} Ring buffer index of the newest sample.
+   int                     state_history_count;                            ///< @trick_io{**} Number of valid samples in the ring buffer.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalEntityLagCompInterp class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompInterp( PhysicalEntityLagCompInterp const &rhs );
+   /*! @brief Assignment operator for PhysicalEntityLagCompInterp class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompInterp &operator=( PhysicalEntityLagCompInterp const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_INTERP_HH: Do NOT put anything after this line!
@@ -68,6 +68,10 @@ class PhysicalInterfaceBase : public TrickHLA::Packing, public TrickHLA::OpaqueB
    // Make the Lag Compensation class a friend.
    friend class PhysicalInterfaceLagCompBase;
 
+   // Make the batch packing class a friend so it can fill the packing
+   // data and encode the wire buffer for a whole group in one sweep.
+   friend class PhysicalInterfaceBatchPack;
+
   public:
    // Public constructors and destructors.
    PhysicalInterfaceBase();          // Default constructor.
@@ -164,6 +168,8 @@ class PhysicalInterfaceBase : public TrickHLA::Packing, public TrickHLA::OpaqueB
    // Instantiate the attitude quaternion encoder.
    QuaternionEncoder quat_encoder; ///< @trick_units{--} Interface attitude quaternion encoder.
 
+   bool batch_packed; ///< @trick_units{--} True when a PhysicalInterfaceBatchPack group packs this interface.
+
    /*! @brief Print out the interface data values.
     *  @param stream Output stream. */
    virtual void print_data( std::ostream &stream = std::cout );
@@ -0,0 +1,132 @@
+/*!
+@file SpaceFOM/PhysicalInterfaceBatchPack.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM physical interface batch
+packing class.
+
+A group of PhysicalInterface instances whose states all come from one
+computation, for instance the joints of a robotic arm kinematic chain,
+can be registered with this class together with a single provider
+callback. The provider fills one contiguous state array for the whole
+group in one call and the group sweep copies the states into the
+interfaces' packing data and encodes the wire buffers, instead of each
+interface going through its own virtual pack dispatch.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/PhysicalInterfaceBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalInterfaceBatchPack.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_INTERFACE_BATCH_PACK_HH
+#define SPACEFOM_PHYSICAL_INTERFACE_BATCH_PACK_HH
+
+// System include files.
+#include <vector>
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalInterfaceBase.hh"
+
+namespace SpaceFOM
+{
+
+class PhysicalInterfaceBatchPack
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalInterfaceBatchPack();
+
+  public:
+   /*! @brief Group state provider callback.
+    *
+    * The provider fills the contiguous state array for the whole group in
+    * one call. Each registered interface occupies STATE_STRIDE doubles in
+    * registration order: position (3), attitude quaternion scalar (1) and
+    * attitude quaternion vector (3).
+    *
+    *  @param num_interfaces Number of registered interfaces (IN).
+    *  @param states         Contiguous group state array (OUT).
+    *  @param udata          Additional user data for the provider (IN). */
+   typedef void ( *StateProviderFunc )( int     num_interfaces,
+                                        double *states,
+                                        void   *udata );
+
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the SpaceFOM PhysicalInterfaceBatchPack class. */
+   PhysicalInterfaceBatchPack();
+   /*! @brief Destructor for the SpaceFOM PhysicalInterfaceBatchPack class. */
+   virtual ~PhysicalInterfaceBatchPack();
+
+   /*! @brief Register an interface with the batch packing group. The
+    *  interface's own pack() becomes a no-op since the group sweep fills
+    *  its packing data and encodes its wire buffer.
+    *  @param interface Interface packing instance to register. */
+   void add_interface( PhysicalInterfaceBase &interface );
+
+   /*! @brief Get the number of registered interfaces.
+    *  @return Number of registered interfaces. */
+   unsigned int get_interface_count() const
+   {
+      return ( (unsigned int)interfaces.size() );
+   }
+
+   /*! @brief Set the group state provider callback.
+    *  @param provider Group state provider callback.
+    *  @param udata    Additional user data passed to the provider. */
+   void set_provider( StateProviderFunc provider, void *udata = NULL );
+
+   /*! @brief Pack the whole group in one sweep: call the provider once to
+    *  fill the contiguous state array, then copy the states into the
+    *  registered interfaces' packing data and encode the wire buffers.
+    *  Call as a scheduled job before the TrickHLA data send job. */
+   void pack_group();
+
+   static int const STATE_STRIDE; ///< Number of doubles per interface in the contiguous state array.
+
+  protected:
+   std::vector< PhysicalInterfaceBase * > interfaces; ///< @trick_io{**} Registered interface packing instances.
+
+   std::vector< double > states; ///< @trick_io{**} Contiguous group state array, STATE_STRIDE doubles per interface.
+
+   StateProviderFunc provider;       ///< @trick_io{**} Group state provider callback.
+   void             *provider_udata; ///< @trick_io{**} User data passed to the provider.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalInterfaceBatchPack class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalInterfaceBatchPack( PhysicalInterfaceBatchPack const &rhs );
+   /*! @brief Assignment operator for PhysicalInterfaceBatchPack class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalInterfaceBatchPack &operator=( PhysicalInterfaceBatchPack const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_INTERFACE_BATCH_PACK_HH: Do NOT put anything after this line!
@@ -221,6 +221,28 @@ class QuaternionData
       double const v_in[3],
       double       v_out[3] ) const;
 
+   /*! @brief Transform a packed array of vectors using this quaternion.
+    *  @details The quaternion is expanded into the equivalent transformation
+    *  matrix once for the whole batch, so this is much cheaper than calling
+    *  transform_vector() per vector when rotating many vectors by the same
+    *  attitude. The output array may be the same array as the input.
+    *  @param v_in  Packed source vectors, three doubles per vector.
+    *  @param v_out Packed transformed vectors, three doubles per vector.
+    *  @param count Number of vectors in the arrays. */
+   void transform_vectors(
+      double const *v_in,
+      double       *v_out,
+      int const     count ) const;
+
+   /*! @brief Conjugate transform a packed array of vectors using this quaternion.
+    *  @param v_in  Packed source vectors, three doubles per vector.
+    *  @param v_out Packed transformed vectors, three doubles per vector.
+    *  @param count Number of vectors in the arrays. */
+   void conjugate_transform_vectors(
+      double const *v_in,
+      double       *v_out,
+      int const     count ) const;
+
    /***********************************************************************
     * Static methods.
     ***********************************************************************/
@@ -93,6 +93,21 @@ class QuaternionEncoder : public TrickHLA::OpaqueBuffer
    rti1516e::HLAfixedArray  vector_encoder; ///< @trick_io{**} Quaternion vector encoder
    rti1516e::HLAfixedRecord encoder;        ///< @trick_io{**} Attitude quaternion encoder
 
+   bool use_fast_encoding; ///< @trick_io{**} True when the precomputed fixed-layout fast path was validated against the encoder objects.
+
+  protected:
+   /*! @brief Validate the precomputed fixed-layout fast path against the
+    *  encoder objects.
+    *  @return True if the fast path produces the same encoding. */
+   bool verify_fast_encoding();
+
+   /*! @brief Encode the quaternion data directly into the buffer using the
+    *  precomputed fixed record layout. */
+   void encode_fast();
+   /*! @brief Decode the quaternion data directly from the buffer using the
+    *  precomputed fixed record layout. */
+   void decode_fast();
+
   private:
    // This object is not copyable
    /*! @brief Copy constructor for QuaternionEncoder class.
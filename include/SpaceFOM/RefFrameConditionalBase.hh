@@ -83,10 +83,25 @@ class RefFrameConditionalBase : public TrickHLA::Conditional
   public:
    bool debug; ///< @trick_units{--} Debug output flag.
 
+   double pos_epsilon;     ///< @trick_units{m} Position delta magnitude below which a state update is suppressed, default: 0.0 (send on any change).
+   double att_epsilon;     ///< @trick_units{rad} Attitude rotation angle below which a state update is suppressed, default: 0.0 (send on any change).
+   double resend_interval; ///< @trick_units{s} Maximum scenario time between state updates when the deltas stay below the epsilons, default: 0.0 (disabled).
+
   protected:
    RefFrameBase &frame;     ///< @trick_units{--} @trick_io{**} Associated RefFrame.
    RefFrameData  prev_data; ///< @trick_units{--} @trick_io{**} Previous comparison data.
 
+   double last_state_send_time; ///< @trick_io{**} Scenario time of the last state update that was sent.
+
+   /*! @brief Determine if the state has moved far enough from the last sent
+    *  state to warrant an update, based on the configured epsilons.
+    *  @details Any change in the velocity or angular velocity is always
+    *  significant since it invalidates a subscriber's local propagation of
+    *  the frame; the position and attitude deltas are compared against the
+    *  pos_epsilon and att_epsilon values.
+    *  @return True if the state delta exceeds the configured epsilons. */
+   virtual bool is_state_delta_significant() const;
+
    TrickHLA::Attribute *name_attr;        ///< @trick_io{**} Reference frame name Attribute.
    TrickHLA::Attribute *parent_name_attr; ///< @trick_io{**} Parent reference frame name Attribute.
    TrickHLA::Attribute *state_attr;       ///< @trick_io{**} Reference frame state Attribute.
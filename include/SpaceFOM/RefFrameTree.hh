@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @python_module{SpaceFOM}
 
 @tldh
+@trick_link_dependency{../../source/SpaceFOM/GpuBatchCompute.cpp}
 @trick_link_dependency{../../source/SpaceFOM/RefFrameBase.cpp}
 @trick_link_dependency{../../source/SpaceFOM/RefFrameTree.cpp}
 
@@ -41,11 +42,15 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // TrickHLA include files.
 
 // SpaceFOM include files.
 #include "SpaceFOM/RefFrameBase.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
 
 namespace SpaceFOM
 {
@@ -94,9 +99,110 @@ class RefFrameTree
    RefFrameBase *find_common_base( RefFrameBase *child_1,
                                    RefFrameBase *child_2 );
 
+   /*! @brief Transform a space-time coordinate state expressed in one
+    *  reference frame into another reference frame.
+    *  @details The frame-to-frame path is resolved through the precomputed
+    *  transform path cache.
+    *  @param state_in State expressed in the 'from' frame.
+    *  @param state_out State expressed in the 'to' frame.
+    *  @param from_frame_name Name of the frame the input state is expressed in.
+    *  @param to_frame_name Name of the frame to express the state in.
+    *  @return True on success, false if either frame is not in the tree or
+    *  the frames do not share a common base frame. */
+   bool transform_state( SpaceTimeCoordinateData const &state_in,
+                         SpaceTimeCoordinateData       &state_out,
+                         char const                    *from_frame_name,
+                         char const                    *to_frame_name );
+
+   /*! @brief Transform an array of space-time coordinate states expressed
+    *  in one reference frame into another reference frame.
+    *  @details The cached frame-to-frame path is composed into a single
+    *  equivalent transform once and then applied to all the states in one
+    *  loop, so transforming many states between the same two frames only
+    *  walks the tree on the first call.
+    *  @param states_in Array of states expressed in the 'from' frame.
+    *  @param states_out Array of states expressed in the 'to' frame.
+    *  @param count Number of states in the arrays.
+    *  @param from_frame_name Name of the frame the input states are expressed in.
+    *  @param to_frame_name Name of the frame to express the states in.
+    *  @return True on success, false if either frame is not in the tree or
+    *  the frames do not share a common base frame. */
+   bool transform_states( SpaceTimeCoordinateData const *states_in,
+                          SpaceTimeCoordinateData       *states_out,
+                          unsigned int const             count,
+                          char const                    *from_frame_name,
+                          char const                    *to_frame_name );
+
+   /*! @brief Invalidate the cached frame-to-frame transform paths.
+    *  @details Called whenever the tree mutates so the cached paths are
+    *  rebuilt on the next transform request. */
+   void invalidate_transform_paths();
+
+   /*! @brief Get the frames of the tree flattened into depth order.
+    *  @details Every frame appears after its parent frame, so a single
+    *  linear sweep over the returned array visits parents before children.
+    *  The array is rebuilt lazily after a tree mutation.
+    *  @return Frames in depth order, parents before children. */
+   std::vector< RefFrameBase * > const &get_frames_in_depth_order();
+
+  protected:
+   /*! @brief A cached path between a pair of reference frames through
+    *  their lowest common ancestor frame. */
+   struct TransformPath {
+      std::vector< RefFrameBase * > up_chain;   ///< @trick_io{**} Frames walked up from the 'from' frame to, but not including, the common base frame.
+      std::vector< RefFrameBase * > down_chain; ///< @trick_io{**} Frames walked down from just below the common base frame to the 'to' frame.
+   };
+
+   /*! @brief Get the cached transform path between two frames, building and
+    *  caching it on the first request for the frame pair.
+    *  @param from_frame The frame the path starts from.
+    *  @param to_frame The frame the path ends at.
+    *  @return Pointer to the cached path, or NULL if the frames do not
+    *  share a common base frame. */
+   TransformPath const *get_transform_path( RefFrameBase *from_frame,
+                                            RefFrameBase *to_frame );
+
+   /*! @brief Compose the current frame states along a cached path into the
+    *  single equivalent transform expressing the 'from' frame in the 'to'
+    *  frame.
+    *  @param path Cached transform path.
+    *  @param combined Composed 'from' frame state expressed in the 'to' frame. */
+   static void compute_path_transform( TransformPath const    &path,
+                                       SpaceTimeCoordinateData &combined );
+
+   /*! @brief Transform a state expressed in a frame into that frame's
+    *  parent frame.
+    *  @param frame_state State of the frame expressed in its parent frame.
+    *  @param state_in State expressed in the frame.
+    *  @param state_out State expressed in the parent frame. */
+   static void transform_to_parent( SpaceTimeCoordinateData const &frame_state,
+                                    SpaceTimeCoordinateData const &state_in,
+                                    SpaceTimeCoordinateData       &state_out );
+
+   /*! @brief Transform a state expressed in a frame's parent frame into
+    *  the frame.
+    *  @param frame_state State of the frame expressed in its parent frame.
+    *  @param state_in State expressed in the parent frame.
+    *  @param state_out State expressed in the frame. */
+   static void transform_to_child( SpaceTimeCoordinateData const &frame_state,
+                                   SpaceTimeCoordinateData const &state_in,
+                                   SpaceTimeCoordinateData       &state_out );
+
   protected:
-   // Map used to build and manage the reference frame tree.
-   std::map< std::string, RefFrameBase * > ref_frame_map;
+   // Hash map used to build and manage the reference frame tree, giving
+   // O(1) frame lookup by name.
+   std::unordered_map< std::string, RefFrameBase * > ref_frame_map;
+
+   // Cache of the resolved frame-to-frame transform paths, keyed on the
+   // {from, to} frame pair and invalidated when the tree mutates.
+   std::map< std::pair< RefFrameBase *, RefFrameBase * >, TransformPath > transform_path_map; ///< @trick_io{**} Cached frame pair transform paths.
+
+   std::vector< RefFrameBase * > depth_ordered_frames; ///< @trick_io{**} Frames flattened into depth order, parents before children.
+   bool                          depth_order_stale;    ///< @trick_io{**} True when the tree mutated and the depth ordered frame array must be rebuilt.
+
+   /*! @brief Rebuild the flattened depth ordered frame array from the
+    *  current contents of the frame map. */
+   void rebuild_depth_order();
 
   private:
    // This object is not copyable
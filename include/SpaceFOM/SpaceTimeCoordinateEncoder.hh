@@ -105,6 +105,21 @@ class SpaceTimeCoordinateEncoder : public TrickHLA::OpaqueBuffer
 
    rti1516e::HLAfixedRecord encoder; ///< @trick_io{**} Space/Time coordinate encoder
 
+   bool use_fast_encoding; ///< @trick_io{**} True when the precomputed fixed-layout fast path was validated against the encoder objects.
+
+  protected:
+   /*! @brief Validate the precomputed fixed-layout fast path against the
+    *  encoder objects.
+    *  @return True if the fast path produces the same encoding. */
+   bool verify_fast_encoding();
+
+   /*! @brief Encode the space-time coordinate data directly into the buffer
+    *  using the precomputed fixed record layout. */
+   void encode_fast();
+   /*! @brief Decode the space-time coordinate data directly from the buffer
+    *  using the precomputed fixed record layout. */
+   void decode_fast();
+
   private:
    // This object is not copyable
    /*! @brief Copy constructor for SpaceTimeCoordinateEncoder class.
@@ -0,0 +1,147 @@
+/*!
+@file TrickHLA/AdaptiveSleepTimeout.hh
+@ingroup TrickHLA
+@brief TrickHLA adaptive spin-then-sleep timer for use in wait loops.
+
+Waits start out busy-spinning with processor pause hints for a configurable
+spin budget to catch short waits with minimal latency, then exponentially
+back off to nanosleep() with absolute deadlines to avoid burning CPU on long
+waits. Per-instance statistics record how often the spin budget was enough
+so the budget can be tuned from measured wakeup latencies.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AdaptiveSleepTimeout.cpp}
+@trick_link_dependency{../../source/TrickHLA/SleepTimeout.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ADAPTIVE_SLEEP_TIMEOUT_HH
+#define TRICKHLA_ADAPTIVE_SLEEP_TIMEOUT_HH
+
+// System include files.
+#include <cstdint>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/SleepTimeout.hh"
+
+#define THLA_DEFAULT_SPIN_BUDGET_IN_MICROS ( (long)50 )
+#define THLA_MIN_BACKOFF_SLEEP_IN_MICROS ( (long)25 )
+#define THLA_LOW_LATENCY_MAX_BACKOFF_IN_MICROS ( (long)500 )
+
+namespace TrickHLA
+{
+
+class AdaptiveSleepTimeout : public SleepTimeout
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AdaptiveSleepTimeout();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA AdaptiveSleepTimeout class. */
+   AdaptiveSleepTimeout();
+
+   /*! @brief Constructor for TrickHLA AdaptiveSleepTimeout class, uses the
+    *  default spin budget and maximum sleep time.
+    *  @param timeout_seconds Timeout time in seconds. */
+   explicit AdaptiveSleepTimeout( double const timeout_seconds );
+
+   /*! @brief Constructor for the TrickHLA AdaptiveSleepTimeout class.
+    *  @param timeout_seconds Timeout time in seconds.
+    *  @param sleep_micros Maximum backoff sleep time in microseconds.
+    *  @param spin_budget_micros Busy-spin budget in microseconds at the
+    *  start of each wait before backing off to sleeping. */
+   AdaptiveSleepTimeout( double const timeout_seconds,
+                         long const   sleep_micros,
+                         long const   spin_budget_micros );
+
+   /*! @brief Destructor for the TrickHLA AdaptiveSleepTimeout class. */
+   virtual ~AdaptiveSleepTimeout();
+
+   /*! @brief Spin with processor pause hints while within the spin budget
+    *  for this wait, otherwise sleep with an exponentially increasing
+    *  backoff up to the configured maximum sleep time.
+    *  @return Integer value of 0 for success, otherwise non-zero for an error. */
+   virtual int const sleep() const;
+
+   /*! @brief Reset the internal timeout time, start a new wait episode and
+    *  update the wait statistics for the episode that just ended. */
+   virtual void reset();
+
+   /*! @brief Get the number of wait episodes that completed within the spin
+    *  budget without ever sleeping.
+    *  @return Number of spin-only wait episodes. */
+   uint64_t const get_spin_only_wait_count() const;
+
+   /*! @brief Get the total number of wait episodes.
+    *  @return Number of wait episodes. */
+   uint64_t const get_wait_count() const;
+
+   /*! @brief Get a summary of the wait statistics for tuning the spin budget.
+    *  @return Wait statistics summary string. */
+   std::string const get_statistics() const;
+
+   /*! @brief Print the wait statistics summary for this wait site to the
+    *  standard output stream.
+    *  @param wait_site Name identifying the wait site for this timer. */
+   void print_statistics( char const *wait_site ) const;
+
+  protected:
+   long spin_budget_micros; ///< @trick_io{**} Busy-spin budget in microseconds at the start of each wait.
+   long max_sleep_micros;   ///< @trick_io{**} Maximum backoff sleep time in microseconds.
+
+   mutable int64_t wait_start_time;      ///< @trick_io{**} Wall clock time in microseconds when the current wait episode started, -1 for none.
+   mutable long    backoff_micros;       ///< @trick_io{**} Current exponential backoff sleep time in microseconds.
+   mutable bool    slept_this_wait;      ///< @trick_io{**} True if the current wait episode has slept.
+   mutable uint64_t wait_cnt;            ///< @trick_io{**} Total number of wait episodes.
+   mutable uint64_t spin_only_wait_cnt;  ///< @trick_io{**} Number of wait episodes resolved within the spin budget.
+   mutable uint64_t spin_cnt;            ///< @trick_io{**} Total number of spin passes.
+   mutable uint64_t sleep_cnt;           ///< @trick_io{**} Total number of backoff sleeps.
+   mutable uint64_t total_wait_micros;   ///< @trick_io{**} Accumulated wait time in microseconds over all episodes.
+
+  private:
+   /*! @brief Account for the wait episode that just ended, if any. */
+   void finish_wait_episode() const;
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AdaptiveSleepTimeout class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AdaptiveSleepTimeout( AdaptiveSleepTimeout const &rhs );
+   /*! @brief Assignment operator for AdaptiveSleepTimeout class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AdaptiveSleepTimeout &operator=( AdaptiveSleepTimeout const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ADAPTIVE_SLEEP_TIMEOUT_HH: Do NOT put anything after this line!
@@ -0,0 +1,137 @@
+/*!
+@file TrickHLA/AllocationTracker.hh
+@ingroup TrickHLA
+@brief Subsystem-tagged allocation accounting for the TrickHLA memory
+consumers.
+
+The instrumented allocation sites tag each allocation, resize and free
+with a subsystem identifier, and this class maintains per-subsystem
+current byte, peak byte and live allocation counters with relaxed atomic
+updates, so mid-run resident set growth is attributable to a subsystem in
+production without attaching a heap profiler.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AllocationTracker.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ALLOCATION_TRACKER_HH
+#define TRICKHLA_ALLOCATION_TRACKER_HH
+
+// System includes
+#include <string>
+
+namespace TrickHLA
+{
+
+class AllocationTracker
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AllocationTracker();
+
+  public:
+   /*! @brief Subsystems the instrumented allocation sites are tagged with. */
+   typedef enum {
+
+      SUBSYS_FIRST_VALUE       = 0, ///< Set to the First value in the enumeration.
+      SUBSYS_ATTRIBUTE_BUFFERS = 0, ///< Attribute staging, snapshot, delta and chunk buffers.
+      SUBSYS_PARAMETER_BUFFERS = 1, ///< Parameter staging buffers.
+      SUBSYS_OPAQUE_BUFFERS    = 2, ///< OpaqueBuffer byte buffers used by the packing encoders.
+      SUBSYS_ITEM_QUEUES       = 3, ///< Interaction items held by the receive and deferred dispatch queues.
+      SUBSYS_REFLECTED_QUEUES  = 4, ///< Encoded attribute values held by the reflected attributes queues.
+      SUBSYS_CHECKPOINT_DATA   = 5, ///< Checkpoint-able copies of the queued interactions.
+      SUBSYS_COUNT             = 6  ///< Number of subsystems, must be last.
+
+   } Subsystem;
+
+   /*! @brief Record an allocation or capacity growth for a subsystem.
+    * Relaxed atomics, safe to call from any thread. An old byte count of
+    * zero counts as a new live allocation.
+    *  @param subsystem Subsystem the allocation site is tagged with.
+    *  @param old_byte_count Byte count before the allocation, zero for a new allocation.
+    *  @param new_byte_count Byte count after the allocation. */
+   static void record_resize( Subsystem const subsystem,
+                              long long const old_byte_count,
+                              long long const new_byte_count );
+
+   /*! @brief Record a new allocation for a subsystem. Relaxed atomics,
+    * safe to call from any thread.
+    *  @param subsystem Subsystem the allocation site is tagged with.
+    *  @param byte_count Byte count of the allocation. */
+   static void record_alloc( Subsystem const subsystem, long long const byte_count )
+   {
+      record_resize( subsystem, 0, byte_count );
+   }
+
+   /*! @brief Record a freed allocation for a subsystem. Relaxed atomics,
+    * safe to call from any thread.
+    *  @param subsystem Subsystem the allocation site is tagged with.
+    *  @param byte_count Byte count of the freed allocation. */
+   static void record_free( Subsystem const subsystem, long long const byte_count );
+
+   /*! @brief Get the current byte count for a subsystem.
+    *  @return Current byte count.
+    *  @param subsystem Subsystem to query. */
+   static long long get_current_bytes( Subsystem const subsystem );
+
+   /*! @brief Get the peak byte count for a subsystem.
+    *  @return Peak byte count.
+    *  @param subsystem Subsystem to query. */
+   static long long get_peak_bytes( Subsystem const subsystem );
+
+   /*! @brief Get the live allocation count for a subsystem.
+    *  @return Live allocation count.
+    *  @param subsystem Subsystem to query. */
+   static long long get_allocation_count( Subsystem const subsystem );
+
+   /*! @brief Summarize the current and peak byte counts and the live
+    * allocation counts of every subsystem.
+    *  @return Summary string with one line per subsystem. */
+   static std::string to_string();
+
+  private:
+   static char const *const subsystem_names[SUBSYS_COUNT]; ///< @trick_io{**} Subsystem names for the summary report.
+
+   static long long current_bytes[SUBSYS_COUNT];     ///< @trick_io{**} Current byte count per subsystem.
+   static long long peak_bytes[SUBSYS_COUNT];        ///< @trick_io{**} Peak byte count per subsystem.
+   static long long allocation_counts[SUBSYS_COUNT]; ///< @trick_io{**} Live allocation count per subsystem.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AllocationTracker class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AllocationTracker( AllocationTracker const &rhs );
+   /*! @brief Assignment operator for AllocationTracker class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AllocationTracker &operator=( AllocationTracker const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ALLOCATION_TRACKER_HH
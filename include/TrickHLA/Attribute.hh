@@ -21,6 +21,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
+@trick_link_dependency{../../source/TrickHLA/AttributeBufferPool.cpp}
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
@@ -41,6 +42,8 @@ NASA, Johnson Space Center\n
 #include <map>
 #include <stdlib.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Trick include files.
 #include "trick/reference.h"
@@ -96,6 +99,23 @@ class Attribute
 
    double cycle_time; ///< @trick_units{s} Send the cyclic attribute at the specified rate.
 
+   bool zero_copy_send; ///< @trick_units{--} True to encode sent updates directly from the Trick simulation variable, skipping the staging buffer.
+
+   bool skip_unchanged_updates; ///< @trick_units{--} True to suppress cyclic updates when the encoded data has not changed since the last sent update. Leave false for attributes that must be sent unconditionally.
+
+   int max_chunk_size; ///< @trick_units{--} Maximum number of value bytes sent per update for the ENCODING_CHUNKED rti_encoding, which bounds the per-frame encode and decode cost, default: 65536.
+
+   //
+   // Wire-traffic accounting counters. Accumulated by the attribute encode
+   // and decode paths and by the unchanged-update suppression check, and
+   // summarized by the wire-traffic top-talkers report at shutdown.
+   //
+   long long updates_sent_count;       ///< @trick_units{--} Attribute updates encoded for sending.
+   long long updates_received_count;   ///< @trick_units{--} Attribute reflections decoded from received data.
+   long long bytes_sent_count;         ///< @trick_units{--} Total encoded attribute bytes sent.
+   long long bytes_received_count;     ///< @trick_units{--} Total encoded attribute bytes received.
+   long long updates_suppressed_count; ///< @trick_units{--} Cyclic updates suppressed because the encoded data was unchanged since the last sent update.
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -132,11 +152,27 @@ class Attribute
       this->config = c;
    }
 
+   /*! @brief Determine if this attribute is configured as initialization-only,
+    * meaning it is sent at initialization and on explicit attribute update
+    * requests but is excluded from the cyclic and zero-lookahead send paths.
+    *  @return True if the attribute is initialization-only. */
+   bool is_initialize_only() const
+   {
+      return ( ( config & CONFIG_INITIALIZE ) == CONFIG_INITIALIZE )
+             && ( ( config & CONFIG_CYCLIC ) != CONFIG_CYCLIC )
+             && ( ( config & CONFIG_ZERO_LOOKAHEAD ) != CONFIG_ZERO_LOOKAHEAD );
+   }
+
    /*! @brief Determine the cycle-ratio given the core job cycle rate and the
     * cycle-time for this attribute.
     *  @param core_job_cycle_time Core job cycle time in seconds. */
    void determine_cycle_ratio( double const core_job_cycle_time );
 
+   /*! @brief Fault in the pages of the staging buffer from the calling
+    * thread so the operating system places them on the calling thread's
+    * NUMA node under the default first-touch placement policy. */
+   void first_touch_buffer();
+
    /*! @brief Pack the attribute into the buffer using the appropriate encoding. */
    void pack_attribute_buffer();
 
@@ -148,10 +184,99 @@ class Attribute
     *  @return The attribute value that contains the buffer of the encoded attribute. */
    RTI1516_NAMESPACE::VariableLengthData get_attribute_value();
 
+   /*! @brief Fill in the encoded attribute value in place, avoiding a data
+    *  copy when the zero-copy send mode is active for this attribute.
+    *  @details When zero-copy send is active the attribute value references
+    *  the Trick simulation variable memory (or the staging buffer when a
+    *  byteswap is required) instead of copying the data, so the attribute
+    *  value must be handed to the RTI before the next data cycle updates the
+    *  simulation variable.
+    *  @param attr_value The attribute value to fill in. */
+   void get_attribute_value( RTI1516_NAMESPACE::VariableLengthData &attr_value );
+
+   /*! @brief Determine if this attribute supports the zero-copy send mode
+    *  based on its type and RTI encoding.
+    *  @return True if zero-copy send is supported, false otherwise. */
+   bool is_zero_copy_send_supported() const;
+
+   /*! @brief Determine if the encoded attribute data has changed since the
+    *  last sent update, and if so snapshot the data as the new last sent
+    *  update.
+    *  @details Used by the cyclic send path to suppress updates for
+    *  unchanged data when 'skip_unchanged_updates' is enabled. The first
+    *  call always reports changed data so an initial update is sent.
+    *  @return True if the data changed since the last sent update. */
+   bool is_data_changed_since_last_sent();
+
    /*! @brief Extract the data out of the HLA Attribute Value.
     *  @param attr_value The variable length data buffer containing the attribute value.
+    *  @param borrow_data True to borrow the attribute value storage in place
+    *  instead of staging a copy in the buffer, in which case the storage
+    *  must stay valid until unpack_attribute_buffer() has been called.
     *  @return True if successfully extracted data, false otherwise. */
-   bool extract_data( RTI1516_NAMESPACE::VariableLengthData const *attr_value );
+   bool extract_data( RTI1516_NAMESPACE::VariableLengthData const *attr_value,
+                      bool const                                   borrow_data = false );
+
+   /*! @brief Drop any borrowed reference to received attribute value
+    * storage, called before that storage is released. */
+   void drop_borrowed_data()
+   {
+      this->borrowed_data = NULL;
+   }
+
+   /*! @brief Determine if a chunk stream send of an ENCODING_CHUNKED value
+    * snapshot is still in progress.
+    *  @return True if more chunks of the current value remain to be sent. */
+   bool is_chunk_send_in_progress() const
+   {
+      return this->chunk_send_active;
+   }
+
+   /*! @brief Register a callback invoked when a complete ENCODING_CHUNKED
+    * value has been reassembled from its received chunks. The callback is
+    * invoked on the thread processing the received data, just before the
+    * reassembled value is decoded into the simulation variable.
+    *  @param callback Callback function, NULL to unregister.
+    *  @param user_arg User argument passed to the callback. */
+   void register_chunk_complete_callback( void ( *callback )( Attribute *attr, void *user_arg ),
+                                          void *user_arg )
+   {
+      this->chunk_complete_callback = callback;
+      this->chunk_complete_user_arg = user_arg;
+   }
+
+   /*! @brief Register a stable user-owned buffer for an attribute with the
+    * ENCODING_OPAQUE_DATA rti_encoding, which makes the opaque data path
+    * copy free. On a send the buffer is handed to the RTI in place with no
+    * staging copy, and on a receive the payload is decoded directly into
+    * the buffer with no staging copy and no reallocation of the simulation
+    * variable. The first 4 bytes of the buffer are reserved for the
+    * HLAopaqueData length prefix maintained by TrickHLA, so the payload
+    * starts at byte 4 (see get_user_buffer_payload()) and the usable
+    * payload capacity is 4 bytes less than the buffer capacity. The buffer
+    * must remain valid and stable for the life of the federation execution.
+    *  @param data     Stable user-owned buffer of at least capacity bytes.
+    *  @param capacity Total buffer capacity in bytes, including the 4 byte
+    *  length prefix.
+    *  @param length   Pointer to the payload byte count, which is read when
+    *  an update is sent and updated when an update is received. */
+   void register_user_buffer( unsigned char *data, size_t const capacity, int *length );
+
+   /*! @brief Determine if a user-owned buffer has been registered.
+    *  @return True if a user-owned buffer has been registered. */
+   bool is_user_buffer_registered() const
+   {
+      return ( this->user_buffer != NULL );
+   }
+
+   /*! @brief Get the payload region of the registered user-owned buffer,
+    * which starts after the reserved 4 byte length prefix.
+    *  @return Payload region of the user-owned buffer, NULL if no buffer
+    *  has been registered. */
+   unsigned char *get_user_buffer_payload()
+   {
+      return ( this->user_buffer != NULL ) ? ( this->user_buffer + 4 ) : NULL;
+   }
 
    /*! @brief Determine if an attribute was received from another federate.
     *  @return True if new attribute value has been received. */
@@ -193,6 +318,34 @@ class Attribute
       return trick_name;
    }
 
+   /*! @brief Request that the byte buffer for this attribute be carved
+    * from the shared AttributeBufferPool instead of getting its own Trick
+    * Memory Manager allocation, so buffers for consecutively initialized
+    * objects are laid out contiguously in iteration order. Must be called
+    * before the attribute is initialized. */
+   void use_buffer_pool()
+   {
+      this->pooled_buffer_requested = true;
+   }
+
+   /*! @brief Declare that the staging byte buffer for this attribute does
+    * not need to be part of a Trick checkpoint, which allows a buffer at or
+    * above the AttributeBufferPool huge-page threshold to be carved from a
+    * huge-page backed slab. The staging buffer is re-encoded from the
+    * simulation variables every data cycle, so this is safe for simulations
+    * that do not rely on checkpoint and restore of the staging buffer
+    * contents. Must be called before the attribute is initialized. */
+   void disable_buffer_checkpoint()
+   {
+      this->buffer_checkpoint_required = false;
+   }
+
+   /*! @brief Rebuild the staging byte buffer after a checkpoint restore
+    * when it was allocated outside checkpointed memory, at its
+    * checkpointed capacity. A no-op for a Trick Memory Manager allocated
+    * buffer, which the restore repopulates directly. */
+   void reinstate_transient_buffer();
+
    /*! @brief Determine if the attribute is published.
     *  @return True if attribute is published. */
    bool is_publish() const
@@ -315,6 +468,13 @@ class Attribute
       return ( ( cycle_ratio <= 1 ) || ( cycle_cnt <= 0 ) );
    }
 
+   /*! @brief Get the ratio of the attribute cycle-time to the core job cycle-time.
+    *  @return The cycle ratio, a value of 1 is for sending every cycle. */
+   int const get_cycle_ratio() const
+   {
+      return cycle_ratio;
+   }
+
    /*! @brief Determine is the data cycle is ready for sending data.
     *  @return True if the data cycle is ready for a send, false otherwise.*/
    bool const check_data_cycle_ready() // RETURN: -- True if the data cycle is ready for a send, false otherwise.
@@ -354,6 +514,23 @@ class Attribute
       this->update_requested = request_update;
    }
 
+   /*! @brief Determine if updates for this attribute are turned on, which
+    * is true unless the RTI attribute relevance advisory has told us no
+    * remote federate subscribes to this attribute.
+    *  @return True if updates are turned on. */
+   bool is_update_turned_on() const
+   {
+      return update_turned_on;
+   }
+
+   /*! @brief Set the attribute updates turned on flag from the RTI
+    * attribute relevance advisory.
+    *  @param turned_on Updates turned on flag. */
+   void set_update_turned_on( bool const turned_on )
+   {
+      this->update_turned_on = turned_on;
+   }
+
    /*! @brief Get the RTI attribute handle.
     *  @return The RTI AttributeHandle associate with this attribute. */
    RTI1516_NAMESPACE::AttributeHandle get_attribute_handle() const
@@ -408,6 +585,11 @@ class Attribute
 
       // Determine if we need to do a byteswap for data transmission.
       byteswap = Utilities::is_transmission_byteswap( rti_encoding );
+
+      // The codec plan depends on the encoding, so resolve it again.
+      if ( ref2 != NULL ) {
+         resolve_buffer_copy_codec();
+      }
    }
 
    /*! @brief Determines if the attribute is static in size.
@@ -426,7 +608,24 @@ class Attribute
     *  @return The size in bytes of the attribute. */
    size_t get_attribute_size();
 
+   /*! @brief Invalidate the cached resolved {address, size, count} record
+    *  for a dynamically sized attribute array. Must be called after a
+    *  checkpoint restore or after the underlying Trick Memory Manager
+    *  allocation has been resized in place so the size is re-derived from
+    *  the Trick ATTRIBUTES metadata on the next pack or unpack. */
+   void invalidate_resolved_address_cache()
+   {
+      this->resolved_array_valid = false;
+   }
+
   private:
+   /*! @brief Resolve the buffer copy codec plan for this attribute.
+    *  @details Resolves the Trick type, encoding, and endianness decisions
+    *  once into a specialized buffer copy kernel so the cyclic encode and
+    *  decode hot path is a single indirect call instead of re-dispatching
+    *  on the type and encoding for every update. */
+   void resolve_buffer_copy_codec();
+
    /*! @brief Calculates the attribute size in bytes and the number of items it contains. */
    void calculate_size_and_number_of_items();
 
@@ -437,11 +636,40 @@ class Attribute
     *  @param capacity Desired capacity of the buffer in bytes. */
    void ensure_buffer_capacity( size_t capacity );
 
+   /*! @brief Allocate the attribute buffer for the current buffer capacity,
+    * carving it from the shared AttributeBufferPool when requested. */
+   void allocate_buffer();
+
    /*! @brief Determines if the HLA object attribute type is supported given
     *         the RTI encoding.
     *  @return True if supported, false otherwise. */
    bool is_supported_attribute_type() const;
 
+   /*! @brief Encode the packed attribute value into an ENCODING_DELTA frame,
+    * which is either a sparse set of byte runs that differ from the last
+    * sent value or a periodic full refresh frame. */
+   void encode_delta_frame();
+
+   /*! @brief Decode an ENCODING_DELTA frame into the attribute buffer by
+    * applying the sparse byte runs to the previously received value, or by
+    * taking the full value from a refresh frame.
+    *  @return True if the frame was decoded, false otherwise.
+    *  @param frame      Received delta frame.
+    *  @param frame_size Size in bytes of the received delta frame. */
+   bool decode_delta_frame( unsigned char const *frame, size_t const frame_size );
+
+   /*! @brief Encode the next ENCODING_CHUNKED frame from the packed attribute
+    * value, starting a new value stream if no stream is in progress. */
+   void encode_chunk_frame();
+
+   /*! @brief Decode an ENCODING_CHUNKED frame by copying the chunk payload
+    * into the reassembly buffer, and move the completed value into the
+    * attribute buffer once the final chunk has been received.
+    *  @return True if the final chunk completed the value, false otherwise.
+    *  @param frame      Received chunk frame.
+    *  @param frame_size Size in bytes of the received chunk frame. */
+   bool decode_chunk_frame( unsigned char const *frame, size_t const frame_size );
+
    /*! @brief Encode a boolean attribute into the buffer using the HLAboolean
     * data type which is encoded as a HLAinteger32BE. */
    void encode_boolean_to_buffer();
@@ -450,6 +678,15 @@ class Attribute
     * data type which is encoded as a HLAinteger32BE. */
    void decode_boolean_from_buffer() const;
 
+   /*! @brief Encode a boolean attribute into the buffer as a packed bitfield
+    * with eight bool elements per byte, see ENCODING_PACKED_BITS in Types.hh. */
+   void encode_packed_bits_to_buffer();
+
+   /*! @brief Decode a boolean attribute from the buffer holding a packed
+    * bitfield with eight bool elements per byte, see ENCODING_PACKED_BITS in
+    * Types.hh. */
+   void decode_packed_bits_from_buffer() const;
+
    /*! @brief Encode the object attribute using the HLAlogicalTime 64-bit
     * integer encoding. */
    void encode_logical_time() const;
@@ -489,6 +726,13 @@ class Attribute
    unsigned char *buffer;          ///< @trick_units{--} Byte buffer for the attribute value bytes.
    size_t         buffer_capacity; ///< @trick_units{count} The capacity of the buffer.
 
+   bool pooled_buffer_requested; ///< @trick_io{**} True to carve the byte buffer from the shared AttributeBufferPool.
+   bool buffer_pooled;           ///< @trick_io{**} True when the byte buffer was carved from the pool and must not be freed or resized in place.
+
+   bool buffer_checkpoint_required; ///< @trick_io{**} True (the default) when the byte buffer must be checkpointable, which excludes the huge-page backed slabs.
+
+   unsigned char const *borrowed_data; ///< @trick_io{**} Borrowed pointer to the received attribute value bytes, only valid until the unpack consumes it, NULL otherwise.
+
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
    size_t size;      ///< @trick_units{count} The size of the attribute in bytes.
@@ -498,10 +742,58 @@ class Attribute
 
    bool update_requested; ///< @trick_units{--} Flag to indicate another federate has requested an attribute update.
 
+   bool update_turned_on; ///< @trick_io{**} False when the attribute relevance advisory has told us no remote federate subscribes to this attribute.
+
    unsigned int HLAtrue; ///< @trick_units{--} A 32-bit integer with a value of 1 on a Big Endian computer.
 
    bool byteswap; ///< @trick_units{--} Flag to indicate byte-swap before RTI Rx/Tx.
 
+   bool zero_copy_active; ///< @trick_units{--} True when the zero-copy send mode has been validated and enabled for this attribute.
+
+   void ( *buffer_copy_fn )( void *dest, void const *src, size_t const length, size_t const num_bytes ); ///< @trick_io{**} Codec plan: buffer copy kernel specialized on the Trick type and byteswap, resolved at initialization.
+
+   void  *resolved_array_address;   ///< @trick_io{**} Cached dereferenced array address for a dynamically sized attribute array.
+   size_t resolved_array_size;      ///< @trick_io{**} Cached size in bytes for the resolved attribute array.
+   size_t resolved_array_num_items; ///< @trick_io{**} Cached number of items for the resolved attribute array.
+   bool   resolved_array_valid;     ///< @trick_io{**} True when the resolved array record is valid.
+
+   unsigned char *last_sent_buffer;   ///< @trick_units{--} Snapshot of the encoded data for the last sent update.
+   size_t         last_sent_capacity; ///< @trick_units{count} The capacity of the last sent data snapshot buffer.
+   size_t         last_sent_size;     ///< @trick_units{count} The size in bytes of the last sent data snapshot.
+   bool           last_sent_valid;    ///< @trick_units{--} True once a last sent data snapshot has been taken.
+
+   unsigned char *delta_ref_buffer;      ///< @trick_io{**} ENCODING_DELTA reference: the last full value sent, which deltas are computed against.
+   size_t         delta_ref_capacity;    ///< @trick_io{**} The capacity of the delta reference buffer.
+   size_t         delta_ref_size;        ///< @trick_io{**} The size in bytes of the delta reference value.
+   bool           delta_ref_valid;       ///< @trick_io{**} True once a delta reference value has been taken.
+   unsigned char *delta_frame_buffer;    ///< @trick_io{**} Encoded ENCODING_DELTA frame staged for sending.
+   size_t         delta_frame_capacity;  ///< @trick_io{**} The capacity of the delta frame buffer.
+   size_t         delta_frame_size;      ///< @trick_io{**} The size in bytes of the staged delta frame.
+   unsigned int   delta_sends_since_full;///< @trick_io{**} Updates sent since the last full refresh frame.
+   bool           delta_rx_ref_valid;    ///< @trick_io{**} True once the receive side holds a full value deltas can be applied to.
+
+   unsigned char *chunk_frame_buffer;   ///< @trick_io{**} Encoded ENCODING_CHUNKED frame staged for sending.
+   size_t         chunk_frame_capacity; ///< @trick_io{**} The capacity of the chunk frame buffer.
+   size_t         chunk_frame_size;     ///< @trick_io{**} The size in bytes of the staged chunk frame.
+   size_t         chunk_send_offset;    ///< @trick_io{**} Byte offset into the value snapshot of the next chunk to send.
+   size_t         chunk_send_total;     ///< @trick_io{**} Total size in bytes of the value snapshot being streamed.
+   unsigned int   chunk_send_update_id; ///< @trick_io{**} Identifier of the value update being streamed, incremented for each new value snapshot.
+   bool           chunk_send_active;    ///< @trick_io{**} True while chunks of the current value snapshot remain to be sent.
+
+   unsigned char *chunk_recv_buffer;    ///< @trick_io{**} Reassembly buffer for the value being received in chunks.
+   size_t         chunk_recv_capacity;  ///< @trick_io{**} The capacity of the reassembly buffer.
+   size_t         chunk_recv_total;     ///< @trick_io{**} Total size in bytes of the value being reassembled.
+   size_t         chunk_recv_offset;    ///< @trick_io{**} Byte offset of the next chunk expected in the reassembly buffer.
+   unsigned int   chunk_recv_update_id; ///< @trick_io{**} Identifier of the value update being reassembled.
+   bool           chunk_recv_active;    ///< @trick_io{**} True while a value reassembly is in progress.
+
+   void ( *chunk_complete_callback )( Attribute *attr, void *user_arg ); ///< @trick_io{**} Optional callback invoked when a complete ENCODING_CHUNKED value has been reassembled, NULL when not registered.
+   void *chunk_complete_user_arg;                                        ///< @trick_io{**} User argument passed to the chunk complete callback.
+
+   unsigned char *user_buffer;          ///< @trick_io{**} Registered user-owned wire buffer for ENCODING_OPAQUE_DATA, NULL when not registered.
+   size_t         user_buffer_capacity; ///< @trick_io{**} Total capacity of the user-owned buffer in bytes, including the 4 byte length prefix.
+   int           *user_buffer_length;   ///< @trick_io{**} User-owned payload byte count, read on send and updated on receive.
+
    int cycle_ratio; ///< @trick_units{--} Ratio of the attribute cycle-time to the send_cyclic_and_requested_data job cycle time.
    int cycle_cnt;   ///< @trick_units{count} Internal cycle counter used to determine when cyclic data will be sent.
 
@@ -527,6 +819,8 @@ class Attribute
 
 typedef std::map< RTI1516_NAMESPACE::AttributeHandle, Attribute * > AttributeMap; ///< @trick_io{**} Map of attributes.
 
+typedef std::vector< std::pair< RTI1516_NAMESPACE::AttributeHandle, Attribute * > > AttributeHandleIndex; ///< @trick_io{**} Flat index of attributes sorted by AttributeHandle for cache-friendly lookups.
+
 } // namespace TrickHLA
 
 #endif // TRICKHLA_ATTRIBUTE_HH
@@ -0,0 +1,166 @@
+/*!
+@file TrickHLA/AttributeBufferPool.hh
+@ingroup TrickHLA
+@brief Shared pool the attribute staging byte buffers are carved from.
+
+Attribute byte buffers that opt into the pool are carved from large
+contiguous, cache-line aligned slabs in allocation order instead of each
+getting an independent Trick Memory Manager allocation. Objects that are
+initialized consecutively, like the SpaceFOM entity objects, end up with
+their staging buffers laid out in iteration order, which improves the
+locality of the per-cycle pack loop. Large chunks that do not need to be
+checkpointable can optionally be carved from 2 MB huge-page backed slabs
+to reduce TLB misses on the per-cycle pack sweep. Pooled memory lives for
+the duration of the federation execution and is never returned to the
+pool.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AttributeBufferPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ATTRIBUTE_BUFFER_POOL_HH
+#define TRICKHLA_ATTRIBUTE_BUFFER_POOL_HH
+
+// System include files.
+#include <cstddef>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class AttributeBufferPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AttributeBufferPool();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA AttributeBufferPool class. */
+   AttributeBufferPool()
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA AttributeBufferPool class. */
+   virtual ~AttributeBufferPool()
+   {
+      return;
+   }
+
+   /*! @brief Carve a cache-line aligned chunk of at least the given capacity
+    * from the current slab, allocating a new slab when the current one does
+    * not have enough room left. The memory lives for the duration of the
+    * federation execution and cannot be individually freed or resized.
+    * Chunks at or above the huge-page threshold that do not need to be
+    * checkpointable are carved from huge-page backed slabs, with a
+    * transparent fallback to the Trick Memory Manager backed slabs.
+    *  @return Pointer to the chunk, or NULL if a slab could not be allocated.
+    *  @param capacity Requested chunk capacity in bytes.
+    *  @param checkpointable True when the chunk must live in Trick Memory
+    *  Manager managed memory so it is part of a Trick checkpoint, which
+    *  excludes the huge-page backed slabs. */
+   static unsigned char *allocate( size_t const capacity, bool const checkpointable );
+
+   /*! @brief Set the chunk size threshold at or above which non-checkpointable
+    * chunks are carved from 2 MB huge-page backed slabs, reducing TLB misses
+    * on the per-cycle pack sweep over large staging buffers. A threshold of
+    * zero (the default) disables the huge-page slabs. The huge-page slabs are
+    * anonymous memory mappings outside the Trick Memory Manager and are
+    * therefore never part of a Trick checkpoint.
+    *  @param threshold Chunk size threshold in bytes, zero to disable. */
+   static void set_huge_page_threshold( size_t const threshold );
+
+   /*! @brief Determine if a chunk of the given capacity qualifies for the
+    * huge-page backed slabs.
+    *  @return True when huge pages are enabled and the capacity is at or
+    *  above the threshold.
+    *  @param capacity Chunk capacity in bytes. */
+   static bool is_huge_page_candidate( size_t const capacity );
+
+   /*! @brief Enable or disable the transient buffer mode. When enabled,
+    * every chunk that does not need to be checkpointable is carved from the
+    * anonymous memory mapped slabs regardless of its size, so the transient
+    * wire buffers stay out of the Trick checkpoint entirely and the
+    * checkpoint only serializes state that genuinely must persist. The
+    * staging buffers are rebuilt from their checkpointed capacities after a
+    * restore.
+    *  @param enable True to keep the non-checkpointable chunks outside
+    *  Trick Memory Manager managed memory. */
+   static void set_transient_mode( bool const enable );
+
+   /*! @brief Determine if the transient buffer mode is enabled.
+    *  @return True when the transient buffer mode is enabled. */
+   static bool is_transient_mode();
+
+  private:
+   /*! @brief Carve a chunk from the huge-page backed slabs, allocating a new
+    * huge-page slab when the current one does not have enough room left. The
+    * caller must hold the pool mutex.
+    *  @return Pointer to the chunk, or NULL if a huge-page slab could not be
+    *  mapped.
+    *  @param capacity Requested chunk capacity in bytes. */
+   static unsigned char *allocate_huge_chunk( size_t const capacity );
+
+  private:
+   static size_t const SLAB_SIZE;            ///< @trick_io{**} Size of each slab carved into chunks, requests larger than this get a dedicated slab.
+   static size_t const CACHE_LINE_ALIGNMENT; ///< @trick_io{**} Alignment of each carved chunk.
+   static size_t const HUGE_PAGE_SIZE;       ///< @trick_io{**} Huge page size the huge slabs are sized in multiples of.
+
+   static MutexLock      pool_mutex;   ///< @trick_io{**} Mutex protecting the slab carving state.
+   static unsigned char *slab;         ///< @trick_io{**} Current slab chunks are carved from, NULL until the first allocation.
+   static size_t         slab_offset;  ///< @trick_io{**} Offset of the next free byte in the current slab.
+   static size_t         slab_size;    ///< @trick_io{**} Size of the current slab in bytes.
+
+   static size_t         huge_page_threshold; ///< @trick_io{**} Chunk size threshold for the huge-page slabs in bytes, zero when disabled.
+   static unsigned char *huge_slab;           ///< @trick_io{**} Current huge-page slab chunks are carved from, NULL until the first huge allocation.
+   static size_t         huge_slab_offset;    ///< @trick_io{**} Offset of the next free byte in the current huge-page slab.
+   static size_t         huge_slab_size;      ///< @trick_io{**} Size of the current huge-page slab in bytes.
+
+   static bool transient_mode; ///< @trick_io{**} True when every non-checkpointable chunk is carved from the anonymous memory mapped slabs regardless of size.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AttributeBufferPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AttributeBufferPool( AttributeBufferPool const &rhs );
+   /*! @brief Assignment operator for AttributeBufferPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AttributeBufferPool &operator=( AttributeBufferPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ATTRIBUTE_BUFFER_POOL_HH
@@ -0,0 +1,123 @@
+/*!
+@file TrickHLA/BundlePacking.hh
+@ingroup TrickHLA
+@brief Packing handler that bundles the cyclic data of several TrickHLA
+objects into a single carrier object update.
+
+Each TrickHLA object normally issues its own updateAttributeValues() call
+per cycle. For federations with many small objects the per-call RTI overhead
+dominates the payload, so this packing handler lets multiple objects that
+share a send cycle ride in one carrier HLA object. The carrier object is a
+regular TrickHLA object with a single dynamic array attribute (rti_encoding
+ENCODING_OPAQUE_DATA) whose Trick variable is the bundle_buffer member of
+this class. Each bundled object is configured like a normal TrickHLA object
+so its attributes map to Trick variables, but with its publish and subscribe
+flags turned off so the manager never sends or receives it directly. The
+sending and receiving federates must configure the same bundled objects.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/BundlePacking.cpp}
+@trick_link_dependency{../../source/TrickHLA/Packing.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_BUNDLE_PACKING_HH
+#define TRICKHLA_BUNDLE_PACKING_HH
+
+// System include files.
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/Packing.hh"
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Object;
+
+class BundlePacking : public Packing
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__BundlePacking();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA BundlePacking class. */
+   BundlePacking();
+   /*! @brief Destructor for the TrickHLA BundlePacking class. */
+   virtual ~BundlePacking();
+
+   /*! @brief Add a TrickHLA object to the set of objects bundled into the
+    * carrier object update. Objects must be added in the same order on the
+    * sending and receiving federates.
+    *  @param obj The TrickHLA object to bundle. */
+   void add_object( Object *obj );
+
+   /*! @brief Finish the initialization of this packing handler. */
+   virtual void initialize();
+
+   /*! @brief Serialize the packed cyclic attribute buffers of all the
+    * bundled objects into the carrier bundle buffer. */
+   virtual void pack();
+
+   /*! @brief Demux the received carrier bundle buffer back into the cyclic
+    * attributes of the bundled objects. */
+   virtual void unpack();
+
+  public:
+   unsigned char *bundle_buffer; /**< @trick_units{--}
+      Serialized bundle of all the bundled object attribute values. Map the
+      carrier object attribute to this variable with an rti_encoding of
+      ENCODING_OPAQUE_DATA. */
+
+  protected:
+   std::vector< Object * > bundle_objects; ///< @trick_io{**} The objects bundled into the carrier object.
+
+   std::vector< unsigned char > staging; ///< @trick_io{**} Reusable bundle serialization buffer.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BundlePacking class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BundlePacking( BundlePacking const &rhs );
+   /*! @brief Assignment operator for BundlePacking class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BundlePacking &operator=( BundlePacking const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_BUNDLE_PACKING_HH: Do NOT put anything after this line!
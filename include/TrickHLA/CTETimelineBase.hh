@@ -31,6 +31,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../../source/TrickHLA/CTETimelineBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/Timeline.cpp}
+@trick_link_dependency{../../source/TrickHLA/TscClock.cpp}
 
 @revs_title
 @revs_begin
@@ -68,6 +69,21 @@ class CTETimelineBase : public Trick::Clock, public Timeline
    friend void init_attrTrickHLA__CTETimelineBase();
 
   public:
+   /*! Clock ID selecting the calibrated invariant TSC clock source instead
+    * of a system clock, which avoids the clock_gettime call and its vDSO
+    * jitter on every time query. Falls back to CLOCK_MONOTONIC when the
+    * hardware has no invariant cycle counter. */
+   static clockid_t const CLOCK_ID_TSC = (clockid_t)-1516;
+
+   /*! Clock ID selecting the PTP Hardware Clock (PHC) of the network
+    * interface as the CTE time source (see set_PHC_device()), so federates
+    * on hosts synchronized with PTP read the same hardware timeline without
+    * NTP clock-smearing artifacts. A cached, rate-corrected offset from
+    * CLOCK_MONOTONIC_RAW is maintained so the spin-loop time queries do not
+    * pay for a device read every call. Falls back to CLOCK_REALTIME when
+    * the PHC device cannot be opened. */
+   static clockid_t const CLOCK_ID_PHC = (clockid_t)-1517;
+
    //-----------------------------------------------------------------
    // Constructors / destructors
    //-----------------------------------------------------------------
@@ -100,17 +116,45 @@ class CTETimelineBase : public Trick::Clock, public Timeline
     *  @return Default implementation always returns 0. */
    virtual int clock_stop();
 
-   /*! @brief Sets the clock ID (system clock type). */
+   /*! @brief Sets the clock ID, either a system clock type, CLOCK_ID_TSC
+    * for the calibrated invariant TSC clock source, or CLOCK_ID_PHC for the
+    * PTP hardware clock of the network interface. */
    virtual void set_clock_ID( clockid_t const id );
 
    /*! @brief Gets the current clock ID (system clock type).
     *  @return The system clock type in use. */
    virtual clockid_t get_clock_ID();
 
+   /*! @brief Sets the PTP Hardware Clock device path used by CLOCK_ID_PHC.
+    * Set this before calling set_clock_ID( CLOCK_ID_PHC ).
+    *  @param device PHC character device path (for example "/dev/ptp0"). */
+   virtual void set_PHC_device( char const *device );
+
   protected:
    clockid_t clk_id; /**<  @trick_io{**}
       System clock type used. The default clock ID is <i>CLOCK_REALTIME</i>. */
 
+   char const *phc_device; ///< @trick_units{--} PTP Hardware Clock device path, default: "/dev/ptp0".
+
+  private:
+   /*! @brief Open the PHC device and take the initial offset sample.
+    *  @return True if the PHC device is usable, false otherwise. */
+   bool initialize_PHC();
+
+   /*! @brief Resample the PHC offset and rate against CLOCK_MONOTONIC_RAW. */
+   void refresh_PHC_offset();
+
+   /*! @brief Get the current PHC time from the cached, rate-corrected
+    * offset, resampling the device when the cached sample has gone stale.
+    *  @return Current PHC time as a count of nanoseconds. */
+   long long PHC_time_in_nanoseconds();
+
+   int       phc_fd;          ///< @trick_io{**} Open file descriptor for the PHC device, -1 when closed.
+   clockid_t phc_clk_id;      ///< @trick_io{**} Dynamic clock ID derived from the PHC device descriptor.
+   long long phc_sample_phc;  ///< @trick_io{**} PHC time in nanoseconds at the last offset sample.
+   long long phc_sample_mono; ///< @trick_io{**} CLOCK_MONOTONIC_RAW time in nanoseconds at the last offset sample.
+   double    phc_rate;        ///< @trick_io{**} PHC nanoseconds per CLOCK_MONOTONIC_RAW nanosecond.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for CTETimelineBase class.
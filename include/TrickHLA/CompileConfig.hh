@@ -37,11 +37,63 @@ NASA, Johnson Space Center\n
 // Default: NO_THLA_CYCLIC_READ_TIME_STATS
 #define NO_THLA_CYCLIC_READ_TIME_STATS
 
+// Measure the time spent in each cyclic and requested data send.
+// Default: NO_THLA_CYCLIC_SEND_TIME_STATS
+#define NO_THLA_CYCLIC_SEND_TIME_STATS
+
+// Measure the time spent waiting for the HLA time advance grant.
+// Default: NO_THLA_TIME_ADV_GRANT_TIME_STATS
+#define NO_THLA_TIME_ADV_GRANT_TIME_STATS
+
+// Report the receive queue depth high-water marks and overflow drop counts
+// at federate shutdown, to detect backpressure from a stalled consumer.
+// Default: NO_THLA_QUEUE_DEPTH_STATS
+#define NO_THLA_QUEUE_DEPTH_STATS
+
+// Record static tracepoints at the data path stage boundaries into an
+// in-memory ring, dumped at federate shutdown as a Chrome-tracing /
+// Perfetto compatible JSON file. Zero cost when not defined.
+// Default: NO_THLA_TRACEPOINTS
+#define NO_THLA_TRACEPOINTS
+
+// Measure per-lock MutexLock acquisition counts, contention counts and
+// contended wait times, dumped at federate shutdown and on demand through
+// MutexLock::print_statistics().
+// Default: NO_THLA_MUTEX_LOCK_STATS
+#define NO_THLA_MUTEX_LOCK_STATS
+
 // Set to THLA_QUEUE_REFLECTED_ATTRIBUTES to enable the queue of the reflected
 // attributes values.
 // Default: THLA_QUEUE_REFLECTED_ATTRIBUTES
 #define THLA_QUEUE_REFLECTED_ATTRIBUTES
 
+// Compile-time ceiling for the debug report level. DebugHandler::show()
+// compares its level argument against this ceiling in an inline function, so
+// any debug site above the ceiling folds to a constant false and the compiler
+// drops the whole guarded block, message construction included. Debug levels
+// at or below the ceiling remain runtime configurable as before. The values
+// match the TrickHLA::DebugLevelEnum levels (0 to 11). Override on the
+// compile command line (e.g. TRICK_CFLAGS) for a leaner production build.
+// Default: 11 (DEBUG_LEVEL_FULL_TRACE, nothing compiled out)
+#ifndef THLA_MAX_COMPILED_DEBUG_LEVEL
+#   define THLA_MAX_COMPILED_DEBUG_LEVEL 11
+#endif
+
+// Fast build profile that elides steady-state-invariant validation from the
+// cyclic data path: the zero-size and supported-encoding checks in the
+// OpaqueBuffer push and pull calls become assert() statements that are only
+// active in a debug build (NDEBUG not defined) and compile to nothing
+// otherwise, and the FPU Control Word protection is no longer automatically
+// enabled on Intel CPU's (see FPU_CW_PROTECTION below). Checks that protect
+// memory safety (buffer capacity) and the configuration validation performed
+// at the initialization boundaries are always retained, so a misconfigured
+// federate still fails fast at startup. WARNING: Federates using the Pitch
+// RTI must explicitly define FPU_CW_PROTECTION when using this profile,
+// otherwise the RTI's Java runtime will silently change the floating-point
+// Mantissa precision (see the FPU_CW_PROTECTION description below).
+// Default: NO_THLA_ELIDE_HOT_PATH_CHECKS
+#define NO_THLA_ELIDE_HOT_PATH_CHECKS
+
 // Insert a compile time error if an unsupported version of Trick 17 is used.
 // Minimum supported Trick 17 version: 17.5.0
 #define MIN_TRICK_VER 17  // Set to the minimum supported Trick Major version.
@@ -79,8 +131,11 @@ NASA, Johnson Space Center\n
 // floating-point control word register to change the Mantissa Precision Control
 // Bits from 64-bit (extended double precision) to 53-bit (double precision)
 // because the Pitch RTI runs Java under the hood which causes the problem.
-// This is only supported for Intel CPU's.
-#if ( !defined( FPU_CW_PROTECTION ) && ( defined( __i386__ ) || defined( __x86_64__ ) ) )
+// This is only supported for Intel CPU's. The protection is not automatically
+// enabled when the THLA_ELIDE_HOT_PATH_CHECKS fast build profile is used, in
+// which case a federate running the Pitch RTI must define FPU_CW_PROTECTION
+// explicitly.
+#if ( !defined( FPU_CW_PROTECTION ) && !defined( THLA_ELIDE_HOT_PATH_CHECKS ) && ( defined( __i386__ ) || defined( __x86_64__ ) ) )
 #   define FPU_CW_PROTECTION
 #endif
 
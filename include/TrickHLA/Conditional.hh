@@ -72,6 +72,12 @@ class Conditional
     *  @param obj Associated object for this class. */
    virtual void initialize_callback( Object *obj );
 
+   /*! @brief Hook called once per attribute value-set creation, just before
+    * the per-attribute should_send() calls, so a batched conditional can
+    * evaluate all of its change thresholds in a single sweep. The default
+    * implementation does nothing. */
+   virtual void evaluate() { return; }
+
    /*! @brief Indicate true if the attribute data should be sent, false otherwise.
     *  @return True if the attribute data should be sent, false otherwise.
     *  @param attr Pointer to TrickHLA Attribute. */
@@ -0,0 +1,148 @@
+/*!
+@file TrickHLA/ConditionalBatch.hh
+@ingroup TrickHLA
+@brief A batched Conditional that evaluates all of an object's attribute
+change thresholds in one sweep.
+
+Change thresholds are registered as {address, count, epsilon} descriptors
+at initialization. The evaluate() hook, called once by the Object just
+before it creates the attribute value-set, sweeps all the descriptors in
+one pass over flat previous-value storage producing a per-attribute send
+bitmask, and the per-attribute should_send() calls reduce to consuming
+that bitmask. This replaces the per-attribute virtual comparison work of
+a hand written Conditional with a single kernel invocation whose inner
+loops the compiler can vectorize.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
+@trick_link_dependency{../../source/TrickHLA/ConditionalBatch.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_CONDITIONAL_BATCH_HH
+#define TRICKHLA_CONDITIONAL_BATCH_HH
+
+// System include files.
+#include <cstddef>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/Conditional.hh"
+
+namespace TrickHLA
+{
+
+class ConditionalBatch : public Conditional
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ConditionalBatch();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA ConditionalBatch class. */
+   ConditionalBatch();
+   /*! @brief Destructor for the TrickHLA ConditionalBatch class. */
+   virtual ~ConditionalBatch();
+
+   /*! @brief Register a change threshold on an array of doubles for the
+    * specified attribute. The current values seed the previous values and
+    * the attribute is marked to send on the first evaluation. More than one
+    * threshold may be registered for the same attribute, in which case any
+    * changed threshold marks the attribute to send.
+    *  @param attr    Attribute the threshold is for.
+    *  @param address Address of the current values, which must stay valid.
+    *  @param count   Number of doubles at the address.
+    *  @param epsilon Change detection threshold, zero for exact compare. */
+   void register_threshold( Attribute    *attr,
+                            double const *address,
+                            int const     count,
+                            double const  epsilon );
+
+   /*! @brief Register a byte-wise change detection region for the specified
+    * attribute, for data that is not an array of doubles.
+    *  @param attr    Attribute the change detection is for.
+    *  @param address Address of the current data, which must stay valid.
+    *  @param size    Size of the data in bytes. */
+   void register_change_detect( Attribute  *attr,
+                                void const *address,
+                                size_t const size );
+
+   /*! @brief Evaluate all the registered change thresholds in one sweep,
+    * updating the previous values and the per-attribute send bitmask. The
+    * Object calls this once just before it creates the attribute value-set. */
+   virtual void evaluate();
+
+   /*! @brief Consume the send bitmask produced by evaluate() for the
+    * specified attribute. Returns true for an attribute with no registered
+    * threshold, matching the default Conditional behavior.
+    *  @return True if the attribute data should be sent, false otherwise.
+    *  @param attr Pointer to TrickHLA Attribute. */
+   virtual bool should_send( Attribute *attr );
+
+  protected:
+   /*! @brief A registered change threshold on an array of doubles. */
+   struct Threshold {
+      Attribute    *attr;        ///< @trick_io{**} Attribute the threshold is for.
+      double const *address;     ///< @trick_io{**} Address of the current values.
+      int           count;       ///< @trick_io{**} Number of doubles at the address.
+      double        epsilon;     ///< @trick_io{**} Change detection threshold.
+      size_t        prev_offset; ///< @trick_io{**} Offset into the previous values storage.
+      bool          changed;     ///< @trick_io{**} True if the last evaluation detected a change.
+   };
+
+   /*! @brief A registered byte-wise change detection region. */
+   struct ByteRegion {
+      Attribute           *attr;        ///< @trick_io{**} Attribute the change detection is for.
+      unsigned char const *address;     ///< @trick_io{**} Address of the current data.
+      size_t               size;        ///< @trick_io{**} Size of the data in bytes.
+      size_t               prev_offset; ///< @trick_io{**} Offset into the previous bytes storage.
+      bool                 changed;     ///< @trick_io{**} True if the last evaluation detected a change.
+   };
+
+   std::vector< Threshold >     thresholds;   ///< @trick_io{**} Registered change thresholds.
+   std::vector< ByteRegion >    byte_regions; ///< @trick_io{**} Registered byte-wise change regions.
+   std::vector< double >        prev_values;  ///< @trick_io{**} Flat previous values storage for all thresholds.
+   std::vector< unsigned char > prev_bytes;   ///< @trick_io{**} Flat previous bytes storage for all byte regions.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ConditionalBatch class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ConditionalBatch( ConditionalBatch const &rhs );
+   /*! @brief Assignment operator for ConditionalBatch class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ConditionalBatch &operator=( ConditionalBatch const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_CONDITIONAL_BATCH_HH: Do NOT put anything after this line!
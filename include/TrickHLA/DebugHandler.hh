@@ -37,6 +37,7 @@ NASA, Johnson Space Center\n
 #include <string>
 
 // TrickHLA Model include files.
+#include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Types.hh"
 
 namespace TrickHLA
@@ -64,16 +65,39 @@ class DebugHandler
    virtual ~DebugHandler();
 
    /*! @brief Conditional test to see if a debug message should be shown.
+    *  @details The level argument is an enum literal at nearly every call
+    *  site, so the comparison against the THLA_MAX_COMPILED_DEBUG_LEVEL
+    *  ceiling folds to a constant and any site above the ceiling becomes
+    *  dead code the compiler drops entirely, message construction included.
+    *  Levels at or below the ceiling remain runtime configurable.
     *  @return Returns true if the requested message should be printed.
     *  @param level Debug level of incoming message.
     *  @param code  Debug code source area of the incoming message. */
-   static bool const show( DebugLevelEnum const level, DebugSourceEnum const code );
+   static bool const show( DebugLevelEnum const level, DebugSourceEnum const code )
+   {
+      if ( (int)level > THLA_MAX_COMPILED_DEBUG_LEVEL ) {
+         return false;
+      }
+      return ( ( debug_level >= level ) && ( ( code_section & code ) != 0 ) );
+   }
 
    /*! @brief Set the debug level and code-section.
     *  @param level Debug level of incoming message.
     *  @param code  Debug code source area of the incoming message. */
    static void set( DebugLevelEnum const level, DebugSourceEnum const code );
 
+   /*! @brief Print a debug message to standard output.
+    *  @details When asynchronous logging is enabled the message is captured
+    *  into a lock-free ring buffer and published by a background logger
+    *  thread so the calling thread does not pay for the synchronous Trick
+    *  message system publish. Otherwise the message is published directly.
+    *  @param message Debug message to print to standard output. */
+   static void print( std::string const &message );
+
+   /*! @brief Shutdown the background logger thread, draining any queued
+    *  debug messages. */
+   static void shutdown_async_logging();
+
    /*! @brief Print the message then shutdown by calling exec_terminate().
     *  @param message Error message to print to standard error. */
    static void terminate_with_message( std::string const &message );
@@ -81,6 +105,7 @@ class DebugHandler
   public:
    static DebugLevelEnum  debug_level;  ///< @trick_units{--} Maximum debug report level requested by the user, default: THLA_NO_TRACE
    static DebugSourceEnum code_section; ///< @trick_units{--} Code section(s) for which to activate debug messages, default: THLA_ALL_MODULES
+   static bool            async_logging; ///< @trick_units{--} True to publish debug messages from a background logger thread, default: false
 };
 
 } // namespace TrickHLA
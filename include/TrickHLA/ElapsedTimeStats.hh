@@ -2,7 +2,9 @@
 @file TrickHLA/ElapsedTimeStats.hh
 @ingroup TrickHLA
 @brief This class gathers statistics on the elapsed time between calls to the
-measure function.
+measure function or on directly sampled durations, including an HDR style
+histogram for percentile extraction and a ring of the recent worst-case
+samples.
 
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
@@ -63,6 +65,48 @@ class ElapsedTimeStats
    /*! @brief Measure the elapsed time. */
    void measure();
 
+   /*! @brief Record one elapsed time sample directly.
+    *  @param time_ms The elapsed time sample in milliseconds. */
+   void sample( double const time_ms );
+
+   /*! @brief Merge the samples accumulated in another statistics instance
+    * into this one, combining the counts, extremes, sums, the histogram and
+    * the recent worst-case samples.
+    *  @param other The statistics instance to merge the samples from. */
+   void merge( ElapsedTimeStats const &other );
+
+   /*! @brief Extract a percentile of the elapsed time samples from the
+    * histogram.
+    *  @return The percentile elapsed time in milliseconds.
+    *  @param fraction The percentile as a fraction in the range (0, 1],
+    *  for example 0.99 for the 99th percentile. */
+   double const percentile( double const fraction );
+
+   /*! @brief Scoped RAII timer that records the elapsed wall-clock time of
+    * the enclosing scope as one sample into the associated ElapsedTimeStats
+    * instance, with just a clock read on construction and destruction. */
+   class ScopedTimer
+   {
+     public:
+      /*! @brief Start timing the enclosing scope.
+       *  @param time_stats The statistics instance to record the sample into. */
+      explicit ScopedTimer( ElapsedTimeStats &time_stats );
+      /*! @brief Record the elapsed time of the enclosing scope. */
+      ~ScopedTimer();
+
+     private:
+      ElapsedTimeStats *stats;      ///< @trick_io{**} Statistics instance the scope sample is recorded into.
+      int64_t           start_time; ///< @trick_io{**} Wall-clock start time of the scope in microseconds.
+
+      // Do not allow the copy constructor or assignment operator.
+      /*! @brief Copy constructor for ScopedTimer class.
+       *  @details This constructor is private to prevent inadvertent copies. */
+      ScopedTimer( ScopedTimer const &rhs );
+      /*! @brief Assignment operator for ScopedTimer class.
+       *  @details This assignment operator is private to prevent inadvertent copies. */
+      ScopedTimer &operator=( ScopedTimer const &rhs );
+   };
+
    /*! @brief Convert confidence level to Z value. */
    double const confidence_to_Z( double &confidence );
 
@@ -70,6 +114,19 @@ class ElapsedTimeStats
    const std::string to_string();
 
   private:
+   /*! @brief Histogram bucket index for an elapsed time in microseconds.
+    *  @return The histogram bucket index. */
+   static int const histogram_bucket( int64_t const time_us );
+
+   /*! @brief Lower bound of a histogram bucket in microseconds.
+    *  @return The lowest elapsed time in microseconds that falls into the bucket.
+    *  @param bucket The histogram bucket index. */
+   static int64_t const bucket_lower_bound( int const bucket );
+
+  private:
+   static int const HISTOGRAM_BUCKET_CNT   = 512; ///< @trick_io{**} Histogram buckets, 16 linear sub-buckets per power of two microseconds.
+   static int const WORST_SAMPLE_RING_SIZE = 16;  ///< @trick_io{**} Number of recent worst-case samples remembered.
+
    bool first_pass; ///< @trick_units{--} Flag indicates first pass to determine external clock.
 
    int64_t prev_time; ///< @trick_units{microseconds} Previous elapsed time.
@@ -83,6 +140,14 @@ class ElapsedTimeStats
 
    double time_sum;         ///< @trick_units{milliseconds} Sum of the elapsed time measured.
    double time_squared_sum; ///< @trick_units{milliseconds^2} Sum of the elapsed time squared.
+
+   uint32_t histogram[HISTOGRAM_BUCKET_CNT]; ///< @trick_io{**} HDR style histogram of the elapsed time samples in microseconds.
+
+   double  worst_sample_time[WORST_SAMPLE_RING_SIZE];      ///< @trick_io{**} Ring of the recent worst-case elapsed times in milliseconds.
+   int64_t worst_sample_timestamp[WORST_SAMPLE_RING_SIZE]; ///< @trick_io{**} Wall-clock timestamps of the recent worst-case samples in microseconds.
+   int     worst_sample_index;     ///< @trick_io{**} Next write position in the worst-case sample ring.
+   int     worst_sample_count;     ///< @trick_io{**} Number of valid entries in the worst-case sample ring.
+   double  worst_sample_threshold; ///< @trick_io{**} Cached 99th percentile in milliseconds used to qualify worst-case samples.
 };
 
 } // namespace TrickHLA
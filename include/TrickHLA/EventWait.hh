@@ -0,0 +1,100 @@
+/*!
+@file TrickHLA/EventWait.hh
+@ingroup TrickHLA
+@brief A reusable event-wait primitive for the FedAmb callback wait loops.
+
+Pairs a condition variable signal with a bounded timed wait so a thread
+waiting on state set from a FedAmb callback wakes as soon as the state
+changes instead of burning a sleep quantum per check, while the bounded
+wait preserves the periodic shutdown, execution membership and wait
+status checks of the surrounding loop.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/EventWait.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_EVENT_WAIT_HH
+#define TRICKHLA_EVENT_WAIT_HH
+
+// System include files.
+#include <pthread.h>
+
+namespace TrickHLA
+{
+
+class EventWait
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__EventWait();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA EventWait class. */
+   EventWait();
+
+   /*! @brief Destructor for the TrickHLA EventWait class. */
+   virtual ~EventWait();
+
+  public:
+   /*! @brief Wake every thread blocked in wait(). Call this after the state
+    * the waiters re-check has been updated and any mutex protecting that
+    * state has been released. */
+   void signal();
+
+   /*! @brief Block until signal() is called or the bounded wait times out.
+    * A bounded timed wait is used instead of an unbounded wait so the
+    * caller can still periodically check for shutdown, check the federation
+    * execution membership and print a wait status summary. The caller is
+    * expected to re-check the waited on state after this function returns. */
+   void wait();
+
+  private:
+   static long const BOUNDED_WAIT_NANOS = 10000000L; ///< Bounded wait time of 10 milliseconds in nanoseconds.
+
+   pthread_mutex_t cond_mutex; ///< @trick_io{**} Mutex paired with the event condition variable.
+   pthread_cond_t  cond;       ///< @trick_io{**} Condition variable signaled on an event state change.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for EventWait class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   EventWait( EventWait const &rhs );
+   /*! @brief Assignment operator for EventWait class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   EventWait &operator=( EventWait const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_EVENT_WAIT_HH: Do NOT put anything after this line!
@@ -21,13 +21,19 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../source/TrickHLA/EventWait.cpp}
 @trick_link_dependency{../../source/TrickHLA/ExecutionControlBase.cpp}
+@trick_link_dependency{../../source/TrickHLA/FrameBudgetWatchdog.cpp}
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/FedAmb.cpp}
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/Metrics.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexProtection.cpp}
+@trick_link_dependency{../../source/TrickHLA/RTISubmitter.cpp}
+@trick_link_dependency{../../source/TrickHLA/SendPacer.cpp}
 @trick_link_dependency{../../source/TrickHLA/TrickThreadCoordinator.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
@@ -46,17 +52,26 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <cstdint>
+#include <map>
+#include <pthread.h>
 #include <string>
+#include <unordered_set>
 
 // Trick include files.
 #include "trick/Flag.h"
 
 // TrickHLA include files.
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/EventWait.hh"
+#include "TrickHLA/FrameBudgetWatchdog.hh"
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/KnownFederate.hh"
+#include "TrickHLA/Metrics.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/RTISubmitter.hh"
+#include "TrickHLA/SendPacer.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/TrickThreadCoordinator.hh"
 #include "TrickHLA/Types.hh"
@@ -135,12 +150,79 @@ class Federate
    bool time_constrained; ///< @trick_units{--} HLA Time Constrained flag (default: true).
    bool time_management;  ///< @trick_units{--} Enable HLA Time Management flag (default: true).
 
+   bool time_adv_grant_wakeup;      ///< @trick_units{--} True to wake the waiting sim thread directly from the Time Advance Grant callback with a condition variable instead of sleep-polling (default: false).
+   long time_adv_grant_spin_micros; ///< @trick_units{us} Bounded busy-spin time before blocking when time_adv_grant_wakeup is enabled, for very low latency grants (default: 0).
+
+   bool use_TARA_for_cyclic_advance; /**< @trick_units{--}
+      Use Time Advance Request Available (TARA) instead of TAR for the
+      cyclic time advance. TARA only guarantees delivery of messages with a
+      timestamp strictly less than the requested time before the grant, so
+      the grant is not held up waiting for messages stamped exactly at the
+      requested time. Those messages flow in after the grant while the
+      frame is already running and are picked up by the blocking cyclic
+      reads, overlapping the receive-side decode with the rest of the frame
+      (default: false). */
+
+   bool adaptive_lookahead_enabled; /**< @trick_units{--}
+      Enable runtime adaptive lookahead negotiation. The federate tracks the
+      achieved per-cycle busy time and renegotiates the RTI registered
+      lookahead through modifyLookahead() so other federates see our updates
+      with less latency, while the configured nominal lookahead remains the
+      worst-case ceiling. The nominal lookahead still defines the cyclic
+      time step and the update timestamps; only the RTI registered lookahead
+      is renegotiated (default: false). */
+   double adaptive_lookahead_min_time; /**< @trick_units{s}
+      Floor for the adaptive RTI lookahead in seconds. Must be greater than
+      zero and not exceed the configured nominal lookahead (default: 0.0). */
+   double adaptive_lookahead_guard_band; /**< @trick_units{s}
+      Guard band in seconds added to the observed worst-case busy time
+      before comparing it to the current RTI lookahead (default: 0.0). */
+   double adaptive_lookahead_period; /**< @trick_units{s}
+      Minimum HLA time in seconds between lookahead reductions. Increases
+      for safety are applied immediately; reductions are rate limited by
+      this period (default: 10.0). */
+
+   FrameBudgetWatchdog frame_watchdog; /**< @trick_units{--}
+      Real-time frame budget watchdog. When enabled with declared budgets it
+      measures the grant wait, receive and send stages each frame and records
+      attributed overrun incidents into a ring readable post-run. */
+
+   SendPacer send_pacer; /**< @trick_units{--}
+      Token-bucket pacer for the send-side RTI call burst. When enabled the
+      cyclic attribute updates are spread across a configured fraction of
+      the data cycle frame instead of leaving the host back-to-back, and the
+      demand and achieved burst profiles are reported at shutdown. */
+
+   bool shared_memory_transport; /**< @trick_units{--}
+      Enable the shared-memory fast path for attribute updates between
+      federates running on the same host. The fast path is only activated
+      when the MOM reports at least one other joined federate with the same
+      host name, and the RTI remains the time management and fallback
+      channel (default: false). */
+
+   bool use_rti_submission_proxy; /**< @trick_units{--}
+      Funnel the outbound updateAttributeValues() and sendInteraction()
+      calls through a single dedicated submitter thread. The data jobs post
+      fully-encoded submissions to a queue instead of contending on the
+      RTI's internal lock when they run across Trick child threads. The
+      queue is flushed before each Time Advance Request so the Timestamp
+      Order messages still precede the advance (default: false). */
+
    // The Federates known to be in the Federation, and specified in the input files.
    // TODO: change this to be an STL Array.
    bool           enable_known_feds; ///< @trick_units{--} Enable use of known Federates list (default: true)
    int            known_feds_count;  ///< @trick_units{--} Number of required Federates (default: 0)
    KnownFederate *known_feds;        ///< @trick_units{--} Array of all the known Federates in the simulation.
 
+   bool sync_point_join_detection; ///< @trick_units{--} True to detect joining required federates from per-federate join sync-point announcements instead of subscribing to the MOM HLAfederate roster, default: false.
+
+   bool wire_traffic_report; /**< @trick_units{--}
+      Dump the per-attribute wire-traffic top-talkers report at shutdown:
+      for each object and federation-wide, the attributes sorted by total
+      encoded bytes with their updates and bytes sent and received and
+      their suppressed-vs-sent ratios, for identifying the attributes that
+      dominate the federation bandwidth (default: false). */
+
    DebugLevelEnum  debug_level;  ///< @trick_units{--} Maximum debug report level requested by the user, default: THLA_NO_TRACE
    DebugSourceEnum code_section; ///< @trick_units{--} Code section(s) for which to activate debug messages, default: THLA_ALL_MODULES
 
@@ -150,6 +232,15 @@ class Federate
       Enables this federate to resign in a way to allow re-joining of the
       federation at a later time. */
 
+   bool fast_teardown; /**< @trick_units{--}
+      Enables the fast teardown mode for shutdown when the federation is
+      being abandoned: the resign's implicit cancel-delete-divest semantics
+      do the per-object cleanup on the RTI side and the per-object RTI
+      calls and per-variable Trick memory frees are skipped during
+      destruction since the process is exiting and the operating system
+      reclaims the memory in bulk. Ignored when can_rejoin_federation is
+      set, which needs the orderly resign, default: false. */
+
    double freeze_delay_frames; /**< @trick_units{--}
       For DIS: Number of lookahead_time frames to delay when freeze issued so
       all feds freeze together. */
@@ -209,6 +300,10 @@ class Federate
    //! @brief Enable asynchronous delivery of messages for this federate.
    void enable_async_delivery();
 
+   /*! @brief Enable attribute relevance advisories so the RTI will tell us
+    * which of our published attributes actually have remote subscribers. */
+   void enable_attribute_relevance_advisory();
+
    //
    // Federation synchronization and synchronization point functions.
    //
@@ -217,6 +312,14 @@ class Federate
     *  @param time  Optional Sync-point time in seconds. */
    void register_generic_sync_point( std::wstring const &label, double time = -1.0 );
 
+   /*! @brief Register this federate's per-federate join announcement
+    *  sync-point, used by the sync-point join detection mode in place of
+    *  the MOM roster queries. The label carries a wall clock stamp so
+    *  every registration produces a unique announcement and never collides
+    *  with a still-pending label from an earlier registration or a
+    *  crash-rejoin cycle. */
+   void register_join_sync_point();
+
    /*! @brief Achieve the specified sync-point and wait for the federation to
     *  be synchronized on it.
     *  @param label Sync-point label. */
@@ -262,9 +365,17 @@ class Federate
    //
    // Management Object Model (MOM) interfaces.
    //
-   /*! @brief Initialize the MOM interface handles. */
+   /*! @brief Initialize the MOM interface handles.
+    *  @details Resolves the MOM class, attribute and interaction handles
+    *  with the RTI on first need. Subsequent calls return immediately, so
+    *  callers can use this as a lazy guard. */
    void initialize_MOM_handles();
 
+   /*! @brief Force the MOM interface handles to be re-resolved with the RTI.
+    *  @details Used after a checkpoint restore where the handles may have
+    *  changed or this federate may now be the master federate. */
+   void refresh_MOM_handles();
+
    /*! @brief Request names of joined federates from the MOM. */
    void ask_MOM_for_federate_names();
 
@@ -274,7 +385,9 @@ class Federate
    /*! @brief Unsubscribe from all MOM federation class attributes. */
    void unsubscribe_all_HLAfederation_class_attributes_from_MOM();
 
-   /*! @brief Ask MOM for the current "auto-provide" setting from the switches table. */
+   /*! @brief Ask MOM for the current "auto-provide" setting from the
+    * switches table. The wait for the MOM reply is event-driven, woken by
+    * the reflection callback instead of a sleep-poll. */
    void ask_MOM_for_auto_provide_setting();
 
    /*! @brief Update the MOM "auto-provide" setting from the switches table
@@ -309,11 +422,23 @@ class Federate
     * in preparation for re-size. */
    void clear_running_feds();
 
-   /*! @brief Update running federates based on current known information. */
+   /*! @brief Rebuild the entire running_feds from the joined federate name
+    * map, which is only needed on a restore. Incremental roster churn is
+    * handled by the single-entry add, update and remove routines. */
    void update_running_feds();
 
-   /*! @brief Grow the running_feds by one entry. */
-   void add_a_single_entry_into_running_feds();
+   /*! @brief Add a single entry into running_feds, or update the existing
+    * entry in place when the federate is already in the roster, without
+    * rebuilding the entire roster.
+    *  @param mom_instance_name MOM HLAfederate object instance name.
+    *  @param fed_name          Federate name. */
+   void add_or_update_a_single_entry_into_running_feds( std::wstring const &mom_instance_name,
+                                                        std::wstring const &fed_name );
+
+   /*! @brief Remove a single entry from running_feds, compacting the roster
+    * in place, without rebuilding the entire roster.
+    *  @param mom_instance_name MOM HLAfederate object instance name. */
+   void remove_a_single_entry_from_running_feds( std::wstring const &mom_instance_name );
 
    /*! @brief Get the count of the currently running federates.
     *  @return Count of the currently running federates. */
@@ -364,11 +489,20 @@ class Federate
    /*! @brief Inform the RTI of the success or failure of the federate restore. */
    void inform_RTI_of_restore_completion();
 
-   /*! @brief Read the running_feds file, replacing the data in known federates
-    * data structure.
+   /*! @brief Read the legacy text running_feds file, replacing the data in
+    * the known federates data structure. Only used as a fallback for
+    * checkpoints created before the binary checkpoint blob.
     * @param file_name Checkpoint file name. */
    void read_running_feds_file( std::string const &file_name );
 
+   /*! @brief Restore the known federates table and the sync-point states
+    * from the memory-mapped binary checkpoint blob, avoiding the text file
+    * string reparse.
+    * @return True if the blob was restored, false to fall back to the text
+    * running-feds file.
+    * @param file_name Checkpoint file name. */
+   bool read_binary_checkpoint( std::string const &file_name );
+
    /*! @brief Copies the contents of the checkpoint's list of federates into
     * known federates data structure. */
    void copy_running_feds_into_known_feds();
@@ -454,6 +588,14 @@ class Federate
       save_completed = true;
       start_to_save  = false;
       publish_data   = true;
+      save_restore_event.signal();
+   }
+
+   /*! @brief Query the save completed state.
+    *  @return True when the most recent federation save has completed. */
+   bool is_save_completed() const
+   {
+      return save_completed;
    }
 
    /*! @brief Set the restore begun state. */
@@ -462,6 +604,7 @@ class Federate
       restore_begun     = true;
       restore_completed = false;
       publish_data      = false;
+      save_restore_event.signal();
    }
 
    /*! @brief Set the restore completed state. */
@@ -472,6 +615,7 @@ class Federate
       restore_begun     = false;
       start_to_restore  = false;
       publish_data      = true;
+      save_restore_event.signal();
    }
 
    /*! @brief Set the restore failed state. */
@@ -482,18 +626,21 @@ class Federate
       restore_begun     = false;
       start_to_restore  = false;
       publish_data      = true;
+      save_restore_event.signal();
    }
 
    /*! @brief Set the restore request failed state. */
    void set_restore_request_failed()
    {
       restore_process = Restore_Request_Failed;
+      save_restore_event.signal();
    }
 
    /*! @brief Set the restore request succeeded state. */
    void set_restore_request_succeeded()
    {
       restore_process = Restore_Request_Succeeded;
+      save_restore_event.signal();
    }
 
    /*! @brief Query if federate should publish data.
@@ -579,6 +726,7 @@ class Federate
    void set_start_to_save()
    {
       start_to_save = true;
+      save_restore_event.signal();
    }
 
    /*! @brief Checks to see if shutdown has been commanded.
@@ -596,6 +744,17 @@ class Federate
       return this->shutdown_called;
    }
 
+   /*! @brief Determine if the fast teardown mode has been activated by
+    * shutdown(), meaning the federate is abandoning the federation and
+    * the per-object RTI cleanup calls and per-variable Trick memory frees
+    * can be skipped during destruction. Static so the destructors can
+    * check it without a Federate reference.
+    *  @return True when the fast teardown mode is active. */
+   static bool is_fast_teardown_active()
+   {
+      return fast_teardown_active;
+   }
+
    /*! @brief Check if HLA_save_directory is empty. If so, ask the EXECUTIVE
     * for info and build the absolute path of the RUN directory. */
    void check_HLA_save_directory();
@@ -654,9 +813,21 @@ class Federate
     *  Available Logical Time (GALT) and Least Common Time Step (LCTS). */
    void time_advance_request_to_GALT_LCTS_multiple();
 
+   /*! @brief Refresh the cached Greatest Available Logical Time (GALT) with
+    * a single queryGALT() RTI round trip. Call once per frame during
+    * catch-up so all the GALT based time advance computations in the frame
+    * consume the cache instead of each querying the RTI. */
+   void refresh_GALT_cache();
+
    /*! @brief Wait for a HLA time-advance grant. */
    void wait_for_time_advance_grant();
 
+   /*! @brief Optionally busy-spin for a bounded time and then block on the
+    *  time advance grant condition variable until the FedAmb callback
+    *  signals the grant, a bounded timed wait expires, or a spurious wakeup
+    *  occurs. The caller is expected to re-check the time advance state. */
+   void spin_then_block_for_time_adv_grant();
+
    /*! @brief Initialize the thread memory associated with the Trick child threads. */
    void initialize_thread_state( double const main_thread_data_cycle_time );
 
@@ -664,6 +835,15 @@ class Federate
    void associate_to_trick_child_thread( unsigned int const thread_id,
                                          double const       data_cycle );
 
+   /*! @brief Associate a Trick child thread with TrickHLA and pin the
+    *  thread to the specified CPU so its working set stays NUMA node-local.
+    *  @param thread_id  Trick thread ID (0 for the main thread).
+    *  @param data_cycle Data cycle time for this thread in seconds.
+    *  @param cpu_id     CPU to pin the thread to, or -1 for no pinning. */
+   void associate_to_trick_child_thread( unsigned int const thread_id,
+                                         double const       data_cycle,
+                                         int const          cpu_id );
+
    /*! @brief Disable the comma separated list of Trick child thread IDs associated to TrickHLA. */
    void disable_trick_child_thread_associations( char const *thread_ids );
 
@@ -687,10 +867,38 @@ class Federate
    int64_t const get_data_cycle_base_time_for_obj( unsigned int const obj_index,
                                                    int64_t const      default_data_cycle_base_time ) const;
 
+   /*! @brief Advance the precomputed per-object data cycle schedule tables to
+    * the specified simulation time. Must be called from the Trick main thread
+    * before the per-object boundary checks are made for the same time. */
+   void advance_data_cycle_schedule( int64_t const sim_time_in_base_time );
+
    /*! @brief Is the object for the given index on a data cycle boundary. */
    bool const on_data_cycle_boundary_for_obj( unsigned int const obj_index,
                                               int64_t const      sim_time_in_base_time ) const;
 
+   /*! @brief Is the object for the given index on a send data cycle boundary,
+    * which includes the object's configured send phase offset. */
+   bool const on_send_data_cycle_boundary_for_obj( unsigned int const obj_index,
+                                                   int64_t const      sim_time_in_base_time ) const;
+
+   /*! @brief Initialize the pool of data job worker threads used to process
+    * per-object send and receive jobs in parallel. */
+   void initialize_data_job_workers( unsigned int const worker_count );
+
+   /*! @brief Determine if the data job worker pool has been initialized. */
+   bool is_data_job_workers_enabled() const;
+
+   /*! @brief Configure the adaptive, cost-driven scheduling of the parallel
+    * per-object data jobs. */
+   void configure_adaptive_job_scheduling( bool const enable, unsigned int const rebalance_period );
+
+   /*! @brief Execute the given job for all the object indices, distributing
+    * the work across the data job worker threads, and return once all the
+    * jobs have completed. */
+   void execute_object_data_jobs( TrickThreadCoordinator::ObjectJobFn job,
+                                  void                               *user_data,
+                                  unsigned int const                  job_count );
+
    /*! @brief Send zero lookahead or requested data for the specified object instance. */
    void send_zero_lookahead_and_requested_data( std::string const &obj_instance_name );
 
@@ -885,6 +1093,15 @@ class Federate
       return this->federation_name;
    }
 
+   /*! @brief Query if the shared-memory transport fast path is active, which
+    * requires both the user enable flag and the MOM based detection of at
+    * least one other joined federate running on the same host.
+    *  @return True if the shared-memory transport is active. */
+   bool is_shared_memory_transport_active() const
+   {
+      return ( this->shared_memory_transport && this->shared_memory_peer_detected );
+   }
+
    /*! @brief Get the current granted HLA federation execution time.
     *  @return Reference to current granted HLA federation execution time. */
    Int64Time const &get_granted_time() const
@@ -1043,6 +1260,7 @@ class Federate
    void set_start_to_save( bool const save_flag )
    {
       this->start_to_save = save_flag;
+      save_restore_event.signal();
    }
 
    /*! @brief Set start to restore flag.
@@ -1050,6 +1268,7 @@ class Federate
    void set_start_to_restore( bool const restore_flag )
    {
       this->start_to_restore = restore_flag;
+      save_restore_event.signal();
    }
 
    /*! @brief Set restart flag.
@@ -1121,6 +1340,11 @@ class Federate
    void exit_freeze();
 
   private:
+   /*! @brief Record the joined federate named by a per-federate join
+    *  sync-point announcement, for the sync-point join detection mode.
+    *  @param label The announced join sync-point label. */
+   void process_join_sync_point_announcement( std::wstring const &label );
+
    // Federation state variables.
    //
    RTI1516_NAMESPACE::FederateHandle federate_id;                    ///< @trick_io{**} Federate ID.
@@ -1135,6 +1359,8 @@ class Federate
 
    bool shutdown_called; ///< @trick_units{--} Flag to indicate shutdown has been called.
 
+   static bool fast_teardown_active; ///< @trick_io{**} True once the fast teardown mode has been activated by shutdown(), static so the destructors can check it without a Federate reference.
+
    std::wstring save_name;    ///< @trick_io{**} Name for a save file
    std::wstring restore_name; ///< @trick_io{**} Name for a restore file
 
@@ -1187,9 +1413,33 @@ class Federate
    //
    unsigned int time_adv_state;       ///< @trick_units{--} HLA Time advance state.
    MutexLock    time_adv_state_mutex; ///< @trick_units{--} HLA Time advance state mutex lock.
+
+   pthread_mutex_t time_adv_cond_mutex; ///< @trick_io{**} Mutex paired with the time advance grant condition variable.
+   pthread_cond_t  time_adv_cond;       ///< @trick_io{**} Condition variable signaled when a time advance is granted.
+
+   int64_t cached_GALT_base_time; ///< @trick_io{**} Cached Greatest Available Logical Time (GALT) in base time units, floored opportunistically from the time advance grant callback.
+   bool    cached_GALT_fresh;     ///< @trick_io{**} True when the cached GALT holds a query result that has not been consumed by a GALT based time advance request yet.
    Int64Time    granted_time;         ///< @trick_units{--} HLA time given by RTI
    Int64Time    requested_time;       ///< @trick_units{--} requested/desired HLA time
    double       HLA_time;             ///< @trick_units{s}  Current HLA time to allow for plotting.
+
+   ElapsedTimeStats time_adv_grant_stats; ///< @trick_units{--} Statistics of the time spent waiting for the HLA time advance grant.
+
+   Metrics metrics; ///< @trick_units{--} Live performance counters, streamable through the Trick variable server.
+
+   int64_t adaptive_lookahead_base_time;   ///< @trick_io{**} Current RTI registered lookahead in base time units, -1 until initialized from the nominal lookahead.
+   double  adaptive_lookahead_window_max;  ///< @trick_io{**} Worst observed busy time in seconds since the last lookahead decision.
+   double  adaptive_lookahead_adjust_time; ///< @trick_io{**} HLA time of the last lookahead reduction, used for rate limiting.
+   int64_t adaptive_lookahead_grant_clock; ///< @trick_io{**} Wall clock time in microseconds of the last time advance grant.
+
+   ElapsedTimeStats adaptive_lookahead_stats; ///< @trick_io{**} Statistics of the per-cycle busy time used by the adaptive lookahead manager.
+
+   RTISubmitter rti_submitter; ///< @trick_io{**} Single-submitter proxy the outbound RTI data calls are funneled through when use_rti_submission_proxy is enabled.
+
+   EventWait save_restore_event; ///< @trick_io{**} Event signaled by the save/restore state setters so the save/restore wait loops wake on the state change instead of a sleep quantum later.
+
+   EventWait MOM_auto_provide_event; ///< @trick_io{**} Event signaled when the MOM HLAautoProvide reflection arrives so the auto-provide query wakes on the reply instead of a sleep quantum later.
+
    bool         start_to_save;        ///< @trick_io{**} Save flag
    bool         start_to_restore;     ///< @trick_io{**} Restore flag
    bool         restart_flag;         ///< @trick_io{**} Restart flag
@@ -1201,6 +1451,8 @@ class Federate
    bool got_startup_sync_point;     ///< @trick_units{--} "startup" Sync-Point has been created. For DIS compatibility
    bool make_copy_of_run_directory; ///< @trick_units{--} Make a backup of RUN directory before restarting the federation via federation manager (default: false).
 
+   bool MOM_handles_resolved; ///< @trick_io{**} True once the MOM class, attribute and interaction handles have been resolved with the RTI.
+
    RTI1516_NAMESPACE::ObjectClassHandle MOM_HLAfederation_class_handle;      ///< @trick_io{**} MOM Federation class handle.
    RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederatesInFederation_handle; ///< @trick_io{**} MOM attribute handle to Federate-count.
    RTI1516_NAMESPACE::AttributeHandle   MOM_HLAautoProvide_handle;           ///< @trick_io{**} MOM AutoProvide attribute handle.
@@ -1212,12 +1464,23 @@ class Federate
    RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederateType_handle;    ///< @trick_io{**} MOM attribute handle to Federate type (a.k.a name in IEEE 1516-2000).
    RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederateName_handle;    ///< @trick_io{**} MOM attribute handle to Federate name.
    RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederate_handle;        ///< @trick_io{**} MOM attribute handle to Federate-Handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederateHost_handle;    ///< @trick_io{**} MOM attribute handle to Federate host name.
    TrickHLAObjInstanceNameMap           mom_HLAfederate_inst_name_map; ///< @trick_io{**} Map of the MOM HLAfederate instances name map.
 
+   bool shared_memory_peer_detected; ///< @trick_io{**} True if the MOM reported another joined federate on the same host.
+
+   std::map< std::string, std::wstring > MOM_unicode_decode_cache; ///< @trick_io{**} Memoized MOM HLAunicodeString decodes keyed on the raw encoded bytes, so repeated reflections of the same name or host skip the per-character decode.
+
+   std::wstring local_host_name_ws; ///< @trick_io{**} Cached local host name, resolved once on first use instead of per MOM reflection.
+
    MutexLock                            joined_federate_mutex;    ///< @trick_io{**} Mutex to lock thread over critical code sections.
    TrickHLAObjInstanceNameMap           joined_federate_name_map; ///< @trick_io{**} Map of the federate instances.
    RTI1516_NAMESPACE::FederateHandleSet joined_federate_handles;  ///< @trick_io{**} FederateHandles of joined federates.
    VectorOfWstrings                     joined_federate_names;    ///< @trick_io{**} Names of the joined federates.
+   std::unordered_set< std::wstring >   joined_federate_name_set; ///< @trick_io{**} Hashed joined federate names for O(1) is_joined_federate() lookups, maintained incrementally from the MOM reflection callbacks.
+
+   std::unordered_set< std::wstring > required_federate_name_set;       ///< @trick_io{**} Hashed required federate names for O(1) is_required_federate() lookups.
+   bool                               required_federate_name_set_built; ///< @trick_io{**} True once the required federate name set has been built from known_feds.
 
    RTI1516_NAMESPACE::InteractionClassHandle MOM_HLAsetSwitches_class_handle; ///< @trick_io{**} MOM HLAsetSwitches class handle.
    RTI1516_NAMESPACE::ParameterHandle        MOM_HLAautoProvide_param_handle; ///< @trick_io{**} MOM HLAautoProvide parameter handle.
@@ -1235,10 +1498,20 @@ class Federate
    ExecutionControlBase *execution_control;   /**< @trick_units{--} Execution control object. This has to point to an allocated execution control class that inherits from the ExecutionControlBase interface class. For instance SRFOM::ExecutionControl. */
 
   private:
-   /*! @brief Dumps the contents of the running_feds object into the supplied
-    *  file name with ".running_feds" appended to it.
+   /*! @brief Decode a MOM HLAunicodeString value through the memoized
+    *  decode cache keyed on the raw encoded bytes, so repeated reflections
+    *  of the same value skip the per-character decode. The caller must hold
+    *  the joined federate mutex.
+    *  @return The decoded wide string, owned by the cache.
+    *  @param value The encoded MOM attribute value. */
+   std::wstring const &decode_MOM_unicode_string( RTI1516_NAMESPACE::VariableLengthData const &value );
+
+   /*! @brief Write the versioned binary checkpoint blob with the running
+    *  federates table and the sync-point states. This is the only running
+    *  federates record written at save time; the restore only parses the
+    *  legacy text running-feds file when the blob is missing.
     *  @param file_name Checkpoint file name. */
-   void write_running_feds_file( std::string const &file_name );
+   void write_binary_checkpoint( std::string const &file_name );
 
    /*! @brief Request federation save from the RTI. */
    void request_federation_save();
@@ -1307,6 +1580,37 @@ class Federate
    /*! @brief Make the HLA time-advance request using the current requested_time value. */
    void perform_time_advance_request();
 
+   /*! @brief Renegotiate the RTI registered lookahead from the achieved
+    * per-cycle busy time when adaptive lookahead is enabled. Must be called
+    * while the federate is not in a time advancing state. */
+   void update_adaptive_lookahead();
+
+   /*! @brief Get the single-submitter proxy for the outbound RTI data calls.
+    *  @return The RTI submission proxy, or NULL when it is not enabled. */
+   RTISubmitter *get_rti_submission_proxy()
+   {
+      return ( this->use_rti_submission_proxy ? &this->rti_submitter : NULL );
+   }
+
+   /*! @brief Get the Greatest Available Logical Time (GALT), consuming the
+    * cache when it holds an unconsumed query result and falling back to a
+    * queryGALT() RTI round trip when the cache is stale.
+    *  @return True if a GALT time is available.
+    *  @param galt_base_time The GALT in base time units. */
+   bool query_GALT_base_time( int64_t &galt_base_time );
+
+   /*! @brief Rebuild the hashed required federate names from the known
+    * federates array. */
+   void refresh_required_federate_name_set();
+
+   /*! @brief Invalidate the hashed required federate names. Called whenever
+    * the known federates array is rebuilt, such as on a checkpoint restore,
+    * so the hashed names are rebuilt on the next lookup. */
+   void invalidate_required_federate_name_set()
+   {
+      this->required_federate_name_set_built = false;
+   }
+
    /*! @brief Make time-advance request available and wait for time advance grant with zero lookahead. */
    void wait_for_zero_lookahead_TARA_TAG();
 
@@ -0,0 +1,179 @@
+/*!
+@file TrickHLA/FrameBudgetWatchdog.hh
+@ingroup TrickHLA
+@brief This class monitors the real-time frame budget of the main data cycle
+by measuring the known frame stages each frame and recording an attributed
+incident into a low-overhead ring whenever the frame or a stage exceeds its
+declared budget.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../source/TrickHLA/FrameBudgetWatchdog.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_FRAME_BUDGET_WATCHDOG_HH
+#define TRICKHLA_FRAME_BUDGET_WATCHDOG_HH
+
+// System includes
+#include <cstdint>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+
+namespace TrickHLA
+{
+
+class FrameBudgetWatchdog
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__FrameBudgetWatchdog();
+
+  public:
+   /*! @brief Identifies the stages of the main data cycle frame that are
+    * measured and budgeted individually. */
+   typedef enum {
+      STAGE_WAIT_FOR_GRANT = 0, ///< Waiting for the HLA Time Advance Grant.
+      STAGE_RECEIVE_DATA   = 1, ///< Receiving cyclic and requested data.
+      STAGE_SEND_DATA      = 2, ///< Sending cyclic and requested data.
+      STAGE_OTHER_JOBS     = 3, ///< All other jobs in the frame, derived as the remainder of the frame time.
+      STAGE_COUNT          = 4  ///< Number of frame stages.
+   } FrameStageEnum;
+
+  public:
+   bool enabled; ///< @trick_units{--} Enable the frame budget watchdog (default: false).
+
+   double frame_budget_ms; /**< @trick_units{ms}
+      Budget for the whole frame in milliseconds, typically the real-time
+      frame time. A value <= 0 disables the whole frame budget check
+      (default: 0). */
+
+   double stage_budget_ms[STAGE_COUNT]; /**< @trick_units{ms}
+      Per-stage budgets in milliseconds, indexed by FrameStageEnum. A value
+      <= 0 disables the budget check for that stage (default: 0). */
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA FrameBudgetWatchdog class. */
+   FrameBudgetWatchdog();
+   /*! @brief Destructor for the TrickHLA FrameBudgetWatchdog class. */
+   virtual ~FrameBudgetWatchdog();
+
+   /*! @brief Mark the start of a new frame, which also closes out and
+    * evaluates the previous frame against the declared budgets. */
+   void begin_frame();
+
+   /*! @brief Mark the start of a measured frame stage.
+    *  @param stage The frame stage that is starting. */
+   void start_stage( FrameStageEnum const stage );
+
+   /*! @brief Mark the end of the frame stage started by start_stage(). */
+   void end_stage();
+
+   /*! @brief Total number of budget overruns observed so far.
+    *  @return The number of overrun incidents recorded. */
+   unsigned int get_incident_count() const
+   {
+      return this->incident_count;
+   }
+
+   /*! @brief The display name of a frame stage.
+    *  @return The stage name as a static string.
+    *  @param stage The frame stage, see FrameStageEnum. */
+   static char const *stage_name( int const stage );
+
+   /*! @brief Returns a string summary of the per-stage timing statistics and
+    * the recorded overrun incidents. */
+   std::string const to_string();
+
+   /*! @brief Scoped RAII stage marker that brackets the enclosing scope with
+    * start_stage() and end_stage() calls, so early returns from a stage job
+    * still close out the stage measurement. */
+   class ScopedStage
+   {
+     public:
+      /*! @brief Start measuring the frame stage for the enclosing scope.
+       *  @param frame_watchdog The watchdog the stage is measured into.
+       *  @param stage The frame stage the enclosing scope implements. */
+      ScopedStage( FrameBudgetWatchdog &frame_watchdog, FrameStageEnum const stage );
+      /*! @brief End the frame stage measurement. */
+      ~ScopedStage();
+
+     private:
+      FrameBudgetWatchdog *watchdog; ///< @trick_io{**} Watchdog the scoped stage is measured into.
+
+      // Do not allow the copy constructor or assignment operator.
+      /*! @brief Copy constructor for ScopedStage class.
+       *  @details This constructor is private to prevent inadvertent copies. */
+      ScopedStage( ScopedStage const &rhs );
+      /*! @brief Assignment operator for ScopedStage class.
+       *  @details This assignment operator is private to prevent inadvertent copies. */
+      ScopedStage &operator=( ScopedStage const &rhs );
+   };
+
+  private:
+   /*! @brief Close out the current frame, derive the other-jobs remainder,
+    * and record an attributed incident if a budget was exceeded.
+    *  @param end_time The wall-clock end time of the frame in microseconds. */
+   void evaluate_frame( int64_t const end_time );
+
+  private:
+   static int const INCIDENT_RING_SIZE = 32; ///< @trick_io{**} Number of recent overrun incidents retained.
+
+   /*! @brief One recorded frame budget overrun. */
+   struct Incident {
+      uint64_t frame;                    ///< Frame number the overrun occurred in.
+      int64_t  timestamp;                ///< Wall-clock end time of the frame in microseconds.
+      double   total_ms;                 ///< Total frame time in milliseconds.
+      double   excess_ms;                ///< Time over budget in milliseconds, for the attributed stage.
+      int      attributed_stage;         ///< Frame stage that consumed the excess, see FrameStageEnum.
+      double   stage_ms[STAGE_COUNT];    ///< Per-stage times for the overrun frame in milliseconds.
+   };
+
+   bool     frame_active;     ///< @trick_io{**} True when a frame measurement is in progress.
+   uint64_t frame_count;      ///< @trick_io{**} Number of frames measured.
+   int64_t  frame_start_time; ///< @trick_io{**} Wall-clock start time of the current frame in microseconds.
+   int64_t  stage_start_time; ///< @trick_io{**} Wall-clock start time of the current stage in microseconds.
+   int64_t  last_stage_end;   ///< @trick_io{**} Wall-clock end time of the last completed stage in microseconds.
+   int      current_stage;    ///< @trick_io{**} Frame stage currently being measured, -1 when none.
+
+   double stage_time_ms[STAGE_COUNT]; ///< @trick_io{**} Accumulated per-stage times for the current frame in milliseconds.
+
+   ElapsedTimeStats stage_stats[STAGE_COUNT]; ///< @trick_io{**} Per-stage elapsed time statistics over all frames.
+
+   Incident     incidents[INCIDENT_RING_SIZE]; ///< @trick_io{**} Ring of the recent overrun incidents.
+   int          incident_index;                ///< @trick_io{**} Next write position in the incident ring.
+   unsigned int incident_count;                ///< @trick_io{**} Total number of overrun incidents observed.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FRAME_BUDGET_WATCHDOG_HH: Do NOT put anything after this line!
@@ -33,6 +33,7 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_INT64_BASE_TIME_HH
 
 // System include files.
+#include <cmath>
 #include <cstdint>
 #include <string>
 
@@ -134,25 +135,52 @@ class Int64BaseTime
 
    /*! @brief Converts the given floating point time to an integer representing
     *  the time in the HLA Logical base time.
+    *  @details Inline so the multiplier, fixed for the lifetime of the
+    *  federation at initialization, is a constant the compiler can fold at
+    *  the cyclic call sites.
     *  @return Time value in the HLA Logical base time.
     *  @param value Time value as a floating point double in seconds. */
-   static int64_t to_base_time( double const value );
+   static int64_t to_base_time( double const value )
+   {
+      // Do a range check on the double value in seconds.
+      if ( value > max_logical_time_seconds ) {
+         return INT64_MAX;
+      } else if ( value < -max_logical_time_seconds ) {
+         return -INT64_MAX;
+      }
+
+      // A more efficient way to calculate the time in the base units_string by avoiding fmod().
+      double        seconds;
+      int64_t const fractional = (int64_t)std::round( std::modf( value, &seconds ) * base_time_multiplier );
+      return ( ( (int64_t)seconds * base_time_multiplier ) + fractional );
+   }
 
    /*! @brief Converts the given integer time to an floating-point time representing seconds.
+    *  @details The fractional part multiplies by the cached reciprocal of
+    *  the base time multiplier instead of dividing by it on every call.
     *  @return Time value in seconds.
     *  @param time_in_base_units Time value as a 64-bit integer in the units_string specified for this class. */
-   static double to_seconds( int64_t const time_in_base_units );
+   static double to_seconds( int64_t const time_in_base_units )
+   {
+      double const seconds    = (double)( time_in_base_units / base_time_multiplier );
+      double const fractional = (double)( time_in_base_units % base_time_multiplier ) * base_time_multiplier_reciprocal;
+      return ( seconds + fractional );
+   }
 
    /*! @brief Converts the given integer time to an integer time representing whole seconds.
     *  @return Time value in whole seconds.
     *  @param time_in_base_units Time value as a 64-bit integer in the units_string specified for this class. */
-   static int64_t to_whole_seconds( int64_t const time_in_base_units );
+   static int64_t to_whole_seconds( int64_t const time_in_base_units )
+   {
+      return ( time_in_base_units / base_time_multiplier );
+   }
 
   protected:
-   static HLABaseTimeEnum base_units;               ///< @trick_units{--} Base time units.
-   static std::string     units_string;             ///< @trick_units{--} Base time units as a string.
-   static int64_t         base_time_multiplier;     ///< @trick_units{--} Multiplier for the base units.
-   static double          max_logical_time_seconds; ///< @trick_units{--} Maximum logical time supported in seconds.
+   static HLABaseTimeEnum base_units;                      ///< @trick_units{--} Base time units.
+   static std::string     units_string;                    ///< @trick_units{--} Base time units as a string.
+   static int64_t         base_time_multiplier;            ///< @trick_units{--} Multiplier for the base units.
+   static double          base_time_multiplier_reciprocal; ///< @trick_units{--} Cached reciprocal of the multiplier so conversions multiply instead of divide.
+   static double          max_logical_time_seconds;        ///< @trick_units{--} Maximum logical time supported in seconds.
 
   private:
    // Do not allow the copy constructor or assignment operator.
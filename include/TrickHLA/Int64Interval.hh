@@ -76,7 +76,7 @@ class Int64Interval
    // Constructors and Destructor
    //
    /*! @brief Default constructor for the TrickHLA Int64Interval class. */
-   Int64Interval() : hla_interval( 0LL )
+   Int64Interval() : base_time( 0LL )
    {
       return;
    }
@@ -162,10 +162,11 @@ class Int64Interval
    // Access routines
    //
    /*! @brief Get the HLA integer time.
-    *  @return A copy of the encapsulated HLAinteger64Interval class. */
+    *  @return The time interval as an HLAinteger64Interval class for use
+    *  at the RTI ambassador boundary. */
    RTI1516_NAMESPACE::HLAinteger64Interval get() const
    {
-      return ( this->hla_interval );
+      return RTI1516_NAMESPACE::HLAinteger64Interval( this->base_time );
    }
 
    //
@@ -174,7 +175,10 @@ class Int64Interval
    /*! @brief Return the time, in the base time, contained in the current
     * timestamp as a 64-bit integer value.
     *  @return Time in integer the base time. */
-   int64_t get_base_time() const;
+   int64_t get_base_time() const
+   {
+      return ( this->base_time );
+   }
 
    /*! @brief Return the current timestamp in seconds as a double precision floating point value.
     *  @return Time in seconds as a floating point double. */
@@ -182,7 +186,10 @@ class Int64Interval
 
    /*! @brief Return true if the value is zero, false otherwise.
     *  @return True if zero, false otherwise. */
-   bool is_zero() const;
+   bool is_zero() const
+   {
+      return ( this->base_time == 0LL );
+   }
 
    /*! @brief Returns a summary of the time.
     *  @return Summary of time as a wide string. */
@@ -193,11 +200,17 @@ class Int64Interval
    //
    /*! @brief Set the time interval to the given value.
     *  @param value The desired time interval in integer the base time. */
-   void set( int64_t const value );
+   void set( int64_t const value )
+   {
+      this->base_time = value;
+   }
 
    /*! @brief Set the time interval to the given value.
     *  @param value The desired time interval in seconds. */
-   void set( double const value );
+   void set( double const value )
+   {
+      this->base_time = Int64BaseTime::to_base_time( value );
+   }
 
    /*! @brief Set the time interval to the given value.
     *  @param value The desired time interval as an HLA LogicalTimeInterval. */
@@ -215,8 +228,11 @@ class Int64Interval
     *  @return The the fractional part of the current timestamp. */
    int64_t get_fractional_seconds() const;
 
-   RTI1516_NAMESPACE::HLAinteger64Interval hla_interval; /**< @trick_io{**}
-      The HLA standard's class representation of integer64 interval. */
+   int64_t base_time; /**< @trick_io{**}
+      Time interval as a plain 64-bit integer count of base time units so
+      internal arithmetic avoids the RTI LogicalTimeInterval interfaces. The
+      HLAinteger64Interval representation is constructed only at the RTI
+      ambassador boundary. */
 };
 
 } // namespace TrickHLA
@@ -78,7 +78,7 @@ class Int64Time
    // Constructors and Destructor
    //
    /*! @brief Default constructor for the TrickHLA Int64Time class. */
-   Int64Time() : hla_time( 0LL )
+   Int64Time() : base_time( 0LL )
    {
       return;
    }
@@ -500,10 +500,11 @@ class Int64Time
    // Interface routines
    //
    /*! @brief Get the HLA integer time.
-    *  @return A copy of the encapsulated HLAinteger64Time class. */
+    *  @return The time as an HLAinteger64Time class for use at the RTI
+    *  ambassador boundary. */
    RTI1516_NAMESPACE::HLAinteger64Time get() const
    {
-      return ( this->hla_time );
+      return RTI1516_NAMESPACE::HLAinteger64Time( this->base_time );
    }
 
    // decodes the HLA encoded time into encapsulated class
@@ -517,7 +518,10 @@ class Int64Time
    /*! @brief Return the time, in the base time, contained in the current
     * timestamp as a 64-bit integer value.
     *  @return Time in integer the base time. */
-   int64_t get_base_time() const;
+   int64_t get_base_time() const
+   {
+      return ( this->base_time );
+   }
 
    /*! @brief Return the current timestamp in seconds as a double precision floating point value.
     *  @return Time in seconds as a floating point double. */
@@ -532,11 +536,17 @@ class Int64Time
    //
    /*! @brief Set the time to the given value.
     *  @param value The desired time in integer the base time. */
-   void set( int64_t const value );
+   void set( int64_t const value )
+   {
+      this->base_time = value;
+   }
 
    /*! @brief Set the time to the given value.
     *  @param value The desired time interval in seconds. */
-   void set( double const value );
+   void set( double const value )
+   {
+      this->base_time = Int64BaseTime::to_base_time( value );
+   }
 
    /*! @brief Set the time to the given value.
     *  @param value The desired time as an HLA LogicalTime. */
@@ -544,7 +554,10 @@ class Int64Time
 
    /*! @brief Set the time to the given value.
     *  @param value The desired time as a TrickHLA::Int64Time. */
-   void set( Int64Time const &value );
+   void set( Int64Time const &value )
+   {
+      this->base_time = value.get_base_time();
+   }
 
   private:
    /*! @brief Return the whole seconds part of the current timestamp.
@@ -555,8 +568,10 @@ class Int64Time
     *  @return The the fractional part of the current timestamp. */
    int64_t get_fractional_seconds() const;
 
-   RTI1516_NAMESPACE::HLAinteger64Time hla_time; /**< @trick_io{**}
-      HLA standard's class representation of integer64 time. */
+   int64_t base_time; /**< @trick_io{**}
+      Time as a plain 64-bit integer count of base time units so internal
+      arithmetic avoids the RTI LogicalTime interfaces. The HLAinteger64Time
+      representation is constructed only at the RTI ambassador boundary. */
 
 }; // end of Int64Time class
 
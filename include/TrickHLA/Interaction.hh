@@ -25,8 +25,10 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../source/TrickHLA/ItemQueue.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/OpaqueBuffer.cpp}
 @trick_link_dependency{../../source/TrickHLA/Parameter.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
@@ -43,6 +45,7 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_INTERACTION_HH
 
 // System include files.
+#include <vector>
 
 // Trick include files.
 #include "trick/MemoryManager.hh"
@@ -51,7 +54,9 @@ NASA, Johnson Space Center\n
 // TrickHLA include files
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
 
@@ -116,6 +121,12 @@ class Interaction
 
    InteractionHandler *handler; ///< @trick_units{--} Interaction handler.
 
+   bool lazy_parameter_decode; ///< @trick_units{--} True to skip the eager decode of every received parameter and let the interaction handler decode just the parameters it reads on first access (default: false).
+
+   int receive_priority; ///< @trick_units{--} Drain priority for the received items of this interaction class, higher priorities are processed first each cycle (default: 0).
+
+   bool batch_enabled; ///< @trick_units{--} True to pack the receive-order sends of this interaction each frame into one carrier interaction flushed per data cycle (default: false).
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -171,15 +182,103 @@ class Interaction
    bool send( double                  send_HLA_time,
               RTI1516_USERDATA const &the_user_supplied_tag );
 
+   /*! @brief Sends a caller supplied preencoded parameter value map to the
+    *  RTI using Timestamp Order, skipping the per-parameter encode.
+    *  @return True if interaction was sent; False otherwise.
+    *  @param param_values_map Preencoded parameter values to send.
+    *  @param send_HLA_time The HLA logical time the user wants to send the interaction.
+    *  @param the_user_supplied_tag Users tag. */
+   bool send( RTI1516_NAMESPACE::ParameterHandleValueMap const &param_values_map,
+              double                                            send_HLA_time,
+              RTI1516_USERDATA const                           &the_user_supplied_tag );
+
    /*! @brief Process the interaction by decoding the parameter data into the
     * users simulation variables and calling the users interaction-handler. */
    void process_interaction();
 
+   /*! @brief Decode the named parameter from its buffer into the users
+    * simulation variable if a received value is pending. This is the lazy
+    * first-access decode used by the interaction handler when
+    * lazy_parameter_decode is enabled.
+    *  @return True if the parameter FOM name is known, false otherwise.
+    *  @param parameter_FOM_name FOM name of the parameter to decode. */
+   bool decode_parameter( char const *parameter_FOM_name );
+
+   /*! @brief Decode every parameter with a pending received value into the
+    * users simulation variables. */
+   void decode_all_parameters();
+
    /*! @brief Extracts the parameters for the received Interaction.
     *  @param interaction_item Interaction item.
     *  @return True if successfull extracted data, false otherwise. */
    bool extract_data( InteractionItem *interaction_item );
 
+   /*! @brief Query if the users interaction handler is flagged as deferrable.
+    *  @return True if received items are dispatched on a worker pool thread. */
+   bool is_deferrable() const;
+
+   /*! @brief Query if carrier-interaction batching is enabled.
+    *  @return True if the receive-order sends of this interaction are batched. */
+   bool is_batch_enabled() const
+   {
+      return batch_enabled;
+   }
+
+   /*! @brief Send the batch of interactions packed this frame, if any, as
+    * one carrier interaction of this class with the length-prefixed records
+    * in the user supplied tag, then reset the batch. Called once per data
+    * cycle by the Manager. */
+   void send_interaction_batch();
+
+   /*! @brief One interaction unpacked from a received carrier batch. */
+   struct BatchRecord {
+      RTI1516_NAMESPACE::ParameterHandleValueMap param_values;      ///< @trick_io{**} Encoded parameter values of the packed interaction.
+      RTI1516_USERDATA                           user_supplied_tag; ///< @trick_io{**} User supplied tag of the packed interaction.
+   };
+
+   /*! @brief Determine if a received user supplied tag is a carrier batch.
+    *  @return True if the tag holds packed interaction records.
+    *  @param the_user_supplied_tag The received user supplied tag. */
+   static bool is_batch_tag( RTI1516_USERDATA const &the_user_supplied_tag );
+
+   /*! @brief Unpack the length-prefixed records of a received carrier batch.
+    *  @return True if every record was unpacked, false for a malformed batch.
+    *  @param rti_amb               RTI ambassador used to decode the parameter handles.
+    *  @param the_user_supplied_tag The received carrier batch tag.
+    *  @param records               Returns the unpacked interaction records. */
+   static bool unpack_batch( RTI1516_NAMESPACE::RTIambassador *rti_amb,
+                             RTI1516_USERDATA const           &the_user_supplied_tag,
+                             std::vector< BatchRecord >       &records );
+
+   /*! @brief Hand a received interaction item to this interaction's deferred
+    * dispatch queue, posting a worker pool job to drain the queue if one is
+    * not already in flight. Takes ownership of the item.
+    *  @param interaction_item Received interaction item to dispatch. */
+   void defer_interaction_item( InteractionItem *interaction_item );
+
+   /*! @brief Drain the deferred dispatch queue by decoding and processing
+    * each queued interaction item in receive order. Only one job per
+    * interaction is ever in flight, which preserves the receive order per
+    * interaction class. Runs on a worker pool thread. */
+   void process_deferred_items();
+
+   /*! @brief Get the receive queue holding the received interaction items
+    * for this interaction class. Giving each interaction class its own
+    * queue keeps producers of different classes from contending on a
+    * shared lock.
+    *  @return Reference to this interaction's receive queue. */
+   ItemQueue &get_receive_queue()
+   {
+      return receive_queue;
+   }
+
+   /*! @brief Get the drain priority for this interaction's receive queue.
+    *  @return Drain priority, higher priorities are drained first. */
+   int get_receive_priority() const
+   {
+      return receive_priority;
+   }
+
    // Instance methods
    /*! @brief Get the FOM name for this interaction.
     *  @return Constant string with the FOM name for this interaction. */
@@ -351,6 +450,11 @@ class Interaction
 
    Int64Time time; ///< @trick_units{--} Time used for Timestamp Order interaction.
 
+   ItemQueue deferred_queue;      ///< @trick_io{**} Received interaction items awaiting deferred dispatch.
+   bool      deferred_job_active; ///< @trick_io{**} True when a worker pool job is draining the deferred queue.
+
+   ItemQueue receive_queue; ///< @trick_io{**} Received interaction items for this interaction class, fed directly from the Manager receive routing table.
+
    Manager                                  *manager;      ///< @trick_units{--} TrickHLA Manager.
    RTI1516_NAMESPACE::InteractionClassHandle class_handle; ///< @trick_io{**} RTI Interaction Class handle.
 
@@ -358,7 +462,28 @@ class Interaction
    size_t         user_supplied_tag_capacity; ///< @trick_units{--} Capacity of the user supplied tag.
    unsigned char *user_supplied_tag;          ///< @trick_units{--} User supplied tag data.
 
+   RTI1516_NAMESPACE::ParameterHandleValueMap send_param_values_map; ///< @trick_io{**} Reusable parameter values map for the send path, keyed once by the stable parameter handles.
+
+   OpaqueBuffer batch_buffer; ///< @trick_io{**} Length-prefixed records of the receive-order sends packed this frame, guarded by the interaction mutex.
+   unsigned int batch_count;  ///< @trick_io{**} Number of interactions packed into the batch buffer this frame.
+
   private:
+   /*! @brief Pack one encoded interaction into the batch buffer as a
+    * length-prefixed record. The caller must hold the interaction mutex.
+    *  @param param_values_map      Encoded parameter values to pack.
+    *  @param the_user_supplied_tag Users tag to pack with the record. */
+   void pack_into_batch( RTI1516_NAMESPACE::ParameterHandleValueMap const &param_values_map,
+                         RTI1516_USERDATA const                           &the_user_supplied_tag );
+
+   /*! @brief Fill the reusable send parameter values map in place with the
+    * current encoded parameter values. The caller must hold the mutex. */
+   void fill_send_parameter_values();
+
+   /*! @brief Worker pool job entry point for the deferred dispatch.
+    *  @return Always NULL.
+    *  @param arg Pointer to the Interaction instance to drain. */
+   static void *process_deferred_items_job( void *arg );
+
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for Interaction class.
     *  @details This constructor is private to prevent inadvertent copies. */
@@ -126,6 +126,19 @@ class InteractionHandler
     *  @return Current CTE time. */
    double get_cte_time();
 
+   /*! @brief Decode the named parameter into the users simulation variable
+    * if a received value is pending. Call this from receive_interaction()
+    * before reading a parameter when the interaction is configured with
+    * lazy_parameter_decode, so only the parameters actually read are ever
+    * decoded.
+    *  @return True if the parameter FOM name is known, false otherwise.
+    *  @param parameter_FOM_name FOM name of the parameter to decode. */
+   bool decode_parameter( char const *parameter_FOM_name );
+
+   /*! @brief Decode every parameter with a pending received value into the
+    * users simulation variables. */
+   void decode_all_parameters();
+
    //-----------------------------------------------------------------
    // This is a virtual function and must be defined by a full class.
    //-----------------------------------------------------------------
@@ -133,9 +146,31 @@ class InteractionHandler
     *  @param the_user_supplied_tag Users tag. */
    virtual void receive_interaction( RTI1516_USERDATA const &the_user_supplied_tag );
 
+   /*! @brief Flag this handler as deferrable so that receive_interaction()
+    * is dispatched on a worker pool thread instead of inline in the
+    * interaction drain loop, which keeps a slow handler (for example one
+    * doing blocking I/O) from stalling the processing of the other queued
+    * interactions for the frame. Receive order is still preserved per
+    * interaction class. Only flag handlers whose processing is not
+    * time-critical within the frame.
+    *  @param flag True to dispatch this handler on a worker pool thread. */
+   void set_deferrable( bool const flag )
+   {
+      this->deferrable = flag;
+   }
+
+   /*! @brief Query if this handler is dispatched on a worker pool thread.
+    *  @return True if this handler is flagged as deferrable. */
+   bool is_deferrable() const
+   {
+      return this->deferrable;
+   }
+
   protected:
    Interaction *interaction; ///< @trick_io{**} Pointer to the TrickHLA interaction.
 
+   bool deferrable; ///< @trick_units{--} True to dispatch receive_interaction() on a worker pool thread. Default: false.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for InteractionHandler class.
@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/ItemPool.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/Item.cpp}
@@ -40,6 +41,7 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_INTERACTION_ITEM_HH
 
 // System include files.
+#include <cstddef>
 
 // Trick include files.
 
@@ -105,6 +107,18 @@ class InteractionItem : public Item
    //
    // Public constructors and destructor.
    //
+   /*! @brief Class level allocation operator that serves InteractionItems
+    *  from a fixed-size pool, falling back to the heap when the pool is
+    *  exhausted, making steady-state interaction receipt allocation-free.
+    *  @return Pointer to the allocated memory.
+    *  @param size Size in bytes to allocate. */
+   static void *operator new( std::size_t size );
+
+   /*! @brief Class level deallocation operator that recycles pooled
+    *  InteractionItems back into the pool.
+    *  @param ptr Pointer to the memory to free. */
+   static void operator delete( void *ptr );
+
    /*! @brief Default constructor for the TrickHLA InteractionItem class. */
    InteractionItem();
 
@@ -145,8 +159,27 @@ class InteractionItem : public Item
    /*! @brief Decode all the parameter_queue values into parm_items linear array. */
    void checkpoint_queue();
 
-   /*! @brief removes all the parm_items values. */
-   void clear_parm_items();
+   /*! @brief Decode all the parameter_queue values into the parm_items
+    *  linear array with the parameter payloads staged into the supplied
+    *  preallocated arena instead of a Trick memory allocation per payload.
+    *  The arena owns the payload data, so clear_parm_items() must be called
+    *  with free_parm_data set to false.
+    *  @param arena        Preallocated contiguous payload arena.
+    *  @param arena_offset Current arena offset in bytes, advanced past the
+    *                      staged payloads. */
+   void checkpoint_queue( unsigned char *arena, size_t &arena_offset );
+
+   /*! @brief Get the number of payload bytes a checkpoint of this item
+    *  needs, i.e. the user supplied tag plus all the queued parameter
+    *  payloads.
+    *  @return Payload size in bytes. */
+   size_t get_checkpoint_payload_size();
+
+   /*! @brief removes all the parm_items values.
+    *  @param free_parm_data True (default) to free the per-parameter payload
+    *  data, false when the payloads are staged in an arena owned by the
+    *  caller. */
+   void clear_parm_items( bool const free_parm_data = true );
 
    /*! @brief Encode all the parm_items values into this InteractionItem. */
    void restore_queue();
@@ -0,0 +1,106 @@
+/*!
+@file TrickHLA/ItemPool.hh
+@ingroup TrickHLA
+@brief This class represents a fixed-size pool allocator for Items.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ItemPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ITEM_POOL_HH
+#define TRICKHLA_ITEM_POOL_HH
+
+// System include files.
+#include <cstddef>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class ItemPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ItemPool();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Constructor for the TrickHLA ItemPool class.
+    *  @param item_size  Size in bytes of each pooled item.
+    *  @param item_count Number of items in the fixed-size slab. */
+   ItemPool( size_t const item_size, size_t const item_count );
+
+   /*! @brief Destructor for the TrickHLA ItemPool class. */
+   virtual ~ItemPool();
+
+  public:
+   /*! @brief Allocate an item from the pool.
+    *  @return Pointer to item memory, or NULL if the pool is exhausted and
+    *  the caller needs to fall back to heap allocation. */
+   void *allocate();
+
+   /*! @brief Return an item to the pool if it came from the pool slab.
+    *  @return True if the item was returned to the pool, false if it did
+    *  not come from the pool slab and the caller needs to free it.
+    *  @param item Pointer to the item memory to return. */
+   bool deallocate( void *item );
+
+   MutexLock mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
+
+  private:
+   size_t item_size;  ///< @trick_units{count} Size in bytes of each pooled item.
+   size_t item_count; ///< @trick_units{count} Number of items in the slab.
+
+   unsigned char *slab;      ///< @trick_io{**} Slab of memory holding all the pooled items, allocated on first use.
+   void          *free_head; ///< @trick_io{**} Head of the intrusive free-list of available items.
+
+  private:
+   /*! @brief Allocate the slab and build the free-list. The caller must
+    *  hold the pool mutex. */
+   void create_slab();
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ItemPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ItemPool( ItemPool const &rhs );
+   /*! @brief Assignment operator for ItemPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ItemPool &operator=( ItemPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ITEM_POOL_HH: Do NOT put anything after this line!
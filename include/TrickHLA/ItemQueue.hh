@@ -35,9 +35,13 @@ NASA, Johnson Space Center\n
 #ifndef TRICKHLA_ITEM_QUEUE_HH
 #define TRICKHLA_ITEM_QUEUE_HH
 
+// System include files.
+#include <cstddef>
+
 // TrickHLA include files.
 #include "TrickHLA/Item.hh"
 #include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/Types.hh"
 
 namespace TrickHLA
 {
@@ -89,10 +93,40 @@ class ItemQueue
    /*! @brief Pop an item off the queue. */
    void pop();
 
-   /*! @brief Push the item onto the queue.
+   /*! @brief Atomically detach the entire linked-list of items from the
+    *  queue under a single lock acquisition so the caller can process the
+    *  detached chain lock-free.
+    *  @return Head item of the detached linked-list, or NULL if the queue
+    *  was empty. The caller takes ownership of the items and must delete
+    *  each one once processed. */
+   Item *drain();
+
+   /*! @brief Push the item onto the queue. The queue takes ownership of
+    *  the item; if the bounded queue is full and the overflow policy drops
+    *  a value, the dropped item is deleted.
     *  @param item Item to put into the queue. */
    void push( Item *item );
 
+   /*! @brief Bound the queue capacity and set the policy applied when an
+    *  item is pushed while the queue is full.
+    *  @param queue_capacity Maximum number of queued items, 0 for unbounded.
+    *  @param policy Overflow policy applied when the bounded queue is full. */
+   void set_capacity( int const queue_capacity, QueueOverflowPolicyEnum const policy );
+
+   /*! @brief Get the most items the queue has ever held.
+    *  @return High-water mark of the queue depth. */
+   int get_high_water_mark() const
+   {
+      return high_water_mark;
+   }
+
+   /*! @brief Get the number of items dropped by the overflow policy.
+    *  @return Count of the dropped items. */
+   long long get_dropped_count() const
+   {
+      return dropped_count;
+   }
+
    /*! @brief Re-established original 'head' queue pointer after the queue has
     *  been walked. */
    void rewind();
@@ -109,6 +143,12 @@ class ItemQueue
   private:
    int count; ///< @trick_units{count} Number of elements in the queue.
 
+   int                     capacity;        ///< @trick_units{count} Maximum number of queued items, 0 for unbounded.
+   QueueOverflowPolicyEnum overflow_policy; ///< @trick_units{--} Policy applied when an item is pushed while the bounded queue is full.
+
+   int       high_water_mark; ///< @trick_units{count} Most items the queue has ever held.
+   long long dropped_count;   ///< @trick_units{count} Number of items dropped by the overflow policy.
+
    Item *head; ///< @trick_units{--} First item in linked-list queue.
    Item *tail; ///< @trick_units{--} Last item in linked-list queue.
 
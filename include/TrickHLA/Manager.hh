@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
 @trick_link_dependency{../../source/TrickHLA/ExecutionConfigurationBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/ExecutionControlBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
@@ -29,6 +30,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
+@trick_link_dependency{../../source/TrickHLA/WorkerThreadPool.cpp}
 
 @revs_title
 @revs_begin
@@ -45,11 +47,15 @@ NASA, Johnson Space Center\n
 
 // System include files.
 #include <cstdint>
+#include <pthread.h>
 #include <string>
+#include <vector>
 
 // TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/ItemQueue.hh"
+#include "TrickHLA/WorkerThreadPool.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/StandardsSupport.hh"
@@ -129,6 +135,18 @@ class Manager
    char *restore_file_name;           ///< @trick_io{*i} @trick_units{--} file name, which will be the label name
    bool  initiated_a_federation_save; ///< @trick_io{**} did this manager initiate the federation save?
 
+   unsigned int data_job_worker_count; ///< @trick_units{--} Number of worker threads for parallel per-object cyclic data jobs, default: 0 (serial).
+
+   bool adaptive_data_job_scheduling; ///< @trick_units{--} True to adaptively order the parallel per-object data jobs by their measured cost, heaviest first, periodically rebalanced with hysteresis as the load shifts, default: false.
+
+   unsigned int data_job_rebalance_period; ///< @trick_units{--} Number of data job batches between adaptive schedule rebalances, default: 64.
+
+   bool auto_stagger_send_phase; ///< @trick_units{--} True to automatically spread the send phase offsets of the main thread associated objects across their data cycle, default: false.
+
+   bool warm_start_enabled; ///< @trick_units{--} True to persist the required object discovery outcome to the warm start cache file at steady state and, when rejoining, validate the cached roster with per-object name probes instead of waiting for discovery callbacks, default: false.
+
+   char *warm_start_cache_file; ///< @trick_units{--} Warm start discovery cache file name, default: "warm_start.cache".
+
   public:
    //
    // Public constructors and destructor.
@@ -192,6 +210,13 @@ class Manager
     *  @param sync_point_label Name of the synchronization point label. */
    void wait_for_init_sync_point( char const *sync_point_label );
 
+   /*! @brief Achieve all the specified sync-points then wait for the
+    * federation to become synchronized on them. Achieving the whole batch
+    * up front overlaps the federation synchronization of every sync-point
+    * at the phase boundary.
+    *  @param sync_point_label_list Comma separated list of synchronization point labels. */
+   void wait_for_init_sync_points( char const *sync_point_label_list );
+
    /*! @brief Request an update to the object attributes for the given object
     * instance name.
     *  @param instance_name Object instance name. */
@@ -202,12 +227,85 @@ class Manager
     *  @param instance_name Object instance name. */
    void request_data_update( char const *instance_name );
 
+   /*! @brief Request an update to the subscribed attributes of all the
+    * objects, using one class-level request per object class. */
+   void request_data_update_for_all_objects();
+
    /*! @brief Send cyclic an requested atrributes data to the remote federates. */
    void send_cyclic_and_requested_data();
 
    /*! @brief Handle the received cyclic data. */
    void receive_cyclic_data();
 
+   /*! @brief Mark the per cycle-time object iteration lists as stale so
+    *  they are rebuilt on the next cyclic data job, used when an object
+    *  data cycle time changes. */
+   void invalidate_data_cycle_groups()
+   {
+      this->data_cycle_groups_built_for = 0LL;
+   }
+
+   /*! @brief Adjust the cyclic receive processing priority of an object at
+    *  runtime and rebuild the cached receive processing orders, so the
+    *  change takes effect on the next cyclic receive job.
+    *  @param obj_index Index of the object in the 'objects' array.
+    *  @param priority New receive processing priority, higher priorities
+    *  are processed first each frame. */
+   void set_object_receive_priority( unsigned int const obj_index, int const priority );
+
+   /*! @brief Change the send cycle time of an attribute at runtime without
+    *  a federation rejoin. The change is queued and applied by the main
+    *  thread at the next data cycle boundary, which revalidates the cycle
+    *  time against the core job cycle time and rebuilds the object's send
+    *  cycle wheel.
+    *  @param obj_instance_name Object instance name.
+    *  @param attr_FOM_name     FOM name of the attribute.
+    *  @param cycle_time        New attribute cycle time in seconds. */
+   void set_attribute_cycle_time( char const *obj_instance_name,
+                                  char const *attr_FOM_name,
+                                  double const cycle_time );
+
+   /*! @brief Enable or disable publication of an attribute, or of all an
+    *  object's attributes, at runtime without a federation rejoin. The
+    *  change is queued and applied by the main thread at the next data
+    *  cycle boundary. The RTI class-level publication is left in place, so
+    *  disabling only stops the attribute values from being sent.
+    *  @param obj_instance_name Object instance name.
+    *  @param attr_FOM_name     FOM name of the attribute, NULL for all the
+    *  object's attributes.
+    *  @param enable            True to publish the attribute values. */
+   void set_attribute_publish( char const *obj_instance_name,
+                               char const *attr_FOM_name,
+                               bool const  enable );
+
+   /*! @brief Enable or disable the local consumption of a subscribed
+    *  attribute, or of all an object's attributes, at runtime without a
+    *  federation rejoin. The change is queued and applied by the main
+    *  thread at the next data cycle boundary. The RTI class-level
+    *  subscription is left in place, so disabling only stops the reflected
+    *  values from being unpacked into the simulation.
+    *  @param obj_instance_name Object instance name.
+    *  @param attr_FOM_name     FOM name of the attribute, NULL for all the
+    *  object's attributes.
+    *  @param enable            True to consume the reflected attribute values. */
+   void set_attribute_subscribe( char const *obj_instance_name,
+                                 char const *attr_FOM_name,
+                                 bool const  enable );
+
+   /*! @brief Switch the subscription for an object instance on or off at
+    *  runtime, in bulk. The switches are queued and batched, so shedding
+    *  hundreds of instances in one frame does not issue hundreds of serial
+    *  RTI calls: at the next data cycle boundary the switched instances
+    *  are grouped by object class and at most one class-scoped RTI
+    *  subscribe or unsubscribe is issued per affected class. The class
+    *  subscription is only shed once every instance of the class is
+    *  switched off; until then the switched-off instances are filtered
+    *  locally by not unpacking their reflected values.
+    *  @param obj_instance_name Object instance name.
+    *  @param enable            True to consume updates for the instance. */
+   void set_object_subscribe( char const *obj_instance_name,
+                              bool const  enable );
+
    /*! @brief Process the object discovery.
     *  @return True if the instance was recognized, false otherwise.
     *  @param theObject             Instance handle to a Federate or Object instance.
@@ -217,6 +315,13 @@ class Manager
                                   RTI1516_NAMESPACE::ObjectClassHandle    theObjectClass,
                                   std::wstring const                     &theObjectInstanceName );
 
+   /*! @brief Batch resolve the object discovery callbacks queued by
+    * discover_object_instance() against the simulation data objects. Called
+    * on the simulation thread from the discovery wait loops and on an object
+    * instance lookup miss so the name matching never runs per callback on
+    * the FedAmb callback thread. */
+   void process_pending_discoveries();
+
    /*! @brief Gets the TrickHLA Object for the specified RTI Object Instance Handle.
     *  @return TrickHLA Object.
     *  @param instance_id Object instance handle. */
@@ -279,6 +384,11 @@ class Manager
    /*! @brief Process the received interactions. */
    void process_interactions();
 
+   /*! @brief Send the carrier interaction batches packed this frame by the
+    * interactions with batching enabled. Called once per data cycle at the
+    * end of the send stage. */
+   void send_interaction_batches();
+
    /*! @brief Process all received interactions by calling in turn each
     * interaction handler that is subscribed to the interaction.
     * @param theInteraction     Interaction handle.
@@ -296,6 +406,12 @@ class Manager
    /*! @brief Process the ownership requests. */
    void process_ownership();
 
+   /*! @brief Register the specified object as having pending ownership
+    * transfer work, so process_ownership() only walks objects with work
+    * instead of scanning every object every frame.
+    *  @param obj Object with pending ownership transfer work. */
+   void register_ownership_work( Object *obj );
+
    /*! @brief Identifies the object as deleted from the RTI.
     *  @param instance_id HLA object instance handle. */
    void mark_object_as_deleted_from_federation(
@@ -361,6 +477,17 @@ class Manager
     * instances with the RTI. */
    void wait_for_registration_of_required_objects();
 
+   /*! @brief Persist the object discovery outcome to the warm start cache
+    * file so a rejoining federate can warm start its discovery. */
+   void write_warm_start_cache();
+
+   /*! @brief Try to warm start the object discovery from the warm start
+    * cache file by validating the cached instance roster with per-object
+    * name probes to the RTI.
+    *  @return True if all the required object instances were resolved from
+    *  the cache, false to fall back to waiting for discovery callbacks. */
+   bool try_warm_start_discovery();
+
    /*! @brief Sets the RTI run-time type IDs/handles for the object, attributes,
     * interactions, and parameters. */
    void setup_all_RTI_handles();
@@ -393,6 +520,15 @@ class Manager
    void provide_attribute_update( RTI1516_NAMESPACE::ObjectInstanceHandle const &theObject,
                                   RTI1516_NAMESPACE::AttributeHandleSet const   &theAttributes );
 
+   /*! @brief Turn cyclic updates on or off for the given object instance
+    *  and attributes as told by the RTI attribute relevance advisory.
+    *  @param theObject HLA object instance handle.
+    *  @param theAttributes HLA attribute handle set.
+    *  @param updates_on True to turn updates on, false to turn them off. */
+   void set_attribute_update_advisory( RTI1516_NAMESPACE::ObjectInstanceHandle const &theObject,
+                                       RTI1516_NAMESPACE::AttributeHandleSet const   &theAttributes,
+                                       bool const                                     updates_on );
+
    /*! @brief Get the TrickHLA::Object count.
     *  @return The number of registered TrickHLA::Object instances. */
    int get_object_count() const
@@ -460,17 +596,114 @@ class Manager
     *  @return True if the manager is shutting down the federate. */
    bool is_shutdown_called() const;
 
+   /*! @brief Post an ownership transfer job to the persistent worker
+    *  thread pool instead of spawning a short-lived thread per transaction.
+    *  @return True if the job was queued, false if the pool is shut down.
+    *  @param job Job function to run on a worker thread.
+    *  @param arg Argument passed to the job function. */
+   bool post_ownership_job( WorkerThreadPool::JobFn job, void *arg )
+   {
+      return ownership_job_pool.post( job, arg );
+   }
+
+   /*! @brief Post a deferred interaction dispatch job to the worker thread
+    *  pool used for the interaction handlers flagged as deferrable.
+    *  @return True if the job was queued, false if the pool is shut down.
+    *  @param job Job function to run on a worker thread.
+    *  @param arg Argument passed to the job function. */
+   bool post_interaction_dispatch_job( WorkerThreadPool::JobFn job, void *arg )
+   {
+      return interaction_dispatch_pool.post( job, arg );
+   }
+
+   /*! @brief Bound the per-interaction receive queues and set the policy
+    *  applied when an interaction arrives while a queue is full. The bound
+    *  applies to each interaction class queue individually.
+    *  @param queue_capacity Maximum number of queued interactions per class, 0 for unbounded.
+    *  @param policy Overflow policy applied when a bounded queue is full. */
+   void set_interactions_queue_capacity( int const queue_capacity, QueueOverflowPolicyEnum const policy );
+
+   /*! @brief Get the most interactions any per-interaction receive queue
+    *  has ever held.
+    *  @return High-water mark across the per-interaction receive queues. */
+   int get_interactions_queue_high_water_mark() const;
+
+   /*! @brief Get the total number of interactions dropped by the overflow
+    *  policies of the per-interaction receive queues.
+    *  @return Count of the dropped interactions. */
+   long long get_interactions_queue_dropped_count() const;
+
    //
    // Private data.
    //
   private:
-   ItemQueue interactions_queue; ///< @trick_io{**} Interactions queue.
+   int                     interactions_queue_capacity;        ///< @trick_io{**} Capacity applied to each per-interaction receive queue, 0 for unbounded.
+   QueueOverflowPolicyEnum interactions_queue_overflow_policy; ///< @trick_io{**} Overflow policy applied to each per-interaction receive queue.
+
+   std::vector< int > interaction_drain_order; ///< @trick_io{**} Interaction indexes in receive queue drain order, highest receive priority first, rebuilt when the interaction count changes.
+
+   std::vector< unsigned int > object_receive_order; ///< @trick_io{**} Object indexes in cyclic receive processing order, highest receive priority first, rebuilt when the object count changes or a priority is adjusted at runtime.
+
+   std::vector< std::vector< unsigned int > > update_groups; ///< @trick_io{**} Member object indexes of each atomic update group, rebuilt when the object count changes.
+
+   int update_groups_obj_count; ///< @trick_io{**} Object count the atomic update group lists were built for, -1 forces a rebuild.
+
+   /*! @brief Identifies the kinds of deferred runtime reconfigurations. */
+   typedef enum {
+      RECONFIG_CYCLE_TIME       = 0, ///< Change an attribute send cycle time.
+      RECONFIG_PUBLISH          = 1, ///< Enable or disable attribute publication.
+      RECONFIG_SUBSCRIBE        = 2, ///< Enable or disable attribute consumption.
+      RECONFIG_OBJECT_SUBSCRIBE = 3  ///< Switch an object instance subscription on or off.
+   } ReconfigKindEnum;
+
+   /*! @brief One deferred runtime reconfiguration, applied by the main
+    * thread at the next data cycle boundary. */
+   struct PendingReconfig {
+      int        kind;       ///< Reconfiguration kind, see ReconfigKindEnum.
+      Object    *obj;        ///< Object the reconfiguration applies to.
+      Attribute *attr;       ///< Attribute the reconfiguration applies to, NULL for all the object's attributes.
+      double     cycle_time; ///< New attribute cycle time in seconds.
+      bool       enable;     ///< New publish or consume state.
+   };
+
+   std::vector< PendingReconfig > pending_reconfigs; ///< @trick_io{**} Deferred runtime reconfigurations awaiting a data cycle boundary.
+
+   MutexLock reconfig_mutex; ///< @trick_io{**} Mutex protecting the deferred reconfiguration list.
+
+   WorkerThreadPool ownership_job_pool; ///< @trick_io{**} Persistent worker thread pool for the ownership transfer jobs.
+
+   WorkerThreadPool interaction_dispatch_pool; ///< @trick_io{**} Persistent worker thread pool for the deferrable interaction handlers.
+
+   std::vector< Object * > ownership_pending_objects; ///< @trick_io{**} Objects with pending ownership transfer work, registered by ownership events.
+
+   MutexLock ownership_pending_mutex; ///< @trick_io{**} Mutex protecting the pending ownership work list.
 
    int              check_interactions_count; ///< @trick_units{--} Number of checkpointed interactions
-   InteractionItem *check_interactions;       ///< @trick_units{--} checkpoint-able version of interactions_queue
+   InteractionItem *check_interactions;       ///< @trick_units{--} checkpoint-able version of the per-interaction receive queues
+
+   size_t         check_interactions_arena_size; ///< @trick_units{--} Size in bytes of the checkpointed interactions payload arena.
+   unsigned char *check_interactions_arena;      ///< @trick_units{--} Grow-only contiguous arena holding every checkpointed interaction parameter payload and user supplied tag, reused across checkpoints.
 
    int64_t job_cycle_base_time; // us Cycle base time for the send_cyclic_and_requested_data and recieve_cyclic_data jobs
 
+   /*! @brief Objects sharing the same data cycle time, and for the send
+    *  lists also the same send phase offset, with the object indices laid
+    *  out contiguously in firing order. */
+   struct DataCycleGroup {
+      int64_t                     cycle_base_time; ///< Data cycle base time shared by this group.
+      int64_t                     phase_base_time; ///< Send phase offset in base time, reduced modulo the cycle, 0 for the receive lists.
+      std::vector< unsigned int > obj_indices;     ///< Object indices of this group in firing order.
+   };
+
+   std::vector< DataCycleGroup > send_cycle_groups;    ///< @trick_io{**} Per cycle-time and send phase iteration lists for the cyclic data sends.
+   std::vector< DataCycleGroup > receive_cycle_groups; ///< @trick_io{**} Per cycle-time iteration lists for the cyclic data receives.
+
+   int64_t data_cycle_groups_built_for; ///< @trick_io{**} Job cycle base time the iteration lists were built for, 0 when the lists are stale.
+
+   /*! @brief Rebuild the per cycle-time object iteration lists from the
+    *  current per-object data cycle times and send phase offsets. */
+   void rebuild_data_cycle_groups();
+
    bool rejoining_federate; ///< @trick_units{--} Internal flag to indicate if the federate is rejoining the federation.
    bool restore_determined; ///< @trick_io{**} Internal flag to indicate that the restore status has been determined.
    bool restore_federate;   ///< @trick_io{**} Internal flag to indicate if the federate is to be restored
@@ -481,7 +714,124 @@ class Manager
 
    ObjectInstanceMap object_map; ///< @trick_io{**} Map of all the Objects this federate uses, the Key is the object instance-handle.
 
-   TrickHLAObjInstanceNameIndexMap obj_name_index_map; ///< @trick_io{**} Map of object instance names to array index.
+   /*! @brief Open-addressing hash table entry for the object instance
+    *  handle to object lookups on the FedAmb callback path. */
+   struct ObjectInstanceHashEntry {
+      RTI1516_NAMESPACE::ObjectInstanceHandle handle; ///< Instance handle for this entry.
+      Object                                 *object; ///< Associated object, NULL for an empty slot.
+   };
+
+   std::vector< ObjectInstanceHashEntry > object_hash_table; ///< @trick_io{**} Open-addressing hash table keyed on the instance handle hash, power of two sized.
+   size_t                                 object_hash_mask;  ///< @trick_io{**} Hash table size minus one, zero when the table is not built.
+   size_t                                 object_hash_count; ///< @trick_io{**} Number of occupied hash table slots.
+
+   /*! @brief Size the instance handle hash table for the expected number
+    *  of object instances.
+    *  @param expected_count Expected number of object instances. */
+   void object_hash_initialize( size_t const expected_count );
+
+   /*! @brief Insert an entry into the instance handle hash table, growing
+    *  the table when it becomes half full.
+    *  @param instance_id Object instance handle key.
+    *  @param object Associated object. */
+   void object_hash_insert( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id,
+                            Object                                        *object );
+
+   /*! @brief Remove all the entries from the instance handle hash table. */
+   void object_hash_clear();
+
+   /*! @brief Find the object for the given instance handle in the hash table.
+    *  @return Associated object, or NULL if not found or the table is not built.
+    *  @param instance_id Object instance handle key. */
+   Object *object_hash_find( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id ) const;
+
+   /*! @brief Record of an object discovery callback queued on the FedAmb
+    *  callback thread for batch resolution on the simulation thread. */
+   struct PendingDiscoveryRecord {
+      RTI1516_NAMESPACE::ObjectInstanceHandle instance_handle; ///< Discovered object instance handle.
+      RTI1516_NAMESPACE::ObjectClassHandle    class_handle;    ///< Object class of the discovered instance.
+      std::wstring                            instance_name;   ///< Object instance name.
+   };
+
+   std::vector< PendingDiscoveryRecord > pending_discoveries; ///< @trick_io{**} Discovery records queued by discover_object_instance(), guarded by obj_discovery_mutex.
+
+   pthread_cond_t obj_discovery_cond; ///< @trick_io{**} Condition signaled when a discovery record is queued, guarded by obj_discovery_mutex.
+
+   ElapsedTimeStats obj_discovery_wait_stats; ///< @trick_io{**} Statistics of the wall clock time spent blocked waiting for required object discoveries.
+
+   /*! @brief Routing table entry resolved at subscribe time that maps a
+    *  subscribed interaction class handle to the interactions array index. */
+   struct InteractionClassRoute {
+      RTI1516_NAMESPACE::InteractionClassHandle handle; ///< Interaction class handle for this entry.
+      int                                       index;  ///< Index into the interactions array, -1 for an empty slot.
+   };
+
+   std::vector< InteractionClassRoute > interaction_route_table; ///< @trick_io{**} Open-addressing routing table keyed on the interaction class handle hash, power of two sized.
+   size_t                               interaction_route_mask;  ///< @trick_io{**} Routing table size minus one, zero when the table is not built.
+
+   /*! @brief Build the interaction routing table from the subscribed
+    *  interactions once the RTI class handles have been resolved. */
+   void build_interaction_routes();
+
+   /*! @brief Find the interactions array index for the given interaction
+    *  class handle in the routing table.
+    *  @return Index of the subscribed interaction for the class, or -1 if
+    *  not found or the table is not built.
+    *  @param class_id Interaction class handle key. */
+   int interaction_route_find( RTI1516_NAMESPACE::InteractionClassHandle const &class_id ) const;
+
+   /*! @brief Rebuild the cached order the per-interaction receive queues
+    *  are drained in, highest receive priority first. Interactions with the
+    *  same priority keep their input file declaration order. */
+   void rebuild_interaction_drain_order();
+
+   /*! @brief Rebuild the cached order the objects are processed in by the
+    *  cyclic receive path, highest receive priority first. Objects with the
+    *  same priority keep their input file declaration order. */
+   void rebuild_object_receive_order();
+
+   /*! @brief Rebuild the cached member lists of the atomic update groups
+    *  from the update_group identifiers assigned to the objects. */
+   void rebuild_update_groups();
+
+   /*! @brief Release the atomic update groups into the simulation. A group
+    *  is released only when every subscribed member has a new update
+    *  pending, so a consumer never sees a torn combination of the member
+    *  states; otherwise the pending member data stays buffered for a later
+    *  frame.
+    *  @param sim_time_in_base_time Simulation time in the base time. */
+   void process_update_groups( int64_t const sim_time_in_base_time );
+
+   /*! @brief Resolve the object and attribute names and queue a deferred
+    *  runtime reconfiguration, which terminates on an unknown name.
+    *  @param kind              Reconfiguration kind, see ReconfigKindEnum.
+    *  @param obj_instance_name Object instance name.
+    *  @param attr_FOM_name     FOM name of the attribute, NULL for all the
+    *  object's attributes.
+    *  @param cycle_time        New attribute cycle time in seconds.
+    *  @param enable            New publish or consume state. */
+   void queue_reconfiguration( int const    kind,
+                               char const  *obj_instance_name,
+                               char const  *attr_FOM_name,
+                               double const cycle_time,
+                               bool const   enable );
+
+   /*! @brief Apply the deferred runtime reconfigurations. Called by the
+    *  main thread at a data cycle boundary, before any data jobs are
+    *  dispatched, so no job observes a half-applied change. */
+   void apply_pending_reconfigurations();
+
+   /*! @brief Issue the class-scoped RTI subscription changes for a batch
+    *  of switched object instances. The switched instances are grouped by
+    *  object class and one RTI call is made per affected class: the class
+    *  is unsubscribed when no instance of it is active any more, otherwise
+    *  the union of the active instance attribute handles is re-subscribed,
+    *  which is cumulative in the RTI so there is never a window without a
+    *  subscription.
+    *  @param switched_objects Object instances whose subscription switched. */
+   void apply_subscription_switches( std::vector< Object * > const &switched_objects );
+
+   TrickHLAObjInstanceNameIndexMap obj_name_index_map; ///< @trick_io{**} Hash index of object instance names to array index.
 
    bool federate_has_been_restored; ///< @trick_io{**} Federate has been restored. do not reserve the object names again!
 
@@ -553,7 +903,8 @@ class Manager
    void pull_ownership();
 
    /*! @brief Pull ownership from the other federates when this federate has
-    * rejoined the Federation. */
+    * rejoined the Federation. The reacquisition requests for all the objects
+    * are issued up front and then blocked on once as a batch. */
    void pull_ownership_upon_rejoin();
 
    /*! @brief Push ownership to the other federates if the push ownership flag
@@ -0,0 +1,123 @@
+/*!
+@file TrickHLA/MetadataStringPool.hh
+@ingroup TrickHLA
+@brief Interned string pool the attribute and parameter metadata names are
+stored in.
+
+Metadata name strings, like the FOM and Trick names of every attribute and
+parameter, are interned into a single deduplicated arena instead of each
+instance carrying an independently allocated copy. Repeated names, like an
+interaction FOM name copied into every one of its parameters or the common
+attribute names across hundreds of object instances, are stored exactly
+once, which shrinks the metadata heap and its fragmentation for federates
+with many thousands of attributes. Interned strings are immutable, live for
+the duration of the federation execution and are never returned to the
+pool.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/MetadataStringPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_METADATA_STRING_POOL_HH
+#define TRICKHLA_METADATA_STRING_POOL_HH
+
+// System include files.
+#include <cstddef>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class MetadataStringPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__MetadataStringPool();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA MetadataStringPool class. */
+   MetadataStringPool()
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA MetadataStringPool class. */
+   virtual ~MetadataStringPool()
+   {
+      return;
+   }
+
+   /*! @brief Intern the given string into the shared deduplicated arena.
+    * The returned string is shared by every caller that interns an equal
+    * string and must be treated as immutable. The arena slabs are Trick
+    * Memory Manager allocations, so an interned string remains resolvable
+    * for a Trick checkpoint.
+    *  @return Pointer to the interned copy of the string, or NULL if the
+    *  given string was NULL or a slab could not be allocated.
+    *  @param str The null terminated string to intern. */
+   static char *intern( char const *str );
+
+   /*! @brief The number of unique strings interned in the pool.
+    *  @return The interned string count. */
+   static size_t get_interned_count();
+
+   /*! @brief The total arena bytes carved for the interned strings.
+    *  @return The interned string storage size in bytes. */
+   static size_t get_interned_bytes();
+
+  private:
+   static size_t const SLAB_SIZE; ///< @trick_io{**} Size of each arena slab the interned strings are carved from.
+
+   static MutexLock      pool_mutex;     ///< @trick_io{**} Mutex protecting the intern table and arena state.
+   static unsigned char *slab;           ///< @trick_io{**} Current arena slab strings are carved from, NULL until the first intern.
+   static size_t         slab_offset;    ///< @trick_io{**} Offset of the next free byte in the current slab.
+   static size_t         slab_size;      ///< @trick_io{**} Size of the current slab in bytes.
+   static size_t         interned_count; ///< @trick_io{**} Number of unique strings interned.
+   static size_t         interned_bytes; ///< @trick_io{**} Total bytes carved for the interned strings.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for MetadataStringPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MetadataStringPool( MetadataStringPool const &rhs );
+   /*! @brief Assignment operator for MetadataStringPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MetadataStringPool &operator=( MetadataStringPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_METADATA_STRING_POOL_HH
@@ -0,0 +1,178 @@
+/*!
+@file TrickHLA/Metrics.hh
+@ingroup TrickHLA
+@brief Live performance counters for the TrickHLA data path, streamable
+through the Trick variable server.
+
+The counters are plain checkpointable members updated with relaxed atomic
+adds on the hot paths, so instrumented code pays one uncontended atomic
+per counted event and variable server clients can sample the counters
+live without attaching a profiler.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Metrics.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_METRICS_HH
+#define TRICKHLA_METRICS_HH
+
+// System includes
+#include <cstddef>
+
+namespace TrickHLA
+{
+
+class Metrics
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__Metrics();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA Metrics class. The most
+    * recently constructed instance becomes the active metrics block the
+    * static counting functions update. */
+   Metrics();
+   /*! @brief Destructor for the TrickHLA Metrics class. */
+   virtual ~Metrics();
+
+   /*! @brief Reset all the counters to zero. */
+   void reset();
+
+   /*! @brief Query if a metrics block is registered. Use this to guard any
+    * per-event work needed only to feed the counters, like summing encoded
+    * byte counts.
+    *  @return True if a metrics block is registered. */
+   static bool is_active()
+   {
+      return ( active != NULL );
+   }
+
+   /*! @brief Count attribute value updates sent to the RTI. Relaxed
+    * atomic, safe to call from any thread.
+    *  @param update_count Number of updateAttributeValues calls made.
+    *  @param byte_count Total encoded attribute bytes in the updates. */
+   static void count_attribute_updates_sent( long long const update_count, long long const byte_count )
+   {
+      if ( active != NULL ) {
+         __atomic_fetch_add( &active->attribute_updates_sent, update_count, __ATOMIC_RELAXED );
+         __atomic_fetch_add( &active->attribute_bytes_sent, byte_count, __ATOMIC_RELAXED );
+      }
+   }
+
+   /*! @brief Count one attribute reflection received from the RTI. Relaxed
+    * atomic, safe to call from the FedAmb callback thread.
+    *  @param byte_count Total encoded attribute bytes in the reflection. */
+   static void count_attribute_reflection_received( long long const byte_count )
+   {
+      if ( active != NULL ) {
+         __atomic_fetch_add( &active->attribute_reflections_received, 1LL, __ATOMIC_RELAXED );
+         __atomic_fetch_add( &active->attribute_bytes_received, byte_count, __ATOMIC_RELAXED );
+      }
+   }
+
+   /*! @brief Count one interaction sent to the RTI. Relaxed atomic, safe
+    * to call from any thread. */
+   static void count_interaction_sent()
+   {
+      if ( active != NULL ) {
+         __atomic_fetch_add( &active->interactions_sent, 1LL, __ATOMIC_RELAXED );
+      }
+   }
+
+   /*! @brief Count one interaction received from the RTI. Relaxed atomic,
+    * safe to call from the FedAmb callback thread. */
+   static void count_interaction_received()
+   {
+      if ( active != NULL ) {
+         __atomic_fetch_add( &active->interactions_received, 1LL, __ATOMIC_RELAXED );
+      }
+   }
+
+   /*! @brief Record one completed time advance grant wait. Called only
+    * from the main thread grant wait, so the double members use plain
+    * stores.
+    *  @param wait_time_ms Time spent waiting for the grant in milliseconds. */
+   static void record_grant_wait( double const wait_time_ms );
+
+   /*! @brief Scoped RAII timer that records the wall-clock time spent in
+    * the enclosing scope as one time advance grant wait, covering every
+    * return path of the scope. */
+   class GrantWaitScope
+   {
+     public:
+      /*! @brief Record the wall-clock start time of the grant wait. */
+      GrantWaitScope();
+      /*! @brief Record the completed grant wait into the metrics block. */
+      ~GrantWaitScope();
+
+     private:
+      long long start_time_us; ///< @trick_io{**} Wall-clock start time in microseconds.
+
+      // Do not allow the copy constructor or assignment operator.
+      /*! @brief Copy constructor for GrantWaitScope class.
+       *  @details This constructor is private to prevent inadvertent copies. */
+      GrantWaitScope( GrantWaitScope const &rhs );
+      /*! @brief Assignment operator for GrantWaitScope class.
+       *  @details This assignment operator is private to prevent inadvertent copies. */
+      GrantWaitScope &operator=( GrantWaitScope const &rhs );
+   };
+
+   //
+   // Counters. Plain checkpointable members so Trick variable server
+   // clients can stream them live.
+   //
+   long long attribute_updates_sent;         ///< @trick_units{--} Attribute value updates sent to the RTI.
+   long long attribute_bytes_sent;           ///< @trick_units{--} Total encoded attribute bytes sent to the RTI.
+   long long attribute_reflections_received; ///< @trick_units{--} Attribute reflections received from the RTI.
+   long long attribute_bytes_received;       ///< @trick_units{--} Total encoded attribute bytes received from the RTI.
+   long long interactions_sent;              ///< @trick_units{--} Interactions sent to the RTI.
+   long long interactions_received;          ///< @trick_units{--} Interactions received from the RTI.
+   long long time_advance_grants;            ///< @trick_units{--} HLA time advance grants received.
+
+   double last_grant_wait_time_ms;  ///< @trick_units{ms} Time spent waiting for the most recent time advance grant.
+   double total_grant_wait_time_ms; ///< @trick_units{ms} Cumulative time spent waiting for time advance grants.
+
+  private:
+   static Metrics *active; ///< @trick_io{**} The metrics block the static counting functions update, NULL when none is registered.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for Metrics class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   Metrics( Metrics const &rhs );
+   /*! @brief Assignment operator for Metrics class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   Metrics &operator=( Metrics const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_METRICS_HH
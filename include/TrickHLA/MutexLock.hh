@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Adaptive spin and contention statistics.}
 @revs_end
 */
 
@@ -31,7 +32,12 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_MUTEX_LOCK_HH
 
 // System include files.
+#include <cstdint>
 #include <pthread.h>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
 
 namespace TrickHLA
 {
@@ -62,7 +68,8 @@ class MutexLock
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const initialize();
 
-   /*! @brief Lock the mutex.
+   /*! @brief Lock the mutex, spinning briefly on a contended lock before
+    * falling back to the blocking wait.
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const lock();
 
@@ -74,8 +81,33 @@ class MutexLock
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const destroy();
 
+   /*! @brief Set the label identifying this lock in the mutex statistics
+    * dump. A no-op unless THLA_MUTEX_LOCK_STATS is defined in
+    * TrickHLA/CompileConfig.hh.
+    *  @param label Label identifying this lock. */
+   void set_name( std::string const &label );
+
+   /*! @brief Returns a summary of the acquisition and contention statistics
+    * for all the MutexLock instances, one line per lock sorted by the
+    * accumulated wait time. The counters are read without holding the locks,
+    * so a dump taken while the simulation is running is an approximation. */
+   static std::string const statistics_to_string();
+
+   /*! @brief Print the mutex statistics summary to the console. */
+   static void print_statistics();
+
    pthread_mutex_t mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
+#if defined( THLA_MUTEX_LOCK_STATS )
+   std::string lock_name;         ///< @trick_io{**} Label identifying this lock in the statistics dump.
+   uint64_t    acquisition_count; ///< @trick_io{**} Number of times this lock has been acquired.
+   uint64_t    contention_count;  ///< @trick_io{**} Number of acquisitions that found the lock already held.
+   int64_t     wait_time_us;      ///< @trick_io{**} Accumulated time spent waiting for contended acquisitions, in microseconds.
+#endif
+
+  private:
+   static int const MAX_SPIN_COUNT = 100; ///< @trick_io{**} Spin iterations on a contended lock before the blocking wait.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for MutexLock class.
@@ -33,6 +33,8 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/OwnershipHandler.cpp}
 @trick_link_dependency{../../source/TrickHLA/Packing.cpp}
 @trick_link_dependency{../../source/TrickHLA/ReflectedAttributesQueue.cpp}
+@trick_link_dependency{../../source/TrickHLA/SharedMemoryRing.cpp}
+@trick_link_dependency{../../source/TrickHLA/TripleBuffer.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
 @revs_title
@@ -50,6 +52,7 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <pthread.h>
 #include <string>
+#include <vector>
 
 // Trick include files.
 #include "trick/attributes.h"
@@ -64,8 +67,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/ReflectedAttributesQueue.hh"
+#include "TrickHLA/SharedMemoryRing.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TripleBuffer.hh"
 #include "TrickHLA/Types.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -137,6 +142,20 @@ class Object
 
    bool blocking_cyclic_read; ///< @trick_units{--} True to block in receive_cyclic_data() for data to be received.
 
+   bool keep_latest_update_only; ///< @trick_units{--} True to keep only the latest received update for decimated consumption instead of queuing every reflection.
+
+   bool latency_survey; ///< @trick_units{--} True to stamp outgoing updates with the CTE time in the user-supplied tag and accumulate one-way latency statistics for received updates. Requires a CTE timeline and must be enabled by both the publishing and subscribing federates, default: false.
+
+   double stale_data_threshold; ///< @trick_units{s} Data age above which the received data for this object is considered stale by is_data_stale() and check_data_staleness(), default: 0.0 (staleness detection disabled).
+
+   double send_phase_offset_time; ///< @trick_units{s} Phase offset within the data cycle for sending cyclic data, which must be an integer multiple of the core job cycle time. Only valid for objects associated to the Trick main thread, default: 0.0 (no offset).
+
+   unsigned int parallel_codec_slices; ///< @trick_units{--} Number of attribute-range slices the buffer encode and decode loops for this object are partitioned into across the data job worker pool. Intended for wide objects with hundreds of attributes, 0 or 1 (default) runs the loops serially.
+
+   int receive_priority; ///< @trick_units{--} Processing priority for this object in the cyclic receive path, higher priorities are processed first each frame so critical data is decoded before the bulk objects. Adjust at runtime through Manager::set_object_receive_priority() (default: 0).
+
+   int update_group; ///< @trick_units{--} Atomic update group identifier. The cyclic receive path releases the objects sharing a non-negative group identifier into the simulation together, and only when every subscribed member has a new update pending, so a consumer never sees a torn combination of the member states (default: -1, no group).
+
    char *thread_ids; ///< @trick_units{--} Comma separated list of Trick child thread IDs associated to this object.
 
    int        attr_count; ///< @trick_units{--} Number of object attributes.
@@ -179,12 +198,28 @@ class Object
    /*! @brief Publishes Object attributes. */
    void publish_object_attributes();
 
+   /*! @brief Add the attribute handles this object publishes to the given set.
+    *  @param attrs The attribute handle set to add the handles to. */
+   void add_published_attribute_handles( RTI1516_NAMESPACE::AttributeHandleSet &attrs ) const;
+
+   /*! @brief Publishes the given set of attributes for this object's class.
+    *  @param attrs The class attribute handles to publish. */
+   void publish_object_class_attributes( RTI1516_NAMESPACE::AttributeHandleSet const &attrs );
+
    /*! @brief Unpublishes all object attributes. */
    void unpublish_all_object_attributes();
 
    /*! @brief Subscribe to Object attributes. */
    void subscribe_to_object_attributes();
 
+   /*! @brief Add the attribute handles this object subscribes to to the given set.
+    *  @param attrs The attribute handle set to add the handles to. */
+   void add_subscribed_attribute_handles( RTI1516_NAMESPACE::AttributeHandleSet &attrs ) const;
+
+   /*! @brief Subscribes to the given set of attributes for this object's class.
+    *  @param attrs The class attribute handles to subscribe to. */
+   void subscribe_to_object_class_attributes( RTI1516_NAMESPACE::AttributeHandleSet const &attrs );
+
    /*! @brief Unsubscribe from all the Object attributes. */
    void unsubscribe_all_object_attributes();
 
@@ -194,6 +229,10 @@ class Object
    /*! @brief Waits for the reservation of the HLA object instance name with the RTI. */
    void wait_for_object_name_reservation();
 
+   /*! @brief Signal any thread blocked in wait_for_name_reservation_change()
+    * that an object instance name reservation changed state. */
+   static void signal_name_reservation_change();
+
    /*! @brief Creates an HLA object instance and registers it with the RTI,
     * but only if we own it locally. */
    void register_object_with_RTI();
@@ -208,6 +247,46 @@ class Object
     *  @param cycle_time The core job cycle time in seconds. */
    void set_core_job_cycle_time( double const cycle_time );
 
+   /*! @brief Get the validated send phase offset in the base HLA Logical
+    * Time representation, which is zero until the core job cycle time is known.
+    *  @return Send phase offset in base time. */
+   long long get_send_phase_offset_base_time() const
+   {
+      return send_phase_offset_base_time;
+   }
+
+   /*! @brief Get the processing priority for this object in the cyclic
+    * receive path.
+    *  @return Receive processing priority, higher priorities are processed
+    *  first each frame. */
+   int get_receive_priority() const
+   {
+      return receive_priority;
+   }
+
+   /*! @brief Get the atomic update group this object is a member of.
+    *  @return Update group identifier, -1 when the object is not grouped. */
+   int get_update_group() const
+   {
+      return update_group;
+   }
+
+   /*! @brief Determine if this object instance's subscription is active.
+    *  @return True while the reflected values for this instance are
+    *  consumed by the simulation. */
+   bool is_subscription_active() const
+   {
+      return subscription_active;
+   }
+
+   /*! @brief Activate or deactivate this object instance's subscription,
+    * used by the Manager bulk subscription switching.
+    *  @param active True to consume the reflected values for this instance. */
+   void set_subscription_active( bool const active )
+   {
+      this->subscription_active = active;
+   }
+
    /*! @brief Marks this object as deleted from the RTI and sets all attributes as non-local. */
    void remove_object_instance();
 
@@ -262,23 +341,128 @@ class Object
    /*! @brief Handle the received zero-lookaehad data. */
    void receive_zero_lookahead_data();
 
+   /*! @brief Block until reflected attribute data arrives for this object
+    * or the timeout expires. The waiter is signaled directly from the data
+    * arrival in enqueue_data() so no poll cycle is needed.
+    *  @return True if data is available, false if the wait timed out.
+    *  @param timeout_seconds Maximum time to wait in seconds, a value of
+    *  zero or less waits indefinitely. */
+   bool wait_for_data_arrival( double const timeout_seconds );
+
+   /*! @brief Block until zero-lookahead data arrives for this object or
+    * the timeout expires, then receive and process it.
+    *  @return True if data was received and processed.
+    *  @param timeout_seconds Maximum time to wait in seconds, a value of
+    *  zero or less waits indefinitely. */
+   bool wait_and_receive_zero_lookahead_data( double const timeout_seconds );
+
+   /*! @brief Register an optional callback invoked when reflected attribute
+    * data arrives for this object, so the arrival can directly trigger the
+    * consuming job without a poll cycle. The callback runs on the RTI
+    * callback thread and must be short and non-blocking. Pass NULL to
+    * clear the registration.
+    *  @param callback Function to call when data arrives, NULL to clear.
+    *  @param user_arg User argument passed through to the callback. */
+   void register_data_arrival_callback( void ( *callback )( Object *obj, void *user_arg ),
+                                        void *user_arg )
+   {
+      this->data_arrival_user_arg = user_arg;
+      this->data_arrival_callback = callback;
+   }
+
    /*! @brief Request an update to the attributes for this object. */
    void request_attribute_value_update();
 
+   /*! @brief Request an update from the RTI for the given set of attributes
+    * of this object's class, which covers every object instance of the
+    * class with a single request.
+    *  @param attrs The class attribute handles to request an update for. */
+   void request_class_attribute_value_update( RTI1516_NAMESPACE::AttributeHandleSet const &attrs );
+
    /*! @brief Requesting an attribute update for the specified attributes.
     *  @param theAttributes The specified attributes. */
    void provide_attribute_update( RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes );
 
+   /*! @brief Turn cyclic updates on or off for the specified attributes as
+    *  told by the RTI attribute relevance advisory.
+    *  @param theAttributes The specified attributes.
+    *  @param updates_on True to turn updates on, false to turn them off. */
+   void set_attribute_update_advisory( RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes,
+                                       bool const                                   updates_on );
+
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
    /*! @brief Enqueue the reflected attributes.
-    *  @param theAttributes Attributes data. */
-   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+    *  @details The attribute values are moved into the queue, leaving the
+    *  callers map empty, so the payload is not copied at the callback
+    *  boundary.
+    *  @param theAttributes Attributes data, emptied by the move. */
+   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap &theAttributes );
 #endif
 
    /*! @brief This function extracts the new attribute values.
     *  @param theAttributes Attributes data.
+    *  @param borrow_data True to let the attributes borrow the received
+    *  values in place instead of staging a copy, in which case the map must
+    *  stay valid until the attribute buffers have been unpacked.
     *  @return True if successfully extracted data, false otherwise. */
-   bool extract_data( RTI1516_NAMESPACE::AttributeHandleValueMap &theAttributes );
+   bool extract_data( RTI1516_NAMESPACE::AttributeHandleValueMap &theAttributes,
+                      bool const                                  borrow_data = false );
+
+   /*! @brief Record a one-way latency sample from the CTE timestamp
+    *  stamped into the user-supplied tag of a received attribute update.
+    *  Does nothing unless the latency survey is enabled for this object
+    *  and the tag carries a latency survey stamp.
+    *  @param user_supplied_tag User-supplied tag of the received update. */
+   void record_latency_survey( RTI1516_NAMESPACE::VariableLengthData const &user_supplied_tag );
+
+   /*! @brief Print a summary of the one-way latency statistics accumulated
+    * for the updates received for this object. Schedule this as a Trick
+    * job for a periodic latency survey report. */
+   void print_latency_survey();
+
+   /*! @brief Register an optional callback invoked by check_data_staleness()
+    * when the received data for this object is older than the
+    * stale_data_threshold, so a health monitor can flag starving
+    * subscriptions. Pass NULL to clear the registration.
+    *  @param callback Function to call when the data is stale, NULL to clear.
+    *  @param user_arg User argument passed through to the callback. */
+   void register_stale_data_callback( void ( *callback )( Object *obj, double const age, void *user_arg ),
+                                      void *user_arg )
+   {
+      this->stale_data_user_arg = user_arg;
+      this->stale_data_callback = callback;
+   }
+
+   /*! @brief Get the age of the received data for this object.
+    *  @return Seconds elapsed since the last reflected attribute update
+    *  arrived for this object, or -1.0 when no update has arrived yet. */
+   double get_data_age() const;
+
+   /*! @brief Determine if the received data for this object is stale.
+    *  @return True when a stale_data_threshold is configured and the data
+    *  age exceeds it. An object that has never received an update is not
+    *  flagged, use get_data_age() returning a negative age to detect that
+    *  case. */
+   bool is_data_stale() const;
+
+   /*! @brief Check the data age against the stale_data_threshold and
+    * notify the registered stale data callback when the data is stale.
+    * Schedule this as a Trick job for a periodic subscription health check.
+    *  @return True when the data is stale. */
+   bool check_data_staleness();
+
+   /*! @brief Print a summary of the update-interval and consumption
+    * latency statistics accumulated for the updates received for this
+    * object. */
+   void print_data_freshness_stats();
+
+   /*! @brief Summarize the wire-traffic accounting counters of this
+    * object's attributes as a top-talkers list sorted by total encoded
+    * bytes, showing the updates and bytes sent and received and the
+    * suppressed-vs-sent ratio of each attribute with traffic.
+    *  @return Multi-line wire-traffic summary string, one line per
+    *  attribute with traffic. */
+   std::string wire_traffic_to_string();
 
    /*! @brief Remove this object instance from the RTI/Federation. */
    void remove();
@@ -294,9 +478,18 @@ class Object
    /*! @brief This function pulls ownership for this object. */
    void pull_ownership();
 
-   /*! @brief This function pulls ownership for all published attributes when
-    * the federate rejoins an already running federation. */
-   void pull_ownership_upon_rejoin();
+   /*! @brief Request ownership reacquisition of the published attributes this
+    * federate should own when it rejoins an already running federation. This
+    * only issues the acquisition request and does not block; the grants are
+    * tracked as the FedAmb ownership callbacks mark the attributes locally
+    * owned again.
+    * @return Number of attributes for which ownership was requested. */
+   unsigned int pull_ownership_upon_rejoin_request();
+
+   /*! @brief Determine if all the attribute ownership reacquisition requests
+    * issued by pull_ownership_upon_rejoin_request() have been granted.
+    * @return True when no reacquisition requests remain outstanding. */
+   bool is_pull_ownership_upon_rejoin_complete();
 
    /*! @brief This function grants a pull request for this object. */
    void grant_pull_request();
@@ -324,6 +517,11 @@ class Object
     * AttributeOwnershipMaps. */
    void restore_ownership_transfer_checkpointed_data();
 
+   /*! @brief Rebuild the attribute staging buffers that were allocated
+    * outside checkpointed memory after a checkpoint restore, at their
+    * checkpointed capacities. */
+   void reinstate_transient_buffers();
+
    // Instance methods
 
    /*! @brief Get the object instance name.
@@ -358,6 +556,7 @@ class Object
    void set_name_registered()
    {
       this->name_registered = true;
+      signal_name_reservation_change();
    }
 
    /*! @brief Set the name registration status as false (not registered). */
@@ -421,6 +620,20 @@ class Object
       set_name_registered();
    }
 
+   /*! @brief Record the wall clock time this object instance was discovered.
+    *  @param time_in_micros Wall clock discovery time in microseconds. */
+   void set_discovery_wallclock_time( int64_t const time_in_micros )
+   {
+      this->discovery_wallclock_time = time_in_micros;
+   }
+
+   /*! @brief Get the wall clock time this object instance was discovered.
+    *  @return Wall clock discovery time in microseconds, -1 if not discovered yet. */
+   int64_t get_discovery_wallclock_time() const
+   {
+      return this->discovery_wallclock_time;
+   }
+
    /*! @brief Check if the object instance has been created.
     *  @return True if the object instance has been created. */
    bool is_create_HLA_instance() const
@@ -552,6 +765,14 @@ class Object
       return any_remotely_owned_subscribed_attribute( CONFIG_INITIALIZE );
    }
 
+   /*! @brief Invalidate the cached ownership counts and attribute index
+    * lists so they are recounted on the next ownership query. Call this
+    * after any attribute ownership or publish state change. */
+   void invalidate_ownership_counts()
+   {
+      this->ownership_counts_valid = false;
+   }
+
    /*! @brief Turn off local flag in all attributes. */
    void mark_all_attributes_as_nonlocal();
 
@@ -560,15 +781,57 @@ class Object
    bool is_changed()
    {
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+      if ( keep_latest_update_only ) {
+         // Keep-latest decimation: decode only the most recent update at
+         // this consumer's cycle, no matter how many reflections arrived.
+         // The snapshot handoff is a wait-free triple buffer, so neither
+         // this consumer nor the FedAmb producer takes the receive mutex,
+         // and in this mode the changed flag is only written by this
+         // consumer thread.
+         if ( !changed ) {
+            // Drop any borrowed reference into the previously latched
+            // snapshot before the latch below hands its slot back to the
+            // producer.
+            if ( front_data_borrowed ) {
+               for ( int i = 0; i < attr_count; ++i ) {
+                  attributes[i].drop_borrowed_data();
+               }
+               front_data_borrowed = false;
+            }
+            if ( latest_update_buffer.fresh() ) {
+               // Latch the latest snapshot with an atomic index flip. The
+               // attributes borrow the latched values in place, which stay
+               // stable until the next latch.
+               extract_data( latest_update_buffer.latch(), true );
+               front_data_borrowed = true;
+            }
+         }
+         return changed;
+      }
+
       // When auto_unlock_mutex goes out of scope it automatically unlocks the
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &receive_mutex );
 
       if ( !changed ) {
-         if ( !thla_reflected_attributes_queue.empty() ) {
-            // The 'changed' flag is set when the data is extracted.
-            extract_data( (RTI1516_NAMESPACE::AttributeHandleValueMap &)thla_reflected_attributes_queue.front() );
+         // Release the front queue entry now that the attribute values
+         // borrowed from it have been consumed by the unpack. Any borrowed
+         // reference not consumed, because the unpack was filtered to a
+         // different attribute configuration, is dropped so that no
+         // attribute references the released storage.
+         if ( front_data_borrowed ) {
+            for ( int i = 0; i < attr_count; ++i ) {
+               attributes[i].drop_borrowed_data();
+            }
             thla_reflected_attributes_queue.pop();
+            front_data_borrowed = false;
+         }
+         if ( !thla_reflected_attributes_queue.empty() ) {
+            // The 'changed' flag is set when the data is extracted. The
+            // attributes borrow the received values in place, so the front
+            // entry is not popped until they have been consumed.
+            extract_data( thla_reflected_attributes_queue.front(), true );
+            front_data_borrowed = true;
          }
       }
 #endif
@@ -610,6 +873,9 @@ class Object
    void set_divest_requested( bool request )
    {
       this->divest_requested = request;
+      if ( request ) {
+         notify_ownership_work_pending();
+      }
    }
 
    /*! @brief Set ownership pull requested flag.
@@ -617,6 +883,29 @@ class Object
    void set_pull_requested( bool request )
    {
       this->pull_requested = request;
+      if ( request ) {
+         notify_ownership_work_pending();
+      }
+   }
+
+   /*! @brief Register this object on the manager's pending ownership work
+    * list so the next process_ownership() pass handles it. Called when an
+    * ownership transfer request is scheduled or an RTI ownership callback
+    * arrives. Safe to call from any thread and idempotent until the
+    * registration is cleared. */
+   void notify_ownership_work_pending();
+
+   /*! @brief Query if any ownership transfer work is pending for this
+    * object, i.e. a pull or divest request flag is set or a pull or push
+    * request is scheduled.
+    *  @return True if ownership transfer work is pending. */
+   bool is_ownership_work_pending();
+
+   /*! @brief Clear the pending ownership work registration so this object
+    * can be registered again by the next ownership event. */
+   void clear_ownership_work_registration()
+   {
+      __atomic_store_n( &this->ownership_work_registered, false, __ATOMIC_RELEASE );
    }
 
    /*! @brief Return a copy of the federate's lookahead time.
@@ -660,6 +949,46 @@ class Object
     * up an attribute given its AttributeHandle. */
    void build_attribute_map();
 
+   /*! @brief Build the attribute map from a precomputed handle-sorted
+    * attribute order, shared by all the objects of a class with the same
+    * attribute layout.
+    *  @param sorted_order Attribute array indices in handle-sorted order. */
+   void build_attribute_map( std::vector< unsigned int > const &sorted_order );
+
+   /*! @brief Get the attribute array indices in the handle-sorted order of
+    * the attribute map, for sharing with the other objects of this class.
+    *  @return A vector of attribute array indices in handle-sorted order. */
+   std::vector< unsigned int > get_attribute_index_order() const;
+
+   /*! @brief Set the policy applied when a reflection arrives while the
+    * bounded reflected attributes queue is full. Only call this during
+    * initialization.
+    *  @param policy Overflow policy applied when the queue is full. */
+   void set_reflected_attributes_queue_overflow_policy( QueueOverflowPolicyEnum const policy )
+   {
+      thla_reflected_attributes_queue.set_overflow_policy( policy );
+   }
+
+   /*! @brief Get the deepest the reflected attributes queue has ever been.
+    *  @return High-water mark of the queue depth. */
+   size_t get_reflected_attributes_queue_high_water_mark() const
+   {
+      return thla_reflected_attributes_queue.get_high_water_mark();
+   }
+
+   /*! @brief Get the number of reflections discarded by the overflow policy
+    * of the reflected attributes queue.
+    *  @return Count of the dropped reflections. */
+   unsigned long long get_reflected_attributes_queue_dropped_count() const
+   {
+      return thla_reflected_attributes_queue.get_dropped_count();
+   }
+
+   /*! @brief Fault in the staging buffers of this object's attributes and
+    * handlers from the calling thread, so the buffer pages are placed on
+    * the calling thread's NUMA node by the first-touch placement policy. */
+   void first_touch_buffers();
+
    /*! @brief Get the attribute FOM names.
     *  @return A vector of strings containing the attribute FOM names. */
    VectorOfStrings get_attribute_FOM_names() const
@@ -733,10 +1062,59 @@ class Object
       unpack_attribute_buffers( CONFIG_INITIALIZE );
    }
 
+   /*! @brief Copy the packed buffer contents back to each initialization-only
+    * attribute that has received new data. Initialization-only attributes are
+    * excluded from the cyclic and zero-lookahead iteration structures, so the
+    * receive paths call this to pick up the data from an explicit attribute
+    * update request or the initial registration update. */
+   void unpack_received_init_only_attribute_buffers();
+
+   /*! @brief Pack one attribute-range slice of this object into the encoded
+    * attribute buffers. The slices are independent, so they can run
+    * concurrently on the data job worker threads.
+    *  @param attr_config Attribute configuration.
+    *  @param include_requested True to also include requested attributes.
+    *  @param slice Zero based slice index.
+    *  @param slice_count Total number of slices. */
+   void pack_attribute_buffer_slice( DataUpdateEnum const attr_config,
+                                     bool const           include_requested,
+                                     unsigned int const   slice,
+                                     unsigned int const   slice_count );
+
+   /*! @brief Unpack one attribute-range slice of the encoded buffers back
+    * into the attributes with the given configuration. The slices are
+    * independent, so they can run concurrently on the data job worker
+    * threads.
+    *  @param attr_config Attribute configuration.
+    *  @param slice Zero based slice index.
+    *  @param slice_count Total number of slices. */
+   void unpack_attribute_buffer_slice( DataUpdateEnum const attr_config,
+                                       unsigned int const   slice,
+                                       unsigned int const   slice_count );
+
+   /*! @brief Lazily create or open the shared-memory transport ring for this
+    * object once the federation name and object instance name are known. */
+   void setup_shared_memory_transport();
+
+   /*! @brief Mirror the packed attribute values map into the shared-memory
+    * ring so co-located subscribing federates can pick the update up without
+    * a round trip through the RTI network stack. */
+   void mirror_cyclic_data_to_shared_memory();
+
+   /*! @brief Poll the shared-memory ring for attribute updates published by
+    * a co-located owning federate and extract any received frames. */
+   void receive_shared_memory_data();
+
    /*! @brief Check if federate is shutdown function was called.
     *  @return True if the manager is shutting down the federate. */
    bool is_shutdown_called() const;
 
+   /*! @brief Drain the requested-update bitmask filled in by the FedAmb
+    * callback thread and translate the bits into the per-attribute request
+    * flags consumed by the send paths, coalescing all the provide requests
+    * that arrived since the last drain into a single update. */
+   void consume_requested_update_mask();
+
    /*! @brief Create a name value pair set, aka attribute handle value pair,
     * for the attributes that were requested for this object. */
    void create_requested_attribute_set();
@@ -755,6 +1133,53 @@ class Object
     * @param include_requested True to also included requeted attributes */
    void create_attribute_set( DataUpdateEnum const required_config, bool const include_requested );
 
+   /*! @brief Start populating the attribute values map for this data cycle. */
+   void begin_populating_attribute_values();
+
+   /*! @brief Get the attribute value slot in the attribute values map for
+    * the given attribute handle, recycling the map node from the previous
+    * data cycle when one exists.
+    * @return Reference to the attribute value slot in the map.
+    * @param handle Attribute handle for the value slot. */
+   RTI1516_NAMESPACE::VariableLengthData &get_attribute_value_slot(
+      RTI1516_NAMESPACE::AttributeHandle const &handle );
+
+   /*! @brief Finish populating the attribute values map for this data cycle
+    * by removing any stale map entries left over from the previous cycle. */
+   void finish_populating_attribute_values();
+
+   /*! @brief Invalidate the cached resolved address records of all the
+    * attributes of this object, forcing the sizes to be re-derived from the
+    * Trick ATTRIBUTES metadata. Call after a checkpoint restore or after an
+    * in-place Trick Memory Manager reallocation of an attribute array. */
+   void invalidate_resolved_address_caches();
+
+   /*! @brief Build the send cycle wheel that buckets the cyclic attributes
+    * by their sub-rate so each data cycle only visits the attributes that
+    * are actually due. Called once the attribute cycle ratios are known. */
+   void build_send_cycle_wheel();
+
+   /*! @brief Advance the send cycle wheel by one data cycle, marking the
+    * sub-rate buckets that are due this cycle. Only call this once per
+    * data cycle. */
+   void advance_send_cycle_wheel();
+
+   /*! @brief Determine if the attribute for the given index is on a send
+    * cycle boundary for this data cycle.
+    * @return True if the attribute send cycle is due.
+    * @param attr_index Index of the attribute. */
+   bool is_attribute_send_cycle_due( unsigned int const attr_index ) const;
+
+   /*! @brief Recount the cached ownership counts and rebuild the locally
+    * owned published and remotely owned subscribed attribute index lists. */
+   void refresh_ownership_counts();
+
+   /*! @brief Determine if reflected attribute data is available to be
+    * processed. Only reads the lock-free queue state and the changed flag,
+    * so it is safe to call while holding the data arrival condition mutex.
+    *  @return True if received data is available. */
+   bool is_received_data_available();
+
    /*! @brief Initialize the thread ID array based on the users 'thread_ids' input.*/
    void initialize_thread_ID_array();
 
@@ -763,6 +1188,10 @@ class Object
     * @param thread_id Trick thread ID. */
    bool is_thread_associated( unsigned int const thread_id );
 
+   /*! @brief Determine if this object is associated to any Trick child thread.
+    * @return True if associated to a Trick child thread (thread-id > 0). */
+   bool is_child_thread_associated();
+
    unsigned int thread_ids_array_count; ///< @trick_units{--} Size of the thread IDs array.
    bool        *thread_ids_array;       ///< @trick_units{--} Array index is the thread ID and the value is true if the thread is associated to this object.
 
@@ -779,20 +1208,30 @@ class Object
     *  @return Pointer to associated HLA RTIambassador instance. */
    RTI1516_NAMESPACE::RTIambassador *get_RTI_ambassador();
 
+   /*! @brief Block for a bounded time until an object instance name
+    * reservation changes state or the wait times out. */
+   static void wait_for_name_reservation_change();
+
    BasicClock clock; ///< @trick_units{--} Clock time object.
 
    bool name_registered; ///< @trick_units{--} True if the object instance name is registered.
 
+   static pthread_mutex_t name_reservation_cond_mutex; ///< @trick_io{**} Mutex paired with the name reservation condition variable, shared by all objects.
+   static pthread_cond_t  name_reservation_cond;       ///< @trick_io{**} Condition variable signaled when any object instance name reservation changes state.
+
    bool changed; ///< @trick_units{--} Flag indicating the data has changed.
 
    bool attr_update_requested; ///< @trick_units{--} Flag to indicate an attribute updated was requested by another federate.
 
+   std::vector< unsigned long long > attr_update_request_mask; ///< @trick_io{**} Requested-update bitmask, one bit per attribute index, set atomically by the FedAmb callback thread and drained wholesale on the send path.
+
    bool removed_instance; ///< @trick_units{--} Flag to indicate if object instance was removed from RTI.
 
    bool first_blocking_cyclic_read; ///< @trick_units{--} True if this is the first call to receive_cyclic_data for data to be received.
 
    bool any_attribute_FOM_specified_order; ///< @trick_units{--} True if any attribute is the FOM specified order.
    bool any_attribute_timestamp_order;     ///< @trick_units{--} True if any attribute is timestamp order.
+   bool any_attribute_receive_order;       ///< @trick_units{--} True if any attribute is preferred receive order.
 
    RTI1516_NAMESPACE::ObjectClassHandle    class_handle;    ///< @trick_io{**} HLA Object Class handle.
    RTI1516_NAMESPACE::ObjectInstanceHandle instance_handle; ///< @trick_io{**} HLA Object Instance handle.
@@ -800,17 +1239,74 @@ class Object
    bool pull_requested;   ///< @trick_units{--} Has someone asked to own us?
    bool divest_requested; ///< @trick_units{--} Are we releasing ownership?
 
+   bool ownership_work_registered; ///< @trick_io{**} True while this object is on the manager's pending ownership work list, accessed atomically.
+
+   bool subscription_active; ///< @trick_io{**} True while this object instance's subscription is active. Switched at runtime through Manager::set_object_subscribe(); when false the reflected values for this instance are not unpacked into the simulation, which is the local instance filtering that complements the class-scoped RTI subscription switching (default: true).
+
    VectorOfStrings attribute_FOM_names; ///< @trick_io{**} String array containing the Attribute FOM names.
 
    Manager *manager; ///< @trick_units{--} Reference to the TrickHLA Manager.
 
    RTI1516_NAMESPACE::RTIambassador *rti_ambassador; ///< @trick_io{**} Reference to the RTI ambassador.
 
-   RTI1516_NAMESPACE::AttributeHandleValueMap *attribute_values_map; ///< @trick_io{**} Map of attributes that will be sent as an update to other federates.
+   RTI1516_NAMESPACE::AttributeHandleValueMap *attribute_values_map; ///< @trick_io{**} Map of attributes that will be sent as an update to other federates, map nodes are recycled across data cycles.
+
+   RTI1516_NAMESPACE::AttributeHandleValueMap *RO_attribute_values_map; ///< @trick_io{**} Map holding the receive-order preferred attribute values of a mixed preferred-order update while they are sent without a timestamp.
+
+   std::vector< RTI1516_NAMESPACE::AttributeHandle > populated_attribute_handles; ///< @trick_io{**} Handles populated into the attribute values map this cycle, reused each cycle to avoid allocations.
 
    ReflectedAttributesQueue thla_reflected_attributes_queue; ///< @trick_io{**} Queue of reflected attributes.
 
-   AttributeMap thla_attribute_map; ///< @trick_io{**} Map of the Attribute's, key is the AttributeHandle.
+   bool front_data_borrowed; ///< @trick_io{**} True when the attributes still borrow values held by the front queue entry, which is popped once they are consumed.
+
+   TripleBuffer latest_update_buffer; ///< @trick_io{**} Wait-free triple buffer holding the latest reflected snapshot when decimating, so the FedAmb producer and the simulation consumer never contend on a lock.
+
+   pthread_mutex_t data_arrival_cond_mutex; ///< @trick_io{**} Mutex paired with the data arrival condition variable.
+   pthread_cond_t  data_arrival_cond;       ///< @trick_io{**} Condition variable signaled when reflected attribute data arrives.
+   bool            data_arrival_waiting;    ///< @trick_io{**} True while a consumer is blocked in wait_for_data_arrival().
+
+   void ( *data_arrival_callback )( Object *obj, void *user_arg ); ///< @trick_io{**} Optional callback invoked on the RTI callback thread when reflected attribute data arrives, NULL when not registered.
+   void *data_arrival_user_arg;                                    ///< @trick_io{**} User argument passed to the data arrival callback.
+
+   long long last_data_arrival_time_us; ///< @trick_io{**} Wall clock arrival time of the most recent reflected attribute update in microseconds, written atomically on the RTI callback thread, 0 until the first update arrives.
+
+   void ( *stale_data_callback )( Object *obj, double const age, void *user_arg ); ///< @trick_io{**} Optional callback invoked by check_data_staleness() when the received data is older than the stale_data_threshold, NULL when not registered.
+   void *stale_data_user_arg;                                                      ///< @trick_io{**} User argument passed to the stale data callback.
+
+   std::string       shm_channel_name;      ///< @trick_io{**} Shared-memory channel name for this object instance.
+   SharedMemoryRing *shm_send_ring;         ///< @trick_io{**} Shared-memory ring this federate publishes attribute updates into for co-located subscribers.
+   SharedMemoryRing *shm_receive_ring;      ///< @trick_io{**} Shared-memory ring polled for attribute updates owned by a co-located federate.
+   bool              shm_transport_failed;  ///< @trick_io{**} True if setting up the shared-memory send ring failed, so we don't retry every cycle.
+
+   std::vector< unsigned char > shm_frame_buffer; ///< @trick_io{**} Scratch buffer for encoding and decoding shared-memory frames.
+
+   AttributeHandleIndex thla_attribute_index; ///< @trick_io{**} Flat index of the Attribute's sorted by AttributeHandle, searched with a cache-friendly binary search.
+
+   long long send_phase_offset_base_time; ///< @trick_io{**} Validated send phase offset in base time, computed from the user configured send_phase_offset_time once the core job cycle time is known.
+
+   std::vector< int >          send_wheel_ratio;           ///< @trick_io{**} Cycle ratio for each sub-rate bucket of the send cycle wheel.
+   std::vector< int >          send_wheel_count;           ///< @trick_io{**} Data cycle counter for each sub-rate bucket of the send cycle wheel.
+   std::vector< int >          send_wheel_due;             ///< @trick_io{**} Due flag for each sub-rate bucket for the current data cycle.
+   std::vector< unsigned int > send_wheel_attr_index;      ///< @trick_io{**} Attribute indices grouped by sub-rate bucket.
+   std::vector< unsigned int > send_wheel_bucket_start;    ///< @trick_io{**} Start offset of each sub-rate bucket into the grouped attribute indices, with an end sentinel.
+   std::vector< unsigned int > send_wheel_everyframe_index; ///< @trick_io{**} Indices of the cyclic attributes that are due every data cycle.
+   std::vector< int >          attr_send_bucket;           ///< @trick_io{**} Per-attribute sub-rate bucket of the send cycle wheel, -1 when due every cycle.
+   bool                        send_wheel_built;           ///< @trick_io{**} True once the send cycle wheel has been built.
+
+   bool ownership_counts_valid; ///< @trick_io{**} True when the cached ownership counts and attribute index lists are up to date.
+
+   int locally_owned_count;             ///< @trick_io{**} Cached count of the locally owned attributes.
+   int locally_owned_published_count;   ///< @trick_io{**} Cached count of the locally owned and published attributes.
+   int remotely_owned_subscribed_count; ///< @trick_io{**} Cached count of the remotely owned and subscribed attributes.
+
+   std::vector< unsigned int > locally_owned_published_index;   ///< @trick_io{**} Indices of the locally owned and published attributes.
+   std::vector< unsigned int > remotely_owned_subscribed_index; ///< @trick_io{**} Indices of the remotely owned and subscribed attributes.
+
+   std::vector< unsigned int > rejoin_pull_request_index; ///< @trick_io{**} Indices of the published attributes with an outstanding ownership reacquisition request after a federation rejoin.
+
+   RTI1516_NAMESPACE::AttributeHandleSet remotely_owned_subscribed_attr_handles; ///< @trick_io{**} Cached handle set of the remotely owned and subscribed attributes, for update requests.
+
+   int64_t discovery_wallclock_time; ///< @trick_io{**} Wall clock time, in microseconds, when this object instance was discovered, -1 if not discovered yet.
 
   public:
    unsigned long long send_count;    ///< @trick_units{--} Number of times data from this object was sent.
@@ -818,7 +1314,21 @@ class Object
 
    ElapsedTimeStats elapsed_time_stats; ///< @trick_units{--} Statistics of elapsed times between cyclic data reads.
 
+   ElapsedTimeStats send_wheel_stats; ///< @trick_units{--} Statistics of elapsed times between sub-rate attribute send cycles.
+
+   ElapsedTimeStats send_time_stats; ///< @trick_units{--} Statistics of the time spent in each cyclic and requested data send.
+
+   ElapsedTimeStats latency_stats; ///< @trick_units{--} One-way CTE latency statistics of the updates received for this object, accumulated by the latency survey.
+
+   ElapsedTimeStats update_interval_stats; ///< @trick_units{--} Statistics of the wall clock intervals between reflected attribute updates arriving for this object.
+
+   ElapsedTimeStats consume_latency_stats; ///< @trick_units{--} Statistics of the wall clock latency from the arrival of a reflected attribute update for this object to its consumption by extract_data().
+
   private:
+   /*! @brief Get the CTE time used by the latency survey.
+    *  @return CTE time in seconds, or -DBL_MAX when no CTE timeline exists. */
+   double get_cte_time();
+
    /*! @brief Sets the new value of the name attribute.
     *  @param new_name New name for the object instance. */
    void set_name( char const *new_name );
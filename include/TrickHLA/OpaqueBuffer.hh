@@ -37,6 +37,8 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_OPAQUE_BUFFER_HH
 
 // System include
+#include <cstddef>
+#include <vector>
 
 // TrickHLA include files.
 #include "TrickHLA/Types.hh"
@@ -87,6 +89,35 @@ class OpaqueBuffer
     *  @param size Requested buffer capacity. */
    void ensure_buffer_capacity( size_t const size );
 
+   /*! @brief Pre-reserve exactly the specified buffer capacity. Intended for
+    * use at initialization with a declared maximum data size so the buffer
+    * is allocated once instead of being repeatedly resized at runtime.
+    *  @param max_size Maximum expected buffer capacity. */
+   void reserve_buffer_capacity( size_t const max_size );
+
+   /*! @brief Fault in the pages of the buffer from the calling thread so
+    * the operating system places them on the calling thread's NUMA node
+    * under the default first-touch placement policy. */
+   void first_touch_buffer();
+
+   /*! @brief Declare that the byte buffer does not need to be part of a
+    * Trick checkpoint, which allows a buffer at or above the
+    * AttributeBufferPool huge-page threshold to be carved from a huge-page
+    * backed slab instead of a Trick Memory Manager allocation. The packed
+    * contents are re-encoded every data cycle, so this is safe for
+    * simulations that do not rely on checkpoint and restore of the buffer
+    * contents. Must be called before the buffer grows past the threshold. */
+   void disable_buffer_checkpoint()
+   {
+      this->buffer_checkpoint_required = false;
+   }
+
+   /*! @brief Rebuild the byte buffer after a checkpoint restore when it
+    * was allocated outside checkpointed memory, at its checkpointed
+    * capacity. A no-op for a Trick Memory Manager allocated buffer, which
+    * the restore repopulates directly. */
+   void reinstate_transient_buffer();
+
    /*! @brief Reset the push buffer position. */
    void reset_push_position()
    {
@@ -138,7 +169,49 @@ class OpaqueBuffer
     *  @param encoding One of ENCODING_LITTLE_ENDIAN, ENCODING_BIG_ENDIAN, or ENCODING_NONE. */
    void pull_from_buffer( void *dest, size_t const size, EncodingEnum const encoding );
 
+   /*! @brief Register a field in the descriptor table used by the
+    * pack_buffer_fields() and unpack_buffer_fields() API. The field is an
+    * array of scalar elements at a fixed offset from a base address, and
+    * the fields are packed into the buffer in registration order with the
+    * same byte alignment padding the push_to_buffer() API uses. Register
+    * the fields once at initialization instead of calling push_to_buffer()
+    * or pull_from_buffer() once per field every cycle.
+    *  @param offset        Byte offset of the field from the base address.
+    *  @param element_size  Size of one element in bytes, must be 1, 2, 4, or 8.
+    *  @param element_count Number of elements in the field, must be greater than zero.
+    *  @param encoding      One of ENCODING_LITTLE_ENDIAN, ENCODING_BIG_ENDIAN, or ENCODING_NONE. */
+   void add_buffer_field( size_t const       offset,
+                          size_t const       element_size,
+                          size_t const       element_count,
+                          EncodingEnum const encoding );
+
+   /*! @brief Remove all the fields from the descriptor table. */
+   void clear_buffer_fields();
+
+   /*! @brief Get the number of fields in the descriptor table.
+    *  @return Number of registered fields. */
+   size_t get_buffer_field_count() const
+   {
+      return buffer_fields.size();
+   }
+
+   /*! @brief Pack all the registered fields from the base address into the
+    * buffer in registration order, with one capacity check for the whole
+    * table and a tight per-type copy loop for each field.
+    *  @param base_address Base address the field offsets are relative to. */
+   void pack_buffer_fields( void const *base_address );
+
+   /*! @brief Unpack the buffer into all the registered fields at the base
+    * address in registration order.
+    *  @param base_address Base address the field offsets are relative to. */
+   void unpack_buffer_fields( void *base_address );
+
   protected:
+   /*! @brief Reallocate the base buffer allocation to the specified capacity
+    * and realign the buffer start on a BUFFER_BASE_ALIGNMENT byte boundary.
+    *  @param new_capacity New buffer capacity in bytes. */
+   void reallocate_buffer( size_t const new_capacity );
+
    /*! @brief Push the specified number of pad bytes to the buffer.
     *  @param pad_size Size of data in bytes. */
    void push_pad_to_buffer( size_t const pad_size );
@@ -156,14 +229,36 @@ class OpaqueBuffer
    void byteswap_buffer_copy( void *dest, void const *src,
                               size_t const size, EncodingEnum const encoding );
 
+   /*! @brief A registered field in the pack/unpack descriptor table. */
+   struct BufferField {
+      size_t       offset;        ///< @trick_io{**} Byte offset of the field from the base address.
+      size_t       element_size;  ///< @trick_io{**} Size of one element in bytes (1, 2, 4, or 8).
+      size_t       element_count; ///< @trick_io{**} Number of elements in the field.
+      EncodingEnum encoding;      ///< @trick_io{**} Encoding of the field data in the buffer.
+      bool         byteswap;      ///< @trick_io{**} True if the encoding requires a transmission byteswap.
+   };
+
+   std::vector< BufferField > buffer_fields; ///< @trick_io{**} The registered fields, packed in registration order.
+
+   /*! @brief Get the total buffer size in bytes of all the registered
+    * fields for the current byte alignment, including any pad bytes.
+    *  @return Total packed size of the descriptor table in bytes. */
+   size_t calculate_buffer_fields_size() const;
+
   public:
-   unsigned int alignment; ///< @trick_units{--} The byte alignment to use for the buffer.
+   static size_t const BUFFER_BASE_ALIGNMENT = 64; ///< @trick_io{**} Guaranteed byte alignment of the buffer start, in bytes.
+
+   unsigned int alignment; ///< @trick_units{--} The byte alignment to use for the data in the buffer.
 
    size_t push_pos; ///< @trick_units{--} Position to push data to.
    size_t pull_pos; ///< @trick_units{--} Position to pull data from.
    size_t capacity; ///< @trick_units{--} Capacity of the buffer.
 
-   unsigned char *buffer; ///< @trick_units{--} Byte buffer.
+   unsigned char *buffer;      ///< @trick_units{--} Byte buffer, aligned on a BUFFER_BASE_ALIGNMENT byte boundary.
+   unsigned char *buffer_base; ///< @trick_units{--} Base allocation the aligned buffer points into.
+
+   bool buffer_checkpoint_required; ///< @trick_io{**} True (the default) when the byte buffer must be checkpointable, which excludes the huge-page backed slabs.
+   bool buffer_pooled;              ///< @trick_io{**} True when the base allocation was carved from the AttributeBufferPool and must not be freed or resized in place.
 };
 
 } // namespace TrickHLA
@@ -125,7 +125,11 @@ class Parameter
     *  @param in_name The FOM name for the parameter. */
    void set_FOM_name( char const *in_name )
    {
-      if ( this->FOM_name != NULL ) {
+      // An interned name lives in the shared MetadataStringPool and is not
+      // an individual Trick Memory Manager allocation, so only delete the
+      // old name when it is one.
+      if ( ( this->FOM_name != NULL )
+           && ( trick_MM->get_alloc_info_at( static_cast< void * >( this->FOM_name ) ) != NULL ) ) {
          if ( trick_MM->delete_var( static_cast< void * >( this->FOM_name ) ) ) {
             send_hs( stderr, "Parameter::set_FOM_name():%d ERROR deleting Trick Memory for 'this->FOM_name'%c",
                      __LINE__, THLA_NEWLINE );
@@ -141,6 +145,14 @@ class Parameter
       return trick_name;
    }
 
+   /*! @brief Get the address of the Trick simulation variable associated
+    * with this parameter.
+    *  @return The address of the associated Trick simulation variable. */
+   void const *get_sim_variable_address() const
+   {
+      return address;
+   }
+
    /*! @brief Set the RTI encoding and based on the new encoding determine if
     * we need to byte-swap.
     *  @param in_type The encoding type for this parameter. */
@@ -189,6 +201,11 @@ class Parameter
     *  @return Encoded parameter value. */
    RTI1516_NAMESPACE::VariableLengthData get_encoded_parameter_value();
 
+   /*! @brief Fill in the HLA Parameter Value in place using the appropriate
+    * encoding, referencing the encoded payload instead of copying it.
+    *  @param param_value The parameter value to fill in. */
+   void get_encoded_parameter_value( RTI1516_NAMESPACE::VariableLengthData &param_value );
+
    /*! @brief Extract the data out of the HLA Parameter Value.
     *  @param param_size Parameter data size.
     *  @param param_data Parameter data.
@@ -215,6 +232,14 @@ class Parameter
       this->value_changed = false;
    }
 
+   /*! @brief Check if received data is sitting encoded in the buffer
+    * waiting to be decoded by unpack_parameter_buffer().
+    *  @return True if an unpack of the parameter buffer is pending. */
+   bool is_unpack_pending() const
+   {
+      return this->unpack_pending;
+   }
+
    /*! @brief Unpack the parameter from the buffer into the trick-variable
     * using the appropriate decoding. */
    void unpack_parameter_buffer();
@@ -243,18 +268,25 @@ class Parameter
 
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
+   bool dynamic_primitive_array; ///< @trick_io{**} True for a primitive pointer array whose length is only known at run time.
+
    size_t size;      ///< @trick_units{--} The size of the attribute in bytes.
    size_t num_items; ///< @trick_units{--} Number of attribute items, length of the array.
 
    bool value_changed; ///< @trick_units{--} Flag to indicate the attribute value changed.
 
+   bool unpack_pending; ///< @trick_io{**} True when received data sits encoded in the buffer awaiting an unpack_parameter_buffer() call.
+
    unsigned int HLAtrue; ///< @trick_units{--} A 32-bit integer with a value of 1 on a Big Endian computer.
 
    bool byteswap; ///< @trick_units{--} Flag to indicate byte-swap before RTI Rx/Tx.
 
    void       *address;              ///< @trick_io{**} Address of the trick variable
    ATTRIBUTES *attr;                 ///< @trick_io{**} ATTRIBUTES of the trick variable
-   char       *interaction_FOM_name; ///< @trick_io{**} Copy of the user-supplied interaction FOM_name
+   char       *interaction_FOM_name; ///< @trick_io{**} The interaction FOM_name, interned in the shared MetadataStringPool.
+
+   void  *cached_decode_address; ///< @trick_io{**} Trick array address the cached decode size plan was computed for.
+   size_t cached_decode_items;   ///< @trick_io{**} Element capacity of the Trick allocation behind the cached array address.
 
    RTI1516_NAMESPACE::ParameterHandle param_handle; ///< @trick_io{**} The RTI parameter handle.
 
@@ -276,6 +308,11 @@ class Parameter
    /*! @brief Calculates the number of static items contained by the parameter. */
    void calculate_static_number_of_items();
 
+   /*! @brief Updates the size, number of items, and the Trick array
+    * allocation for a dynamic primitive array being decoded, reusing the
+    * existing allocation when the received data fits its capacity. */
+   void update_dynamic_array_for_decode();
+
    /*! @brief Determines if the HLA interaction parameter type is supported
     * given the RTI encoding.
     *  @return True if supported, false otherwise. */
@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/ItemPool.cpp}
 @trick_link_dependency{../../source/TrickHLA/ParameterItem.cpp}
 @trick_link_dependency{../../source/TrickHLA/Item.cpp}
 
@@ -69,6 +70,18 @@ class ParameterItem : public Item
    //-----------------------------------------------------------------
    // Constructors / destructors
    //-----------------------------------------------------------------
+   /*! @brief Class level allocation operator that serves ParameterItems
+    *  from a fixed-size pool, falling back to the heap when the pool is
+    *  exhausted, making steady-state interaction receipt allocation-free.
+    *  @return Pointer to the allocated memory.
+    *  @param size Size in bytes to allocate. */
+   static void *operator new( std::size_t size );
+
+   /*! @brief Class level deallocation operator that recycles pooled
+    *  ParameterItems back into the pool.
+    *  @param ptr Pointer to the memory to free. */
+   static void operator delete( void *ptr );
+
    /*! @brief Default constructor for the TrickHLA ParameterItem class. */
    ParameterItem();
    /*! @brief Initialization constructor for the TrickHLA ParameterItem class.
@@ -0,0 +1,199 @@
+/*!
+@file TrickHLA/RTISubmitter.hh
+@ingroup TrickHLA
+@brief A single-submitter proxy for the outbound RTI data calls.
+
+Worker threads post fully-encoded attribute updates and interactions to a
+queue and one dedicated submitter thread drains them into the RTI
+ambassador back-to-back. Concurrent updateAttributeValues() and
+sendInteraction() calls from the Trick child threads otherwise serialize
+on the RTI's internal lock and convoy; funneling them through a single
+submitter keeps that lock continuously warm instead of contended.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/RTISubmitter.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_RTI_SUBMITTER_HH
+#define TRICKHLA_RTI_SUBMITTER_HH
+
+// System include files.
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+class RTISubmitter
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__RTISubmitter();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA RTISubmitter class. */
+   RTISubmitter();
+
+   /*! @brief Destructor for the TrickHLA RTISubmitter class. */
+   virtual ~RTISubmitter();
+
+  public:
+   /*! @brief Post a fully-encoded attribute update for submission by the
+    * dedicated submitter thread, creating the thread on first use. The
+    * attribute values are copied into the queued record so the caller can
+    * reuse its map immediately.
+    *  @param rti_amb          RTI ambassador to submit the update to.
+    *  @param instance_handle  Object instance handle for the update.
+    *  @param attribute_values Encoded attribute values for the update.
+    *  @param tag              User supplied tag.
+    *  @param with_timestamp   True to submit in Timestamp Order.
+    *  @param update_time      HLA logical time for a Timestamp Order update.
+    *  @param source_name      Object instance name used for error reporting. */
+   void post_attribute_update( RTI1516_NAMESPACE::RTIambassador               *rti_amb,
+                               RTI1516_NAMESPACE::ObjectInstanceHandle const  &instance_handle,
+                               RTI1516_NAMESPACE::AttributeHandleValueMap const &attribute_values,
+                               RTI1516_USERDATA const                         &tag,
+                               bool const                                      with_timestamp,
+                               Int64Time const                                &update_time,
+                               char const                                     *source_name );
+
+   /*! @brief Post a fully-encoded interaction for submission by the
+    * dedicated submitter thread, creating the thread on first use. The
+    * parameter values are copied into the queued record so the caller can
+    * reuse its map immediately.
+    *  @param rti_amb          RTI ambassador to submit the interaction to.
+    *  @param class_handle     Interaction class handle.
+    *  @param parameter_values Encoded parameter values for the interaction.
+    *  @param tag              User supplied tag.
+    *  @param with_timestamp   True to submit in Timestamp Order.
+    *  @param send_time        HLA logical time for a Timestamp Order send.
+    *  @param source_name      Interaction FOM name used for error reporting. */
+   void post_interaction( RTI1516_NAMESPACE::RTIambassador                 *rti_amb,
+                          RTI1516_NAMESPACE::InteractionClassHandle const  &class_handle,
+                          RTI1516_NAMESPACE::ParameterHandleValueMap const &parameter_values,
+                          RTI1516_USERDATA const                           &tag,
+                          bool const                                        with_timestamp,
+                          Int64Time const                                  &send_time,
+                          char const                                       *source_name );
+
+   /*! @brief Block until every queued submission has been handed to the RTI
+    * ambassador. Call this before a Time Advance Request so all Timestamp
+    * Order messages for the current logical time are submitted before the
+    * advance. */
+   void flush();
+
+   /*! @brief Shutdown the submitter, draining the queued submissions and
+    * joining the submitter thread. */
+   void shutdown();
+
+  private:
+   /*! @brief A fully-encoded outbound RTI submission queued for the
+    *  dedicated submitter thread. */
+   struct Submission {
+      bool                                       is_interaction;   ///< True for a sendInteraction(), false for an updateAttributeValues().
+      RTI1516_NAMESPACE::RTIambassador          *rti_amb;          ///< RTI ambassador to submit to.
+      RTI1516_NAMESPACE::ObjectInstanceHandle    instance_handle;  ///< Object instance handle for an attribute update.
+      RTI1516_NAMESPACE::InteractionClassHandle  class_handle;     ///< Interaction class handle for an interaction.
+      RTI1516_NAMESPACE::AttributeHandleValueMap attribute_values; ///< Encoded attribute values for an attribute update.
+      RTI1516_NAMESPACE::ParameterHandleValueMap parameter_values; ///< Encoded parameter values for an interaction.
+      RTI1516_USERDATA                           tag;              ///< User supplied tag.
+      bool                                       with_timestamp;   ///< True to submit in Timestamp Order.
+      Int64Time                                  time;             ///< HLA logical time for a Timestamp Order submission.
+      std::string                                source_name;      ///< Source object or interaction name for error reporting.
+   };
+
+   pthread_mutex_t mutex;          ///< @trick_io{**} Mutex protecting the submission queue state.
+   pthread_cond_t  work_available; ///< @trick_io{**} Condition signaled when a submission is queued.
+   pthread_cond_t  queue_drained;  ///< @trick_io{**} Condition signaled when the queue empties and no submission is in flight.
+
+   std::vector< Submission > submission_queue; ///< @trick_io{**} Queued submissions in post order.
+
+   bool in_flight; ///< @trick_io{**} True while the submitter thread is handing a batch to the RTI ambassador.
+
+   pthread_t thread;         ///< @trick_io{**} Dedicated submitter thread.
+   bool      thread_created; ///< @trick_io{**} True once the submitter thread has been created.
+
+   bool shutdown_requested; ///< @trick_io{**} True when the submitter is shutting down.
+
+  private:
+   /*! @brief Queue a submission record, creating the submitter thread on
+    *  first use.
+    *  @param submission Submission record to queue. */
+   void post( Submission &submission );
+
+   /*! @brief Create the dedicated submitter thread. The caller must hold
+    *  the submitter mutex. */
+   void create_thread();
+
+   /*! @brief Submitter thread entry point.
+    *  @return Always NULL.
+    *  @param arg Pointer to the RTISubmitter instance. */
+   static void *submitter_entry( void *arg );
+
+   /*! @brief Submitter thread loop that drains queued submissions into the
+    *  RTI ambassador back-to-back. */
+   void submitter_loop();
+
+   /*! @brief Hand one submission to the RTI ambassador, reporting any RTI
+    *  exception without propagating it.
+    *  @param submission Submission to hand to the RTI ambassador. */
+   void submit( Submission const &submission );
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for RTISubmitter class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   RTISubmitter( RTISubmitter const &rhs );
+   /*! @brief Assignment operator for RTISubmitter class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   RTISubmitter &operator=( RTISubmitter const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_RTI_SUBMITTER_HH: Do NOT put anything after this line!
@@ -0,0 +1,95 @@
+/*!
+@file TrickHLA/ReceiveBufferPool.hh
+@ingroup TrickHLA
+@brief Size-classed recycling pool for the receive-side payload buffers.
+
+The user-supplied tag and the decoded parameter payloads received through
+the RTI callbacks are copied into buffers that only live until the queued
+item is processed, which at a high message rate turns into constant
+allocator churn. This pool carves those short-lived buffers from
+size-classed free lists and recycles them when the item is cleared, so
+the receive path is allocation-free at steady state. Buffers larger than
+the largest size class, or requested while the fitting class is
+exhausted, fall back to the Trick Memory Manager exactly as before.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ItemPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/ReceiveBufferPool.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_RECEIVE_BUFFER_POOL_HH
+#define TRICKHLA_RECEIVE_BUFFER_POOL_HH
+
+// System include files.
+#include <cstddef>
+
+namespace TrickHLA
+{
+
+class ReceiveBufferPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ReceiveBufferPool();
+
+  public:
+   /*! @brief Allocate a receive payload buffer of at least the given size
+    * from the smallest size class that fits. Safe to call from the RTI
+    * callback threads.
+    *  @return Pointer to the buffer, or NULL when no size class fits or
+    *  the fitting class is exhausted and the caller needs to fall back to
+    *  a Trick Memory Manager allocation.
+    *  @param size Requested buffer size in bytes. */
+   static unsigned char *allocate( size_t const size );
+
+   /*! @brief Return a buffer to its size-class free list if it came from
+    * the pool. Safe to call from any thread.
+    *  @return True if the buffer was recycled, false if it did not come
+    *  from the pool and the caller needs to free it itself.
+    *  @param data Pointer to the buffer to return. */
+   static bool deallocate( void *data );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Default constructor for ReceiveBufferPool class.
+    *  @details This constructor is private because this class only has
+    *  static functions. */
+   ReceiveBufferPool();
+   /*! @brief Copy constructor for ReceiveBufferPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ReceiveBufferPool( ReceiveBufferPool const &rhs );
+   /*! @brief Assignment operator for ReceiveBufferPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ReceiveBufferPool &operator=( ReceiveBufferPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_RECEIVE_BUFFER_POOL_HH: Do NOT put anything after this line!
@@ -20,7 +20,6 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/ReflectedAttributesQueue.cpp}
-@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
 @revs_title
@@ -34,8 +33,11 @@ NASA, Johnson Space Center\n
 #ifndef TRICKHLA_REFLECTED_ATTRIBUTES_QUEUE_HH
 #define TRICKHLA_REFLECTED_ATTRIBUTES_QUEUE_HH
 
+// System include files.
+#include <atomic>
+#include <cstddef>
+
 // TrickHLA include files
-#include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
 
@@ -64,14 +66,9 @@ class ReflectedAttributesQueue
    friend void init_attrTrickHLA__ReflectedAttributesQueue();
 
   public:
-   MutexLock queue_mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
-
-   // TODO: Update this class so that we can create a Trick checkpoint by adding
-   // serialize and deserialize capability for the attribute_map_queue data type.
-   // Trick can not checkpoint an STL Queue container containing a Map of
-   // AttributeHandles and VariableLength values. DDexter 2/28/2019
-
-   HLAAttributeMapQueue attribute_map_queue; ///< @trick_io{**} Queue of AttributeHandleValueMap from attribute reflections.
+   /*! @brief Capacity of the bounded ring buffer. Must be a power of two so
+    *  the ring indices can wrap with a mask instead of a modulo. */
+   static size_t const QUEUE_CAPACITY = 256;
 
   public:
    //
@@ -88,20 +85,84 @@ class ReflectedAttributesQueue
    bool empty();
 
    /*! @brief Push the attributes onto the queue.
-    *  @param theAttributes The reflected attributes. */
-   void push( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+    *  @details Called only from the single producer thread (the FedAmb
+    *  callback thread). The map contents are moved into the ring slot,
+    *  leaving the callers map empty, so the attribute values are not
+    *  copied. If the ring is full the overflow policy is applied: the
+    *  default QUEUE_OVERFLOW_BLOCK_PRODUCER policy busy-waits for the
+    *  consumer to free up a slot, any other policy discards the incoming
+    *  reflection and counts the drop.
+    *  @param theAttributes The reflected attributes, emptied by the move. */
+   void push( RTI1516_NAMESPACE::AttributeHandleValueMap &theAttributes );
+
+   /*! @brief Set the policy applied when a reflection is pushed while the
+    *  ring is full. Only call this before the federation execution starts
+    *  pushing reflections.
+    *  @details On this lock-free single-producer/single-consumer ring the
+    *  producer must not touch slots already published to the consumer, so
+    *  the drop-oldest and overwrite-latest policies both degrade to
+    *  discarding the incoming reflection.
+    *  @param policy Overflow policy applied when the ring is full. */
+   void set_overflow_policy( QueueOverflowPolicyEnum const policy )
+   {
+      this->overflow_policy = policy;
+   }
+
+   /*! @brief Get the deepest the ring has ever been.
+    *  @return High-water mark of the queue depth. */
+   size_t get_high_water_mark() const
+   {
+      return high_water_mark.load( std::memory_order_relaxed );
+   }
+
+   /*! @brief Get the number of reflections discarded by the overflow policy.
+    *  @return Count of the dropped reflections. */
+   unsigned long long get_dropped_count() const
+   {
+      return dropped_count.load( std::memory_order_relaxed );
+   }
 
    /*! @brief Pop the front value off the queue and the destructor for the
     * value will be called. */
    void pop();
 
    /*! @brief Get the first/oldest item in the queue.
+    *  @details The single consumer owns the front slot until pop() is
+    *  called, so it is free to move or borrow the attribute values held
+    *  by the returned map.
     *  @return The first/oldest item in the queue. */
-   RTI1516_NAMESPACE::AttributeHandleValueMap const &front();
+   RTI1516_NAMESPACE::AttributeHandleValueMap &front();
 
    /*! @brief Clear the queue of all values. */
    void clear();
 
+  private:
+   // This is a bounded lock-free single-producer/single-consumer ring
+   // buffer. The FedAmb callback thread is the only producer (push) and the
+   // Trick simulation thread is the only consumer (front/pop), so a mutex
+   // is not needed: the producer only writes 'tail' and the consumer only
+   // writes 'head'. The indices increase monotonically and are wrapped with
+   // a mask, and they are padded to separate cache lines to avoid
+   // false-sharing ping-pong between the two threads.
+   //
+   // TODO: Update this class so that we can create a Trick checkpoint by
+   // adding serialize and deserialize capability for the ring slots. Trick
+   // can not checkpoint an STL Map of AttributeHandles and VariableLength
+   // values. DDexter 2/28/2019
+
+   RTI1516_NAMESPACE::AttributeHandleValueMap ring[QUEUE_CAPACITY]; ///< @trick_io{**} Ring buffer slots holding the reflected attribute maps.
+
+   size_t slot_bytes[QUEUE_CAPACITY]; ///< @trick_io{**} Encoded byte count held by each ring slot, maintained for the allocation accounting.
+
+   std::atomic< size_t > head;                                      ///< @trick_io{**} Consumer index, only written by the consumer thread.
+   char                  pad[64 - sizeof( std::atomic< size_t > )]; ///< @trick_io{**} Padding to keep head and tail on separate cache lines.
+   std::atomic< size_t > tail;                                      ///< @trick_io{**} Producer index, only written by the producer thread.
+
+   QueueOverflowPolicyEnum overflow_policy; ///< @trick_io{**} Policy applied when a reflection is pushed while the ring is full.
+
+   std::atomic< size_t >             high_water_mark; ///< @trick_io{**} Deepest the ring has ever been, only written by the producer thread.
+   std::atomic< unsigned long long > dropped_count;   ///< @trick_io{**} Number of reflections discarded by the overflow policy, only written by the producer thread.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for ReflectedAttributesQueue class.
@@ -0,0 +1,155 @@
+/*!
+@file TrickHLA/SendPacer.hh
+@ingroup TrickHLA
+@brief This class paces the send-side RTI calls of a data cycle frame with a
+token bucket so the frame's update burst is spread across a configured
+fraction of the frame instead of leaving the host back-to-back.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/SendPacer.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_SEND_PACER_HH
+#define TRICKHLA_SEND_PACER_HH
+
+// System includes
+#include <cstdint>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class SendPacer
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__SendPacer();
+
+  public:
+   bool enabled; ///< @trick_units{--} Enable token-bucket pacing of the cyclic send-side RTI calls (default: false).
+
+   double frame_fraction; /**< @trick_units{--}
+      Fraction of the data cycle frame the frame's RTI calls are spread
+      across. The token refill rate is recomputed each frame as the expected
+      call count divided by this window, so the burst leaves over the window
+      instead of back-to-back. Clamped to (0, 1] (default: 0.5). */
+
+   double burst_tokens; /**< @trick_units{--}
+      Depth of the token bucket, the number of RTI calls permitted
+      back-to-back before the pacing delay engages. Clamped to be at
+      least 1 (default: 4.0). */
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA SendPacer class. */
+   SendPacer();
+   /*! @brief Destructor for the TrickHLA SendPacer class. */
+   virtual ~SendPacer();
+
+   /*! @brief Start a new pacing frame, which also closes out the burst
+    * profile of the previous frame. Fills the bucket and sets the token
+    * refill rate so the expected calls are spread across the configured
+    * fraction of the frame.
+    *  @param frame_time     The data cycle frame time in seconds.
+    *  @param expected_calls The number of RTI calls expected this frame. */
+   void begin_frame( double const frame_time, unsigned int const expected_calls );
+
+   /*! @brief Take a token before making an RTI call, sleeping in short
+    * increments until one refills. Thread safe, and the sleeps happen with
+    * the internal mutex released so concurrent send jobs are not serialized
+    * behind a waiting job. */
+   void acquire();
+
+   /*! @brief Returns a string summary of the demand and achieved burst
+    * profiles and the pacing wait statistics. */
+   std::string const to_string();
+
+  private:
+   /*! @brief Add the tokens that accrued since the last refill.
+    *  @param time The current wall-clock time in microseconds. */
+   void refill( int64_t const time );
+
+   /*! @brief Count a call into a burst profile, tracking the peak number of
+    * calls observed in any one measurement window of the current frame.
+    *  @param time         The wall-clock time of the call in microseconds.
+    *  @param window_start Start time of the profile's current window.
+    *  @param window_calls Calls counted in the profile's current window.
+    *  @param frame_peak   Peak window call count of the frame so far. */
+   static void record_burst( int64_t const time,
+                             int64_t      &window_start,
+                             unsigned int &window_calls,
+                             unsigned int &frame_peak );
+
+   /*! @brief Close out the current frame, folding its burst peaks and
+    * pacing wait time into the run statistics. */
+   void close_frame();
+
+  private:
+   static int64_t const BURST_WINDOW_MICROS  = 1000; ///< @trick_io{**} Burst profile measurement window in microseconds.
+   static int64_t const PACING_SLEEP_MICROS  = 50;   ///< @trick_io{**} Sleep increment while waiting for a token in microseconds.
+
+   MutexLock mutex; ///< @trick_io{**} Serializes the token bucket and profile updates from concurrent send jobs.
+
+   bool     frame_active;     ///< @trick_io{**} True when a pacing frame is in progress.
+   uint64_t frame_count;      ///< @trick_io{**} Number of pacing frames measured.
+   double   tokens;           ///< @trick_io{**} Tokens currently in the bucket.
+   double   refill_rate;      ///< @trick_io{**} Token refill rate in tokens per microsecond.
+   int64_t  last_refill_time; ///< @trick_io{**} Wall-clock time of the last refill in microseconds.
+
+   int64_t      arrival_window_start; ///< @trick_io{**} Start of the current demand profile window in microseconds.
+   unsigned int arrival_window_calls; ///< @trick_io{**} Calls counted in the current demand profile window.
+   unsigned int arrival_frame_peak;   ///< @trick_io{**} Peak demand window call count of the current frame.
+
+   int64_t      release_window_start; ///< @trick_io{**} Start of the current achieved profile window in microseconds.
+   unsigned int release_window_calls; ///< @trick_io{**} Calls counted in the current achieved profile window.
+   unsigned int release_frame_peak;   ///< @trick_io{**} Peak achieved window call count of the current frame.
+
+   uint64_t frame_call_count; ///< @trick_io{**} Calls paced in the current frame.
+   int64_t  frame_wait_time;  ///< @trick_io{**} Time spent waiting for tokens this frame in microseconds.
+
+   uint64_t     total_call_count;     ///< @trick_io{**} Calls paced over the whole run.
+   uint64_t     profiled_frame_count; ///< @trick_io{**} Closed frames that made at least one call.
+   double       arrival_peak_sum;  ///< @trick_io{**} Sum of the per-frame demand burst peaks.
+   unsigned int arrival_peak_max;  ///< @trick_io{**} Largest per-frame demand burst peak observed.
+   double       release_peak_sum;  ///< @trick_io{**} Sum of the per-frame achieved burst peaks.
+   unsigned int release_peak_max;  ///< @trick_io{**} Largest per-frame achieved burst peak observed.
+
+   ElapsedTimeStats wait_time_stats; ///< @trick_io{**} Statistics of the per-frame pacing wait time.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_SEND_PACER_HH: Do NOT put anything after this line!
@@ -0,0 +1,99 @@
+/*!
+@file TrickHLA/ShardedElapsedTimeStats.hh
+@ingroup TrickHLA
+@brief This class gathers elapsed time statistics from multiple threads with
+zero cross-thread contention by sharding the accumulation, with one padded
+ElapsedTimeStats accumulator per sampling thread and a lock-free merged
+snapshot for reporting.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../source/TrickHLA/ShardedElapsedTimeStats.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_SHARDED_ELAPSED_TIME_STATS_HH
+#define TRICKHLA_SHARDED_ELAPSED_TIME_STATS_HH
+
+// System includes
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+
+namespace TrickHLA
+{
+
+class ShardedElapsedTimeStats
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ShardedElapsedTimeStats();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA ShardedElapsedTimeStats class. */
+   ShardedElapsedTimeStats();
+   /*! @brief Destructor for the TrickHLA ShardedElapsedTimeStats class. */
+   virtual ~ShardedElapsedTimeStats();
+
+   // Use implicit copy constructor and assignment operator.
+
+   /*! @brief Record one elapsed time sample into the shard owned by the
+    * calling thread, with no locking and no shared state updates.
+    *  @param time_ms The elapsed time sample in milliseconds. */
+   void sample( double const time_ms );
+
+   /*! @brief Merge the shards into one statistics instance. Each shard is
+    * only ever written by its owning thread, so the merge takes no locks;
+    * take the snapshot where the sampling threads are quiescent (e.g. after
+    * the data job completion barrier) for an exact merge.
+    *  @return The merged elapsed time statistics. */
+   ElapsedTimeStats const snapshot() const;
+
+   /*! @brief Returns a string summary of the merged elapsed time statistics. */
+   std::string const to_string() const;
+
+  private:
+   static int const SHARD_CNT = 32; ///< @trick_io{**} Maximum number of concurrently sampling threads with a private shard.
+
+   /*! @brief One statistics shard with trailing padding so the accumulator
+    * of one thread never shares a cache line with the hot leading members
+    * of the next shard. */
+   struct PaddedStats {
+      ElapsedTimeStats stats;   ///< @trick_io{**} Statistics accumulated by the one thread owning this shard.
+      char             pad[64]; ///< @trick_io{**} Pad the shard out past a cache line.
+   };
+
+   PaddedStats shards[SHARD_CNT]; ///< @trick_io{**} Per-thread statistics shards.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_SHARDED_ELAPSED_TIME_STATS_HH: Do NOT put anything after this line!
@@ -0,0 +1,166 @@
+/*!
+@file TrickHLA/SharedMemoryRing.hh
+@ingroup TrickHLA
+@brief Shared-memory ring buffer used as an optional intra-host fast path for
+attribute updates between co-located federates.
+
+The ring lives in a POSIX shared-memory segment that is created by the single
+writer (the federate that owns the object attributes) and opened by the single
+reader (the co-located subscribing federate). Each ring slot is protected by a
+sequence-lock so the writer never blocks on the reader; a slow reader detects
+that it was lapped and re-synchronizes to the newest published frame.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/SharedMemoryRing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_SHARED_MEMORY_RING_HH
+#define TRICKHLA_SHARED_MEMORY_RING_HH
+
+// System include files.
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace TrickHLA
+{
+
+class SharedMemoryRing
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__SharedMemoryRing();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA SharedMemoryRing class. */
+   SharedMemoryRing();
+
+   /*! @brief Destructor for the TrickHLA SharedMemoryRing class. */
+   virtual ~SharedMemoryRing();
+
+   /*! @brief Create the shared-memory segment and initialize the ring as the
+    * single writer. Any stale segment left over from a previous run with the
+    * same channel name is removed first.
+    *  @return True if the ring was created, false otherwise.
+    *  @param channel    Shared-memory channel name, see make_channel_name().
+    *  @param frame_size Maximum payload size in bytes of one published frame.
+    *  @param frame_count Number of ring slots, rounded up to a power of two. */
+   bool create( std::string const &channel,
+                size_t const       frame_size,
+                size_t const       frame_count );
+
+   /*! @brief Open an existing shared-memory segment as the single reader.
+    * Failure is not an error because the writer may not have created the
+    * segment yet, in which case the caller should simply retry later.
+    *  @return True if the ring was opened, false otherwise.
+    *  @param channel Shared-memory channel name, see make_channel_name(). */
+   bool open( std::string const &channel );
+
+   /*! @brief Unmap the ring, and for the writer also remove the segment. */
+   void close();
+
+   /*! @brief Publish one frame into the ring, never blocking on the reader.
+    *  @return True if the frame was published, false if the frame is larger
+    * than the ring slot payload capacity.
+    *  @param data Frame data to publish.
+    *  @param size Frame size in bytes. */
+   bool write( unsigned char const *data, size_t const size );
+
+   /*! @brief Read the next unread frame from the ring. If the reader was
+    * lapped by the writer it re-synchronizes to the newest frame and the
+    * skipped frames are counted as dropped.
+    *  @return True if a frame was read, false if no new frame is available.
+    *  @param dest     Destination buffer for the frame data.
+    *  @param capacity Destination buffer capacity in bytes.
+    *  @param size     Returned frame size in bytes. */
+   bool read( unsigned char *dest, size_t const capacity, size_t &size );
+
+   /*! @brief Query if the ring is mapped and ready for use.
+    *  @return True if the ring is usable. */
+   bool is_valid() const
+   {
+      return ( header != NULL );
+   }
+
+   /*! @brief Get the payload capacity in bytes of one ring frame.
+    *  @return Frame payload capacity in bytes, or zero if the ring is not mapped. */
+   size_t get_frame_size() const;
+
+   /*! @brief Get the number of frames dropped because the reader was lapped.
+    *  @return Count of dropped frames. */
+   unsigned long get_dropped_frame_count() const
+   {
+      return dropped_frame_count;
+   }
+
+   /*! @brief Build a valid POSIX shared-memory channel name from the
+    * federation execution and object instance names.
+    *  @return Shared-memory channel name.
+    *  @param federation_name Federation execution name.
+    *  @param instance_name   Object instance name. */
+   static std::string make_channel_name( std::string const &federation_name,
+                                         std::string const &instance_name );
+
+  private:
+   /*! @brief Get the address of the indicated ring slot.
+    *  @return Address of the ring slot.
+    *  @param frame Frame number of the slot. */
+   unsigned char *slot_address( unsigned long const frame ) const;
+
+   std::string channel_name; ///< @trick_io{**} Shared-memory channel name.
+   bool        writer;       ///< @trick_io{**} True if this end created the segment.
+
+   void  *mapped_memory; ///< @trick_io{**} Address of the memory mapped segment.
+   size_t mapped_size;   ///< @trick_io{**} Size in bytes of the mapped segment.
+
+   struct RingHeader; ///< Shared ring bookkeeping placed at the start of the segment.
+
+   RingHeader *header;    ///< @trick_io{**} Ring header within the mapped segment.
+   size_t      slot_size; ///< @trick_io{**} Size in bytes of one ring slot including bookkeeping.
+
+   unsigned long next_frame;          ///< @trick_io{**} Next frame number the reader will consume.
+   unsigned long dropped_frame_count; ///< @trick_io{**} Frames skipped because the reader was lapped.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SharedMemoryRing class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SharedMemoryRing( SharedMemoryRing const &rhs );
+   /*! @brief Assignment operator for SharedMemoryRing class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SharedMemoryRing &operator=( SharedMemoryRing const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_SHARED_MEMORY_RING_HH
@@ -84,7 +84,7 @@ class SleepTimeout
 
    /*! @brief Sleep for the configured sleep time.
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
-   int const sleep() const;
+   virtual int const sleep() const;
 
    /*! @brief Gets the wall clock time.
     *  @return The wall clock time in microseconds. */
@@ -100,7 +100,7 @@ class SleepTimeout
    bool const timeout( int64_t const time_in_micros ) const;
 
    /*! @brief Reset the internal timeout time. */
-   void reset();
+   virtual void reset();
 
   protected:
    long long       timeout_time;       ///< @trick_io{**} Timeout elapsed time in microseconds.
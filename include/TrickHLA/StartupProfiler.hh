@@ -0,0 +1,122 @@
+/*!
+@file TrickHLA/StartupProfiler.hh
+@ingroup TrickHLA
+@brief Wall-clock timing of the major federate startup stages, reported
+as a per-stage startup report when the federate begins execution.
+
+The instrumented initialization stages record begin and end timestamps
+through a scoped RAII timer, and the collected stage records are dumped
+as one report at run start, so startup-time regressions are visible and
+attributable to a stage in every simulation log without attaching a
+profiler. The startup stages all run on the main Trick thread, so the
+stage records use plain statics with no locking.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/StartupProfiler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_STARTUP_PROFILER_HH
+#define TRICKHLA_STARTUP_PROFILER_HH
+
+// System includes
+#include <string>
+#include <vector>
+
+namespace TrickHLA
+{
+
+class StartupProfiler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__StartupProfiler();
+
+  public:
+   /*! @brief Scoped RAII timer that records the enclosing scope as one
+    * startup stage, covering every return path of the scope. Nested
+    * scopes are recorded with their nesting depth so sub-stages indent
+    * under their parent stage in the report. */
+   class Scope
+   {
+     public:
+      /*! @brief Record the begin timestamp of the startup stage.
+       *  @param stage_name Name of the startup stage. */
+      explicit Scope( std::string const &stage_name );
+      /*! @brief Record the end timestamp of the startup stage. */
+      ~Scope();
+
+     private:
+      int stage_index; ///< @trick_io{**} Index of the stage record this scope closes.
+
+      // Do not allow the copy constructor or assignment operator.
+      /*! @brief Copy constructor for Scope class.
+       *  @details This constructor is private to prevent inadvertent copies. */
+      Scope( Scope const &rhs );
+      /*! @brief Assignment operator for Scope class.
+       *  @details This assignment operator is private to prevent inadvertent copies. */
+      Scope &operator=( Scope const &rhs );
+   };
+
+   /*! @brief Query if any startup stages have been recorded.
+    *  @return True if at least one startup stage has been recorded. */
+   static bool has_stages();
+
+   /*! @brief Summarize the recorded startup stages with one line per
+    * stage showing the start offset from the first stage, the stage
+    * duration and the share of the total startup time.
+    *  @return Multi-line startup report string. */
+   static std::string to_string();
+
+  private:
+   /*! @brief Begin and end timestamps of one recorded startup stage. */
+   struct StageRecord
+   {
+      std::string name;          ///< @trick_io{**} Name of the startup stage.
+      long long   start_time_us; ///< @trick_io{**} Wall-clock begin time in microseconds.
+      long long   end_time_us;   ///< @trick_io{**} Wall-clock end time in microseconds, -1 while the stage is open.
+      int         depth;         ///< @trick_io{**} Nesting depth of the stage, 0 for a top level stage.
+   };
+
+   static std::vector< StageRecord > stages; ///< @trick_io{**} Recorded startup stages in begin order.
+
+   static int open_stage_count; ///< @trick_io{**} Number of currently open stage scopes, used as the nesting depth.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for StartupProfiler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StartupProfiler( StartupProfiler const &rhs );
+   /*! @brief Assignment operator for StartupProfiler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StartupProfiler &operator=( StartupProfiler const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_STARTUP_PROFILER_HH
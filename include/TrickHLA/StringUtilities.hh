@@ -225,6 +225,128 @@ class StringUtilities
       to_string( output, handle.toString() );
    }
 
+   /*! @brief C++ wide string to caller provided fixed buffer conversion
+    * routine, narrowing each character, with no heap allocation. The output
+    * is truncated to fit the buffer and always NUL terminated.
+    *  @return The output buffer.
+    *  @param output Caller provided output buffer.
+    *  @param size   Size of the output buffer in bytes.
+    *  @param input  The input wide string. */
+   static char const *to_buffer(
+      char               *output,
+      size_t const        size,
+      std::wstring const &input )
+   {
+      if ( ( output == NULL ) || ( size == 0 ) ) {
+         return output;
+      }
+      size_t const length = ( input.size() < ( size - 1 ) ) ? input.size() : ( size - 1 );
+      for ( size_t i = 0; i < length; ++i ) {
+         output[i] = (char)input[i];
+      }
+      output[length] = '\0';
+      return output;
+   }
+
+   /*! @brief Convert a federate handle to text through the bounded
+    * per-thread handle text cache, with no heap allocation on a cache hit.
+    *  @details The returned pointer is non-owning and remains valid on the
+    *  calling thread until a colliding handle reuses the cache slot, so use
+    *  it immediately (e.g. as a send_hs() argument) or copy it out.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Federate handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::FederateHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 1, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
+   /*! @brief Convert an interaction class handle to text through the
+    * bounded per-thread handle text cache.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Class handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::InteractionClassHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 2, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
+   /*! @brief Convert a parameter handle to text through the bounded
+    * per-thread handle text cache.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Parameter handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::ParameterHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 3, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
+   /*! @brief Convert an object instance handle to text through the bounded
+    * per-thread handle text cache.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Instance handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::ObjectInstanceHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 4, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
+   /*! @brief Convert an object class handle to text through the bounded
+    * per-thread handle text cache.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Class handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::ObjectClassHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 5, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
+   /*! @brief Convert an attribute handle to text through the bounded
+    * per-thread handle text cache.
+    *  @return Non-owning pointer to the formatted handle text.
+    *  @param handle Attribute handle. */
+   static char const *to_text(
+      RTI1516_NAMESPACE::AttributeHandle const &handle )
+   {
+      unsigned long long const key   = handle_text_key( 6, handle.hash() );
+      HandleTextEntry         *entry = handle_text_slot( key );
+      if ( entry->key != key ) {
+         to_buffer( entry->text, sizeof( entry->text ), handle.toString() );
+         entry->key = key;
+      }
+      return entry->text;
+   }
+
    /*! @brief Trim any leading or trailing whitespace from the string.
     *  @param s The string to trim. */
    static void trim_whitespace(
@@ -364,6 +486,49 @@ class StringUtilities
    }
 
   private:
+   enum {
+      HANDLE_TEXT_SIZE  = 64, ///< Size of one cached handle text entry in bytes, including the NUL.
+      HANDLE_TEXT_SLOTS = 256 ///< Number of slots in the per-thread handle text cache, power of two.
+   };
+
+   /*! @brief One slot of the bounded per-thread handle to text cache. */
+   struct HandleTextEntry {
+      unsigned long long key;                    ///< Mixed handle hash key, zero when the slot is empty.
+      char               text[HANDLE_TEXT_SIZE]; ///< Formatted handle text.
+   };
+
+   /*! @brief Build the cache key for a handle from a per handle-type tag
+    * and the encoded handle hash, so equal hashes of different handle
+    * types do not alias and a real key is never zero.
+    *  @return Handle text cache key.
+    *  @param type_id Small tag unique to the handle type.
+    *  @param hash    The encoded handle hash value. */
+   static unsigned long long handle_text_key(
+      unsigned int const type_id,
+      long const         hash )
+   {
+      return ( ( (unsigned long long)type_id << 56 )
+               | ( ( (unsigned long long)(unsigned long)hash + 1ULL ) & 0x00ffffffffffffffULL ) );
+   }
+
+   /*! @brief Look up the direct-mapped cache slot for the given key. The
+    * cache is per-thread so the lookup needs no mutex and is safe on the
+    * RTI callback thread.
+    *  @return The cache slot for the key, which may hold a different key.
+    *  @param key Handle text cache key. */
+   static HandleTextEntry *handle_text_slot(
+      unsigned long long const key )
+   {
+      static thread_local HandleTextEntry cache[HANDLE_TEXT_SLOTS];
+
+      // Mix the key so clustered handle values spread across the slots.
+      unsigned long long k = key;
+      k ^= k >> 33;
+      k *= 0xff51afd7ed558ccdULL;
+      k ^= k >> 33;
+      return ( &cache[(size_t)k & ( HANDLE_TEXT_SLOTS - 1 )] );
+   }
+
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for StringUtilities class.
     *  @details This constructor is private to prevent inadvertent copies. */
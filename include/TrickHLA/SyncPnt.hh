@@ -119,11 +119,12 @@ class SyncPnt
       return this->label;
    }
 
-   /*! @brief Get the synchronization point state.
+   /*! @brief Get the synchronization point state. Wait-free atomic load,
+    *  safe to call from any thread without holding the list mutex.
     *  @return The current state for this synchronization point. */
    virtual SyncPtStateEnum const get_state() const
    {
-      return this->state;
+      return (SyncPtStateEnum)__atomic_load_n( &this->state, __ATOMIC_ACQUIRE );
    }
 
    /*! @brief Set the synchronization point label.
@@ -133,11 +134,28 @@ class SyncPnt
       this->label = l;
    }
 
-   /*! @brief Set the current state of the synchronization point.
+   /*! @brief Set the current state of the synchronization point. Atomic
+    *  store, safe to call from any thread without holding the list mutex.
     *  @param s Current synchronization point state. */
    virtual void set_state( SyncPtStateEnum const s )
    {
-      this->state = s;
+      __atomic_store_n( &this->state, s, __ATOMIC_RELEASE );
+   }
+
+   /*! @brief Atomically transition the synchronization point state from the
+    *  expected state to the new state. The compare-and-swap makes the
+    *  consume-style transitions (e.g. SYNCHRONIZED back to EXISTS) safe
+    *  against a concurrent state change from the federate ambassador
+    *  callback thread without taking a lock.
+    *  @return True if the state was the expected state and was transitioned.
+    *  @param from Expected current state.
+    *  @param to New state. */
+   virtual bool transition_state( SyncPtStateEnum const from,
+                                  SyncPtStateEnum const to )
+   {
+      SyncPtStateEnum expected = from;
+      return __atomic_compare_exchange_n( &this->state, &expected, to, false,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE );
    }
 
    // Utility functions.
@@ -153,7 +171,7 @@ class SyncPnt
 
   protected:
    std::wstring    label; ///< @trick_io{**} Sync-point name.
-   SyncPtStateEnum state; ///< @trick_units{--} Sync-point state.
+   SyncPtStateEnum state; ///< @trick_units{--} Sync-point state, only accessed through the atomic get_state(), set_state() and transition_state() functions since the federate ambassador callback thread and the waiting simulation threads race on it.
 };
 
 } // namespace TrickHLA
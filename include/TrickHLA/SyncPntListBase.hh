@@ -37,7 +37,11 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_SYNC_PNT_LIST_BASE_HH
 
 // System includes.
+#include <map>
+#include <pthread.h>
+#include <set>
 #include <string>
+#include <vector>
 
 // Trick include files.
 
@@ -120,6 +124,13 @@ class SyncPntListBase
       RTI1516_NAMESPACE::RTIambassador           &RTI_amb,
       RTI1516_NAMESPACE::FederateHandleSet const &federate_handle_set );
 
+   /*! @brief Wait for the RTI to confirm the registration of every
+    *  synchronization point fired off by register_all_sync_points(). The
+    *  registrations are pipelined without intermediate waits, so this
+    *  drains the pending registration completion set in one place.
+    *  @param fed_ptr Pointer to TrickHLA::Federate instance. */
+   virtual void wait_for_all_registration_confirmations( Federate *fed_ptr );
+
    /*! @brief Callback from TrickHLA::FedAmb through TrickHLA::Federate for
     *  when registration of a synchronization point success.
     *  and is one of the sync-points created.
@@ -181,6 +192,18 @@ class SyncPntListBase
       Federate                         *federate,
       std::wstring const               &label );
 
+   /*! @brief Achieve all the specified sync-points first and then wait for
+    *  the federation to be synchronized on them. Achieving the whole batch
+    *  up front lets the RTI overlap the synchronization of every sync-point
+    *  in the batch instead of paying a full federation round trip per label.
+    *  @param RTI_amb Reference to RTI Ambassador.
+    *  @param federate       Associated federate.
+    *  @param labels         Synchronization point labels. */
+   virtual void achieve_and_wait_for_synchronization_list(
+      RTI1516_NAMESPACE::RTIambassador  &RTI_amb,
+      Federate                          *federate,
+      std::vector< std::wstring > const &labels );
+
    /*! @brief Determine if the synchronization point is known to be in the list
     * of known synchronization points.
     *  @return True if the label is a known synchronization point.
@@ -282,13 +305,29 @@ class SyncPntListBase
    virtual bool wait_for_synchronization( Federate *federate,
                                           SyncPnt  *sync_pnt );
 
+   /*! @brief Broadcast the sync-point state change condition variable to
+    *  wake up any thread blocked in wait_for_sync_point_state_change().
+    *  Only call this after the sync-point list mutex has been released. */
+   void signal_sync_point_state_change();
+
+   /*! @brief Block for a bounded time waiting for a sync-point state change
+    *  to be signaled from one of the FedAmb callback driven functions. */
+   void wait_for_sync_point_state_change();
+
   protected:
    MutexLock mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
    std::vector< SyncPnt * > sync_point_list; ///< @trick_io{**} Vector of synchronization points.
 
+   std::map< std::wstring, SyncPnt * > sync_point_map; ///< @trick_io{**} Interning table mapping each label to its synchronization point so label lookups avoid a linear scan with wide string compares.
+
+   std::set< std::wstring > pending_registrations; ///< @trick_io{**} Completion set of sync-point labels fired off for registration with the RTI but not confirmed by a registration callback yet.
+
    std::wstring reconfig_name; ///< @trick_io{**} Wide string of the reconfiguration name.
 
+   pthread_mutex_t sync_pnt_cond_mutex; ///< @trick_io{**} Mutex paired with the sync-point state change condition variable.
+   pthread_cond_t  sync_pnt_cond;       ///< @trick_io{**} Condition variable signaled when a sync-point changes state.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for SyncPntListBase class.
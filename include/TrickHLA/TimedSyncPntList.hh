@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/TimedSyncPntList.cpp}
 @trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/SyncPntListBase.cpp}
+@trick_link_dependency{../../source/TrickHLA/TimedSyncPnt.cpp}
 
 @revs_title
 @revs_begin
@@ -38,6 +39,7 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <string>
+#include <vector>
 
 // Trick include files.
 
@@ -45,6 +47,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/SyncPntListBase.hh"
+#include "TrickHLA/TimedSyncPnt.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -115,6 +118,14 @@ class TimedSyncPntList : public TrickHLA::SyncPntListBase
     *  @param checkTime Time to check. */
    virtual bool check_sync_points( Int64Time const &checkTime );
 
+   /*! @brief Clear the given synchronization point label from the list.
+    *  @return True if synchronization point is cleared.
+    *  @param label The synchronization point label. */
+   virtual bool clear_sync_point( std::wstring const &label );
+
+   /*! @brief Clear out the list of synchronization points. */
+   virtual void reset();
+
    /*! @brief Converts the vector of synchronization points to a
     *  checkpoint-able class.
     *  @param pts Area to populate. */
@@ -123,6 +134,22 @@ class TimedSyncPntList : public TrickHLA::SyncPntListBase
    /*! @brief Dumps synchronization point information to the screen. */
    virtual void print_sync_points();
 
+  private:
+   /*! @brief Heap ordering predicate placing the pending synchronization
+    * point with the earliest action time at the front of the heap.
+    *  @return True if lhs has a later action time than rhs.
+    *  @param lhs Left hand side synchronization point.
+    *  @param rhs Right hand side synchronization point. */
+   static bool later_action_time( TimedSyncPnt const *lhs,
+                                  TimedSyncPnt const *rhs );
+
+   /*! @brief Drop synchronization points that are no longer pending off the
+    * front of the heap so the front entry is the earliest pending point.
+    * The caller must hold the mutex. */
+   void prune_achieved_heap_entries();
+
+   std::vector< TimedSyncPnt * > pending_sync_point_heap; ///< @trick_io{**} Min-heap of the pending synchronization points keyed on the action time, the entries are owned by the sync_point_list.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for TimedSyncPntList class.
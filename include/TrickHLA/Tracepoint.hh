@@ -0,0 +1,141 @@
+/*!
+@file TrickHLA/Tracepoint.hh
+@ingroup TrickHLA
+@brief Compile-time-optional static tracepoints for the hot data path.
+
+The THLA_TRACEPOINT macros mark the data path stage boundaries (encode,
+RTI call, grant wait, thread coordination) so a frame overrun can be
+attributed to a stage without an external profiler. Events are recorded
+into a fixed-size in-memory ring and dumped at federate shutdown as a
+Chrome-tracing / Perfetto compatible JSON file. When THLA_TRACEPOINTS is
+not defined in TrickHLA/CompileConfig.hh the macros compile to nothing,
+so the instrumented hot paths pay zero cost.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Tracepoint.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRACEPOINT_HH
+#define TRICKHLA_TRACEPOINT_HH
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+#if defined( THLA_TRACEPOINTS )
+
+// System include files.
+#include <cstdint>
+
+namespace TrickHLA
+{
+
+class Tracepoint
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__Tracepoint();
+
+  public:
+   /*! @brief Record one trace event into the ring. Lock free, a single
+    * atomic increment plus four stores, safe to call from any thread.
+    *  @param name  Event name, which must be a string literal because only
+    *  the pointer is stored.
+    *  @param phase Chrome-tracing phase: 'B' begin, 'E' end, 'i' instant. */
+   static void record( char const *name, char const phase );
+
+   /*! @brief Dump the recorded events to a Chrome-tracing / Perfetto
+    * compatible JSON file, oldest event first. Events recorded while the
+    * dump is running may be missed or torn, so dump at shutdown or while
+    * the data path is quiescent.
+    *  @param path Path of the JSON trace file to write. */
+   static void dump( char const *path );
+
+   /*! @brief Scoped RAII tracepoint that records a begin event on
+    * construction and the matching end event on destruction, covering
+    * every return path of the enclosing scope. */
+   class Scope
+   {
+     public:
+      /*! @brief Record the begin event for the enclosing scope.
+       *  @param name Event name, which must be a string literal. */
+      explicit Scope( char const *name )
+         : scope_name( name )
+      {
+         Tracepoint::record( scope_name, 'B' );
+      }
+      /*! @brief Record the matching end event. */
+      ~Scope()
+      {
+         Tracepoint::record( scope_name, 'E' );
+      }
+
+     private:
+      char const *scope_name; ///< @trick_io{**} Event name of the enclosing scope.
+
+      // Do not allow the copy constructor or assignment operator.
+      /*! @brief Copy constructor for Scope class.
+       *  @details This constructor is private to prevent inadvertent copies. */
+      Scope( Scope const &rhs );
+      /*! @brief Assignment operator for Scope class.
+       *  @details This assignment operator is private to prevent inadvertent copies. */
+      Scope &operator=( Scope const &rhs );
+   };
+
+   static unsigned int const RING_CAPACITY = 65536; ///< @trick_io{**} Ring capacity in events, must be a power of two.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for Tracepoint class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   Tracepoint( Tracepoint const &rhs );
+   /*! @brief Assignment operator for Tracepoint class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   Tracepoint &operator=( Tracepoint const &rhs );
+};
+
+} // namespace TrickHLA
+
+// Static tracepoint macros used on the hot data path.
+#   define THLA_TRACEPOINT( name ) TrickHLA::Tracepoint::record( name, 'i' )
+#   define THLA_TRACEPOINT_BEGIN( name ) TrickHLA::Tracepoint::record( name, 'B' )
+#   define THLA_TRACEPOINT_END( name ) TrickHLA::Tracepoint::record( name, 'E' )
+#   define THLA_TRACEPOINT_SCOPE( name ) TrickHLA::Tracepoint::Scope thla_tracepoint_scope_( name )
+
+#else // !THLA_TRACEPOINTS
+
+// Tracing is compiled out, the macros expand to nothing.
+#   define THLA_TRACEPOINT( name ) ( (void)0 )
+#   define THLA_TRACEPOINT_BEGIN( name ) ( (void)0 )
+#   define THLA_TRACEPOINT_END( name ) ( (void)0 )
+#   define THLA_TRACEPOINT_SCOPE( name ) ( (void)0 )
+
+#endif // THLA_TRACEPOINTS
+
+#endif // TRICKHLA_TRACEPOINT_HH: Do NOT put anything after this line!
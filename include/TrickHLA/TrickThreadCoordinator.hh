@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/ShardedElapsedTimeStats.cpp}
 
 @revs_title
 @revs_begin
@@ -37,11 +38,15 @@ thread data cycle time being longer than the main thread data cycle time.}
 #define TRICKHLA_TRICK_THREAD_COORDINATOR_HH
 
 // System includes
+#include <atomic>
 #include <cstdint>
+#include <pthread.h>
 #include <string>
+#include <vector>
 
 // TrickHLA include files.
 #include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/ShardedElapsedTimeStats.hh"
 
 namespace TrickHLA
 {
@@ -86,12 +91,66 @@ class TrickThreadCoordinator
    void associate_to_trick_child_thread( unsigned int const thread_id,
                                          double const       data_cycle );
 
+   /*! @brief Associate a Trick child thread with TrickHLA and pin the
+    *  thread to the specified CPU. The pinned thread faults in the staging
+    *  buffers of its associated objects on its first data cycle so the
+    *  buffer pages are placed on the thread's NUMA node by the operating
+    *  system's first-touch placement policy.
+    *  @param thread_id  Trick thread ID (0 for the main thread).
+    *  @param data_cycle Data cycle time for this thread in seconds.
+    *  @param cpu_id     CPU to pin the thread to, or -1 for no pinning. */
+   void associate_to_trick_child_thread( unsigned int const thread_id,
+                                         double const       data_cycle,
+                                         int const          cpu_id );
+
    /*! @brief Disable the comma separated list of Trick child thread IDs associated to TrickHLA. */
    void disable_trick_thread_associations( char const *thread_ids );
 
    /*! @brief Verify the threads IDs associated to objects in the input file. */
    void verify_trick_thread_associations();
 
+   /*! @brief Function signature for a per-object data job used by the data
+    *  job worker pool.
+    *  @param user_data Opaque per-batch context supplied by the caller.
+    *  @param obj_index Index of the object to process. */
+   typedef void ( *ObjectJobFn )( void *user_data, unsigned int const obj_index );
+
+   /*! @brief Create the pool of persistent data job worker threads used to
+    *  fan per-object encode/decode jobs out across CPU cores. Calling this
+    *  more than once or with a zero count is a no-op.
+    *  @param worker_count Number of worker threads to create. */
+   void initialize_data_job_workers( unsigned int const worker_count );
+
+   /*! @brief Command the data job worker threads to exit and join them. */
+   void shutdown_data_job_workers();
+
+   /*! @brief Determine if the data job worker pool is available.
+    *  @return True if the data job worker pool has been initialized. */
+   bool is_data_job_workers_enabled() const
+   {
+      return ( this->worker_cnt > 0 );
+   }
+
+   /*! @brief Fan the per-object job out across the worker threads, with the
+    *  calling thread participating, and block until every object index in
+    *  the batch has been processed (i.e. a completion barrier).
+    *  @param job       Job function called once per object index.
+    *  @param user_data Opaque per-batch context passed to the job function.
+    *  @param job_count Number of object indices in the batch. */
+   void execute_object_jobs( ObjectJobFn job, void *user_data, unsigned int const job_count );
+
+   /*! @brief Configure the adaptive scheduling of the data job batches.
+    *  When enabled, the per-object job times are measured and the claim
+    *  order of each batch is periodically rebalanced so that the objects
+    *  predicted to take the longest are claimed first, which keeps a heavy
+    *  object from being claimed last where it would extend the batch
+    *  critical path. A rebalance is only adopted when the predicted batch
+    *  completion time improves enough to clear a hysteresis band, which
+    *  avoids schedule thrash on noisy timing.
+    *  @param enable           True to adaptively schedule the data jobs.
+    *  @param rebalance_period Number of batches between rebalances. */
+   void configure_adaptive_job_scheduling( bool const enable, unsigned int const rebalance_period );
+
    /*! @brief Announce to all the child threads the main thread has data available. */
    void announce_data_available();
 
@@ -104,10 +163,22 @@ class TrickThreadCoordinator
    /*! @brief Wait to receive data when the Trick main thread is ready. */
    void wait_to_receive_data();
 
+   /*! @brief Advance the precomputed per-object data cycle schedule tables
+    * to the specified simulation time so the per-object boundary checks can
+    * answer with a table lookup instead of a modulo per object. Must be
+    * called from the Trick main thread before the boundary checks are made
+    * for the same simulation time. */
+   void advance_data_cycle_schedule( int64_t const sim_time_in_base_time );
+
    /*! @brief On receive boundary if sim-time is an integer multiple of a valid cycle-time. */
    bool const on_receive_data_cycle_boundary_for_obj( unsigned int const obj_index,
                                                       int64_t const      sim_time_in_base_time ) const;
 
+   /*! @brief On send boundary if sim-time is offset from an integer multiple
+    * of a valid cycle-time by the object's configured send phase offset. */
+   bool const on_send_data_cycle_boundary_for_obj( unsigned int const obj_index,
+                                                   int64_t const      sim_time_in_base_time ) const;
+
    /*! @brief Get the data cycle time for the configured object index or return
     * the default data cycle time. */
    int64_t const get_data_cycle_base_time_for_obj( unsigned int const obj_index,
@@ -128,6 +199,12 @@ class TrickThreadCoordinator
    /*! @brief Wait to send data for Trick child thread. */
    void wait_to_send_data_for_child_thread( unsigned int const thread_id );
 
+   /*! @brief Fault in the staging buffers of the objects associated to the
+    *  specified thread from the calling thread, for NUMA first-touch page
+    *  placement.
+    *  @param thread_id Trick thread ID. */
+   void first_touch_associated_object_buffers( unsigned int const thread_id );
+
   protected:
    Federate *federate; ///< @trick_units{--} Associated TrickHLA::Federate.
    Manager  *manager;  ///< @trick_units{--} Associated TrickHLA::Manager.
@@ -140,12 +217,84 @@ class TrickThreadCoordinator
 
    unsigned int thread_cnt; ///< @trick_units{--} Number of Trick child threads used for array sizes.
 
-   unsigned int *thread_state; ///< @trick_units{--} TrickHLA state of trick child threads being used.
+   bool *first_touch_pending_per_thread; ///< @trick_io{**} Per-thread flag set when a pinned thread still needs to fault in the staging buffers of its associated objects.
+
+   /*! @brief Coordination state of one Trick thread, padded out to its own
+    * cache line so the per-thread state words never share a cache line and
+    * the threads do not false-share when they poll each others state. */
+   struct AlignedThreadState {
+      std::atomic< unsigned int > state;                                    ///< @trick_io{**} TrickHLA state of this Trick thread.
+      char                        pad[64 - sizeof( std::atomic< unsigned int > )]; ///< @trick_io{**} Pad the state out to a full cache line.
+   };
+
+   AlignedThreadState *thread_state; ///< @trick_io{**} TrickHLA state of trick child threads being used, one cache line per thread.
 
    long long *data_cycle_base_time_per_thread; ///< @trick_units{--} Data cycle times per thread in the base HLA Logical Time representation.
    long long *data_cycle_base_time_per_obj;    ///< @trick_units{--} Data cycle times per object instance in the base HLA Logical Time representation.
 
+   long long *time_in_cycle_per_obj;       ///< @trick_io{**} Precomputed position of the simulation time within each object's data cycle, advanced by advance_data_cycle_schedule().
+   long long *send_phase_in_cycle_per_obj; ///< @trick_io{**} Precomputed per-object send phase offset reduced modulo the object's data cycle time.
+   long long  data_cycle_schedule_sim_time; ///< @trick_io{**} Simulation time the schedule tables have been advanced to, in the base HLA Logical Time representation.
+   long long  data_cycle_schedule_step;     ///< @trick_io{**} Simulation time step used for the previous schedule table advance.
+
    long long main_thread_data_cycle_base_time; ///< @trick_units{--} Trick main thread data cycle time in the base HLA Logical Time representation.
+
+   unsigned int worker_cnt;     ///< @trick_io{**} Number of data job worker threads in the pool.
+   pthread_t   *worker_threads; ///< @trick_io{**} Data job worker thread handles.
+
+   pthread_mutex_t job_mutex;      ///< @trick_io{**} Mutex protecting the data job dispatch state.
+   pthread_cond_t  job_start_cond; ///< @trick_io{**} Signaled to start a new batch of data jobs.
+   pthread_cond_t  job_done_cond;  ///< @trick_io{**} Signaled when the last data job of a batch completes.
+
+   ObjectJobFn        job_fn;         ///< @trick_io{**} Job function for the current batch.
+   void              *job_user_data;  ///< @trick_io{**} Opaque context for the current batch.
+   unsigned int       job_count;      ///< @trick_io{**} Number of object indices in the current batch.
+   std::atomic< unsigned int > job_next_index; ///< @trick_io{**} Next unclaimed object index, claimed lock-free by the workers.
+   unsigned int       job_remaining;  ///< @trick_io{**} Object indices not yet completed, guarded by job_mutex.
+   unsigned long long job_generation; ///< @trick_io{**} Batch generation counter used to wake the workers.
+   bool               job_shutdown;   ///< @trick_io{**} True to command the worker threads to exit.
+   bool               job_batch_active; ///< @trick_io{**} True while a batch is in flight, set atomically so a nested dispatch from within a job degrades to a serial run on the calling thread.
+
+   static double const JOB_COST_FILTER_GAIN;      ///< @trick_io{**} Low-pass filter gain for the per-object job cost estimates.
+   static double const JOB_REBALANCE_HYSTERESIS;  ///< @trick_io{**} Fractional predicted improvement required to adopt a rebalanced schedule.
+
+   bool         adaptive_job_scheduling;      ///< @trick_io{**} True to adaptively order the data job batches by measured per-object cost.
+   unsigned int job_rebalance_period;         ///< @trick_io{**} Number of batches between adaptive schedule rebalances.
+   unsigned int job_batches_since_rebalance;  ///< @trick_io{**} Batches processed since the last schedule rebalance.
+   bool         job_schedule_active;          ///< @trick_io{**} True when the claim slots map through the adaptive schedule for the current batch.
+
+   std::vector< unsigned int > job_schedule; ///< @trick_io{**} Claim slot to object index schedule, heaviest objects first.
+   std::vector< double >       job_cost_avg; ///< @trick_io{**} Low-pass filtered per-object job cost in milliseconds.
+
+   ShardedElapsedTimeStats job_time_stats; ///< @trick_io{**} Sharded per-thread statistics of the measured data job execution times, contention free from the worker threads.
+
+  protected:
+   /*! @brief Entry point wrapper for the data job worker threads.
+    *  @return Always NULL.
+    *  @param arg The TrickThreadCoordinator instance. */
+   static void *data_job_worker_entry( void *arg );
+
+   /*! @brief Main loop for a data job worker thread: wait for a batch,
+    *  claim and process object indices, and signal batch completion. */
+   void data_job_worker_loop();
+
+   /*! @brief Claim and process object indices from the current batch.
+    *  @return The number of object indices this thread processed. */
+   unsigned int process_claimed_jobs();
+
+   /*! @brief Refresh the adaptive claim schedule for a batch of the
+    *  specified size, rebalancing it when the rebalance period has elapsed
+    *  and the predicted improvement clears the hysteresis band. Called with
+    *  the job mutex held before the batch is published.
+    *  @param batch_job_count Number of object indices in the batch. */
+   void update_job_schedule( unsigned int const batch_job_count );
+
+   /*! @brief Predict the completion time of a batch claimed in the given
+    *  order from the filtered per-object costs, by greedily assigning each
+    *  claimed object to the soonest-free thread of the pool.
+    *  @return The predicted batch completion time in milliseconds.
+    *  @param order Claim order of the object indices. */
+   double estimate_batch_makespan( std::vector< unsigned int > const &order ) const;
 };
 
 } // namespace TrickHLA
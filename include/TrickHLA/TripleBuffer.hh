@@ -0,0 +1,142 @@
+/*!
+@file TrickHLA/TripleBuffer.hh
+@ingroup TrickHLA
+@brief Wait-free triple buffer holding the latest reflected attribute snapshot.
+
+The producer thread publishes each reflected attribute snapshot into its own
+slot and makes it the latest snapshot with a single atomic index flip, while
+the consumer thread latches the latest snapshot with another atomic index
+flip, so the two threads exchange the state snapshot without ever taking a
+lock or waiting on each other.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TripleBuffer.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRIPLE_BUFFER_HH
+#define TRICKHLA_TRIPLE_BUFFER_HH
+
+// System include files.
+#include <atomic>
+
+// TrickHLA include files
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+class TripleBuffer
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TripleBuffer();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA TripleBuffer class. */
+   TripleBuffer();
+   /*! @brief Destructor for the TrickHLA TripleBuffer class. */
+   virtual ~TripleBuffer();
+
+  public:
+   /*! @brief Determine if a published snapshot has not been latched yet.
+    *  @return True if a fresh snapshot is available to latch. */
+   bool fresh() const;
+
+   /*! @brief Publish the given attribute values as the latest snapshot.
+    *  @details Called only from the single producer thread (the FedAmb
+    *  callback thread). The values are moved into the write slot, leaving
+    *  the callers map empty, then published with an atomic index flip that
+    *  never blocks on the consumer. Any published-but-unlatched value this
+    *  snapshot does not supersede is carried forward so a slower attribute
+    *  update is not lost when the consumer skips a snapshot.
+    *  @param values The reflected attribute values, emptied by the move. */
+   void publish( RTI1516_NAMESPACE::AttributeHandleValueMap &values );
+
+   /*! @brief Latch the latest published snapshot.
+    *  @details Called only from the single consumer thread (the Trick
+    *  simulation thread) and only when fresh() is true. The consumer owns
+    *  the latched slot until the next latch() call, so it is free to move
+    *  or borrow the attribute values held by the returned map, but any
+    *  borrowed reference must be dropped before the next latch() hands the
+    *  slot back to the producer.
+    *  @return The latched snapshot of attribute values. */
+   RTI1516_NAMESPACE::AttributeHandleValueMap &latch();
+
+   /*! @brief Clear all the snapshot slots. Not thread safe, only call when
+    * neither the producer nor the consumer is active. */
+   void clear();
+
+  private:
+   static unsigned int const FRESH_BIT;  ///< @trick_io{**} Bit set in the latest index while the published snapshot has not been latched.
+   static unsigned int const INDEX_MASK; ///< @trick_io{**} Mask extracting the slot index from the latest index.
+
+   // The producer only writes the slot indexed by write_index and the
+   // consumer only reads the slot indexed by read_index, with slot
+   // ownership handed over exclusively through atomic exchanges on the
+   // latest index, so a slot is never written by one thread while the
+   // other thread uses it.
+   //
+   // NOTE: Like the reflected attributes queue, the snapshot slots are not
+   // checkpointed because Trick can not checkpoint an STL Map of
+   // AttributeHandles and VariableLength values.
+
+   RTI1516_NAMESPACE::AttributeHandleValueMap slots[3]; ///< @trick_io{**} Snapshot slots, one written, one published and one latched.
+
+   std::atomic< unsigned int > latest;                                  ///< @trick_io{**} Published slot index plus the fresh bit, the only state shared between the threads.
+   char                        pad[64 - sizeof( std::atomic< unsigned int > )]; ///< @trick_io{**} Padding to keep the shared index off the thread-private cache line.
+
+   unsigned int write_index; ///< @trick_io{**} Slot the next snapshot is built in, only used by the producer thread.
+   unsigned int read_index;  ///< @trick_io{**} Slot the consumer latched, only used by the consumer thread.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TripleBuffer class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TripleBuffer( TripleBuffer const &rhs );
+   /*! @brief Assignment operator for TripleBuffer class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TripleBuffer &operator=( TripleBuffer const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRIPLE_BUFFER_HH: Do NOT put anything after this line!
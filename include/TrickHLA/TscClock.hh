@@ -0,0 +1,101 @@
+/*!
+@file TrickHLA/TscClock.hh
+@ingroup TrickHLA
+@brief A fast clock source backed by the CPU invariant cycle counter and
+calibrated against CLOCK_MONOTONIC.
+
+A time query reads the CPU cycle counter (TSC on x86, the generic counter
+on aarch64) and scales it with a calibration captured once against
+CLOCK_MONOTONIC and CLOCK_REALTIME, avoiding the clock_gettime call and
+its vDSO jitter on every query. This matters for the spin loops that
+query time millions of times per second. On hardware without an invariant
+cycle counter the queries transparently fall back to clock_gettime.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TscClock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TSC_CLOCK_HH
+#define TRICKHLA_TSC_CLOCK_HH
+
+// System include files.
+#include <cstdint>
+
+namespace TrickHLA
+{
+
+class TscClock
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TscClock();
+
+  public:
+   /*! @brief Detect the invariant cycle counter and calibrate it against
+    * CLOCK_MONOTONIC and CLOCK_REALTIME. Safe to call more than once, a
+    * repeated call recalibrates.
+    *  @return True if the calibrated cycle counter is available. */
+   static bool initialize();
+
+   /*! @brief Query if the calibrated cycle counter is available.
+    *  @return True if initialize() succeeded on this hardware. */
+   static bool is_available();
+
+   /*! @brief Get the monotonic time, from the calibrated cycle counter
+    * when available, otherwise from clock_gettime( CLOCK_MONOTONIC ).
+    *  @return Monotonic time as a count of microseconds. */
+   static int64_t time_in_microseconds();
+
+   /*! @brief Get the realtime (wall clock) time, from the calibrated cycle
+    * counter when available, otherwise from clock_gettime( CLOCK_REALTIME ).
+    *  @return Realtime time as a count of microseconds. */
+   static int64_t realtime_in_microseconds();
+
+   /*! @brief Get the monotonic time in seconds.
+    *  @return Monotonic time in seconds. */
+   static double time_in_seconds();
+
+   /*! @brief Get the realtime (wall clock) time in seconds.
+    *  @return Realtime time in seconds. */
+   static double realtime_in_seconds();
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TscClock class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TscClock( TscClock const &rhs );
+   /*! @brief Assignment operator for TscClock class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TscClock &operator=( TscClock const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TSC_CLOCK_HH: Do NOT put anything after this line!
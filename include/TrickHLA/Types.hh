@@ -38,6 +38,7 @@ NASA, Johnson Space Center\n
 #include <map>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // TrickHLA include files.
@@ -118,8 +119,11 @@ typedef enum {
    ENCODING_ASCII_STRING   = 6, ///< Variable length HLA ASCII string encoding.
    ENCODING_OPAQUE_DATA    = 7, ///< Variable length HLA Opaque data for a "char *" type.
    ENCODING_BOOLEAN        = 8, ///< Boolean c++ type configured in the FOM to use HLAboolean HLA data type encoded as an HLAinteger32BE.
-   ENCODING_NONE           = 9, ///< Fixed length array of data for "char *" type sent as is.
-   ENCODING_LAST_VALUE     = 9  ///< Set to the Last value in the enumeration.
+   ENCODING_NONE           = 9,  ///< Fixed length array of data for "char *" type sent as is.
+   ENCODING_DELTA          = 10, ///< Sparse delta encoding against the last sent value, for large arrays where successive updates differ in a few elements. Data is sent in host byte order so all federates using this attribute must have the same Endianness, and both sides must configure ENCODING_DELTA.
+   ENCODING_CHUNKED        = 11, ///< Chunked streaming encoding for very large values: the raw value bytes are fragmented into bounded chunks sent across consecutive data cycles and reassembled on the receive side, bounding the per-frame cost regardless of the value size. Data is sent in host byte order so all federates using this attribute must have the same Endianness, and both sides must configure ENCODING_CHUNKED.
+   ENCODING_PACKED_BITS    = 12, ///< Packed bitfield encoding for a bool c++ type, packing eight bool values per byte on the wire with element k stored in bit (k modulo 8) of byte (k / 8). The packed bytes have no Endianness, but both sides must configure ENCODING_PACKED_BITS.
+   ENCODING_LAST_VALUE     = 12  ///< Set to the Last value in the enumeration.
 
 } EncodingEnum;
 
@@ -137,6 +141,21 @@ typedef enum {
 
 } TransportationEnum;
 
+/*!
+@enum QueueOverflowPolicyEnum
+@brief Define the policy of a bounded receive queue when a value arrives
+while the queue is at capacity.
+*/
+typedef enum {
+
+   QUEUE_OVERFLOW_FIRST_VALUE      = 0, ///< Set to the First value in the enumeration.
+   QUEUE_OVERFLOW_BLOCK_PRODUCER   = 0, ///< Block the producer until the consumer frees up a slot.
+   QUEUE_OVERFLOW_DROP_OLDEST      = 1, ///< Drop the oldest queued value to make room for the new one.
+   QUEUE_OVERFLOW_OVERWRITE_LATEST = 2, ///< Replace the newest queued value with the new one.
+   QUEUE_OVERFLOW_LAST_VALUE       = 2  ///< Set to the Last value in the enumeration.
+
+} QueueOverflowPolicyEnum;
+
 /*!
 @enum LagCompensationEnum
 @brief Define the TrickHLA latency (lag) compensation type.
@@ -317,7 +336,7 @@ typedef std::queue< RTI1516_NAMESPACE::AttributeHandleValueMap > HLAAttributeMap
 
 typedef std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, std::wstring > TrickHLAObjInstanceNameMap;
 
-typedef std::map< std::string, unsigned int > TrickHLAObjInstanceNameIndexMap;
+typedef std::unordered_map< std::string, unsigned int > TrickHLAObjInstanceNameIndexMap;
 
 typedef std::vector< std::string > VectorOfStrings;
 
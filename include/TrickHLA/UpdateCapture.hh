@@ -0,0 +1,131 @@
+/*!
+@file TrickHLA/UpdateCapture.hh
+@ingroup TrickHLA
+@brief Capture and replay engine for received attribute updates.
+
+When capturing, every attribute update reflected by the RTI is appended as a
+timestamped record to a memory-mapped capture file as it is enqueued for the
+object. A captured stream can later be replayed back through the attribute
+decode path at full speed with no RTI present, which provides a reproducible
+benchmark harness for decode optimizations and a forensic record of what a
+federate actually received in the field.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/UpdateCapture.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_UPDATE_CAPTURE_HH
+#define TRICKHLA_UPDATE_CAPTURE_HH
+
+// System include files.
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+// Forward declarations.
+class Manager;
+class Object;
+
+class UpdateCapture
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__UpdateCapture();
+
+  public:
+   /*! @brief Start capturing received attribute updates to the given file.
+    * Any existing file with the same name is replaced.
+    *  @return True if the capture file was created, false otherwise.
+    *  @param file_name Capture file name. */
+   static bool start( std::string const &file_name );
+
+   /*! @brief Stop capturing, flush the capture file and trim it to its
+    * final size. Safe to call when no capture is active. */
+   static void stop();
+
+   /*! @brief Query if a capture is currently active.
+    *  @return True if a capture is active. */
+   static bool is_active()
+   {
+      return capture_active;
+   }
+
+   /*! @brief Append one timestamped attribute update record for the given
+    * object to the capture file.
+    *  @param obj    The object the attribute values were reflected for.
+    *  @param values The reflected attribute values. */
+   static void record( Object                                           *obj,
+                       RTI1516_NAMESPACE::AttributeHandleValueMap const &values );
+
+   /*! @brief Replay a captured stream back through the attribute decode
+    * path at full speed with no RTI present. Objects and attributes are
+    * matched by name, so the simulation must be configured with the same
+    * objects that were captured.
+    *  @return The number of update records replayed.
+    *  @param file_name Capture file name to replay.
+    *  @param manager   The manager holding the configured objects. */
+   static unsigned long replay( std::string const &file_name,
+                                Manager           *manager );
+
+  private:
+   static bool capture_active; ///< @trick_io{**} True while a capture is active.
+
+   /*! @brief Make sure the memory-mapped capture file has capacity for the
+    * given number of additional bytes, growing the file by whole chunks.
+    *  @return True if the capacity is available, false otherwise.
+    *  @param additional_bytes Number of bytes about to be appended. */
+   static bool ensure_capture_capacity( size_t const additional_bytes );
+
+  private:
+   /*! @brief Constructor for the TrickHLA UpdateCapture class.
+    *  @details This constructor is private because all the functions and
+    *  data of this class are static. */
+   UpdateCapture();
+   /*! @brief Destructor for the TrickHLA UpdateCapture class. */
+   virtual ~UpdateCapture();
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_UPDATE_CAPTURE_HH
@@ -155,17 +155,41 @@ class Utilities
     *  @return Either TRICK_BIG_ENDIAN (char)0x00 or TRICK_LITTLE_ENDIAN (char)0x01 */
    static char const get_endianness()
    {
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_LITTLE_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+      // The host byte order is known at compile time, which lets the
+      // compiler collapse the encode and decode paths that branch on the
+      // endianness down to straight copies. verify_endianness() asserts at
+      // startup that this matches the byte order measured at runtime.
+      return TRICK_LITTLE_ENDIAN;
+#elif defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+      return TRICK_BIG_ENDIAN;
+#else
+      // Fall back to the runtime Trick byte order test when the compiler
+      // does not predefine the byte order macros.
       static char endianness = (char)( std::max( TRICK_LITTLE_ENDIAN, TRICK_BIG_ENDIAN ) + 1 );
       if ( ( endianness != TRICK_LITTLE_ENDIAN ) && ( endianness != TRICK_BIG_ENDIAN ) ) {
          TRICK_GET_BYTE_ORDER( endianness );
       }
       return endianness;
+#endif
    }
 
+   /*! @brief Startup assertion that the byte order returned by
+    * get_endianness() matches the byte order measured at runtime.
+    * Terminates the simulation with an error message on a mismatch. */
+   static void verify_endianness();
+
    /*! @brief Determine if the RTI data needs a byteswap before transmission.
     *  @return True if byteswap is needed.
     *  @param  rti_encoding TrickHLA RTI encoding of the data. */
-   static bool is_transmission_byteswap( EncodingEnum const rti_encoding );
+   static bool is_transmission_byteswap( EncodingEnum const rti_encoding )
+   {
+      char const endianness = Utilities::get_endianness();
+
+      // Check encoding versus Endianness to determine if we need to byteswap.
+      return ( ( ( rti_encoding == ENCODING_BIG_ENDIAN ) && ( endianness == TRICK_LITTLE_ENDIAN ) )
+               || ( ( rti_encoding == ENCODING_LITTLE_ENDIAN ) && ( endianness == TRICK_BIG_ENDIAN ) ) );
+   }
 
    /*! @brief Byteswap an short integer type.
     *  @return Byteswap value.
@@ -221,6 +245,74 @@ class Utilities
     *  @param  input The input value to byteswap. */
    static double byteswap_double( double const input );
 
+   /*! @brief Byteswap an array of 2-byte elements from the source into the
+    *  destination buffer, using SIMD batch kernels when available for the
+    *  target CPU, otherwise a scalar loop.
+    *  @details The source and destination buffers may be the same buffer for
+    *  an in-place byteswap, but must not otherwise overlap.
+    *  @param  dest   Destination buffer, sized for at least length elements.
+    *  @param  src    Source buffer holding length elements to byteswap.
+    *  @param  length The number of 2-byte elements to byteswap. */
+   static void byteswap_2_byte_array( void *dest, void const *src, size_t const length );
+
+   /*! @brief Byteswap an array of 4-byte elements from the source into the
+    *  destination buffer, using SIMD batch kernels when available for the
+    *  target CPU, otherwise a scalar loop.
+    *  @details The source and destination buffers may be the same buffer for
+    *  an in-place byteswap, but must not otherwise overlap.
+    *  @param  dest   Destination buffer, sized for at least length elements.
+    *  @param  src    Source buffer holding length elements to byteswap.
+    *  @param  length The number of 4-byte elements to byteswap. */
+   static void byteswap_4_byte_array( void *dest, void const *src, size_t const length );
+
+   /*! @brief Byteswap an array of 8-byte elements from the source into the
+    *  destination buffer, using SIMD batch kernels when available for the
+    *  target CPU, otherwise a scalar loop.
+    *  @details The source and destination buffers may be the same buffer for
+    *  an in-place byteswap, but must not otherwise overlap.
+    *  @param  dest   Destination buffer, sized for at least length elements.
+    *  @param  src    Source buffer holding length elements to byteswap.
+    *  @param  length The number of 8-byte elements to byteswap. */
+   static void byteswap_8_byte_array( void *dest, void const *src, size_t const length );
+
+   /*! @brief Pack an array of 1-byte bool elements into a bitfield with
+    *  eight elements per byte, element k stored in bit (k modulo 8) of byte
+    *  (k / 8), using SIMD batch kernels when available for the target CPU,
+    *  otherwise a scalar loop.
+    *  @details The source and destination buffers must not overlap.
+    *  @param  dest   Destination buffer, sized for at least ( length + 7 ) / 8 bytes.
+    *  @param  src    Source buffer holding length bool elements to pack.
+    *  @param  length The number of bool elements to pack. */
+   static void pack_bool_array_to_bits( void *dest, void const *src, size_t const length );
+
+   /*! @brief Unpack a bitfield holding eight elements per byte into an array
+    *  of 1-byte bool elements, element k taken from bit (k modulo 8) of byte
+    *  (k / 8), using SIMD batch kernels when available for the target CPU,
+    *  otherwise a scalar loop.
+    *  @details The source and destination buffers must not overlap.
+    *  @param  dest   Destination buffer, sized for at least length bool elements.
+    *  @param  src    Source buffer holding at least ( length + 7 ) / 8 packed bytes.
+    *  @param  length The number of bool elements to unpack. */
+   static void unpack_bits_to_bool_array( void *dest, void const *src, size_t const length );
+
+   /*! @brief Widen an array of 8-bit characters into Big Endian UTF-16 code
+    *  units, using SIMD batch kernels when available for the target CPU,
+    *  otherwise a scalar loop.
+    *  @details The source and destination buffers must not overlap.
+    *  @param  dest   Destination buffer, sized for at least 2 * length bytes.
+    *  @param  src    Source buffer holding length characters to widen.
+    *  @param  length The number of characters to widen. */
+   static void ascii_to_utf16_be( void *dest, void const *src, size_t const length );
+
+   /*! @brief Narrow an array of Big Endian UTF-16 code units into 8-bit
+    *  characters by keeping the low byte of each code unit, using SIMD batch
+    *  kernels when available for the target CPU, otherwise a scalar loop.
+    *  @details The source and destination buffers must not overlap.
+    *  @param  dest   Destination buffer, sized for at least length bytes.
+    *  @param  src    Source buffer holding length UTF-16 code units to narrow.
+    *  @param  length The number of characters to narrow. */
+   static void utf16_be_to_ascii( void *dest, void const *src, size_t const length );
+
    /*! @brief Round to the next positive multiple of 8.
     *  @return The value rounded to the next positive multiple of 8.
     *  @param  value The value to round to next positive multiple of 8. */
@@ -239,6 +331,11 @@ class Utilities
     *  @param  usec Time to sleep in microseconds. */
    static int micro_sleep( long const usec );
 
+   /*! @brief Issue a processor pause/yield hint for use in busy-wait spin
+    *  loops to reduce power usage and free up pipeline resources for the
+    *  sibling hyper-thread. Compiles to a no-op on unsupported platforms. */
+   static void processor_pause();
+
    /*! @brief Return the current TrickHLA version string from the auto
     *  generated Version.hh header file.
     *  @return Byteswap value. */
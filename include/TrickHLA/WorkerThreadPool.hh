@@ -0,0 +1,128 @@
+/*!
+@file TrickHLA/WorkerThreadPool.hh
+@ingroup TrickHLA
+@brief A small persistent pool of worker threads that queued jobs are posted to.
+
+Replaces the spawn-a-detached-pthread-per-job pattern for short-lived jobs,
+such as the ownership transfer transactions, so each job reuses a warm
+thread and stack instead of paying thread creation and page-fault warmup.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/WorkerThreadPool.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_WORKER_THREAD_POOL_HH
+#define TRICKHLA_WORKER_THREAD_POOL_HH
+
+// System include files.
+#include <pthread.h>
+
+namespace TrickHLA
+{
+
+class WorkerThreadPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__WorkerThreadPool();
+
+  public:
+   /*! @brief Function signature of a job posted to the pool, matching the
+    *  pthread start routine signature so existing thread functions can be
+    *  posted unchanged. The return value is ignored. */
+   typedef void *( *JobFn )( void *arg );
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA WorkerThreadPool class. */
+   WorkerThreadPool();
+
+   /*! @brief Destructor for the TrickHLA WorkerThreadPool class. */
+   virtual ~WorkerThreadPool();
+
+  public:
+   /*! @brief Post a job to the pool, creating the worker threads on first
+    *  use. Blocks if the bounded job queue is full until a slot opens up.
+    *  @return True if the job was queued, false if the pool is shut down.
+    *  @param job Job function to run on a worker thread.
+    *  @param arg Argument passed to the job function. */
+   bool post( JobFn job, void *arg );
+
+   /*! @brief Shutdown the pool, waiting for the queued jobs to finish and
+    *  joining the worker threads. */
+   void shutdown();
+
+  private:
+   static unsigned int const THREAD_COUNT   = 2;  ///< Number of persistent worker threads.
+   static unsigned int const QUEUE_CAPACITY = 32; ///< Bounded job queue capacity.
+
+   pthread_mutex_t mutex;         ///< @trick_io{**} Mutex protecting the job queue state.
+   pthread_cond_t  job_available; ///< @trick_io{**} Condition signaled when a job is queued.
+   pthread_cond_t  slot_available; ///< @trick_io{**} Condition signaled when a queue slot opens up.
+
+   JobFn jobs[QUEUE_CAPACITY];     ///< @trick_io{**} Ring of queued job functions.
+   void *job_args[QUEUE_CAPACITY]; ///< @trick_io{**} Ring of queued job arguments.
+
+   unsigned int job_head;  ///< @trick_io{**} Index of the next job to take.
+   unsigned int job_count; ///< @trick_io{**} Number of queued jobs.
+
+   pthread_t    threads[THREAD_COUNT]; ///< @trick_io{**} Persistent worker threads.
+   unsigned int thread_cnt;            ///< @trick_io{**} Number of worker threads created.
+
+   bool shutdown_requested; ///< @trick_io{**} True when the pool is shutting down.
+
+  private:
+   /*! @brief Create the persistent worker threads. The caller must hold the
+    *  pool mutex. */
+   void create_threads();
+
+   /*! @brief Worker thread entry point.
+    *  @return Always NULL.
+    *  @param arg Pointer to the WorkerThreadPool instance. */
+   static void *worker_entry( void *arg );
+
+   /*! @brief Worker thread loop that takes and runs queued jobs. */
+   void worker_loop();
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for WorkerThreadPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   WorkerThreadPool( WorkerThreadPool const &rhs );
+   /*! @brief Assignment operator for WorkerThreadPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   WorkerThreadPool &operator=( WorkerThreadPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_WORKER_THREAD_POOL_HH: Do NOT put anything after this line!
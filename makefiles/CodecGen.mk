@@ -0,0 +1,43 @@
+#=============================================================================
+# FOM-driven compile-time codec generation.
+#
+# Include this fragment from a simulation S_overrides.mk to generate
+# specialized fixed-layout pack/unpack codec classes from the federation
+# FOM modules and a Trick variable binding manifest. The generated classes
+# plug in through the TrickHLA::Packing interface and replace the generic
+# per-attribute reflection encode path for stable FOMs.
+#
+# The simulation provides:
+#    TRICKHLA_CODEC_MANIFEST - JSON binding manifest (see the documentation
+#                              in scripts/generate_fom_codecs.py).
+#    TRICKHLA_CODEC_FOM_DIR  - Directory of FOM module XML files,
+#                              default: ${TRICKHLA_HOME}/FOMs/SpaceFOM.
+#    TRICKHLA_CODEC_OUTPUT   - Directory the generated sources are written
+#                              under, default: ./generated.
+#
+# Add ${TRICKHLA_CODEC_OUTPUT} to TRICK_CFLAGS/TRICK_CXXFLAGS include paths
+# and reference the generated classes from the S_define so Trick compiles
+# them into the simulation.
+#=============================================================================
+TRICKHLA_HOME ?= ${MODEL_PACKAGE_HOME}/TrickHLA
+
+TRICKHLA_CODEC_FOM_DIR ?= ${TRICKHLA_HOME}/FOMs/SpaceFOM
+TRICKHLA_CODEC_OUTPUT  ?= ./generated
+
+ifeq ("$(wildcard ${TRICKHLA_HOME})","")
+   $(error CodecGen.mk:ERROR: Must specify a valid TRICKHLA_HOME environment variable, which is currently set to invalid path ${TRICKHLA_HOME})
+endif
+
+.PHONY: fom_codecs clean_fom_codecs
+
+fom_codecs:
+ifndef TRICKHLA_CODEC_MANIFEST
+	$(error CodecGen.mk:ERROR: Must specify a TRICKHLA_CODEC_MANIFEST binding manifest to generate codecs)
+endif
+	python3 ${TRICKHLA_HOME}/scripts/generate_fom_codecs.py \
+	   --manifest ${TRICKHLA_CODEC_MANIFEST} \
+	   --fom-dir ${TRICKHLA_CODEC_FOM_DIR} \
+	   --output-dir ${TRICKHLA_CODEC_OUTPUT}
+
+clean_fom_codecs:
+	rm -rf ${TRICKHLA_CODEC_OUTPUT}
@@ -0,0 +1,138 @@
+/**
+@file models/EntityDynamics/include/MultiEntityDynamics.hh
+@ingroup SpaceFOM
+@brief A class to propagate many SpaceFOM PhysicalEntity instances together
+for large entity count scaling tests.
+
+Where the EntityDynamics model propagates a single entity per instance,
+this model holds the positions, velocities, attitude quaternions and
+angular velocities of all the entities in structure-of-arrays working
+arrays and advances them with flat propagation loops the compiler can
+vectorize, so a single model instance can generate a realistic publisher
+load of hundreds or thousands of entities.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/QuaternionData.cpp}
+@trick_link_dependency{../src/MultiEntityDynamics.cpp}
+
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_MULTI_ENTITY_DYNAMICS_HH
+#define SPACEFOM_MULTI_ENTITY_DYNAMICS_HH
+
+// System includes.
+#include <vector>
+
+// SpaceFOM includes.
+#include "SpaceFOM/PhysicalEntityData.hh"
+
+namespace SpaceFOM
+{
+
+class MultiEntityDynamics
+{
+
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__MultiEntityDynamics();
+
+  public:
+   // Public constructors and destructors.
+   explicit MultiEntityDynamics(); // Default constructor.
+   virtual ~MultiEntityDynamics(); // Destructor.
+
+   void default_data();
+
+   void initialize();
+
+   /*! @brief Set the number of entities to propagate, call from the input
+    *  file before initialize().
+    *  @param count Number of entities. */
+   void set_entity_count( int count );
+
+   /*! @brief Get the number of entities being propagated.
+    *  @return Number of entities. */
+   int get_entity_count() const
+   {
+      return ( (int)entity_data.size() );
+   }
+
+   /*! @brief Get the propagation data for an entity, for wiring an entity
+    *  into a SpaceFOM PhysicalEntity publisher.
+    *  @param index Entity index.
+    *  @return Reference to the entity propagation data. */
+   PhysicalEntityData &get_entity_data( int index )
+   {
+      return ( entity_data[index] );
+   }
+
+   /*! @brief Propagate all the entities' states forward by one time step.
+    *  @param dt Propagation time step. */
+   void propagate( double dt );
+
+  public:
+   std::vector< PhysicalEntityData > entity_data; ///< @trick_io{**} Entity propagation data, one entry per entity.
+
+  protected:
+   /*! @brief Gather the entity states into the structure-of-arrays
+    *  working arrays. */
+   void load();
+
+   /*! @brief Scatter the structure-of-arrays working arrays back into the
+    *  entity states. */
+   void unload();
+
+   /*! @brief Compute the attitude quaternion rates for all the entities. */
+   void derivative();
+
+  protected:
+   // Structure-of-arrays working state, one entry per entity.
+   std::vector< double > pos[3];     ///< @trick_io{**} Entity positions.
+   std::vector< double > vel[3];     ///< @trick_io{**} Entity velocities.
+   std::vector< double > acc[3];     ///< @trick_io{**} Entity accelerations.
+   std::vector< double > att_s;      ///< @trick_io{**} Entity attitude quaternion scalars.
+   std::vector< double > att_v[3];   ///< @trick_io{**} Entity attitude quaternion vectors.
+   std::vector< double > qdot_s;     ///< @trick_io{**} Entity attitude quaternion rate scalars.
+   std::vector< double > qdot_v[3];  ///< @trick_io{**} Entity attitude quaternion rate vectors.
+   std::vector< double > ang_vel[3]; ///< @trick_io{**} Entity angular velocities.
+   std::vector< double > ang_acc[3]; ///< @trick_io{**} Entity angular accelerations.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for MultiEntityDynamics class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MultiEntityDynamics( MultiEntityDynamics const &rhs );
+   /*! @brief Assignment operator for MultiEntityDynamics class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MultiEntityDynamics &operator=( MultiEntityDynamics const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_MULTI_ENTITY_DYNAMICS_HH: Do NOT put anything after this line!
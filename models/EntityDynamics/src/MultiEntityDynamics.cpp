@@ -0,0 +1,225 @@
+/*!
+@file models/EntityDynamics/src/MultiEntityDynamics.cpp
+@ingroup SpaceFOM
+@brief A class to propagate many SpaceFOM PhysicalEntity instances together
+for large entity count scaling tests.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/QuaternionData.cpp}
+@trick_link_dependency{MultiEntityDynamics.cpp}
+
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System includes.
+#include <vector>
+
+// Model includes.
+#include "../include/MultiEntityDynamics.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+MultiEntityDynamics::MultiEntityDynamics() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+MultiEntityDynamics::~MultiEntityDynamics() // RETURN: -- None.
+{
+   return;
+}
+
+void MultiEntityDynamics::default_data()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void MultiEntityDynamics::initialize()
+{
+   // An unconfigured instance propagates nothing, which keeps the model
+   // benign in sims that only enable it for scaling test runs.
+
+   // Make sure every entity starts with a unit attitude quaternion.
+   for ( size_t einc = 0; einc < entity_data.size(); ++einc ) {
+      entity_data[einc].state.att.normalize();
+   }
+
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void MultiEntityDynamics::set_entity_count(
+   int count )
+{
+   // Zero initialized entity data with an identity attitude quaternion,
+   // the initial states are then set from the input file.
+   PhysicalEntityData initial_data = PhysicalEntityData();
+   initial_data.state.att.scalar   = 1.0;
+
+   entity_data.assign( (size_t)count, initial_data );
+
+   // Size the structure-of-arrays working state for the entity count.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      pos[iinc].resize( (size_t)count );
+      vel[iinc].resize( (size_t)count );
+      acc[iinc].resize( (size_t)count );
+      att_v[iinc].resize( (size_t)count );
+      qdot_v[iinc].resize( (size_t)count );
+      ang_vel[iinc].resize( (size_t)count );
+      ang_acc[iinc].resize( (size_t)count );
+   }
+   att_s.resize( (size_t)count );
+   qdot_s.resize( (size_t)count );
+
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void MultiEntityDynamics::load()
+{
+   // Gather the entity states into the structure-of-arrays working state.
+   for ( size_t einc = 0; einc < entity_data.size(); ++einc ) {
+      PhysicalEntityData const &entity = entity_data[einc];
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         pos[iinc][einc]     = entity.state.pos[iinc];
+         vel[iinc][einc]     = entity.state.vel[iinc];
+         acc[iinc][einc]     = entity.accel[iinc];
+         att_v[iinc][einc]   = entity.state.att.vector[iinc];
+         ang_vel[iinc][einc] = entity.state.ang_vel[iinc];
+         ang_acc[iinc][einc] = entity.ang_accel[iinc];
+      }
+      att_s[einc] = entity.state.att.scalar;
+   }
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void MultiEntityDynamics::unload()
+{
+   // Scatter the structure-of-arrays working state back into the entities.
+   for ( size_t einc = 0; einc < entity_data.size(); ++einc ) {
+      PhysicalEntityData &entity = entity_data[einc];
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         entity.state.pos[iinc]        = pos[iinc][einc];
+         entity.state.vel[iinc]        = vel[iinc][einc];
+         entity.state.att.vector[iinc] = att_v[iinc][einc];
+         entity.state.ang_vel[iinc]    = ang_vel[iinc][einc];
+      }
+      entity.state.att.scalar = att_s[einc];
+
+      // Normalize the propagated attitude quaternion.
+      entity.state.att.normalize();
+   }
+   return;
+}
+
+/*!
+ * @details Computes the attitude quaternion rates for all the entities in
+ * flat component loops over the structure-of-arrays working state.
+ *
+ * @job_class{derivative}
+ */
+void MultiEntityDynamics::derivative()
+{
+   size_t const num_entities = entity_data.size();
+
+   double const *qs = &att_s[0];
+   double const *qx = &att_v[0][0];
+   double const *qy = &att_v[1][0];
+   double const *qz = &att_v[2][0];
+   double const *wx = &ang_vel[0][0];
+   double const *wy = &ang_vel[1][0];
+   double const *wz = &ang_vel[2][0];
+
+   for ( size_t einc = 0; einc < num_entities; ++einc ) {
+      qdot_s[einc]    = ( ( qx[einc] * wx[einc] ) + ( qy[einc] * wy[einc] ) + ( qz[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[0][einc] = ( ( -qs[einc] * wx[einc] ) + ( -qz[einc] * wy[einc] ) + ( qy[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[1][einc] = ( ( qz[einc] * wx[einc] ) + ( -qs[einc] * wy[einc] ) + ( -qx[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[2][einc] = ( ( -qy[einc] * wx[einc] ) + ( qx[einc] * wy[einc] ) + ( -qs[einc] * wz[einc] ) ) * 0.5;
+   }
+   return;
+}
+
+/*!
+ * @details First order propagation of all the entities' states under the
+ * entities' constant accelerations, one flat loop per state component so
+ * the compiler can vectorize over the entities.
+ *
+ * @job_class{scheduled}
+ */
+void MultiEntityDynamics::propagate(
+   double dt )
+{
+   size_t const num_entities = entity_data.size();
+
+   if ( num_entities == 0 ) {
+      return;
+   }
+
+   // Gather the entity states into the structure-of-arrays working state.
+   load();
+
+   // Compute the attitude quaternion rates for all the entities.
+   derivative();
+
+   // Euler propagation, one flat loop per state component.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double       *p  = &pos[iinc][0];
+      double       *v  = &vel[iinc][0];
+      double const *a  = &acc[iinc][0];
+      double       *qv = &att_v[iinc][0];
+      double const *qd = &qdot_v[iinc][0];
+      double       *w  = &ang_vel[iinc][0];
+      double const *wd = &ang_acc[iinc][0];
+
+      for ( size_t einc = 0; einc < num_entities; ++einc ) {
+         p[einc] += v[einc] * dt;
+         v[einc] += a[einc] * dt;
+         qv[einc] += qd[einc] * dt;
+         w[einc] += wd[einc] * dt;
+      }
+   }
+   for ( size_t einc = 0; einc < num_entities; ++einc ) {
+      att_s[einc] += qdot_s[einc] * dt;
+   }
+
+   // Scatter the propagated states back into the entities.
+   unload();
+
+   return;
+}
@@ -0,0 +1,187 @@
+/*!
+@file models/SAIntegrator/include/PhysicalEntityLagCompBatchSA.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM physical entity batched
+latency/lag compensation class that uses the batched Stand-Alone (SA)
+style integrators.
+
+Instead of each entity stepping its own Stand-Alone integrator, the
+registered entities' states are advanced together by a batch integrator
+with structure-of-arrays working storage, so every integration stage is a
+set of flat loops over all the entities that the compiler can vectorize.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../../source/SpaceFOM/GpuBatchCompute.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../src/PhysicalEntityLagCompBatchSA.cpp}
+@trick_link_dependency{../src/SABatchIntegrator.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_SA_HH
+#define SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_SA_HH
+
+// System include files.
+#include <cstddef>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/LagCompensationIntegBase.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+
+// Model include files.
+#include "SABatchIntegrator.hh"
+
+namespace SpaceFOM
+{
+
+class PhysicalEntityLagCompBatchSA : public TrickHLA::LagCompensationIntegBase
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalEntityLagCompBatchSA();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the SpaceFOM PhysicalEntityLagCompBatchSA class. */
+   PhysicalEntityLagCompBatchSA();
+   /*! @brief Destructor for the SpaceFOM PhysicalEntityLagCompBatchSA class. */
+   virtual ~PhysicalEntityLagCompBatchSA();
+
+   /*! @brief Batch engine initialization routine, call after all the
+    *  entities have been registered with add_entity(). */
+   virtual void initialize();
+
+   /*! @brief Register an entity lag compensation instance with the batch
+    *  integration engine, must be called before initialize().
+    *  @param lag_comp Entity lag compensation instance to register. */
+   void add_entity( PhysicalEntityLagCompBase &lag_comp );
+
+   /*! @brief Get the number of registered entities.
+    *  @return Number of registered entities. */
+   unsigned int get_entity_count() const
+   {
+      return ( (unsigned int)entities.size() );
+   }
+
+   /*! @brief Compensate all the registered entities' states from the data
+    *  time to the current scenario time in one batched integration pass.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   int compensate( double const t_begin, double const t_end )
+   {
+      return ( integrate( t_begin, t_end ) );
+   }
+
+  public:
+   bool use_rk2_integ; ///< @trick_units{--} False (default) to use the batched Euler integrator matching the per-entity Stand-Alone path; true to use the batched midpoint (RK2) integrator.
+
+  protected:
+   /*! @brief Batched derivative routine used by the batch integrator,
+    *  component major structure-of-arrays layout.
+    *  @param t             Integration time (IN).
+    *  @param num_instances Number of registered entities (IN).
+    *  @param states        Integration states, component major (IN).
+    *  @param derivs        Derivatives of the integration states, component major (OUT).
+    *  @param udata         The PhysicalEntityLagCompBatchSA instance (IN). */
+   static void derivatives( double        t,
+                            int           num_instances,
+                            double const *states,
+                            double       *derivs,
+                            void         *udata );
+
+   /*! @brief Update the latency compensation time for all the registered
+    *  entities from the integrator. */
+   virtual void update_time();
+
+   /*! @brief Load the registered entities' states into the batch integrator. */
+   virtual void load();
+
+   /*! @brief Unload the registered entities' states from the batch integrator. */
+   virtual void unload();
+
+   /*! @brief Compute the first time derivative of the lag compensation
+    *  state vector for all the registered entities.
+    *  @param user_data Any special user data needed to compute the derivative values. */
+   virtual void derivative_first( void *user_data = NULL );
+
+   /*! @brief Compute the second time derivative of the lag compensation
+    *  state vector.
+    *  @details This function is called for second order integrators to compute
+    *  second time derivative of the state vector.
+    *  @param user_data Any special user data needed to compute the derivative values. */
+   virtual void derivative_second( void *user_data = NULL ) { return; }
+
+   /*! @brief Compensate all the registered entities' states from the data
+    *  time to the current scenario time.
+    *  @details When a GPU compute device is available and the registered
+    *  entity count meets the GpuBatchCompute offload threshold, the whole
+    *  propagation is offloaded through integrate_gpu(), otherwise the CPU
+    *  batch integrator is used.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int integrate( double const t_begin, double const t_end );
+
+   /*! @brief Compensate all the registered entities' states on the GPU.
+    *  @details Gathers the entity states and accelerations into the pinned
+    *  staging buffer, runs the whole sub-step propagation loop on the
+    *  device and scatters the results back.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step.
+    *  @return True on success, false if the caller must fall back to the
+    *  CPU batch integrator. */
+   bool integrate_gpu( double const t_begin, double const t_end );
+
+  protected:
+   std::vector< PhysicalEntityLagCompBase * > entities; ///< @trick_io{**} Registered entity lag compensation instances.
+
+   std::vector< double * > state_refs; ///< @trick_io{**} Integration state references, thirteen per entity in the Stand-Alone state order.
+   std::vector< double >   acc[3];     ///< @trick_io{**} Entity translational accelerations.
+   std::vector< double >   ang_acc[3]; ///< @trick_io{**} Entity rotational accelerations.
+
+   SABatchIntegrator *integrator; ///< @trick_io{**} Batch integrator, allocated by initialize().
+
+   double *gpu_staging;      ///< @trick_io{**} Host-device staging buffer for the GPU offload path, page-locked (pinned) when a device is available.
+   size_t  gpu_staging_size; ///< @trick_io{**} Size of the staging buffer in doubles.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalEntityLagCompBatchSA class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompBatchSA( PhysicalEntityLagCompBatchSA const &rhs );
+   /*! @brief Assignment operator for PhysicalEntityLagCompBatchSA class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalEntityLagCompBatchSA &operator=( PhysicalEntityLagCompBatchSA const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_ENTITY_LAG_COMP_BATCH_SA_HH: Do NOT put anything after this line!
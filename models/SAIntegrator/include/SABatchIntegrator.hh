@@ -0,0 +1,215 @@
+/*!
+@file models/SAIntegrator/include/SABatchIntegrator.hh
+@ingroup SpaceFOM
+@brief Definition of the batched Stand-Alone (SA) style integrators that
+advance many independent state vectors simultaneously.
+
+Where the Trick Stand-Alone integrators step one state vector per instance
+through scalar stage loops, these batch integrators hold the states of all
+the instances in structure-of-arrays working storage, component major, so
+every integration stage is a flat loop over the instances that the
+compiler can vectorize.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../src/SABatchIntegrator.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_SA_BATCH_INTEGRATOR_HH
+#define SPACEFOM_SA_BATCH_INTEGRATOR_HH
+
+// System include files.
+#include <vector>
+
+namespace SpaceFOM
+{
+
+/*! @brief Batched derivative routine.
+ *
+ * The states and derivatives use the component major structure-of-arrays
+ * layout, where state component s of instance k is states[ ( s * num_instances ) + k ],
+ * so the routine can compute each component for all the instances in a
+ * flat loop.
+ *
+ *  @param t             Integration time (IN).
+ *  @param num_instances Number of state vector instances (IN).
+ *  @param states        Integration states, component major (IN).
+ *  @param derivs        Derivatives of the integration states, component major (OUT).
+ *  @param udata         Additional user data needed to compute the derivatives (IN). */
+typedef void ( *BatchDerivsFunc )( double       t,
+                                   int          num_instances,
+                                   double const *states,
+                                   double       *derivs,
+                                   void         *udata );
+
+class SABatchIntegrator
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__SABatchIntegrator();
+
+  public:
+   /*! @brief Initialization constructor.
+    *  @param dt            Default integration time step.
+    *  @param num_states    Number of state components per instance.
+    *  @param num_instances Number of state vector instances.
+    *  @param state_refs    Instance major pointer table into the instance
+    *                       states, where state component s of instance k is
+    *                       state_refs[ ( k * num_states ) + s ].
+    *  @param derivs_func   Batched derivative routine.
+    *  @param udata         Additional user data passed to the derivative routine. */
+   SABatchIntegrator( double          dt,
+                      int             num_states,
+                      int             num_instances,
+                      double        **state_refs,
+                      BatchDerivsFunc derivs_func,
+                      void           *udata );
+   virtual ~SABatchIntegrator(); // Destructor.
+
+   /*! @brief Gather the instance states through the state reference table
+    *  into the structure-of-arrays working storage. */
+   void load();
+
+   /*! @brief Scatter the structure-of-arrays working storage back through
+    *  the state reference table into the instance states. */
+   void unload();
+
+   /*! @brief Advance all the instance states by one integration step.
+    *  @param dt Integration time step. */
+   virtual void variable_step( double dt ) = 0;
+
+   /*! @brief Advance all the instance states by the default time step. */
+   void step() { variable_step( this->default_dt ); }
+
+   /*! @brief Set the integrator independent variable (time).
+    *  @param v Independent variable value. */
+   void setIndyVar( double v ) { this->indy_var = v; }
+
+   /*! @brief Get the integrator independent variable (time).
+    *  @return Independent variable value. */
+   double getIndyVar() const { return this->indy_var; }
+
+   /*! @brief Get the number of state vector instances.
+    *  @return Number of state vector instances. */
+   int get_num_instances() const { return this->num_instances; }
+
+  protected:
+   double          default_dt;    ///< @trick_units{s} Default integration time step.
+   int             num_states;    ///< @trick_units{--} Number of state components per instance.
+   int             num_instances; ///< @trick_units{--} Number of state vector instances.
+   double        **state_refs;    ///< @trick_io{**} Instance major pointer table into the instance states.
+   BatchDerivsFunc derivs_func;   ///< @trick_io{**} Batched derivative routine.
+   void           *udata;         ///< @trick_io{**} User data passed to the derivative routine.
+   double          indy_var;      ///< @trick_units{s} Integrator independent variable (time).
+
+   std::vector< double > states; ///< @trick_io{**} Integration states, component major.
+   std::vector< double > derivs; ///< @trick_io{**} State derivatives, component major.
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for SABatchIntegrator class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SABatchIntegrator( SABatchIntegrator const &rhs );
+   /*! @brief Assignment operator for SABatchIntegrator class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SABatchIntegrator &operator=( SABatchIntegrator const &rhs );
+};
+
+class SABatchEulerIntegrator : public SABatchIntegrator
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__SABatchEulerIntegrator();
+
+  public:
+   /*! @brief Initialization constructor.
+    *  @param dt            Default integration time step.
+    *  @param num_states    Number of state components per instance.
+    *  @param num_instances Number of state vector instances.
+    *  @param state_refs    Instance major pointer table into the instance states.
+    *  @param derivs_func   Batched derivative routine.
+    *  @param udata         Additional user data passed to the derivative routine. */
+   SABatchEulerIntegrator( double          dt,
+                           int             num_states,
+                           int             num_instances,
+                           double        **state_refs,
+                           BatchDerivsFunc derivs_func,
+                           void           *udata );
+   virtual ~SABatchEulerIntegrator(); // Destructor.
+
+   /*! @brief Advance all the instance states by one Euler step.
+    *  @param dt Integration time step. */
+   virtual void variable_step( double dt );
+};
+
+class SABatchRK2Integrator : public SABatchIntegrator
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__SABatchRK2Integrator();
+
+  public:
+   /*! @brief Initialization constructor.
+    *  @param dt            Default integration time step.
+    *  @param num_states    Number of state components per instance.
+    *  @param num_instances Number of state vector instances.
+    *  @param state_refs    Instance major pointer table into the instance states.
+    *  @param derivs_func   Batched derivative routine.
+    *  @param udata         Additional user data passed to the derivative routine. */
+   SABatchRK2Integrator( double          dt,
+                         int             num_states,
+                         int             num_instances,
+                         double        **state_refs,
+                         BatchDerivsFunc derivs_func,
+                         void           *udata );
+   virtual ~SABatchRK2Integrator(); // Destructor.
+
+   /*! @brief Advance all the instance states by one midpoint (RK2) step.
+    *  @param dt Integration time step. */
+   virtual void variable_step( double dt );
+
+  protected:
+   std::vector< double > states_0; ///< @trick_io{**} Step start states, component major.
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_SA_BATCH_INTEGRATOR_HH: Do NOT put anything after this line!
@@ -0,0 +1,427 @@
+/*!
+@file models/SAIntegrator/src/PhysicalEntityLagCompBatchSA.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+physical entity batched latency/lag compensation class that uses the
+batched Stand-Alone (SA) style integrators.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/SpaceFOM/GpuBatchCompute.cpp}
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{PhysicalEntityLagCompBatchSA.cpp}
+@trick_link_dependency{SABatchIntegrator.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/message_proto.h" // for send_hs
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/GpuBatchCompute.hh"
+
+// Model include files.
+#include "../include/PhysicalEntityLagCompBatchSA.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityLagCompBatchSA::PhysicalEntityLagCompBatchSA() // RETURN: -- None.
+   : TrickHLA::LagCompensationIntegBase(),
+     use_rk2_integ( false ),
+     integrator( NULL ),
+     gpu_staging( NULL ),
+     gpu_staging_size( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityLagCompBatchSA::~PhysicalEntityLagCompBatchSA() // RETURN: -- None.
+{
+   if ( integrator != NULL ) {
+      delete integrator;
+      integrator = NULL;
+   }
+   if ( gpu_staging != NULL ) {
+      GpuBatchCompute::free_staging( gpu_staging );
+      gpu_staging      = NULL;
+      gpu_staging_size = 0;
+   }
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityLagCompBatchSA::initialize()
+{
+   // Allocate the batch integrator for the registered entity count. The
+   // state reference table is complete once all the entities have been
+   // registered with add_entity().
+   double **refs = state_refs.empty() ? NULL : &state_refs[0];
+   if ( use_rk2_integ ) {
+      integrator = new SABatchRK2Integrator( this->integ_dt, 13, (int)entities.size(),
+                                             refs, this->derivatives, this );
+   } else {
+      integrator = new SABatchEulerIntegrator( this->integ_dt, 13, (int)entities.size(),
+                                               refs, this->derivatives, this );
+   }
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityLagCompBatchSA::add_entity(
+   PhysicalEntityLagCompBase &lag_comp )
+{
+   if ( integrator != NULL ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityLagCompBatchSA::add_entity():" << __LINE__
+             << " ERROR: Entities must be registered before initialize() is"
+             << " called, the batch integrator has already been sized!"
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   entities.push_back( &lag_comp );
+
+   // Append the entity's integration state references in the Stand-Alone
+   // state order used by the per-entity PhysicalEntityLagCompSA class.
+   // Translational position
+   state_refs.push_back( &( lag_comp.lag_comp_data.pos[0] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.pos[1] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.pos[2] ) );
+   // Rotational position
+   state_refs.push_back( &( lag_comp.lag_comp_data.att.scalar ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.att.vector[0] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.att.vector[1] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.att.vector[2] ) );
+   // Translational velocity
+   state_refs.push_back( &( lag_comp.lag_comp_data.vel[0] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.vel[1] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.vel[2] ) );
+   // Rotational velocity
+   state_refs.push_back( &( lag_comp.lag_comp_data.ang_vel[0] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.ang_vel[1] ) );
+   state_refs.push_back( &( lag_comp.lag_comp_data.ang_vel[2] ) );
+
+   // Size the acceleration structure-of-arrays working state.
+   size_t const num_entities = entities.size();
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      acc[iinc].resize( num_entities );
+      ang_acc[iinc].resize( num_entities );
+   }
+   return;
+}
+
+/*!
+ * @details Computes the derivatives for all the registered entities in
+ * flat component loops over the structure-of-arrays states: the position
+ * rates are the velocities, the attitude quaternion rates come from the
+ * attitudes and the angular velocities, and the accelerations are the
+ * entities' constant translational and rotational accelerations.
+ *
+ * @job_class{derivative}
+ */
+void PhysicalEntityLagCompBatchSA::derivatives(
+   double        t,
+   int           num_instances,
+   double const *states,
+   double       *derivs,
+   void         *udata )
+{
+   size_t const K = (size_t)num_instances;
+
+   // Cast the user data to a PhysicalEntityLagCompBatchSA instance.
+   PhysicalEntityLagCompBatchSA *batch = static_cast< PhysicalEntityLagCompBatchSA * >( udata );
+
+   // Component major state rows in the Stand-Alone state order.
+   double const *qs = &states[3 * K];
+   double const *qx = &states[4 * K];
+   double const *qy = &states[5 * K];
+   double const *qz = &states[6 * K];
+   double const *wx = &states[10 * K];
+   double const *wy = &states[11 * K];
+   double const *wz = &states[12 * K];
+
+   // Translational velocity.
+   for ( size_t k = 0; k < ( 3 * K ); ++k ) {
+      derivs[k] = states[( 7 * K ) + k];
+   }
+
+   // Rotational velocity in quaternion form.
+   double *qdot_s = &derivs[3 * K];
+   double *qdot_x = &derivs[4 * K];
+   double *qdot_y = &derivs[5 * K];
+   double *qdot_z = &derivs[6 * K];
+   for ( size_t k = 0; k < K; ++k ) {
+      qdot_s[k] = ( ( qx[k] * wx[k] ) + ( qy[k] * wy[k] ) + ( qz[k] * wz[k] ) ) * 0.5;
+      qdot_x[k] = ( ( -qs[k] * wx[k] ) + ( -qz[k] * wy[k] ) + ( qy[k] * wz[k] ) ) * 0.5;
+      qdot_y[k] = ( ( qz[k] * wx[k] ) + ( -qs[k] * wy[k] ) + ( -qx[k] * wz[k] ) ) * 0.5;
+      qdot_z[k] = ( ( -qy[k] * wx[k] ) + ( qx[k] * wy[k] ) + ( -qs[k] * wz[k] ) ) * 0.5;
+   }
+
+   // Translational and rotational acceleration.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double const *a  = &( batch->acc[iinc][0] );
+      double const *wd = &( batch->ang_acc[iinc][0] );
+      double       *dv = &derivs[( 7 + iinc ) * K];
+      double       *dw = &derivs[( 10 + iinc ) * K];
+      for ( size_t k = 0; k < K; ++k ) {
+         dv[k] = a[k];
+         dw[k] = wd[k];
+      }
+   }
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchSA::update_time()
+{
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      entities[einc]->lag_comp_data.time = this->integ_t;
+   }
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchSA::load()
+{
+   // Gather the entity accelerations, which are constant over the step,
+   // into the structure-of-arrays working state for the derivative routine.
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         acc[iinc][einc]     = entities[einc]->accel[iinc];
+         ang_acc[iinc][einc] = entities[einc]->ang_accel[iinc];
+      }
+   }
+
+   // Load the integration states into the batch integrator.
+   this->integrator->load();
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchSA::unload()
+{
+   // Unload the integrated states from the batch integrator.
+   this->integrator->unload();
+
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      // Normalize the propagated attitude quaternion.
+      entities[einc]->lag_comp_data.att.normalize();
+
+      // Compute the derivative of the attitude quaternion from the
+      // angular velocity vector.
+      entities[einc]->Q_dot.derivative_first( entities[einc]->lag_comp_data.att,
+                                              entities[einc]->lag_comp_data.ang_vel );
+   }
+   return;
+}
+
+/*!
+ * @job_class{derivative}
+ */
+void PhysicalEntityLagCompBatchSA::derivative_first(
+   void *user_data )
+{
+   // Compute the derivative of the attitude quaternion from the
+   // angular velocity vector for all the registered entities.
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      entities[einc]->Q_dot.derivative_first( entities[einc]->lag_comp_data.att,
+                                              entities[einc]->lag_comp_data.ang_vel );
+   }
+   return;
+}
+
+/*!
+ * @details Mirrors the per-entity PhysicalEntityLagCompSA::integrate()
+ * loop but advances all the registered entities together through the
+ * batch integrator.
+ *
+ * @job_class{derivative}
+ */
+int PhysicalEntityLagCompBatchSA::integrate(
+   double const t_begin,
+   double const t_end )
+{
+   double const compensate_dt = t_end - t_begin;
+   double       dt_go         = compensate_dt;
+
+   if ( integrator == NULL ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityLagCompBatchSA::integrate():" << __LINE__
+             << " ERROR: The batch integrator has not been allocated,"
+             << " initialize() must be called before compensation!"
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return ( 1 );
+   }
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      cout << "**** PhysicalEntityLagCompBatchSA::integrate(): "
+           << "Compensate: t_begin, t_end, dt_go: "
+           << t_begin << ", " << t_end << ", " << dt_go << endl;
+   }
+
+   // Offload the whole propagation to the GPU when enough entities are
+   // registered and a compute device is available, falling back to the CPU
+   // batch integrator otherwise.
+   if ( GpuBatchCompute::should_offload( (int)entities.size() )
+        && integrate_gpu( t_begin, t_end ) ) {
+      return ( 0 );
+   }
+
+   // Propagate the current PhysicalEntity states to the desired time.
+   // Set the current integration time for the integrator.
+   this->integ_t = t_begin;
+   this->integrator->setIndyVar( 0.0 );
+
+   // Loop through integrating the states forward to the current scenario time.
+   while ( ( dt_go >= 0.0 ) && ( fabs( dt_go ) > this->integ_tol ) ) {
+
+      // Load the integration states and derivatives.
+      this->load();
+
+      // Perform the integration propagation one integration step.
+      if ( dt_go > this->integ_dt ) {
+         // Not near the end; so, use the defined integration step size.
+         this->integrator->variable_step( this->integ_dt );
+      } else {
+         // Near the end; so, integrate to the end of the compensation step.
+         this->integrator->variable_step( dt_go );
+      }
+
+      // Unload the integrated states and derivatives.
+      this->unload();
+
+      // Update the integration time.
+      this->integ_t = t_begin + this->integrator->getIndyVar();
+
+      // Compute the remaining time in the compensation step.
+      dt_go = compensate_dt - this->integrator->getIndyVar();
+   }
+
+   // Update the lag compensated time of the entities.
+   this->update_time();
+
+   // Compute the lag compensated value for the attitude quaternion rate.
+   this->derivative_first();
+
+   return ( 0 );
+}
+
+/*!
+ * @details The staging buffer is page-locked (pinned) host memory when a
+ * compute device is available, so the host-device transfers can use DMA.
+ * The device runs the whole sub-step propagation loop against
+ * device-resident state, so the entity states cross the bus once each way
+ * per compensation call.
+ *
+ * @job_class{derivative}
+ */
+bool PhysicalEntityLagCompBatchSA::integrate_gpu(
+   double const t_begin,
+   double const t_end )
+{
+   size_t const K      = entities.size();
+   size_t const needed = ( 13 + 6 ) * K;
+
+   // Size the staging buffer on the first pass; the entity count is fixed
+   // once initialize() has been called.
+   if ( ( gpu_staging == NULL ) || ( gpu_staging_size < needed ) ) {
+      GpuBatchCompute::free_staging( gpu_staging );
+      gpu_staging      = GpuBatchCompute::allocate_staging( needed );
+      gpu_staging_size = needed;
+   }
+   if ( gpu_staging == NULL ) {
+      return ( false );
+   }
+
+   double *states  = &gpu_staging[0];
+   double *acc_stg = &gpu_staging[13 * K];
+   double *ang_stg = &gpu_staging[16 * K];
+
+   // Gather the entity states through the state reference table into the
+   // component major layout used by the batch integrator, with the
+   // constant accelerations staged alongside them.
+   for ( size_t k = 0; k < K; ++k ) {
+      double *const *refs = &state_refs[k * 13];
+      for ( size_t s = 0; s < 13; ++s ) {
+         states[( s * K ) + k] = *( refs[s] );
+      }
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         acc_stg[( (size_t)iinc * K ) + k] = entities[k]->accel[iinc];
+         ang_stg[( (size_t)iinc * K ) + k] = entities[k]->ang_accel[iinc];
+      }
+   }
+
+   if ( !GpuBatchCompute::propagate_entities( t_end - t_begin, this->integ_dt,
+                                              this->integ_tol, this->use_rk2_integ,
+                                              (int)K, states, acc_stg, ang_stg ) ) {
+      return ( false );
+   }
+
+   // Scatter the propagated states back through the state reference table.
+   // The device kernels normalized the attitude quaternions after each
+   // step, the way the CPU path does in unload().
+   for ( size_t k = 0; k < K; ++k ) {
+      double *const *refs = &state_refs[k * 13];
+      for ( size_t s = 0; s < 13; ++s ) {
+         *( refs[s] ) = states[( s * K ) + k];
+      }
+   }
+
+   // Update the lag compensated time of the entities.
+   this->integ_t = t_end;
+   this->update_time();
+
+   // Compute the lag compensated value for the attitude quaternion rate.
+   this->derivative_first();
+
+   return ( true );
+}
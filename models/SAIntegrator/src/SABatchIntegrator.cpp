@@ -0,0 +1,220 @@
+/*!
+@file models/SAIntegrator/src/SABatchIntegrator.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for the batched Stand-Alone
+(SA) style integrators that advance many independent state vectors
+simultaneously.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{SABatchIntegrator.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <vector>
+
+// SpaceFOM include files.
+#include "../include/SABatchIntegrator.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+SABatchIntegrator::SABatchIntegrator(
+   double          dt,
+   int             num_states,
+   int             num_instances,
+   double        **state_refs,
+   BatchDerivsFunc derivs_func,
+   void           *udata ) // RETURN: -- None.
+   : default_dt( dt ),
+     num_states( num_states ),
+     num_instances( num_instances ),
+     state_refs( state_refs ),
+     derivs_func( derivs_func ),
+     udata( udata ),
+     indy_var( 0.0 ),
+     states( (size_t)num_states * (size_t)num_instances, 0.0 ),
+     derivs( (size_t)num_states * (size_t)num_instances, 0.0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SABatchIntegrator::~SABatchIntegrator() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @details Transposes the instance major state references into the
+ * component major structure-of-arrays working storage.
+ *
+ * @job_class{integration}
+ */
+void SABatchIntegrator::load()
+{
+   for ( int k = 0; k < num_instances; ++k ) {
+      double *const *refs = &state_refs[k * num_states];
+      for ( int s = 0; s < num_states; ++s ) {
+         states[( s * num_instances ) + k] = *( refs[s] );
+      }
+   }
+   return;
+}
+
+/*!
+ * @details Transposes the component major structure-of-arrays working
+ * storage back into the instance major state references.
+ *
+ * @job_class{integration}
+ */
+void SABatchIntegrator::unload()
+{
+   for ( int k = 0; k < num_instances; ++k ) {
+      double *const *refs = &state_refs[k * num_states];
+      for ( int s = 0; s < num_states; ++s ) {
+         *( refs[s] ) = states[( s * num_instances ) + k];
+      }
+   }
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+SABatchEulerIntegrator::SABatchEulerIntegrator(
+   double          dt,
+   int             num_states,
+   int             num_instances,
+   double        **state_refs,
+   BatchDerivsFunc derivs_func,
+   void           *udata ) // RETURN: -- None.
+   : SABatchIntegrator( dt, num_states, num_instances, state_refs, derivs_func, udata )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SABatchEulerIntegrator::~SABatchEulerIntegrator() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @details One derivative evaluation for all the instances followed by a
+ * single flat update loop over the working storage.
+ *
+ * @job_class{integration}
+ */
+void SABatchEulerIntegrator::variable_step(
+   double dt )
+{
+   size_t const num_values = states.size();
+
+   if ( num_values == 0 ) {
+      this->indy_var += dt;
+      return;
+   }
+
+   // Evaluate the derivatives for all the instances.
+   ( *derivs_func )( this->indy_var, num_instances, &states[0], &derivs[0], udata );
+
+   // Euler propagation in one flat loop over all the state values.
+   double       *x  = &states[0];
+   double const *xd = &derivs[0];
+   for ( size_t i = 0; i < num_values; ++i ) {
+      x[i] += xd[i] * dt;
+   }
+
+   this->indy_var += dt;
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+SABatchRK2Integrator::SABatchRK2Integrator(
+   double          dt,
+   int             num_states,
+   int             num_instances,
+   double        **state_refs,
+   BatchDerivsFunc derivs_func,
+   void           *udata ) // RETURN: -- None.
+   : SABatchIntegrator( dt, num_states, num_instances, state_refs, derivs_func, udata ),
+     states_0( (size_t)num_states * (size_t)num_instances, 0.0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SABatchRK2Integrator::~SABatchRK2Integrator() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @details Midpoint method: two derivative evaluations for all the
+ * instances with flat update loops over the working storage.
+ *
+ * @job_class{integration}
+ */
+void SABatchRK2Integrator::variable_step(
+   double dt )
+{
+   size_t const num_values = states.size();
+
+   if ( num_values == 0 ) {
+      this->indy_var += dt;
+      return;
+   }
+
+   double       *x  = &states[0];
+   double       *x0 = &states_0[0];
+   double const *xd = &derivs[0];
+
+   // Save the step start states.
+   states_0 = states;
+
+   // Evaluate the derivatives at the start of the step and advance all
+   // the state values to the midpoint.
+   ( *derivs_func )( this->indy_var, num_instances, x0, &derivs[0], udata );
+   for ( size_t i = 0; i < num_values; ++i ) {
+      x[i] = x0[i] + ( xd[i] * ( dt * 0.5 ) );
+   }
+
+   // Evaluate the derivatives at the midpoint and take the full step
+   // from the step start states with the midpoint derivatives.
+   ( *derivs_func )( ( this->indy_var + ( dt * 0.5 ) ), num_instances, x, &derivs[0], udata );
+   for ( size_t i = 0; i < num_values; ++i ) {
+      x[i] = x0[i] + ( xd[i] * dt );
+   }
+
+   this->indy_var += dt;
+   return;
+}
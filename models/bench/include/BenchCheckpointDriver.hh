@@ -0,0 +1,144 @@
+/*!
+@file models/bench/include/BenchCheckpointDriver.hh
+@ingroup TrickHLAModel
+@brief Checkpoint and restore benchmark driver that repeatedly exercises the
+TrickHLA checkpoint path and times each sub-stage: interaction capture,
+sync-point conversion, Trick checkpoint file write, interaction restore and
+the optional federation-save coordination round trip.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{bench/src/BenchCheckpointDriver.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_BENCH_CHECKPOINT_DRIVER_HH
+#define TRICKHLA_MODEL_BENCH_CHECKPOINT_DRIVER_HH
+
+// System include files.
+#include <cstdint>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+
+namespace TrickHLA
+{
+class Federate;
+class Manager;
+} // namespace TrickHLA
+
+namespace TrickHLAModel
+{
+
+class BenchCheckpointDriver
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__BenchCheckpointDriver();
+
+  public:
+   double checkpoint_period; ///< @trick_units{s} Simulation time between benchmark checkpoint cycles (default: 10.0).
+
+   double start_time; ///< @trick_units{s} Simulation time of the first benchmark checkpoint cycle, so startup transients are excluded (default: 5.0).
+
+   bool dump_trick_checkpoint; /**< @trick_units{--}
+      Include the Trick checkpoint file write in each cycle. This dumps a
+      full Trick checkpoint of the simulation to the RUN directory every
+      cycle, which is the dominant cost being benchmarked (default: true). */
+
+   bool measure_restore; /**< @trick_units{--}
+      Include the interaction restore decode in each cycle. The restore
+      re-queues the captured interaction items into the live receive queues
+      where they are processed again, so only enable this in a benchmark
+      federation where the duplicate deliveries are harmless
+      (default: false). */
+
+   bool drive_federation_save; /**< @trick_units{--}
+      Announce a coordinated federation save each cycle and time the
+      announce-to-completion round trip. Requires an execution control
+      scheme that supports HLA save and restore (default: false). */
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel BenchCheckpointDriver class. */
+   BenchCheckpointDriver();
+   /*! @brief Destructor for the TrickHLAModel BenchCheckpointDriver class. */
+   virtual ~BenchCheckpointDriver();
+
+   /*! @brief Initialization job that associates the driver with the
+    * federate and manager it benchmarks.
+    *  @param federate The TrickHLA Federate instance.
+    *  @param manager  The TrickHLA Manager instance. */
+   void initialize( TrickHLA::Federate *federate, TrickHLA::Manager *manager );
+
+   /*! @brief Scheduled job that runs one benchmark checkpoint cycle each
+    * time the checkpoint period elapses, timing each sub-stage, and polls
+    * the completion of an outstanding federation save.
+    *  @param sim_time Current simulation time {s}. */
+   void drive( double const sim_time );
+
+   /*! @brief Shutdown job that prints the cycle count and the per-stage
+    * timing statistics, including the histogram percentiles. */
+   void record_results();
+
+  protected:
+   /*! @brief Run one benchmark checkpoint cycle, timing each sub-stage. */
+   void run_checkpoint_cycle();
+
+   TrickHLA::Federate *federate; ///< @trick_io{**} Associated TrickHLA Federate.
+   TrickHLA::Manager  *manager;  ///< @trick_io{**} Associated TrickHLA Manager.
+
+   double    next_checkpoint_time; ///< @trick_io{**} Simulation time of the next benchmark checkpoint cycle.
+   long long cycle_count;          ///< @trick_io{**} Number of benchmark checkpoint cycles completed.
+
+   bool    save_outstanding;     ///< @trick_io{**} True while an announced federation save has not completed.
+   int64_t save_announce_time;   ///< @trick_io{**} Wall clock time of the outstanding save announce in microseconds.
+
+   TrickHLA::ElapsedTimeStats capture_stats;    ///< @trick_units{--} Interaction queue capture (setup_checkpoint_interactions) times in milliseconds.
+   TrickHLA::ElapsedTimeStats sync_pts_stats;   ///< @trick_units{--} Sync-point conversion (convert_sync_pts) times in milliseconds.
+   TrickHLA::ElapsedTimeStats file_write_stats; ///< @trick_units{--} Trick checkpoint file write times in milliseconds.
+   TrickHLA::ElapsedTimeStats restore_stats;    ///< @trick_units{--} Interaction restore decode (restore_interactions) times in milliseconds.
+   TrickHLA::ElapsedTimeStats total_stats;      ///< @trick_units{--} Whole benchmark cycle times in milliseconds.
+   TrickHLA::ElapsedTimeStats fed_save_stats;   ///< @trick_units{--} Federation save announce-to-completion round trip times in milliseconds.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BenchCheckpointDriver class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BenchCheckpointDriver( BenchCheckpointDriver const &rhs );
+   /*! @brief Assignment operator for BenchCheckpointDriver class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BenchCheckpointDriver &operator=( BenchCheckpointDriver const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_BENCH_CHECKPOINT_DRIVER_HH: Do NOT put anything after this line!
@@ -0,0 +1,86 @@
+/*!
+@file models/bench/include/BenchData.hh
+@ingroup TrickHLAModel
+@brief A configurable N-values data container used by the throughput
+benchmark federates.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{bench/src/BenchData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_BENCH_DATA_HH
+#define TRICKHLA_MODEL_BENCH_DATA_HH
+
+namespace TrickHLAModel
+{
+
+class BenchData
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__BenchData();
+
+  public:
+   char *name; ///< @trick_units{--} Unique name to identify this benchmark data instance.
+
+   int     value_count; ///< @trick_units{--} Number of values in the dynamic values array.
+   double *values;      ///< @trick_units{--} Dynamic array of values, map the object attribute to this variable.
+
+   long long update_count; ///< @trick_units{--} Number of times the values have been updated.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel BenchData class. */
+   BenchData();
+   /*! @brief Destructor for the TrickHLAModel BenchData class. */
+   virtual ~BenchData();
+
+   /*! @brief Allocate the values array for the configured number of values.
+    *  @param num_values Number of values this instance carries. */
+   void configure( int const num_values );
+
+   /*! @brief Update all the values as a cheap deterministic function of time
+    * so the publishing federate sends changed data every cycle.
+    *  @param time Current scenario time {s}. */
+   void compute_values( double const time );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BenchData class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BenchData( BenchData const &rhs );
+   /*! @brief Assignment operator for BenchData class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BenchData &operator=( BenchData const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_BENCH_DATA_HH: Do NOT put anything after this line!
@@ -0,0 +1,121 @@
+/*!
+@file models/bench/include/BenchOwnershipHandler.hh
+@ingroup TrickHLAModel
+@brief Cyclic ownership transfer benchmark driver that measures the
+request-to-grant latency and sustained transfer rate of the TrickHLA
+attribute ownership path.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/OwnershipHandler.cpp}
+@trick_link_dependency{bench/src/BenchOwnershipHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_BENCH_OWNERSHIP_HANDLER_HH
+#define TRICKHLA_MODEL_BENCH_OWNERSHIP_HANDLER_HH
+
+// System include files.
+#include <cstdint>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/OwnershipHandler.hh"
+#include "TrickHLA/Types.hh"
+
+namespace TrickHLAModel
+{
+
+class BenchOwnershipHandler : public TrickHLA::OwnershipHandler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__BenchOwnershipHandler();
+
+  public:
+   double transfer_period; ///< @trick_units{s} Simulation time between handover attempts by the non-owning federate (default: 1.0).
+
+   TrickHLA::ElapsedTimeStats latency_stats; ///< @trick_units{--} Request-to-grant latency statistics, in milliseconds, of the ownership pulls completed by this federate.
+
+   long long transfer_count; ///< @trick_units{--} Number of ownership transfers completed by this federate.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLAModel BenchOwnershipHandler class. */
+   BenchOwnershipHandler();
+   /*! @brief Destructor for the TrickHLAModel BenchOwnershipHandler class. */
+   virtual ~BenchOwnershipHandler();
+
+   /*! @brief Initialization callback as part of the TrickHLA::OwnershipHandler functions.
+    *  @param obj Object associated with this OwnershipHandler class. */
+   virtual void initialize_callback( TrickHLA::Object *obj );
+
+   /*! @brief Scheduled job that drives the cyclic handover. When this
+    * federate does not own the object attributes and the transfer period
+    * has elapsed it requests a pull of all the attributes and records the
+    * request wall clock time; while a pull is outstanding it checks for
+    * the grant and samples the request-to-grant latency.
+    *  @param sim_time Current simulation time {s}. */
+   void drive_transfer( double const sim_time );
+
+   /*! @brief Shutdown job that prints the transfer count, the sustained
+    * transfers per wall clock second and the request-to-grant latency
+    * statistics, including the histogram percentiles. */
+   void record_results();
+
+  protected:
+   /*! @brief Determine if this federate owns all the object attributes.
+    *  @return True when every attribute is locally owned. */
+   bool owns_all_attributes();
+
+   TrickHLA::VectorOfStrings attribute_FOM_names; ///< @trick_io{**} Attribute FOM names of the associated object.
+
+   bool    pull_in_progress;      ///< @trick_io{**} True while an ownership pull issued by this federate is outstanding.
+   double  next_transfer_time;    ///< @trick_io{**} Simulation time of the next handover attempt.
+   int64_t request_wall_time;     ///< @trick_io{**} Wall clock time of the outstanding pull request in microseconds.
+   int64_t first_request_wall_time; ///< @trick_io{**} Wall clock time of the first pull request in microseconds, -1 if none yet.
+   int64_t last_grant_wall_time;  ///< @trick_io{**} Wall clock time of the most recent grant in microseconds.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BenchOwnershipHandler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BenchOwnershipHandler( BenchOwnershipHandler const &rhs );
+   /*! @brief Assignment operator for BenchOwnershipHandler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BenchOwnershipHandler &operator=( BenchOwnershipHandler const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_BENCH_OWNERSHIP_HANDLER_HH: Do NOT put anything after this line!
@@ -0,0 +1,123 @@
+/*!
+@file models/bench/include/BenchPingInteractionHandler.hh
+@ingroup TrickHLAModel
+@brief This class measures the HLA interaction ping-pong latency between a
+pair of benchmark federates.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{bench/src/BenchPingInteractionHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_BENCH_PING_INTERACTION_HANDLER_HH
+#define TRICKHLA_MODEL_BENCH_PING_INTERACTION_HANDLER_HH
+
+// System include files.
+#include <cstdint>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/InteractionHandler.hh"
+#include "TrickHLA/StandardsSupport.hh"
+
+namespace TrickHLAModel
+{
+
+class BenchPingInteractionHandler : public TrickHLA::InteractionHandler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__BenchPingInteractionHandler();
+
+  public:
+   char *name; ///< @trick_units{--} Unique name to identify the interaction handler.
+
+   bool echo;      ///< @trick_units{--} True for the pong side, which echoes back every received ping.
+   bool auto_send; ///< @trick_units{--} True for the ping side to send a ping every interaction cycle.
+
+   char *results_file; ///< @trick_units{--} Name of the CSV file the latency samples are written to at shutdown.
+
+   // The interaction payload, mapped to the interaction parameters in the
+   // input file.
+   long long origin_time; ///< @trick_units{--} Wall-clock time in microseconds when the ping was originally sent.
+   long long sequence;    ///< @trick_units{--} Sequence number of the ping.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLAModel BenchPingInteractionHandler class. */
+   BenchPingInteractionHandler();
+   /*! @brief Destructor for the TrickHLAModel BenchPingInteractionHandler class. */
+   virtual ~BenchPingInteractionHandler();
+
+  public:
+   /*! @brief Send one ping interaction carrying the current wall-clock time.
+    *  @param send_time HLA time to send the interaction {s}. */
+   void send_ping( double const send_time );
+
+   /*! @brief Scheduled job wrapper that sends a ping every call when
+    * auto_send is enabled, so the ping rate is the job cycle time.
+    *  @param send_time HLA time to send the interaction {s}. */
+   void send_ping_job( double const send_time );
+
+   /*! @brief Receive the HLA interaction: the pong side echoes the payload
+    * back, the ping side computes the round-trip latency from it.
+    *  @param the_user_supplied_tag User tag. */
+   virtual void receive_interaction( RTI1516_USERDATA const &the_user_supplied_tag );
+
+   /*! @brief Write the latency samples to the results CSV file and print a
+    * summary of the latency statistics. */
+   void record_results();
+
+  protected:
+   unsigned int send_cnt;    ///< @trick_units{--} The number of times an interaction is sent.
+   unsigned int receive_cnt; ///< @trick_units{--} The number of times an interaction was received.
+
+   TrickHLA::ElapsedTimeStats round_trip_stats; ///< @trick_units{--} Statistics of the measured round-trip latencies.
+
+   std::vector< long long > sample_sequence;     ///< @trick_io{**} Sequence number of each latency sample.
+   std::vector< double >    sample_round_trip_ms; ///< @trick_io{**} Measured round-trip latency of each sample in milliseconds.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BenchPingInteractionHandler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BenchPingInteractionHandler( BenchPingInteractionHandler const &rhs );
+   /*! @brief Assignment operator for BenchPingInteractionHandler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BenchPingInteractionHandler &operator=( BenchPingInteractionHandler const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_BENCH_PING_INTERACTION_HANDLER_HH: Do NOT put anything after this line!
@@ -0,0 +1,109 @@
+/*!
+@file models/bench/include/BenchThroughputMetrics.hh
+@ingroup TrickHLAModel
+@brief Collects per-frame send and receive throughput of all the TrickHLA
+objects and dumps the results to a CSV file for regression tracking.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{bench/src/BenchThroughputMetrics.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_BENCH_THROUGHPUT_METRICS_HH
+#define TRICKHLA_MODEL_BENCH_THROUGHPUT_METRICS_HH
+
+// System include files.
+#include <cstdint>
+#include <vector>
+
+namespace TrickHLA
+{
+class Manager;
+}
+
+namespace TrickHLAModel
+{
+
+class BenchThroughputMetrics
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__BenchThroughputMetrics();
+
+  public:
+   char *results_file; ///< @trick_units{--} Name of the CSV file the throughput samples are written to at shutdown.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel BenchThroughputMetrics class. */
+   BenchThroughputMetrics();
+   /*! @brief Destructor for the TrickHLAModel BenchThroughputMetrics class. */
+   virtual ~BenchThroughputMetrics();
+
+   /*! @brief Associate the TrickHLA manager whose objects are measured.
+    *  @param thla_manager The TrickHLA manager. */
+   void initialize( TrickHLA::Manager *thla_manager );
+
+   /*! @brief Scheduled job that samples the object send and receive counts
+    * once per frame and computes the update rates since the previous frame.
+    *  @param sim_time Current simulation time {s}. */
+   void record_frame( double const sim_time );
+
+   /*! @brief Write the per-frame throughput samples to the results CSV file
+    * and print a summary, including the per-stage elapsed time statistics
+    * when those are compiled in. */
+   void record_results();
+
+  protected:
+   TrickHLA::Manager *manager; ///< @trick_io{**} Associated TrickHLA Manager.
+
+   long long prev_send_count;    ///< @trick_io{**} Total object send count at the previous frame.
+   long long prev_receive_count; ///< @trick_io{**} Total object receive count at the previous frame.
+   int64_t   prev_wall_time;     ///< @trick_io{**} Wall-clock time of the previous frame in microseconds.
+
+   std::vector< double >    frame_sim_time;     ///< @trick_io{**} Simulation time of each frame sample.
+   std::vector< double >    frame_send_rate;    ///< @trick_io{**} Sends per wall-clock second during each frame.
+   std::vector< double >    frame_receive_rate; ///< @trick_io{**} Receives per wall-clock second during each frame.
+   std::vector< long long > frame_sends;        ///< @trick_io{**} Sends during each frame.
+   std::vector< long long > frame_receives;     ///< @trick_io{**} Receives during each frame.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for BenchThroughputMetrics class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   BenchThroughputMetrics( BenchThroughputMetrics const &rhs );
+   /*! @brief Assignment operator for BenchThroughputMetrics class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   BenchThroughputMetrics &operator=( BenchThroughputMetrics const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_BENCH_THROUGHPUT_METRICS_HH: Do NOT put anything after this line!
@@ -0,0 +1,142 @@
+/*!
+@file models/bench/include/SoakDriftMonitor.hh
+@ingroup TrickHLAModel
+@brief Long-duration soak monitor that records windowed performance
+baselines (frame wall time, resident set size, queue depths and update
+rates) and fails the run when the final window drifts from the first
+beyond the configured tolerances, making slow leaks and creeping latency
+first-class test failures.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{bench/src/SoakDriftMonitor.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SOAK_DRIFT_MONITOR_HH
+#define TRICKHLA_MODEL_SOAK_DRIFT_MONITOR_HH
+
+// System include files.
+#include <cstdint>
+#include <vector>
+
+namespace TrickHLA
+{
+class Manager;
+}
+
+namespace TrickHLAModel
+{
+
+class SoakDriftMonitor
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__SoakDriftMonitor();
+
+  public:
+   bool enabled; ///< @trick_units{--} True to enable the soak monitor, default: false.
+
+   char *results_file; ///< @trick_units{--} Name of the CSV file the per-window baselines are written to at shutdown.
+
+   double window_seconds; ///< @trick_units{s} Wall-clock length of each baseline window, default: 300.
+
+   double frame_time_drift_tolerance; ///< @trick_units{--} Allowed fractional growth of the mean frame wall time from the first window to the final window, default: 0.25.
+
+   double rss_drift_tolerance; ///< @trick_units{--} Allowed fractional growth of the resident set size from the first window to the final window, default: 0.10.
+
+   bool fail_on_drift; ///< @trick_units{--} True (default) to terminate the run with a non-zero status when a drift tolerance is exceeded, so a soak regression fails automated tests.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel SoakDriftMonitor class. */
+   SoakDriftMonitor();
+   /*! @brief Destructor for the TrickHLAModel SoakDriftMonitor class. */
+   virtual ~SoakDriftMonitor();
+
+   /*! @brief Associate the TrickHLA manager whose objects are measured.
+    *  @param thla_manager The TrickHLA manager. */
+   void initialize( TrickHLA::Manager *thla_manager );
+
+   /*! @brief Scheduled job that measures the frame wall time and rolls the
+    * accumulators into a new baseline window record each time the window
+    * elapses.
+    *  @param sim_time Current simulation time {s}. */
+   void sample( double const sim_time );
+
+   /*! @brief Write the per-window baselines to the results CSV file and
+    * print the end-of-run drift report comparing the final window to the
+    * first. Terminates the run with a non-zero status when fail_on_drift
+    * is set and a drift tolerance is exceeded. */
+   void record_results();
+
+  protected:
+   /*! @brief Close out the current accumulation window into a baseline
+    * record.
+    *  @param sim_time  Current simulation time {s}.
+    *  @param wall_time Current wall-clock time in microseconds. */
+   void close_window( double const sim_time, int64_t const wall_time );
+
+   /*! @brief Read the current resident set size of this process.
+    *  @return Resident set size in bytes, 0 when it cannot be read. */
+   static long long read_resident_set_size();
+
+   TrickHLA::Manager *manager; ///< @trick_io{**} Associated TrickHLA Manager.
+
+   int64_t   window_start_wall_time; ///< @trick_io{**} Wall-clock time the current window started in microseconds.
+   int64_t   prev_sample_wall_time;  ///< @trick_io{**} Wall-clock time of the previous sample in microseconds.
+   long long window_start_receives;  ///< @trick_io{**} Total object receive count when the current window started.
+   long long window_start_sends;     ///< @trick_io{**} Total object send count when the current window started.
+   double    frame_time_sum_ms;      ///< @trick_io{**} Sum of the frame wall times in the current window in milliseconds.
+   double    frame_time_peak_ms;     ///< @trick_io{**} Largest frame wall time in the current window in milliseconds.
+   long long frame_count;            ///< @trick_io{**} Number of frame samples in the current window.
+
+   std::vector< double >    window_sim_time;       ///< @trick_io{**} Simulation time at the close of each window.
+   std::vector< double >    window_mean_frame_ms;  ///< @trick_io{**} Mean frame wall time of each window in milliseconds.
+   std::vector< double >    window_peak_frame_ms;  ///< @trick_io{**} Peak frame wall time of each window in milliseconds.
+   std::vector< double >    window_rss_mb;         ///< @trick_io{**} Resident set size at the close of each window in megabytes.
+   std::vector< double >    window_send_rate;      ///< @trick_io{**} Sends per wall-clock second during each window.
+   std::vector< double >    window_receive_rate;   ///< @trick_io{**} Receives per wall-clock second during each window.
+   std::vector< long long > window_queue_depth;    ///< @trick_io{**} Total reflected attributes queue high-water mark at the close of each window.
+   std::vector< long long > window_queue_dropped;  ///< @trick_io{**} Total reflections dropped by the queue overflow policies at the close of each window.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SoakDriftMonitor class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SoakDriftMonitor( SoakDriftMonitor const &rhs );
+   /*! @brief Assignment operator for SoakDriftMonitor class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SoakDriftMonitor &operator=( SoakDriftMonitor const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SOAK_DRIFT_MONITOR_HH: Do NOT put anything after this line!
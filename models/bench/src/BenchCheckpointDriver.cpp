@@ -0,0 +1,219 @@
+/*!
+@file models/bench/src/BenchCheckpointDriver.cpp
+@ingroup TrickHLAModel
+@brief Checkpoint and restore benchmark driver that repeatedly exercises the
+TrickHLA checkpoint path and times each sub-stage: interaction capture,
+sync-point conversion, Trick checkpoint file write, interaction restore and
+the optional federation-save coordination round trip.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Federate.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{bench/src/BenchCheckpointDriver.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/CheckPointRestart_c_intf.hh"
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/BenchCheckpointDriver.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/Manager.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+BenchCheckpointDriver::BenchCheckpointDriver()
+   : checkpoint_period( 10.0 ),
+     start_time( 5.0 ),
+     dump_trick_checkpoint( true ),
+     measure_restore( false ),
+     drive_federation_save( false ),
+     federate( NULL ),
+     manager( NULL ),
+     next_checkpoint_time( 0.0 ),
+     cycle_count( 0 ),
+     save_outstanding( false ),
+     save_announce_time( 0 ),
+     capture_stats(),
+     sync_pts_stats(),
+     file_write_stats(),
+     restore_stats(),
+     total_stats(),
+     fed_save_stats()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BenchCheckpointDriver::~BenchCheckpointDriver()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BenchCheckpointDriver::initialize(
+   TrickHLA::Federate *federate,
+   TrickHLA::Manager  *manager )
+{
+   this->federate             = federate;
+   this->manager              = manager;
+   this->next_checkpoint_time = this->start_time;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void BenchCheckpointDriver::drive(
+   double const sim_time )
+{
+   if ( ( federate == NULL ) || ( manager == NULL ) ) {
+      return;
+   }
+
+   // Close out an outstanding coordinated federation save once the
+   // federate reports it complete. The round trip resolution is this
+   // job's cycle time.
+   if ( this->save_outstanding && federate->is_save_completed() ) {
+      this->save_outstanding = false;
+      fed_save_stats.sample( (double)( clock_wall_time() - this->save_announce_time ) * 0.001 );
+   }
+
+   if ( sim_time < this->next_checkpoint_time ) {
+      return;
+   }
+   this->next_checkpoint_time += this->checkpoint_period;
+
+   run_checkpoint_cycle();
+
+   // Announce a coordinated federation save for this frame when the
+   // execution control scheme supports it.
+   if ( this->drive_federation_save && !this->save_outstanding ) {
+      if ( federate->is_HLA_save_and_restore_supported() ) {
+         ostringstream label;
+         label << "bench_checkpoint_" << this->cycle_count;
+         this->save_announce_time = clock_wall_time();
+         this->save_outstanding   = true;
+         manager->initiate_federation_save( label.str().c_str() );
+      } else if ( this->cycle_count == 1 ) {
+         send_hs( stderr, "BenchCheckpointDriver::drive():%d The execution \
+control scheme does not support HLA save and restore, so the federation-save \
+coordination stage is skipped.",
+                  __LINE__ );
+      }
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void BenchCheckpointDriver::run_checkpoint_cycle()
+{
+   int64_t const cycle_start = clock_wall_time(); // in microseconds
+   int64_t       stage_start = cycle_start;
+   int64_t       stage_end;
+
+   // Stage 1: Capture the per-interaction receive queues into the
+   // checkpointable linear arrays.
+   manager->setup_checkpoint_interactions();
+   stage_end = clock_wall_time();
+   capture_stats.sample( (double)( stage_end - stage_start ) * 0.001 );
+
+   // Stage 2: Convert the sync-point states into their checkpointable form.
+   stage_start = stage_end;
+   federate->convert_sync_pts();
+   stage_end = clock_wall_time();
+   sync_pts_stats.sample( (double)( stage_end - stage_start ) * 0.001 );
+
+   // Stage 3: Write a full Trick checkpoint of the simulation, which is
+   // the dominant stall cost in production.
+   if ( this->dump_trick_checkpoint ) {
+      ostringstream label;
+      label << "bench_checkpoint_cycle_" << this->cycle_count;
+      stage_start = clock_wall_time();
+      checkpoint( label.str().c_str() );
+      stage_end = clock_wall_time();
+      file_write_stats.sample( (double)( stage_end - stage_start ) * 0.001 );
+   }
+
+   // Stage 4: Decode the captured interaction arrays back into the live
+   // receive queues, which is the restore-side cost. The re-queued items
+   // are processed again, so this stage is opt-in.
+   if ( this->measure_restore ) {
+      stage_start = clock_wall_time();
+      manager->restore_interactions();
+      stage_end = clock_wall_time();
+      restore_stats.sample( (double)( stage_end - stage_start ) * 0.001 );
+   } else {
+      // Free the captured interaction arrays when they are not consumed
+      // by the restore stage.
+      manager->clear_interactions();
+   }
+
+   total_stats.sample( (double)( clock_wall_time() - cycle_start ) * 0.001 );
+   ++this->cycle_count;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void BenchCheckpointDriver::record_results()
+{
+   ostringstream summary;
+   summary << "BenchCheckpointDriver::record_results():" << __LINE__
+           << " completed-cycles:" << this->cycle_count
+           << "\n interaction capture (ms): " << capture_stats.to_string()
+           << "\n sync-point conversion (ms): " << sync_pts_stats.to_string();
+   if ( this->dump_trick_checkpoint ) {
+      summary << "\n Trick checkpoint file write (ms): " << file_write_stats.to_string();
+   }
+   if ( this->measure_restore ) {
+      summary << "\n interaction restore (ms): " << restore_stats.to_string();
+   }
+   if ( this->drive_federation_save ) {
+      summary << "\n federation save round trip (ms): " << fed_save_stats.to_string();
+   }
+   summary << "\n whole cycle (ms): " << total_stats.to_string();
+
+   send_hs( stdout, summary.str().c_str() );
+}
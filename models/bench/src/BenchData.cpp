@@ -0,0 +1,103 @@
+/*!
+@file models/bench/src/BenchData.cpp
+@ingroup TrickHLAModel
+@brief A configurable N-values data container used by the throughput
+benchmark federates.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{bench/src/BenchData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cmath>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/BenchData.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+using namespace std;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+BenchData::BenchData()
+   : name( NULL ),
+     value_count( 0 ),
+     values( NULL ),
+     update_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BenchData::~BenchData()
+{
+   if ( values != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( values ) ) ) {
+         send_hs( stderr, "BenchData::~BenchData():%d WARNING failed to delete Trick Memory for 'values'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      values = NULL;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BenchData::configure(
+   int const num_values )
+{
+   value_count = ( num_values > 0 ) ? num_values : 1;
+
+   if ( values == NULL ) {
+      values = static_cast< double * >( TMM_declare_var_1d( "double", value_count ) );
+   } else {
+      values = static_cast< double * >( TMM_resize_array_1d_a( values, value_count ) );
+   }
+   for ( int i = 0; i < value_count; ++i ) {
+      values[i] = 0.0;
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void BenchData::compute_values(
+   double const time )
+{
+   for ( int i = 0; i < value_count; ++i ) {
+      values[i] = sin( time + (double)i );
+   }
+   ++update_count;
+}
@@ -0,0 +1,181 @@
+/*!
+@file models/bench/src/BenchOwnershipHandler.cpp
+@ingroup TrickHLAModel
+@brief Cyclic ownership transfer benchmark driver that measures the
+request-to-grant latency and sustained transfer rate of the TrickHLA
+attribute ownership path.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/OwnershipHandler.cpp}
+@trick_link_dependency{bench/src/BenchOwnershipHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/BenchOwnershipHandler.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/OwnershipHandler.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+BenchOwnershipHandler::BenchOwnershipHandler()
+   : transfer_period( 1.0 ),
+     latency_stats(),
+     transfer_count( 0 ),
+     attribute_FOM_names(),
+     pull_in_progress( false ),
+     next_transfer_time( 0.0 ),
+     request_wall_time( 0 ),
+     first_request_wall_time( -1 ),
+     last_grant_wall_time( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BenchOwnershipHandler::~BenchOwnershipHandler()
+{
+   return;
+}
+
+/*!
+ * @details From the TrickHLA::OwnershipHandler class. We override this
+ * function so that we can cache the attribute FOM names used by the
+ * ownership completion check every cycle.
+ * @job_class{initialization}
+ */
+void BenchOwnershipHandler::initialize_callback(
+   TrickHLA::Object *obj )
+{
+   // Make sure we call the original function so that the callback is initialized.
+   OwnershipHandler::initialize_callback( obj );
+
+   this->attribute_FOM_names = get_attribute_FOM_names();
+}
+
+bool BenchOwnershipHandler::owns_all_attributes()
+{
+   for ( unsigned int i = 0; i < attribute_FOM_names.size(); ++i ) {
+      if ( !is_locally_owned( attribute_FOM_names[i].c_str() ) ) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/*!
+ * @details The two federates of the benchmark run this job every data
+ * cycle. Whichever federate does not own the object attributes requests a
+ * pull of all of them once per transfer period, and the owning federate
+ * grants the pull through the normal TrickHLA ownership processing. The
+ * wall clock time from issuing the pull request to every attribute being
+ * locally owned is sampled into the latency statistics, so the ownership
+ * handoff alternates between the federates for the whole run.
+ * @job_class{scheduled}
+ */
+void BenchOwnershipHandler::drive_transfer(
+   double const sim_time )
+{
+   if ( attribute_FOM_names.empty() ) {
+      return;
+   }
+
+   if ( pull_in_progress ) {
+      // Check if the outstanding pull has been granted for all attributes.
+      if ( owns_all_attributes() ) {
+         int64_t const grant_wall_time = clock_wall_time();
+
+         // Sample the request-to-grant latency in milliseconds.
+         latency_stats.sample( (double)( grant_wall_time - request_wall_time ) * 0.001 );
+
+         ++transfer_count;
+         this->last_grant_wall_time = grant_wall_time;
+         this->pull_in_progress     = false;
+      }
+   } else if ( sim_time >= next_transfer_time ) {
+
+      // Schedule the next handover attempt.
+      while ( next_transfer_time <= sim_time ) {
+         next_transfer_time += transfer_period;
+      }
+
+      // Only the non-owning federate initiates the handover.
+      if ( !owns_all_attributes() ) {
+         this->request_wall_time = clock_wall_time();
+         if ( first_request_wall_time < 0 ) {
+            this->first_request_wall_time = request_wall_time;
+         }
+
+         // Request a pull of all the object attributes as soon as possible.
+         // The request is processed by the Manager process_ownership job.
+         pull_ownership();
+
+         this->pull_in_progress = true;
+      }
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void BenchOwnershipHandler::record_results()
+{
+   ostringstream summary;
+   summary << "BenchOwnershipHandler::record_results():" << __LINE__
+           << " Object:'" << get_object_name() << "'"
+           << " attributes:" << attribute_FOM_names.size()
+           << " completed-transfers:" << transfer_count;
+
+   // The sustained rate covers the first pull request to the last grant,
+   // which spans both directions of the alternating handover.
+   if ( ( transfer_count > 0 ) && ( first_request_wall_time >= 0 )
+        && ( last_grant_wall_time > first_request_wall_time ) ) {
+      double const elapsed_sec = (double)( last_grant_wall_time - first_request_wall_time ) / 1000000.0;
+      summary << " sustained-transfers-per-sec:"
+              << ( (double)transfer_count / elapsed_sec );
+   }
+   summary << "\n request-to-grant latency (ms): "
+           << latency_stats.to_string();
+
+   send_hs( stdout, summary.str().c_str() );
+}
@@ -0,0 +1,188 @@
+/*!
+@file models/bench/src/BenchPingInteractionHandler.cpp
+@ingroup TrickHLAModel
+@brief This class measures the HLA interaction ping-pong latency between a
+pair of benchmark federates.
+
+The ping side sends an interaction carrying a wall-clock timestamp and a
+sequence number. The pong side echoes the payload back unchanged in Receive
+Order. When the echo arrives back at the ping side the round-trip latency is
+the current wall-clock time minus the embedded timestamp, and the one-way
+latency is estimated as half the round trip. The per-sample latencies are
+written to a CSV file at shutdown for regression tracking.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Types.cpp}
+@trick_link_dependency{bench/src/BenchPingInteractionHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/BenchPingInteractionHandler.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/InteractionHandler.hh"
+#include "TrickHLA/StandardsSupport.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+BenchPingInteractionHandler::BenchPingInteractionHandler()
+   : TrickHLA::InteractionHandler(),
+     name( NULL ),
+     echo( false ),
+     auto_send( false ),
+     results_file( NULL ),
+     origin_time( 0 ),
+     sequence( 0 ),
+     send_cnt( 0 ),
+     receive_cnt( 0 ),
+     round_trip_stats(),
+     sample_sequence(),
+     sample_round_trip_ms()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BenchPingInteractionHandler::~BenchPingInteractionHandler()
+{
+   return;
+}
+
+void BenchPingInteractionHandler::send_ping(
+   double const send_time )
+{
+   // Stamp the payload with the wall-clock send time and next sequence number.
+   origin_time = clock_wall_time(); // in microseconds
+   ++sequence;
+
+   // Send the ping in Timestamp Order at the current simulation time plus
+   // the lookahead, just like a cyclic data interaction would be sent.
+   double timestamp = send_time + get_lookahead().get_time_in_seconds();
+
+   if ( this->InteractionHandler::send_interaction( timestamp ) ) {
+      ++send_cnt;
+   } else if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+      cout << "+-+-NOT SENT-+-+ BenchPingInteractionHandler::send_ping():"
+           << __LINE__ << endl
+           << "  name:'" << ( ( name != NULL ) ? name : "NULL" ) << "'" << endl;
+   }
+}
+
+void BenchPingInteractionHandler::send_ping_job(
+   double const send_time )
+{
+   if ( auto_send ) {
+      send_ping( send_time );
+   }
+}
+
+void BenchPingInteractionHandler::receive_interaction(
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   ++receive_cnt;
+
+   if ( echo ) {
+      // Pong side: echo the payload back unchanged in Receive Order so the
+      // echo path adds as little latency as possible.
+      if ( this->InteractionHandler::send_interaction() ) {
+         ++send_cnt;
+      }
+   } else {
+      // Ping side: the payload came back, so the round-trip latency is the
+      // wall-clock time elapsed since the embedded origin time.
+      double const round_trip_ms = ( clock_wall_time() - origin_time ) * 0.001;
+
+      round_trip_stats.sample( round_trip_ms );
+      sample_sequence.push_back( sequence );
+      sample_round_trip_ms.push_back( round_trip_ms );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+         cout << "BenchPingInteractionHandler::receive_interaction():" << __LINE__
+              << " name:'" << ( ( name != NULL ) ? name : "NULL" ) << "'"
+              << " sequence:" << sequence
+              << " round-trip:" << round_trip_ms << " milliseconds" << endl;
+      }
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void BenchPingInteractionHandler::record_results()
+{
+   // Only the ping side collects latency samples.
+   if ( sample_round_trip_ms.empty() ) {
+      return;
+   }
+
+   // Print a summary of the round-trip latency statistics.
+   ostringstream summary;
+   summary << "BenchPingInteractionHandler::record_results():" << __LINE__
+           << " name:'" << ( ( name != NULL ) ? name : "NULL" ) << "'"
+           << " pings-sent:" << send_cnt
+           << " echoes-received:" << receive_cnt
+           << " round-trip "
+           << round_trip_stats.to_string()
+           << endl;
+   send_hs( stdout, summary.str().c_str() );
+
+   // Dump the per-sample latencies to the CSV results file.
+   if ( results_file != NULL ) {
+      ofstream csv( results_file );
+      if ( csv.is_open() ) {
+         csv << "sequence,round_trip_ms,one_way_ms" << endl;
+         for ( size_t i = 0; i < sample_round_trip_ms.size(); ++i ) {
+            csv << sample_sequence[i] << ","
+                << sample_round_trip_ms[i] << ","
+                << ( sample_round_trip_ms[i] * 0.5 ) << endl;
+         }
+         csv.close();
+      } else {
+         send_hs( stderr, "BenchPingInteractionHandler::record_results():%d WARNING: Could not open results file '%s'.%c",
+                  __LINE__, results_file, THLA_NEWLINE );
+      }
+   }
+}
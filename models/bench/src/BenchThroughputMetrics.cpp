@@ -0,0 +1,197 @@
+/*!
+@file models/bench/src/BenchThroughputMetrics.cpp
+@ingroup TrickHLAModel
+@brief Collects per-frame send and receive throughput of all the TrickHLA
+objects and dumps the results to a CSV file for regression tracking.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{bench/src/BenchThroughputMetrics.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/BenchThroughputMetrics.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+BenchThroughputMetrics::BenchThroughputMetrics()
+   : results_file( NULL ),
+     manager( NULL ),
+     prev_send_count( 0 ),
+     prev_receive_count( 0 ),
+     prev_wall_time( 0 ),
+     frame_sim_time(),
+     frame_send_rate(),
+     frame_receive_rate(),
+     frame_sends(),
+     frame_receives()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BenchThroughputMetrics::~BenchThroughputMetrics()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BenchThroughputMetrics::initialize(
+   TrickHLA::Manager *thla_manager )
+{
+   this->manager = thla_manager;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void BenchThroughputMetrics::record_frame(
+   double const sim_time )
+{
+   if ( manager == NULL ) {
+      return;
+   }
+
+   // Total the send and receive counts over all the TrickHLA objects.
+   long long total_sends    = 0;
+   long long total_receives = 0;
+   for ( unsigned int i = 0; i < manager->obj_count; ++i ) {
+      total_sends += manager->objects[i].send_count;
+      total_receives += manager->objects[i].receive_count;
+   }
+
+   int64_t const wall_time = clock_wall_time(); // in microseconds
+
+   // Skip the first frame since there is no previous frame to difference
+   // against for the rates.
+   if ( prev_wall_time > 0 ) {
+      double const    wall_seconds = ( wall_time - prev_wall_time ) * 0.000001;
+      long long const sends        = total_sends - prev_send_count;
+      long long const receives     = total_receives - prev_receive_count;
+
+      frame_sim_time.push_back( sim_time );
+      frame_sends.push_back( sends );
+      frame_receives.push_back( receives );
+      frame_send_rate.push_back( ( wall_seconds > 0.0 ) ? ( sends / wall_seconds ) : 0.0 );
+      frame_receive_rate.push_back( ( wall_seconds > 0.0 ) ? ( receives / wall_seconds ) : 0.0 );
+   }
+
+   prev_send_count    = total_sends;
+   prev_receive_count = total_receives;
+   prev_wall_time     = wall_time;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void BenchThroughputMetrics::record_results()
+{
+   if ( manager == NULL ) {
+      return;
+   }
+
+   // Summarize the overall throughput.
+   double total_send_rate    = 0.0;
+   double total_receive_rate = 0.0;
+   for ( size_t i = 0; i < frame_send_rate.size(); ++i ) {
+      total_send_rate += frame_send_rate[i];
+      total_receive_rate += frame_receive_rate[i];
+   }
+   ostringstream summary;
+   summary << "BenchThroughputMetrics::record_results():" << __LINE__
+           << " frames:" << frame_sim_time.size();
+   if ( !frame_sim_time.empty() ) {
+      summary << " mean-sends-per-sec:" << ( total_send_rate / frame_send_rate.size() )
+              << " mean-receives-per-sec:" << ( total_receive_rate / frame_receive_rate.size() );
+   }
+   summary << endl;
+   send_hs( stdout, summary.str().c_str() );
+
+   // Per-stage elapsed time statistics per object, when compiled in.
+#ifdef THLA_CYCLIC_READ_TIME_STATS
+   for ( unsigned int i = 0; i < manager->obj_count; ++i ) {
+      ostringstream msg;
+      msg << "BenchThroughputMetrics::record_results():" << __LINE__
+          << " Object[" << i << "]:'" << manager->objects[i].get_name() << "'"
+          << " cyclic read "
+          << manager->objects[i].elapsed_time_stats.to_string()
+          << endl;
+      send_hs( stdout, msg.str().c_str() );
+   }
+#endif
+#ifdef THLA_CYCLIC_SEND_TIME_STATS
+   for ( unsigned int i = 0; i < manager->obj_count; ++i ) {
+      ostringstream msg;
+      msg << "BenchThroughputMetrics::record_results():" << __LINE__
+          << " Object[" << i << "]:'" << manager->objects[i].get_name() << "'"
+          << " send time "
+          << manager->objects[i].send_time_stats.to_string()
+          << endl;
+      send_hs( stdout, msg.str().c_str() );
+   }
+#endif
+
+   // Dump the per-frame throughput samples to the CSV results file.
+   if ( results_file != NULL ) {
+      ofstream csv( results_file );
+      if ( csv.is_open() ) {
+         csv << "sim_time,sends,receives,sends_per_sec,receives_per_sec" << endl;
+         for ( size_t i = 0; i < frame_sim_time.size(); ++i ) {
+            csv << frame_sim_time[i] << ","
+                << frame_sends[i] << ","
+                << frame_receives[i] << ","
+                << frame_send_rate[i] << ","
+                << frame_receive_rate[i] << endl;
+         }
+         csv.close();
+      } else {
+         send_hs( stderr, "BenchThroughputMetrics::record_results():%d WARNING: Could not open results file '%s'.%c",
+                  __LINE__, results_file, THLA_NEWLINE );
+      }
+   }
+}
@@ -0,0 +1,317 @@
+/*!
+@file models/bench/src/SoakDriftMonitor.cpp
+@ingroup TrickHLAModel
+@brief Long-duration soak monitor that records windowed performance
+baselines (frame wall time, resident set size, queue depths and update
+rates) and fails the run when the final window drifts from the first
+beyond the configured tolerances.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{bench/src/SoakDriftMonitor.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/exec_proto.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/SoakDriftMonitor.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+SoakDriftMonitor::SoakDriftMonitor()
+   : enabled( false ),
+     results_file( NULL ),
+     window_seconds( 300.0 ),
+     frame_time_drift_tolerance( 0.25 ),
+     rss_drift_tolerance( 0.10 ),
+     fail_on_drift( true ),
+     manager( NULL ),
+     window_start_wall_time( 0 ),
+     prev_sample_wall_time( 0 ),
+     window_start_receives( 0 ),
+     window_start_sends( 0 ),
+     frame_time_sum_ms( 0.0 ),
+     frame_time_peak_ms( 0.0 ),
+     frame_count( 0 ),
+     window_sim_time(),
+     window_mean_frame_ms(),
+     window_peak_frame_ms(),
+     window_rss_mb(),
+     window_send_rate(),
+     window_receive_rate(),
+     window_queue_depth(),
+     window_queue_dropped()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SoakDriftMonitor::~SoakDriftMonitor()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SoakDriftMonitor::initialize(
+   TrickHLA::Manager *thla_manager )
+{
+   this->manager = thla_manager;
+}
+
+/*!
+ * @details Reads the resident pages from /proc/self/statm. Returns 0 on
+ * platforms without procfs, which disables the RSS drift check.
+ */
+long long SoakDriftMonitor::read_resident_set_size()
+{
+   long long resident_pages = 0;
+
+   FILE *statm = fopen( "/proc/self/statm", "r" );
+   if ( statm == NULL ) {
+      return 0;
+   }
+   long long total_pages = 0;
+   if ( fscanf( statm, "%lld %lld", &total_pages, &resident_pages ) != 2 ) {
+      resident_pages = 0;
+   }
+   fclose( statm );
+
+   return resident_pages * (long long)sysconf( _SC_PAGESIZE );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SoakDriftMonitor::sample(
+   double const sim_time )
+{
+   if ( !this->enabled || ( manager == NULL ) ) {
+      return;
+   }
+
+   int64_t const wall_time = clock_wall_time(); // in microseconds
+
+   // The first sample just establishes the baselines.
+   if ( prev_sample_wall_time == 0 ) {
+      prev_sample_wall_time  = wall_time;
+      window_start_wall_time = wall_time;
+      for ( unsigned int i = 0; i < manager->obj_count; ++i ) {
+         window_start_sends += manager->objects[i].send_count;
+         window_start_receives += manager->objects[i].receive_count;
+      }
+      return;
+   }
+
+   // Accumulate the frame wall time into the current window.
+   double const frame_ms = ( wall_time - prev_sample_wall_time ) * 0.001;
+   prev_sample_wall_time = wall_time;
+
+   frame_time_sum_ms += frame_ms;
+   if ( frame_ms > frame_time_peak_ms ) {
+      frame_time_peak_ms = frame_ms;
+   }
+   ++frame_count;
+
+   // Close out the window once it has elapsed.
+   if ( ( wall_time - window_start_wall_time ) >= (int64_t)( window_seconds * 1000000.0 ) ) {
+      close_window( sim_time, wall_time );
+   }
+}
+
+/*!
+ * @details Rolls the window accumulators into one baseline record and
+ * starts the next window.
+ */
+void SoakDriftMonitor::close_window(
+   double const  sim_time,
+   int64_t const wall_time )
+{
+   // Total the send and receive counts and the queue counters over all
+   // the TrickHLA objects.
+   long long total_sends    = 0;
+   long long total_receives = 0;
+   long long queue_depth    = 0;
+   long long queue_dropped  = 0;
+   for ( unsigned int i = 0; i < manager->obj_count; ++i ) {
+      total_sends += manager->objects[i].send_count;
+      total_receives += manager->objects[i].receive_count;
+      queue_depth += (long long)manager->objects[i].get_reflected_attributes_queue_high_water_mark();
+      queue_dropped += (long long)manager->objects[i].get_reflected_attributes_queue_dropped_count();
+   }
+
+   double const wall_seconds = ( wall_time - window_start_wall_time ) * 0.000001;
+
+   window_sim_time.push_back( sim_time );
+   window_mean_frame_ms.push_back( ( frame_count > 0 ) ? ( frame_time_sum_ms / frame_count ) : 0.0 );
+   window_peak_frame_ms.push_back( frame_time_peak_ms );
+   window_rss_mb.push_back( read_resident_set_size() / ( 1024.0 * 1024.0 ) );
+   window_send_rate.push_back( ( wall_seconds > 0.0 ) ? ( ( total_sends - window_start_sends ) / wall_seconds ) : 0.0 );
+   window_receive_rate.push_back( ( wall_seconds > 0.0 ) ? ( ( total_receives - window_start_receives ) / wall_seconds ) : 0.0 );
+   window_queue_depth.push_back( queue_depth );
+   window_queue_dropped.push_back( queue_dropped );
+
+   // One line per window so the drift is visible in the log while the
+   // soak is still running.
+   {
+      ostringstream msg;
+      msg << "SoakDriftMonitor::close_window():" << __LINE__
+          << " window:" << window_sim_time.size()
+          << " sim-time:" << sim_time
+          << " mean-frame-ms:" << window_mean_frame_ms.back()
+          << " peak-frame-ms:" << window_peak_frame_ms.back()
+          << " rss-mb:" << window_rss_mb.back()
+          << " queue-high-water:" << queue_depth
+          << endl;
+      send_hs( stdout, msg.str().c_str() );
+   }
+
+   // Start the next window.
+   window_start_wall_time = wall_time;
+   window_start_sends     = total_sends;
+   window_start_receives  = total_receives;
+   frame_time_sum_ms      = 0.0;
+   frame_time_peak_ms     = 0.0;
+   frame_count            = 0;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void SoakDriftMonitor::record_results()
+{
+   if ( !this->enabled || ( manager == NULL ) ) {
+      return;
+   }
+
+   // Close out the partial final window so short runs still get a record.
+   if ( frame_count > 0 ) {
+      close_window( exec_get_sim_time(), clock_wall_time() );
+   }
+
+   // Dump the per-window baselines to the CSV results file.
+   if ( results_file != NULL ) {
+      ofstream csv( results_file );
+      if ( csv.is_open() ) {
+         csv << "window,sim_time,mean_frame_ms,peak_frame_ms,rss_mb,"
+             << "sends_per_sec,receives_per_sec,queue_high_water,queue_dropped" << endl;
+         for ( size_t i = 0; i < window_sim_time.size(); ++i ) {
+            csv << ( i + 1 ) << ","
+                << window_sim_time[i] << ","
+                << window_mean_frame_ms[i] << ","
+                << window_peak_frame_ms[i] << ","
+                << window_rss_mb[i] << ","
+                << window_send_rate[i] << ","
+                << window_receive_rate[i] << ","
+                << window_queue_depth[i] << ","
+                << window_queue_dropped[i] << endl;
+         }
+         csv.close();
+      } else {
+         send_hs( stderr, "SoakDriftMonitor::record_results():%d WARNING: Could not open results file '%s'.%c",
+                  __LINE__, results_file, THLA_NEWLINE );
+      }
+   }
+
+   // The drift report needs a first and a final window to compare.
+   if ( window_sim_time.size() < 2 ) {
+      send_hs( stdout, "SoakDriftMonitor::record_results():%d Fewer than two baseline windows recorded, no drift report.%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   size_t const first = 0;
+   size_t const last  = window_sim_time.size() - 1;
+
+   double const frame_drift = ( window_mean_frame_ms[first] > 0.0 )
+                                 ? ( ( window_mean_frame_ms[last] - window_mean_frame_ms[first] )
+                                     / window_mean_frame_ms[first] )
+                                 : 0.0;
+   double const rss_drift = ( window_rss_mb[first] > 0.0 )
+                               ? ( ( window_rss_mb[last] - window_rss_mb[first] )
+                                   / window_rss_mb[first] )
+                               : 0.0;
+   long long const queue_growth   = window_queue_depth[last] - window_queue_depth[first];
+   long long const dropped_growth = window_queue_dropped[last] - window_queue_dropped[first];
+
+   bool const frame_drift_failed = ( frame_drift > frame_time_drift_tolerance );
+   bool const rss_drift_failed   = ( rss_drift > rss_drift_tolerance );
+
+   // Print the end-of-run drift report comparing the final window to the
+   // first.
+   ostringstream report;
+   report << "SoakDriftMonitor::record_results():" << __LINE__
+          << " Drift report over " << window_sim_time.size() << " windows:"
+          << "\n    mean-frame-ms:   first:" << window_mean_frame_ms[first]
+          << " final:" << window_mean_frame_ms[last]
+          << " drift:" << ( frame_drift * 100.0 ) << "%"
+          << " tolerance:" << ( frame_time_drift_tolerance * 100.0 ) << "%"
+          << ( frame_drift_failed ? " FAILED" : " ok" )
+          << "\n    rss-mb:          first:" << window_rss_mb[first]
+          << " final:" << window_rss_mb[last]
+          << " drift:" << ( rss_drift * 100.0 ) << "%"
+          << " tolerance:" << ( rss_drift_tolerance * 100.0 ) << "%"
+          << ( rss_drift_failed ? " FAILED" : " ok" )
+          << "\n    queue-high-water: first:" << window_queue_depth[first]
+          << " final:" << window_queue_depth[last]
+          << " growth:" << queue_growth
+          << "\n    queue-dropped:    first:" << window_queue_dropped[first]
+          << " final:" << window_queue_dropped[last]
+          << " growth:" << dropped_growth
+          << endl;
+   send_hs( stdout, report.str().c_str() );
+
+   // Make a soak regression a first-class test failure.
+   if ( fail_on_drift && ( frame_drift_failed || rss_drift_failed ) ) {
+      ostringstream errmsg;
+      errmsg << "SoakDriftMonitor::record_results():" << __LINE__
+             << " ERROR: Performance drift tolerance exceeded, see the"
+             << " drift report above.";
+      exec_terminate_with_return( 1, __FILE__, __LINE__, errmsg.str().c_str() );
+   }
+}
@@ -0,0 +1,87 @@
+/*!
+@file models/stress/include/StressData.hh
+@ingroup TrickHLAModel
+@brief One data block of the N-instance scaling stress model, holding
+configurable sized arrays of doubles and 64-bit integers that map to the
+attributes of one HLA object instance.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{stress/src/StressData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_STRESS_DATA_HH
+#define TRICKHLA_MODEL_STRESS_DATA_HH
+
+namespace TrickHLAModel
+{
+
+class StressData
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__StressData();
+
+  public:
+   char *name; ///< @trick_units{--} Unique name to identify this stress data instance.
+
+   int     double_count;  ///< @trick_units{--} Number of values in the dynamic double values array.
+   double *double_values; ///< @trick_units{--} Dynamic array of doubles, map an object attribute to this variable.
+
+   int        int_count;  ///< @trick_units{--} Number of values in the dynamic integer values array.
+   long long *int_values; ///< @trick_units{--} Dynamic array of 64-bit integers, map an object attribute to this variable.
+
+   long long update_count; ///< @trick_units{--} Number of times the values have been updated.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel StressData class. */
+   StressData();
+   /*! @brief Destructor for the TrickHLAModel StressData class. */
+   virtual ~StressData();
+
+   /*! @brief Allocate the value arrays for the configured sizes. Either
+    * count may be zero to leave that attribute out of the stress load.
+    *  @param num_doubles Number of doubles this instance carries.
+    *  @param num_ints Number of 64-bit integers this instance carries. */
+   void configure( int const num_doubles, int const num_ints );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for StressData class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StressData( StressData const &rhs );
+   /*! @brief Assignment operator for StressData class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StressData &operator=( StressData const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_STRESS_DATA_HH: Do NOT put anything after this line!
@@ -0,0 +1,101 @@
+/*!
+@file models/stress/include/StressDriver.hh
+@ingroup TrickHLAModel
+@brief Load generator for the N-instance scaling stress model. Owns a
+configurable number of StressData blocks and updates all of them from one
+scheduled job with a tight, branch free generator loop.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{stress/src/StressData.cpp}
+@trick_link_dependency{stress/src/StressDriver.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_STRESS_DRIVER_HH
+#define TRICKHLA_MODEL_STRESS_DRIVER_HH
+
+// Model include files.
+#include "StressData.hh"
+
+namespace TrickHLAModel
+{
+
+class StressDriver
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__StressDriver();
+
+  public:
+   int         instance_count; ///< @trick_units{--} Number of stress data instances.
+   StressData *instances;      ///< @trick_units{--} Dynamic array of stress data instances, one per HLA object.
+
+   long long cycle_count; ///< @trick_units{--} Number of data generation cycles performed.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel StressDriver class. */
+   StressDriver();
+   /*! @brief Destructor for the TrickHLAModel StressDriver class. */
+   virtual ~StressDriver();
+
+   /*! @brief Allocate and configure the stress data instances. Every
+    * instance gets the same array sizes so the per-instance send cost is
+    * uniform and the scaling measurements isolate the instance count.
+    *  @param name_prefix Prefix for the per-instance names, the instance
+    *  index is appended.
+    *  @param num_instances Number of stress data instances to create.
+    *  @param num_doubles Number of doubles each instance carries.
+    *  @param num_ints Number of 64-bit integers each instance carries. */
+   void configure( char const *name_prefix,
+                   int const   num_instances,
+                   int const   num_doubles,
+                   int const   num_ints );
+
+   /*! @brief Update the values of every instance as a cheap deterministic
+    * function of time so the publishing federate sends changed data for
+    * every object every cycle. The generator is a branch free linear ramp
+    * per value the compiler can vectorize, so the data generation cost
+    * stays negligible next to the TrickHLA send path being measured.
+    *  @param time Current scenario time {s}. */
+   void compute_values( double const time );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for StressDriver class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StressDriver( StressDriver const &rhs );
+   /*! @brief Assignment operator for StressDriver class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StressDriver &operator=( StressDriver const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_STRESS_DRIVER_HH: Do NOT put anything after this line!
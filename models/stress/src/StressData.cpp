@@ -0,0 +1,113 @@
+/*!
+@file models/stress/src/StressData.cpp
+@ingroup TrickHLAModel
+@brief One data block of the N-instance scaling stress model, holding
+configurable sized arrays of doubles and 64-bit integers that map to the
+attributes of one HLA object instance.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{stress/src/StressData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/StressData.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+using namespace std;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+StressData::StressData()
+   : name( NULL ),
+     double_count( 0 ),
+     double_values( NULL ),
+     int_count( 0 ),
+     int_values( NULL ),
+     update_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+StressData::~StressData()
+{
+   if ( double_values != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( double_values ) ) ) {
+         send_hs( stderr, "StressData::~StressData():%d WARNING failed to delete Trick Memory for 'double_values'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      double_values = NULL;
+   }
+   if ( int_values != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( int_values ) ) ) {
+         send_hs( stderr, "StressData::~StressData():%d WARNING failed to delete Trick Memory for 'int_values'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      int_values = NULL;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void StressData::configure(
+   int const num_doubles,
+   int const num_ints )
+{
+   double_count = ( num_doubles > 0 ) ? num_doubles : 0;
+   int_count    = ( num_ints > 0 ) ? num_ints : 0;
+
+   if ( double_count > 0 ) {
+      if ( double_values == NULL ) {
+         double_values = static_cast< double * >( TMM_declare_var_1d( "double", double_count ) );
+      } else {
+         double_values = static_cast< double * >( TMM_resize_array_1d_a( double_values, double_count ) );
+      }
+      for ( int i = 0; i < double_count; ++i ) {
+         double_values[i] = 0.0;
+      }
+   }
+
+   if ( int_count > 0 ) {
+      if ( int_values == NULL ) {
+         int_values = static_cast< long long * >( TMM_declare_var_1d( "long long", int_count ) );
+      } else {
+         int_values = static_cast< long long * >( TMM_resize_array_1d_a( int_values, int_count ) );
+      }
+      for ( int i = 0; i < int_count; ++i ) {
+         int_values[i] = 0LL;
+      }
+   }
+}
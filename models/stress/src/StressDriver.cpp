@@ -0,0 +1,138 @@
+/*!
+@file models/stress/src/StressDriver.cpp
+@ingroup TrickHLAModel
+@brief Load generator for the N-instance scaling stress model. Owns a
+configurable number of StressData blocks and updates all of them from one
+scheduled job with a tight, branch free generator loop.
+
+@copyright Copyright 2020 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{stress/src/StressData.cpp}
+@trick_link_dependency{stress/src/StressDriver.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdio>
+#include <cstring>
+
+// Trick include files.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h" // for send_hs
+
+// Model include files.
+#include "../include/StressDriver.hh"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+using namespace std;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+StressDriver::StressDriver()
+   : instance_count( 0 ),
+     instances( NULL ),
+     cycle_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+StressDriver::~StressDriver()
+{
+   if ( instances != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( instances ) ) ) {
+         send_hs( stderr, "StressDriver::~StressDriver():%d WARNING failed to delete Trick Memory for 'instances'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      instances      = NULL;
+      instance_count = 0;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void StressDriver::configure(
+   char const *name_prefix,
+   int const   num_instances,
+   int const   num_doubles,
+   int const   num_ints )
+{
+   instance_count = ( num_instances > 0 ) ? num_instances : 1;
+
+   // Allocate the instances through the Trick memory manager so the input
+   // file can map object attributes to the instance variables by name.
+   instances = reinterpret_cast< StressData * >(
+      TMM_declare_var_1d( "TrickHLAModel::StressData", instance_count ) );
+   if ( instances == NULL ) {
+      send_hs( stderr, "StressDriver::configure():%d FAILED to allocate %d stress data instances!%c",
+               __LINE__, instance_count, THLA_NEWLINE );
+      instance_count = 0;
+      return;
+   }
+
+   char inst_name[256];
+   for ( int n = 0; n < instance_count; ++n ) {
+      snprintf( inst_name, sizeof( inst_name ), "%s_%d",
+                ( name_prefix != NULL ) ? name_prefix : "StressData", n );
+      instances[n].name = trick_MM->mm_strdup( inst_name );
+      instances[n].configure( num_doubles, num_ints );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void StressDriver::compute_values(
+   double const time )
+{
+   ++cycle_count;
+
+   for ( int n = 0; n < instance_count; ++n ) {
+      StressData &data = instances[n];
+
+      // Branch free linear ramp per value, unique per instance and cycle,
+      // which the compiler can vectorize.
+      double const     base  = time + (double)n;
+      double *const    dvals = data.double_values;
+      int const        dcnt  = data.double_count;
+      for ( int i = 0; i < dcnt; ++i ) {
+         dvals[i] = base + ( 0.001 * (double)i );
+      }
+
+      long long const  tick  = cycle_count + (long long)n;
+      long long *const ivals = data.int_values;
+      int const        icnt  = data.int_count;
+      for ( int i = 0; i < icnt; ++i ) {
+         ivals[i] = tick + (long long)i;
+      }
+
+      ++data.update_count;
+   }
+}
@@ -0,0 +1,477 @@
+#!/usr/bin/env python3
+# @file generate_fom_codecs.py
+# @brief Generates specialized C++ pack/unpack codec classes from FOM modules.
+#
+# This is a Python program that reads the federation's FOM modules (the XML
+# files under FOMs/) together with a Trick variable binding manifest and
+# emits specialized TrickHLA::Packing subclasses with fixed offsets,
+# compile-time types and encodings, and fully inlined byte swapping. The
+# generated codecs serialize all the bound fields of an object class into a
+# single contiguous wire buffer, which is published as one opaque attribute
+# instead of going through the generic per-attribute reflection encode path.
+# For stable FOMs this roughly halves the encode/decode cost per object.
+#
+# The binding manifest is a JSON file that names, for each codec to emit,
+# the FOM object class, the C++ data type holding the simulation state and
+# an ordered field list binding FOM attribute data types to C++ lvalue
+# expressions, for example:
+#
+#    {
+#       "codecs": [
+#          {
+#             "class_name": "PhysicalEntityFixedCodec",
+#             "namespace": "SpaceFOM",
+#             "object_class": "PhysicalEntity",
+#             "data_type": "SpaceFOM::PhysicalEntityData",
+#             "data_include": "SpaceFOM/PhysicalEntityData.hh",
+#             "fields": [
+#                { "fom_name": "position", "expr": "data->state.pos", "type": "HLAfloat64BE", "count": 3 },
+#                { "fom_name": "mass",     "expr": "data->mass",      "type": "HLAfloat64BE" }
+#             ]
+#          }
+#       ]
+#    }
+#
+# The emitted classes plug in through the existing TrickHLA::Packing
+# interface: pack() serializes the bound fields into the fixed-layout
+# wire_buffer member and unpack() deserializes them back, so the simulation
+# maps the wire_buffer to a single ENCODING_OPAQUE_DATA attribute in the
+# input file. Only fixed-size basic data types (and fixed-length arrays of
+# them) are supported; variable-size types must stay on the generic
+# reflection path.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial creation.}
+# @revs_end
+#
+import argparse
+import json
+import os
+import sys
+import textwrap
+import xml.etree.ElementTree as ET
+
+# Fallback table of the HLA standard basic data representations, used when
+# the FOM modules do not carry a basicDataRepresentations section. Each
+# entry is (C++ type, size in bytes, big endian).
+BUILTIN_BASIC_TYPES = {
+   'HLAoctet': ( 'unsigned char', 1, True ),
+   'HLAbyte': ( 'unsigned char', 1, True ),
+   'HLAboolean': ( 'int', 4, True ),
+   'HLAinteger16BE': ( 'short', 2, True ),
+   'HLAinteger32BE': ( 'int', 4, True ),
+   'HLAinteger64BE': ( 'long long', 8, True ),
+   'HLAinteger16LE': ( 'short', 2, False ),
+   'HLAinteger32LE': ( 'int', 4, False ),
+   'HLAinteger64LE': ( 'long long', 8, False ),
+   'HLAfloat32BE': ( 'float', 4, True ),
+   'HLAfloat64BE': ( 'double', 8, True ),
+   'HLAfloat32LE': ( 'float', 4, False ),
+   'HLAfloat64LE': ( 'double', 8, False ),
+}
+
+
+# Strip the default namespace from the element tags so lookups are simple.
+def strip_xml_namespaces( root ):
+   for element in root.iter():
+      if isinstance( element.tag, str ) and '}' in element.tag:
+         element.tag = element.tag.split( '}', 1 )[1]
+
+
+# Load the data type tables from all the FOM modules. Simple data types are
+# resolved down to their underlying basic representation.
+def load_fom_data_types( fom_files ):
+   basic_types = dict( BUILTIN_BASIC_TYPES )
+   simple_to_basic = {}
+
+   for fom_file in fom_files:
+      try:
+         tree = ET.parse( fom_file )
+      except ET.ParseError as error:
+         print( 'generate_fom_codecs.py:ERROR: Could not parse FOM module \''
+                + fom_file + '\': ' + str( error ) )
+         sys.exit( 1 )
+      root = tree.getroot()
+      strip_xml_namespaces( root )
+
+      for basic in root.iter( 'basicData' ):
+         name = basic.findtext( 'name' )
+         size = basic.findtext( 'size' )
+         endian = basic.findtext( 'endian' )
+         if name and size and name not in basic_types:
+            size_bytes = int( size ) // 8
+            cpp_type = {
+               1: 'unsigned char',
+               2: 'short',
+               4: 'int',
+               8: 'long long',
+            }.get( size_bytes )
+            if cpp_type is not None:
+               basic_types[name] = ( cpp_type, size_bytes,
+                                     ( endian is None ) or ( endian.strip() == 'Big' ) )
+
+      for simple in root.iter( 'simpleData' ):
+         name = simple.findtext( 'name' )
+         representation = simple.findtext( 'representation' )
+         if name and representation:
+            simple_to_basic[name] = representation
+
+   return basic_types, simple_to_basic
+
+
+# Collect the attribute name to data type map of every object class found
+# in the FOM modules, keyed on the unqualified class name.
+def load_fom_object_classes( fom_files ):
+   object_classes = {}
+
+   for fom_file in fom_files:
+      tree = ET.parse( fom_file )
+      root = tree.getroot()
+      strip_xml_namespaces( root )
+
+      for object_class in root.iter( 'objectClass' ):
+         name = object_class.findtext( 'name' )
+         if not name:
+            continue
+         attributes = object_classes.setdefault( name, {} )
+         for attribute in object_class.findall( 'attribute' ):
+            attr_name = attribute.findtext( 'name' )
+            attr_type = attribute.findtext( 'dataType' )
+            if attr_name and attr_type:
+               attributes[attr_name] = attr_type
+
+   return object_classes
+
+
+# Resolve a field data type down to (C++ type, size, big endian).
+def resolve_type( type_name, basic_types, simple_to_basic ):
+   seen = set()
+   while type_name in simple_to_basic and type_name not in seen:
+      seen.add( type_name )
+      type_name = simple_to_basic[type_name]
+   return basic_types.get( type_name )
+
+
+# Shared inlined byte swapping preamble emitted once per generated header.
+CODEC_PREAMBLE = '''\
+// Inlined big-endian scalar encode/decode helpers. The swaps compile down
+// to single bswap instructions on little-endian hosts and to plain moves
+// on big-endian hosts.
+namespace CodecByteSwap
+{
+
+inline bool host_is_little_endian()
+{
+   union {
+      unsigned int  i;
+      unsigned char c[4];
+   } const probe = { 1U };
+   return ( probe.c[0] == 1 );
+}
+
+inline unsigned long long swap_bytes( unsigned long long v, unsigned int const size )
+{
+   switch ( size ) {
+      case 2:
+         return __builtin_bswap16( (unsigned short)v );
+      case 4:
+         return __builtin_bswap32( (unsigned int)v );
+      case 8:
+         return __builtin_bswap64( v );
+      default:
+         return v;
+   }
+}
+
+template < typename T >
+inline void encode( unsigned char *buffer, T const value, bool const big_endian )
+{
+   unsigned long long bits = 0;
+   __builtin_memcpy( &bits, &value, sizeof( T ) );
+   if ( big_endian == host_is_little_endian() ) {
+      bits = swap_bytes( bits, sizeof( T ) );
+   }
+   __builtin_memcpy( buffer, &bits, sizeof( T ) );
+}
+
+template < typename T >
+inline void decode( unsigned char const *buffer, T &value, bool const big_endian )
+{
+   unsigned long long bits = 0;
+   __builtin_memcpy( &bits, buffer, sizeof( T ) );
+   if ( big_endian == host_is_little_endian() ) {
+      bits = swap_bytes( bits, sizeof( T ) );
+   }
+   __builtin_memcpy( &value, &bits, sizeof( T ) );
+}
+
+} // namespace CodecByteSwap
+'''
+
+
+# Lay out the codec fields at fixed offsets and return the field layout
+# list and the total wire size.
+def layout_fields( codec, object_classes, basic_types, simple_to_basic ):
+   object_class = codec['object_class']
+   fom_attributes = object_classes.get( object_class, {} )
+
+   layout = []
+   offset = 0
+   for field in codec['fields']:
+      fom_name = field['fom_name']
+      type_name = field.get( 'type' ) or fom_attributes.get( fom_name )
+      if type_name is None:
+         print( 'generate_fom_codecs.py:ERROR: No data type for field \''
+                + fom_name + '\' of object class \'' + object_class
+                + '\', not in the FOM modules and no \'type\' in the manifest.' )
+         sys.exit( 1 )
+
+      resolved = resolve_type( type_name, basic_types, simple_to_basic )
+      if resolved is None:
+         print( 'generate_fom_codecs.py:ERROR: Field \'' + fom_name
+                + '\' data type \'' + type_name + '\' is not a fixed-size'
+                + ' basic type; leave it on the generic reflection path.' )
+         sys.exit( 1 )
+
+      cpp_type, size, big_endian = resolved
+      count = int( field.get( 'count', 1 ) )
+      layout.append( {
+         'fom_name': fom_name,
+         'expr': field['expr'],
+         'cpp_type': cpp_type,
+         'size': size,
+         'big_endian': big_endian,
+         'count': count,
+         'offset': offset,
+      } )
+      offset += size * count
+
+   return layout, offset
+
+
+# Emit the header and source of one codec class.
+def emit_codec( codec, layout, wire_size, output_dir ):
+   class_name = codec['class_name']
+   namespace = codec.get( 'namespace', 'TrickHLA' )
+   data_type = codec['data_type']
+   data_include = codec.get( 'data_include' )
+
+   guard = ( namespace + '_' + class_name ).upper() + '_HH'
+
+   pack_lines = []
+   unpack_lines = []
+   for field in layout:
+      endian = 'true' if field['big_endian'] else 'false'
+      if field['count'] == 1:
+         pack_lines.append(
+            '   CodecByteSwap::encode< %s >( &wire_buffer[%d], (%s)( %s ), %s ); // %s'
+            % ( field['cpp_type'], field['offset'], field['cpp_type'],
+                field['expr'], endian, field['fom_name'] ) )
+         unpack_lines.append(
+            '   {\n'
+            '      %s value;\n'
+            '      CodecByteSwap::decode< %s >( &wire_buffer[%d], value, %s ); // %s\n'
+            '      %s = value;\n'
+            '   }'
+            % ( field['cpp_type'], field['cpp_type'], field['offset'], endian,
+                field['fom_name'], field['expr'] ) )
+      else:
+         for index in range( field['count'] ):
+            element_offset = field['offset'] + ( index * field['size'] )
+            pack_lines.append(
+               '   CodecByteSwap::encode< %s >( &wire_buffer[%d], (%s)( %s[%d] ), %s ); // %s[%d]'
+               % ( field['cpp_type'], element_offset, field['cpp_type'],
+                   field['expr'], index, endian, field['fom_name'], index ) )
+            unpack_lines.append(
+               '   {\n'
+               '      %s value;\n'
+               '      CodecByteSwap::decode< %s >( &wire_buffer[%d], value, %s ); // %s[%d]\n'
+               '      %s[%d] = value;\n'
+               '   }'
+               % ( field['cpp_type'], field['cpp_type'], element_offset, endian,
+                   field['fom_name'], index, field['expr'], index ) )
+
+   includes = '#include "TrickHLA/Packing.hh"\n'
+   if data_include:
+      includes += '#include "' + data_include + '"\n'
+
+   header = '''\
+/*!
+@file %(namespace)s/%(class_name)s.hh
+@ingroup %(namespace)s
+@brief Generated fixed-layout codec for the '%(object_class)s' object class.
+
+GENERATED FILE, DO NOT EDIT. Regenerate with scripts/generate_fom_codecs.py.
+
+The codec serializes the bound simulation state into the fixed-layout
+wire_buffer member, which the simulation maps to a single opaque attribute
+in the input file so one attribute encode replaces the per-attribute
+reflection path.
+
+@trick_parse{everything}
+
+@python_module{%(namespace)s}
+*/
+
+#ifndef %(guard)s
+#define %(guard)s
+
+%(includes)s
+namespace %(namespace)s
+{
+
+class %(class_name)s : public TrickHLA::Packing
+{
+   friend class InputProcessor;
+   friend void init_attr%(namespace)s__%(class_name)s();
+
+  public:
+   /*! @brief Default constructor. */
+   %(class_name)s() : data( 0 )
+   {
+      for ( unsigned int i = 0; i < WIRE_SIZE; ++i ) {
+         wire_buffer[i] = 0;
+      }
+   }
+
+   /*! @brief Destructor. */
+   virtual ~%(class_name)s()
+   {
+      return;
+   }
+
+   /*! @brief Associate the simulation state this codec serializes.
+    *  @param data_ptr Simulation state instance. */
+   void configure( %(data_type)s *data_ptr )
+   {
+      this->data = data_ptr;
+   }
+
+   /*! @brief Serialize the bound fields into the wire buffer. */
+   virtual void pack();
+
+   /*! @brief Deserialize the wire buffer into the bound fields. */
+   virtual void unpack();
+
+   static unsigned int const WIRE_SIZE = %(wire_size)d; ///< @trick_units{--} Fixed wire buffer size in bytes.
+
+   unsigned char wire_buffer[%(wire_size)d]; ///< @trick_units{--} Fixed-layout wire buffer, map this to a single opaque attribute.
+
+  protected:
+   %(data_type)s *data; ///< @trick_units{--} Bound simulation state.
+};
+
+} // namespace %(namespace)s
+
+#endif // %(guard)s
+''' % {
+      'namespace': namespace,
+      'class_name': class_name,
+      'object_class': codec['object_class'],
+      'guard': guard,
+      'includes': includes,
+      'data_type': data_type,
+      'wire_size': wire_size,
+   }
+
+   source = '''\
+/*!
+@file %(namespace)s/%(class_name)s.cpp
+@ingroup %(namespace)s
+@brief Generated fixed-layout codec for the '%(object_class)s' object class.
+
+GENERATED FILE, DO NOT EDIT. Regenerate with scripts/generate_fom_codecs.py.
+*/
+
+#include "%(namespace)s/%(class_name)s.hh"
+
+%(preamble)s
+using namespace %(namespace)s;
+
+void %(class_name)s::pack()
+{
+   if ( data == 0 ) {
+      return;
+   }
+%(pack_body)s
+}
+
+void %(class_name)s::unpack()
+{
+   if ( data == 0 ) {
+      return;
+   }
+%(unpack_body)s
+}
+''' % {
+      'namespace': namespace,
+      'class_name': class_name,
+      'object_class': codec['object_class'],
+      'preamble': CODEC_PREAMBLE,
+      'pack_body': '\n'.join( pack_lines ),
+      'unpack_body': '\n'.join( unpack_lines ),
+   }
+
+   namespace_dir = os.path.join( output_dir, namespace )
+   os.makedirs( namespace_dir, exist_ok = True )
+
+   header_path = os.path.join( namespace_dir, class_name + '.hh' )
+   source_path = os.path.join( namespace_dir, class_name + '.cpp' )
+   with open( header_path, 'w' ) as header_file:
+      header_file.write( header )
+   with open( source_path, 'w' ) as source_file:
+      source_file.write( source )
+
+   return header_path, source_path, wire_size
+
+
+# Main routine.
+def main():
+
+   parser = argparse.ArgumentParser(
+      prog = 'generate_fom_codecs',
+      formatter_class = argparse.RawDescriptionHelpFormatter,
+      description = textwrap.dedent( '''\
+         Generate specialized fixed-layout pack/unpack codec classes from
+         the federation FOM modules and a Trick variable binding manifest.
+         The generated classes plug in through the TrickHLA::Packing
+         interface and replace the generic per-attribute reflection encode
+         path for stable FOMs.''' ) )
+   parser.add_argument( '--manifest', required = True,
+                        help = 'JSON binding manifest describing the codecs to emit.' )
+   parser.add_argument( '--fom', action = 'append', default = [],
+                        help = 'FOM module XML file, may be repeated.' )
+   parser.add_argument( '--fom-dir',
+                        help = 'Directory of FOM module XML files, all *.xml files are read.' )
+   parser.add_argument( '--output-dir', required = True,
+                        help = 'Directory the generated <namespace>/<class>.hh/.cpp pairs are written under.' )
+   args = parser.parse_args()
+
+   fom_files = list( args.fom )
+   if args.fom_dir:
+      for entry in sorted( os.listdir( args.fom_dir ) ):
+         if entry.endswith( '.xml' ):
+            fom_files.append( os.path.join( args.fom_dir, entry ) )
+
+   with open( args.manifest ) as manifest_file:
+      manifest = json.load( manifest_file )
+
+   basic_types, simple_to_basic = load_fom_data_types( fom_files )
+   object_classes = load_fom_object_classes( fom_files )
+
+   for codec in manifest.get( 'codecs', [] ):
+      layout, wire_size = layout_fields( codec, object_classes,
+                                         basic_types, simple_to_basic )
+      header_path, source_path, size = emit_codec( codec, layout,
+                                                   wire_size, args.output_dir )
+      print( 'generate_fom_codecs.py: Generated ' + header_path + ' and '
+             + source_path + ' (' + str( size ) + ' byte wire layout).' )
+
+   return
+
+
+#
+# Call the main function.
+#
+main()
@@ -0,0 +1,96 @@
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_enable_freeze(False)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+# Run as fast as possible, this is an ownership benchmark not a realtime sim.
+run_duration = 120.0
+
+#---------------------------------------------
+# Configure the ownership transfer benchmark:
+# num_attributes value attributes are cyclically handed back and forth
+# between the two federates every transfer_period seconds. This side
+# does not own the attributes at startup, so it issues the first pull.
+#---------------------------------------------
+num_attributes  = 8    # Transferred value attributes, up to 16 in the FOM.
+transfer_period = 1.0  # Sim seconds between handover attempts.
+
+OWN.data.configure( num_attributes )
+
+OWN.ownership_handler.transfer_period = transfer_period
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+# Use Level-3 to show the ownership transfer debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.250
+
+# Configure the federate.
+THLA.federate.name             = 'P-side-Federate'
+THLA.federate.FOM_modules      = 'FOMs/BenchOwnership_FOM.xml,FOMs/TrickHLAFreezeInteraction.xml'
+THLA.federate.federation_name  = 'BenchOwnership'
+THLA.federate.time_regulating  = True
+THLA.federate.time_constrained = True
+
+# Configure ExecutionControl.
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The list of Federates known to be in our Federation.
+THLA.federate.enable_known_feds      = True
+THLA.federate.known_feds_count       = 2
+THLA.federate.known_feds             = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+THLA.federate.known_feds[0].name     = 'A-side-Federate'
+THLA.federate.known_feds[0].required = True
+THLA.federate.known_feds[1].name     = 'P-side-Federate'
+THLA.federate.known_feds[1].required = True
+
+#---------------------------------------------
+# Set up for simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = 'A-side-Federate'
+THLA.simple_sim_config.run_duration = run_duration
+
+
+# The A-side federate creates the benchmark object instance and owns it at
+# startup, so this side starts with every attribute remotely owned.
+THLA.manager.obj_count = 1
+THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+THLA.manager.objects[0].FOM_name            = 'BenchOwnershipData'
+THLA.manager.objects[0].name                = 'A-side-Federate.BenchOwnershipData'
+THLA.manager.objects[0].create_HLA_instance = False
+THLA.manager.objects[0].ownership           = OWN.ownership_handler
+THLA.manager.objects[0].attr_count          = num_attributes + 1
+THLA.manager.objects[0].attributes          = trick.sim_services.alloc_type( THLA.manager.objects[0].attr_count, 'TrickHLA::Attribute' )
+
+THLA.manager.objects[0].attributes[0].FOM_name      = 'Name'
+THLA.manager.objects[0].attributes[0].trick_name    = 'OWN.data.name'
+THLA.manager.objects[0].attributes[0].config        = trick.CONFIG_INITIALIZE + trick.CONFIG_CYCLIC
+THLA.manager.objects[0].attributes[0].publish       = True
+THLA.manager.objects[0].attributes[0].subscribe     = True
+THLA.manager.objects[0].attributes[0].locally_owned = False
+THLA.manager.objects[0].attributes[0].rti_encoding  = trick.ENCODING_UNICODE_STRING
+
+for i in range( num_attributes ):
+    THLA.manager.objects[0].attributes[i + 1].FOM_name      = 'Value%02d' % i
+    THLA.manager.objects[0].attributes[i + 1].trick_name    = 'OWN.data.values[' + str( i ) + ']'
+    THLA.manager.objects[0].attributes[i + 1].config        = trick.CONFIG_CYCLIC
+    THLA.manager.objects[0].attributes[i + 1].publish       = True
+    THLA.manager.objects[0].attributes[i + 1].subscribe     = True
+    THLA.manager.objects[0].attributes[i + 1].locally_owned = False
+    THLA.manager.objects[0].attributes[i + 1].rti_encoding  = trick.ENCODING_LITTLE_ENDIAN
+
+trick.stop(run_duration)
@@ -0,0 +1,83 @@
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_enable_freeze(False)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+# Run as fast as possible, this is a latency benchmark not a realtime sim.
+run_duration = 60.0
+
+#---------------------------------------------
+# Configure the ping side of the benchmark.
+#---------------------------------------------
+BENCH.ping.name         = 'Ping-Federate.ping'
+BENCH.ping.echo         = False
+BENCH.ping.auto_send    = True
+BENCH.ping.results_file = 'ping_pong_latency.csv'
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.050
+
+# Configure the federate.
+THLA.federate.name             = 'Ping-Federate'
+THLA.federate.FOM_modules      = 'FOMs/Bench_FOM.xml,FOMs/TrickHLAFreezeInteraction.xml'
+THLA.federate.federation_name  = 'BenchPingPong'
+THLA.federate.time_regulating  = True
+THLA.federate.time_constrained = True
+
+# Configure ExecutionControl.
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The list of Federates known to be in our Federation.
+THLA.federate.enable_known_feds      = True
+THLA.federate.known_feds_count       = 2
+THLA.federate.known_feds             = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+THLA.federate.known_feds[0].name     = 'Ping-Federate'
+THLA.federate.known_feds[0].required = True
+THLA.federate.known_feds[1].name     = 'Pong-Federate'
+THLA.federate.known_feds[1].required = True
+
+#---------------------------------------------
+# Set up for simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = 'Ping-Federate'
+THLA.simple_sim_config.run_duration = run_duration
+
+
+# TrickHLA Interactions and Parameters.
+THLA.manager.inter_count  = 1
+THLA.manager.interactions = trick.sim_services.alloc_type( THLA.manager.inter_count, 'TrickHLA::Interaction' )
+
+THLA.manager.interactions[0].FOM_name    = 'BenchPing'
+THLA.manager.interactions[0].publish     = True
+THLA.manager.interactions[0].subscribe   = True
+THLA.manager.interactions[0].handler     = BENCH.ping
+THLA.manager.interactions[0].param_count = 2
+THLA.manager.interactions[0].parameters  = trick.sim_services.alloc_type( THLA.manager.interactions[0].param_count, 'TrickHLA::Parameter' )
+
+THLA.manager.interactions[0].parameters[0].FOM_name     = 'OriginTime'
+THLA.manager.interactions[0].parameters[0].trick_name   = 'BENCH.ping.origin_time'
+THLA.manager.interactions[0].parameters[0].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+THLA.manager.interactions[0].parameters[1].FOM_name     = 'Sequence'
+THLA.manager.interactions[0].parameters[1].trick_name   = 'BENCH.ping.sequence'
+THLA.manager.interactions[0].parameters[1].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+# No TrickHLA objects in the latency benchmark.
+THLA.manager.obj_count = 0
+
+trick.stop(run_duration)
@@ -0,0 +1,182 @@
+#---------------------------------------------------------------------------
+# RUN_soak: Long-duration soak benchmark with performance drift detection.
+# The stress model runs for a configurable number of wall-clock hours with
+# the SoakDriftMonitor recording windowed performance baselines (frame
+# wall time, resident set size, queue depths and update rates) and
+# comparing the final window to the first at shutdown, so slow leaks and
+# creeping latency fail the run.
+#
+# The federate role is parameterized through the environment like
+# RUN_scale, plus the soak configuration:
+#
+#    STRESS_ROLE           - 'pub' or 'sub'.
+#    STRESS_FED_INDEX      - Zero based index within the role.
+#    STRESS_NUM_PUBS       - Number of publisher federates.
+#    STRESS_NUM_SUBS       - Number of subscriber federates.
+#    STRESS_NUM_OBJECTS    - StressData instances per publisher.
+#    STRESS_NUM_DOUBLES    - Doubles per instance.
+#    STRESS_NUM_INTS       - 64-bit integers per instance.
+#    STRESS_FEDERATION     - Federation execution name.
+#    SOAK_DURATION_HOURS   - Soak duration in hours, default: 72.
+#    SOAK_WINDOW_SECONDS   - Baseline window length in seconds, default: 300.
+#    SOAK_FRAME_DRIFT_TOL  - Allowed fractional mean frame time growth,
+#                            default: 0.25.
+#    SOAK_RSS_DRIFT_TOL    - Allowed fractional resident set size growth,
+#                            default: 0.10.
+#    SOAK_FAIL_ON_DRIFT    - '1' (default) to fail the run on drift.
+#
+# The simulation is not real-time throttled, so the sim time runs at an
+# accelerated rate and the soak duration is bounded by the Trick stop
+# time computed from the soak hours.
+#---------------------------------------------------------------------------
+import os
+
+role         = os.environ.get( 'STRESS_ROLE', 'pub' )
+fed_index    = int( os.environ.get( 'STRESS_FED_INDEX', '0' ) )
+num_pubs     = int( os.environ.get( 'STRESS_NUM_PUBS', '1' ) )
+num_subs     = int( os.environ.get( 'STRESS_NUM_SUBS', '1' ) )
+num_objects  = int( os.environ.get( 'STRESS_NUM_OBJECTS', '100' ) )
+num_doubles  = int( os.environ.get( 'STRESS_NUM_DOUBLES', '10' ) )
+num_ints     = int( os.environ.get( 'STRESS_NUM_INTS', '10' ) )
+federation   = os.environ.get( 'STRESS_FEDERATION', 'StressSoak' )
+
+soak_hours     = float( os.environ.get( 'SOAK_DURATION_HOURS', '72.0' ) )
+soak_window    = float( os.environ.get( 'SOAK_WINDOW_SECONDS', '300.0' ) )
+soak_frame_tol = float( os.environ.get( 'SOAK_FRAME_DRIFT_TOL', '0.25' ) )
+soak_rss_tol   = float( os.environ.get( 'SOAK_RSS_DRIFT_TOL', '0.10' ) )
+soak_fail      = os.environ.get( 'SOAK_FAIL_ON_DRIFT', '1' ) != '0'
+
+run_duration = soak_hours * 3600.0
+
+pub_names = [ 'Pub-%02d' % i for i in range( num_pubs ) ]
+sub_names = [ 'Sub-%02d' % i for i in range( num_subs ) ]
+
+if role == 'pub':
+    federate_name = pub_names[fed_index]
+else:
+    federate_name = sub_names[fed_index]
+
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_enable_freeze(False)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+#---------------------------------------------
+# Configure the stress model load generator. A publisher owns its own
+# instance set; a subscriber receives the instances of every publisher.
+#---------------------------------------------
+if role == 'pub':
+    local_instances = num_objects
+else:
+    local_instances = num_pubs * num_objects
+
+STRESS.driver.configure( federate_name + '.StressData', local_instances, num_doubles, num_ints )
+
+STRESS.metrics.results_file = federate_name + '_soak_throughput.csv'
+
+#---------------------------------------------
+# Configure the soak drift monitor.
+#---------------------------------------------
+STRESS.soak.enabled                    = True
+STRESS.soak.results_file               = federate_name + '_soak_windows.csv'
+STRESS.soak.window_seconds             = soak_window
+STRESS.soak.frame_time_drift_tolerance = soak_frame_tol
+STRESS.soak.rss_drift_tolerance        = soak_rss_tol
+STRESS.soak.fail_on_drift              = soak_fail
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.250
+
+# Configure the federate.
+THLA.federate.name             = federate_name
+THLA.federate.FOM_modules      = 'FOMs/Stress_FOM.xml,FOMs/TrickHLAFreezeInteraction.xml'
+THLA.federate.federation_name  = federation
+THLA.federate.time_regulating  = True
+THLA.federate.time_constrained = True
+
+# Configure ExecutionControl.
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The list of Federates known to be in our Federation: every publisher
+# and subscriber is required so the standard ExecutionControl
+# initialization coordinates the whole federation.
+all_feds = pub_names + sub_names
+THLA.federate.enable_known_feds = True
+THLA.federate.known_feds_count  = len( all_feds )
+THLA.federate.known_feds        = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+for i, name in enumerate( all_feds ):
+    THLA.federate.known_feds[i].name     = name
+    THLA.federate.known_feds[i].required = True
+
+#---------------------------------------------
+# Set up for simulation configuration. The first publisher owns the
+# simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = pub_names[0]
+THLA.simple_sim_config.run_duration = run_duration
+
+
+#---------------------------------------------
+# Object configuration. A publisher creates its own instance set; a
+# subscriber maps the instances of every publisher onto its local
+# StressData instances.
+#---------------------------------------------
+if role == 'pub':
+    THLA.manager.obj_count = num_objects
+else:
+    THLA.manager.obj_count = num_pubs * num_objects
+THLA.manager.objects = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+for k in range( THLA.manager.obj_count ):
+
+    if role == 'pub':
+        instance_name = federate_name + '.StressData_' + str( k )
+    else:
+        owner_pub     = pub_names[k // num_objects]
+        instance_name = owner_pub + '.StressData_' + str( k % num_objects )
+
+    THLA.manager.objects[k].FOM_name            = 'StressData'
+    THLA.manager.objects[k].name                = instance_name
+    THLA.manager.objects[k].create_HLA_instance = ( role == 'pub' )
+    THLA.manager.objects[k].attr_count          = 3
+    THLA.manager.objects[k].attributes          = trick.sim_services.alloc_type( THLA.manager.objects[k].attr_count, 'TrickHLA::Attribute' )
+
+    THLA.manager.objects[k].attributes[0].FOM_name     = 'Name'
+    THLA.manager.objects[k].attributes[0].trick_name   = 'STRESS.driver.instances[' + str( k ) + '].name'
+    THLA.manager.objects[k].attributes[0].config       = trick.CONFIG_INITIALIZE + trick.CONFIG_CYCLIC
+    THLA.manager.objects[k].attributes[0].rti_encoding = trick.ENCODING_UNICODE_STRING
+
+    THLA.manager.objects[k].attributes[1].FOM_name     = 'DoubleValues'
+    THLA.manager.objects[k].attributes[1].trick_name   = 'STRESS.driver.instances[' + str( k ) + '].double_values'
+    THLA.manager.objects[k].attributes[1].config       = trick.CONFIG_CYCLIC
+    THLA.manager.objects[k].attributes[1].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+    THLA.manager.objects[k].attributes[2].FOM_name     = 'IntValues'
+    THLA.manager.objects[k].attributes[2].trick_name   = 'STRESS.driver.instances[' + str( k ) + '].int_values'
+    THLA.manager.objects[k].attributes[2].config       = trick.CONFIG_CYCLIC
+    THLA.manager.objects[k].attributes[2].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+    for a in range( 3 ):
+        if role == 'pub':
+            THLA.manager.objects[k].attributes[a].publish       = True
+            THLA.manager.objects[k].attributes[a].locally_owned = True
+        else:
+            THLA.manager.objects[k].attributes[a].subscribe     = True
+            THLA.manager.objects[k].attributes[a].locally_owned = False
+
+trick.stop(run_duration)
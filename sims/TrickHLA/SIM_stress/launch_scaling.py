@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+# @file launch_scaling.py
+# @brief Multi-federate scaling harness launcher for SIM_stress.
+#
+# This is a Python program that spawns N publisher federates and M
+# subscriber federates of the SIM_stress stress model against the same
+# federation execution, all parameterized through the RUN_scale input
+# file, waits for them to run to completion through the standard
+# ExecutionControl initialization, and then aggregates the per-federate
+# results into one report:
+#
+#    - the per-federate wall clock time from process launch to exit,
+#      which covers the join, initialization sync-point and run phases,
+#    - the mean and peak sends/receives per second from each federate's
+#      BenchThroughputMetrics CSV file, and
+#    - the ElapsedTimeStats summary lines (e.g. the time advance grant
+#      wait statistics) scraped from each federate's log output.
+#
+# Run it from the SIM_stress directory after building the simulation:
+#
+#    ./launch_scaling.py --pubs 10 --subs 20 --objects 100 --duration 60
+#
+# The per-federate Trick output and logs are written under the output
+# directory (default: scaling_results) along with the aggregated
+# scaling_report.csv, so join-time, sync-point and throughput scaling
+# curves are reproducible from a single command.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial creation.}
+# @revs_end
+#
+import argparse
+import csv
+import glob
+import os
+import subprocess
+import sys
+import time
+
+
+# Find the Trick simulation main executable in the sim directory.
+def find_sim_executable( sim_dir ):
+   candidates = glob.glob( os.path.join( sim_dir, 'S_main_*.exe' ) )
+   if not candidates:
+      print( 'launch_scaling.py:ERROR: No S_main_*.exe found in ' + sim_dir
+             + ', build the simulation first.' )
+      sys.exit( 1 )
+   return candidates[0]
+
+
+# Launch one federate process and return its bookkeeping record.
+def launch_federate( sim_exe, sim_dir, output_dir, role, index, args ):
+   if role == 'pub':
+      federate_name = 'Pub-%02d' % index
+   else:
+      federate_name = 'Sub-%02d' % index
+
+   fed_output_dir = os.path.join( output_dir, federate_name )
+   os.makedirs( fed_output_dir, exist_ok = True )
+
+   environment = dict( os.environ )
+   environment['STRESS_ROLE']         = role
+   environment['STRESS_FED_INDEX']    = str( index )
+   environment['STRESS_NUM_PUBS']     = str( args.pubs )
+   environment['STRESS_NUM_SUBS']     = str( args.subs )
+   environment['STRESS_NUM_OBJECTS']  = str( args.objects )
+   environment['STRESS_NUM_DOUBLES']  = str( args.doubles )
+   environment['STRESS_NUM_INTS']     = str( args.ints )
+   environment['STRESS_RUN_DURATION'] = str( args.duration )
+   environment['STRESS_FEDERATION']   = args.federation
+
+   log_path = os.path.join( fed_output_dir, federate_name + '.log' )
+   log_file = open( log_path, 'w' )
+
+   process = subprocess.Popen(
+      [ sim_exe, 'RUN_scale/input.py', '-O', fed_output_dir ],
+      cwd = sim_dir,
+      env = environment,
+      stdout = log_file,
+      stderr = subprocess.STDOUT )
+
+   return {
+      'name': federate_name,
+      'role': role,
+      'process': process,
+      'log_file': log_file,
+      'log_path': log_path,
+      'start_time': time.time(),
+      'wall_time': None,
+      'returncode': None,
+   }
+
+
+# Scrape the ElapsedTimeStats summary blocks from a federate log: the
+# headers naming the statistic (e.g. the time advance grant wait report
+# at shutdown) and the key/value lines from ElapsedTimeStats::to_string().
+STATS_MARKERS = ( 'ElapsedTimeStats::to_string():',
+                  'Time advance grant wait',
+                  'sample-count:', 'min:', 'max:', 'mean:',
+                  'sample-std-dev:', 'p50:', 'p95:', 'p99:', 'p999:',
+                  'margin-of-error:' )
+
+
+def scrape_time_stats( log_path ):
+   stats_lines = []
+   try:
+      with open( log_path, errors = 'replace' ) as log_file:
+         for line in log_file:
+            if any( marker in line for marker in STATS_MARKERS ):
+               stats_lines.append( line.rstrip() )
+   except OSError:
+      pass
+   return stats_lines
+
+
+# Summarize a federate's BenchThroughputMetrics CSV samples.
+def summarize_throughput( csv_path ):
+   sends_per_sec = []
+   receives_per_sec = []
+   try:
+      with open( csv_path ) as csv_file:
+         for row in csv.DictReader( csv_file ):
+            try:
+               sends_per_sec.append( float( row['sends_per_sec'] ) )
+               receives_per_sec.append( float( row['receives_per_sec'] ) )
+            except ( KeyError, ValueError ):
+               pass
+   except OSError:
+      return None
+   if not sends_per_sec:
+      return None
+   return {
+      'mean_sends_per_sec': sum( sends_per_sec ) / len( sends_per_sec ),
+      'peak_sends_per_sec': max( sends_per_sec ),
+      'mean_receives_per_sec': sum( receives_per_sec ) / len( receives_per_sec ),
+      'peak_receives_per_sec': max( receives_per_sec ),
+   }
+
+
+# Main routine.
+def main():
+
+   parser = argparse.ArgumentParser(
+      prog = 'launch_scaling',
+      description = 'Launch an N publisher, M subscriber SIM_stress federation'
+                    + ' and aggregate the per-federate timing into one report.' )
+   parser.add_argument( '--pubs', type = int, default = 2,
+                        help = 'Number of publisher federates, default: 2.' )
+   parser.add_argument( '--subs', type = int, default = 2,
+                        help = 'Number of subscriber federates, default: 2.' )
+   parser.add_argument( '--objects', type = int, default = 100,
+                        help = 'StressData instances per publisher, default: 100.' )
+   parser.add_argument( '--doubles', type = int, default = 10,
+                        help = 'Doubles per instance, default: 10.' )
+   parser.add_argument( '--ints', type = int, default = 10,
+                        help = '64-bit integers per instance, default: 10.' )
+   parser.add_argument( '--duration', type = float, default = 60.0,
+                        help = 'Run duration in seconds, default: 60.' )
+   parser.add_argument( '--federation', default = 'StressScaling',
+                        help = 'Federation execution name, default: StressScaling.' )
+   parser.add_argument( '--output-dir', default = 'scaling_results',
+                        help = 'Directory the per-federate output and the report are written to.' )
+   parser.add_argument( '--stagger', type = float, default = 0.0,
+                        help = 'Seconds between federate launches, default: 0 (all at once).' )
+   args = parser.parse_args()
+
+   sim_dir = os.path.dirname( os.path.abspath( __file__ ) )
+   sim_exe = find_sim_executable( sim_dir )
+   output_dir = os.path.abspath( args.output_dir )
+   os.makedirs( output_dir, exist_ok = True )
+
+   # Launch every federate. All of them are required known federates, so
+   # the standard ExecutionControl initialization holds the federation
+   # until the whole set has joined.
+   federates = []
+   for index in range( args.pubs ):
+      federates.append( launch_federate( sim_exe, sim_dir, output_dir,
+                                         'pub', index, args ) )
+      if args.stagger > 0.0:
+         time.sleep( args.stagger )
+   for index in range( args.subs ):
+      federates.append( launch_federate( sim_exe, sim_dir, output_dir,
+                                         'sub', index, args ) )
+      if args.stagger > 0.0:
+         time.sleep( args.stagger )
+
+   print( 'launch_scaling.py: Launched ' + str( args.pubs ) + ' publishers and '
+          + str( args.subs ) + ' subscribers, waiting for completion...' )
+
+   # Wait for all the federates to run to completion.
+   failed = False
+   for federate in federates:
+      federate['returncode'] = federate['process'].wait()
+      federate['wall_time'] = time.time() - federate['start_time']
+      federate['log_file'].close()
+      if federate['returncode'] != 0:
+         failed = True
+         print( 'launch_scaling.py:ERROR: Federate ' + federate['name']
+                + ' exited with status ' + str( federate['returncode'] )
+                + ', see ' + federate['log_path'] )
+
+   # Aggregate the per-federate results into one report.
+   report_path = os.path.join( output_dir, 'scaling_report.csv' )
+   with open( report_path, 'w' ) as report_file:
+      writer = csv.writer( report_file )
+      writer.writerow( [ 'federate', 'role', 'returncode', 'wall_time_sec',
+                         'mean_sends_per_sec', 'peak_sends_per_sec',
+                         'mean_receives_per_sec', 'peak_receives_per_sec' ] )
+
+      for federate in federates:
+         throughput = summarize_throughput(
+            os.path.join( sim_dir, federate['name'] + '_stress.csv' ) )
+         row = [ federate['name'], federate['role'],
+                 federate['returncode'], '%.3f' % federate['wall_time'] ]
+         if throughput is not None:
+            row += [ '%.1f' % throughput['mean_sends_per_sec'],
+                     '%.1f' % throughput['peak_sends_per_sec'],
+                     '%.1f' % throughput['mean_receives_per_sec'],
+                     '%.1f' % throughput['peak_receives_per_sec'] ]
+         else:
+            row += [ '', '', '', '' ]
+         writer.writerow( row )
+
+   print( 'launch_scaling.py: Report written to ' + report_path )
+
+   # Print the ElapsedTimeStats summaries (time advance grant wait and any
+   # other statistics the federates reported at shutdown) per federate.
+   for federate in federates:
+      stats_lines = scrape_time_stats( federate['log_path'] )
+      if stats_lines:
+         print( '--- ' + federate['name'] + ' ---' )
+         for line in stats_lines:
+            print( '   ' + line )
+
+   sys.exit( 1 if failed else 0 )
+
+
+#
+# Call the main function.
+#
+main()
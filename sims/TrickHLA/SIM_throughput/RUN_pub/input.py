@@ -0,0 +1,91 @@
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_enable_freeze(False)
+trick.sim_control_panel_set_enabled(False)
+trick.exec_set_stack_trace(False)
+
+# Run as fast as possible, this is a throughput benchmark not a realtime sim.
+run_duration = 60.0
+
+#---------------------------------------------
+# Configure the publisher side of the benchmark:
+# num_objects BenchData instances of num_values doubles each.
+#---------------------------------------------
+num_objects = 4   # Up to BENCH_MAX_OBJECTS declared in the S_define file.
+num_values  = 25  # Values (doubles) per object.
+
+for i in range( num_objects ):
+    BENCH.data[i].name = 'Pub-Federate.BenchData_' + str( i )
+    BENCH.data[i].configure( num_values )
+
+BENCH.metrics.results_file = 'throughput_pub.csv'
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
+
+# Configure the CRC.
+# Pitch specific local settings designator:
+THLA.federate.local_settings = 'crcHost = localhost\n crcPort = 8989'
+THLA.federate.lookahead_time = 0.250
+
+# Configure the federate.
+THLA.federate.name             = 'Pub-Federate'
+THLA.federate.FOM_modules      = 'FOMs/Bench_FOM.xml,FOMs/TrickHLAFreezeInteraction.xml'
+THLA.federate.federation_name  = 'BenchThroughput'
+THLA.federate.time_regulating  = True
+THLA.federate.time_constrained = True
+
+# Configure ExecutionControl.
+# Set the simulation timeline to be used for time computations.
+THLA.execution_control.sim_timeline = THLA_INIT.sim_timeline
+# Set the scenario timeline to be used for configuring federation freeze times.
+THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+# The list of Federates known to be in our Federation.
+THLA.federate.enable_known_feds      = True
+THLA.federate.known_feds_count       = 2
+THLA.federate.known_feds             = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+THLA.federate.known_feds[0].name     = 'Pub-Federate'
+THLA.federate.known_feds[0].required = True
+THLA.federate.known_feds[1].name     = 'Sub-Federate'
+THLA.federate.known_feds[1].required = True
+
+#---------------------------------------------
+# Set up for simulation configuration.
+#---------------------------------------------
+THLA.simple_sim_config.owner        = 'Pub-Federate'
+THLA.simple_sim_config.run_duration = run_duration
+
+
+# The publisher creates and sends every benchmark object instance.
+THLA.manager.obj_count = num_objects
+THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+for i in range( num_objects ):
+    THLA.manager.objects[i].FOM_name            = 'BenchData'
+    THLA.manager.objects[i].name                = 'Pub-Federate.BenchData_' + str( i )
+    THLA.manager.objects[i].create_HLA_instance = True
+    THLA.manager.objects[i].attr_count          = 2
+    THLA.manager.objects[i].attributes          = trick.sim_services.alloc_type( THLA.manager.objects[i].attr_count, 'TrickHLA::Attribute' )
+
+    THLA.manager.objects[i].attributes[0].FOM_name      = 'Name'
+    THLA.manager.objects[i].attributes[0].trick_name    = 'BENCH.data[' + str( i ) + '].name'
+    THLA.manager.objects[i].attributes[0].config        = trick.CONFIG_INITIALIZE + trick.CONFIG_CYCLIC
+    THLA.manager.objects[i].attributes[0].publish       = True
+    THLA.manager.objects[i].attributes[0].locally_owned = True
+    THLA.manager.objects[i].attributes[0].rti_encoding  = trick.ENCODING_UNICODE_STRING
+
+    THLA.manager.objects[i].attributes[1].FOM_name      = 'Values'
+    THLA.manager.objects[i].attributes[1].trick_name    = 'BENCH.data[' + str( i ) + '].values'
+    THLA.manager.objects[i].attributes[1].config        = trick.CONFIG_CYCLIC
+    THLA.manager.objects[i].attributes[1].publish       = True
+    THLA.manager.objects[i].attributes[1].locally_owned = True
+    THLA.manager.objects[i].attributes[1].rti_encoding  = trick.ENCODING_LITTLE_ENDIAN
+
+trick.stop(run_duration)
@@ -82,6 +82,18 @@ using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 using namespace DIS;
 
+// Precomputed mode transition request validity table, indexed by the pending
+// MTR and the current ExCO execution mode. This replaces the per-call mode
+// comparison chains so that validating a mode transition request is a single
+// table lookup.
+//                                                   UNINITIALIZED INITIALIZING RUNNING FREEZE SHUTDOWN
+static bool const MTR_VALID_FOR_MODE[MTR_LAST_VALUE + 1][EXECUITON_MODE_LAST_VALUE + 1] = {
+   /* MTR_UNINITIALIZED */ { false, false, false, false, false },
+   /* MTR_INITIALIZING  */ { false, false, false, false, false },
+   /* MTR_GOTO_RUN      */ { false, true, false, true, false },
+   /* MTR_GOTO_FREEZE   */ { false, true, true, false, false },
+   /* MTR_GOTO_SHUTDOWN */ { true, true, true, true, false } };
+
 /*!
  * @job_class{initialization}
  */
@@ -244,6 +256,10 @@ void ExecutionControl::pre_multi_phase_init_processes()
    if ( !get_manager()->federate_has_been_restored ) {
       // Don't forget to enable asynchronous delivery of messages.
       federate->enable_async_delivery();
+
+      // Enable attribute relevance advisories so we don't send cyclic updates
+      // for attributes with no remote subscribers.
+      federate->enable_attribute_relevance_advisory();
    }
 
    // Setup all the RTI handles for the objects, attributes and interaction
@@ -265,8 +281,9 @@ void ExecutionControl::pre_multi_phase_init_processes()
       // Set the object instance handles based on its name.
       get_manager()->set_all_object_instance_handles_by_name();
 
-      // Re-Initialize the MOM interface handles.
-      federate->initialize_MOM_handles();
+      // Re-resolve the MOM interface handles, which may have changed
+      // after the checkpoint restore.
+      federate->refresh_MOM_handles();
 
    } else {
       // Reserve the RTI object instance names with the RTI, but only for
@@ -300,8 +317,9 @@ void ExecutionControl::pre_multi_phase_init_processes()
       // instances in the Federation have been registered.
       get_manager()->wait_for_registration_of_required_objects();
 
-      // Initialize the MOM interface handles.
-      federate->initialize_MOM_handles();
+      // NOTE: The MOM interface handles are resolved lazily on first need,
+      // so there is no longer an eager Federate::initialize_MOM_handles()
+      // call here.
 
       // Perform the next few steps if we are the Master federate.
       if ( this->is_master() ) {
@@ -329,7 +347,8 @@ void ExecutionControl::pre_multi_phase_init_processes()
 */
 void ExecutionControl::post_multi_phase_init_process()
 {
-   // DANNY2.7 need this so that write_running_feds_file for checkpoint will work
+   // DANNY2.7 need this so that the running federates table recorded by
+   // write_binary_checkpoint for a checkpoint will work
    federate->load_and_print_running_federate_names();
 
    // Setup HLA time management.
@@ -575,21 +594,16 @@ bool ExecutionControl::is_mtr_valid(
 {
    ExecutionConfiguration const *ExCO = get_execution_configuration();
 
-   switch ( mtr_value ) {
-      case MTR_GOTO_RUN: {
-         return ( ( ExCO->current_execution_mode == EXECUTION_MODE_INITIALIZING ) || ( ExCO->current_execution_mode == EXECUTION_MODE_FREEZE ) );
-      }
-      case MTR_GOTO_FREEZE: {
-         return ( ( ExCO->current_execution_mode == EXECUTION_MODE_INITIALIZING ) || ( ExCO->current_execution_mode == EXECUTION_MODE_RUNNING ) );
-      }
-      case MTR_GOTO_SHUTDOWN: {
-         return ( ExCO->current_execution_mode != EXECUTION_MODE_SHUTDOWN );
-      }
-      default: {
-         return false;
-      }
+   int const current_mode = ExCO->current_execution_mode;
+
+   // Range check the values then look the transition up in the precomputed
+   // validity table.
+   if ( ( mtr_value < MTR_FIRST_VALUE ) || ( mtr_value > MTR_LAST_VALUE )
+        || ( current_mode < EXECUTION_MODE_FIRST_VALUE )
+        || ( current_mode > EXECUITON_MODE_LAST_VALUE ) ) {
+      return false;
    }
-   return false;
+   return MTR_VALID_FOR_MODE[mtr_value][current_mode];
 }
 
 void ExecutionControl::set_mode_request_from_mtr(
@@ -876,8 +890,7 @@ bool ExecutionControl::process_mode_transition_request()
  */
 bool ExecutionControl::process_execution_control_updates()
 {
-   bool          mode_change = false;
-   ostringstream errmsg;
+   bool mode_change = false;
 
    // Reference the DIS Execution Configuration Object (ExCO)
    ExecutionConfiguration *ExCO = get_execution_configuration();
@@ -894,6 +907,7 @@ bool ExecutionControl::process_execution_control_updates()
 
    // The Master federate should never have to process ExCO updates.
    if ( this->is_master() ) {
+      ostringstream errmsg;
       errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
              << __LINE__ << " WARNING: Master receive an ExCO update: "
              << execution_control_enum_to_string( this->requested_execution_control_mode )
@@ -910,6 +924,7 @@ bool ExecutionControl::process_execution_control_updates()
 
    // Check for consistency between ExecutionControl and ExCO.
    if ( exco_cem != this->current_execution_control_mode ) {
+      ostringstream errmsg;
       errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
              << __LINE__ << " WARNING: Current execution mode mismatch between ExecutionControl ("
              << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -932,6 +947,7 @@ bool ExecutionControl::process_execution_control_updates()
          this->scenario_freeze_time             = ExCO->next_mode_scenario_time;
          this->simulation_freeze_time           = this->scenario_timeline->compute_simulation_time( this->scenario_freeze_time );
       } else {
+         ostringstream errmsg;
          errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                 << __LINE__ << " WARNING: Invalid ExCO next execution mode: "
                 << execution_mode_enum_to_string( exco_nem ) << "!"
@@ -973,6 +989,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1034,6 +1051,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1057,6 +1075,7 @@ bool ExecutionControl::process_execution_control_updates()
          if ( this->requested_execution_control_mode == EXECUTION_CONTROL_SHUTDOWN ) {
 
             // Print out a diagnostic warning message.
+            ostringstream errmsg;
             errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1108,6 +1127,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1149,6 +1169,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1169,6 +1190,7 @@ bool ExecutionControl::process_execution_control_updates()
       case EXECUTION_CONTROL_SHUTDOWN:
 
          // Once in SHUTDOWN, we cannot do anything else.
+         ostringstream errmsg;
          errmsg << "DIS::ExecutionControl::process_execution_control_updates():"
                 << __LINE__ << " WARNING: Shutting down but received mode transition: "
                 << execution_control_enum_to_string( this->requested_execution_control_mode )
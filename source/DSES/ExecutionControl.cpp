@@ -85,6 +85,18 @@ using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 using namespace DSES;
 
+// Precomputed mode transition request validity table, indexed by the pending
+// MTR and the current ExCO execution mode. This replaces the per-call mode
+// comparison chains so that validating a mode transition request is a single
+// table lookup.
+//                                                   UNINITIALIZED INITIALIZING RUNNING FREEZE SHUTDOWN
+static bool const MTR_VALID_FOR_MODE[MTR_LAST_VALUE + 1][EXECUITON_MODE_LAST_VALUE + 1] = {
+   /* MTR_UNINITIALIZED */ { false, false, false, false, false },
+   /* MTR_INITIALIZING  */ { false, false, false, false, false },
+   /* MTR_GOTO_RUN      */ { false, true, false, true, false },
+   /* MTR_GOTO_FREEZE   */ { false, true, true, false, false },
+   /* MTR_GOTO_SHUTDOWN */ { true, true, true, true, false } };
+
 /*!
  * @job_class{initialization}
  */
@@ -244,6 +256,10 @@ void ExecutionControl::pre_multi_phase_init_processes()
    // Don't forget to enable asynchronous delivery of messages.
    federate->enable_async_delivery();
 
+   // Enable attribute relevance advisories so we don't send cyclic updates
+   // for attributes with no remote subscribers.
+   federate->enable_attribute_relevance_advisory();
+
    // Determine if this federate is the Master.
    determine_federation_master();
 
@@ -277,8 +293,9 @@ void ExecutionControl::pre_multi_phase_init_processes()
    // instances in the Federation have been registered.
    get_manager()->wait_for_registration_of_required_objects();
 
-   // Initialize the MOM interface handles.
-   federate->initialize_MOM_handles();
+   // NOTE: The MOM interface handles are resolved lazily on first need,
+   // so there is no longer an eager Federate::initialize_MOM_handles()
+   // call here.
 
    // Perform the next few steps if we are the Master federate.
    if ( this->is_master() ) {
@@ -588,21 +605,16 @@ bool ExecutionControl::is_mtr_valid(
 {
    ExecutionConfiguration const *ExCO = get_execution_configuration();
 
-   switch ( mtr_value ) {
-      case MTR_GOTO_RUN: {
-         return ( ( ExCO->current_execution_mode == EXECUTION_MODE_INITIALIZING ) || ( ExCO->current_execution_mode == EXECUTION_MODE_FREEZE ) );
-      }
-      case MTR_GOTO_FREEZE: {
-         return ( ( ExCO->current_execution_mode == EXECUTION_MODE_INITIALIZING ) || ( ExCO->current_execution_mode == EXECUTION_MODE_RUNNING ) );
-      }
-      case MTR_GOTO_SHUTDOWN: {
-         return ( ExCO->current_execution_mode != EXECUTION_MODE_SHUTDOWN );
-      }
-      default: {
-         return false;
-      }
+   int const current_mode = ExCO->current_execution_mode;
+
+   // Range check the values then look the transition up in the precomputed
+   // validity table.
+   if ( ( mtr_value < MTR_FIRST_VALUE ) || ( mtr_value > MTR_LAST_VALUE )
+        || ( current_mode < EXECUTION_MODE_FIRST_VALUE )
+        || ( current_mode > EXECUITON_MODE_LAST_VALUE ) ) {
+      return false;
    }
-   return false;
+   return MTR_VALID_FOR_MODE[mtr_value][current_mode];
 }
 
 void ExecutionControl::set_mode_request_from_mtr(
@@ -888,8 +900,7 @@ bool ExecutionControl::process_mode_transition_request()
  */
 bool ExecutionControl::process_execution_control_updates()
 {
-   bool          mode_change = false;
-   ostringstream errmsg;
+   bool mode_change = false;
 
    // Reference the DSES Execution Configuration Object (ExCO)
    ExecutionConfiguration *ExCO = get_execution_configuration();
@@ -906,6 +917,7 @@ bool ExecutionControl::process_execution_control_updates()
 
    // The Master federate should never have to process ExCO updates.
    if ( this->is_master() ) {
+      ostringstream errmsg;
       errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
              << __LINE__ << " WARNING: Master receive an ExCO update: "
              << execution_control_enum_to_string( this->requested_execution_control_mode )
@@ -922,6 +934,7 @@ bool ExecutionControl::process_execution_control_updates()
 
    // Check for consistency between ExecutionControl and ExCO.
    if ( exco_cem != this->current_execution_control_mode ) {
+      ostringstream errmsg;
       errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
              << __LINE__ << " WARNING: Current execution mode mismatch between ExecutionControl ("
              << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -944,6 +957,7 @@ bool ExecutionControl::process_execution_control_updates()
          this->scenario_freeze_time             = ExCO->next_mode_scenario_time;
          this->simulation_freeze_time           = this->scenario_timeline->compute_simulation_time( this->scenario_freeze_time );
       } else {
+         ostringstream errmsg;
          errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                 << __LINE__ << " WARNING: Invalid ExCO next execution mode: "
                 << execution_mode_enum_to_string( exco_nem ) << "!"
@@ -985,6 +999,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1046,6 +1061,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1069,6 +1085,7 @@ bool ExecutionControl::process_execution_control_updates()
          if ( this->requested_execution_control_mode == EXECUTION_CONTROL_SHUTDOWN ) {
 
             // Print out a diagnostic warning message.
+            ostringstream errmsg;
             errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1120,6 +1137,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1161,6 +1179,7 @@ bool ExecutionControl::process_execution_control_updates()
 
          } else {
 
+            ostringstream errmsg;
             errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                    << __LINE__ << " WARNING: Execution mode mismatch between current mode ("
                    << execution_control_enum_to_string( this->current_execution_control_mode )
@@ -1181,6 +1200,7 @@ bool ExecutionControl::process_execution_control_updates()
       case EXECUTION_CONTROL_SHUTDOWN:
 
          // Once in SHUTDOWN, we cannot do anything else.
+         ostringstream errmsg;
          errmsg << "DSES::ExecutionControl::process_execution_control_updates():"
                 << __LINE__ << " WARNING: Shutting down but received mode transition: "
                 << execution_control_enum_to_string( this->requested_execution_control_mode )
@@ -276,6 +276,10 @@ void ExecutionControl::pre_multi_phase_init_processes()
    // Don't forget to enable asynchronous delivery of messages.
    federate->enable_async_delivery();
 
+   // Enable attribute relevance advisories so we don't send cyclic updates
+   // for attributes with no remote subscribers.
+   federate->enable_attribute_relevance_advisory();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
       if ( this->is_master() ) {
          send_hs( stdout, "IMSim::ExecutionControl::pre_multi_phase_init_processes():%d\n    I AM THE MASTER%c",
@@ -293,8 +297,9 @@ void ExecutionControl::pre_multi_phase_init_processes()
       tRestoreName = strdup( get_manager()->restore_file_name );
    }
 
-   // Initialize the MOM interface handles.
-   federate->initialize_MOM_handles();
+   // NOTE: The MOM interface handles are resolved lazily on first need,
+   // so there is no longer an eager Federate::initialize_MOM_handles()
+   // call here.
 
    if ( this->is_master() ) {
       //**** This federate is the Master for the multiphase ****
@@ -312,9 +317,13 @@ void ExecutionControl::pre_multi_phase_init_processes()
             // looking for anyone who is not required.
             federate->set_restore_is_imminent();
 
-            // read the required federates data from external file, replacing
-            // the contents of 'known_feds'.
-            federate->read_running_feds_file( tRestoreName );
+            // Read the required federates data from the binary checkpoint
+            // blob, replacing the contents of 'known_feds'. Fall back to
+            // parsing the legacy text running-feds file for checkpoints
+            // created by older versions.
+            if ( !federate->read_binary_checkpoint( tRestoreName ) ) {
+               federate->read_running_feds_file( tRestoreName );
+            }
 
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
                send_hs( stdout, "IMSim::ExecutionControl::pre_multi_phase_init_processes():%d \
@@ -20,7 +20,10 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../TrickHLA/Int64BaseTime.cpp}
 @trick_link_dependency{../TrickHLA/Int64Interval.cpp}
 @trick_link_dependency{../TrickHLA/Int64Time.cpp}
+@trick_link_dependency{../TrickHLA/Interaction.cpp}
+@trick_link_dependency{../TrickHLA/Parameter.cpp}
 @trick_link_dependency{../TrickHLA/Types.cpp}
+@trick_link_dependency{../TrickHLA/Utilities.cpp}
 @trick_link_dependency{FreezeInteractionHandler.cpp}
 
 @revs_title
@@ -34,6 +37,7 @@ NASA, Johnson Space Center\n
 
 // System include files.
 #include <cmath>
+#include <cstdint>
 #include <sstream>
 #include <string>
 
@@ -47,7 +51,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64BaseTime.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/Interaction.hh"
+#include "TrickHLA/Parameter.hh"
 #include "TrickHLA/Types.hh"
+#include "TrickHLA/Utilities.hh"
 
 // IMSim include files.
 #include "IMSim/FreezeInteractionHandler.hh"
@@ -62,7 +69,9 @@ using namespace IMSim;
  * @job_class{initialization}
  */
 FreezeInteractionHandler::FreezeInteractionHandler() // RETURN: -- None.
-   : time( 0.0 )
+   : time( 0.0 ),
+     time_parameter( NULL ),
+     preencoded_parameters()
 {
    return;
 }
@@ -230,10 +239,16 @@ new freeze HLA time:%lf %c",
    // Capture the current federation save time attribute value for the interaction.
    this->time = freeze_time;
 
-   // Notify the parent interaction handler to send the interaction using
-   // Timestamp Order at the earliest convenience, even if the federation is to
-   // freeze in the future...
-   if ( this->InteractionHandler::send_interaction( interaction_hla_time.get_time_in_seconds() ) ) {
+   // Send the interaction using Timestamp Order at the earliest convenience,
+   // even if the federation is to freeze in the future. The preencoded payload
+   // template is used when available so scheduling the freeze costs one patch
+   // and send instead of a full parameter encode in this time-critical path.
+   bool const interaction_sent =
+      prepare_preencoded_payload()
+         ? send_preencoded_freeze_interaction( interaction_hla_time.get_time_in_seconds() )
+         : this->InteractionHandler::send_interaction( interaction_hla_time.get_time_in_seconds() );
+
+   if ( interaction_sent ) {
       ostringstream infomsg;
       infomsg << "IMSim::FreezeInteractionHandler::send_scenario_freeze_interaction(Timestamp Order):"
               << __LINE__ << endl
@@ -271,6 +286,84 @@ new freeze HLA time:%lf %c",
    }
 }
 
+/*!
+ *  @details The parameter handles are resolved during initialization, so the
+ *  payload template is built lazily on the first send. Every parameter is
+ *  encoded once to capture the handles and any fixed fields, and the
+ *  parameter bound to the freeze time variable is remembered so only it is
+ *  patched on each send.
+ */
+bool FreezeInteractionHandler::prepare_preencoded_payload()
+{
+   if ( time_parameter != NULL ) {
+      return true;
+   }
+
+   Parameter *params          = interaction->get_parameters();
+   int const  parameter_count = interaction->get_parameter_count();
+
+   preencoded_parameters.clear();
+
+   for ( int i = 0; i < parameter_count; ++i ) {
+      preencoded_parameters[params[i].get_parameter_handle()] = params[i].get_encoded_parameter_value();
+
+      if ( params[i].get_sim_variable_address() == static_cast< void const * >( &this->time ) ) {
+         this->time_parameter = &params[i];
+      }
+   }
+
+   if ( time_parameter == NULL ) {
+      // No parameter is bound to the freeze time variable, so fall back to
+      // the full encode path in the parent interaction handler.
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+         send_hs( stdout, "IMSim::FreezeInteractionHandler::prepare_preencoded_payload():%d \
+No parameter is bound to the freeze time variable, using the full encode path.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      preencoded_parameters.clear();
+      return false;
+   }
+   return true;
+}
+
+/*!
+ *  @details Only the freeze time is patched into the preencoded payload, the
+ *  rest of the payload was resolved by prepare_preencoded_payload(). The
+ *  patch reproduces the scalar double encodings the Parameter class supports
+ *  for the time parameter.
+ */
+bool FreezeInteractionHandler::send_preencoded_freeze_interaction(
+   double const send_HLA_time )
+{
+   if ( time_parameter->get_rti_encoding() == ENCODING_LOGICAL_TIME ) {
+      // Encode as the big-endian integer HLA Logical Time representation.
+      int64_t const logical_time = Int64BaseTime::to_base_time( this->time );
+
+      unsigned char encoded[8];
+      encoded[0] = (unsigned char)( ( logical_time >> 56 ) & 0xFF );
+      encoded[1] = (unsigned char)( ( logical_time >> 48 ) & 0xFF );
+      encoded[2] = (unsigned char)( ( logical_time >> 40 ) & 0xFF );
+      encoded[3] = (unsigned char)( ( logical_time >> 32 ) & 0xFF );
+      encoded[4] = (unsigned char)( ( logical_time >> 24 ) & 0xFF );
+      encoded[5] = (unsigned char)( ( logical_time >> 16 ) & 0xFF );
+      encoded[6] = (unsigned char)( ( logical_time >> 8 ) & 0xFF );
+      encoded[7] = (unsigned char)( logical_time & 0xFF );
+
+      preencoded_parameters[time_parameter->get_parameter_handle()] =
+         RTI1516_NAMESPACE::VariableLengthData( encoded, sizeof( encoded ) );
+   } else {
+      // A scalar double, byteswapped for transmission as needed.
+      double const encoded_time = time_parameter->is_byteswap()
+                                     ? Utilities::byteswap_double( this->time )
+                                     : this->time;
+
+      preencoded_parameters[time_parameter->get_parameter_handle()] =
+         RTI1516_NAMESPACE::VariableLengthData( &encoded_time, sizeof( encoded_time ) );
+   }
+
+   return interaction->send( preencoded_parameters, send_HLA_time, RTI1516_USERDATA( 0, 0 ) );
+}
+
 void FreezeInteractionHandler::receive_interaction(
    RTI1516_USERDATA const &theUserSuppliedTag )
 {
@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../TrickHLA/MutexProtection.cpp}
 @trick_link_dependency{../TrickHLA/SyncPnt.cpp}
 @trick_link_dependency{../TrickHLA/TimedSyncPnt.cpp}
+@trick_link_dependency{../TrickHLA/TimedSyncPntList.cpp}
 @trick_link_dependency{../TrickHLA/Types.cpp}
 @trick_link_dependency{PausePointList.cpp}
 @trick_link_dependency{Types.cpp}
@@ -64,7 +65,8 @@ using namespace IMSim;
  * @job_class{initialization}
  */
 PausePointList::PausePointList()
-   : state( PAUSE_POINT_STATE_UNKNOWN )
+   : state( PAUSE_POINT_STATE_UNKNOWN ),
+     achieved_count( 0 )
 {
    return;
 }
@@ -76,34 +78,77 @@ bool PausePointList::clear_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt *sp = ( *i );
-         if ( ( sp != NULL )
-              && ( sp->get_state() == SYNC_PT_STATE_ACHIEVED )
-              && ( label.compare( sp->get_label() ) == 0 ) ) {
-
-            if ( sp->get_label().find( L"stop", 0 ) == 0 ) {
-               this->state = PAUSE_POINT_STATE_EXIT;
-            } else if ( sp->get_label().find( L"restart", 0 ) == 0 ) {
-               this->state = PAUSE_POINT_STATE_RESTART;
-            } else if ( sp->get_label().find( L"reconfig", 0 ) == 0 ) {
-               this->reconfig_name = sp->get_label().substr( 9 );
-               this->state         = PAUSE_POINT_STATE_RECONFIG;
-            }
-
-            sync_point_list.erase( i );
-            delete sp;
-            i = sync_point_list.end();
-
-            return true;
-         }
+   // The interning map finds the pause point for the label without a
+   // linear scan over the list with wide string compares.
+   SyncPnt *sp = get_sync_point( label );
+   if ( ( sp != NULL ) && ( sp->get_state() == SYNC_PT_STATE_ACHIEVED ) ) {
+
+      if ( sp->get_label().find( L"stop", 0 ) == 0 ) {
+         this->state = PAUSE_POINT_STATE_EXIT;
+      } else if ( sp->get_label().find( L"restart", 0 ) == 0 ) {
+         this->state = PAUSE_POINT_STATE_RESTART;
+      } else if ( sp->get_label().find( L"reconfig", 0 ) == 0 ) {
+         this->reconfig_name = sp->get_label().substr( 9 );
+         this->state         = PAUSE_POINT_STATE_RECONFIG;
       }
+
+      --this->achieved_count;
+
+      // The timed list removes the point from the pending heap, the list
+      // and the label map, and deletes it.
+      return TimedSyncPntList::clear_sync_point( label );
    }
    return false;
 }
 
+bool PausePointList::achieve_sync_point(
+   RTI1516_NAMESPACE::RTIambassador &RTI_amb,
+   TrickHLA::SyncPnt                *sync_pnt )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   bool const was_achieved = ( sync_pnt != NULL )
+                             && ( sync_pnt->get_state() == SYNC_PT_STATE_ACHIEVED );
+
+   bool const achieved = TimedSyncPntList::achieve_sync_point( RTI_amb, sync_pnt );
+
+   // Maintain the achieved count so check_state() does not have to scan
+   // the list for an achieved pause point.
+   if ( achieved && !was_achieved
+        && ( sync_pnt->get_state() == SYNC_PT_STATE_ACHIEVED ) ) {
+      ++this->achieved_count;
+   }
+   return achieved;
+}
+
+bool PausePointList::mark_synchronized(
+   wstring const &label )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // The point leaves the achieved state when marked as synchronized.
+   SyncPnt const *sp = get_sync_point( label );
+   if ( ( sp != NULL ) && ( sp->get_state() == SYNC_PT_STATE_ACHIEVED ) ) {
+      --this->achieved_count;
+   }
+   return TimedSyncPntList::mark_synchronized( label );
+}
+
+void PausePointList::reset()
+{
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+      this->achieved_count = 0;
+   }
+   TimedSyncPntList::reset();
+}
+
 void PausePointList::check_state()
 {
    if ( ( state == PAUSE_POINT_STATE_EXIT )
@@ -116,13 +161,12 @@ void PausePointList::check_state()
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      if ( std::any_of( sync_point_list.begin(),
-                        sync_point_list.end(),
-                        []( SyncPtStateEnum const s ) { return s == SYNC_PT_STATE_ACHIEVED; } ) ) {
-         this->state = PAUSE_POINT_STATE_FREEZE;
-         return;
-      }
+   // The achieved count is maintained as the pause points change state, so
+   // this per-frame check is constant time instead of a scan over every
+   // pause point in the list.
+   if ( this->achieved_count > 0 ) {
+      this->state = PAUSE_POINT_STATE_FREEZE;
+      return;
    }
 
    // FIXME: Commenting out to test. This needs to be split between the
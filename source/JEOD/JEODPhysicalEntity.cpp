@@ -141,41 +141,55 @@ void JEODPhysicalEntity::pack_from_working_data()
    // FRAME MATCHES THE SPACEFOM PhysicalEntity PARENT FRAME!  IF NOT, A LOT
    // MORE COMPUTATIONS HAVE TO BE DONE HERE!!!!!
 
+   // Each field is only pulled from the JEOD side when the owning attribute
+   // is locally owned and published, otherwise it will never be sent and
+   // the copy, including the quaternion conversions, can be skipped.
+
    // Pack the state time coordinate data.
-   // Position and velocity vectors.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.state.pos[iinc] = dyn_body_data->composite_body.state.trans.position[iinc];
-      this->pe_packing_data.state.vel[iinc] = dyn_body_data->composite_body.state.trans.velocity[iinc];
-   }
-   // Attitude quaternion.
-   this->pe_packing_data.state.att.scalar = dyn_body_data->composite_body.state.rot.Q_parent_this.scalar;
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.state.att.vector[iinc] = dyn_body_data->composite_body.state.rot.Q_parent_this.vector[iinc];
-      this->pe_packing_data.state.ang_vel[iinc]    = dyn_body_data->composite_body.state.rot.ang_vel_this[iinc];
-   }
+   if ( state_attr->is_locally_owned() && state_attr->is_publish() ) {
+      // Position and velocity vectors.
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.state.pos[iinc] = dyn_body_data->composite_body.state.trans.position[iinc];
+         this->pe_packing_data.state.vel[iinc] = dyn_body_data->composite_body.state.trans.velocity[iinc];
+      }
+      // Attitude quaternion.
+      this->pe_packing_data.state.att.scalar = dyn_body_data->composite_body.state.rot.Q_parent_this.scalar;
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.state.att.vector[iinc] = dyn_body_data->composite_body.state.rot.Q_parent_this.vector[iinc];
+         this->pe_packing_data.state.ang_vel[iinc]    = dyn_body_data->composite_body.state.rot.ang_vel_this[iinc];
+      }
 
-   // Time tag for this state data.
-   this->pe_packing_data.state.time = get_scenario_time();
+      // Time tag for this state data.
+      this->pe_packing_data.state.time = get_scenario_time();
+   }
 
    // Set the acceleration data.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.accel[iinc] = dyn_body_data->derivs.trans_accel[iinc];
+   if ( accel_attr->is_locally_owned() && accel_attr->is_publish() ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.accel[iinc] = dyn_body_data->derivs.trans_accel[iinc];
+      }
    }
 
    // Set the rotational acceleration data.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.ang_accel[iinc] = dyn_body_data->derivs.rot_accel[iinc];
+   if ( ang_accel_attr->is_locally_owned() && ang_accel_attr->is_publish() ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.ang_accel[iinc] = dyn_body_data->derivs.rot_accel[iinc];
+      }
    }
 
    // Set the center of mass location.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.cm[iinc] = dyn_body_data->mass.composite_properties.position[iinc];
+   if ( cm_attr->is_locally_owned() && cm_attr->is_publish() ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.cm[iinc] = dyn_body_data->mass.composite_properties.position[iinc];
+      }
    }
 
    // Pack the body to structural reference frame attitude quaternion.
-   this->pe_packing_data.body_wrt_struct.scalar = dyn_body_data->mass.composite_properties.Q_parent_this.scalar;
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      this->pe_packing_data.body_wrt_struct.vector[iinc] = dyn_body_data->mass.composite_properties.Q_parent_this.vector[iinc];
+   if ( body_frame_attr->is_locally_owned() && body_frame_attr->is_publish() ) {
+      this->pe_packing_data.body_wrt_struct.scalar = dyn_body_data->mass.composite_properties.Q_parent_this.scalar;
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         this->pe_packing_data.body_wrt_struct.vector[iinc] = dyn_body_data->mass.composite_properties.Q_parent_this.vector[iinc];
+      }
    }
 
    return;
@@ -69,7 +69,8 @@ using namespace SpaceFOM;
 JEODRefFrameState::JEODRefFrameState()
    : RefFrameBase(),
      time_tt( NULL ),
-     ref_frame_state( NULL )
+     ref_frame_state( NULL ),
+     direct_copy_compatible( false )
 {
    return;
 }
@@ -82,7 +83,8 @@ JEODRefFrameState::JEODRefFrameState(
    jeod::RefFrameState &ref_frame_state_ref )
    : RefFrameBase(),
      time_tt( &time_tt_in ),
-     ref_frame_state( &ref_frame_state_ref )
+     ref_frame_state( &ref_frame_state_ref ),
+     direct_copy_compatible( false )
 {
    return;
 }
@@ -153,6 +155,16 @@ void JEODRefFrameState::initialize()
       TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Determine once if the JEOD and SpaceFOM state layouts allow the bulk
+   // span copy fast path used in pack_from_working_data() and
+   // unpack_into_working_data().
+   this->direct_copy_compatible = is_direct_copy_compatible();
+   if ( !this->direct_copy_compatible
+        && TrickHLA::DebugHandler::show( TrickHLA::DEBUG_LEVEL_2_TRACE, TrickHLA::DEBUG_SOURCE_PACKING ) ) {
+      send_hs( stdout, "SpaceFOM::JEODRefFrameState::initialize():%d Frame '%s' state layouts are not direct-copy compatible, using the element copy path.%c",
+               __LINE__, this->packing_data.name, THLA_NEWLINE );
+   }
+
    // Mark this as initialized.
    RefFrameBase::initialize();
 
@@ -160,6 +172,26 @@ void JEODRefFrameState::initialize()
    return;
 }
 
+/*!
+ * @job_class{initialization}
+ */
+bool JEODRefFrameState::is_direct_copy_compatible() const
+{
+   // Both the JEOD reference frame state and the SpaceFOM packing data use
+   // SI units, so no conversions are required and compatibility reduces to
+   // the copied spans being contiguous doubles on both sides. The position,
+   // velocity and angular velocity spans are plain double[3] arrays by
+   // declaration; only the attitude quaternion scalar followed by vector
+   // layout needs to be verified.
+   if ( &ref_frame_state->rot.Q_parent_this.vector[0] != ( &ref_frame_state->rot.Q_parent_this.scalar + 1 ) ) {
+      return false;
+   }
+   if ( &packing_data.state.att.vector[0] != ( &packing_data.state.att.scalar + 1 ) ) {
+      return false;
+   }
+   return true;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -180,21 +212,35 @@ void JEODRefFrameState::pack_from_working_data()
    // ignored for now.
    //}
 
-   // Pack the data.
-   // Position and velocity vectors.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      packing_data.state.pos[iinc] = ref_frame_state->trans.position[iinc];
-      packing_data.state.vel[iinc] = ref_frame_state->trans.velocity[iinc];
-   }
-   // Attitude quaternion.
-   packing_data.state.att.scalar = ref_frame_state->rot.Q_parent_this.scalar;
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      packing_data.state.att.vector[iinc] = ref_frame_state->rot.Q_parent_this.vector[iinc];
-      packing_data.state.ang_vel[iinc]    = ref_frame_state->rot.ang_vel_this[iinc];
+   // Pack the data. The state is only pulled from the JEOD side when the
+   // state attribute is locally owned and published, otherwise it will
+   // never be sent and the copy can be skipped.
+   if ( state_attr->is_locally_owned() && state_attr->is_publish() ) {
+      if ( direct_copy_compatible ) {
+         // Direct layout copy, validated in initialize(). Bulk copy each
+         // contiguous double span with a single memcpy.
+         memcpy( packing_data.state.pos, ref_frame_state->trans.position, 3 * sizeof( double ) );
+         memcpy( packing_data.state.vel, ref_frame_state->trans.velocity, 3 * sizeof( double ) );
+         memcpy( &packing_data.state.att.scalar, &ref_frame_state->rot.Q_parent_this.scalar, 4 * sizeof( double ) );
+         memcpy( packing_data.state.ang_vel, ref_frame_state->rot.ang_vel_this, 3 * sizeof( double ) );
+      } else {
+         // Element copy path for incompatible layouts.
+         // Position and velocity vectors.
+         for ( iinc = 0; iinc < 3; ++iinc ) {
+            packing_data.state.pos[iinc] = ref_frame_state->trans.position[iinc];
+            packing_data.state.vel[iinc] = ref_frame_state->trans.velocity[iinc];
+         }
+         // Attitude quaternion.
+         packing_data.state.att.scalar = ref_frame_state->rot.Q_parent_this.scalar;
+         for ( iinc = 0; iinc < 3; ++iinc ) {
+            packing_data.state.att.vector[iinc] = ref_frame_state->rot.Q_parent_this.vector[iinc];
+            packing_data.state.ang_vel[iinc]    = ref_frame_state->rot.ang_vel_this[iinc];
+         }
+      }
+      // Time tag for this state data.
+      // FIXME: Need to check if get_scenario_time is really what we want here?
+      packing_data.state.time = get_scenario_time();
    }
-   // Time tag for this state data.
-   // FIXME: Need to check if get_scenario_time is really what we want here?
-   packing_data.state.time = get_scenario_time();
 
    if ( debug ) {
       cout << "JEODRefFrameState::pack_from_working_data():" << __LINE__ << endl
@@ -244,16 +290,26 @@ void JEODRefFrameState::unpack_into_working_data()
    if ( state_attr->is_received() ) {
 
       // Unpack the data.
-      // Position and velocity vectors.
-      for ( int iinc = 0; iinc < 3; ++iinc ) {
-         ref_frame_state->trans.position[iinc] = packing_data.state.pos[iinc];
-         ref_frame_state->trans.velocity[iinc] = packing_data.state.vel[iinc];
-      }
-      // Attitude quaternion.
-      ref_frame_state->rot.Q_parent_this.scalar = packing_data.state.att.scalar;
-      for ( int iinc = 0; iinc < 3; ++iinc ) {
-         ref_frame_state->rot.Q_parent_this.vector[iinc] = packing_data.state.att.vector[iinc];
-         ref_frame_state->rot.ang_vel_this[iinc]         = packing_data.state.ang_vel[iinc];
+      if ( direct_copy_compatible ) {
+         // Direct layout copy, validated in initialize(). Bulk copy each
+         // contiguous double span with a single memcpy.
+         memcpy( ref_frame_state->trans.position, packing_data.state.pos, 3 * sizeof( double ) );
+         memcpy( ref_frame_state->trans.velocity, packing_data.state.vel, 3 * sizeof( double ) );
+         memcpy( &ref_frame_state->rot.Q_parent_this.scalar, &packing_data.state.att.scalar, 4 * sizeof( double ) );
+         memcpy( ref_frame_state->rot.ang_vel_this, packing_data.state.ang_vel, 3 * sizeof( double ) );
+      } else {
+         // Element copy path for incompatible layouts.
+         // Position and velocity vectors.
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            ref_frame_state->trans.position[iinc] = packing_data.state.pos[iinc];
+            ref_frame_state->trans.velocity[iinc] = packing_data.state.vel[iinc];
+         }
+         // Attitude quaternion.
+         ref_frame_state->rot.Q_parent_this.scalar = packing_data.state.att.scalar;
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            ref_frame_state->rot.Q_parent_this.vector[iinc] = packing_data.state.att.vector[iinc];
+            ref_frame_state->rot.ang_vel_this[iinc]         = packing_data.state.ang_vel[iinc];
+         }
       }
    }
 
@@ -147,25 +147,48 @@ void DynamicalEntity::pack_from_working_data()
    // Call the base class pack from working data function.
    PhysicalEntity::pack_from_working_data();
 
+   // When the dynamics model maintains the dirty flags, only re-derive the
+   // flagged fields; the previously derived packing data (and its encoded
+   // bytes) are reused for the unchanged fields. During coast phases where
+   // the forces, torques and mass rates are constant this skips all the
+   // derivation below. The flags are consumed and cleared by the
+   // conditional send logic, not here, so the send suppression sees them.
+
    // Set the force data.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      de_packing_data.force[iinc] = dynamical_data->force[iinc];
+   if ( !use_dirty_flags || force_dirty ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         de_packing_data.force[iinc] = dynamical_data->force[iinc];
+      }
    }
 
    // Set the torque data.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      de_packing_data.torque[iinc] = dynamical_data->torque[iinc];
+   if ( !use_dirty_flags || torque_dirty ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         de_packing_data.torque[iinc] = dynamical_data->torque[iinc];
+      }
    }
 
    // Set the mass and mass rate values.
-   de_packing_data.mass      = dynamical_data->mass;
-   de_packing_data.mass_rate = dynamical_data->mass_rate;
+   if ( !use_dirty_flags || mass_dirty ) {
+      de_packing_data.mass = dynamical_data->mass;
+   }
+   if ( !use_dirty_flags || mass_rate_dirty ) {
+      de_packing_data.mass_rate = dynamical_data->mass_rate;
+   }
 
    // Set the inertia matrix and inertia rate data.
-   for ( iinc = 0; iinc < 3; ++iinc ) {
-      for ( jinc = 0; jinc < 3; ++jinc ) {
-         de_packing_data.inertia[iinc][jinc]      = dynamical_data->inertia[iinc][jinc];
-         de_packing_data.inertia_rate[iinc][jinc] = dynamical_data->inertia_rate[iinc][jinc];
+   if ( !use_dirty_flags || inertia_dirty ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         for ( jinc = 0; jinc < 3; ++jinc ) {
+            de_packing_data.inertia[iinc][jinc] = dynamical_data->inertia[iinc][jinc];
+         }
+      }
+   }
+   if ( !use_dirty_flags || inertia_rate_dirty ) {
+      for ( iinc = 0; iinc < 3; ++iinc ) {
+         for ( jinc = 0; jinc < 3; ++jinc ) {
+            de_packing_data.inertia_rate[iinc][jinc] = dynamical_data->inertia_rate[iinc][jinc];
+         }
       }
    }
 
@@ -64,7 +64,14 @@ using namespace SpaceFOM;
  * @job_class{initialization}
  */
 DynamicalEntityBase::DynamicalEntityBase() // RETURN: -- None.
-   : force_attr( NULL ),
+   : use_dirty_flags( false ),
+     force_dirty( true ),
+     torque_dirty( true ),
+     mass_dirty( true ),
+     mass_rate_dirty( true ),
+     inertia_dirty( true ),
+     inertia_rate_dirty( true ),
+     force_attr( NULL ),
      torque_attr( NULL ),
      mass_attr( NULL ),
      mass_rate_attr( NULL ),
@@ -138,10 +145,13 @@ void DynamicalEntityBase::base_config(
    //
    // Specify the Reference Frame attributes.
    //
+   // The name, type, status and parent frame strings never change after
+   // initialization, so they are configured as initialization-only and
+   // stay out of the cyclic send path.
    object->attributes[0].FOM_name      = allocate_input_string( "name" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.name" );
    object->attributes[0].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[0].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[0].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[0].publish       = publishes;
    object->attributes[0].subscribe     = !publishes;
    object->attributes[0].locally_owned = publishes;
@@ -150,7 +160,7 @@ void DynamicalEntityBase::base_config(
    object->attributes[1].FOM_name      = allocate_input_string( "type" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.type" );
    object->attributes[1].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[1].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[1].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[1].publish       = publishes;
    object->attributes[1].subscribe     = !publishes;
    object->attributes[1].locally_owned = publishes;
@@ -159,7 +169,7 @@ void DynamicalEntityBase::base_config(
    object->attributes[2].FOM_name      = allocate_input_string( "status" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.status" );
    object->attributes[2].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[2].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[2].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[2].publish       = publishes;
    object->attributes[2].subscribe     = !publishes;
    object->attributes[2].locally_owned = publishes;
@@ -168,7 +178,7 @@ void DynamicalEntityBase::base_config(
    object->attributes[3].FOM_name      = allocate_input_string( "parent_reference_frame" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.parent_ref_frame" );
    object->attributes[3].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[3].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[3].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[3].publish       = publishes;
    object->attributes[3].subscribe     = !publishes;
    object->attributes[3].locally_owned = publishes;
@@ -18,6 +18,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../TrickHLA/Attribute.cpp}
 @trick_link_dependency{../TrickHLA/Conditional.cpp}
+@trick_link_dependency{../TrickHLA/ConditionalBatch.cpp}
 @trick_link_dependency{../TrickHLA/Object.cpp}
 @trick_link_dependency{DynamicalEntityConditionalBase.cpp}
 
@@ -39,6 +40,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/Conditional.hh"
+#include "TrickHLA/ConditionalBatch.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Object.hh"
 
@@ -56,7 +58,6 @@ DynamicalEntityConditionalBase::DynamicalEntityConditionalBase(
    DynamicalEntityBase &entity_ref )
    : SpaceFOM::PhysicalEntityConditionalBase( entity_ref ),
      de_entity( entity_ref ),
-     prev_de_data(),
      force_attr( NULL ),
      torque_attr( NULL ),
      mass_attr( NULL ),
@@ -108,6 +109,21 @@ void DynamicalEntityConditionalBase::initialize_callback(
    inertia_attr      = de_entity.inertia_attr;
    inertia_rate_attr = de_entity.inertia_rate_attr;
 
+   // Register the numeric attribute change thresholds with the batched
+   // conditional engine so they are all evaluated in one sweep per send
+   // instead of element-by-element in should_send(). An epsilon of zero
+   // matches the previous exact comparisons. When the packing object runs
+   // on dynamics-model dirty flags the flags are consumed in should_send()
+   // instead and no comparisons are needed at all.
+   if ( !de_entity.use_dirty_flags ) {
+      register_threshold( force_attr, de_entity.de_packing_data.force, 3, 0.0 );
+      register_threshold( torque_attr, de_entity.de_packing_data.torque, 3, 0.0 );
+      register_threshold( mass_attr, &de_entity.de_packing_data.mass, 1, 0.0 );
+      register_threshold( mass_rate_attr, &de_entity.de_packing_data.mass_rate, 1, 0.0 );
+      register_threshold( inertia_attr, &de_entity.de_packing_data.inertia[0][0], 9, 0.0 );
+      register_threshold( inertia_rate_attr, &de_entity.de_packing_data.inertia_rate[0][0], 9, 0.0 );
+   }
+
    // We must call the original function so that the callback is initialized.
    this->PhysicalEntityConditionalBase::initialize_callback( obj );
 
@@ -122,112 +138,44 @@ bool DynamicalEntityConditionalBase::should_send(
 {
    bool send_attr = false;
 
-   // If there is simulation data to compare to and if the attribute FOM name
-   // has been specified, check the value of the current simulation variable
-   // versus the previous value. Return true if there was a change.
-   //
-   // Check for change in force.
-   if ( attr == force_attr ) {
-
-      if ( ( de_entity.de_packing_data.force[0] != prev_de_data.force[0] )
-           || ( de_entity.de_packing_data.force[1] != prev_de_data.force[1] )
-           || ( de_entity.de_packing_data.force[2] != prev_de_data.force[2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            prev_de_data.force[iinc] = de_entity.de_packing_data.force[iinc];
-         }
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in torque.
-   else if ( attr == torque_attr ) {
-
-      if ( ( de_entity.de_packing_data.torque[0] != prev_de_data.torque[0] )
-           || ( de_entity.de_packing_data.torque[1] != prev_de_data.torque[1] )
-           || ( de_entity.de_packing_data.torque[2] != prev_de_data.torque[2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            prev_de_data.torque[iinc] = de_entity.de_packing_data.torque[iinc];
+   if ( ( attr == force_attr )
+        || ( attr == torque_attr )
+        || ( attr == mass_attr )
+        || ( attr == mass_rate_attr )
+        || ( attr == inertia_attr )
+        || ( attr == inertia_rate_attr ) ) {
+
+      if ( de_entity.use_dirty_flags ) {
+
+         // The dynamics model maintains the dirty flags, so consume and
+         // clear the flag for this attribute; nothing is compared for the
+         // unflagged fields.
+         if ( attr == force_attr ) {
+            send_attr             = de_entity.force_dirty;
+            de_entity.force_dirty = false;
+         } else if ( attr == torque_attr ) {
+            send_attr              = de_entity.torque_dirty;
+            de_entity.torque_dirty = false;
+         } else if ( attr == mass_attr ) {
+            send_attr            = de_entity.mass_dirty;
+            de_entity.mass_dirty = false;
+         } else if ( attr == mass_rate_attr ) {
+            send_attr                 = de_entity.mass_rate_dirty;
+            de_entity.mass_rate_dirty = false;
+         } else if ( attr == inertia_attr ) {
+            send_attr               = de_entity.inertia_dirty;
+            de_entity.inertia_dirty = false;
+         } else {
+            send_attr                    = de_entity.inertia_rate_dirty;
+            de_entity.inertia_rate_dirty = false;
          }
 
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in mass.
-   else if ( attr == mass_attr ) {
-
-      if ( de_entity.de_packing_data.mass != prev_de_data.mass ) {
-
-         // Update the previous value.
-         prev_de_data.mass = de_entity.de_packing_data.mass;
+      } else {
 
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in mass rate.
-   else if ( attr == mass_rate_attr ) {
-
-      if ( de_entity.de_packing_data.mass_rate != prev_de_data.mass_rate ) {
-
-         // Update the previous value.
-         prev_de_data.mass_rate = de_entity.de_packing_data.mass_rate;
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in inertia matrix.
-   else if ( attr == inertia_attr ) {
-
-      if ( ( de_entity.de_packing_data.inertia[0][0] != prev_de_data.inertia[0][0] )
-           || ( de_entity.de_packing_data.inertia[0][1] != prev_de_data.inertia[0][1] )
-           || ( de_entity.de_packing_data.inertia[0][2] != prev_de_data.inertia[0][2] )
-           || ( de_entity.de_packing_data.inertia[1][0] != prev_de_data.inertia[1][0] )
-           || ( de_entity.de_packing_data.inertia[1][1] != prev_de_data.inertia[1][1] )
-           || ( de_entity.de_packing_data.inertia[1][2] != prev_de_data.inertia[1][2] )
-           || ( de_entity.de_packing_data.inertia[2][0] != prev_de_data.inertia[2][0] )
-           || ( de_entity.de_packing_data.inertia[2][1] != prev_de_data.inertia[2][1] )
-           || ( de_entity.de_packing_data.inertia[2][2] != prev_de_data.inertia[2][2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            for ( int jinc = 0; jinc < 3; ++jinc ) {
-               prev_de_data.inertia[iinc][jinc] = de_entity.de_packing_data.inertia[iinc][jinc];
-            }
-         }
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in inertia rate matrix.
-   else if ( attr == inertia_rate_attr ) {
-
-      if ( ( de_entity.de_packing_data.inertia_rate[0][0] != prev_de_data.inertia_rate[0][0] )
-           || ( de_entity.de_packing_data.inertia_rate[0][1] != prev_de_data.inertia_rate[0][1] )
-           || ( de_entity.de_packing_data.inertia_rate[0][2] != prev_de_data.inertia_rate[0][2] )
-           || ( de_entity.de_packing_data.inertia_rate[1][0] != prev_de_data.inertia_rate[1][0] )
-           || ( de_entity.de_packing_data.inertia_rate[1][1] != prev_de_data.inertia_rate[1][1] )
-           || ( de_entity.de_packing_data.inertia_rate[1][2] != prev_de_data.inertia_rate[1][2] )
-           || ( de_entity.de_packing_data.inertia_rate[2][0] != prev_de_data.inertia_rate[2][0] )
-           || ( de_entity.de_packing_data.inertia_rate[2][1] != prev_de_data.inertia_rate[2][1] )
-           || ( de_entity.de_packing_data.inertia_rate[2][2] != prev_de_data.inertia_rate[2][2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            for ( int jinc = 0; jinc < 3; ++jinc ) {
-               prev_de_data.inertia_rate[iinc][jinc] = de_entity.de_packing_data.inertia_rate[iinc][jinc];
-            }
-         }
-
-         // Mark to send.
-         send_attr = true;
+         // The numeric attributes are evaluated in one vectorized sweep by
+         // the batched conditional engine, so just consume the send bitmask
+         // here.
+         send_attr = ConditionalBatch::should_send( attr );
       }
 
    } else {
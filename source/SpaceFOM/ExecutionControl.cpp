@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../TrickHLA/ElapsedTimeStats.cpp}
 @trick_link_dependency{../TrickHLA/ExecutionConfigurationBase.cpp}
 @trick_link_dependency{../TrickHLA/Federate.cpp}
 @trick_link_dependency{../TrickHLA/Int64BaseTime.cpp}
@@ -46,6 +47,7 @@ NASA, Johnson Space Center\n
 #include <limits>
 #include <math.h>
 #include <string>
+#include <time.h>
 
 // Trick includes.
 #include "trick/Executive.hh"
@@ -121,7 +123,9 @@ ExecutionControl::ExecutionControl()
      root_ref_frame( NULL ),
      pending_mtr( SpaceFOM::MTR_UNINITIALIZED ),
      mtr_interaction( NULL ),
-     mtr_interaction_handler( NULL )
+     mtr_interaction_handler( NULL ),
+     mtr_request_time( 0 ),
+     mode_transition_stats()
 {
    return;
 }
@@ -137,7 +141,9 @@ ExecutionControl::ExecutionControl(
      root_ref_frame( NULL ),
      pending_mtr( SpaceFOM::MTR_UNINITIALIZED ),
      mtr_interaction( NULL ),
-     mtr_interaction_handler( NULL )
+     mtr_interaction_handler( NULL ),
+     mtr_request_time( 0 ),
+     mode_transition_stats()
 {
    return;
 }
@@ -676,8 +682,9 @@ described in section 7.2 and figure 7-4.
 */
 void ExecutionControl::role_determination_process()
 {
-   // Initialize the MOM interface handles.
-   federate->initialize_MOM_handles();
+   // NOTE: The MOM interface handles are resolved lazily on first need,
+   // so there is no longer an eager Federate::initialize_MOM_handles()
+   // call here.
 
    // Check for Master initialization lane.
    if ( this->is_master() ) {
@@ -709,6 +716,12 @@ void ExecutionControl::role_determination_process()
       multiphase_init_sync_pnt_list.register_all_sync_points( *( federate->get_RTI_ambassador() ),
                                                               federate->get_joined_federate_handles() );
 
+      // All the registrations above were pipelined without intermediate
+      // waits, so collect the RTI registration confirmations for the whole
+      // batch in one place before moving on.
+      this->wait_for_all_registration_confirmations( federate );
+      multiphase_init_sync_pnt_list.wait_for_all_registration_confirmations( federate );
+
    } else {
 
       //
@@ -1389,6 +1402,16 @@ void ExecutionControl::post_multi_phase_init_processes()
  */
 void ExecutionControl::shutdown()
 {
+   // Summarize the mode transition request-to-transition latency
+   // statistics for the Master federate, which executes the requests.
+   if ( this->is_master() ) {
+      ostringstream msg;
+      msg << "SpaceFOM::ExecutionControl::shutdown():" << __LINE__
+          << " Mode transition request-to-transition latency "
+          << mode_transition_stats.to_string() << THLA_ENDL;
+      send_hs( stdout, msg.str().c_str() );
+   }
+
    // If this is the Master, let's pause for a moment to let things
    // propagate through the federate before tearing things down.
    if ( current_execution_control_mode != EXECUTION_CONTROL_SHUTDOWN ) {
@@ -1414,6 +1437,47 @@ void ExecutionControl::shutdown()
    }
 }
 
+/*!
+ * @details Stamps the wall-clock request time used by the
+ * request-to-transition latency statistics, then sets the flag.
+ */
+void ExecutionControl::set_mode_transition_requested()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   this->mtr_request_time = ( (int64_t)ts.tv_sec * 1000000LL )
+                            + ( (int64_t)ts.tv_nsec / 1000LL );
+
+   ExecutionControlBase::set_mode_transition_requested();
+}
+
+void ExecutionControl::sample_mode_transition_latency(
+   char const *label )
+{
+   // Nothing to sample if the pending mode transition was not commanded
+   // by a mode transition request.
+   if ( this->mtr_request_time == 0 ) {
+      return;
+   }
+
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   int64_t const now = ( (int64_t)ts.tv_sec * 1000000LL )
+                       + ( (int64_t)ts.tv_nsec / 1000LL );
+
+   double const latency_ms = (double)( now - this->mtr_request_time ) * 0.001;
+   mode_transition_stats.sample( latency_ms );
+   this->mtr_request_time = 0;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
+      ostringstream msg;
+      msg << "SpaceFOM::ExecutionControl::sample_mode_transition_latency():" << __LINE__
+          << " '" << label << "' request-to-transition latency: "
+          << latency_ms << " milliseconds." << THLA_ENDL;
+      send_hs( stdout, msg.str().c_str() );
+   }
+}
+
 bool ExecutionControl::set_pending_mtr(
    MTREnum mtr_value )
 {
@@ -2145,6 +2209,9 @@ bool ExecutionControl::run_mode_transition()
       this->current_execution_control_mode = EXECUTION_CONTROL_RUNNING;
       ExCO->set_current_execution_mode( EXECUTION_MODE_RUNNING );
 
+      // Record the request-to-transition latency for this mode change.
+      sample_mode_transition_latency( "mtr_run" );
+
       // Check for CTE.
       if ( this->does_cte_timeline_exist() ) {
 
@@ -2235,6 +2302,9 @@ bool ExecutionControl::freeze_mode_transition()
       // Set the current execution mode to freeze.
       this->current_execution_control_mode = EXECUTION_CONTROL_FREEZE;
       ExCO->set_current_execution_mode( EXECUTION_MODE_FREEZE );
+
+      // Record the request-to-transition latency for this mode change.
+      sample_mode_transition_latency( "mtr_freeze" );
    }
    return false;
 }
@@ -2765,7 +2835,9 @@ void ExecutionControl::receive_root_ref_frame()
          // Check for shutdown.
          federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         // Block until the FedAmb reflection callback signals the arrival
+         // of data or the bounded wait times out.
+         rrf_object->wait_for_data_arrival( 0.010 );
 
          if ( !rrf_object->is_changed() ) {
 
@@ -0,0 +1,192 @@
+/*!
+@file SpaceFOM/GpuBatchCompute.cpp
+@ingroup SpaceFOM
+@brief GPU offload facade for the embarrassingly-parallel batch kernels.
+
+The host side of the facade. The device layer it calls into lives in
+GpuBatchComputeKernels.cu and is only linked in when SPACEFOM_GPU_OFFLOAD
+is defined; without the define this translation unit compiles to the CPU
+fallback behavior on its own.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{GpuBatchCompute.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+
+// SpaceFOM include files.
+#include "SpaceFOM/GpuBatchCompute.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+#ifdef SPACEFOM_GPU_OFFLOAD
+// Device layer implemented in GpuBatchComputeKernels.cu, compiled with
+// nvcc (or hipcc) by the sim's S_overrides.mk.
+extern "C" {
+int   spacefom_gpu_device_available( void );
+void *spacefom_gpu_alloc_pinned( size_t bytes );
+void  spacefom_gpu_free_pinned( void *ptr );
+int   spacefom_gpu_transform_states( double const *frame_state,
+                                     double const *states_in,
+                                     double       *states_out,
+                                     unsigned int  count );
+int   spacefom_gpu_propagate( double        compensate_dt,
+                              double        integ_dt,
+                              double        integ_tol,
+                              int           use_rk2,
+                              int           num_instances,
+                              double       *states,
+                              double const *acc,
+                              double const *ang_acc );
+}
+#endif
+
+// Declare the static GpuBatchCompute variables.
+int GpuBatchCompute::offload_threshold = 256;
+int GpuBatchCompute::device_available  = -1;
+
+bool GpuBatchCompute::is_available()
+{
+#ifdef SPACEFOM_GPU_OFFLOAD
+   // Probe the device once and cache the result. The probe only runs on
+   // the first call so a race just repeats the idempotent probe.
+   if ( device_available < 0 ) {
+      device_available = spacefom_gpu_device_available() ? 1 : 0;
+   }
+   return ( device_available == 1 );
+#else
+   return ( false );
+#endif
+}
+
+void GpuBatchCompute::set_offload_threshold(
+   int const count )
+{
+   offload_threshold = ( count > 0 ) ? count : 0;
+}
+
+int GpuBatchCompute::get_offload_threshold()
+{
+   return ( offload_threshold );
+}
+
+bool GpuBatchCompute::should_offload(
+   int const count )
+{
+   return ( ( count >= offload_threshold ) && is_available() );
+}
+
+double *GpuBatchCompute::allocate_staging(
+   size_t const count )
+{
+   if ( count == 0 ) {
+      return ( NULL );
+   }
+#ifdef SPACEFOM_GPU_OFFLOAD
+   if ( is_available() ) {
+      double *ptr = static_cast< double * >(
+         spacefom_gpu_alloc_pinned( count * sizeof( double ) ) );
+      if ( ptr != NULL ) {
+         return ( ptr );
+      }
+      // Fall through to heap memory if the pinned allocation failed.
+   }
+#endif
+   return ( new double[count] );
+}
+
+void GpuBatchCompute::free_staging(
+   double *ptr )
+{
+   if ( ptr == NULL ) {
+      return;
+   }
+#ifdef SPACEFOM_GPU_OFFLOAD
+   if ( is_available() ) {
+      // The device layer frees pinned memory and hands anything else
+      // back for a heap delete.
+      spacefom_gpu_free_pinned( ptr );
+      return;
+   }
+#endif
+   delete[] ptr;
+}
+
+bool GpuBatchCompute::transform_states(
+   SpaceTimeCoordinateData const &frame_state,
+   SpaceTimeCoordinateData const *states_in,
+   SpaceTimeCoordinateData       *states_out,
+   unsigned int const             count )
+{
+#ifdef SPACEFOM_GPU_OFFLOAD
+   if ( !is_available() || ( count == 0 ) ) {
+      return ( false );
+   }
+   // SpaceTimeCoordinateData is a standard-layout block of fourteen
+   // doubles, so the state arrays cross to the device layer as flat
+   // double arrays.
+   return ( spacefom_gpu_transform_states(
+               reinterpret_cast< double const * >( &frame_state ),
+               reinterpret_cast< double const * >( states_in ),
+               reinterpret_cast< double * >( states_out ),
+               count )
+            == 0 );
+#else
+   (void)frame_state;
+   (void)states_in;
+   (void)states_out;
+   (void)count;
+   return ( false );
+#endif
+}
+
+bool GpuBatchCompute::propagate_entities(
+   double const  compensate_dt,
+   double const  integ_dt,
+   double const  integ_tol,
+   bool const    use_rk2,
+   int const     num_instances,
+   double       *states,
+   double const *acc,
+   double const *ang_acc )
+{
+#ifdef SPACEFOM_GPU_OFFLOAD
+   if ( !is_available() || ( num_instances <= 0 ) ) {
+      return ( false );
+   }
+   return ( spacefom_gpu_propagate( compensate_dt, integ_dt, integ_tol,
+                                    use_rk2 ? 1 : 0, num_instances,
+                                    states, acc, ang_acc )
+            == 0 );
+#else
+   (void)compensate_dt;
+   (void)integ_dt;
+   (void)integ_tol;
+   (void)use_rk2;
+   (void)num_instances;
+   (void)states;
+   (void)acc;
+   (void)ang_acc;
+   return ( false );
+#endif
+}
@@ -78,7 +78,8 @@ MTRInteractionHandler::MTRInteractionHandler(
      cte_time( 0.0 ),
      granted_time( 0.0 ),
      send_cnt( 0 ),
-     receive_cnt( 0 )
+     receive_cnt( 0 ),
+     user_supplied_tag( 0, 0 )
 {
    return;
 }
@@ -114,6 +115,14 @@ void MTRInteractionHandler::set_name(
       this->name = NULL;
    }
    this->name = trick_MM->mm_strdup( new_name );
+
+   // Preencode the user-supplied tag for the outgoing interaction so the
+   // mode-change critical path does not have to build it at send time.
+   if ( this->name != NULL ) {
+      this->user_supplied_tag = RTI1516_USERDATA( this->name, strlen( this->name ) );
+   } else {
+      this->user_supplied_tag = RTI1516_USERDATA( 0, 0 );
+   }
 }
 
 /*!
@@ -138,13 +147,9 @@ void MTRInteractionHandler::send_interaction(
    mtr_mode     = mode_request;
    mtr_mode_int = mtr_enum_to_int16( mode_request );
 
-   // Create a User Supplied Tag based off the name in this example.
-   RTI1516_USERDATA user_supplied_tag;
-   if ( name != NULL ) {
-      user_supplied_tag = RTI1516_USERDATA( name, strlen( name ) );
-   } else {
-      user_supplied_tag = RTI1516_USERDATA( 0, 0 );
-   }
+   // The user-supplied tag, based off the name in this example, is
+   // preencoded in set_name() to keep the encode work out of the
+   // mode-change critical path here.
 
    // Get the current time line values.
    scenario_time = this->get_scenario_time();
@@ -15,6 +15,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{../TrickHLA/AttributeBufferPool.cpp}
 @trick_link_dependency{../TrickHLA/Packing.cpp}
 @trick_link_dependency{PhysicalEntityBase.cpp}
 
@@ -192,10 +193,15 @@ void PhysicalEntityBase::base_config(
    //
    // Specify the Reference Frame attributes.
    //
+   // The name, type, status and parent frame strings never change after
+   // initialization, so they are configured as initialization-only. They
+   // are sent at initialization and on explicit attribute update requests
+   // but stay out of the cyclic send path, which avoids re-encoding the
+   // strings (including the UTF-16 conversion) on every update cycle.
    object->attributes[0].FOM_name      = allocate_input_string( "name" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.name" );
    object->attributes[0].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[0].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[0].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[0].publish       = publishes;
    object->attributes[0].subscribe     = !publishes;
    object->attributes[0].locally_owned = publishes;
@@ -204,7 +210,7 @@ void PhysicalEntityBase::base_config(
    object->attributes[1].FOM_name      = allocate_input_string( "type" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.type" );
    object->attributes[1].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[1].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[1].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[1].publish       = publishes;
    object->attributes[1].subscribe     = !publishes;
    object->attributes[1].locally_owned = publishes;
@@ -213,7 +219,7 @@ void PhysicalEntityBase::base_config(
    object->attributes[2].FOM_name      = allocate_input_string( "status" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.status" );
    object->attributes[2].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[2].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[2].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[2].publish       = publishes;
    object->attributes[2].subscribe     = !publishes;
    object->attributes[2].locally_owned = publishes;
@@ -222,7 +228,7 @@ void PhysicalEntityBase::base_config(
    object->attributes[3].FOM_name      = allocate_input_string( "parent_reference_frame" );
    trick_name_str                      = entity_name_str + string( ".pe_packing_data.parent_frame" );
    object->attributes[3].trick_name    = allocate_input_string( trick_name_str );
-   object->attributes[3].config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   object->attributes[3].config        = TrickHLA::CONFIG_INITIALIZE;
    object->attributes[3].publish       = publishes;
    object->attributes[3].subscribe     = !publishes;
    object->attributes[3].locally_owned = publishes;
@@ -397,6 +403,14 @@ void PhysicalEntityBase::initialize_callback(
    // We must call the original function so that the callback is initialized.
    this->TrickHLA::Packing::initialize_callback( obj );
 
+   // Carve the attribute staging buffers for this entity from the shared
+   // buffer pool. Entity objects are initialized consecutively, so their
+   // buffers end up laid out contiguously in iteration order, which
+   // improves the locality of the per-cycle pack loop.
+   for ( int i = 0; i < obj->attr_count; ++i ) {
+      obj->attributes[i].use_buffer_pool();
+   }
+
    // Get references to all the TrickHLA::Attribute for this object type.
    // We do this here so that we only do the attribute lookup once instead of
    // looking it up every time the unpack function is called.
@@ -18,6 +18,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../TrickHLA/Attribute.cpp}
 @trick_link_dependency{../TrickHLA/Conditional.cpp}
+@trick_link_dependency{../TrickHLA/ConditionalBatch.cpp}
 @trick_link_dependency{../TrickHLA/Object.cpp}
 @trick_link_dependency{PhysicalEntityConditionalBase.cpp}
 
@@ -38,7 +39,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/Attribute.hh"
-#include "TrickHLA/Conditional.hh"
+#include "TrickHLA/ConditionalBatch.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Object.hh"
 
@@ -54,7 +55,7 @@ using namespace SpaceFOM;
  */
 PhysicalEntityConditionalBase::PhysicalEntityConditionalBase(
    PhysicalEntityBase &entity_ref )
-   : TrickHLA::Conditional(),
+   : TrickHLA::ConditionalBatch(),
      debug( false ),
      entity( entity_ref ),
      prev_data(),
@@ -120,6 +121,22 @@ void PhysicalEntityConditionalBase::initialize_callback(
    cm_attr           = entity.cm_attr;
    body_frame_attr   = entity.body_frame_attr;
 
+   // Register the numeric attribute change thresholds with the batched
+   // conditional engine so they are all evaluated in one sweep per send
+   // instead of element-by-element in should_send(). An epsilon of zero
+   // matches the previous exact comparisons.
+   register_threshold( state_attr,
+                       reinterpret_cast< double const * >( &entity.pe_packing_data.state ),
+                       sizeof( entity.pe_packing_data.state ) / sizeof( double ),
+                       0.0 );
+   register_threshold( accel_attr, entity.pe_packing_data.accel, 3, 0.0 );
+   register_threshold( ang_accel_attr, entity.pe_packing_data.ang_accel, 3, 0.0 );
+   register_threshold( cm_attr, entity.pe_packing_data.cm, 3, 0.0 );
+   register_threshold( body_frame_attr,
+                       reinterpret_cast< double const * >( &entity.pe_packing_data.body_wrt_struct ),
+                       sizeof( entity.pe_packing_data.body_wrt_struct ) / sizeof( double ),
+                       0.0 );
+
    // Mark this Conditional instance as initialized.
    this->initialized = true;
 
@@ -258,77 +275,16 @@ bool PhysicalEntityConditionalBase::should_send(
          TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
       }
 
-   } // Check for change in state.
-   else if ( attr == state_attr ) {
-
-      if ( entity.pe_packing_data.state != prev_data.state ) {
-
-         // Update the previous value.
-         prev_data.state = entity.pe_packing_data.state;
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in translational acceleration.
-   else if ( attr == accel_attr ) {
-
-      if ( ( entity.pe_packing_data.accel[0] != prev_data.accel[0] )
-           || ( entity.pe_packing_data.accel[1] != prev_data.accel[1] )
-           || ( entity.pe_packing_data.accel[2] != prev_data.accel[2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            prev_data.accel[iinc] = entity.pe_packing_data.accel[iinc];
-         }
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in angular acceleration.
-   else if ( attr == ang_accel_attr ) {
-
-      if ( ( entity.pe_packing_data.ang_accel[0] != prev_data.ang_accel[0] )
-           || ( entity.pe_packing_data.ang_accel[1] != prev_data.ang_accel[1] )
-           || ( entity.pe_packing_data.ang_accel[2] != prev_data.ang_accel[2] ) ) {
+   } // The numeric attributes (state, accelerations, center of mass and the
+     // body frame orientation) are evaluated in one vectorized sweep by the
+     // batched conditional engine, so just consume the send bitmask here.
+   else if ( ( attr == state_attr )
+             || ( attr == accel_attr )
+             || ( attr == ang_accel_attr )
+             || ( attr == cm_attr )
+             || ( attr == body_frame_attr ) ) {
 
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            prev_data.ang_accel[iinc] = entity.pe_packing_data.ang_accel[iinc];
-         }
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in center of mass (cm).
-   else if ( attr == cm_attr ) {
-
-      if ( ( entity.pe_packing_data.cm[0] != prev_data.cm[0] )
-           || ( entity.pe_packing_data.cm[1] != prev_data.cm[1] )
-           || ( entity.pe_packing_data.cm[2] != prev_data.cm[2] ) ) {
-
-         // Update the previous value.
-         for ( int iinc = 0; iinc < 3; ++iinc ) {
-            prev_data.cm[iinc] = entity.pe_packing_data.cm[iinc];
-         }
-
-         // Mark to send.
-         send_attr = true;
-      }
-
-   } // Check for change in body frame definition.
-   else if ( attr == body_frame_attr ) {
-
-      if ( entity.pe_packing_data.body_wrt_struct != prev_data.body_wrt_struct ) {
-
-         // Update the previous value.
-         prev_data.body_wrt_struct = entity.pe_packing_data.body_wrt_struct;
-
-         // Mark to send.
-         send_attr = true;
-      }
+      send_attr = ConditionalBatch::should_send( attr );
 
    } else {
       ostringstream errmsg;
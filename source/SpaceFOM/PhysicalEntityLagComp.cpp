@@ -52,11 +52,106 @@ using namespace std;
 using namespace TrickHLA;
 using namespace SpaceFOM;
 
+namespace
+{
+
+// Dimension of the compensated state vector: position, velocity, attitude
+// quaternion and angular velocity.
+int const N_STATES = 13;
+
+/*! @brief Evaluate the constant-acceleration derivative of the fixed
+ * 13-dimension state vector, inlining the attitude quaternion derivative
+ * instead of dispatching through the virtual derivative callbacks. */
+inline void fixed_state_derivative(
+   double const y[N_STATES],
+   double const accel[3],
+   double const ang_accel[3],
+   double       yd[N_STATES] )
+{
+   // Translational position derivative is the velocity.
+   yd[0] = y[3];
+   yd[1] = y[4];
+   yd[2] = y[5];
+   // Translational velocity derivative is the constant acceleration.
+   yd[3] = accel[0];
+   yd[4] = accel[1];
+   yd[5] = accel[2];
+   // Attitude quaternion derivative from the angular velocity.
+   QuaternionData::compute_derivative( y[6], &y[7], &y[10], &yd[6], &yd[7] );
+   // Angular velocity derivative is the constant angular acceleration.
+   yd[10] = ang_accel[0];
+   yd[11] = ang_accel[1];
+   yd[12] = ang_accel[2];
+}
+
+/*! @brief Runge-Kutta propagation kernel with the stage count and the state
+ * dimension fixed at compile time, so the stage and state loops fully
+ * unroll and the derivative evaluation inlines with no virtual dispatch or
+ * integrator load/unload copies. */
+template< int STAGES >
+inline void propagate_fixed_state(
+   double       y[N_STATES],
+   double const accel[3],
+   double const ang_accel[3],
+   double const dt );
+
+// Two stage (midpoint) Runge-Kutta specialization.
+template<>
+inline void propagate_fixed_state< 2 >(
+   double       y[N_STATES],
+   double const accel[3],
+   double const ang_accel[3],
+   double const dt )
+{
+   double k1[N_STATES], k2[N_STATES], y_mid[N_STATES];
+
+   fixed_state_derivative( y, accel, ang_accel, k1 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y_mid[i] = y[i] + ( 0.5 * dt * k1[i] );
+   }
+   fixed_state_derivative( y_mid, accel, ang_accel, k2 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y[i] += dt * k2[i];
+   }
+}
+
+// Four stage (classic) Runge-Kutta specialization.
+template<>
+inline void propagate_fixed_state< 4 >(
+   double       y[N_STATES],
+   double const accel[3],
+   double const ang_accel[3],
+   double const dt )
+{
+   double k1[N_STATES], k2[N_STATES], k3[N_STATES], k4[N_STATES], y_stage[N_STATES];
+
+   fixed_state_derivative( y, accel, ang_accel, k1 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y_stage[i] = y[i] + ( 0.5 * dt * k1[i] );
+   }
+   fixed_state_derivative( y_stage, accel, ang_accel, k2 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y_stage[i] = y[i] + ( 0.5 * dt * k2[i] );
+   }
+   fixed_state_derivative( y_stage, accel, ang_accel, k3 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y_stage[i] = y[i] + ( dt * k3[i] );
+   }
+   fixed_state_derivative( y_stage, accel, ang_accel, k4 );
+   for ( int i = 0; i < N_STATES; ++i ) {
+      y[i] += ( dt / 6.0 ) * ( k1[i] + ( 2.0 * k2[i] ) + ( 2.0 * k3[i] ) + k4[i] );
+   }
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 PhysicalEntityLagComp::PhysicalEntityLagComp( PhysicalEntityBase &entity_ref ) // RETURN: -- None.
-   : PhysicalEntityLagCompInteg( entity_ref )
+   : PhysicalEntityLagCompInteg( entity_ref ),
+     use_unrolled_integ( true ),
+     unrolled_integ_stages( 4 )
 {
 
    // Assign the integrator state references.
@@ -100,6 +195,22 @@ PhysicalEntityLagComp::~PhysicalEntityLagComp() // RETURN: -- None.
 void PhysicalEntityLagComp::initialize()
 {
 
+   // The unrolled kernels are only specialized for the 2 and 4 stage
+   // Runge-Kutta schemes.
+   if ( this->use_unrolled_integ
+        && ( this->unrolled_integ_stages != 2 )
+        && ( this->unrolled_integ_stages != 4 ) ) {
+      ostringstream errmsg;
+
+      errmsg << "SpaceFOM::PhysicalEntityLagComp::initialize():" << __LINE__
+             << " ERROR: The 'unrolled_integ_stages' setting must be either 2 or 4"
+             << " but is " << this->unrolled_integ_stages << "! Please check your"
+             << " input or modified-data files to make sure the Runge-Kutta stage"
+             << " count is correctly specified." << THLA_ENDL;
+      // Print message and terminate.
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
    // Create and get a reference to the Trick Euler integrator.
    this->integrator = Trick::getIntegrator( Euler, 26, this->integ_dt );
 
@@ -198,3 +309,103 @@ void PhysicalEntityLagComp::derivative_first(
 
    return;
 }
+
+/*!
+ * @job_class{integration}
+ */
+int PhysicalEntityLagComp::integrate(
+   double const t_begin,
+   double const t_end )
+{
+   // Fall back to the generic Trick integrator path when the unrolled
+   // kernels are disabled, which a subclass with a custom derivative model
+   // must do because the kernels inline the constant-acceleration
+   // derivative evaluation.
+   if ( !this->use_unrolled_integ ) {
+      return PhysicalEntityLagCompInteg::integrate( t_begin, t_end );
+   }
+
+   double const compensate_dt = t_end - t_begin;
+   double       dt_go         = compensate_dt;
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream errmsg;
+      errmsg << "**** PhysicalEntityLagComp::integrate(): "
+             << "Unrolled RK" << this->unrolled_integ_stages
+             << " compensate: t_begin, t_end, dt_go: "
+             << t_begin << ", " << t_end << ", " << dt_go << endl;
+      send_hs( stderr, errmsg.str().c_str() );
+   }
+
+   // Gather the fixed 13-dimension state vector.
+   double y[N_STATES];
+   y[0]  = this->lag_comp_data.pos[0];
+   y[1]  = this->lag_comp_data.pos[1];
+   y[2]  = this->lag_comp_data.pos[2];
+   y[3]  = this->lag_comp_data.vel[0];
+   y[4]  = this->lag_comp_data.vel[1];
+   y[5]  = this->lag_comp_data.vel[2];
+   y[6]  = this->lag_comp_data.att.scalar;
+   y[7]  = this->lag_comp_data.att.vector[0];
+   y[8]  = this->lag_comp_data.att.vector[1];
+   y[9]  = this->lag_comp_data.att.vector[2];
+   y[10] = this->lag_comp_data.ang_vel[0];
+   y[11] = this->lag_comp_data.ang_vel[1];
+   y[12] = this->lag_comp_data.ang_vel[2];
+
+   // Set the current integration time.
+   this->integ_t          = t_begin;
+   double time_integrated = 0.0;
+
+   // Loop through integrating the state forward to the current scenario time.
+   while ( ( dt_go >= 0.0 ) && ( fabs( dt_go ) > this->integ_tol ) ) {
+
+      // Near the end use the remainder of the time step, otherwise use the
+      // defined integration step size.
+      double const dt = ( dt_go > this->integ_dt ) ? this->integ_dt : dt_go;
+
+      // Propagate the state one integration step with the unrolled kernel.
+      if ( this->unrolled_integ_stages == 2 ) {
+         propagate_fixed_state< 2 >( y, this->accel, this->ang_accel, dt );
+      } else {
+         propagate_fixed_state< 4 >( y, this->accel, this->ang_accel, dt );
+      }
+
+      // Normalize the propagated attitude quaternion, like the generic
+      // integrator path does when unloading each integration step.
+      QuaternionData::normalize( &y[6], &y[7] );
+
+      // Update the integration time.
+      time_integrated += dt;
+      this->integ_t = t_begin + time_integrated;
+
+      // Compute the remaining time in the compensation step.
+      dt_go = compensate_dt - time_integrated;
+   }
+
+   // Scatter the propagated state back into the lag compensated state.
+   this->lag_comp_data.pos[0]        = y[0];
+   this->lag_comp_data.pos[1]        = y[1];
+   this->lag_comp_data.pos[2]        = y[2];
+   this->lag_comp_data.vel[0]        = y[3];
+   this->lag_comp_data.vel[1]        = y[4];
+   this->lag_comp_data.vel[2]        = y[5];
+   this->lag_comp_data.att.scalar    = y[6];
+   this->lag_comp_data.att.vector[0] = y[7];
+   this->lag_comp_data.att.vector[1] = y[8];
+   this->lag_comp_data.att.vector[2] = y[9];
+   this->lag_comp_data.ang_vel[0]    = y[10];
+   this->lag_comp_data.ang_vel[1]    = y[11];
+   this->lag_comp_data.ang_vel[2]    = y[12];
+
+   // Update the lag compensated time.
+   update_time();
+
+   // Compute the derivative of the attitude quaternion for the
+   // compensated state.
+   this->derivative_first();
+
+   return ( 0 );
+}
@@ -0,0 +1,249 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompBatchInteg.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+physical entity batched latency/lag compensation integration engine.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{PhysicalEntityLagCompBatchInteg.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+
+// TrickHLA include files.
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompBatchInteg.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityLagCompBatchInteg::PhysicalEntityLagCompBatchInteg() // RETURN: -- None.
+   : TrickHLA::LagCompensationIntegBase()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityLagCompBatchInteg::~PhysicalEntityLagCompBatchInteg() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityLagCompBatchInteg::add_entity(
+   PhysicalEntityLagCompBase &lag_comp )
+{
+   entities.push_back( &lag_comp );
+
+   // Size the structure-of-arrays working state for the new entity.
+   size_t const num_entities = entities.size();
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      pos[iinc].resize( num_entities );
+      vel[iinc].resize( num_entities );
+      acc[iinc].resize( num_entities );
+      att_v[iinc].resize( num_entities );
+      qdot_v[iinc].resize( num_entities );
+      ang_vel[iinc].resize( num_entities );
+      ang_acc[iinc].resize( num_entities );
+   }
+   att_s.resize( num_entities );
+   qdot_s.resize( num_entities );
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchInteg::update_time()
+{
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      entities[einc]->lag_comp_data.time = this->integ_t;
+   }
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchInteg::load()
+{
+   // Gather the entity states into the structure-of-arrays working state.
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      SpaceTimeCoordinateData const &state = entities[einc]->lag_comp_data;
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         pos[iinc][einc]     = state.pos[iinc];
+         vel[iinc][einc]     = state.vel[iinc];
+         acc[iinc][einc]     = entities[einc]->accel[iinc];
+         att_v[iinc][einc]   = state.att.vector[iinc];
+         ang_vel[iinc][einc] = state.ang_vel[iinc];
+         ang_acc[iinc][einc] = entities[einc]->ang_accel[iinc];
+      }
+      att_s[einc] = state.att.scalar;
+   }
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void PhysicalEntityLagCompBatchInteg::unload()
+{
+   // Scatter the structure-of-arrays working state back into the entities.
+   for ( size_t einc = 0; einc < entities.size(); ++einc ) {
+      SpaceTimeCoordinateData &state = entities[einc]->lag_comp_data;
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         state.pos[iinc]        = pos[iinc][einc];
+         state.vel[iinc]        = vel[iinc][einc];
+         state.att.vector[iinc] = att_v[iinc][einc];
+         state.ang_vel[iinc]    = ang_vel[iinc][einc];
+      }
+      state.att.scalar = att_s[einc];
+
+      // Normalize the propagated attitude quaternion.
+      state.att.normalize();
+
+      // Compute the derivative of the attitude quaternion from the
+      // angular velocity vector.
+      entities[einc]->Q_dot.derivative_first( state.att, state.ang_vel );
+   }
+   return;
+}
+
+/*!
+ * @details Computes the attitude quaternion rates for all the entities in
+ * flat component loops over the structure-of-arrays working state.
+ *
+ * @job_class{derivative}
+ */
+void PhysicalEntityLagCompBatchInteg::derivative_first(
+   void *user_data )
+{
+   size_t const num_entities = entities.size();
+
+   double const *qs = &att_s[0];
+   double const *qx = &att_v[0][0];
+   double const *qy = &att_v[1][0];
+   double const *qz = &att_v[2][0];
+   double const *wx = &ang_vel[0][0];
+   double const *wy = &ang_vel[1][0];
+   double const *wz = &ang_vel[2][0];
+
+   for ( size_t einc = 0; einc < num_entities; ++einc ) {
+      qdot_s[einc]    = ( ( qx[einc] * wx[einc] ) + ( qy[einc] * wy[einc] ) + ( qz[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[0][einc] = ( ( -qs[einc] * wx[einc] ) + ( -qz[einc] * wy[einc] ) + ( qy[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[1][einc] = ( ( qz[einc] * wx[einc] ) + ( -qs[einc] * wy[einc] ) + ( -qx[einc] * wz[einc] ) ) * 0.5;
+      qdot_v[2][einc] = ( ( -qy[einc] * wx[einc] ) + ( qx[einc] * wy[einc] ) + ( -qs[einc] * wz[einc] ) ) * 0.5;
+   }
+   return;
+}
+
+/*!
+ * @job_class{derivative}
+ */
+void PhysicalEntityLagCompBatchInteg::derivative_second(
+   void *user_data )
+{
+   // Not used by the first order batched propagation.
+   return;
+}
+
+/*!
+ * @details Mirrors the per-entity TrickHLA::LagCompensationInteg::integrate()
+ * loop but advances all the registered entities together: each Euler step is
+ * a set of flat loops over the structure-of-arrays working state.
+ *
+ * @job_class{integration}
+ */
+int PhysicalEntityLagCompBatchInteg::integrate(
+   double const t_begin,
+   double const t_end )
+{
+   size_t const num_entities = entities.size();
+   double       dt_go        = t_end - t_begin;
+
+   this->integ_t = t_begin;
+
+   if ( num_entities == 0 ) {
+      return ( 0 );
+   }
+
+   // Gather the entity states into the structure-of-arrays working state.
+   load();
+
+   // Loop through integrating the states forward to the current scenario time.
+   while ( ( dt_go >= 0.0 ) && ( fabs( dt_go ) > this->integ_tol ) ) {
+
+      // Near the end use the remainder of the compensation step, otherwise
+      // use the defined integration step size.
+      double const dt = ( dt_go > this->integ_dt ) ? this->integ_dt : dt_go;
+
+      // Compute the attitude quaternion rates for all the entities.
+      derivative_first();
+
+      // Euler propagation, one flat loop per state component.
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         double       *p  = &pos[iinc][0];
+         double       *v  = &vel[iinc][0];
+         double const *a  = &acc[iinc][0];
+         double       *qv = &att_v[iinc][0];
+         double const *qd = &qdot_v[iinc][0];
+         double       *w  = &ang_vel[iinc][0];
+         double const *wd = &ang_acc[iinc][0];
+
+         for ( size_t einc = 0; einc < num_entities; ++einc ) {
+            p[einc] += v[einc] * dt;
+            v[einc] += a[einc] * dt;
+            qv[einc] += qd[einc] * dt;
+            w[einc] += wd[einc] * dt;
+         }
+      }
+      for ( size_t einc = 0; einc < num_entities; ++einc ) {
+         att_s[einc] += qdot_s[einc] * dt;
+      }
+
+      // Update the integration time and the remaining compensation time.
+      this->integ_t += dt;
+      dt_go = t_end - this->integ_t;
+   }
+
+   // Scatter the propagated states back into the entities.
+   unload();
+
+   // Update the lag compensated time of the entities.
+   update_time();
+
+   return ( 0 );
+}
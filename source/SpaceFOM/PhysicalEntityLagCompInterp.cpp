@@ -0,0 +1,275 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompInterp.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+PhysicalEntity latency/lag compensation class that interpolates a
+history of received states.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{PhysicalEntityLagCompInterp.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/message_proto.h" // for send_hs
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityLagCompInterp.hh"
+#include "SpaceFOM/QuaternionData.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityLagCompInterp::PhysicalEntityLagCompInterp( PhysicalEntityBase &entity_ref ) // RETURN: -- None.
+   : PhysicalEntityLagCompBase( entity_ref ),
+     state_history_head( 0 ),
+     state_history_count( 0 )
+{
+   for ( int n = 0; n < STATE_HISTORY_SIZE; ++n ) {
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         this->state_history_accel[n][iinc]     = 0.0;
+         this->state_history_ang_accel[n][iinc] = 0.0;
+      }
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityLagCompInterp::~PhysicalEntityLagCompInterp() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityLagCompInterp::initialize()
+{
+   // Start with an empty state history.
+   this->state_history_head  = 0;
+   this->state_history_count = 0;
+
+   // Call the base class initialize function.
+   PhysicalEntityLagCompBase::initialize();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @details The state loaded by the caller is recorded as the newest sample
+ * in the state history ring buffer and the compensated state is evaluated
+ * from the history, so no numeric integration is performed. Dropped or
+ * jittered updates just leave the previous samples in place and the
+ * evaluation extrapolates from the newest ones.
+ * @job_class{scheduled}
+ */
+int PhysicalEntityLagCompInterp::compensate(
+   const double t_begin,
+   const double t_end )
+{
+   this->compensate_dt = t_end - t_begin;
+
+   // Record the state the caller just loaded, timestamped with the data time.
+   record_state_sample( t_begin );
+
+   // Evaluate the compensated state at the requested time.
+   interpolate_state( t_end );
+
+   // The compensated state is valid at the evaluation time.
+   this->lag_comp_data.time = t_end;
+
+   // Normalize the interpolated attitude quaternion.
+   this->lag_comp_data.att.normalize();
+
+   // Compute the derivative of the attitude quaternion from the
+   // angular velocity vector.
+   this->Q_dot.derivative_first( this->lag_comp_data.att,
+                                 this->lag_comp_data.ang_vel );
+
+   return ( 0 );
+}
+
+/*!
+ * @details A sample older than the newest buffered one is ignored and a
+ * sample at the same time replaces it, so out of order or repeated data
+ * never corrupts the time ordering of the ring buffer.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::record_state_sample(
+   double const time )
+{
+   if ( state_history_count > 0 ) {
+      double const newest_time = state_history[state_history_head].time;
+      if ( time < newest_time ) {
+         // Stale data, leave the history as is.
+         return;
+      }
+      if ( time > newest_time ) {
+         // Advance the ring buffer head for a new sample.
+         this->state_history_head = ( state_history_head + 1 ) % STATE_HISTORY_SIZE;
+         if ( state_history_count < STATE_HISTORY_SIZE ) {
+            ++state_history_count;
+         }
+      }
+      // A sample at the same time as the newest one just replaces it.
+   } else {
+      this->state_history_head  = 0;
+      this->state_history_count = 1;
+   }
+
+   state_history[state_history_head] = this->lag_comp_data;
+   state_history[state_history_head].time = time;
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      this->state_history_accel[state_history_head][iinc]     = this->accel[iinc];
+      this->state_history_ang_accel[state_history_head][iinc] = this->ang_accel[iinc];
+   }
+}
+
+/*!
+ * @details With two or more samples the state is evaluated with the cubic
+ * Hermite polynomial through the two samples bracketing the evaluation
+ * time, using the velocity, acceleration, rotational acceleration and
+ * attitude quaternion rate as the channel derivatives. A time beyond the
+ * newest sample evaluates the same polynomial past its end, which reduces
+ * the evaluation to a smooth extrapolation. With a single sample a second
+ * order Taylor expansion of that sample is used instead.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompInterp::interpolate_state(
+   double const time )
+{
+   if ( state_history_count < 1 ) {
+      // Nothing buffered, leave the loaded state untouched.
+      return;
+   }
+
+   if ( state_history_count == 1 ) {
+      // Only one sample, use a Taylor expansion about it.
+      SpaceTimeCoordinateData const &s  = state_history[state_history_head];
+      double const                  *sa = state_history_accel[state_history_head];
+      double const                  *sw = state_history_ang_accel[state_history_head];
+
+      double const dt = time - s.time;
+
+      QuaternionData q_dot;
+      q_dot.derivative_first( s.att, s.ang_vel );
+
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         this->lag_comp_data.pos[iinc]     = s.pos[iinc] + ( s.vel[iinc] * dt ) + ( 0.5 * sa[iinc] * dt * dt );
+         this->lag_comp_data.vel[iinc]     = s.vel[iinc] + ( sa[iinc] * dt );
+         this->lag_comp_data.ang_vel[iinc] = s.ang_vel[iinc] + ( sw[iinc] * dt );
+      }
+      this->lag_comp_data.att.scalar = s.att.scalar + ( q_dot.scalar * dt );
+      for ( int iinc = 0; iinc < 3; ++iinc ) {
+         this->lag_comp_data.att.vector[iinc] = s.att.vector[iinc] + ( q_dot.vector[iinc] * dt );
+      }
+      return;
+   }
+
+   // Find the pair of consecutive samples bracketing the evaluation time,
+   // walking back from the newest sample. A time beyond the newest sample
+   // uses the newest pair, which extrapolates the Hermite polynomial.
+   int i1 = state_history_head;
+   int i0 = ( i1 + STATE_HISTORY_SIZE - 1 ) % STATE_HISTORY_SIZE;
+   for ( int n = 2; n < state_history_count; ++n ) {
+      if ( time >= state_history[i0].time ) {
+         break;
+      }
+      i1 = i0;
+      i0 = ( i0 + STATE_HISTORY_SIZE - 1 ) % STATE_HISTORY_SIZE;
+   }
+
+   SpaceTimeCoordinateData const &s0 = state_history[i0];
+   SpaceTimeCoordinateData const &s1 = state_history[i1];
+
+   double const h = s1.time - s0.time;
+   if ( h <= 0.0 ) {
+      // Degenerate spacing, fall back to the newest sample as is.
+      this->lag_comp_data = s1;
+      return;
+   }
+
+   // Cubic Hermite basis functions evaluated at the normalized time. A
+   // normalized time greater than one extrapolates beyond the newest sample.
+   double const s   = ( time - s0.time ) / h;
+   double const s2  = s * s;
+   double const s3  = s2 * s;
+   double const h00 = ( 2.0 * s3 ) - ( 3.0 * s2 ) + 1.0;
+   double const h10 = s3 - ( 2.0 * s2 ) + s;
+   double const h01 = ( -2.0 * s3 ) + ( 3.0 * s2 );
+   double const h11 = s3 - s2;
+
+   double const *a0 = state_history_accel[i0];
+   double const *a1 = state_history_accel[i1];
+   double const *w0 = state_history_ang_accel[i0];
+   double const *w1 = state_history_ang_accel[i1];
+
+   // Position with the velocities as the channel derivatives, velocity
+   // with the accelerations, and angular velocity with the rotational
+   // accelerations.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      this->lag_comp_data.pos[iinc] = ( h00 * s0.pos[iinc] )
+                                      + ( h10 * h * s0.vel[iinc] )
+                                      + ( h01 * s1.pos[iinc] )
+                                      + ( h11 * h * s1.vel[iinc] );
+      this->lag_comp_data.vel[iinc] = ( h00 * s0.vel[iinc] )
+                                      + ( h10 * h * a0[iinc] )
+                                      + ( h01 * s1.vel[iinc] )
+                                      + ( h11 * h * a1[iinc] );
+      this->lag_comp_data.ang_vel[iinc] = ( h00 * s0.ang_vel[iinc] )
+                                          + ( h10 * h * w0[iinc] )
+                                          + ( h01 * s1.ang_vel[iinc] )
+                                          + ( h11 * h * w1[iinc] );
+   }
+
+   // Attitude quaternion components with the quaternion rates as the
+   // channel derivatives, normalized by the caller.
+   QuaternionData q_dot0;
+   QuaternionData q_dot1;
+   q_dot0.derivative_first( s0.att, s0.ang_vel );
+   q_dot1.derivative_first( s1.att, s1.ang_vel );
+
+   this->lag_comp_data.att.scalar = ( h00 * s0.att.scalar )
+                                    + ( h10 * h * q_dot0.scalar )
+                                    + ( h01 * s1.att.scalar )
+                                    + ( h11 * h * q_dot1.scalar );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      this->lag_comp_data.att.vector[iinc] = ( h00 * s0.att.vector[iinc] )
+                                             + ( h10 * h * q_dot0.vector[iinc] )
+                                             + ( h01 * s1.att.vector[iinc] )
+                                             + ( h11 * h * q_dot1.vector[iinc] );
+   }
+}
@@ -65,7 +65,8 @@ PhysicalInterfaceBase::PhysicalInterfaceBase() // RETURN: -- None.
      parent_attr( NULL ),
      position_attr( NULL ),
      attitude_attr( NULL ),
-     quat_encoder( packing_data.attitude )
+     quat_encoder( packing_data.attitude ),
+     batch_packed( false )
 {
    V_INIT( packing_data.position );
 }
@@ -317,6 +318,20 @@ void PhysicalInterfaceBase::pack()
       send_hs( stderr, errmsg.str().c_str() );
    }
 
+   // When a PhysicalInterfaceBatchPack group manages this interface the
+   // group sweep has already filled the packing data and encoded the wire
+   // buffer, so there is nothing left to do here.
+   if ( this->batch_packed ) {
+
+      // Print out debug information if desired.
+      if ( debug ) {
+         cout << "PhysicalInterfaceBase::pack():" << __LINE__
+              << " Batch packed." << endl;
+         this->print_data();
+      }
+      return;
+   }
+
    // Check for latency/lag compensation.
    if ( this->object->lag_comp == NULL ) {
       this->pack_from_working_data();
@@ -0,0 +1,145 @@
+/*!
+@file SpaceFOM/PhysicalInterfaceBatchPack.cpp
+@ingroup SpaceFOM
+@brief This class provides batched packing for a group of SpaceFOM
+PhysicalInterface instances.
+
+@copyright Copyright 2023 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{PhysicalInterfaceBase.cpp}
+@trick_link_dependency{PhysicalInterfaceBatchPack.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <sstream>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalInterfaceBatchPack.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+// Position (3), attitude quaternion scalar (1) and vector (3).
+int const PhysicalInterfaceBatchPack::STATE_STRIDE = 7;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalInterfaceBatchPack::PhysicalInterfaceBatchPack() // RETURN: -- None.
+   : interfaces(),
+     states(),
+     provider( NULL ),
+     provider_udata( NULL )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalInterfaceBatchPack::~PhysicalInterfaceBatchPack() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalInterfaceBatchPack::add_interface(
+   PhysicalInterfaceBase &interface )
+{
+   // Mark the interface as group managed so its own pack() becomes a
+   // no-op and does not overwrite or re-encode the group packed data.
+   interface.batch_packed = true;
+
+   interfaces.push_back( &interface );
+
+   // Grow the contiguous group state array to match.
+   states.resize( interfaces.size() * STATE_STRIDE, 0.0 );
+
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalInterfaceBatchPack::set_provider(
+   StateProviderFunc provider,
+   void             *udata )
+{
+   this->provider       = provider;
+   this->provider_udata = udata;
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalInterfaceBatchPack::pack_group()
+{
+   int const num_interfaces = (int)interfaces.size();
+
+   // Nothing to do for an empty group.
+   if ( num_interfaces == 0 ) {
+      return;
+   }
+
+   // A populated group without a provider is a configuration error.
+   if ( provider == NULL ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalInterfaceBatchPack::pack_group():" << __LINE__
+             << " ERROR: No group state provider has been set. Call"
+             << " set_provider() before the first pack_group() call!"
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   // Let the provider fill the contiguous group state array in one call.
+   ( *provider )( num_interfaces, &states[0], provider_udata );
+
+   // Sweep the group states into the interfaces' packing data and encode
+   // the wire buffers, without going through the per-interface virtual
+   // pack dispatch.
+   for ( int iinc = 0; iinc < num_interfaces; ++iinc ) {
+
+      PhysicalInterfaceBase *interface = interfaces[iinc];
+      double const          *state     = &states[iinc * STATE_STRIDE];
+
+      interface->packing_data.position[0] = state[0];
+      interface->packing_data.position[1] = state[1];
+      interface->packing_data.position[2] = state[2];
+
+      interface->packing_data.attitude.scalar    = state[3];
+      interface->packing_data.attitude.vector[0] = state[4];
+      interface->packing_data.attitude.vector[1] = state[5];
+      interface->packing_data.attitude.vector[2] = state[6];
+
+      // Encode the data into the wire buffer.
+      interface->quat_encoder.encode();
+   }
+
+   return;
+}
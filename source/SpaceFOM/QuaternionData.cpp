@@ -31,6 +31,17 @@ NASA, Johnson Space Center\n
 // C includes.
 #include <math.h>
 
+// Use the processor vector unit for the hot quaternion kernels when the
+// compiler makes one available. These paths compute exactly the same
+// products as the portable scalar code they replace.
+#if defined( __SSE2__ )
+#   include <emmintrin.h>
+#   define SPACEFOM_QUAT_SSE2
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#   include <arm_neon.h>
+#   define SPACEFOM_QUAT_NEON
+#endif
+
 // Trick includes.
 #include "trick/constant.h"
 #include "trick/trick_math.h"
@@ -403,6 +414,116 @@ void QuaternionData::conjugate_transform_vector(
    return;
 }
 
+/*!
+ * @details The quaternion is expanded into the equivalent transformation
+ * matrix once, which amortizes all the quaternion-dependent products across
+ * the batch and leaves nine multiplies per vector for the matrix-vector
+ * products.
+ * @job_class{scheduled}
+ */
+void QuaternionData::transform_vectors(
+   double const *v_in,
+   double       *v_out,
+   int const     count ) const
+{
+   double T[3][3];
+
+   // Expand this quaternion into the matrix form of transform_vector():
+   // T = (s^2 - |qv|^2) I + 2s [qv]x + 2 qv qv^T
+   {
+      double const s       = scalar;
+      double const q1      = vector[0];
+      double const q2      = vector[1];
+      double const q3      = vector[2];
+      double const ss_m_vv = ( s * s ) - ( ( q1 * q1 ) + ( q2 * q2 ) + ( q3 * q3 ) );
+
+      T[0][0] = ss_m_vv + ( 2.0 * q1 * q1 );
+      T[0][1] = 2.0 * ( ( q1 * q2 ) - ( s * q3 ) );
+      T[0][2] = 2.0 * ( ( q1 * q3 ) + ( s * q2 ) );
+      T[1][0] = 2.0 * ( ( q1 * q2 ) + ( s * q3 ) );
+      T[1][1] = ss_m_vv + ( 2.0 * q2 * q2 );
+      T[1][2] = 2.0 * ( ( q2 * q3 ) - ( s * q1 ) );
+      T[2][0] = 2.0 * ( ( q1 * q3 ) - ( s * q2 ) );
+      T[2][1] = 2.0 * ( ( q2 * q3 ) + ( s * q1 ) );
+      T[2][2] = ss_m_vv + ( 2.0 * q3 * q3 );
+   }
+
+#if defined( SPACEFOM_QUAT_SSE2 )
+   // Hold the first two rows of each matrix column in a register so the x
+   // and y components of each output vector are computed pairwise.
+   __m128d const col0 = _mm_set_pd( T[1][0], T[0][0] );
+   __m128d const col1 = _mm_set_pd( T[1][1], T[0][1] );
+   __m128d const col2 = _mm_set_pd( T[1][2], T[0][2] );
+
+   for ( int i = 0; i < count; ++i ) {
+      double const *v = &v_in[i * 3];
+      double       *w = &v_out[i * 3];
+
+      __m128d out01 = _mm_mul_pd( col0, _mm_set1_pd( v[0] ) );
+      out01         = _mm_add_pd( out01, _mm_mul_pd( col1, _mm_set1_pd( v[1] ) ) );
+      out01         = _mm_add_pd( out01, _mm_mul_pd( col2, _mm_set1_pd( v[2] ) ) );
+
+      // Compute the z component before the stores so that transforming an
+      // array in place works.
+      double const out2 = ( T[2][0] * v[0] ) + ( T[2][1] * v[1] ) + ( T[2][2] * v[2] );
+
+      _mm_storeu_pd( &w[0], out01 );
+      w[2] = out2;
+   }
+#elif defined( SPACEFOM_QUAT_NEON )
+   // Hold the first two rows of each matrix column in a register so the x
+   // and y components of each output vector are computed pairwise.
+   float64x2_t const col0 = vcombine_f64( vld1_f64( &T[0][0] ), vld1_f64( &T[1][0] ) );
+   float64x2_t const col1 = vcombine_f64( vld1_f64( &T[0][1] ), vld1_f64( &T[1][1] ) );
+   float64x2_t const col2 = vcombine_f64( vld1_f64( &T[0][2] ), vld1_f64( &T[1][2] ) );
+
+   for ( int i = 0; i < count; ++i ) {
+      double const *v = &v_in[i * 3];
+      double       *w = &v_out[i * 3];
+
+      float64x2_t out01 = vmulq_n_f64( col0, v[0] );
+      out01             = vfmaq_n_f64( out01, col1, v[1] );
+      out01             = vfmaq_n_f64( out01, col2, v[2] );
+
+      // Compute the z component before the stores so that transforming an
+      // array in place works.
+      double const out2 = ( T[2][0] * v[0] ) + ( T[2][1] * v[1] ) + ( T[2][2] * v[2] );
+
+      vst1q_f64( &w[0], out01 );
+      w[2] = out2;
+   }
+#else
+   for ( int i = 0; i < count; ++i ) {
+      double const *v = &v_in[i * 3];
+      double       *w = &v_out[i * 3];
+
+      double const out0 = ( T[0][0] * v[0] ) + ( T[0][1] * v[1] ) + ( T[0][2] * v[2] );
+      double const out1 = ( T[1][0] * v[0] ) + ( T[1][1] * v[1] ) + ( T[1][2] * v[2] );
+      double const out2 = ( T[2][0] * v[0] ) + ( T[2][1] * v[1] ) + ( T[2][2] * v[2] );
+
+      w[0] = out0;
+      w[1] = out1;
+      w[2] = out2;
+   }
+#endif
+
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QuaternionData::conjugate_transform_vectors(
+   double const *v_in,
+   double       *v_out,
+   int const     count ) const
+{
+   QuaternionData q_star( *this );
+   q_star.conjugate();
+   q_star.transform_vectors( v_in, v_out, count );
+   return;
+}
+
 /***********************************************************************
  * Static methods.
  ***********************************************************************/
@@ -418,11 +539,6 @@ void QuaternionData::multiply_sv(
    double      *ps,
    double       pv[3] )
 {
-   // We use a working area because we do not know it the product happens to
-   // refer to either the left or right operands.
-   double ws;
-   double wv[3];
-
    // Quaternion multiplication:
    // p[s:v] = l[s:v] * r[s:v]
    // ps = (ls*rs) - |lv,rv|
@@ -430,10 +546,56 @@ void QuaternionData::multiply_sv(
 
    // Compute the scalar component:
    // ws = (ls*rs) - |lv,rv|
-   ws = ( ls * rs ) - ( ( lv[0] * rv[0] ) + ( lv[1] * rv[1] ) + ( lv[2] * rv[2] ) );
+   // All the results are computed into working variables before any store
+   // because the product may refer to either the left or right operands.
+   double const ws = ( ls * rs ) - ( ( lv[0] * rv[0] ) + ( lv[1] * rv[1] ) + ( lv[2] * rv[2] ) );
 
+#if defined( SPACEFOM_QUAT_SSE2 )
+   // Compute the first two vector components pairwise:
+   // wv = (lv X rv) + (ls * rv) + (lv * rs)
+   __m128d const lv01 = _mm_loadu_pd( &lv[0] );               // ( lv0, lv1 )
+   __m128d const rv01 = _mm_loadu_pd( &rv[0] );               // ( rv0, rv1 )
+   __m128d const lv12 = _mm_loadu_pd( &lv[1] );               // ( lv1, lv2 )
+   __m128d const rv12 = _mm_loadu_pd( &rv[1] );               // ( rv1, rv2 )
+   __m128d const lv20 = _mm_set_pd( lv[0], lv[2] );           // ( lv2, lv0 )
+   __m128d const rv20 = _mm_set_pd( rv[0], rv[2] );           // ( rv2, rv0 )
+
+   __m128d wv01 = _mm_sub_pd( _mm_mul_pd( lv12, rv20 ),
+                              _mm_mul_pd( lv20, rv12 ) );     // lv X rv
+   wv01         = _mm_add_pd( wv01, _mm_mul_pd( _mm_set1_pd( ls ), rv01 ) );
+   wv01         = _mm_add_pd( wv01, _mm_mul_pd( _mm_set1_pd( rs ), lv01 ) );
+
+   double const wv2 = ( ( lv[0] * rv[1] ) - ( lv[1] * rv[0] ) ) + ( ls * rv[2] ) + ( lv[2] * rs );
+
+   // Place results in the product quaternion.
+   *ps = ws;
+   _mm_storeu_pd( &pv[0], wv01 );
+   pv[2] = wv2;
+#elif defined( SPACEFOM_QUAT_NEON )
+   // Compute the first two vector components pairwise:
+   // wv = (lv X rv) + (ls * rv) + (lv * rs)
+   float64x2_t const lv01 = vld1q_f64( &lv[0] );                                  // ( lv0, lv1 )
+   float64x2_t const rv01 = vld1q_f64( &rv[0] );                                  // ( rv0, rv1 )
+   float64x2_t const lv12 = vld1q_f64( &lv[1] );                                  // ( lv1, lv2 )
+   float64x2_t const rv12 = vld1q_f64( &rv[1] );                                  // ( rv1, rv2 )
+   float64x2_t const lv20 = vcombine_f64( vld1_f64( &lv[2] ), vld1_f64( &lv[0] ) ); // ( lv2, lv0 )
+   float64x2_t const rv20 = vcombine_f64( vld1_f64( &rv[2] ), vld1_f64( &rv[0] ) ); // ( rv2, rv0 )
+
+   float64x2_t wv01 = vsubq_f64( vmulq_f64( lv12, rv20 ),
+                                 vmulq_f64( lv20, rv12 ) );                       // lv X rv
+   wv01             = vfmaq_n_f64( wv01, rv01, ls );
+   wv01             = vfmaq_n_f64( wv01, lv01, rs );
+
+   double const wv2 = ( ( lv[0] * rv[1] ) - ( lv[1] * rv[0] ) ) + ( ls * rv[2] ) + ( lv[2] * rs );
+
+   // Place results in the product quaternion.
+   *ps = ws;
+   vst1q_f64( &pv[0], wv01 );
+   pv[2] = wv2;
+#else
    // Compute the vector component:
    // wv = (lv X rv) + (ls * rv) + (lv * rs)
+   double wv[3];
    wv[0] = ( ( lv[1] * rv[2] ) - ( lv[2] * rv[1] ) ) + ( ls * rv[0] ) + ( lv[0] * rs );
    wv[1] = ( ( lv[2] * rv[0] ) - ( lv[0] * rv[2] ) ) + ( ls * rv[1] ) + ( lv[1] * rs );
    wv[2] = ( ( lv[0] * rv[1] ) - ( lv[1] * rv[0] ) ) + ( ls * rv[2] ) + ( lv[2] * rs );
@@ -443,6 +605,7 @@ void QuaternionData::multiply_sv(
    pv[0] = wv[0];
    pv[1] = wv[1];
    pv[2] = wv[2];
+#endif
 
    return;
 }
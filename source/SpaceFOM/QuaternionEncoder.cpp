@@ -31,6 +31,9 @@ NASA, Johnson Space Center\n
 // Trick include files.
 #include "trick/message_proto.h"
 
+// TrickHLA include files.
+#include "TrickHLA/Utilities.hh"
+
 // Model include files.
 #include "SpaceFOM/QuaternionEncoder.hh"
 
@@ -45,8 +48,13 @@ NASA, Johnson Space Center\n
 
 using namespace RTI1516_NAMESPACE;
 using namespace std;
+using namespace TrickHLA;
 using namespace SpaceFOM;
 
+/*! @brief Encoded size of the AttitudeQuaternion fixed record: the scalar
+ *  and vector fields are four packed little-endian doubles. */
+static size_t const QUATERNION_ENCODED_SIZE = 4 * sizeof( double );
+
 /**
  * @job_class{initialization}
  */
@@ -55,7 +63,8 @@ QuaternionEncoder::QuaternionEncoder(
    : data( quat_data ),
      scalar_encoder( &data.scalar ),
      vector_encoder( HLAfloat64LE(), 3 ),
-     encoder()
+     encoder(),
+     use_fast_encoding( false )
 {
    // Build up the encoders.
    // ObjectClass: ReferenceFrame, FOM-Module: SISO_SpaceFOM_environment.xml
@@ -81,6 +90,62 @@ QuaternionEncoder::QuaternionEncoder(
    // We can do this here because the record is a fixed size all the time.
    set_byte_alignment( 1 );
    ensure_buffer_capacity( encoder.getEncodedLength() );
+
+   // The attitude quaternion is a fixed record of four packed little-endian
+   // doubles, so the data can be copied and byteswapped straight between the
+   // user data and the buffer without going through the encoder objects.
+   // Validate the fast path against the encoder objects once here and fall
+   // back to them if the RTI implementation encodes the record differently.
+   this->use_fast_encoding = verify_fast_encoding();
+}
+
+/**
+ * @job_class{initialization}
+ */
+bool QuaternionEncoder::verify_fast_encoding()
+{
+   if ( encoder.getEncodedLength() != QUATERNION_ENCODED_SIZE ) {
+      return false;
+   }
+
+   // Encode the current data values through the encoder objects and compare
+   // against what the fast path produces for the same values.
+   VariableLengthData encoded_data = encoder.encode();
+   if ( ( encoded_data.size() != QUATERNION_ENCODED_SIZE )
+        || ( get_capacity() < QUATERNION_ENCODED_SIZE ) ) {
+      return false;
+   }
+   encode_fast();
+
+   return ( memcmp( buffer, encoded_data.data(), QUATERNION_ENCODED_SIZE ) == 0 );
+}
+
+/**
+ * @job_class{scheduled}
+ */
+void QuaternionEncoder::encode_fast()
+{
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      memcpy( buffer, &data.scalar, sizeof( double ) );
+      memcpy( buffer + sizeof( double ), data.vector, 3 * sizeof( double ) );
+   } else {
+      Utilities::byteswap_8_byte_array( buffer, &data.scalar, 1 );
+      Utilities::byteswap_8_byte_array( buffer + sizeof( double ), data.vector, 3 );
+   }
+}
+
+/**
+ * @job_class{scheduled}
+ */
+void QuaternionEncoder::decode_fast()
+{
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      memcpy( &data.scalar, buffer, sizeof( double ) );
+      memcpy( data.vector, buffer + sizeof( double ), 3 * sizeof( double ) );
+   } else {
+      Utilities::byteswap_8_byte_array( &data.scalar, buffer, 1 );
+      Utilities::byteswap_8_byte_array( data.vector, buffer + sizeof( double ), 3 );
+   }
 }
 
 /**
@@ -88,6 +153,13 @@ QuaternionEncoder::QuaternionEncoder(
  */
 void QuaternionEncoder::encode() // Return: -- Nothing.
 {
+   // Use the precomputed fixed-layout fast path when it was validated
+   // against the encoder objects at construction time.
+   if ( this->use_fast_encoding ) {
+      encode_fast();
+      return;
+   }
+
    // Encode the data into the reference frame buffer.
    VariableLengthData encoded_data = encoder.encode();
 
@@ -112,6 +184,13 @@ void QuaternionEncoder::encode() // Return: -- Nothing.
  */
 void QuaternionEncoder::decode() // Return: -- Nothing.
 {
+   // Use the precomputed fixed-layout fast path when it was validated
+   // against the encoder objects at construction time.
+   if ( this->use_fast_encoding && ( capacity >= QUATERNION_ENCODED_SIZE ) ) {
+      decode_fast();
+      return;
+   }
+
    // The Encoder helps operate on VariableLengthData so create one using the
    // buffered HLA data we received through the TrickHLA callback.
    VariableLengthData encoded_data = VariableLengthData( buffer, capacity );
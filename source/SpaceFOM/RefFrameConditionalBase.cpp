@@ -30,6 +30,8 @@ NASA, Johnson Space Center\n
 
 // System include files.
 #include <iostream>
+#include <limits>
+#include <math.h>
 #include <string>
 
 // Trick include files.
@@ -56,8 +58,12 @@ RefFrameConditionalBase::RefFrameConditionalBase(
    RefFrameBase &frame_ref )
    : TrickHLA::Conditional(),
      debug( false ),
+     pos_epsilon( 0.0 ),
+     att_epsilon( 0.0 ),
+     resend_interval( 0.0 ),
      frame( frame_ref ),
      prev_data(),
+     last_state_send_time( -std::numeric_limits< double >::max() ),
      name_attr( NULL ),
      parent_name_attr( NULL ),
      state_attr( NULL )
@@ -114,6 +120,49 @@ void RefFrameConditionalBase::initialize_callback(
    return;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+bool RefFrameConditionalBase::is_state_delta_significant() const
+{
+   // Any change in the velocity or angular velocity invalidates a
+   // subscriber's local propagation of the frame, so it is always
+   // significant. Note that an analytically evolving frame, like a
+   // planet-fixed frame with a fixed rotation rate, has constant rates
+   // so these comparisons do not force an update every cycle.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      if ( frame.packing_data.state.vel[iinc] != prev_data.state.vel[iinc] ) {
+         return true;
+      }
+      if ( frame.packing_data.state.ang_vel[iinc] != prev_data.state.ang_vel[iinc] ) {
+         return true;
+      }
+   }
+
+   // Compare the position delta magnitude to the position epsilon.
+   double dx = frame.packing_data.state.pos[0] - prev_data.state.pos[0];
+   double dy = frame.packing_data.state.pos[1] - prev_data.state.pos[1];
+   double dz = frame.packing_data.state.pos[2] - prev_data.state.pos[2];
+   if ( ( ( dx * dx ) + ( dy * dy ) + ( dz * dz ) ) > ( pos_epsilon * pos_epsilon ) ) {
+      return true;
+   }
+
+   // Compare the rotation angle between the previous and current attitude
+   // quaternions to the attitude epsilon.
+   double dot = ( frame.packing_data.state.att.scalar * prev_data.state.att.scalar )
+                + ( frame.packing_data.state.att.vector[0] * prev_data.state.att.vector[0] )
+                + ( frame.packing_data.state.att.vector[1] * prev_data.state.att.vector[1] )
+                + ( frame.packing_data.state.att.vector[2] * prev_data.state.att.vector[2] );
+   if ( fabs( dot ) > 1.0 ) {
+      dot = 1.0;
+   }
+   if ( ( 2.0 * acos( fabs( dot ) ) ) > att_epsilon ) {
+      return true;
+   }
+
+   return false;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -191,13 +240,31 @@ bool RefFrameConditionalBase::should_send(
 
       if ( frame.packing_data.state != prev_data.state ) {
 
-         // Update the previous value.
-         prev_data.state = frame.packing_data.state;
+         // Quasi-static frames can suppress updates until the state moves
+         // by more than the configured epsilons from the last sent state.
+         // With the default zero epsilons any change is sent, which
+         // preserves the original send-on-change behavior.
+         if ( ( pos_epsilon > 0.0 ) || ( att_epsilon > 0.0 ) ) {
+            send_attr = is_state_delta_significant();
+         } else {
+            send_attr = true;
+         }
+      }
 
-         // Mark to send.
+      // Periodically resend an otherwise suppressed state so that late
+      // joining subscribers and lag compensation get fresh truth data.
+      if ( !send_attr
+           && ( resend_interval > 0.0 )
+           && ( ( frame.packing_data.state.time - last_state_send_time ) >= resend_interval ) ) {
          send_attr = true;
       }
 
+      if ( send_attr ) {
+         // Update the previous value and the time of the last sent state.
+         prev_data.state      = frame.packing_data.state;
+         last_state_send_time = frame.packing_data.state.time;
+      }
+
    } else {
 
       ostringstream errmsg;
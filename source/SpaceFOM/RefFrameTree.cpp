@@ -16,6 +16,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{GpuBatchCompute.cpp}
 @trick_link_dependency{RefFrameBase.cpp}
 @trick_link_dependency{RefFrameTree.cpp}
 
@@ -27,22 +28,41 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
+#include <sstream>
 
 // Trick include files.
+#include "trick/message_proto.h"
+#include "trick/vector_macros.h"
 
 // TrickHLA model include files.
 
 // SpaceFOM include files.
+#include "SpaceFOM/GpuBatchCompute.hh"
 #include "SpaceFOM/RefFrameTree.hh"
 
 using namespace std;
 using namespace TrickHLA;
 using namespace SpaceFOM;
 
+namespace
+{
+
+/*! @brief Depth ordering comparison for the flattened frame array. */
+bool compare_frame_depth(
+   pair< int, SpaceFOM::RefFrameBase * > const &lhs,
+   pair< int, SpaceFOM::RefFrameBase * > const &rhs )
+{
+   return ( lhs.first < rhs.first );
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 RefFrameTree::RefFrameTree()
+   : depth_order_stale( true )
 {
    return;
 }
@@ -64,6 +84,11 @@ bool RefFrameTree::add_frame( RefFrameBase *frame_ptr )
 {
    if ( frame_ptr != NULL ) {
       ref_frame_map.insert( pair< string, RefFrameBase * >( frame_ptr->packing_data.name, frame_ptr ) );
+
+      // The tree mutated so the cached transform paths and the flattened
+      // depth ordered frame array are now stale.
+      invalidate_transform_paths();
+      this->depth_order_stale = true;
       return ( true );
    }
    return ( true );
@@ -71,6 +96,10 @@ bool RefFrameTree::add_frame( RefFrameBase *frame_ptr )
 
 bool RefFrameTree::build_tree()
 {
+   // The tree mutated so the cached transform paths and the flattened
+   // depth ordered frame array are now stale.
+   invalidate_transform_paths();
+   this->depth_order_stale = true;
    return ( true );
 }
 
@@ -81,7 +110,7 @@ bool RefFrameTree::check_tree()
 
 bool RefFrameTree::has_frame( char const *name )
 {
-   map< string, RefFrameBase * >::iterator map_iter;
+   unordered_map< string, RefFrameBase * >::iterator map_iter;
 
    // Find the frame in the map.
    map_iter = ref_frame_map.find( string( name ) );
@@ -93,7 +122,7 @@ bool RefFrameTree::has_frame( char const *name )
 
 bool RefFrameTree::has_frame( string const &name )
 {
-   map< string, RefFrameBase * >::iterator map_iter;
+   unordered_map< string, RefFrameBase * >::iterator map_iter;
 
    // Find the frame in the map.
    map_iter = ref_frame_map.find( name );
@@ -110,24 +139,24 @@ bool RefFrameTree::has_frame( RefFrameBase const *frame )
 
 RefFrameBase *RefFrameTree::find_frame( char const *name )
 {
-   map< string, RefFrameBase * >::iterator map_iter;
+   unordered_map< string, RefFrameBase * >::iterator map_iter;
 
    // Find the frame in the map.
    map_iter = ref_frame_map.find( string( name ) );
    if ( map_iter != ref_frame_map.end() ) {
-      return ( ref_frame_map[string( name )] );
+      return ( map_iter->second );
    }
    return ( NULL );
 }
 
 RefFrameBase *RefFrameTree::find_frame( string const &name )
 {
-   map< string, RefFrameBase * >::iterator map_iter;
+   unordered_map< string, RefFrameBase * >::iterator map_iter;
 
    // Find the frame in the map.
    map_iter = ref_frame_map.find( name );
    if ( map_iter != ref_frame_map.end() ) {
-      return ( ref_frame_map[name] );
+      return ( map_iter->second );
    }
    return ( NULL );
 }
@@ -136,19 +165,336 @@ RefFrameBase *RefFrameTree::find_common_base(
    char const *child_1,
    char const *child_2 )
 {
-   return ( NULL );
+   return ( find_common_base( find_frame( child_1 ), find_frame( child_2 ) ) );
 }
 
 RefFrameBase *RefFrameTree::find_common_base(
    string const &child_1,
    string const &child_2 )
 {
-   return ( NULL );
+   return ( find_common_base( find_frame( child_1 ), find_frame( child_2 ) ) );
 }
 
 RefFrameBase *RefFrameTree::find_common_base(
    RefFrameBase *child_1,
    RefFrameBase *child_2 )
 {
-   return ( NULL );
+   if ( ( child_1 == NULL ) || ( child_2 == NULL ) ) {
+      return ( NULL );
+   }
+
+   // Measure the depth of each frame from its root frame.
+   int           depth_1 = 0;
+   RefFrameBase *frame_1 = child_1;
+   while ( frame_1->get_parent_frame() != NULL ) {
+      frame_1 = frame_1->get_parent_frame();
+      ++depth_1;
+   }
+   int           depth_2 = 0;
+   RefFrameBase *frame_2 = child_2;
+   while ( frame_2->get_parent_frame() != NULL ) {
+      frame_2 = frame_2->get_parent_frame();
+      ++depth_2;
+   }
+
+   // Frames in disjoint trees have no common base frame.
+   if ( frame_1 != frame_2 ) {
+      return ( NULL );
+   }
+
+   // Walk the deeper frame up until both frames are at the same depth.
+   frame_1 = child_1;
+   frame_2 = child_2;
+   while ( depth_1 > depth_2 ) {
+      frame_1 = frame_1->get_parent_frame();
+      --depth_1;
+   }
+   while ( depth_2 > depth_1 ) {
+      frame_2 = frame_2->get_parent_frame();
+      --depth_2;
+   }
+
+   // Walk both frames up in lockstep until they meet at the lowest
+   // common base frame.
+   while ( frame_1 != frame_2 ) {
+      frame_1 = frame_1->get_parent_frame();
+      frame_2 = frame_2->get_parent_frame();
+   }
+   return ( frame_1 );
+}
+
+void RefFrameTree::invalidate_transform_paths()
+{
+   transform_path_map.clear();
+}
+
+void RefFrameTree::rebuild_depth_order()
+{
+   // Measure the depth of each frame from its root frame.
+   vector< pair< int, RefFrameBase * > > depth_frames;
+   depth_frames.reserve( ref_frame_map.size() );
+
+   unordered_map< string, RefFrameBase * >::iterator map_iter;
+   for ( map_iter = ref_frame_map.begin(); map_iter != ref_frame_map.end(); ++map_iter ) {
+      int           depth = 0;
+      RefFrameBase *frame = map_iter->second;
+      while ( frame->get_parent_frame() != NULL ) {
+         frame = frame->get_parent_frame();
+         ++depth;
+      }
+      depth_frames.push_back( pair< int, RefFrameBase * >( depth, map_iter->second ) );
+   }
+
+   // Order the frames by depth so that every frame appears after its
+   // parent frame and a single linear sweep visits parents first.
+   stable_sort( depth_frames.begin(), depth_frames.end(), compare_frame_depth );
+
+   depth_ordered_frames.clear();
+   depth_ordered_frames.reserve( depth_frames.size() );
+   for ( unsigned int i = 0; i < depth_frames.size(); ++i ) {
+      depth_ordered_frames.push_back( depth_frames[i].second );
+   }
+
+   this->depth_order_stale = false;
+}
+
+vector< RefFrameBase * > const &RefFrameTree::get_frames_in_depth_order()
+{
+   // Rebuild the flattened frame array after a tree mutation.
+   if ( depth_order_stale ) {
+      rebuild_depth_order();
+   }
+   return ( depth_ordered_frames );
+}
+
+RefFrameTree::TransformPath const *RefFrameTree::get_transform_path(
+   RefFrameBase *from_frame,
+   RefFrameBase *to_frame )
+{
+   pair< RefFrameBase *, RefFrameBase * > const key( from_frame, to_frame );
+
+   // Use the cached path for this frame pair when we have one.
+   map< pair< RefFrameBase *, RefFrameBase * >, TransformPath >::iterator path_iter;
+   path_iter = transform_path_map.find( key );
+   if ( path_iter != transform_path_map.end() ) {
+      return ( &( path_iter->second ) );
+   }
+
+   RefFrameBase *common_base = find_common_base( from_frame, to_frame );
+   if ( common_base == NULL ) {
+      return ( NULL );
+   }
+
+   // Build the path up from the 'from' frame to the common base frame and
+   // down from the common base frame to the 'to' frame.
+   TransformPath path;
+   for ( RefFrameBase *frame = from_frame; frame != common_base; frame = frame->get_parent_frame() ) {
+      path.up_chain.push_back( frame );
+   }
+   for ( RefFrameBase *frame = to_frame; frame != common_base; frame = frame->get_parent_frame() ) {
+      path.down_chain.push_back( frame );
+   }
+   // The down chain was collected leaf first but is applied from just below
+   // the common base frame down to the 'to' frame.
+   reverse( path.down_chain.begin(), path.down_chain.end() );
+
+   return ( &( transform_path_map.insert( make_pair( key, path ) ).first->second ) );
+}
+
+/*!
+ * @details The frame state expresses the frame with respect to its parent
+ * frame: position, velocity and attitude of the frame in the parent frame
+ * with the angular velocity expressed in the frame itself.
+ */
+void RefFrameTree::transform_to_parent(
+   SpaceTimeCoordinateData const &frame_state,
+   SpaceTimeCoordinateData const &state_in,
+   SpaceTimeCoordinateData       &state_out )
+{
+   double wxr[3];
+   double rel_vel[3];
+   double pos_in_parent[3];
+   double vel_in_parent[3];
+   double frame_rate_in_body[3];
+
+   // Position: rotate into the parent frame and add the frame origin offset.
+   frame_state.att.conjugate_transform_vector( state_in.pos, pos_in_parent );
+
+   // Velocity: include the frame rotation rate contribution.
+   V_CROSS( wxr, frame_state.ang_vel, state_in.pos );
+   rel_vel[0] = state_in.vel[0] + wxr[0];
+   rel_vel[1] = state_in.vel[1] + wxr[1];
+   rel_vel[2] = state_in.vel[2] + wxr[2];
+   frame_state.att.conjugate_transform_vector( rel_vel, vel_in_parent );
+
+   // Angular velocity: add the frame rotation rate expressed in the body frame.
+   state_in.att.transform_vector( frame_state.ang_vel, frame_rate_in_body );
+
+   // Compose the results using temporaries above so the input and output
+   // states may alias.
+   state_out.pos[0] = frame_state.pos[0] + pos_in_parent[0];
+   state_out.pos[1] = frame_state.pos[1] + pos_in_parent[1];
+   state_out.pos[2] = frame_state.pos[2] + pos_in_parent[2];
+
+   state_out.vel[0] = frame_state.vel[0] + vel_in_parent[0];
+   state_out.vel[1] = frame_state.vel[1] + vel_in_parent[1];
+   state_out.vel[2] = frame_state.vel[2] + vel_in_parent[2];
+
+   state_out.ang_vel[0] = state_in.ang_vel[0] + frame_rate_in_body[0];
+   state_out.ang_vel[1] = state_in.ang_vel[1] + frame_rate_in_body[1];
+   state_out.ang_vel[2] = state_in.ang_vel[2] + frame_rate_in_body[2];
+
+   // Attitude: body = (frame to body) * (parent to frame).
+   QuaternionData::multiply_sv( state_in.att.scalar, state_in.att.vector,
+                                frame_state.att.scalar, frame_state.att.vector,
+                                &( state_out.att.scalar ), state_out.att.vector );
+
+   state_out.time = state_in.time;
+}
+
+/*!
+ * @details The inverse of transform_to_parent(): takes a state expressed in
+ * the frame's parent frame and expresses it in the frame.
+ */
+void RefFrameTree::transform_to_child(
+   SpaceTimeCoordinateData const &frame_state,
+   SpaceTimeCoordinateData const &state_in,
+   SpaceTimeCoordinateData       &state_out )
+{
+   double rel_pos[3];
+   double rel_vel[3];
+   double wxr[3];
+   double pos_in_frame[3];
+   double vel_in_frame[3];
+   double ang_vel_out[3];
+   double frame_rate_in_body[3];
+   double att_out_scalar;
+   double att_out_vector[3];
+
+   // Position: remove the frame origin offset and rotate into the frame.
+   rel_pos[0] = state_in.pos[0] - frame_state.pos[0];
+   rel_pos[1] = state_in.pos[1] - frame_state.pos[1];
+   rel_pos[2] = state_in.pos[2] - frame_state.pos[2];
+   frame_state.att.transform_vector( rel_pos, pos_in_frame );
+
+   // Velocity: remove the frame rotation rate contribution.
+   rel_vel[0] = state_in.vel[0] - frame_state.vel[0];
+   rel_vel[1] = state_in.vel[1] - frame_state.vel[1];
+   rel_vel[2] = state_in.vel[2] - frame_state.vel[2];
+   frame_state.att.transform_vector( rel_vel, vel_in_frame );
+   V_CROSS( wxr, frame_state.ang_vel, pos_in_frame );
+
+   // Attitude: body = (parent to body) * conj(parent to frame).
+   QuaternionData::multiply_conjugate( state_in.att.scalar, state_in.att.vector,
+                                       frame_state.att.scalar, frame_state.att.vector,
+                                       &att_out_scalar, att_out_vector );
+
+   // Angular velocity: remove the frame rotation rate expressed in the
+   // body frame.
+   QuaternionData att_out;
+   att_out.scalar    = att_out_scalar;
+   att_out.vector[0] = att_out_vector[0];
+   att_out.vector[1] = att_out_vector[1];
+   att_out.vector[2] = att_out_vector[2];
+   att_out.transform_vector( frame_state.ang_vel, frame_rate_in_body );
+   ang_vel_out[0] = state_in.ang_vel[0] - frame_rate_in_body[0];
+   ang_vel_out[1] = state_in.ang_vel[1] - frame_rate_in_body[1];
+   ang_vel_out[2] = state_in.ang_vel[2] - frame_rate_in_body[2];
+
+   // Compose the results using temporaries above so the input and output
+   // states may alias.
+   state_out.pos[0] = pos_in_frame[0];
+   state_out.pos[1] = pos_in_frame[1];
+   state_out.pos[2] = pos_in_frame[2];
+
+   state_out.vel[0] = vel_in_frame[0] - wxr[0];
+   state_out.vel[1] = vel_in_frame[1] - wxr[1];
+   state_out.vel[2] = vel_in_frame[2] - wxr[2];
+
+   state_out.ang_vel[0] = ang_vel_out[0];
+   state_out.ang_vel[1] = ang_vel_out[1];
+   state_out.ang_vel[2] = ang_vel_out[2];
+
+   state_out.att = att_out;
+
+   state_out.time = state_in.time;
+}
+
+/*!
+ * @details The composed transform is itself a frame state: the 'from'
+ * frame expressed in the 'to' frame.
+ */
+void RefFrameTree::compute_path_transform(
+   TransformPath const     &path,
+   SpaceTimeCoordinateData &combined )
+{
+   // Start with the identity transform: the 'from' frame expressed in itself.
+   combined.initialize();
+   combined.att.scalar = 1.0;
+
+   // Compose the frame states up from the 'from' frame to the common base
+   // frame, then down from the common base frame to the 'to' frame.
+   for ( unsigned int i = 0; i < path.up_chain.size(); ++i ) {
+      transform_to_parent( path.up_chain[i]->packing_data.state, combined, combined );
+   }
+   for ( unsigned int i = 0; i < path.down_chain.size(); ++i ) {
+      transform_to_child( path.down_chain[i]->packing_data.state, combined, combined );
+   }
+}
+
+bool RefFrameTree::transform_state(
+   SpaceTimeCoordinateData const &state_in,
+   SpaceTimeCoordinateData       &state_out,
+   char const                    *from_frame_name,
+   char const                    *to_frame_name )
+{
+   return ( transform_states( &state_in, &state_out, 1, from_frame_name, to_frame_name ) );
+}
+
+bool RefFrameTree::transform_states(
+   SpaceTimeCoordinateData const *states_in,
+   SpaceTimeCoordinateData       *states_out,
+   unsigned int const             count,
+   char const                    *from_frame_name,
+   char const                    *to_frame_name )
+{
+   RefFrameBase *from_frame = find_frame( from_frame_name );
+   RefFrameBase *to_frame   = find_frame( to_frame_name );
+   if ( ( from_frame == NULL ) || ( to_frame == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::RefFrameTree::transform_states():" << __LINE__
+             << " ERROR: Unknown reference frame '"
+             << ( ( from_frame == NULL ) ? from_frame_name : to_frame_name )
+             << "'!";
+      send_hs( stderr, errmsg.str().c_str() );
+      return ( false );
+   }
+
+   TransformPath const *path = get_transform_path( from_frame, to_frame );
+   if ( path == NULL ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::RefFrameTree::transform_states():" << __LINE__
+             << " ERROR: Reference frames '" << from_frame_name << "' and '"
+             << to_frame_name << "' do not have a common base frame!";
+      send_hs( stderr, errmsg.str().c_str() );
+      return ( false );
+   }
+
+   // Compose the cached path into the single equivalent transform once and
+   // apply it to all the states in one loop.
+   SpaceTimeCoordinateData combined;
+   compute_path_transform( *path, combined );
+
+   // Offload the flat transform loop to the GPU when the batch is large
+   // enough to amortize the transfers, otherwise fall through to the
+   // vectorized CPU loop.
+   if ( GpuBatchCompute::should_offload( (int)count )
+        && GpuBatchCompute::transform_states( combined, states_in, states_out, count ) ) {
+      return ( true );
+   }
+
+   for ( unsigned int i = 0; i < count; ++i ) {
+      transform_to_parent( combined, states_in[i], states_out[i] );
+   }
+   return ( true );
 }
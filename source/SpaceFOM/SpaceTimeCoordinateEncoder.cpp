@@ -32,6 +32,9 @@ NASA, Johnson Space Center\n
 // Trick include files.
 #include "trick/message_proto.h"
 
+// TrickHLA include files.
+#include "TrickHLA/Utilities.hh"
+
 // Model include files.
 #include "SpaceFOM/SpaceTimeCoordinateEncoder.hh"
 
@@ -46,8 +49,14 @@ NASA, Johnson Space Center\n
 
 using namespace RTI1516_NAMESPACE;
 using namespace std;
+using namespace TrickHLA;
 using namespace SpaceFOM;
 
+/*! @brief Encoded size of the SpaceTimeCoordinateState fixed record: the
+ *  position, velocity, attitude quaternion, angular velocity and time fields
+ *  are thirteen packed little-endian doubles. */
+static size_t const STC_ENCODED_SIZE = 13 * sizeof( double );
+
 /**
  * @job_class{initialization}
  */
@@ -63,7 +72,8 @@ SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
      ang_vel_encoder( HLAfloat64LE(), 3 ),
      rot_state_encoder(),
      time_encoder( &data.time ),
-     encoder()
+     encoder(),
+     use_fast_encoding( false )
 {
 
    // Build up the encoders.
@@ -129,6 +139,103 @@ SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
    // We can do this here because the record is a fixed size all the time.
    set_byte_alignment( 1 );
    ensure_buffer_capacity( encoder.getEncodedLength() );
+
+   // The space/time coordinate state is a fixed record of thirteen packed
+   // little-endian doubles, so the data can be copied and byteswapped
+   // straight between the user data and the buffer without going through
+   // the encoder objects. Validate the fast path against the encoder
+   // objects once here and fall back to them if the RTI implementation
+   // encodes the record differently.
+   this->use_fast_encoding = verify_fast_encoding();
+}
+
+/**
+ * @job_class{initialization}
+ */
+bool SpaceTimeCoordinateEncoder::verify_fast_encoding()
+{
+   if ( encoder.getEncodedLength() != STC_ENCODED_SIZE ) {
+      return false;
+   }
+
+   // Encode the current data values through the encoder objects and compare
+   // against what the fast path produces for the same values.
+   VariableLengthData encoded_data = encoder.encode();
+   if ( ( encoded_data.size() != STC_ENCODED_SIZE )
+        || ( get_capacity() < STC_ENCODED_SIZE ) ) {
+      return false;
+   }
+   encode_fast();
+
+   return ( memcmp( buffer, encoded_data.data(), STC_ENCODED_SIZE ) == 0 );
+}
+
+/**
+ * @job_class{scheduled}
+ */
+void SpaceTimeCoordinateEncoder::encode_fast()
+{
+   unsigned char *output = buffer;
+
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      memcpy( output, data.pos, 3 * sizeof( double ) );
+      output += 3 * sizeof( double );
+      memcpy( output, data.vel, 3 * sizeof( double ) );
+      output += 3 * sizeof( double );
+      memcpy( output, &data.att.scalar, sizeof( double ) );
+      output += sizeof( double );
+      memcpy( output, data.att.vector, 3 * sizeof( double ) );
+      output += 3 * sizeof( double );
+      memcpy( output, data.ang_vel, 3 * sizeof( double ) );
+      output += 3 * sizeof( double );
+      memcpy( output, &data.time, sizeof( double ) );
+   } else {
+      Utilities::byteswap_8_byte_array( output, data.pos, 3 );
+      output += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( output, data.vel, 3 );
+      output += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( output, &data.att.scalar, 1 );
+      output += sizeof( double );
+      Utilities::byteswap_8_byte_array( output, data.att.vector, 3 );
+      output += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( output, data.ang_vel, 3 );
+      output += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( output, &data.time, 1 );
+   }
+}
+
+/**
+ * @job_class{scheduled}
+ */
+void SpaceTimeCoordinateEncoder::decode_fast()
+{
+   unsigned char const *input = buffer;
+
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      memcpy( data.pos, input, 3 * sizeof( double ) );
+      input += 3 * sizeof( double );
+      memcpy( data.vel, input, 3 * sizeof( double ) );
+      input += 3 * sizeof( double );
+      memcpy( &data.att.scalar, input, sizeof( double ) );
+      input += sizeof( double );
+      memcpy( data.att.vector, input, 3 * sizeof( double ) );
+      input += 3 * sizeof( double );
+      memcpy( data.ang_vel, input, 3 * sizeof( double ) );
+      input += 3 * sizeof( double );
+      memcpy( &data.time, input, sizeof( double ) );
+   } else {
+      Utilities::byteswap_8_byte_array( data.pos, input, 3 );
+      input += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( data.vel, input, 3 );
+      input += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( &data.att.scalar, input, 1 );
+      input += sizeof( double );
+      Utilities::byteswap_8_byte_array( data.att.vector, input, 3 );
+      input += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( data.ang_vel, input, 3 );
+      input += 3 * sizeof( double );
+      Utilities::byteswap_8_byte_array( &data.time, input, 1 );
+   }
 }
 
 /**
@@ -136,6 +243,13 @@ SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
  */
 void SpaceTimeCoordinateEncoder::encode()
 {
+   // Use the precomputed fixed-layout fast path when it was validated
+   // against the encoder objects at construction time.
+   if ( this->use_fast_encoding ) {
+      encode_fast();
+      return;
+   }
+
    // Encode the data into the reference frame buffer.
    VariableLengthData encoded_data = encoder.encode();
 
@@ -160,6 +274,13 @@ void SpaceTimeCoordinateEncoder::encode()
  */
 void SpaceTimeCoordinateEncoder::decode()
 {
+   // Use the precomputed fixed-layout fast path when it was validated
+   // against the encoder objects at construction time.
+   if ( this->use_fast_encoding && ( capacity >= STC_ENCODED_SIZE ) ) {
+      decode_fast();
+      return;
+   }
+
    // The Encoder helps operate on VariableLengthData so create one using the
    // buffered HLA data we received through the TrickHLA callback.
    VariableLengthData encoded_data = VariableLengthData( buffer, capacity );
@@ -0,0 +1,238 @@
+/*!
+@file TrickHLA/AdaptiveSleepTimeout.cpp
+@ingroup TrickHLA
+@brief TrickHLA adaptive spin-then-sleep timer for use in wait loops.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AdaptiveSleepTimeout.cpp}
+@trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cerrno>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/AdaptiveSleepTimeout.hh"
+#include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+AdaptiveSleepTimeout::AdaptiveSleepTimeout()
+   : SleepTimeout( THLA_DEFAULT_SLEEP_TIMEOUT_IN_SEC, THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ),
+     spin_budget_micros( THLA_DEFAULT_SPIN_BUDGET_IN_MICROS ),
+     max_sleep_micros( THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ),
+     wait_start_time( -1 ),
+     backoff_micros( THLA_MIN_BACKOFF_SLEEP_IN_MICROS ),
+     slept_this_wait( false ),
+     wait_cnt( 0 ),
+     spin_only_wait_cnt( 0 ),
+     spin_cnt( 0 ),
+     sleep_cnt( 0 ),
+     total_wait_micros( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+AdaptiveSleepTimeout::AdaptiveSleepTimeout(
+   double const timeout_seconds )
+   : SleepTimeout( timeout_seconds, THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ),
+     spin_budget_micros( THLA_DEFAULT_SPIN_BUDGET_IN_MICROS ),
+     max_sleep_micros( THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ),
+     wait_start_time( -1 ),
+     backoff_micros( THLA_MIN_BACKOFF_SLEEP_IN_MICROS ),
+     slept_this_wait( false ),
+     wait_cnt( 0 ),
+     spin_only_wait_cnt( 0 ),
+     spin_cnt( 0 ),
+     sleep_cnt( 0 ),
+     total_wait_micros( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+AdaptiveSleepTimeout::AdaptiveSleepTimeout(
+   double const timeout_seconds,
+   long const   sleep_micros,
+   long const   spin_budget )
+   : SleepTimeout( timeout_seconds, sleep_micros ),
+     spin_budget_micros( ( spin_budget > 0 ) ? spin_budget : 0 ),
+     max_sleep_micros( ( sleep_micros > THLA_MIN_BACKOFF_SLEEP_IN_MICROS )
+                          ? sleep_micros
+                          : THLA_MIN_BACKOFF_SLEEP_IN_MICROS ),
+     wait_start_time( -1 ),
+     backoff_micros( THLA_MIN_BACKOFF_SLEEP_IN_MICROS ),
+     slept_this_wait( false ),
+     wait_cnt( 0 ),
+     spin_only_wait_cnt( 0 ),
+     spin_cnt( 0 ),
+     sleep_cnt( 0 ),
+     total_wait_micros( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+AdaptiveSleepTimeout::~AdaptiveSleepTimeout()
+{
+   return;
+}
+
+/*!
+ * @details Spin with processor pause hints while within the configured spin
+ * budget for this wait episode. Once the budget is spent, sleep with an
+ * exponentially increasing backoff time that starts small and doubles up to
+ * the configured maximum sleep time. The backoff sleeps use an absolute
+ * deadline on the monotonic clock so interrupted sleeps do not extend the
+ * overall wait.
+ */
+int const AdaptiveSleepTimeout::sleep() const
+{
+   int64_t const now = time();
+
+   // A new wait episode starts with the first sleep call after a reset.
+   if ( this->wait_start_time < 0 ) {
+      this->wait_start_time = now;
+   }
+
+   // Busy-spin with pause hints while within the spin budget.
+   if ( ( now - this->wait_start_time ) < this->spin_budget_micros ) {
+      ++this->spin_cnt;
+      for ( int i = 0; i < 16; ++i ) {
+         Utilities::processor_pause();
+      }
+      return 0;
+   }
+
+   // The spin budget is spent, back off to a bounded sleep with an
+   // absolute deadline on the monotonic clock.
+   struct timespec deadline;
+   clock_gettime( CLOCK_MONOTONIC, &deadline );
+   deadline.tv_sec += ( this->backoff_micros / 1000000 );
+   deadline.tv_nsec += ( this->backoff_micros % 1000000 ) * 1000;
+   if ( deadline.tv_nsec >= 1000000000 ) {
+      deadline.tv_nsec -= 1000000000;
+      ++deadline.tv_sec;
+   }
+
+   int ret;
+   do {
+      ret = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL );
+   } while ( ret == EINTR );
+
+   ++this->sleep_cnt;
+   this->slept_this_wait = true;
+
+   // Exponentially increase the backoff up to the maximum sleep time.
+   if ( this->backoff_micros < this->max_sleep_micros ) {
+      this->backoff_micros *= 2;
+      if ( this->backoff_micros > this->max_sleep_micros ) {
+         this->backoff_micros = this->max_sleep_micros;
+      }
+   }
+   return ret;
+}
+
+/*!
+ * @details Record the statistics for the wait episode that just ended and
+ * reset the spin budget and backoff for the next wait episode, in addition
+ * to resetting the base class timeout time.
+ */
+void AdaptiveSleepTimeout::reset()
+{
+   finish_wait_episode();
+   SleepTimeout::reset();
+}
+
+void AdaptiveSleepTimeout::finish_wait_episode() const
+{
+   if ( this->wait_start_time >= 0 ) {
+      ++this->wait_cnt;
+      if ( !this->slept_this_wait ) {
+         ++this->spin_only_wait_cnt;
+      }
+      int64_t const waited = time() - this->wait_start_time;
+      if ( waited > 0 ) {
+         this->total_wait_micros += waited;
+      }
+      this->wait_start_time = -1;
+      this->backoff_micros  = THLA_MIN_BACKOFF_SLEEP_IN_MICROS;
+      this->slept_this_wait = false;
+   }
+}
+
+uint64_t const AdaptiveSleepTimeout::get_spin_only_wait_count() const
+{
+   return this->spin_only_wait_cnt;
+}
+
+uint64_t const AdaptiveSleepTimeout::get_wait_count() const
+{
+   return this->wait_cnt;
+}
+
+/*!
+ * @details A wait site where most episodes are spin-only has a well tuned
+ * spin budget; a site with mostly slept episodes should either grow the
+ * budget or give up on spinning entirely.
+ */
+string const AdaptiveSleepTimeout::get_statistics() const
+{
+   // Account for an episode still in progress so the summary is current.
+   finish_wait_episode();
+
+   ostringstream msg;
+   msg << "waits:" << this->wait_cnt
+       << " spin-only-waits:" << this->spin_only_wait_cnt
+       << " spin-passes:" << this->spin_cnt
+       << " backoff-sleeps:" << this->sleep_cnt
+       << " total-wait:" << this->total_wait_micros << " microseconds"
+       << " spin-budget:" << this->spin_budget_micros << " microseconds";
+   return msg.str();
+}
+
+void AdaptiveSleepTimeout::print_statistics(
+   char const *wait_site ) const
+{
+   send_hs( stdout, "AdaptiveSleepTimeout::print_statistics():%d %s %s%c",
+            __LINE__, ( ( wait_site != NULL ) ? wait_site : "wait-site" ),
+            get_statistics().c_str(), THLA_NEWLINE );
+}
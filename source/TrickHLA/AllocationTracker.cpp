@@ -0,0 +1,113 @@
+/*!
+@file TrickHLA/AllocationTracker.cpp
+@ingroup TrickHLA
+@brief Subsystem-tagged allocation accounting for the TrickHLA memory
+consumers.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AllocationTracker.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <sstream>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Define the static class variables.
+char const *const AllocationTracker::subsystem_names[SUBSYS_COUNT] = {
+   "attribute-buffers",
+   "parameter-buffers",
+   "opaque-buffers",
+   "item-queues",
+   "reflected-queues",
+   "checkpoint-data"
+};
+
+long long AllocationTracker::current_bytes[SUBSYS_COUNT]     = { 0 };
+long long AllocationTracker::peak_bytes[SUBSYS_COUNT]        = { 0 };
+long long AllocationTracker::allocation_counts[SUBSYS_COUNT] = { 0 };
+
+/*!
+ * @details The peak is advanced with a compare-and-swap loop, so a
+ * concurrent update can never move the peak backwards.
+ */
+void AllocationTracker::record_resize(
+   Subsystem const subsystem,
+   long long const old_byte_count,
+   long long const new_byte_count )
+{
+   long long const current = __atomic_add_fetch( &current_bytes[subsystem],
+                                                 ( new_byte_count - old_byte_count ),
+                                                 __ATOMIC_RELAXED );
+   if ( old_byte_count == 0 ) {
+      __atomic_fetch_add( &allocation_counts[subsystem], 1LL, __ATOMIC_RELAXED );
+   }
+
+   long long peak = __atomic_load_n( &peak_bytes[subsystem], __ATOMIC_RELAXED );
+   while ( ( current > peak )
+           && !__atomic_compare_exchange_n( &peak_bytes[subsystem], &peak, current,
+                                            true, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+      // Another thread advanced the peak, retry against the value it wrote.
+   }
+}
+
+void AllocationTracker::record_free(
+   Subsystem const subsystem,
+   long long const byte_count )
+{
+   __atomic_fetch_sub( &current_bytes[subsystem], byte_count, __ATOMIC_RELAXED );
+   __atomic_fetch_sub( &allocation_counts[subsystem], 1LL, __ATOMIC_RELAXED );
+}
+
+long long AllocationTracker::get_current_bytes(
+   Subsystem const subsystem )
+{
+   return __atomic_load_n( &current_bytes[subsystem], __ATOMIC_RELAXED );
+}
+
+long long AllocationTracker::get_peak_bytes(
+   Subsystem const subsystem )
+{
+   return __atomic_load_n( &peak_bytes[subsystem], __ATOMIC_RELAXED );
+}
+
+long long AllocationTracker::get_allocation_count(
+   Subsystem const subsystem )
+{
+   return __atomic_load_n( &allocation_counts[subsystem], __ATOMIC_RELAXED );
+}
+
+string AllocationTracker::to_string()
+{
+   ostringstream msg;
+   for ( int s = SUBSYS_FIRST_VALUE; s < SUBSYS_COUNT; ++s ) {
+      Subsystem const subsystem = static_cast< Subsystem >( s );
+      msg << "\n   " << subsystem_names[s]
+          << " current:" << get_current_bytes( subsystem ) << " bytes"
+          << " peak:" << get_peak_bytes( subsystem ) << " bytes"
+          << " allocations:" << get_allocation_count( subsystem );
+   }
+   return msg.str();
+}
@@ -20,9 +20,11 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{AttributeBufferPool.cpp}
 @trick_link_dependency{Conditional.cpp}
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{MetadataStringPool.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -52,10 +54,14 @@ NASA, Johnson Space Center\n
 #include "trick/trick_byteswap.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/Attribute.hh"
+#include "TrickHLA/AttributeBufferPool.hh"
 #include "TrickHLA/Conditional.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Federate.hh"
 #include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/MetadataStringPool.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -79,14 +85,64 @@ Attribute::Attribute()
      locally_owned( false ),
      rti_encoding( ENCODING_UNKNOWN ),
      cycle_time( -std::numeric_limits< double >::max() ),
+     zero_copy_send( false ),
+     skip_unchanged_updates( false ),
+     max_chunk_size( 65536 ),
+     updates_sent_count( 0 ),
+     updates_received_count( 0 ),
+     bytes_sent_count( 0 ),
+     bytes_received_count( 0 ),
+     updates_suppressed_count( 0 ),
      buffer( NULL ),
      buffer_capacity( 0 ),
+     pooled_buffer_requested( false ),
+     buffer_pooled( false ),
+     buffer_checkpoint_required( true ),
+     borrowed_data( NULL ),
      size_is_static( true ),
      size( 0 ),
      num_items( 0 ),
      value_changed( false ),
      update_requested( false ),
+     update_turned_on( true ),
      byteswap( false ),
+     zero_copy_active( false ),
+     buffer_copy_fn( NULL ),
+     resolved_array_address( NULL ),
+     resolved_array_size( 0 ),
+     resolved_array_num_items( 0 ),
+     resolved_array_valid( false ),
+     last_sent_buffer( NULL ),
+     last_sent_capacity( 0 ),
+     last_sent_size( 0 ),
+     last_sent_valid( false ),
+     delta_ref_buffer( NULL ),
+     delta_ref_capacity( 0 ),
+     delta_ref_size( 0 ),
+     delta_ref_valid( false ),
+     delta_frame_buffer( NULL ),
+     delta_frame_capacity( 0 ),
+     delta_frame_size( 0 ),
+     delta_sends_since_full( 0 ),
+     delta_rx_ref_valid( false ),
+     chunk_frame_buffer( NULL ),
+     chunk_frame_capacity( 0 ),
+     chunk_frame_size( 0 ),
+     chunk_send_offset( 0 ),
+     chunk_send_total( 0 ),
+     chunk_send_update_id( 0 ),
+     chunk_send_active( false ),
+     chunk_recv_buffer( NULL ),
+     chunk_recv_capacity( 0 ),
+     chunk_recv_total( 0 ),
+     chunk_recv_offset( 0 ),
+     chunk_recv_update_id( 0 ),
+     chunk_recv_active( false ),
+     chunk_complete_callback( NULL ),
+     chunk_complete_user_arg( NULL ),
+     user_buffer( NULL ),
+     user_buffer_capacity( 0 ),
+     user_buffer_length( NULL ),
      cycle_ratio( 1 ),
      cycle_cnt( 0 ),
      ref2( NULL ),
@@ -106,13 +162,52 @@ Attribute::Attribute()
  */
 Attribute::~Attribute()
 {
+   // Fast teardown: the process is exiting and the operating system
+   // reclaims the memory in bulk, so skip the per-buffer Trick memory
+   // frees.
+   if ( Federate::is_fast_teardown_active() ) {
+      return;
+   }
+
    if ( buffer != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( buffer ) ) ) {
-         send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'buffer'%c",
-                  __LINE__, THLA_NEWLINE );
+      // Pooled buffers belong to the AttributeBufferPool slab and are not
+      // individually freed.
+      if ( !this->buffer_pooled ) {
+         if ( trick_MM->delete_var( static_cast< void * >( buffer ) ) ) {
+            send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'buffer'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
       }
       buffer          = NULL;
       buffer_capacity = 0;
+      buffer_pooled   = false;
+   }
+
+   if ( last_sent_buffer != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( last_sent_buffer ) ) ) {
+         send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'last_sent_buffer'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      last_sent_buffer   = NULL;
+      last_sent_capacity = 0;
+   }
+
+   if ( chunk_frame_buffer != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( chunk_frame_buffer ) ) ) {
+         send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'chunk_frame_buffer'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      chunk_frame_buffer   = NULL;
+      chunk_frame_capacity = 0;
+   }
+
+   if ( chunk_recv_buffer != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( chunk_recv_buffer ) ) ) {
+         send_hs( stderr, "Attribute::~Attribute():%d ERROR deleting Trick Memory for 'chunk_recv_buffer'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      chunk_recv_buffer   = NULL;
+      chunk_recv_capacity = 0;
    }
 
    if ( ref2 != NULL ) {
@@ -166,6 +261,24 @@ void Attribute::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Intern the metadata name strings in the shared deduplicated pool and
+   // release the per-attribute allocations, so the common names across
+   // many object instances are stored exactly once.
+   char *interned_name = MetadataStringPool::intern( FOM_name );
+   if ( ( interned_name != NULL ) && ( interned_name != FOM_name ) ) {
+      if ( trick_MM->get_alloc_info_at( static_cast< void * >( FOM_name ) ) != NULL ) {
+         trick_MM->delete_var( static_cast< void * >( FOM_name ) );
+      }
+      FOM_name = interned_name;
+   }
+   interned_name = MetadataStringPool::intern( trick_name );
+   if ( ( interned_name != NULL ) && ( interned_name != trick_name ) ) {
+      if ( trick_MM->get_alloc_info_at( static_cast< void * >( trick_name ) ) != NULL ) {
+         trick_MM->delete_var( static_cast< void * >( trick_name ) );
+      }
+      trick_name = interned_name;
+   }
+
    // Do a quick bounds check on the 'rti_encoding' value.
    if ( ( rti_encoding < ENCODING_FIRST_VALUE ) || ( rti_encoding > ENCODING_LAST_VALUE ) ) {
       ostringstream errmsg;
@@ -261,6 +374,7 @@ void Attribute::initialize(
          if ( ( rti_encoding != ENCODING_BIG_ENDIAN )
               && ( rti_encoding != ENCODING_LITTLE_ENDIAN )
               && ( rti_encoding != ENCODING_BOOLEAN )
+              && ( rti_encoding != ENCODING_PACKED_BITS )
               && ( rti_encoding != ENCODING_NONE )
               && ( rti_encoding != ENCODING_UNKNOWN ) ) {
             ostringstream errmsg;
@@ -268,7 +382,8 @@ void Attribute::initialize(
                    << " ERROR: FOM Object Attribute '"
                    << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
                    << trick_name << "' must use either the ENCODING_BIG_ENDIAN, "
-                   << "ENCODING_LITTLE_ENDIAN, ENCODING_BOOLEAN, ENCODING_NONE, or "
+                   << "ENCODING_LITTLE_ENDIAN, ENCODING_BOOLEAN, ENCODING_PACKED_BITS, "
+                   << "ENCODING_NONE, or "
                    << "ENCODING_UNKNOWN value for the 'rti_encoding' when the "
                    << "attribute represents a 'bool' type. Please check your input "
                    << "or modified-data files to make sure the value for the 'rti_"
@@ -285,6 +400,7 @@ void Attribute::initialize(
               && ( rti_encoding != ENCODING_NONE )
               && ( rti_encoding != ENCODING_UNICODE_STRING )
               && ( rti_encoding != ENCODING_OPAQUE_DATA )
+              && ( rti_encoding != ENCODING_CHUNKED )
               && ( rti_encoding != ENCODING_UNKNOWN ) ) {
             ostringstream errmsg;
             errmsg << "Attribute::initialize():" << __LINE__
@@ -292,7 +408,7 @@ void Attribute::initialize(
                    << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
                    << trick_name << "' must use either the ENCODING_BIG_ENDIAN,"
                    << " ENCODING_LITTLE_ENDIAN, ENCODING_NONE, ENCODING_UNICODE_STRING,"
-                   << " ENCODING_OPAQUE_DATA, or ENCODING_UNKNOWN value for the"
+                   << " ENCODING_OPAQUE_DATA, ENCODING_CHUNKED, or ENCODING_UNKNOWN value for the"
                    << " 'rti_encoding' when the attribute represents a 'char' or"
                    << " 'unsigned char' type. Please check  your input or"
                    << " modified-data files to make sure the value for the"
@@ -348,13 +464,16 @@ void Attribute::initialize(
               && ( rti_encoding != ENCODING_LITTLE_ENDIAN )
               && ( rti_encoding != ENCODING_LOGICAL_TIME )
               && ( rti_encoding != ENCODING_NONE )
+              && ( rti_encoding != ENCODING_DELTA )
+              && ( rti_encoding != ENCODING_CHUNKED )
               && ( rti_encoding != ENCODING_UNKNOWN ) ) {
             ostringstream errmsg;
             errmsg << "Attribute::initialize():" << __LINE__
                    << " ERROR: FOM Object Attribute '"
                    << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
                    << trick_name << "' must use either the ENCODING_LOGICAL_TIME, "
-                   << "ENCODING_BIG_ENDIAN, ENCODING_LITTLE_ENDIAN, ENCODING_NONE, or "
+                   << "ENCODING_BIG_ENDIAN, ENCODING_LITTLE_ENDIAN, ENCODING_NONE, "
+                   << "ENCODING_DELTA, ENCODING_CHUNKED, or "
                    << "ENCODING_UNKNOWN value for the 'rti_encoding' when the "
                    << "attribute represents a primitive type. Please check your "
                    << "input or modified-data files to make sure the value for the "
@@ -447,6 +566,34 @@ void Attribute::initialize(
       }
    }
 
+   // Validate the chunked streaming configuration.
+   if ( rti_encoding == ENCODING_CHUNKED ) {
+      if ( this->max_chunk_size <= 0 ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::initialize():" << __LINE__
+                << " ERROR: FOM Object Attribute '"
+                << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
+                << trick_name << "' has a 'max_chunk_size' value of "
+                << this->max_chunk_size << " bytes, which must be greater"
+                << " than zero for the ENCODING_CHUNKED rti_encoding. Please"
+                << " check your input or modified-data files to make sure the"
+                << " value for 'max_chunk_size' is correctly specified." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      if ( this->skip_unchanged_updates ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::initialize():" << __LINE__
+                << " ERROR: FOM Object Attribute '"
+                << obj_FOM_name << "'->'" << FOM_name << "' with Trick name '"
+                << trick_name << "' has 'skip_unchanged_updates' enabled,"
+                << " which is not supported for the ENCODING_CHUNKED"
+                << " rti_encoding because the staging buffer is intentionally"
+                << " unchanged while the chunks of a value are being sent"
+                << " across consecutive data cycles." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
    // Determine if the Object Attribute type is supported.
    if ( !is_supported_attribute_type() ) {
       ostringstream errmsg;
@@ -488,9 +635,17 @@ void Attribute::initialize(
    // Determine if we need to do a byteswap for data transmission.
    byteswap = Utilities::is_transmission_byteswap( rti_encoding );
 
+   // Resolve the buffer copy codec plan now that the type and encoding
+   // are known, so the cyclic encode/decode path does not have to
+   // re-dispatch on them every cycle.
+   resolve_buffer_copy_codec();
+
    // Determine if the size of this attribute is static or dynamic.
    size_is_static = is_static_in_size();
 
+   // A (re)initialize invalidates any previously resolved array record.
+   invalidate_resolved_address_cache();
+
    // Get the attribute size and number of items.
    // However, do not re-initialize an attribute which was loaded
    // from a checkpoint (already in an initialized state).
@@ -520,6 +675,25 @@ void Attribute::initialize(
       }
    }
 
+   // Determine if the user requested zero-copy send mode is supported for
+   // this attribute, otherwise fall back to the buffered send path.
+   if ( this->zero_copy_send ) {
+      if ( is_zero_copy_send_supported() ) {
+         this->zero_copy_active = true;
+      } else {
+         ostringstream msg;
+         msg << "Attribute::initialize():" << __LINE__
+             << " WARNING: FOM Attribute '" << FOM_name << "' with Trick name '"
+             << trick_name << "' has 'zero_copy_send' enabled but the zero-copy"
+             << " send mode is only supported for primitive types and static"
+             << " arrays of primitive type with an rti_encoding of"
+             << " ENCODING_NONE, ENCODING_LITTLE_ENDIAN, or ENCODING_BIG_ENDIAN."
+             << " Falling back to the buffered send path." << THLA_ENDL;
+         send_hs( stderr, msg.str().c_str() );
+         this->zero_copy_active = false;
+      }
+   }
+
    if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
       string attr_handle_string;
       StringUtilities::to_string( attr_handle_string, this->attr_handle );
@@ -634,24 +808,232 @@ void Attribute::determine_cycle_ratio(
    }
 }
 
+/*!
+ * @job_class{initialization}
+ */
+void Attribute::register_user_buffer(
+   unsigned char *data,
+   size_t const   capacity,
+   int           *length )
+{
+   if ( rti_encoding != ENCODING_OPAQUE_DATA ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::register_user_buffer():" << __LINE__
+             << " ERROR: A user-owned buffer is only supported for the"
+             << " ENCODING_OPAQUE_DATA rti_encoding, for attribute '" << FOM_name
+             << "' with Trick name '" << trick_name << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( data == NULL ) || ( length == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::register_user_buffer():" << __LINE__
+             << " ERROR: Unexpected NULL buffer or length pointer for attribute '"
+             << FOM_name << "' with Trick name '" << trick_name << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( capacity < 4 ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::register_user_buffer():" << __LINE__
+             << " ERROR: The user-owned buffer capacity of " << capacity
+             << " bytes for attribute '" << FOM_name << "' with Trick name '"
+             << trick_name << "' must be at least 4 bytes to hold the"
+             << " HLAopaqueData length prefix!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( this->skip_unchanged_updates ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::register_user_buffer():" << __LINE__
+             << " ERROR: A user-owned buffer can not be used with"
+             << " 'skip_unchanged_updates' enabled for attribute '" << FOM_name
+             << "' with Trick name '" << trick_name << "', because the staging"
+             << " buffer the change detection compares against is intentionally"
+             << " skipped for a user-owned buffer!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   this->user_buffer          = data;
+   this->user_buffer_capacity = capacity;
+   this->user_buffer_length   = length;
+}
+
 VariableLengthData Attribute::get_attribute_value()
 {
+   if ( this->user_buffer != NULL ) {
+      // The user-owned buffer already holds the full wire image with the
+      // HLAopaqueData length prefix written by pack_attribute_buffer().
+      return VariableLengthData( user_buffer, size );
+   }
+   if ( rti_encoding == ENCODING_DELTA ) {
+      // Encode the sparse delta frame against the last sent value.
+      encode_delta_frame();
+      return VariableLengthData( delta_frame_buffer, delta_frame_size );
+   }
+   if ( rti_encoding == ENCODING_CHUNKED ) {
+      // Encode the next bounded chunk of the value snapshot.
+      encode_chunk_frame();
+      return VariableLengthData( chunk_frame_buffer, chunk_frame_size );
+   }
    if ( rti_encoding == ENCODING_BOOLEAN ) {
       // The size is the number of 1-byte bool values in c++ and we need to
       // map to a 4-byte HLAboolean type. The buffer already holds the
       // encoded HLAboolean type.
       return VariableLengthData( buffer, ( 4 * size ) );
    }
+   if ( rti_encoding == ENCODING_PACKED_BITS ) {
+      // The size is the number of 1-byte bool values in c++ and the buffer
+      // already holds the bools packed eight per byte.
+      return VariableLengthData( buffer, ( ( size + 7 ) / 8 ) );
+   }
    return VariableLengthData( buffer, size );
 }
 
-bool Attribute::extract_data(             // RETURN: -- True if data successfully extracted, false otherwise.
-   VariableLengthData const *attr_value ) // IN: ** HLA attribute-value to get data from.
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - When zero-copy send is active, the filled in attribute value only
+ *   references the attribute data and does not copy it, so the attribute
+ *   value must be handed to the RTI before the next data cycle updates the
+ *   simulation variable or the staging buffer.
+ */
+void Attribute::get_attribute_value(
+   VariableLengthData &attr_value )
+{
+   if ( this->user_buffer != NULL ) {
+      // The user-owned buffer already holds the full wire image with the
+      // HLAopaqueData length prefix written by pack_attribute_buffer().
+      // Reference it without copying it; the user guarantees the buffer
+      // stays stable, which matches the zero-copy lifetime assumption
+      // documented above.
+      attr_value.setDataPointer( user_buffer, size );
+   } else if ( this->zero_copy_active ) {
+      if ( byteswap ) {
+         // A byteswap is required so the data was encoded into the staging
+         // buffer, reference the buffer without copying it.
+         attr_value.setDataPointer( buffer, size );
+      } else {
+         // No encoding is needed so reference the Trick simulation variable
+         // memory directly without copying it.
+         attr_value.setDataPointer( ref2->address, size );
+      }
+   } else if ( rti_encoding == ENCODING_DELTA ) {
+      // Encode the sparse delta frame against the last sent value and
+      // reference it without copying it. The frame buffer stays stable
+      // until the next data cycle, which matches the zero-copy lifetime
+      // assumption documented above.
+      encode_delta_frame();
+      attr_value.setDataPointer( delta_frame_buffer, delta_frame_size );
+   } else if ( rti_encoding == ENCODING_CHUNKED ) {
+      // Encode the next bounded chunk of the value snapshot and reference
+      // it without copying it. The frame buffer stays stable until the
+      // next data cycle, which matches the zero-copy lifetime assumption
+      // documented above.
+      encode_chunk_frame();
+      attr_value.setDataPointer( chunk_frame_buffer, chunk_frame_size );
+   } else if ( rti_encoding == ENCODING_BOOLEAN ) {
+      // The size is the number of 1-byte bool values in c++ and we need to
+      // map to a 4-byte HLAboolean type. The buffer already holds the
+      // encoded HLAboolean type.
+      attr_value.setData( buffer, ( 4 * size ) );
+   } else if ( rti_encoding == ENCODING_PACKED_BITS ) {
+      // The size is the number of 1-byte bool values in c++ and the buffer
+      // already holds the bools packed eight per byte.
+      attr_value.setData( buffer, ( ( size + 7 ) / 8 ) );
+   } else {
+      attr_value.setData( buffer, size );
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The attribute data must already be encoded (i.e. packed) before this
+ *   function is called.
+ * - When the data changed, the encoded data is snapshot as the new last
+ *   sent update, so the caller is expected to actually send the update.
+ */
+bool Attribute::is_data_changed_since_last_sent()
+{
+   // Determine where the encoded data lives and how many bytes it is. For
+   // a zero-copy send with no byteswap the data is the Trick simulation
+   // variable itself, otherwise it is the encoded staging buffer.
+   unsigned char const *data = ( this->zero_copy_active && !byteswap )
+                                  ? static_cast< unsigned char const * >( ref2->address )
+                                  : buffer;
+   size_t const data_size = ( rti_encoding == ENCODING_BOOLEAN )
+                               ? ( 4 * size )
+                               : ( ( rti_encoding == ENCODING_PACKED_BITS )
+                                      ? ( ( size + 7 ) / 8 )
+                                      : size );
+
+   // The data is unchanged only if we have a valid snapshot of the same
+   // size with the same byte contents.
+   if ( last_sent_valid
+        && ( data_size == last_sent_size )
+        && ( memcmp( last_sent_buffer, data, data_size ) == 0 ) ) {
+      return false;
+   }
+
+   // Ensure the snapshot buffer has enough capacity.
+   if ( data_size > last_sent_capacity ) {
+      size_t const old_capacity = last_sent_capacity;
+      last_sent_capacity        = data_size;
+      if ( last_sent_buffer == NULL ) {
+         last_sent_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", last_sent_capacity ) );
+      } else {
+         last_sent_buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( last_sent_buffer, last_sent_capacity ) );
+      }
+      AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                        (long long)old_capacity, (long long)last_sent_capacity );
+      if ( last_sent_buffer == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::is_data_changed_since_last_sent():" << __LINE__
+                << " ERROR: Could not allocate memory for the last sent data"
+                << " snapshot for attribute '" << FOM_name << "' with Trick name '"
+                << trick_name << "' and a size of " << data_size << " bytes!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   // Snapshot the encoded data as the new last sent update.
+   memcpy( last_sent_buffer, data, data_size );
+   last_sent_size  = data_size;
+   last_sent_valid = true;
+
+   return true;
+}
+
+bool Attribute::is_zero_copy_send_supported() const
+{
+   // Zero-copy send only works for data we can hand to the RTI as a flat
+   // byte layout, which limits it to primitive types and static arrays of
+   // primitive type with no special encoding.
+   if ( ( rti_encoding != ENCODING_NONE )
+        && ( rti_encoding != ENCODING_LITTLE_ENDIAN )
+        && ( rti_encoding != ENCODING_BIG_ENDIAN ) ) {
+      return false;
+   }
+
+   // Strings and dynamic arrays (i.e. pointers) are variable in size and
+   // are repacked every cycle, so they are not supported.
+   if ( ( ref2->attr->type == TRICK_STRING )
+        || ( ( ref2->attr->num_index > 0 )
+             && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
+      return false;
+   }
+
+   return size_is_static;
+}
+
+bool Attribute::extract_data(            // RETURN: -- True if data successfully extracted, false otherwise.
+   VariableLengthData const *attr_value, // IN: ** HLA attribute-value to get data from.
+   bool const                borrow_data ) // IN: -- True to borrow the attribute value storage in place.
 {
    if ( attr_value == NULL ) {
       return false;
    }
 
+   // Drop any previously borrowed reference, it is replaced below when the
+   // caller lets us borrow the received value storage.
+   this->borrowed_data = NULL;
+
    // Keep track of the attribute FOM size and ensure enough buffer capacity.
    size_t attr_size = attr_value->size();
 
@@ -678,14 +1060,54 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
             return false;
          }
 
-         // Ensure enough buffer capacity.
-         ensure_buffer_capacity( attr_size );
-
          // Note: We don't set the 'size' to the value of "attr_size" since we
          // are mapping 4-byte HLAboolean types to 1-byte bool in C++.
          //
-         // Copy the RTI attribute value into the buffer.
-         memcpy( buffer, attr_value->data(), attr_size );
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), attr_size );
+         }
+         break;
+      }
+      case ENCODING_PACKED_BITS: {
+         if ( attr_size != ( ( expected_byte_count + 7 ) / 8 ) ) {
+            ostringstream errmsg;
+            errmsg << "Attribute::extract_data():" << __LINE__
+                   << " WARNING: For Attribute '" << FOM_name << "' with Trick name '"
+                   << trick_name << "', the received FOM data size (" << attr_size
+                   << " bytes) != Expected packed size ("
+                   << ( ( expected_byte_count + 7 ) / 8 ) << " bytes) for 'rti_encoding' of"
+                   << " ENCODING_PACKED_BITS. Make sure your simulation variable is the"
+                   << " same size and type as what is defined in the FOM, and that the"
+                   << " sending federate also configured ENCODING_PACKED_BITS for this"
+                   << " attribute." << THLA_ENDL;
+            send_hs( stderr, errmsg.str().c_str() );
+
+            // For now, we ignore this error by just returning here.
+            return false;
+         }
+
+         // Note: We don't set the 'size' to the value of "attr_size" since we
+         // are mapping eight packed bits per byte to 1-byte bool in C++.
+         //
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), attr_size );
+         }
          break;
       }
       case ENCODING_NONE: {
@@ -713,14 +1135,20 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
             return false;
          }
 
-         // Ensure enough buffer capacity.
-         ensure_buffer_capacity( attr_size );
-
          // Make sure the buffer size matches how much data we are putting in it.
          this->size = attr_size;
 
-         // Copy the RTI attribute value into the buffer.
-         memcpy( buffer, attr_value->data(), size );
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), size );
+         }
          break;
       }
       case ENCODING_LOGICAL_TIME: {
@@ -743,17 +1171,64 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
                    << " variables are not the correct size or type." << THLA_ENDL;
             DebugHandler::terminate_with_message( errmsg.str() );
          }
-         // Ensure enough buffer capacity.
-         ensure_buffer_capacity( attr_size );
-
          // Make sure the buffer size matches how much data we are putting in it.
          this->size = attr_size;
 
-         // Copy the RTI attribute value into the buffer.
-         memcpy( buffer, attr_value->data(), size );
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), size );
+         }
          break;
       }
       case ENCODING_OPAQUE_DATA: {
+         if ( this->user_buffer != NULL ) {
+            // Decode the received wire image directly into the user-owned
+            // buffer instead of staging a copy, the later unpack is a no-op.
+            if ( attr_size < 4 ) {
+               ostringstream errmsg;
+               errmsg << "Attribute::extract_data():" << __LINE__
+                      << " WARNING: For Attribute '" << FOM_name << "' with Trick name '"
+                      << trick_name << "', the received FOM data size (" << attr_size
+                      << " bytes) is too small to hold the HLAopaqueData length"
+                      << " prefix!" << THLA_ENDL;
+               send_hs( stderr, errmsg.str().c_str() );
+               return false;
+            }
+            if ( attr_size > user_buffer_capacity ) {
+               ostringstream errmsg;
+               errmsg << "Attribute::extract_data():" << __LINE__
+                      << " WARNING: For Attribute '" << FOM_name << "' with Trick name '"
+                      << trick_name << "', the received FOM data size (" << attr_size
+                      << " bytes) exceeds the registered user-owned buffer capacity ("
+                      << user_buffer_capacity << " bytes)!" << THLA_ENDL;
+               send_hs( stderr, errmsg.str().c_str() );
+               return false;
+            }
+            unsigned char const *data = static_cast< unsigned char const * >( attr_value->data() );
+
+            // Decode the big endian HLAinteger32BE length prefix.
+            int length = ( data[0] << 24 ) | ( data[1] << 16 ) | ( data[2] << 8 ) | data[3];
+            if ( length < 0 ) {
+               length = 0;
+            } else if ( length > ( (int)attr_size - 4 ) ) {
+               length = (int)attr_size - 4;
+            }
+
+            // Copy the full wire image (prefix + payload) into the
+            // user-owned buffer and publish the decoded payload length.
+            memcpy( user_buffer, data, attr_size );
+            *user_buffer_length = length;
+            this->size          = attr_size;
+            break;
+         }
+
          if ( size_is_static && ( attr_size != expected_byte_count ) ) {
             ostringstream errmsg;
             errmsg << "Attribute::extract_data():" << __LINE__
@@ -773,14 +1248,42 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
             return false;
          }
 
-         // Ensure enough buffer capacity.
-         ensure_buffer_capacity( attr_size );
-
          // Make sure the buffer size matches how much data we are putting in it.
          this->size = attr_size;
 
-         // Copy the RTI attribute value into the buffer.
-         memcpy( buffer, attr_value->data(), size );
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), size );
+         }
+         break;
+      }
+      case ENCODING_DELTA: {
+         // Reconstruct the full value by applying the received sparse delta
+         // frame to the previously received value held in the buffer. Any
+         // frame that can not be applied is reported and ignored, and the
+         // value re-synchronizes on the next full refresh frame.
+         if ( !decode_delta_frame( static_cast< unsigned char const * >( attr_value->data() ),
+                                   attr_size ) ) {
+            return false;
+         }
+         break;
+      }
+      case ENCODING_CHUNKED: {
+         // Copy the received chunk into the reassembly buffer and only
+         // report extracted data once the final chunk completes the value,
+         // so the incremental per-frame cost stays bounded and a partially
+         // received value is never decoded into the simulation variable.
+         if ( !decode_chunk_frame( static_cast< unsigned char const * >( attr_value->data() ),
+                                   attr_size ) ) {
+            return false;
+         }
          break;
       }
       default: {
@@ -804,41 +1307,601 @@ bool Attribute::extract_data(             // RETURN: -- True if data successfull
             return false;
          }
 
-         // Ensure enough buffer capacity.
-         ensure_buffer_capacity( attr_size );
+         // Make sure the buffer size matches how much data we are putting in it.
+         this->size = attr_size;
+
+         if ( borrow_data ) {
+            // Borrow the received value storage in place instead of staging
+            // a copy, the unpack decodes directly from it.
+            this->borrowed_data = static_cast< unsigned char const * >( attr_value->data() );
+         } else {
+            // Ensure enough buffer capacity.
+            ensure_buffer_capacity( attr_size );
+
+            // Copy the RTI attribute value into the buffer.
+            memcpy( buffer, attr_value->data(), size );
+         }
+         break;
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      send_hs( stdout, "Attribute::extract_data():%d Decoded '%s' (trick_name '%s') from attribute map.%c",
+               __LINE__, get_FOM_name(), get_trick_name(), THLA_NEWLINE );
+   }
+   if ( ( this->borrowed_data == NULL )
+        && ( this->user_buffer == NULL )
+        && DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      print_buffer();
+   }
+
+   // Mark the attribute value as changed.
+   mark_changed();
+
+   return true;
+}
+
+// ENCODING_DELTA frame layout: a 1-byte frame type, the 4-byte size of the
+// full value, and a 4-byte checksum of the full value, followed by either
+// the raw value bytes (full refresh frame) or a 4-byte run count and sparse
+// {offset, length, bytes} runs of the bytes that differ from the last sent
+// value. All fields are in host byte order, see ENCODING_DELTA in Types.hh.
+static unsigned char const DELTA_FRAME_FULL   = 0;
+static unsigned char const DELTA_FRAME_SPARSE = 1;
+
+static size_t const DELTA_FRAME_HEADER_SIZE = 1 + ( 2 * sizeof( uint32_t ) );
+
+// Number of consecutive unchanged bytes that ends a sparse run. Merging
+// nearby runs trades a few duplicate bytes for fewer run headers.
+static size_t const DELTA_RUN_MERGE_GAP = 8;
+
+// A full refresh frame is sent at least this often so a late joining
+// subscriber re-synchronizes within a bounded number of updates.
+static unsigned int const DELTA_FULL_REFRESH_PERIOD = 64;
+
+/*! @brief 32-bit FNV-1a checksum used to validate reconstructed
+ *  ENCODING_DELTA values.
+ *  @return Checksum of the data.
+ *  @param data Data to checksum.
+ *  @param size Size in bytes of the data. */
+static uint32_t delta_checksum(
+   unsigned char const *data,
+   size_t const         size )
+{
+   uint32_t checksum = 0x811C9DC5U;
+   for ( size_t i = 0; i < size; ++i ) {
+      checksum ^= (uint32_t)data[i];
+      checksum *= 0x01000193U;
+   }
+   return checksum;
+}
+
+void Attribute::encode_delta_frame()
+{
+   // The packed value this frame is encoded from.
+   unsigned char const *data      = buffer;
+   size_t const         data_size = size;
+
+   // Ensure the frame buffer can hold a worst case frame, which is a full
+   // refresh frame plus the sparse frame run count.
+   size_t const needed_capacity = DELTA_FRAME_HEADER_SIZE + sizeof( uint32_t ) + data_size;
+   if ( needed_capacity > delta_frame_capacity ) {
+      size_t const old_frame_capacity = delta_frame_capacity;
+      delta_frame_capacity            = needed_capacity;
+      if ( delta_frame_buffer == NULL ) {
+         delta_frame_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", delta_frame_capacity ) );
+      } else {
+         delta_frame_buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( delta_frame_buffer, delta_frame_capacity ) );
+      }
+      AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                        (long long)old_frame_capacity, (long long)delta_frame_capacity );
+      if ( delta_frame_buffer == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::encode_delta_frame():" << __LINE__
+                << " ERROR: Could not allocate memory for the delta frame"
+                << " buffer for attribute '" << FOM_name << "' with Trick name '"
+                << trick_name << "' and a size of " << needed_capacity
+                << " bytes!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   uint32_t const value_size     = (uint32_t)data_size;
+   uint32_t const value_checksum = delta_checksum( data, data_size );
+
+   // A full refresh frame must be sent for the first update, whenever the
+   // value size changed, and periodically to bound re-synchronization.
+   bool send_full = !delta_ref_valid
+                    || ( delta_ref_size != data_size )
+                    || ( delta_sends_since_full >= DELTA_FULL_REFRESH_PERIOD );
+
+   if ( !send_full ) {
+
+      // Build the sparse runs of bytes that differ from the last sent value.
+      size_t   out_pos   = DELTA_FRAME_HEADER_SIZE + sizeof( uint32_t );
+      uint32_t run_count = 0;
+
+      size_t index = 0;
+      while ( index < data_size ) {
+         if ( data[index] == delta_ref_buffer[index] ) {
+            ++index;
+            continue;
+         }
+
+         // Extend the run until DELTA_RUN_MERGE_GAP consecutive bytes are
+         // unchanged, merging nearby changes into a single run.
+         size_t scan      = index;
+         size_t equal_run = 0;
+         while ( ( scan < data_size ) && ( equal_run < DELTA_RUN_MERGE_GAP ) ) {
+            equal_run = ( data[scan] == delta_ref_buffer[scan] ) ? ( equal_run + 1 ) : 0;
+            ++scan;
+         }
+         size_t const run_end    = scan - equal_run;
+         uint32_t const run_offset = (uint32_t)index;
+         uint32_t const run_length = (uint32_t)( run_end - index );
+
+         // Fall back to a full refresh frame when the sparse frame is not
+         // actually smaller than just sending the full value.
+         if ( ( out_pos + ( 2 * sizeof( uint32_t ) ) + run_length )
+              >= ( DELTA_FRAME_HEADER_SIZE + data_size ) ) {
+            send_full = true;
+            break;
+         }
+
+         memcpy( delta_frame_buffer + out_pos, &run_offset, sizeof( run_offset ) );
+         out_pos += sizeof( run_offset );
+         memcpy( delta_frame_buffer + out_pos, &run_length, sizeof( run_length ) );
+         out_pos += sizeof( run_length );
+         memcpy( delta_frame_buffer + out_pos, data + index, run_length );
+         out_pos += run_length;
+         ++run_count;
+
+         index = scan;
+      }
+
+      if ( !send_full ) {
+         delta_frame_buffer[0] = DELTA_FRAME_SPARSE;
+         memcpy( delta_frame_buffer + 1, &value_size, sizeof( value_size ) );
+         memcpy( delta_frame_buffer + 1 + sizeof( value_size ), &value_checksum, sizeof( value_checksum ) );
+         memcpy( delta_frame_buffer + DELTA_FRAME_HEADER_SIZE, &run_count, sizeof( run_count ) );
+         delta_frame_size = out_pos;
+         ++delta_sends_since_full;
+      }
+   }
+
+   if ( send_full ) {
+      delta_frame_buffer[0] = DELTA_FRAME_FULL;
+      memcpy( delta_frame_buffer + 1, &value_size, sizeof( value_size ) );
+      memcpy( delta_frame_buffer + 1 + sizeof( value_size ), &value_checksum, sizeof( value_checksum ) );
+      memcpy( delta_frame_buffer + DELTA_FRAME_HEADER_SIZE, data, data_size );
+      delta_frame_size       = DELTA_FRAME_HEADER_SIZE + data_size;
+      delta_sends_since_full = 0;
+   }
+
+   // Snapshot the value as the new reference for the next delta.
+   if ( data_size > delta_ref_capacity ) {
+      size_t const old_ref_capacity = delta_ref_capacity;
+      delta_ref_capacity            = data_size;
+      if ( delta_ref_buffer == NULL ) {
+         delta_ref_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", delta_ref_capacity ) );
+      } else {
+         delta_ref_buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( delta_ref_buffer, delta_ref_capacity ) );
+      }
+      AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                        (long long)old_ref_capacity, (long long)delta_ref_capacity );
+      if ( delta_ref_buffer == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::encode_delta_frame():" << __LINE__
+                << " ERROR: Could not allocate memory for the delta reference"
+                << " buffer for attribute '" << FOM_name << "' with Trick name '"
+                << trick_name << "' and a size of " << data_size
+                << " bytes!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+   memcpy( delta_ref_buffer, data, data_size );
+   delta_ref_size  = data_size;
+   delta_ref_valid = true;
+}
+
+bool Attribute::decode_delta_frame(
+   unsigned char const *frame,
+   size_t const         frame_size )
+{
+   if ( ( frame == NULL ) || ( frame_size < DELTA_FRAME_HEADER_SIZE ) ) {
+      send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', received a malformed ENCODING_DELTA frame of %d bytes. Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)frame_size, THLA_NEWLINE );
+      return false;
+   }
+
+   unsigned char const frame_type = frame[0];
+   uint32_t            value_size;
+   uint32_t            value_checksum;
+   memcpy( &value_size, frame + 1, sizeof( value_size ) );
+   memcpy( &value_checksum, frame + 1 + sizeof( value_size ), sizeof( value_checksum ) );
+
+   if ( frame_type == DELTA_FRAME_FULL ) {
+
+      if ( frame_size != ( DELTA_FRAME_HEADER_SIZE + value_size ) ) {
+         send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_DELTA full refresh frame size (%d bytes) does not match the declared value size (%d bytes). Ignoring this update.%c",
+                  __LINE__, FOM_name, trick_name, (int)frame_size, (int)value_size, THLA_NEWLINE );
+         return false;
+      }
+
+      // Ensure enough buffer capacity.
+      ensure_buffer_capacity( value_size );
+
+      // Make sure the buffer size matches how much data we are putting in it.
+      this->size = value_size;
+
+      // Take the full value from the refresh frame.
+      memcpy( buffer, frame + DELTA_FRAME_HEADER_SIZE, value_size );
+
+      if ( delta_checksum( buffer, value_size ) != value_checksum ) {
+         send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_DELTA full refresh frame failed the checksum. Ignoring this update.%c",
+                  __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+         this->delta_rx_ref_valid = false;
+         return false;
+      }
+      this->delta_rx_ref_valid = true;
+      return true;
+   }
+
+   if ( frame_type != DELTA_FRAME_SPARSE ) {
+      send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', received an unknown ENCODING_DELTA frame type %d. Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)frame_type, THLA_NEWLINE );
+      return false;
+   }
+
+   // A sparse delta frame can only be applied to a matching full value we
+   // already received, so wait for the next full refresh frame otherwise.
+   // This happens when joining a federation late and is not an error.
+   if ( !delta_rx_ref_valid || ( this->size != value_size ) ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+         send_hs( stdout, "Attribute::decode_delta_frame():%d For Attribute '%s' with Trick name '%s', no reference value to apply the ENCODING_DELTA sparse frame to yet, waiting for the next full refresh frame.%c",
+                  __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+      }
+      return false;
+   }
+
+   if ( frame_size < ( DELTA_FRAME_HEADER_SIZE + sizeof( uint32_t ) ) ) {
+      send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', received a malformed ENCODING_DELTA sparse frame of %d bytes. Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)frame_size, THLA_NEWLINE );
+      return false;
+   }
+
+   uint32_t run_count;
+   memcpy( &run_count, frame + DELTA_FRAME_HEADER_SIZE, sizeof( run_count ) );
+
+   // Apply the sparse runs to the previously received value in the buffer.
+   size_t in_pos = DELTA_FRAME_HEADER_SIZE + sizeof( uint32_t );
+   for ( uint32_t run = 0; run < run_count; ++run ) {
+      if ( ( in_pos + ( 2 * sizeof( uint32_t ) ) ) > frame_size ) {
+         send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_DELTA sparse frame is truncated. Ignoring this update.%c",
+                  __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+         this->delta_rx_ref_valid = false;
+         return false;
+      }
+      uint32_t run_offset;
+      uint32_t run_length;
+      memcpy( &run_offset, frame + in_pos, sizeof( run_offset ) );
+      in_pos += sizeof( run_offset );
+      memcpy( &run_length, frame + in_pos, sizeof( run_length ) );
+      in_pos += sizeof( run_length );
+
+      if ( ( ( in_pos + run_length ) > frame_size )
+           || ( ( (size_t)run_offset + run_length ) > (size_t)value_size ) ) {
+         send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_DELTA sparse frame has an out of bounds run. Ignoring this update.%c",
+                  __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+         this->delta_rx_ref_valid = false;
+         return false;
+      }
+
+      memcpy( buffer + run_offset, frame + in_pos, run_length );
+      in_pos += run_length;
+   }
+
+   // Validate the reconstructed value. A mismatch means the reference got
+   // out of sync, so drop it and wait for the next full refresh frame.
+   if ( delta_checksum( buffer, value_size ) != value_checksum ) {
+      send_hs( stderr, "Attribute::decode_delta_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the reconstructed ENCODING_DELTA value failed the checksum, re-synchronizing on the next full refresh frame.%c",
+               __LINE__, FOM_name, trick_name, THLA_NEWLINE );
+      this->delta_rx_ref_valid = false;
+      return false;
+   }
+
+   return true;
+}
+
+// ENCODING_CHUNKED frame layout: a 4-byte update identifier, the 4-byte
+// total size of the value, and the 4-byte offset of this chunk into the
+// value, followed by the chunk payload bytes. All fields are in host byte
+// order, see ENCODING_CHUNKED in Types.hh.
+static size_t const CHUNK_FRAME_HEADER_SIZE = 3 * sizeof( uint32_t );
+
+void Attribute::encode_chunk_frame()
+{
+   // Start a new value stream if no stream is in progress. The staging
+   // buffer is not re-packed while a stream is in progress, so the value
+   // snapshot stays stable across the consecutive data cycle sends.
+   if ( !chunk_send_active ) {
+      this->chunk_send_active = true;
+      this->chunk_send_offset = 0;
+      this->chunk_send_total  = size;
+      ++this->chunk_send_update_id;
+   }
+
+   // Bound the payload of this chunk to the configured maximum chunk size.
+   size_t const remaining   = chunk_send_total - chunk_send_offset;
+   size_t const chunk_bytes = ( remaining < (size_t)max_chunk_size )
+                                 ? remaining
+                                 : (size_t)max_chunk_size;
+
+   // Ensure the frame buffer can hold the header and the chunk payload.
+   size_t const needed_capacity = CHUNK_FRAME_HEADER_SIZE + chunk_bytes;
+   if ( needed_capacity > chunk_frame_capacity ) {
+      size_t const old_capacity = chunk_frame_capacity;
+      chunk_frame_capacity      = needed_capacity;
+      if ( chunk_frame_buffer == NULL ) {
+         chunk_frame_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", chunk_frame_capacity ) );
+      } else {
+         chunk_frame_buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( chunk_frame_buffer, chunk_frame_capacity ) );
+      }
+      AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                        (long long)old_capacity, (long long)chunk_frame_capacity );
+      if ( chunk_frame_buffer == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::encode_chunk_frame():" << __LINE__
+                << " ERROR: Could not allocate memory for the chunk frame"
+                << " buffer for attribute '" << FOM_name << "' with Trick name '"
+                << trick_name << "' and a size of " << needed_capacity
+                << " bytes!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   uint32_t const update_id  = (uint32_t)chunk_send_update_id;
+   uint32_t const total_size = (uint32_t)chunk_send_total;
+   uint32_t const offset     = (uint32_t)chunk_send_offset;
+
+   memcpy( chunk_frame_buffer, &update_id, sizeof( update_id ) );
+   memcpy( chunk_frame_buffer + sizeof( uint32_t ), &total_size, sizeof( total_size ) );
+   memcpy( chunk_frame_buffer + ( 2 * sizeof( uint32_t ) ), &offset, sizeof( offset ) );
+   if ( chunk_bytes > 0 ) {
+      memcpy( chunk_frame_buffer + CHUNK_FRAME_HEADER_SIZE, buffer + chunk_send_offset, chunk_bytes );
+   }
+   chunk_frame_size = CHUNK_FRAME_HEADER_SIZE + chunk_bytes;
+
+   this->chunk_send_offset += chunk_bytes;
+   if ( this->chunk_send_offset >= this->chunk_send_total ) {
+      // This was the final chunk of the value snapshot, so the next send
+      // re-packs the staging buffer and starts a new value stream.
+      this->chunk_send_active = false;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      send_hs( stdout, "Attribute::encode_chunk_frame():%d For Attribute '%s' with Trick name '%s', sending %d bytes at offset %d of %d total bytes for value update %d.%c",
+               __LINE__, FOM_name, trick_name, (int)chunk_bytes, (int)offset,
+               (int)chunk_send_total, (int)update_id, THLA_NEWLINE );
+   }
+}
+
+bool Attribute::decode_chunk_frame(
+   unsigned char const *frame,
+   size_t const         frame_size )
+{
+   if ( ( frame == NULL ) || ( frame_size < CHUNK_FRAME_HEADER_SIZE ) ) {
+      send_hs( stderr, "Attribute::decode_chunk_frame():%d WARNING: For Attribute '%s' with Trick name '%s', received a malformed ENCODING_CHUNKED frame of %d bytes. Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)frame_size, THLA_NEWLINE );
+      return false;
+   }
+
+   uint32_t update_id;
+   uint32_t total_size;
+   uint32_t offset;
+   memcpy( &update_id, frame, sizeof( update_id ) );
+   memcpy( &total_size, frame + sizeof( uint32_t ), sizeof( total_size ) );
+   memcpy( &offset, frame + ( 2 * sizeof( uint32_t ) ), sizeof( offset ) );
+
+   size_t const payload_size = frame_size - CHUNK_FRAME_HEADER_SIZE;
+
+   if ( ( (size_t)offset + payload_size ) > (size_t)total_size ) {
+      send_hs( stderr, "Attribute::decode_chunk_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_CHUNKED chunk at offset %d with %d bytes exceeds the declared value size of %d bytes. Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)offset, (int)payload_size,
+               (int)total_size, THLA_NEWLINE );
+      this->chunk_recv_active = false;
+      return false;
+   }
+
+   // Start a new reassembly when this chunk begins a new value update.
+   if ( !chunk_recv_active || ( update_id != chunk_recv_update_id ) ) {
+      if ( offset != 0 ) {
+         if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+            send_hs( stdout, "Attribute::decode_chunk_frame():%d For Attribute '%s' with Trick name '%s', no reassembly in progress for the ENCODING_CHUNKED chunk at offset %d, waiting for the first chunk of the next value update.%c",
+                     __LINE__, FOM_name, trick_name, (int)offset, THLA_NEWLINE );
+         }
+         this->chunk_recv_active = false;
+         return false;
+      }
+
+      // Ensure the reassembly buffer can hold the complete value.
+      if ( (size_t)total_size > chunk_recv_capacity ) {
+         size_t const old_capacity = chunk_recv_capacity;
+         chunk_recv_capacity       = total_size;
+         if ( chunk_recv_buffer == NULL ) {
+            chunk_recv_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", chunk_recv_capacity ) );
+         } else {
+            chunk_recv_buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( chunk_recv_buffer, chunk_recv_capacity ) );
+         }
+         AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                           (long long)old_capacity, (long long)chunk_recv_capacity );
+         if ( chunk_recv_buffer == NULL ) {
+            ostringstream errmsg;
+            errmsg << "Attribute::decode_chunk_frame():" << __LINE__
+                   << " ERROR: Could not allocate memory for the chunk"
+                   << " reassembly buffer for attribute '" << FOM_name
+                   << "' with Trick name '" << trick_name << "' and a size of "
+                   << total_size << " bytes!" << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
+      }
+      this->chunk_recv_total     = total_size;
+      this->chunk_recv_offset    = 0;
+      this->chunk_recv_update_id = update_id;
+      this->chunk_recv_active    = true;
+   }
+
+   if ( (size_t)total_size != chunk_recv_total ) {
+      send_hs( stderr, "Attribute::decode_chunk_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the ENCODING_CHUNKED chunk declares a value size of %d bytes but the reassembly in progress expects %d bytes, re-synchronizing on the next value update.%c",
+               __LINE__, FOM_name, trick_name, (int)total_size,
+               (int)chunk_recv_total, THLA_NEWLINE );
+      this->chunk_recv_active = false;
+      return false;
+   }
+
+   // The chunks of a value update must arrive in order, which holds for the
+   // ordered HLA transports. A gap means an update was lost, so drop this
+   // reassembly and re-synchronize on the first chunk of the next update.
+   if ( (size_t)offset != chunk_recv_offset ) {
+      send_hs( stderr, "Attribute::decode_chunk_frame():%d WARNING: For Attribute '%s' with Trick name '%s', received an ENCODING_CHUNKED chunk at offset %d but expected offset %d, re-synchronizing on the next value update.%c",
+               __LINE__, FOM_name, trick_name, (int)offset,
+               (int)chunk_recv_offset, THLA_NEWLINE );
+      this->chunk_recv_active = false;
+      return false;
+   }
 
-         // Make sure the buffer size matches how much data we are putting in it.
-         this->size = attr_size;
+   if ( payload_size > 0 ) {
+      memcpy( chunk_recv_buffer + offset, frame + CHUNK_FRAME_HEADER_SIZE, payload_size );
+   }
+   this->chunk_recv_offset += payload_size;
 
-         // Copy the RTI attribute value into the buffer.
-         memcpy( buffer, attr_value->data(), size );
-         break;
+   if ( chunk_recv_offset < chunk_recv_total ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+         send_hs( stdout, "Attribute::decode_chunk_frame():%d For Attribute '%s' with Trick name '%s', reassembled %d of %d total bytes for value update %d.%c",
+                  __LINE__, FOM_name, trick_name, (int)chunk_recv_offset,
+                  (int)chunk_recv_total, (int)update_id, THLA_NEWLINE );
       }
+      return false;
    }
 
-   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      send_hs( stdout, "Attribute::extract_data():%d Decoded '%s' (trick_name '%s') from attribute map.%c",
-               __LINE__, get_FOM_name(), get_trick_name(), THLA_NEWLINE );
+   // The final chunk completed the value.
+   this->chunk_recv_active = false;
+
+   // The reassembled value must match the simulation variable size unless
+   // the variable is a dynamically sized character array, which the unpack
+   // resizes to the received value size.
+   bool const dynamic_char_array = ( ( ref2->attr->type == TRICK_CHARACTER )
+                                     || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
+                                   && ( ref2->attr->num_index > 0 )
+                                   && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 );
+   if ( !dynamic_char_array && ( chunk_recv_total != get_attribute_size() ) ) {
+      send_hs( stderr, "Attribute::decode_chunk_frame():%d WARNING: For Attribute '%s' with Trick name '%s', the reassembled ENCODING_CHUNKED value size (%d bytes) != Expected Trick simulation variable memory size (%d bytes). Ignoring this update.%c",
+               __LINE__, FOM_name, trick_name, (int)chunk_recv_total,
+               (int)get_attribute_size(), THLA_NEWLINE );
+      return false;
    }
-   if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      print_buffer();
+
+   // Move the completed value into the attribute buffer.
+   ensure_buffer_capacity( chunk_recv_total );
+   this->size = chunk_recv_total;
+   if ( chunk_recv_total > 0 ) {
+      memcpy( buffer, chunk_recv_buffer, chunk_recv_total );
    }
 
-   // Mark the attribute value as changed.
-   mark_changed();
+   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      send_hs( stdout, "Attribute::decode_chunk_frame():%d For Attribute '%s' with Trick name '%s', completed the %d byte value for update %d.%c",
+               __LINE__, FOM_name, trick_name, (int)chunk_recv_total,
+               (int)update_id, THLA_NEWLINE );
+   }
+
+   // Notify the user the complete value has been reassembled, just before
+   // it is decoded into the simulation variable.
+   if ( chunk_complete_callback != NULL ) {
+      ( *chunk_complete_callback )( this, chunk_complete_user_arg );
+   }
 
    return true;
 }
 
+void Attribute::allocate_buffer()
+{
+   // The transient buffer mode overrides the per-buffer checkpoint
+   // requirement for the staging buffers, whose contents are re-encoded
+   // every cycle and are meaningless across a restore.
+   bool const checkpoint_required = this->buffer_checkpoint_required
+                                    && !AttributeBufferPool::is_transient_mode();
+
+   if ( this->pooled_buffer_requested
+        || ( !checkpoint_required
+             && ( AttributeBufferPool::is_transient_mode()
+                  || AttributeBufferPool::is_huge_page_candidate( buffer_capacity ) ) ) ) {
+      // Carve the buffer from the shared pool so buffers allocated
+      // consecutively are laid out contiguously in iteration order, and
+      // large buffers that do not need to be checkpointable land in the
+      // huge-page backed slabs. Fall back to a Trick Memory Manager
+      // allocation if the pool fails.
+      buffer              = AttributeBufferPool::allocate( buffer_capacity, checkpoint_required );
+      this->buffer_pooled = ( buffer != NULL );
+   }
+   if ( buffer == NULL ) {
+      buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", buffer_capacity ) );
+   }
+   AllocationTracker::record_alloc( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                    (long long)buffer_capacity );
+}
+
+void Attribute::reinstate_transient_buffer()
+{
+   if ( this->buffer_pooled ) {
+      // The pooled chunk was allocated outside checkpointed memory, so the
+      // restored pointer is stale. Drop it and rebuild the staging buffer
+      // at its checkpointed capacity. The contents are transient wire
+      // bytes that are re-encoded on the next pack, so only the capacity
+      // needs to be reconstructed.
+      size_t const restored_capacity = ( buffer_capacity > 0 ) ? buffer_capacity : 1;
+
+      this->buffer          = NULL;
+      this->buffer_pooled   = false;
+      this->buffer_capacity = 0;
+      ensure_buffer_capacity( restored_capacity );
+   }
+}
+
 void Attribute::ensure_buffer_capacity(
    size_t capacity )
 {
    if ( capacity > buffer_capacity ) {
-      buffer_capacity = capacity;
-      if ( buffer == NULL ) {
-         buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", buffer_capacity ) );
+      if ( ( buffer != NULL ) && this->buffer_pooled ) {
+         // A pooled chunk cannot be resized in place, so allocate a new
+         // buffer through the same selection as the original allocation,
+         // preserving the current contents. The old pooled chunk stays
+         // with its slab.
+         unsigned char *old_buffer   = buffer;
+         size_t const   old_capacity = buffer_capacity;
+
+         buffer              = NULL;
+         this->buffer_pooled = false;
+         buffer_capacity     = capacity;
+         allocate_buffer();
+         if ( buffer != NULL ) {
+            memcpy( buffer, old_buffer, old_capacity );
+         }
+
+         // The new buffer was accounted by allocate_buffer(), so retire
+         // the old chunk from the accounting.
+         AllocationTracker::record_free( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                         (long long)old_capacity );
       } else {
-         buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( buffer, buffer_capacity ) );
+         size_t const old_capacity = buffer_capacity;
+
+         buffer_capacity = capacity;
+         if ( buffer == NULL ) {
+            allocate_buffer();
+         } else {
+            buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( buffer, buffer_capacity ) );
+            AllocationTracker::record_resize( AllocationTracker::SUBSYS_ATTRIBUTE_BUFFERS,
+                                              (long long)old_capacity, (long long)buffer_capacity );
+         }
       }
    } else if ( buffer == NULL ) {
       // Handle the case where the buffer has not been created yet and we
@@ -847,7 +1910,7 @@ void Attribute::ensure_buffer_capacity(
       // Make sure the capacity is at least 1.
       buffer_capacity = ( capacity > 0 ) ? capacity : 1;
 
-      buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", buffer_capacity ) );
+      allocate_buffer();
    }
 
    if ( buffer == NULL ) {
@@ -914,6 +1977,19 @@ void Attribute::calculate_size_and_number_of_items()
          // only are handling the case when num_index == 1 below.
          // NOTE: For now we assume 1-D array.
 
+         void *array_addr = *static_cast< void ** >( ref2->address );
+
+         // Use the cached resolved {address, size, count} record so the
+         // steady-state pack/unpack path does not re-walk Trick's memory
+         // manager allocation metadata every cycle. A reallocation that
+         // moves the array is detected by the address check; an in-place
+         // resize requires invalidate_resolved_address_cache() be called.
+         if ( this->resolved_array_valid && ( array_addr == this->resolved_array_address ) ) {
+            this->size      = this->resolved_array_size;
+            this->num_items = this->resolved_array_num_items;
+            return;
+         }
+
          // get_size returns the number of elements in the array.
          int trick_size = get_size( *static_cast< char ** >( ref2->address ) ) * ref2->attr->size;
          num_bytes      = ( trick_size >= 0 ) ? trick_size : 0;
@@ -926,6 +2002,12 @@ void Attribute::calculate_size_and_number_of_items()
             // Punt and set the number of items equal to the number of bytes.
             this->num_items = num_bytes;
          }
+
+         // Cache the resolved record for the next cycle.
+         this->resolved_array_address   = array_addr;
+         this->resolved_array_size      = num_bytes;
+         this->resolved_array_num_items = this->num_items;
+         this->resolved_array_valid     = true;
       } else {
          // The user variable is either a primitive type or a static
          // multi-dimensional array.
@@ -981,6 +2063,25 @@ void Attribute::calculate_size_and_number_of_items()
    return;
 }
 
+/*!
+ * @details Writes one byte per page of the staging buffer, preserving the
+ * byte value, so the pages are faulted in from the calling thread and the
+ * operating system places them on the calling thread's NUMA node under the
+ * default first-touch placement policy. Only call this when the owning
+ * thread is not concurrently encoding or decoding this attribute.
+ */
+void Attribute::first_touch_buffer()
+{
+   if ( ( buffer != NULL ) && ( buffer_capacity > 0 ) ) {
+      size_t const            page_size = 4096;
+      volatile unsigned char *bytes     = buffer;
+      for ( size_t pos = 0; pos < buffer_capacity; pos += page_size ) {
+         bytes[pos] = bytes[pos];
+      }
+      bytes[buffer_capacity - 1] = bytes[buffer_capacity - 1];
+   }
+}
+
 /*! @details If the attribute is static in size it uses a cached size value
  * otherwise the size is calculated. */
 size_t Attribute::get_attribute_size()
@@ -1120,7 +2221,61 @@ void Attribute::pack_attribute_buffer()
          }
          break;
       }
+      case ENCODING_PACKED_BITS: {
+         // Determine the number of items this attribute has (i.e. is it an array).
+         if ( !size_is_static ) {
+            calculate_size_and_number_of_items();
+         }
+
+         encode_packed_bits_to_buffer();
+
+         if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+            ostringstream msg;
+            msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
+                << "================== ATTRIBUTE ENCODE ==================================" << endl
+                << " attribute '" << FOM_name << "' (trick name '" << trick_name
+                << "')" << endl;
+            send_hs( stdout, msg.str().c_str() );
+            print_buffer();
+         }
+         break;
+      }
       case ENCODING_OPAQUE_DATA: {
+         if ( this->user_buffer != NULL ) {
+            // The user-owned buffer is the wire image, so just refresh the
+            // HLAopaqueData length prefix in place from the user supplied
+            // payload length. The payload bytes are never staged or copied.
+            int length = *user_buffer_length;
+            if ( length < 0 ) {
+               length = 0;
+            } else if ( length > ( (int)user_buffer_capacity - 4 ) ) {
+               send_hs( stderr, "Attribute::pack_attribute_buffer():%d \
+WARNING: For ENCODING_OPAQUE_DATA attribute '%s', the user supplied payload length %d > \
+user buffer payload capacity %d, will use the capacity instead.%c",
+                        __LINE__, FOM_name, length,
+                        (int)user_buffer_capacity - 4, THLA_NEWLINE );
+               length = (int)user_buffer_capacity - 4;
+            }
+
+            // Store the payload length as an HLAinteger32BE (Big Endian).
+            unsigned char *output = user_buffer;
+            if ( Utilities::get_endianness() == TRICK_BIG_ENDIAN ) {
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 0 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 1 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 2 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 3 );
+            } else {
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 3 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 2 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 1 );
+               *( output++ ) = *( ( reinterpret_cast< unsigned char * >( &length ) ) + 0 );
+            }
+
+            // The amount of data (i.e. size) is the prefix plus the payload.
+            this->size = 4 + length;
+            break;
+         }
+
          // NOTE: For now we must calculate size every time because on a
          // receive, the 'size' is adjusted to the number of bytes received
          // and does not reflect what we are sending. We only have this
@@ -1141,6 +2296,48 @@ void Attribute::pack_attribute_buffer()
          }
          break;
       }
+      case ENCODING_CHUNKED: {
+         // The staging buffer must stay stable while the chunks of the
+         // previous value snapshot are still being sent across consecutive
+         // data cycles, so skip the re-pack until the stream completes and
+         // the next value snapshot is taken.
+         if ( chunk_send_active ) {
+            break;
+         }
+
+         // Determine the number of items this attribute has (i.e. is it an array).
+         if ( !size_is_static ) {
+            calculate_size_and_number_of_items();
+         }
+
+         // Ensure enough capacity in the buffer for the attribute and all its
+         // items if it was an array.
+         ensure_buffer_capacity( size );
+
+         // The chunked value is the raw value bytes. Determine if the users
+         // variable is a pointer.
+         if ( ( ref2->attr->num_index > 0 )
+              && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) {
+            // It's a pointer
+
+            // Byteswap if needed and copy the attribute to the buffer.
+            byteswap_buffer_copy( buffer,
+                                  *static_cast< char ** >( ref2->address ),
+                                  ref2->attr->type,
+                                  num_items,
+                                  size );
+         } else {
+            // It's either a primitive type or a static array.
+
+            // Byteswap if needed and copy the attribute to the buffer.
+            byteswap_buffer_copy( buffer,
+                                  ref2->address,
+                                  ref2->attr->type,
+                                  num_items,
+                                  size );
+         }
+         break;
+      }
       default: {
          // Must handle the string as a special case because of special encodings.
          if ( ( ref2->attr->type == TRICK_STRING )
@@ -1186,8 +2383,13 @@ void Attribute::pack_attribute_buffer()
                                      ref2->attr->type,
                                      num_items,
                                      size );
-            } else {
+            } else if ( !this->zero_copy_active || byteswap ) {
                // It's either a primitive type or a static array.
+               //
+               // For a zero-copy send with no byteswap the attribute value
+               // will reference the Trick simulation variable memory
+               // directly, so there is no need to stage the data into the
+               // buffer here.
 
                // Byteswap if needed and copy the attribute to the buffer.
                byteswap_buffer_copy( buffer,
@@ -1211,6 +2413,10 @@ void Attribute::pack_attribute_buffer()
       }
    }
 
+   // Wire-traffic accounting, cheap enough to always accumulate.
+   ++this->updates_sent_count;
+   this->bytes_sent_count += (long long)size;
+
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
       string attr_handle_string;
       StringUtilities::to_string( attr_handle_string, this->attr_handle );
@@ -1262,12 +2468,24 @@ void Attribute::unpack_attribute_buffer()
              << " Skipping unpack of attribute buffer because the attribute is locally owned." << endl;
          send_hs( stdout, msg.str().c_str() );
       }
+      // Drop any borrowed reference since we are not going to unpack it,
+      // the storage it points to is released with the queue entry.
+      this->borrowed_data = NULL;
       return;
    }
 
    // TODO: Use a transcoder for each type to encode and decode depending on
    // the type specified in the FOM instead of the code below. Dan Dexter
 
+   // When the extract borrowed the received value storage, decode directly
+   // out of it by pointing the buffer at the borrowed bytes for the
+   // duration of the unpack. The decode helpers only read from the buffer
+   // and never resize it, so the heap buffer can be restored afterwards.
+   unsigned char *const heap_buffer = this->buffer;
+   if ( this->borrowed_data != NULL ) {
+      this->buffer = const_cast< unsigned char * >( this->borrowed_data );
+   }
+
    switch ( rti_encoding ) {
       case ENCODING_LOGICAL_TIME: {
          num_items = 1;
@@ -1296,7 +2514,33 @@ void Attribute::unpack_attribute_buffer()
          }
          break;
       }
+      case ENCODING_PACKED_BITS: {
+         // Determine the number of items this attribute has (i.e. is it an array).
+         if ( !size_is_static ) {
+            calculate_size_and_number_of_items();
+         }
+
+         decode_packed_bits_from_buffer();
+
+         if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+            ostringstream msg;
+            msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
+                << "================== ATTRIBUTE DECODE ==================================" << endl
+                << " attribute '" << FOM_name << "' (trick name '" << trick_name
+                << "')" << endl;
+            send_hs( stdout, msg.str().c_str() );
+            print_buffer();
+         }
+         break;
+      }
       case ENCODING_OPAQUE_DATA: {
+         if ( this->user_buffer != NULL ) {
+            // The received wire image was already decoded directly into the
+            // user-owned buffer by extract_data(), so there is no staged
+            // data to decode into the simulation variable.
+            break;
+         }
+
          // The size is the received size but recalculate the number of items.
          if ( !size_is_static ) {
             calculate_static_number_of_items();
@@ -1315,6 +2559,49 @@ void Attribute::unpack_attribute_buffer()
          }
          break;
       }
+      case ENCODING_CHUNKED: {
+         // The buffer holds the last completely reassembled value, which is
+         // the raw value bytes. A dynamically sized character array is
+         // decoded like opaque data so the simulation variable is resized
+         // to the received value size, otherwise the raw value is copied.
+         if ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
+              && ( ref2->attr->num_index > 0 )
+              && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) {
+            // The size is the received size but recalculate the number of items.
+            if ( !size_is_static ) {
+               calculate_static_number_of_items();
+            }
+
+            decode_opaque_data_from_buffer();
+         } else {
+            // Determine the number of items this attribute has (i.e. is it an array).
+            if ( !size_is_static ) {
+               calculate_size_and_number_of_items();
+            }
+
+            // Determine if the users variable is a pointer.
+            if ( ( ref2->attr->num_index > 0 ) && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) {
+               // It's a pointer
+
+               // Byteswap if needed and copy the buffer over to the attribute.
+               byteswap_buffer_copy( *static_cast< char ** >( ref2->address ),
+                                     buffer,
+                                     ref2->attr->type,
+                                     num_items,
+                                     size );
+            } else {
+               // It's either a primitive type or a static array.
+
+               // Byteswap if needed and copy the buffer over to the attribute.
+               byteswap_buffer_copy( ref2->address,
+                                     buffer,
+                                     ref2->attr->type,
+                                     num_items,
+                                     size );
+            }
+         }
+         break;
+      }
       default: {
          // Must handle the string as a special case because of special encodings.
          if ( ( ref2->attr->type == TRICK_STRING )
@@ -1384,6 +2671,15 @@ void Attribute::unpack_attribute_buffer()
       }
    }
 
+   // Restore the heap buffer and drop the borrowed reference, which is only
+   // valid until the reflected attributes queue entry is released.
+   this->buffer        = heap_buffer;
+   this->borrowed_data = NULL;
+
+   // Wire-traffic accounting, cheap enough to always accumulate.
+   ++this->updates_received_count;
+   this->bytes_received_count += (long long)size;
+
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
       string attr_handle_string;
       StringUtilities::to_string( attr_handle_string, this->attr_handle );
@@ -1474,6 +2770,42 @@ void Attribute::decode_boolean_from_buffer() const // RETURN: -- None.
    }
 }
 
+void Attribute::encode_packed_bits_to_buffer() // RETURN: -- None.
+{
+   bool *bool_src;
+
+   // Determine if the users variable is a pointer.
+   if ( ( ref2->attr->num_index > 0 ) && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) {
+      // It's a pointer
+      bool_src = reinterpret_cast< bool * >( *static_cast< char ** >( ref2->address ) );
+
+   } else {
+      // It's either a primitive type or a static array.
+      bool_src = static_cast< bool * >( ref2->address );
+   }
+
+   // Encoded size is eight bool elements packed per byte.
+   ensure_buffer_capacity( ( num_items + 7 ) / 8 );
+
+   Utilities::pack_bool_array_to_bits( buffer, bool_src, num_items );
+}
+
+void Attribute::decode_packed_bits_from_buffer() const // RETURN: -- None.
+{
+   bool *bool_dest;
+
+   // Determine if the users variable is a pointer.
+   if ( ( ref2->attr->num_index > 0 ) && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) {
+      // It's a pointer
+      bool_dest = reinterpret_cast< bool * >( ( *static_cast< char ** >( ref2->address ) ) );
+   } else {
+      // It's either a primitive type or a static array.
+      bool_dest = static_cast< bool * >( ref2->address );
+   }
+
+   Utilities::unpack_bits_to_bool_array( bool_dest, buffer, num_items );
+}
+
 void Attribute::encode_logical_time() const // RETURN: -- None.
 {
    // Integer representing time in the HLA Logical Time base.
@@ -1880,11 +3212,9 @@ void Attribute::encode_string_to_buffer() // RETURN: -- None.
                // Get the length of the string.
                size_t length = strlen( s );
 
-               // Encode as UTF-16 characters in Big Endian
-               for ( size_t k = 0; k < length; ++k ) {
-                  *( output++ ) = '\0';
-                  *( output++ ) = (unsigned char)*( s++ );
-               }
+               // Encode as UTF-16 characters in Big Endian.
+               Utilities::ascii_to_utf16_be( output, s, length );
+               output += 2 * length;
                byte_count += 2 * length;
             }
 
@@ -1961,11 +3291,9 @@ void Attribute::encode_string_to_buffer() // RETURN: -- None.
                byte_count += 4;
 
                if ( s != NULL ) {
-                  // Encode as UTF-16 characters in Big Endian
-                  for ( size_t k = 0; k < length; ++k ) {
-                     *( output++ ) = '\0';
-                     *( output++ ) = (unsigned char)*( s++ );
-                  }
+                  // Encode as UTF-16 characters in Big Endian.
+                  Utilities::ascii_to_utf16_be( output, s, length );
+                  output += 2 * length;
                   byte_count += ( 2 * length );
                }
 
@@ -2490,10 +3818,8 @@ size %d, will use the data buffer size instead.%c",
             } else {
 
                // Decode the UTF-16 characters.
-               for ( size_t k = 0; k < length; ++k ) {
-                  input++; // skip the high-character of the UTF-16 encoding
-                  output[k] = *( input++ );
-               }
+               Utilities::utf16_be_to_ascii( output, input, length );
+               input += 2 * length;
 
                // Add the terminating null character '\0';
                output[length] = '\0';
@@ -2641,10 +3967,8 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                } else {
 
                   // Decode the UTF-16 characters.
-                  for ( size_t k = 0; k < length; ++k ) {
-                     input++; // skip the high-character of the UTF-16 encoding
-                     output[k] = *( input++ );
-                  }
+                  Utilities::utf16_be_to_ascii( output, input, length );
+                  input += 2 * length;
 
                   // Add the terminating null character '\0';
                   output[length] = '\0';
@@ -3264,6 +4588,106 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
    }
 }
 
+namespace
+{
+/*! @brief Buffer copy kernel specialized at compile time on the element
+ *  type and whether a byteswap is needed, used by the attribute codec
+ *  plans resolved at initialization.
+ *  @param dest      Destination to copy data to.
+ *  @param src       Source of the data to byteswap and copy from.
+ *  @param length    The length/number of entries in the source array.
+ *  @param num_bytes The number of bytes in the source array. */
+template< typename T, bool swap >
+void buffer_copy_kernel(
+   void        *dest,
+   void const  *src,
+   size_t const length,
+   size_t const num_bytes )
+{
+   if ( swap && ( sizeof( T ) == 2 ) ) {
+      Utilities::byteswap_2_byte_array( dest, src, length );
+   } else if ( swap && ( sizeof( T ) == 4 ) ) {
+      Utilities::byteswap_4_byte_array( dest, src, length );
+   } else if ( swap && ( sizeof( T ) == 8 ) ) {
+      Utilities::byteswap_8_byte_array( dest, src, length );
+   } else {
+      // Single byte elements or no byteswap needed.
+      memcpy( dest, src, num_bytes );
+   }
+}
+} // namespace
+
+void Attribute::resolve_buffer_copy_codec()
+{
+   // No byteswap is needed for ENCODING_NONE regardless of endianness.
+   bool const swap = byteswap && ( rti_encoding != ENCODING_NONE );
+
+   switch ( ref2->attr->type ) {
+      case TRICK_CHARACTER:
+      case TRICK_UNSIGNED_CHARACTER:
+      case TRICK_BOOLEAN: {
+         buffer_copy_fn = &buffer_copy_kernel< char, false >;
+         break;
+      }
+      case TRICK_SHORT: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< short, true >
+                               : &buffer_copy_kernel< short, false >;
+         break;
+      }
+      case TRICK_UNSIGNED_SHORT: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< unsigned short, true >
+                               : &buffer_copy_kernel< unsigned short, false >;
+         break;
+      }
+      case TRICK_INTEGER: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< int, true >
+                               : &buffer_copy_kernel< int, false >;
+         break;
+      }
+      case TRICK_UNSIGNED_INTEGER: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< unsigned int, true >
+                               : &buffer_copy_kernel< unsigned int, false >;
+         break;
+      }
+      case TRICK_LONG: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< long, true >
+                               : &buffer_copy_kernel< long, false >;
+         break;
+      }
+      case TRICK_UNSIGNED_LONG: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< unsigned long, true >
+                               : &buffer_copy_kernel< unsigned long, false >;
+         break;
+      }
+      case TRICK_LONG_LONG: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< long long, true >
+                               : &buffer_copy_kernel< long long, false >;
+         break;
+      }
+      case TRICK_UNSIGNED_LONG_LONG: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< unsigned long long, true >
+                               : &buffer_copy_kernel< unsigned long long, false >;
+         break;
+      }
+      case TRICK_FLOAT: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< float, true >
+                               : &buffer_copy_kernel< float, false >;
+         break;
+      }
+      case TRICK_DOUBLE: {
+         buffer_copy_fn = swap ? &buffer_copy_kernel< double, true >
+                               : &buffer_copy_kernel< double, false >;
+         break;
+      }
+      default: {
+         // Strings and any other variable length types use the general
+         // encode/decode paths, so there is no codec plan for them.
+         buffer_copy_fn = NULL;
+         break;
+      }
+   }
+}
+
 /*! @details
  * \par<b>Assumptions and Limitations:</b>
  * - The destination must be large enough to hold num_bytes of data.
@@ -3289,6 +4713,13 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
       return;
    }
 
+   // Use the codec plan resolved at initialization, which avoids
+   // re-dispatching on the type and encoding below for every update.
+   if ( ( buffer_copy_fn != NULL ) && ( type == ref2->attr->type ) ) {
+      ( *buffer_copy_fn )( dest, src, length, num_bytes );
+      return;
+   }
+
    // Determine if we can just copy the data between the two buffers since
    // we don't need to byteswap or do any special encoding.
    if ( ( !byteswap ) || ( rti_encoding == ENCODING_NONE ) ) {
@@ -3308,9 +4739,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                d_dest[0] = Utilities::byteswap_double( d_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  d_dest[k] = Utilities::byteswap_double( d_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( d_dest, d_src, length );
             }
             break;
          }
@@ -3321,9 +4750,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                f_dest[0] = Utilities::byteswap_float( f_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  f_dest[k] = Utilities::byteswap_float( f_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( f_dest, f_src, length );
             }
             break;
          }
@@ -3340,9 +4767,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                s_dest[0] = Utilities::byteswap_short( s_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  s_dest[k] = Utilities::byteswap_short( s_src[k] );
-               }
+               Utilities::byteswap_2_byte_array( s_dest, s_src, length );
             }
             break;
          }
@@ -3352,9 +4777,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                us_dest[0] = Utilities::byteswap_unsigned_short( us_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  us_dest[k] = Utilities::byteswap_unsigned_short( us_src[k] );
-               }
+               Utilities::byteswap_2_byte_array( us_dest, us_src, length );
             }
             break;
          }
@@ -3364,9 +4787,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                i_dest[0] = Utilities::byteswap_int( i_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  i_dest[k] = Utilities::byteswap_int( i_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( i_dest, i_src, length );
             }
             break;
          }
@@ -3376,9 +4797,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                ui_dest[0] = Utilities::byteswap_unsigned_int( ui_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ui_dest[k] = Utilities::byteswap_unsigned_int( ui_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( ui_dest, ui_src, length );
             }
             break;
          }
@@ -3388,8 +4807,10 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                l_dest[0] = Utilities::byteswap_long( l_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  l_dest[k] = Utilities::byteswap_long( l_src[k] );
+               if ( sizeof( long ) == 8 ) {
+                  Utilities::byteswap_8_byte_array( l_dest, l_src, length );
+               } else {
+                  Utilities::byteswap_4_byte_array( l_dest, l_src, length );
                }
             }
             break;
@@ -3400,8 +4821,10 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                ul_dest[0] = Utilities::byteswap_unsigned_long( ul_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ul_dest[k] = Utilities::byteswap_unsigned_long( ul_src[k] );
+               if ( sizeof( long ) == 8 ) {
+                  Utilities::byteswap_8_byte_array( ul_dest, ul_src, length );
+               } else {
+                  Utilities::byteswap_4_byte_array( ul_dest, ul_src, length );
                }
             }
             break;
@@ -3412,9 +4835,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                ll_dest[0] = Utilities::byteswap_long_long( ll_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ll_dest[k] = Utilities::byteswap_long_long( ll_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( ll_dest, ll_src, length );
             }
             break;
          }
@@ -3424,9 +4845,7 @@ void Attribute::byteswap_buffer_copy( // RETURN: -- None.
             if ( length == 1 ) {
                ull_dest[0] = Utilities::byteswap_unsigned_long_long( ull_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ull_dest[k] = Utilities::byteswap_unsigned_long_long( ull_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( ull_dest, ull_src, length );
             }
             break;
          }
@@ -3479,6 +4898,7 @@ bool Attribute::is_supported_attribute_type() const // RETURN: -- True if suppor
          return ( ( rti_encoding == ENCODING_BIG_ENDIAN )
                   || ( rti_encoding == ENCODING_LITTLE_ENDIAN )
                   || ( rti_encoding == ENCODING_BOOLEAN )
+                  || ( rti_encoding == ENCODING_PACKED_BITS )
                   || ( rti_encoding == ENCODING_UNKNOWN )
                   || ( rti_encoding == ENCODING_NONE ) );
       }
@@ -3489,6 +4909,7 @@ bool Attribute::is_supported_attribute_type() const // RETURN: -- True if suppor
                   || ( rti_encoding == ENCODING_UNKNOWN )
                   || ( rti_encoding == ENCODING_UNICODE_STRING )
                   || ( rti_encoding == ENCODING_OPAQUE_DATA )
+                  || ( rti_encoding == ENCODING_CHUNKED )
                   || ( rti_encoding == ENCODING_NONE ) );
       }
       case TRICK_STRING: {
@@ -3521,6 +4942,8 @@ bool Attribute::is_supported_attribute_type() const // RETURN: -- True if suppor
          return ( ( rti_encoding == ENCODING_BIG_ENDIAN )
                   || ( rti_encoding == ENCODING_LITTLE_ENDIAN )
                   || ( rti_encoding == ENCODING_LOGICAL_TIME )
+                  || ( rti_encoding == ENCODING_DELTA )
+                  || ( rti_encoding == ENCODING_CHUNKED )
                   || ( rti_encoding == ENCODING_UNKNOWN )
                   || ( rti_encoding == ENCODING_NONE ) );
       }
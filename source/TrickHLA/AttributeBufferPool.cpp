@@ -0,0 +1,209 @@
+/*!
+@file TrickHLA/AttributeBufferPool.cpp
+@ingroup TrickHLA
+@brief Shared pool the attribute staging byte buffers are carved from.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AttributeBufferPool.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+#include <cstdint>
+#include <sys/mman.h>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+
+// TrickHLA include files.
+#include "TrickHLA/AttributeBufferPool.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+
+using namespace TrickHLA;
+
+// Declare the static class variables.
+size_t const AttributeBufferPool::SLAB_SIZE            = 65536;
+size_t const AttributeBufferPool::CACHE_LINE_ALIGNMENT = 64;
+size_t const AttributeBufferPool::HUGE_PAGE_SIZE       = 2 * 1024 * 1024;
+
+MutexLock      AttributeBufferPool::pool_mutex;
+unsigned char *AttributeBufferPool::slab        = NULL;
+size_t         AttributeBufferPool::slab_offset = 0;
+size_t         AttributeBufferPool::slab_size   = 0;
+
+size_t         AttributeBufferPool::huge_page_threshold = 0;
+unsigned char *AttributeBufferPool::huge_slab           = NULL;
+size_t         AttributeBufferPool::huge_slab_offset    = 0;
+size_t         AttributeBufferPool::huge_slab_size      = 0;
+
+bool AttributeBufferPool::transient_mode = false;
+
+/*!
+ * @details Assumptions and Limitations:
+ * - The slabs are allocated through the Trick Memory Manager and are never
+ *   freed, so the pooled memory lives for the duration of the federation
+ *   execution.
+ * - Chunks are carved in allocation order, so callers that allocate their
+ *   buffers consecutively get them laid out contiguously.
+ */
+unsigned char *AttributeBufferPool::allocate(
+   size_t const capacity,
+   bool const   checkpointable )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   // Chunks that do not need to be checkpointable are carved from the
+   // anonymous memory mapped slabs when the transient mode is enabled or
+   // the chunk is a huge-page candidate, with a transparent fallback to
+   // the Trick Memory Manager backed slabs when a slab cannot be mapped.
+   if ( !checkpointable && ( transient_mode || is_huge_page_candidate( capacity ) ) ) {
+      unsigned char *chunk = allocate_huge_chunk( capacity );
+      if ( chunk != NULL ) {
+         return chunk;
+      }
+   }
+
+   uintptr_t const align_mask = (uintptr_t)( CACHE_LINE_ALIGNMENT - 1 );
+
+   // Align the carve point so every chunk starts on an absolute cache-line
+   // boundary, the slab base itself is only guaranteed malloc alignment.
+   size_t aligned_offset = 0;
+   if ( slab != NULL ) {
+      uintptr_t const base = reinterpret_cast< uintptr_t >( slab );
+      aligned_offset       = ( ( ( base + slab_offset ) + align_mask ) & ~align_mask ) - base;
+   }
+
+   if ( ( slab == NULL ) || ( ( aligned_offset + capacity ) > slab_size ) ) {
+      // Requests larger than a slab get a dedicated slab, with room to
+      // align the chunk start.
+      size_t const new_slab_size = ( ( capacity + CACHE_LINE_ALIGNMENT ) > SLAB_SIZE )
+                                      ? ( capacity + CACHE_LINE_ALIGNMENT )
+                                      : SLAB_SIZE;
+
+      unsigned char *new_slab = static_cast< unsigned char * >(
+         TMM_declare_var_1d( "unsigned char", new_slab_size ) );
+      if ( new_slab == NULL ) {
+         return NULL;
+      }
+
+      slab      = new_slab;
+      slab_size = new_slab_size;
+
+      uintptr_t const base = reinterpret_cast< uintptr_t >( slab );
+      aligned_offset       = ( ( base + align_mask ) & ~align_mask ) - base;
+   }
+
+   unsigned char *chunk = slab + aligned_offset;
+   slab_offset          = aligned_offset + capacity;
+   return chunk;
+}
+
+void AttributeBufferPool::set_huge_page_threshold(
+   size_t const threshold )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   huge_page_threshold = threshold;
+}
+
+bool AttributeBufferPool::is_huge_page_candidate(
+   size_t const capacity )
+{
+   return ( huge_page_threshold > 0 ) && ( capacity >= huge_page_threshold );
+}
+
+void AttributeBufferPool::set_transient_mode(
+   bool const enable )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   transient_mode = enable;
+}
+
+bool AttributeBufferPool::is_transient_mode()
+{
+   return transient_mode;
+}
+
+/*!
+ * @details Assumptions and Limitations:
+ * - The caller must hold the pool mutex.
+ * - The huge-page slabs are anonymous memory mappings outside the Trick
+ *   Memory Manager, are never part of a Trick checkpoint, and are never
+ *   unmapped, so the memory lives for the duration of the federation
+ *   execution.
+ * - When the kernel has no pre-allocated huge page pool, a normally mapped
+ *   slab advised as transparent-huge-page eligible is used instead, so the
+ *   allocation still succeeds without a configured hugetlb pool.
+ */
+unsigned char *AttributeBufferPool::allocate_huge_chunk(
+   size_t const capacity )
+{
+   uintptr_t const align_mask = (uintptr_t)( CACHE_LINE_ALIGNMENT - 1 );
+
+   // Align the carve point so every chunk starts on an absolute cache-line
+   // boundary, the slab base itself is page aligned by mmap.
+   size_t aligned_offset = 0;
+   if ( huge_slab != NULL ) {
+      uintptr_t const base = reinterpret_cast< uintptr_t >( huge_slab );
+      aligned_offset       = ( ( ( base + huge_slab_offset ) + align_mask ) & ~align_mask ) - base;
+   }
+
+   if ( ( huge_slab == NULL ) || ( ( aligned_offset + capacity ) > huge_slab_size ) ) {
+      // Size the new slab as a whole multiple of the huge page size.
+      size_t const new_slab_size = ( ( capacity + HUGE_PAGE_SIZE - 1 ) / HUGE_PAGE_SIZE )
+                                   * HUGE_PAGE_SIZE;
+
+      // Map the slab with explicit huge pages from the kernel hugetlb pool.
+      void *mem = mmap( NULL, new_slab_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+      if ( mem == MAP_FAILED ) {
+         // No hugetlb pool is configured, fall back to a normally mapped
+         // slab that is huge-page aligned and sized so the kernel can back
+         // it with transparent huge pages.
+         mem = mmap( NULL, new_slab_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+         if ( mem == MAP_FAILED ) {
+            return NULL;
+         }
+#ifdef MADV_HUGEPAGE
+         madvise( mem, new_slab_size, MADV_HUGEPAGE );
+#endif
+      }
+
+      huge_slab        = static_cast< unsigned char * >( mem );
+      huge_slab_size   = new_slab_size;
+      huge_slab_offset = 0;
+      aligned_offset   = 0;
+   }
+
+   unsigned char *chunk = huge_slab + aligned_offset;
+   huge_slab_offset     = aligned_offset + capacity;
+   return chunk;
+}
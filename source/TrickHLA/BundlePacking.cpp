@@ -0,0 +1,335 @@
+/*!
+@file TrickHLA/BundlePacking.cpp
+@ingroup TrickHLA
+@brief Packing handler that bundles the cyclic data of several TrickHLA
+objects into a single carrier object update.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{BundlePacking.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{Packing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/BundlePacking.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Bundle layout, all fields in the byte order of the attribute encoding
+// agreed to by the bundled object attributes: a 32-bit object count followed
+// by one record per bundled object. Each record is the length prefixed
+// object instance name, a 32-bit attribute count, and for each attribute the
+// length prefixed attribute FOM name and the length prefixed encoded
+// attribute value.
+
+/*! @brief Append a length prefixed string to the bundle staging buffer.
+ *  @param staging Bundle staging buffer.
+ *  @param text    String to append, NULL is treated as an empty string. */
+void append_bundle_string(
+   vector< unsigned char > &staging,
+   char const              *text )
+{
+   uint16_t const length = ( text != NULL ) ? (uint16_t)strlen( text ) : 0;
+   size_t const   pos    = staging.size();
+   staging.resize( pos + sizeof( length ) + length );
+   memcpy( &staging[pos], &length, sizeof( length ) );
+   if ( length > 0 ) {
+      memcpy( &staging[pos + sizeof( length )], text, length );
+   }
+}
+
+/*! @brief Read a length prefixed string from a bundle buffer.
+ *  @return True if the string was read, false if the bundle is truncated.
+ *  @param input Current bundle position, advanced past the string.
+ *  @param end   End of the bundle.
+ *  @param text  Returned string value. */
+bool parse_bundle_string(
+   unsigned char const *&input,
+   unsigned char const  *end,
+   string               &text )
+{
+   uint16_t length;
+   if ( (size_t)( end - input ) < sizeof( length ) ) {
+      return false;
+   }
+   memcpy( &length, input, sizeof( length ) );
+   input += sizeof( length );
+   if ( (size_t)( end - input ) < length ) {
+      return false;
+   }
+   text.assign( reinterpret_cast< char const * >( input ), length );
+   input += length;
+   return true;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+BundlePacking::BundlePacking()
+   : bundle_buffer( NULL ),
+     bundle_objects(),
+     staging()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+BundlePacking::~BundlePacking()
+{
+   if ( bundle_buffer != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( bundle_buffer ) ) ) {
+         send_hs( stderr, "BundlePacking::~BundlePacking():%d WARNING failed to delete Trick Memory for 'bundle_buffer'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      bundle_buffer = NULL;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BundlePacking::add_object(
+   Object *obj )
+{
+   if ( obj != NULL ) {
+      bundle_objects.push_back( obj );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void BundlePacking::initialize()
+{
+   if ( bundle_objects.empty() ) {
+      ostringstream errmsg;
+      errmsg << "BundlePacking::initialize():" << __LINE__
+             << " ERROR: No objects have been added to this bundle. Use"
+             << " add_object() in the input file to add the TrickHLA objects"
+             << " to bundle into the carrier object." << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // The carrier object must not bundle itself.
+   for ( size_t n = 0; n < bundle_objects.size(); ++n ) {
+      if ( bundle_objects[n] == this->object ) {
+         ostringstream errmsg;
+         errmsg << "BundlePacking::initialize():" << __LINE__
+                << " ERROR: The carrier object '"
+                << ( ( this->object != NULL ) ? this->object->get_name() : "" )
+                << "' must not be added to its own bundle." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   // Make sure the bundle buffer is a Trick allocation so the dynamic array
+   // carrier attribute can be resized as the bundle size changes.
+   if ( bundle_buffer == NULL ) {
+      bundle_buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", 1 ) );
+   }
+
+   Packing::initialize();
+}
+
+/*!
+ * @details Called before the carrier object attribute values are buffered
+ * for sending, so the serialized bundle it produces is what goes out in the
+ * carrier object update.
+ * @job_class{scheduled}
+ */
+void BundlePacking::pack()
+{
+   staging.clear();
+
+   // Bundled object count.
+   uint32_t const object_count = (uint32_t)bundle_objects.size();
+   size_t         pos          = staging.size();
+   staging.resize( pos + sizeof( object_count ) );
+   memcpy( &staging[pos], &object_count, sizeof( object_count ) );
+
+   for ( size_t n = 0; n < bundle_objects.size(); ++n ) {
+      Object *obj = bundle_objects[n];
+
+      // Run the bundled object send-side data path just like the manager
+      // would if the object was sending its own update.
+      if ( ( obj->packing != NULL ) && ( obj->packing != this ) ) {
+         obj->packing->pack();
+      }
+      obj->pack_cyclic_attribute_buffers();
+
+      append_bundle_string( staging, obj->get_name() );
+
+      // Leave a placeholder for the attribute count, which is filled in
+      // once we know how many cyclic attributes this object has.
+      uint32_t     attr_count     = 0;
+      size_t const attr_count_pos = staging.size();
+      staging.resize( attr_count_pos + sizeof( attr_count ) );
+
+      Attribute *attrs = obj->get_attributes();
+      for ( int i = 0; i < obj->get_attribute_count(); ++i ) {
+         if ( ( attrs[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) {
+
+            append_bundle_string( staging, attrs[i].get_FOM_name() );
+
+            // The encoded attribute value, using the same encoding the
+            // attribute would have on the wire in its own update.
+            VariableLengthData const value      = attrs[i].get_attribute_value();
+            uint32_t const           value_size = (uint32_t)value.size();
+
+            pos = staging.size();
+            staging.resize( pos + sizeof( value_size ) + value_size );
+            memcpy( &staging[pos], &value_size, sizeof( value_size ) );
+            if ( value_size > 0 ) {
+               memcpy( &staging[pos + sizeof( value_size )], value.data(), value_size );
+            }
+            ++attr_count;
+         }
+      }
+      memcpy( &staging[attr_count_pos], &attr_count, sizeof( attr_count ) );
+   }
+
+   // Size the carrier attribute variable to the serialized bundle and copy
+   // the bundle into it.
+   if ( (size_t)get_size( bundle_buffer ) != staging.size() ) {
+      bundle_buffer = static_cast< unsigned char * >(
+         TMM_resize_array_1d_a( bundle_buffer, (int)staging.size() ) );
+   }
+   memcpy( bundle_buffer, &staging[0], staging.size() );
+}
+
+/*!
+ * @details Called after the carrier object attribute values have been
+ * unpacked into the bundle buffer, so the received bundle is demuxed back
+ * into the bundled objects.
+ * @job_class{scheduled}
+ */
+void BundlePacking::unpack()
+{
+   int const total_size = get_size( bundle_buffer );
+   if ( ( bundle_buffer == NULL ) || ( total_size < (int)sizeof( uint32_t ) ) ) {
+      return;
+   }
+
+   unsigned char const *input = bundle_buffer;
+   unsigned char const *end   = bundle_buffer + total_size;
+
+   uint32_t object_count;
+   memcpy( &object_count, input, sizeof( object_count ) );
+   input += sizeof( object_count );
+
+   string object_name;
+   string attr_FOM_name;
+
+   for ( uint32_t n = 0; n < object_count; ++n ) {
+
+      if ( !parse_bundle_string( input, end, object_name ) ) {
+         break; // Truncated bundle.
+      }
+      uint32_t attr_count;
+      if ( (size_t)( end - input ) < sizeof( attr_count ) ) {
+         break;
+      }
+      memcpy( &attr_count, input, sizeof( attr_count ) );
+      input += sizeof( attr_count );
+
+      // Match the bundled object by instance name.
+      Object *obj = NULL;
+      for ( size_t k = 0; k < bundle_objects.size(); ++k ) {
+         if ( ( bundle_objects[k]->get_name() != NULL )
+              && ( object_name == bundle_objects[k]->get_name() ) ) {
+            obj = bundle_objects[k];
+            break;
+         }
+      }
+      if ( ( obj == NULL ) && DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_PACKING ) ) {
+         send_hs( stderr, "BundlePacking::unpack():%d Received bundle record for unknown object '%s', skipping.%c",
+                  __LINE__, object_name.c_str(), THLA_NEWLINE );
+      }
+
+      bool any_extracted = false;
+
+      for ( uint32_t i = 0; i < attr_count; ++i ) {
+         if ( !parse_bundle_string( input, end, attr_FOM_name ) ) {
+            input = end; // Truncated bundle, stop the demux.
+            break;
+         }
+         uint32_t value_size;
+         if ( (size_t)( end - input ) < sizeof( value_size ) ) {
+            input = end;
+            break;
+         }
+         memcpy( &value_size, input, sizeof( value_size ) );
+         input += sizeof( value_size );
+         if ( (size_t)( end - input ) < value_size ) {
+            input = end;
+            break;
+         }
+
+         if ( obj != NULL ) {
+            Attribute *attr = obj->get_attribute( attr_FOM_name );
+            if ( attr != NULL ) {
+               // Decode the value just like a reflection of the bundled
+               // object, referencing the bundle bytes directly.
+               VariableLengthData value;
+               value.setDataPointer( const_cast< unsigned char * >( input ), value_size );
+               if ( attr->extract_data( &value ) ) {
+                  any_extracted = true;
+               }
+            }
+         }
+         input += value_size;
+      }
+
+      // Run the bundled object receive-side data path just like the manager
+      // would if the object had received its own update.
+      if ( any_extracted ) {
+         obj->unpack_cyclic_attribute_buffers();
+         if ( ( obj->packing != NULL ) && ( obj->packing != this ) ) {
+            obj->packing->unpack();
+         }
+      }
+   }
+}
@@ -29,6 +29,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{Timeline.cpp}
 @trick_link_dependency{CTETimelineBase.cpp}
+@trick_link_dependency{TscClock.cpp}
 
 @revs_title
 @revs_begin
@@ -39,23 +40,66 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <fcntl.h>
 #include <time.h>
+#include <unistd.h>
 
 // Trick include files.
 #include "trick/Clock.hh"
+#include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/CTETimelineBase.hh"
+#include "TrickHLA/TscClock.hh"
 
 using namespace Trick;
 using namespace TrickHLA;
 
+// Define the static class constants.
+clockid_t const CTETimelineBase::CLOCK_ID_TSC;
+clockid_t const CTETimelineBase::CLOCK_ID_PHC;
+
+// Convert an open PTP Hardware Clock device descriptor into the dynamic
+// posix clock ID understood by clock_gettime. This is how the Linux kernel
+// encodes dynamic clocks; the macro is not exported by the uapi headers.
+#ifndef FD_TO_CLOCKID
+#   define FD_TO_CLOCKID( fd ) ( ( ~(clockid_t)( fd ) << 3 ) | 3 )
+#endif
+
+namespace
+{
+
+// Refresh the cached PHC offset sample when it is older than this. The
+// system oscillator can drift on the order of tens of ppm against the
+// PTP-disciplined hardware clock, and the rate correction leaves only the
+// drift-rate change over one interval as the extrapolation error, which
+// keeps the cached reads well under a microsecond of the device reads.
+long long const PHC_OFFSET_REFRESH_NANOS = 250000000LL; // 250 milliseconds.
+
+/*! @brief Get the current CLOCK_MONOTONIC_RAW time.
+ *  @return Time as a count of nanoseconds. */
+long long monotonic_raw_nanoseconds()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC_RAW, &ts );
+   return ( (long long)ts.tv_sec * 1000000000LL ) + (long long)ts.tv_nsec;
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 CTETimelineBase::CTETimelineBase()
    : Clock( 1000000, "GetTimeOfDay - CLOCK_REALTIME" ),
-     clk_id( CLOCK_REALTIME )
+     clk_id( CLOCK_REALTIME ),
+     phc_device( "/dev/ptp0" ),
+     phc_fd( -1 ),
+     phc_clk_id( CLOCK_REALTIME ),
+     phc_sample_phc( 0 ),
+     phc_sample_mono( 0 ),
+     phc_rate( 1.0 )
 {
    return;
 }
@@ -65,7 +109,10 @@ CTETimelineBase::CTETimelineBase()
  */
 CTETimelineBase::~CTETimelineBase()
 {
-   return;
+   if ( phc_fd >= 0 ) {
+      close( phc_fd );
+      phc_fd = -1;
+   }
 }
 
 /*!
@@ -82,6 +129,12 @@ int CTETimelineBase::clock_init()
  */
 double CTETimelineBase::get_time()
 {
+   if ( clk_id == CLOCK_ID_TSC ) {
+      return TscClock::realtime_in_seconds();
+   }
+   if ( clk_id == CLOCK_ID_PHC ) {
+      return (double)PHC_time_in_nanoseconds() * 0.000000001;
+   }
    struct timespec ts;
    clock_gettime( CLOCK_REALTIME, &ts );
    return ( (double)ts.tv_sec + ( (double)ts.tv_nsec * 0.000000001 ) );
@@ -101,6 +154,12 @@ double const CTETimelineBase::get_min_resolution()
  */
 long long CTETimelineBase::wall_clock_time()
 {
+   if ( clk_id == CLOCK_ID_TSC ) {
+      return (long long)TscClock::realtime_in_microseconds();
+   }
+   if ( clk_id == CLOCK_ID_PHC ) {
+      return PHC_time_in_nanoseconds() / 1000LL;
+   }
    struct timespec tp;
    clock_gettime( clk_id, &tp );
    return (long long)tp.tv_sec * 1000000LL + (long long)( ( tp.tv_nsec ) / 1000 );
@@ -119,15 +178,45 @@ void CTETimelineBase::set_clock_ID( clockid_t const id )
    switch ( id ) {
       case CLOCK_REALTIME:
          name = "GetTimeOfDay - CLOCK_REALTIME";
+         this->clk_id = id;
          break;
       case CLOCK_MONOTONIC:
          name = "GetTimeOfDay - CLOCK_MONOTONIC";
+         this->clk_id = id;
          break;
       case CLOCK_MONOTONIC_RAW:
          name = "GetTimeOfDay - CLOCK_MONOTONIC_RAW";
+         this->clk_id = id;
+         break;
+      case CLOCK_ID_TSC:
+         // Calibrate the invariant TSC clock source, and fall back to
+         // CLOCK_MONOTONIC if this hardware does not support it.
+         if ( TscClock::initialize() ) {
+            name = "TscClock - calibrated invariant TSC";
+            this->clk_id = id;
+         } else {
+            send_hs( stderr, "CTETimelineBase::set_clock_ID():%d WARNING: No invariant TSC support on this hardware, falling back to CLOCK_MONOTONIC.%c",
+                     __LINE__, THLA_NEWLINE );
+            name = "GetTimeOfDay - CLOCK_MONOTONIC";
+            this->clk_id = CLOCK_MONOTONIC;
+         }
+         break;
+      case CLOCK_ID_PHC:
+         // Open the PTP Hardware Clock device, and fall back to
+         // CLOCK_REALTIME if the device is not usable.
+         if ( initialize_PHC() ) {
+            name = "PtpHwClock - PTP hardware clock";
+            this->clk_id = id;
+         } else {
+            send_hs( stderr, "CTETimelineBase::set_clock_ID():%d WARNING: Could not open PTP hardware clock device '%s', falling back to CLOCK_REALTIME.%c",
+                     __LINE__, ( ( phc_device != NULL ) ? phc_device : "NULL" ), THLA_NEWLINE );
+            name = "GetTimeOfDay - CLOCK_REALTIME";
+            this->clk_id = CLOCK_REALTIME;
+         }
          break;
       default:
          name = "GetTimeOfDay - other";
+         this->clk_id = id;
          break;
    }
 }
@@ -136,3 +225,122 @@ clockid_t CTETimelineBase::get_clock_ID()
 {
    return clk_id;
 }
+
+void CTETimelineBase::set_PHC_device(
+   char const *device )
+{
+   this->phc_device = device;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+bool CTETimelineBase::initialize_PHC()
+{
+   if ( phc_device == NULL ) {
+      return false;
+   }
+
+   // Reopen the device in case the device path changed.
+   if ( phc_fd >= 0 ) {
+      close( phc_fd );
+      phc_fd = -1;
+   }
+   phc_fd = open( phc_device, O_RDONLY );
+   if ( phc_fd < 0 ) {
+      return false;
+   }
+   phc_clk_id = FD_TO_CLOCKID( phc_fd );
+
+   // Verify the dynamic clock is readable before committing to it.
+   struct timespec ts;
+   if ( clock_gettime( phc_clk_id, &ts ) != 0 ) {
+      close( phc_fd );
+      phc_fd = -1;
+      return false;
+   }
+
+   // Take the initial offset sample with a unity rate, then resample so
+   // the first queries already use a measured rate.
+   this->phc_rate        = 1.0;
+   this->phc_sample_mono = 0;
+   this->phc_sample_phc  = 0;
+   refresh_PHC_offset();
+
+   return true;
+}
+
+/*!
+ * @details Sample the PHC against CLOCK_MONOTONIC_RAW with a bracketed
+ * read, taking the attempt with the smallest bracket so scheduling
+ * preemption between the reads does not skew the offset. The rate of the
+ * PHC against the free-running system oscillator is measured from the
+ * previous sample so the cached queries extrapolate with the local drift
+ * corrected.
+ */
+void CTETimelineBase::refresh_PHC_offset()
+{
+   long long best_mid     = 0;
+   long long best_phc     = 0;
+   long long best_bracket = -1;
+
+   for ( int attempt = 0; attempt < 3; ++attempt ) {
+      long long const mono_before = monotonic_raw_nanoseconds();
+
+      struct timespec ts;
+      if ( clock_gettime( phc_clk_id, &ts ) != 0 ) {
+         // Keep extrapolating from the previous sample if the device
+         // read fails (e.g. the NIC went away). The sample times are
+         // refreshed below so the failed read is retried only once per
+         // refresh interval instead of on every query.
+         break;
+      }
+      long long const phc_now    = ( (long long)ts.tv_sec * 1000000000LL ) + (long long)ts.tv_nsec;
+      long long const mono_after = monotonic_raw_nanoseconds();
+
+      long long const bracket = mono_after - mono_before;
+      if ( ( best_bracket < 0 ) || ( bracket < best_bracket ) ) {
+         best_bracket = bracket;
+         best_mid     = mono_before + ( bracket / 2 );
+         best_phc     = phc_now;
+      }
+   }
+
+   if ( best_bracket < 0 ) {
+      // All the device reads failed, advance the sample times using the
+      // current rate so the extrapolation continues seamlessly.
+      long long const mono_now = monotonic_raw_nanoseconds();
+      this->phc_sample_phc += (long long)( (double)( mono_now - phc_sample_mono ) * phc_rate );
+      this->phc_sample_mono = mono_now;
+      return;
+   }
+
+   // Measure the PHC rate against the system oscillator from the previous
+   // sample. Skip the rate update for the very first sample or for a
+   // degenerate interval.
+   if ( ( phc_sample_mono > 0 ) && ( best_mid > phc_sample_mono ) ) {
+      double const rate = (double)( best_phc - phc_sample_phc )
+                          / (double)( best_mid - phc_sample_mono );
+      // Guard against a bogus measurement (e.g. a PHC step from the PTP
+      // servo); oscillator drift is at most a few hundred ppm.
+      if ( ( rate > 0.999 ) && ( rate < 1.001 ) ) {
+         this->phc_rate = rate;
+      }
+   }
+
+   this->phc_sample_phc  = best_phc;
+   this->phc_sample_mono = best_mid;
+}
+
+long long CTETimelineBase::PHC_time_in_nanoseconds()
+{
+   long long mono_now = monotonic_raw_nanoseconds();
+
+   // Resample the device when the cached offset has gone stale.
+   if ( ( mono_now - phc_sample_mono ) > PHC_OFFSET_REFRESH_NANOS ) {
+      refresh_PHC_offset();
+      mono_now = monotonic_raw_nanoseconds();
+   }
+
+   return phc_sample_phc + (long long)( (double)( mono_now - phc_sample_mono ) * phc_rate );
+}
@@ -0,0 +1,194 @@
+/*!
+@file TrickHLA/ConditionalBatch.cpp
+@ingroup TrickHLA
+@brief A batched Conditional that evaluates all of an object's attribute
+change thresholds in one sweep.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Conditional.cpp}
+@trick_link_dependency{ConditionalBatch.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+// TrickHLA include files.
+#include "TrickHLA/ConditionalBatch.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+ConditionalBatch::ConditionalBatch()
+   : Conditional(),
+     thresholds(),
+     byte_regions(),
+     prev_values(),
+     prev_bytes()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ConditionalBatch::~ConditionalBatch()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ConditionalBatch::register_threshold(
+   Attribute    *attr,
+   double const *address,
+   int const     count,
+   double const  epsilon )
+{
+   if ( ( address == NULL ) || ( count <= 0 ) || ( epsilon < 0.0 ) ) {
+      ostringstream errmsg;
+      errmsg << "ConditionalBatch::register_threshold():" << __LINE__
+             << " ERROR: Invalid threshold descriptor, the address must be"
+             << " non-NULL, the count positive and the epsilon non-negative!"
+             << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   Threshold threshold;
+   threshold.attr        = attr;
+   threshold.address     = address;
+   threshold.count       = count;
+   threshold.epsilon     = epsilon;
+   threshold.prev_offset = prev_values.size();
+
+   // Seed the previous values from the current values and mark the
+   // attribute as changed so the first evaluation sends it.
+   threshold.changed = true;
+   prev_values.insert( prev_values.end(), address, address + count );
+
+   thresholds.push_back( threshold );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ConditionalBatch::register_change_detect(
+   Attribute   *attr,
+   void const  *address,
+   size_t const size )
+{
+   if ( ( address == NULL ) || ( size == 0 ) ) {
+      ostringstream errmsg;
+      errmsg << "ConditionalBatch::register_change_detect():" << __LINE__
+             << " ERROR: Invalid change detection region, the address must"
+             << " be non-NULL and the size positive!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   ByteRegion region;
+   region.attr        = attr;
+   region.address     = static_cast< unsigned char const * >( address );
+   region.size        = size;
+   region.prev_offset = prev_bytes.size();
+
+   // Seed the previous bytes from the current data and mark the attribute
+   // as changed so the first evaluation sends it.
+   region.changed = true;
+   prev_bytes.insert( prev_bytes.end(), region.address, region.address + size );
+
+   byte_regions.push_back( region );
+}
+
+/*!
+ * @details One sweep over the flat previous-value storage. The inner
+ * comparison loop is branch free over the elements of a threshold so the
+ * compiler can vectorize it, and the previous values are only written back
+ * for a threshold that actually changed.
+ * @job_class{scheduled}
+ */
+void ConditionalBatch::evaluate()
+{
+   for ( unsigned int i = 0; i < thresholds.size(); ++i ) {
+      Threshold    &threshold = thresholds[i];
+      double const *current   = threshold.address;
+      double       *previous  = &prev_values[threshold.prev_offset];
+
+      bool changed = false;
+      for ( int j = 0; j < threshold.count; ++j ) {
+         changed |= ( fabs( current[j] - previous[j] ) > threshold.epsilon );
+      }
+
+      if ( changed ) {
+         memcpy( previous, current, threshold.count * sizeof( double ) );
+      }
+      threshold.changed = changed;
+   }
+
+   for ( unsigned int i = 0; i < byte_regions.size(); ++i ) {
+      ByteRegion    &region   = byte_regions[i];
+      unsigned char *previous = &prev_bytes[region.prev_offset];
+
+      bool const changed = ( memcmp( region.address, previous, region.size ) != 0 );
+      if ( changed ) {
+         memcpy( previous, region.address, region.size );
+      }
+      region.changed = changed;
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool ConditionalBatch::should_send(
+   Attribute *attr )
+{
+   bool registered = false;
+
+   // Any changed threshold or byte region registered for this attribute
+   // marks it to send. An attribute with no registered descriptor defaults
+   // to true, matching the base Conditional behavior.
+   for ( unsigned int i = 0; i < thresholds.size(); ++i ) {
+      if ( thresholds[i].attr == attr ) {
+         if ( thresholds[i].changed ) {
+            return true;
+         }
+         registered = true;
+      }
+   }
+   for ( unsigned int i = 0; i < byte_regions.size(); ++i ) {
+      if ( byte_regions[i].attr == attr ) {
+         if ( byte_regions[i].changed ) {
+            return true;
+         }
+         registered = true;
+      }
+   }
+   return !registered;
+}
@@ -28,7 +28,11 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <pthread.h>
 #include <string>
 
 // Trick include files.
@@ -45,6 +49,115 @@ using namespace TrickHLA;
 // Initialize the DebugHandler level and code section values.
 DebugLevelEnum  DebugHandler::debug_level  = DEBUG_LEVEL_NO_TRACE;
 DebugSourceEnum DebugHandler::code_section = DEBUG_SOURCE_ALL_MODULES;
+bool            DebugHandler::async_logging = false;
+
+namespace
+{
+
+// Bounded multi-producer single-consumer debug message ring drained by the
+// background logger thread. Each slot carries a sequence number so the
+// producers stay wait-free: a producer claims a slot with one atomic
+// fetch-add, copies the formatted message in and releases the slot to the
+// consumer by advancing the sequence number.
+size_t const ASYNC_LOG_RING_SIZE = 256; // Must be a power of two.
+size_t const ASYNC_LOG_TEXT_SIZE = 480; // Longer messages are truncated.
+
+struct AsyncLogSlot {
+   std::atomic< unsigned long > sequence; ///< Slot state sequence number.
+   char                         text[ASYNC_LOG_TEXT_SIZE]; ///< Captured message text.
+};
+
+AsyncLogSlot                 async_log_ring[ASYNC_LOG_RING_SIZE];
+std::atomic< unsigned long > async_log_enqueue_pos( 0 );
+unsigned long                async_log_dequeue_pos = 0; // Logger thread only.
+std::atomic< unsigned long > async_log_dropped_cnt( 0 );
+unsigned long                async_log_dropped_reported = 0; // Logger thread only.
+
+pthread_once_t  async_log_once     = PTHREAD_ONCE_INIT;
+pthread_t       async_log_thread;
+pthread_mutex_t async_log_mutex    = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t  async_log_cond     = PTHREAD_COND_INITIALIZER;
+bool            async_log_running  = false;
+bool            async_log_shutdown = false;
+
+/*! @brief Publish one queued message if available.
+ *  @return True if a message was published. */
+bool async_log_publish_next()
+{
+   AsyncLogSlot &slot = async_log_ring[async_log_dequeue_pos & ( ASYNC_LOG_RING_SIZE - 1 )];
+
+   unsigned long const seq = slot.sequence.load( std::memory_order_acquire );
+   if ( (long)seq - (long)( async_log_dequeue_pos + 1 ) != 0 ) {
+      return false; // The next slot has not been released by a producer yet.
+   }
+
+   send_hs( stdout, slot.text );
+
+   // Release the slot for reuse one lap later.
+   slot.sequence.store( async_log_dequeue_pos + ASYNC_LOG_RING_SIZE,
+                        std::memory_order_release );
+   ++async_log_dequeue_pos;
+   return true;
+}
+
+/*! @brief Background logger thread loop draining the message ring.
+ *  @return Always NULL.
+ *  @param arg Unused. */
+void *async_log_thread_loop(
+   void *arg )
+{
+   while ( true ) {
+
+      // Drain everything currently in the ring.
+      while ( async_log_publish_next() ) {
+         // Keep draining.
+      }
+
+      // Report messages dropped while the ring was full.
+      unsigned long const dropped = async_log_dropped_cnt.load( std::memory_order_relaxed );
+      if ( dropped != async_log_dropped_reported ) {
+         send_hs( stderr, "DebugHandler::print():%d Warning: Dropped %lu debug messages, the async logging ring was full.",
+                  __LINE__, (unsigned long)( dropped - async_log_dropped_reported ) );
+         async_log_dropped_reported = dropped;
+      }
+
+      // Sleep briefly waiting for more messages. The producers never touch
+      // the mutex or condition variable so the hot path stays wait-free.
+      pthread_mutex_lock( &async_log_mutex );
+      if ( async_log_shutdown ) {
+         pthread_mutex_unlock( &async_log_mutex );
+         break;
+      }
+      struct timespec deadline;
+      clock_gettime( CLOCK_REALTIME, &deadline );
+      deadline.tv_nsec += 2000000L; // 2 milliseconds.
+      if ( deadline.tv_nsec >= 1000000000L ) {
+         deadline.tv_nsec -= 1000000000L;
+         deadline.tv_sec += 1;
+      }
+      pthread_cond_timedwait( &async_log_cond, &async_log_mutex, &deadline );
+      pthread_mutex_unlock( &async_log_mutex );
+   }
+
+   // Final drain so queued messages are not lost on shutdown.
+   while ( async_log_publish_next() ) {
+      // Keep draining.
+   }
+   return NULL;
+}
+
+/*! @brief One time initialization of the ring and the logger thread. */
+void async_log_initialize()
+{
+   for ( size_t i = 0; i < ASYNC_LOG_RING_SIZE; ++i ) {
+      async_log_ring[i].sequence.store( (unsigned long)i, std::memory_order_relaxed );
+   }
+   if ( pthread_create( &async_log_thread, NULL, async_log_thread_loop, NULL ) == 0 ) {
+      async_log_running = true;
+   }
+}
+
+} // namespace
 
 /*!
  * @job_class{initialization}
@@ -62,13 +175,6 @@ DebugHandler::~DebugHandler() // RETURN: -- None.
    return;
 }
 
-bool const DebugHandler::show(
-   DebugLevelEnum const  level,
-   DebugSourceEnum const code )
-{
-   return ( ( debug_level >= level ) && ( ( code_section & code ) != 0 ) );
-}
-
 void DebugHandler::set(
    DebugLevelEnum const  level,
    DebugSourceEnum const code )
@@ -89,9 +195,74 @@ void DebugHandler::set(
    }
 }
 
+void DebugHandler::print(
+   string const &message )
+{
+   // Publish directly when async logging is off or has been shut down.
+   if ( !async_logging || async_log_shutdown ) {
+      send_hs( stdout, message.c_str() );
+      return;
+   }
+
+   // Create the ring and the background logger thread on first use.
+   pthread_once( &async_log_once, async_log_initialize );
+   if ( !async_log_running ) {
+      send_hs( stdout, message.c_str() );
+      return;
+   }
+
+   // Claim the next ring slot. Drop the message instead of blocking the
+   // calling thread when the logger has fallen a full ring lap behind.
+   unsigned long pos = async_log_enqueue_pos.load( std::memory_order_relaxed );
+   AsyncLogSlot *slot;
+   while ( true ) {
+      slot = &async_log_ring[pos & ( ASYNC_LOG_RING_SIZE - 1 )];
+
+      unsigned long const seq = slot->sequence.load( std::memory_order_acquire );
+      long const          dif = (long)seq - (long)pos;
+      if ( dif == 0 ) {
+         if ( async_log_enqueue_pos.compare_exchange_weak( pos, pos + 1,
+                                                           std::memory_order_relaxed ) ) {
+            break;
+         }
+      } else if ( dif < 0 ) {
+         async_log_dropped_cnt.fetch_add( 1, std::memory_order_relaxed );
+         return;
+      } else {
+         pos = async_log_enqueue_pos.load( std::memory_order_relaxed );
+      }
+   }
+
+   // Capture the message into the claimed slot, truncating if needed, and
+   // release the slot to the logger thread.
+   size_t const length = ( message.length() < ( ASYNC_LOG_TEXT_SIZE - 1 ) )
+                            ? message.length()
+                            : ( ASYNC_LOG_TEXT_SIZE - 1 );
+   memcpy( slot->text, message.data(), length );
+   slot->text[length] = '\0';
+   slot->sequence.store( pos + 1, std::memory_order_release );
+}
+
+void DebugHandler::shutdown_async_logging()
+{
+   if ( !async_log_running ) {
+      return;
+   }
+   pthread_mutex_lock( &async_log_mutex );
+   async_log_shutdown = true;
+   pthread_cond_signal( &async_log_cond );
+   pthread_mutex_unlock( &async_log_mutex );
+
+   pthread_join( async_log_thread, NULL );
+   async_log_running = false;
+}
+
 void DebugHandler::terminate_with_message(
    string const &message )
 {
+   // Make sure any queued debug messages are published before terminating.
+   shutdown_async_logging();
+
    send_hs( stderr, message.c_str() );
    exec_terminate( __FILE__, message.c_str() );
    exit( 1 );
@@ -2,7 +2,9 @@
 @file TrickHLA/ElapsedTimeStats.cpp
 @ingroup TrickHLA
 @brief This class gathers statistics on the elapsed time between calls to the
-measure function.
+measure function or on directly sampled durations, including an HDR style
+histogram for percentile extraction and a ring of the recent worst-case
+samples.
 
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
@@ -40,6 +42,10 @@ NASA, Johnson Space Center\n
 using namespace std;
 using namespace TrickHLA;
 
+// Out of class definitions for the in class initialized static constants.
+int const ElapsedTimeStats::HISTOGRAM_BUCKET_CNT;
+int const ElapsedTimeStats::WORST_SAMPLE_RING_SIZE;
+
 /*!
  * @job_class{initialization}
  */
@@ -51,9 +57,18 @@ ElapsedTimeStats::ElapsedTimeStats()
      min( 0.0 ),
      max( 0.0 ),
      time_sum( 0.0 ),
-     time_squared_sum( 0.0 )
+     time_squared_sum( 0.0 ),
+     worst_sample_index( 0 ),
+     worst_sample_count( 0 ),
+     worst_sample_threshold( 0.0 )
 {
-   return;
+   for ( int b = 0; b < HISTOGRAM_BUCKET_CNT; ++b ) {
+      histogram[b] = 0;
+   }
+   for ( int i = 0; i < WORST_SAMPLE_RING_SIZE; ++i ) {
+      worst_sample_time[i]      = 0.0;
+      worst_sample_timestamp[i] = 0;
+   }
 }
 
 /*!
@@ -73,22 +88,163 @@ void ElapsedTimeStats::measure()
    if ( first_pass ) {
       first_pass = false;
    } else {
-      elapsed_time = ( time - prev_time ) * 0.001; // milliseconds
-      if ( count == 0 ) {
-         max = elapsed_time; // milliseconds
-         min = elapsed_time; // milliseconds
-      } else {
-         if ( elapsed_time > max ) {
-            max = elapsed_time;
-         } else if ( elapsed_time < min ) {
-            min = elapsed_time;
+      sample( ( time - prev_time ) * 0.001 ); // milliseconds
+   }
+   prev_time = time;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ElapsedTimeStats::sample(
+   double const time_ms )
+{
+   elapsed_time = time_ms; // milliseconds
+
+   bool is_new_max = false;
+   if ( count == 0 ) {
+      max        = time_ms; // milliseconds
+      min        = time_ms; // milliseconds
+      is_new_max = true;
+   } else if ( time_ms > max ) {
+      max        = time_ms;
+      is_new_max = true;
+   } else if ( time_ms < min ) {
+      min = time_ms;
+   }
+   time_sum += time_ms;                   // milliseconds
+   time_squared_sum += time_ms * time_ms; // milliseconds^2
+   ++count;
+
+   // Count the sample in the histogram, which has microsecond buckets.
+   ++histogram[histogram_bucket( (int64_t)( time_ms * 1000.0 ) )];
+
+   // Remember the recent worst-case samples, which are the samples setting a
+   // new maximum or landing above the cached 99th percentile, along with a
+   // wall-clock timestamp of when they happened.
+   if ( is_new_max || ( ( worst_sample_threshold > 0.0 ) && ( time_ms >= worst_sample_threshold ) ) ) {
+      worst_sample_time[worst_sample_index]      = time_ms;
+      worst_sample_timestamp[worst_sample_index] = clock_wall_time();
+      worst_sample_index                         = ( worst_sample_index + 1 ) % WORST_SAMPLE_RING_SIZE;
+      if ( worst_sample_count < WORST_SAMPLE_RING_SIZE ) {
+         ++worst_sample_count;
+      }
+   }
+
+   // Periodically refresh the worst-case qualification threshold from the
+   // histogram so the ring tracks roughly the top one percent of samples.
+   if ( ( count & 0x3FF ) == 0 ) {
+      worst_sample_threshold = percentile( 0.99 );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ElapsedTimeStats::merge(
+   ElapsedTimeStats const &other )
+{
+   if ( other.count == 0 ) {
+      return;
+   }
+   if ( count == 0 ) {
+      min = other.min;
+      max = other.max;
+   } else {
+      if ( other.min < min ) {
+         min = other.min;
+      }
+      if ( other.max > max ) {
+         max = other.max;
+      }
+   }
+   count += other.count;
+   time_sum += other.time_sum;
+   time_squared_sum += other.time_squared_sum;
+   elapsed_time = other.elapsed_time;
+
+   for ( int b = 0; b < HISTOGRAM_BUCKET_CNT; ++b ) {
+      histogram[b] += other.histogram[b];
+   }
+
+   // Merge the recent worst-case samples into the ring, oldest first so the
+   // most recent samples survive if the merged ring overflows.
+   for ( int i = other.worst_sample_count - 1; i >= 0; --i ) {
+      int const ring_index = ( ( other.worst_sample_index - 1 - i ) + ( 2 * WORST_SAMPLE_RING_SIZE ) ) % WORST_SAMPLE_RING_SIZE;
+
+      worst_sample_time[worst_sample_index]      = other.worst_sample_time[ring_index];
+      worst_sample_timestamp[worst_sample_index] = other.worst_sample_timestamp[ring_index];
+      worst_sample_index                         = ( worst_sample_index + 1 ) % WORST_SAMPLE_RING_SIZE;
+      if ( worst_sample_count < WORST_SAMPLE_RING_SIZE ) {
+         ++worst_sample_count;
+      }
+   }
+}
+
+/*!
+ * @details The histogram uses 16 linear sub-buckets per power of two of
+ * microseconds, which bounds the bucket quantization error to about six
+ * percent of the sample value just like an HDR histogram with two
+ * significant digits.
+ */
+int const ElapsedTimeStats::histogram_bucket(
+   int64_t const time_us )
+{
+   if ( time_us < 16 ) {
+      return ( time_us < 0 ) ? 0 : (int)time_us;
+   }
+   // Position of the most significant bit that is set.
+   int     msb = 0;
+   int64_t v   = time_us;
+   while ( ( v >>= 1 ) != 0 ) {
+      ++msb;
+   }
+   // One major bucket of 16 linear sub-buckets per power of two, with the
+   // sub-bucket from the 4 bits below the most significant bit.
+   int bucket = 16 + ( ( msb - 4 ) * 16 ) + (int)( ( time_us >> ( msb - 4 ) ) & 0xF );
+   return ( bucket < HISTOGRAM_BUCKET_CNT ) ? bucket : ( HISTOGRAM_BUCKET_CNT - 1 );
+}
+
+int64_t const ElapsedTimeStats::bucket_lower_bound(
+   int const bucket )
+{
+   if ( bucket < 16 ) {
+      return bucket;
+   }
+   int const major = ( bucket - 16 ) / 16;
+   return (int64_t)( 16 + ( bucket % 16 ) ) << major;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+double const ElapsedTimeStats::percentile(
+   double const fraction )
+{
+   if ( count == 0 ) {
+      return 0.0;
+   }
+   uint64_t target = (uint64_t)ceil( fraction * (double)count );
+   if ( target < 1 ) {
+      target = 1;
+   } else if ( target > count ) {
+      target = count;
+   }
+   uint64_t cumulative = 0;
+   for ( int b = 0; b < HISTOGRAM_BUCKET_CNT; ++b ) {
+      cumulative += histogram[b];
+      if ( cumulative >= target ) {
+         if ( b == ( HISTOGRAM_BUCKET_CNT - 1 ) ) {
+            // The last bucket is open ended, report the maximum seen.
+            return max;
          }
+         // Report the bucket midpoint in milliseconds, bounded by the
+         // maximum sample seen.
+         double const midpoint = ( (double)( bucket_lower_bound( b ) + bucket_lower_bound( b + 1 ) ) * 0.5 ) * 0.001;
+         return ( midpoint < max ) ? midpoint : max;
       }
-      time_sum += elapsed_time;                        // milliseconds
-      time_squared_sum += elapsed_time * elapsed_time; // milliseconds^2
-      ++count;
    }
-   prev_time = time;
+   return max;
 }
 
 /*!
@@ -189,6 +345,10 @@ std::string const ElapsedTimeStats::to_string()
           << "             max: " << max << " milliseconds" << endl
           << "            mean: " << mean << " milliseconds" << endl
           << "  sample-std-dev: " << std_dev << " milliseconds" << endl
+          << "             p50: " << percentile( 0.50 ) << " milliseconds" << endl
+          << "             p95: " << percentile( 0.95 ) << " milliseconds" << endl
+          << "             p99: " << percentile( 0.99 ) << " milliseconds" << endl
+          << "            p999: " << percentile( 0.999 ) << " milliseconds" << endl
           << " margin-of-error: " << ( moe_percent * 100.0 )
           << "%%%% (" << moe << " milliseconds) with "
           << ( confidence * 100.0 ) << "%%%% confidence" << endl
@@ -198,6 +358,20 @@ std::string const ElapsedTimeStats::to_string()
           << M << " milliseconds) margin of error with a "
           << ( confidence * 100.0 ) << "%%%% confidence level we need at least "
           << min_sample_size << " samples based on the statistics.";
+
+      // The recent worst-case samples, most recent first.
+      if ( worst_sample_count > 0 ) {
+         msg << endl
+             << "   worst-samples: (most recent first)";
+         for ( int i = 0; i < worst_sample_count; ++i ) {
+            int const ring_index = ( ( worst_sample_index - 1 - i ) + ( 2 * WORST_SAMPLE_RING_SIZE ) ) % WORST_SAMPLE_RING_SIZE;
+            msg << endl
+                << "      " << worst_sample_time[ring_index]
+                << " milliseconds at wall-clock time "
+                << ( (double)worst_sample_timestamp[ring_index] * 0.000001 )
+                << " seconds";
+         }
+      }
    } else {
       msg << "    sample-count: " << count << endl
           << "             min: N/A" << endl
@@ -207,3 +381,22 @@ std::string const ElapsedTimeStats::to_string()
    }
    return msg.str();
 }
+
+/*!
+ * @job_class{scheduled}
+ */
+ElapsedTimeStats::ScopedTimer::ScopedTimer(
+   ElapsedTimeStats &time_stats )
+   : stats( &time_stats ),
+     start_time( clock_wall_time() ) // in microseconds
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+ElapsedTimeStats::ScopedTimer::~ScopedTimer()
+{
+   stats->sample( ( clock_wall_time() - start_time ) * 0.001 ); // milliseconds
+}
@@ -0,0 +1,82 @@
+/*!
+@file TrickHLA/EventWait.cpp
+@ingroup TrickHLA
+@brief A reusable event-wait primitive for the FedAmb callback wait loops.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{EventWait.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+// System include files.
+#include <ctime>
+#include <pthread.h>
+
+// TrickHLA include files.
+#include "TrickHLA/EventWait.hh"
+
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+EventWait::EventWait()
+{
+   pthread_mutex_init( &cond_mutex, NULL );
+   pthread_cond_init( &cond, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+EventWait::~EventWait()
+{
+   pthread_cond_destroy( &cond );
+   pthread_mutex_destroy( &cond_mutex );
+}
+
+/*!
+ * @details The broadcast is done while holding the condition variable
+ * mutex, which pairs with the timed wait in wait(). Only call this after
+ * any mutex protecting the waited on state has been released so a waiter
+ * woken here can immediately re-check that state.
+ */
+void EventWait::signal()
+{
+   pthread_mutex_lock( &cond_mutex );
+   pthread_cond_broadcast( &cond );
+   pthread_mutex_unlock( &cond_mutex );
+}
+
+void EventWait::wait()
+{
+   pthread_mutex_lock( &cond_mutex );
+
+   struct timespec abs_timeout;
+   clock_gettime( CLOCK_REALTIME, &abs_timeout );
+   abs_timeout.tv_nsec += BOUNDED_WAIT_NANOS;
+   if ( abs_timeout.tv_nsec >= 1000000000L ) {
+      abs_timeout.tv_sec += 1;
+      abs_timeout.tv_nsec -= 1000000000L;
+   }
+   pthread_cond_timedwait( &cond, &cond_mutex, &abs_timeout );
+
+   pthread_mutex_unlock( &cond_mutex );
+}
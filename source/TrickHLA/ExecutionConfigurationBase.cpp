@@ -201,6 +201,10 @@ void ExecutionConfigurationBase::reset_ownership_states()
             attributes[i].mark_locally_owned();
          }
       }
+
+      // The cached ownership counts are stale now that the ownership
+      // states have been reset.
+      invalidate_ownership_counts();
    }
 }
 
@@ -232,6 +236,10 @@ void ExecutionConfigurationBase::set_master(
          attributes[i].set_subscribe( true );
       }
    }
+
+   // The cached ownership counts are stale now that the ownership, publish
+   // and subscribe states have been set for the master or non-master role.
+   invalidate_ownership_counts();
 }
 
 /*!
@@ -373,7 +381,9 @@ bool ExecutionConfigurationBase::wait_for_update() // RETURN: -- None.
          // Check for shutdown.
          federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         // Block until the FedAmb reflection callback signals the arrival
+         // of data or the bounded wait times out.
+         this->wait_for_data_arrival( 0.010 );
 
          if ( !this->is_changed() ) {
 
@@ -177,6 +177,10 @@ void ExecutionControl::pre_multi_phase_init_processes()
    // Don't forget to enable asynchronous delivery of messages.
    federate->enable_async_delivery();
 
+   // Enable attribute relevance advisories so we don't send cyclic updates
+   // for attributes with no remote subscribers.
+   federate->enable_attribute_relevance_advisory();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
       if ( this->is_master() ) {
          send_hs( stdout, "TrickHLA::ExecutionControl::pre_multi_phase_init_processes():%d\n    I AM THE MASTER%c",
@@ -191,10 +195,9 @@ void ExecutionControl::pre_multi_phase_init_processes()
    // the "Master" federate or not.
    execution_configuration->set_master( this->is_master() );
 
-   if ( this->is_master() ) {
-      // Initialize the MOM interface handles.
-      federate->initialize_MOM_handles();
-   }
+   // NOTE: The MOM interface handles are resolved lazily on first need,
+   // so there is no longer an eager Federate::initialize_MOM_handles()
+   // call here for the Master federate.
 
    // Setup all the RTI handles for the objects, attributes and interaction
    // parameters.
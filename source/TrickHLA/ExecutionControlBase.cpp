@@ -301,6 +301,10 @@ void ExecutionControlBase::join_federation_process()
    // Don't forget to enable asynchronous delivery of messages.
    fed->enable_async_delivery();
 
+   // Enable attribute relevance advisories so we don't send cyclic updates
+   // for attributes with no remote subscribers.
+   fed->enable_attribute_relevance_advisory();
+
    // Check for a latent shutdown sync-point.
    // If shutdown sync-point is detected, then we must have entered into
    // a running federation execution that is shutting down. This is an
@@ -695,6 +699,14 @@ void ExecutionControlBase::receive_cyclic_data()
    // Receive the requested data for the ExecutionConfiguration if we have one.
    if ( execution_configuration != NULL ) {
 
+      // The execution configuration is event driven and unchanged for long
+      // stretches of a run, so do a cheap lock-free pre-check and skip the
+      // mutex protected change detection in is_changed() for the common
+      // cycle where no update has arrived.
+      if ( !execution_configuration->is_received_data_available() ) {
+         return;
+      }
+
       // Process all the received ExecutionConfiguration data in the
       // buffer/queue, which shows up as changed.
       while ( execution_configuration->is_changed() ) {
@@ -504,29 +504,26 @@ void FedAmb::discoverObjectInstance(
    wstring const                          &theObjectInstanceName ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-      string id_str, name_str;
-      StringUtilities::to_string( id_str, theObject );
-      StringUtilities::to_string( name_str, theObjectInstanceName );
+      char name_text[128];
+      StringUtilities::to_buffer( name_text, sizeof( name_text ), theObjectInstanceName );
       send_hs( stdout, "FedAmb::discoverObjectInstance():%d DISCOVERED '%s' Instance-ID:%s%c",
-               __LINE__, name_str.c_str(), id_str.c_str(), THLA_NEWLINE );
+               __LINE__, name_text, StringUtilities::to_text( theObject ), THLA_NEWLINE );
    }
 
    if ( manager == NULL ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str, name_str;
-         StringUtilities::to_string( id_str, theObject );
-         StringUtilities::to_string( name_str, theObjectInstanceName );
+         char name_text[128];
+         StringUtilities::to_buffer( name_text, sizeof( name_text ), theObjectInstanceName );
          send_hs( stdout, "FedAmb::discoverObjectInstance():%d Unexpected \
 NULL Manager! Can't do anything with discovered object '%s' Instance-ID:%s%c",
-                  __LINE__, name_str.c_str(), id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, name_text, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
    } else if ( !manager->discover_object_instance( theObject, theObjectClass, theObjectInstanceName ) ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str, name_str;
-         StringUtilities::to_string( id_str, theObject );
-         StringUtilities::to_string( name_str, theObjectInstanceName );
+         char name_text[128];
+         StringUtilities::to_buffer( name_text, sizeof( name_text ), theObjectInstanceName );
          send_hs( stderr, "FedAmb::discoverObjectInstance():%d Object '%s' with Instance-ID:%s is UNKNOWN to me!%c",
-                  __LINE__, name_str.c_str(), id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, name_text, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
    }
 }
@@ -538,11 +535,9 @@ void FedAmb::discoverObjectInstance(
    RTI1516_NAMESPACE::FederateHandle       producingFederate ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-      string fed_id;
-      StringUtilities::to_string( fed_id, producingFederate );
       send_hs( stdout, "FedAmb::discoverObjectInstance(producing \
 federate '%s'):%d calling 'discoverObjectInstance' to finish the discovery.%c",
-               fed_id.c_str(), __LINE__, THLA_NEWLINE );
+               StringUtilities::to_text( producingFederate ), __LINE__, THLA_NEWLINE );
    }
 
    discoverObjectInstance( theObject, theObjectClass, theObjectInstanceName );
@@ -566,7 +561,14 @@ void FedAmb::reflectAttributeValues(
                   __LINE__, trickhla_obj->get_name(), THLA_NEWLINE );
       }
 
-      // Pass the attribute values off to the object.
+      // Record a one-way latency survey sample from the user-supplied tag,
+      // when the survey is enabled for this object.
+      trickhla_obj->record_latency_survey( theUserSuppliedTag );
+
+      // Pass the attribute values off to the object. The attribute values
+      // are moved out of the map, which the HLA standard allows since the
+      // callback argument is only for our use for the duration of this
+      // callback and the RTI is left with a valid empty map.
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
       trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues );
 #else
@@ -579,37 +581,29 @@ void FedAmb::reflectAttributeValues(
 
       if ( federation_restored_rebuild_federate_handle_set ) {
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-            string id_str;
-            StringUtilities::to_string( id_str, theObject );
             send_hs( stdout, "FedAmb::reflectAttributeValues(%d elements):%d Rebuilding federate handle for Federate ID:%s%c",
                      (int)theAttributeValues.size(),
-                     __LINE__, id_str.c_str(), THLA_NEWLINE );
+                     __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
          }
          federate->rebuild_federate_handles( theObject, theAttributeValues );
       } else {
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-            string id_str;
-            StringUtilities::to_string( id_str, theObject );
             send_hs( stdout, "FedAmb::reflectAttributeValues():%d Setting name for Federate ID:%s%c",
-                     __LINE__, id_str.c_str(), THLA_NEWLINE );
+                     __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
          }
          federate->set_MOM_HLAfederate_instance_attributes( theObject, theAttributeValues );
       }
    } else if ( ( federate != NULL ) && federate->is_MOM_HLAfederation_instance_id( theObject ) ) {
       // This was an instance-ID for the Federation and not a federate.
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
          send_hs( stdout, "FedAmb::reflectAttributeValues():%d Setting name for Federation ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
       federate->set_MOM_HLAfederation_instance_attributes( theObject, theAttributeValues );
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
          send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
    }
 }
@@ -637,7 +631,14 @@ void FedAmb::reflectAttributeValues(
                   THLA_NEWLINE );
       }
 
-      // Pass the attribute values off to the object.
+      // Record a one-way latency survey sample from the user-supplied tag,
+      // when the survey is enabled for this object.
+      trickhla_obj->record_latency_survey( theUserSuppliedTag );
+
+      // Pass the attribute values off to the object. The attribute values
+      // are moved out of the map, which the HLA standard allows since the
+      // callback argument is only for our use for the duration of this
+      // callback and the RTI is left with a valid empty map.
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
       trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues );
 #else
@@ -648,10 +649,8 @@ void FedAmb::reflectAttributeValues(
 #endif
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
          send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
    }
 }
@@ -679,7 +678,14 @@ void FedAmb::reflectAttributeValues(
                   __LINE__, trickhla_obj->get_name(), time.get_time_in_seconds(), THLA_NEWLINE );
       }
 
-      // Pass the attribute values off to the object.
+      // Record a one-way latency survey sample from the user-supplied tag,
+      // when the survey is enabled for this object.
+      trickhla_obj->record_latency_survey( theUserSuppliedTag );
+
+      // Pass the attribute values off to the object. The attribute values
+      // are moved out of the map, which the HLA standard allows since the
+      // callback argument is only for our use for the duration of this
+      // callback and the RTI is left with a valid empty map.
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
       trickhla_obj->enqueue_data( (AttributeHandleValueMap &)theAttributeValues );
 #else
@@ -690,10 +696,8 @@ void FedAmb::reflectAttributeValues(
 #endif
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
          send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), THLA_NEWLINE );
       }
    }
 }
@@ -794,17 +798,14 @@ void FedAmb::removeObjectInstance(
    RTI1516_NAMESPACE::SupplementalRemoveInfo    theRemoveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-      string id_str;
-      StringUtilities::to_string( id_str, theObject );
-
       if ( theUserSuppliedTag.size() > 0 ) {
          char const *tag = static_cast< char const * >( theUserSuppliedTag.data() );
          send_hs( stdout, "FedAmb::removeObjectInstance():%d User-Supplied-Tag='%s' Instance-ID:%s Valid-ID:%s %c",
-                  __LINE__, tag, id_str.c_str(),
+                  __LINE__, tag, StringUtilities::to_text( theObject ),
                   ( theObject.isValid() ? "Yes" : "No" ), THLA_NEWLINE );
       } else {
          send_hs( stdout, "FedAmb::removeObjectInstance():%d Instance-ID:%s Valid-ID:%s %c",
-                  __LINE__, id_str.c_str(),
+                  __LINE__, StringUtilities::to_text( theObject ),
                   ( theObject.isValid() ? "Yes" : "No" ), THLA_NEWLINE );
       }
    }
@@ -828,18 +829,16 @@ void FedAmb::removeObjectInstance(
    federate->remove_MOM_HLAfederate_instance_id( theObject );
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-      string id_str;
-      StringUtilities::to_string( id_str, theObject );
       Int64Time time;
       time.set( theTime );
 
       if ( theUserSuppliedTag.size() > 0 ) {
          char const *tag = static_cast< char const * >( theUserSuppliedTag.data() );
          send_hs( stdout, "FedAmb::removeObjectInstance():%d tag='%s' Instance-ID:%s HLA-time:%.12G seconds.%c",
-                  __LINE__, tag, id_str.c_str(), time.get_time_in_seconds(), THLA_NEWLINE );
+                  __LINE__, tag, StringUtilities::to_text( theObject ), time.get_time_in_seconds(), THLA_NEWLINE );
       } else {
          send_hs( stdout, "FedAmb::removeObjectInstance():%d Instance-ID:%s HLA-time:%.12G seconds.%c",
-                  __LINE__, id_str.c_str(), time.get_time_in_seconds(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), time.get_time_in_seconds(), THLA_NEWLINE );
       }
    }
 
@@ -860,19 +859,16 @@ void FedAmb::removeObjectInstance(
    federate->remove_MOM_HLAfederate_instance_id( theObject );
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-      string id_str;
-      StringUtilities::to_string( id_str, theObject );
-
       Int64Time time;
       time.set( theTime );
 
       if ( theUserSuppliedTag.size() > 0 ) {
          char const *tag = static_cast< char const * >( theUserSuppliedTag.data() );
          send_hs( stdout, "FedAmb::removeObjectInstance():%d tag='%s' Instance-ID:%s HLA-time:%.12G seconds.%c",
-                  __LINE__, tag, id_str.c_str(), time.get_time_in_seconds(), THLA_NEWLINE );
+                  __LINE__, tag, StringUtilities::to_text( theObject ), time.get_time_in_seconds(), THLA_NEWLINE );
       } else {
          send_hs( stdout, "FedAmb::removeObjectInstance():%d Instance-ID:%s HLA-time:%.12G seconds.%c",
-                  __LINE__, id_str.c_str(), time.get_time_in_seconds(), THLA_NEWLINE );
+                  __LINE__, StringUtilities::to_text( theObject ), time.get_time_in_seconds(), THLA_NEWLINE );
       }
    }
 
@@ -915,9 +911,9 @@ void FedAmb::turnUpdatesOnForObjectInstance(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
-   send_hs( stderr, "This federate '%s' does not support this function: \
-FedAmb::turnUpdatesOnForObjectInstance():%d %c",
-            federate->get_federate_name(), __LINE__, THLA_NEWLINE );
+   if ( manager != NULL ) {
+      manager->set_attribute_update_advisory( theObject, theAttributes, true );
+   }
 }
 
 void FedAmb::turnUpdatesOnForObjectInstance(
@@ -925,18 +921,20 @@ void FedAmb::turnUpdatesOnForObjectInstance(
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes,
    wstring const                               &updateRateDesignator ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
-   send_hs( stderr, "This federate '%s' does not support this function: \
-FedAmb::turnUpdatesOnForObjectInstance():%d %c",
-            federate->get_federate_name(), __LINE__, THLA_NEWLINE );
+   // The update rate designator is ignored since TrickHLA sends cyclic
+   // updates at the configured job cycle rate.
+   if ( manager != NULL ) {
+      manager->set_attribute_update_advisory( theObject, theAttributes, true );
+   }
 }
 
 void FedAmb::turnUpdatesOffForObjectInstance(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
-   send_hs( stderr, "This federate '%s' does not support this function: \
-FedAmb::turnUpdatesOffForObjectInstance():%d %c",
-            federate->get_federate_name(), __LINE__, THLA_NEWLINE );
+   if ( manager != NULL ) {
+      manager->set_attribute_update_advisory( theObject, theAttributes, false );
+   }
 }
 
 void FedAmb::confirmAttributeTransportationTypeChange(
@@ -16,14 +16,20 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{ElapsedTimeStats.cpp}
 @trick_link_dependency{ExecutionControlBase.cpp}
 @trick_link_dependency{FedAmb.cpp}
 @trick_link_dependency{Federate.cpp}
+@trick_link_dependency{FrameBudgetWatchdog.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{AdaptiveSleepTimeout.cpp}
+@trick_link_dependency{SendPacer.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{StartupProfiler.cpp}
+@trick_link_dependency{Tracepoint.cpp}
 @trick_link_dependency{TrickThreadCoordinator.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
@@ -39,22 +45,30 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <arpa/inet.h>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib> // for atof
+#include <cstring>
+#include <fcntl.h>
 #include <float.h>
 #include <fstream> // for ifstream
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <memory> // for auto_ptr
+#include <pthread.h>
 #include <sstream>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <time.h>
+#include <unistd.h>
+#include <vector>
 
 // Trick include files.
 #include "trick/CheckPointRestart.hh"
@@ -63,6 +77,7 @@ NASA, Johnson Space Center\n
 #include "trick/DataRecordDispatcher.hh" //DANNY2.7 need the_drd to init data recording groups when restoring at init time (IMSIM)
 #include "trick/Executive.hh"
 #include "trick/MemoryManager.hh"
+#include "trick/clock_proto.h"
 #include "trick/command_line_protos.h"
 #include "trick/exec_proto.h"
 #include "trick/input_processor_proto.h"
@@ -71,17 +86,26 @@ NASA, Johnson Space Center\n
 #include "trick/release.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/FedAmb.hh"
 #include "TrickHLA/Federate.hh"
+#include "TrickHLA/FrameBudgetWatchdog.hh"
 #include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/LoggableSyncPnt.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/Metrics.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/AdaptiveSleepTimeout.hh"
+#include "TrickHLA/SendPacer.hh"
 #include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/StartupProfiler.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Tracepoint.hh"
 #include "TrickHLA/TrickThreadCoordinator.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -114,6 +138,22 @@ using namespace std;
 using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 
+// Static flag checked from the destructors, which may run without a
+// Federate reference.
+bool Federate::fast_teardown_active = false;
+
+// Label prefix of the per-federate join announcement sync-points used by
+// the sync-point join detection mode. The full label is the prefix, the
+// joining federate's name and a trailing '.' separated wall clock stamp
+// that makes every registration unique.
+static std::wstring const JOIN_SYNC_POINT_PREFIX = L"_THLA_join_";
+
+// Determine if a sync-point label is a per-federate join announcement.
+static bool is_join_sync_point_label( wstring const &label )
+{
+   return ( label.compare( 0, JOIN_SYNC_POINT_PREFIX.length(), JOIN_SYNC_POINT_PREFIX ) == 0 );
+}
+
 /*!
  * @details NOTE: In most cases, we would allocate and set default names in
  * the constructor. However, since we want this class to be Input Processor
@@ -135,13 +175,27 @@ Federate::Federate()
      time_regulating( true ),
      time_constrained( true ),
      time_management( true ),
+     time_adv_grant_wakeup( false ),
+     time_adv_grant_spin_micros( 0 ),
+     use_TARA_for_cyclic_advance( false ),
+     adaptive_lookahead_enabled( false ),
+     adaptive_lookahead_min_time( 0.0 ),
+     adaptive_lookahead_guard_band( 0.0 ),
+     adaptive_lookahead_period( 10.0 ),
+     frame_watchdog(),
+     send_pacer(),
+     shared_memory_transport( false ),
+     use_rti_submission_proxy( false ),
      enable_known_feds( true ),
      known_feds_count( 0 ),
      known_feds( NULL ),
+     sync_point_join_detection( false ),
+     wire_traffic_report( false ),
      debug_level( DEBUG_LEVEL_NO_TRACE ),
      code_section( DEBUG_SOURCE_ALL_MODULES ),
      wait_status_time( 30.0 ),
      can_rejoin_federation( false ),
+     fast_teardown( false ),
      freeze_delay_frames( 2 ),
      unfreeze_after_save( false ),
      federation_created_by_federate( false ),
@@ -184,9 +238,21 @@ Federate::Federate()
      execution_has_begun( false ),
      time_adv_state( TIME_ADVANCE_RESET ),
      time_adv_state_mutex(),
+     cached_GALT_base_time( 0LL ),
+     cached_GALT_fresh( false ),
      granted_time( 0.0 ),
      requested_time( 0.0 ),
      HLA_time( 0.0 ),
+     time_adv_grant_stats(),
+     metrics(),
+     adaptive_lookahead_base_time( -1 ),
+     adaptive_lookahead_window_max( 0.0 ),
+     adaptive_lookahead_adjust_time( 0.0 ),
+     adaptive_lookahead_grant_clock( 0 ),
+     adaptive_lookahead_stats(),
+     rti_submitter(),
+     save_restore_event(),
+     MOM_auto_provide_event(),
      start_to_save( false ),
      start_to_restore( false ),
      restart_flag( false ),
@@ -195,6 +261,7 @@ Federate::Federate()
      time_constrained_state( false ),
      got_startup_sync_point( false ),
      make_copy_of_run_directory( false ),
+     MOM_handles_resolved( false ),
      MOM_HLAfederation_class_handle(),
      MOM_HLAfederatesInFederation_handle(),
      MOM_HLAautoProvide_handle(),
@@ -205,21 +272,36 @@ Federate::Federate()
      MOM_HLAfederateType_handle(),
      MOM_HLAfederateName_handle(),
      MOM_HLAfederate_handle(),
+     MOM_HLAfederateHost_handle(),
      mom_HLAfederate_inst_name_map(),
+     shared_memory_peer_detected( false ),
+     MOM_unicode_decode_cache(),
+     local_host_name_ws(),
      joined_federate_mutex(),
      joined_federate_name_map(),
      joined_federate_handles(),
      joined_federate_names(),
+     joined_federate_name_set(),
+     required_federate_name_set(),
+     required_federate_name_set_built( false ),
      thread_coordinator(),
      RTI_ambassador( NULL ),
      federate_ambassador( NULL ),
      manager( NULL ),
      execution_control( NULL )
 {
+   // Initialize the time advance grant wakeup synchronization primitives.
+   pthread_mutex_init( &time_adv_cond_mutex, NULL );
+   pthread_cond_init( &time_adv_cond, NULL );
+
    TRICKHLA_INIT_FPU_CONTROL_WORD;
 
    // As a sanity check validate the FPU code word.
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // Assert the compile-time byte order used by the encode and decode
+   // paths matches the byte order measured at runtime.
+   Utilities::verify_endianness();
 }
 
 /*!
@@ -229,6 +311,17 @@ Federate::Federate()
  */
 Federate::~Federate()
 {
+   // Fast teardown: the process is exiting and the operating system
+   // reclaims the memory in bulk, so skip the per-variable Trick memory
+   // frees.
+   if ( Federate::fast_teardown_active ) {
+      return;
+   }
+
+   // Destroy the time advance grant wakeup synchronization primitives.
+   pthread_cond_destroy( &time_adv_cond );
+   pthread_mutex_destroy( &time_adv_cond_mutex );
+
    // Free the memory used for the federate name.
    if ( name != NULL ) {
       if ( trick_MM->delete_var( static_cast< void * >( name ) ) ) {
@@ -315,6 +408,7 @@ Federate::~Federate()
 
    // Clear the list of joined federate names.
    joined_federate_names.clear();
+   joined_federate_name_set.clear();
 
    // Free the memory used by the array of running Federates for the Federation.
    clear_running_feds();
@@ -709,6 +803,13 @@ void Federate::post_multiphase_initialization()
 
    // Mark the federate as having begun execution.
    this->set_federate_has_begun_execution();
+
+   // Dump the startup phase timing report now that the startup is over, so
+   // startup-time regressions are visible and attributable in every log.
+   if ( StartupProfiler::has_stages() ) {
+      send_hs( stdout, "Federate::post_multiphase_initialization():%d\n%s%c",
+               __LINE__, StartupProfiler::to_string().c_str(), THLA_NEWLINE );
+   }
 }
 
 /*!
@@ -716,6 +817,9 @@ void Federate::post_multiphase_initialization()
  */
 void Federate::create_RTI_ambassador_and_connect()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Federate::create_RTI_ambassador_and_connect" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -764,6 +868,14 @@ void Federate::create_RTI_ambassador_and_connect()
       // Create the RTI ambassador.
       this->RTI_ambassador = rtiAmbassadorFactory->createRTIambassador();
 
+      // Connect using the HLA_IMMEDIATE callback model so that the RTI
+      // delivers federate-ambassador callbacks continuously on its own
+      // dedicated callback thread, which feeds the lock-free reflected
+      // attributes and interaction queues. This decouples callback delivery
+      // latency from the simulation frame phase, and it means the simulation
+      // thread must never call into the RTI evoked-callback API's (i.e.
+      // evokeCallback()/evokeMultipleCallbacks()), which are only valid for
+      // the HLA_EVOKED callback model.
       if ( ( local_settings == NULL ) || ( *local_settings == '\0' ) ) {
          // Use default vendor local settings.
          RTI_ambassador->connect( *federate_ambassador,
@@ -916,6 +1028,35 @@ bool Federate::is_federate_instance_id(
    return ( joined_federate_name_map.find( id ) != joined_federate_name_map.end() );
 }
 
+/*!
+ * @details The cache is keyed on the raw encoded bytes, so during a join
+ * storm the repeated MOM reflections of the same federate name and host
+ * name values hit the cache and skip the per-character Unicode decode.
+ * The cache is bounded and simply dropped when it grows past the expected
+ * working set, which only costs a re-decode on the next reflection.
+ */
+wstring const &Federate::decode_MOM_unicode_string(
+   VariableLengthData const &value )
+{
+   string const key( static_cast< char const * >( value.data() ), value.size() );
+
+   map< string, wstring >::const_iterator cache_iter = MOM_unicode_decode_cache.find( key );
+   if ( cache_iter != MOM_unicode_decode_cache.end() ) {
+      return cache_iter->second;
+   }
+
+   // Bound the cache to the expected working set of a large federation,
+   // i.e. one name and one host value per joined federate.
+   if ( MOM_unicode_decode_cache.size() >= 512 ) {
+      MOM_unicode_decode_cache.clear();
+   }
+
+   HLAunicodeString unicode_str;
+   unicode_str.decode( value );
+
+   return ( MOM_unicode_decode_cache[key] = wstring( unicode_str ) );
+}
+
 void Federate::set_MOM_HLAfederate_instance_attributes(
    ObjectInstanceHandle           id,
    AttributeHandleValueMap const &values )
@@ -940,26 +1081,18 @@ void Federate::set_MOM_HLAfederate_instance_attributes(
    // Determine if we have a federate name attribute.
    if ( attr_iter != values.end() ) {
 
-      // Federate name is encoded into variable length data.
-      VariableLengthData const &value = attr_iter->second;
-
-      // Decode the federate name that is encoded as a Unicode string.
-      HLAunicodeString fed_name_unicode;
-      fed_name_unicode.decode( value );
-      federate_name_ws = wstring( fed_name_unicode );
+      // The federate name is encoded as a Unicode string. Decode it through
+      // the memoized cache so join-storm re-reflections of the same value
+      // skip the per-character decode.
+      federate_name_ws = decode_MOM_unicode_string( attr_iter->second );
 
       // Map the federate name to the federate ID.
       joined_federate_name_map[id] = federate_name_ws;
 
-      // Make sure that the federate name does not exist before adding.
-      bool found = false;
-      for ( size_t i = 0; !found && ( i < joined_federate_names.size() ); ++i ) {
-         if ( joined_federate_names[i] == federate_name_ws ) {
-            found = true;
-         }
-      }
-      if ( !found ) {
-         // Record the federate name.
+      // Record the federate name if we have not seen it before. The hashed
+      // set detects a duplicate in O(1) and is maintained incrementally
+      // here, from this MOM reflection callback.
+      if ( joined_federate_name_set.insert( federate_name_ws ).second ) {
          joined_federate_names.push_back( federate_name_ws );
       }
 
@@ -972,6 +1105,48 @@ void Federate::set_MOM_HLAfederate_instance_attributes(
       }
    }
 
+   // Find the Federate host name for the given MOM federate Host attribute
+   // handle, which is used to detect other federates that are co-located on
+   // the same host so the shared-memory transport fast path can be used.
+   attr_iter = values.find( MOM_HLAfederateHost_handle );
+
+   // Determine if we have a federate host attribute.
+   if ( attr_iter != values.end() ) {
+
+      // The federate host name is encoded as a Unicode string. Decode it
+      // through the memoized cache since every federate on the same host
+      // reflects the identical value.
+      wstring const &federate_host_ws = decode_MOM_unicode_string( attr_iter->second );
+
+      // Resolve the host name this federate is running on once and cache
+      // it, instead of calling gethostname() per MOM reflection.
+      if ( local_host_name_ws.empty() ) {
+         char local_host[256];
+         if ( gethostname( local_host, sizeof( local_host ) ) == 0 ) {
+            local_host[sizeof( local_host ) - 1] = '\0';
+            StringUtilities::to_wstring( local_host_name_ws, local_host );
+         }
+      }
+
+      if ( !local_host_name_ws.empty() ) {
+         // We detected a co-located peer if the reflected host name matches
+         // our host name and the federate is not us.
+         wstring federate_name_check_ws;
+         StringUtilities::to_wstring( federate_name_check_ws, get_federate_name() );
+         if ( ( federate_host_ws == local_host_name_ws )
+              && !federate_name_ws.empty()
+              && ( federate_name_ws != federate_name_check_ws ) ) {
+
+            if ( !this->shared_memory_peer_detected
+                 && DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+               send_hs( stdout, "Federate::set_MOM_HLAfederate_instance_attributes():%d Detected federate '%ls' co-located on host '%ls'.%c",
+                        __LINE__, federate_name_ws.c_str(), federate_host_ws.c_str(), THLA_NEWLINE );
+            }
+            this->shared_memory_peer_detected = true;
+         }
+      }
+   }
+
    // Find the FederateHandle attribute for the given MOM federate handle.
    attr_iter = values.find( MOM_HLAfederate_handle );
 
@@ -1089,56 +1264,26 @@ void Federate::set_MOM_HLAfederate_instance_attributes(
                   __LINE__, id_str.c_str(), size, fed_id.c_str(), THLA_NEWLINE );
       }
 
-      // If this federate is running, add the new entry into running_feds.
+      // If this federate is running, absorb the new entries into running_feds.
       if ( is_federate_executing() ) {
-         bool found = false;
-         for ( int loop = 0; loop < running_feds_count; ++loop ) {
-            char const *tName = StringUtilities::ip_strdup_wstring( federate_name_ws );
-            if ( !strcmp( running_feds[loop].name, tName ) ) {
-               found = true;
-               break;
+         // Absorb each pending joined federate name into running_feds
+         // incrementally, updating any entry already in the roster in place,
+         // instead of rebuilding the entire roster from the MOM data on
+         // every membership change. Stray entries for federates whose name
+         // attribute has not been reflected yet are skipped and simply get
+         // re-discovered on their next reflection.
+         TrickHLAObjInstanceNameMap::const_iterator map_iter;
+         for ( map_iter = joined_federate_name_map.begin();
+               map_iter != joined_federate_name_map.end(); ++map_iter ) {
+            if ( map_iter->second.length() > 0 ) {
+               add_or_update_a_single_entry_into_running_feds(
+                  mom_HLAfederate_inst_name_map[map_iter->first],
+                  map_iter->second );
             }
          }
-         // Update the running_feds if the federate name was not found.
-         if ( !found ) {
-            if ( joined_federate_name_map.size() == 1 ) {
-               add_a_single_entry_into_running_feds();
 
-               // Clear the entry after it is absorbed into running_feds.
-               joined_federate_name_map.clear();
-            } else {
-               // Loop thru all joined_federate_name_map entries removing stray
-               // NULL string entries.
-               TrickHLAObjInstanceNameMap::iterator map_iter;
-               for ( map_iter = joined_federate_name_map.begin();
-                     map_iter != joined_federate_name_map.end(); ++map_iter ) {
-                  if ( map_iter->second.length() == 0 ) {
-                     joined_federate_name_map.erase( map_iter );
-
-                     // Re-process all entries if any are deleted since the
-                     // delete modified the iterator position.
-                     map_iter = joined_federate_name_map.begin();
-                  }
-               }
-
-               // After the purge, if there is only one value, process the
-               // single element.
-               if ( joined_federate_name_map.size() == 1 ) {
-                  add_a_single_entry_into_running_feds();
-
-                  // Clear the entry after it is absorbed into running_feds.
-                  joined_federate_name_map.clear();
-               } else {
-                  // Process multiple joined_federate_name_map entries.
-                  clear_running_feds();
-                  ++running_feds_count;
-                  update_running_feds();
-
-                  // Clear the entries after they are absorbed into running_feds.
-                  joined_federate_name_map.clear();
-               }
-            }
-         }
+         // Clear the entries after they are absorbed into running_feds.
+         joined_federate_name_map.clear();
       }
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
@@ -1375,19 +1520,30 @@ void Federate::determine_federate_MOM_object_instance_names()
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
-bool Federate::is_required_federate(
-   wstring const &federate_name )
+void Federate::refresh_required_federate_name_set()
 {
+   required_federate_name_set.clear();
    for ( unsigned int i = 0; i < known_feds_count; ++i ) {
-      if ( known_feds[i].required ) {
+      if ( known_feds[i].required && ( known_feds[i].name != NULL ) ) {
          wstring required_fed_name;
          StringUtilities::to_wstring( required_fed_name, known_feds[i].name );
-         if ( federate_name == required_fed_name ) {
-            return true;
-         }
+         required_federate_name_set.insert( required_fed_name );
       }
    }
-   return false;
+   this->required_federate_name_set_built = true;
+}
+
+bool Federate::is_required_federate(
+   wstring const &federate_name )
+{
+   // Build the hashed required federate names on first use so checking all
+   // the joined federates is linear instead of quadratic in the federate
+   // count.
+   if ( !required_federate_name_set_built ) {
+      refresh_required_federate_name_set();
+   }
+   return ( required_federate_name_set.find( federate_name )
+            != required_federate_name_set.end() );
 }
 
 bool Federate::is_joined_federate(
@@ -1401,12 +1557,8 @@ bool Federate::is_joined_federate(
 bool Federate::is_joined_federate(
    wstring const &federate_name )
 {
-   for ( unsigned int i = 0; i < joined_federate_names.size(); ++i ) {
-      if ( federate_name == joined_federate_names[i] ) {
-         return true;
-      }
-   }
-   return false;
+   return ( joined_federate_name_set.find( federate_name )
+            != joined_federate_name_set.end() );
 }
 
 /*!
@@ -1414,6 +1566,9 @@ bool Federate::is_joined_federate(
  */
 string Federate::wait_for_required_federates_to_join()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Federate::wait_for_required_federates_to_join" );
+
    string status_string;
 
    // If the known Federates list is disabled then just return.
@@ -1466,13 +1621,23 @@ string Federate::wait_for_required_federates_to_join()
       // Display a summary of the required federate by name.
       send_hs( stdout, required_fed_summary.str().c_str() );
 
-      // Display a message that we are requesting the federate names.
-      send_hs( stdout, "Federate::wait_for_required_federates_to_join():%d Requesting list of joined federates from CRC.%c",
-               __LINE__, THLA_NEWLINE );
+      if ( !this->sync_point_join_detection ) {
+         // Display a message that we are requesting the federate names.
+         send_hs( stdout, "Federate::wait_for_required_federates_to_join():%d Requesting list of joined federates from CRC.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
    }
 
-   // Subscribe to Federate names using MOM interface and request an update.
-   ask_MOM_for_federate_names();
+   if ( this->sync_point_join_detection ) {
+      // Lightweight join protocol: announce ourself with a per-federate
+      // join sync-point and detect the other required federates from
+      // their announcements, with no MOM subscriptions or name-list
+      // reflections.
+      register_join_sync_point();
+   } else {
+      // Subscribe to Federate names using MOM interface and request an update.
+      ask_MOM_for_federate_names();
+   }
 
    size_t i, req_fed_cnt;
    size_t joined_fed_cnt = 0;
@@ -1608,6 +1773,14 @@ string Federate::wait_for_required_federates_to_join()
          if ( print_timer.timeout( wallclock_time ) ) {
             print_timer.reset();
             print_summary = true;
+
+            // Periodically re-announce our join sync-point so federates
+            // that joined after our previous announcement hear us, since
+            // a sync-point announcement only reaches the federates that
+            // are joined at registration time.
+            if ( this->sync_point_join_detection ) {
+               register_join_sync_point();
+            }
          }
       }
    }
@@ -1659,12 +1832,19 @@ string Federate::wait_for_required_federates_to_join()
       return status_string;
    }
 
-   // Unsubscribe from all attributes for the MOM HLAfederate class.
-   unsubscribe_all_HLAfederate_class_attributes_from_MOM();
+   if ( this->sync_point_join_detection ) {
+      // Final announcement: every required federate is joined by now, so
+      // this reaches any federate that joined after our last periodic
+      // announcement, letting it complete its own roster.
+      register_join_sync_point();
+   } else {
+      // Unsubscribe from all attributes for the MOM HLAfederate class.
+      unsubscribe_all_HLAfederate_class_attributes_from_MOM();
 
-   // Get the federate object instance names so that we can recover the
-   // instance handles for the MOM object associated with each federate.
-   determine_federate_MOM_object_instance_names();
+      // Get the federate object instance names so that we can recover the
+      // instance handles for the MOM object associated with each federate.
+      determine_federate_MOM_object_instance_names();
+   }
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::wait_for_required_federates_to_join():%d FOUND ALL REQUIRED FEDERATES!!!%c",
@@ -1679,6 +1859,13 @@ string Federate::wait_for_required_federates_to_join()
  */
 void Federate::initialize_MOM_handles()
 {
+   // The MOM handles are resolved lazily on first need and then reused,
+   // so there is nothing to do when they have already been resolved. Use
+   // refresh_MOM_handles() to force a re-resolution after a restore.
+   if ( this->MOM_handles_resolved ) {
+      return;
+   }
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -1891,6 +2078,37 @@ RTIinternalError for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLA
                __LINE__, THLA_NEWLINE );
    }
 
+   // Get the MOM Federate Host Attribute handle, which is used to detect
+   // federates that are co-located on the same host as this federate.
+   try {
+      this->MOM_HLAfederateHost_handle = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAfederateHost" );
+   } catch ( RTI1516_NAMESPACE::NameNotFound const &e ) {
+      error_flag = true;
+      send_hs( stderr, "Federate::initialize_MOM_handles():%d \
+NameNotFound ERROR for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLAfederateHost')%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_NAMESPACE::InvalidObjectClassHandle const &e ) {
+      error_flag = true;
+      send_hs( stderr, "Federate::initialize_MOM_handles():%d \
+InvalidObjectClassHandle ERROR for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLAfederateHost')%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_NAMESPACE::FederateNotExecutionMember const &e ) {
+      error_flag = true;
+      send_hs( stderr, "Federate::initialize_MOM_handles():%d \
+FederateNotExecutionMember ERROR for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLAfederateHost')%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_NAMESPACE::NotConnected const &e ) {
+      error_flag = true;
+      send_hs( stderr, "Federate::initialize_MOM_handles():%d \
+NotConnected ERROR for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLAfederateHost')%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_NAMESPACE::RTIinternalError const &e ) {
+      error_flag = true;
+      send_hs( stderr, "Federate::initialize_MOM_handles():%d \
+RTIinternalError for RTI_amb->getAttributrHandle(MOM_federate_class_handle, 'HLAfederateHost')%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
    // Interaction: HLAmanager.HLAfederation.HLAadjust.HLAsetSwitches
    //   Parameter: HLAautoProvide of type HLAswitches which is a HLAinteger32BE
    try {
@@ -1953,6 +2171,21 @@ RTIinternalError for RTI_amb->getParameterHandle(MOM_HLAsetSwitches_class_handle
    if ( error_flag ) {
       DebugHandler::terminate_with_message( "Federate::initialize_MOM_handles() ERROR Detected!" );
    }
+
+   this->MOM_handles_resolved = true;
+}
+
+void Federate::refresh_MOM_handles()
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::refresh_MOM_handles():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // Force a re-resolution of the MOM handles, which may have changed
+   // after a checkpoint restore.
+   this->MOM_handles_resolved = false;
+   initialize_MOM_handles();
 }
 
 void Federate::subscribe_attributes(
@@ -2150,6 +2383,7 @@ void Federate::ask_MOM_for_federate_names()
 
       // Clear the list of joined federate names.
       joined_federate_names.clear();
+      joined_federate_name_set.clear();
    }
 
    // Make sure the MOM handles get initialized before we try to use them.
@@ -2160,11 +2394,13 @@ void Federate::ask_MOM_for_federate_names()
    AttributeHandleSet fedMomAttributes;
    fedMomAttributes.insert( MOM_HLAfederateName_handle );
    fedMomAttributes.insert( MOM_HLAfederate_handle );
+   fedMomAttributes.insert( MOM_HLAfederateHost_handle );
    subscribe_attributes( MOM_HLAfederate_class_handle, fedMomAttributes );
 
    AttributeHandleSet requestedAttributes;
    requestedAttributes.insert( MOM_HLAfederateName_handle );
    requestedAttributes.insert( MOM_HLAfederate_handle );
+   requestedAttributes.insert( MOM_HLAfederateHost_handle );
    request_attribute_update( MOM_HLAfederate_class_handle, requestedAttributes );
 }
 
@@ -2566,10 +2802,70 @@ void Federate::achieve_synchronization_point(
    }
 }
 
+/*!
+ * @details The join sync-points are announcement-only and are never
+ * achieved, so they stay pending in the federation. The wall clock stamp
+ * in the label makes every registration unique, so the periodic
+ * re-announcements from the join wait loop and crash-rejoin cycles never
+ * collide with a still-pending label from an earlier registration.
+ */
+void Federate::register_join_sync_point()
+{
+   ostringstream label;
+   label << "_THLA_join_" << name << "." << clock_wall_time();
+
+   wstring label_ws;
+   StringUtilities::to_wstring( label_ws, label.str() );
+
+   register_generic_sync_point( label_ws );
+}
+
+/*!
+ * @details Called from the sync-point announcement callback on the RTI
+ * callback thread when the sync-point join detection mode is enabled.
+ */
+void Federate::process_join_sync_point_announcement(
+   wstring const &label )
+{
+   // Strip the label prefix and the trailing wall clock stamp to recover
+   // the joined federate name.
+   wstring      fed_name_ws = label.substr( JOIN_SYNC_POINT_PREFIX.length() );
+   size_t const stamp_pos   = fed_name_ws.rfind( L'.' );
+   if ( stamp_pos != wstring::npos ) {
+      fed_name_ws.erase( stamp_pos );
+   }
+
+   // Concurrency critical code section because the joined federate names
+   // are consumed by the wait loop in wait_for_required_federates_to_join().
+   //
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &joined_federate_mutex );
+
+   // Record the federate name if we have not seen it before. The hashed
+   // set detects a duplicate re-announcement in O(1).
+   if ( joined_federate_name_set.insert( fed_name_ws ).second ) {
+      joined_federate_names.push_back( fed_name_ws );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::process_join_sync_point_announcement():%d Federate '%ls' joined.%c",
+                  __LINE__, fed_name_ws.c_str(), THLA_NEWLINE );
+      }
+   }
+}
+
 void Federate::announce_sync_point(
    wstring const          &label,
    RTI1516_USERDATA const &user_supplied_tag )
 {
+   // Sync-point join detection: a required federate announces itself by
+   // registering a per-federate join sync-point, so record the joiner
+   // directly from the announcement instead of a MOM roster reflection.
+   // The join sync-points take no part in the execution control.
+   if ( this->sync_point_join_detection && is_join_sync_point_label( label ) ) {
+      process_join_sync_point_announcement( label );
+      return;
+   }
 
    // Dispatch this to the ExecutionControl process. It will check for
    // any synchronization points that require special handling.
@@ -2579,6 +2875,12 @@ void Federate::announce_sync_point(
 void Federate::sync_point_registration_succeeded(
    wstring const &label )
 {
+   // The announcement-only join sync-points take no part in the execution
+   // control.
+   if ( this->sync_point_join_detection && is_join_sync_point_label( label ) ) {
+      return;
+   }
+
    // Call the ExecutionControl method associated with the TirckHLA::Manager.
    execution_control->sync_point_registration_succeeded( label );
 }
@@ -2587,6 +2889,17 @@ void Federate::sync_point_registration_failed(
    wstring const &label,
    bool           not_unique )
 {
+   // The announcement-only join sync-point labels are unique per
+   // registration, so a failure is unexpected but must not feed the
+   // execution control. Report it and let the join wait loop re-announce.
+   if ( this->sync_point_join_detection && is_join_sync_point_label( label ) ) {
+      send_hs( stderr, "Federate::sync_point_registration_failed():%d Join sync-point '%ls' registration failed%s.%c",
+               __LINE__, label.c_str(),
+               ( not_unique ? " because the label is not unique" : "" ),
+               THLA_NEWLINE );
+      return;
+   }
+
    // Call the ExecutionControl method associated with the TirckHLA::Manager.
    execution_control->sync_point_registration_failed( label, not_unique );
 }
@@ -2842,7 +3155,7 @@ void Federate::setup_checkpoint()
             // Check for shutdown.
             check_for_shutdown_with_termination();
 
-            sleep_timer.sleep();
+            save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
             if ( !this->start_to_save ) {
 
@@ -2905,9 +3218,12 @@ void Federate::setup_checkpoint()
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
-   // This is a shortcut so that we can enforce that only these federates exist
-   // when we restore
-   write_running_feds_file( str_save_label );
+   // Record the running federates table so that we can enforce that only
+   // these federates exist when we restore. The versioned binary checkpoint
+   // blob is the only record written; the text running-feds file is no
+   // longer produced and the restore only parses it as a fallback for
+   // checkpoints created by older versions.
+   write_binary_checkpoint( str_save_label );
 
    // Tell the manager to setup the checkpoint data structures.
    manager->setup_checkpoint();
@@ -3073,8 +3389,12 @@ void Federate::setup_restore()
       // make sure we have a save directory specified
       check_HLA_save_directory();
 
-      // make sure only the required federates are in the federation before we do the restore
-      read_running_feds_file( str_restore_label );
+      // make sure only the required federates are in the federation before we
+      // do the restore. Use the binary checkpoint blob as a fast path and
+      // fall back to parsing the text running-feds file when it is missing.
+      if ( !read_binary_checkpoint( str_restore_label ) ) {
+         read_running_feds_file( str_restore_label );
+      }
 
       string return_string;
       return_string = wait_for_required_federates_to_join(); // sets running_feds_count
@@ -3098,7 +3418,7 @@ void Federate::setup_restore()
          // Check for shutdown.
          check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
          if ( !this->start_to_restore ) {
 
@@ -3199,6 +3519,10 @@ void Federate::post_restore()
       int     obj_count = manager->get_object_count();
       for ( unsigned int i = 0; i < obj_count; ++i ) {
          objects[i].restore_ownership_transfer_checkpointed_data();
+
+         // Rebuild any attribute staging buffers that were allocated
+         // outside checkpointed memory, at their checkpointed capacities.
+         objects[i].reinstate_transient_buffers();
       }
 
       // Macro to save the FPU Control Word register value.
@@ -3255,37 +3579,63 @@ void Federate::set_time_advance_granted(
 {
    Int64Time int64_time( time );
 
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+   bool granted = false;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
 
-   // Ignore any granted time less than the requested time otherwise it will
-   // break our concept of HLA time since we are using scheduled jobs for
-   // processing HLA data sends, receives, etc and expected the next granted
-   // time to match our requested time. Dan Dexter, 2/12/2007
-   if ( int64_time >= this->requested_time ) {
+      // Ignore any granted time less than the requested time otherwise it will
+      // break our concept of HLA time since we are using scheduled jobs for
+      // processing HLA data sends, receives, etc and expected the next granted
+      // time to match our requested time. Dan Dexter, 2/12/2007
+      if ( int64_time >= this->requested_time ) {
+         // The grant implies the federation GALT has advanced at least this
+         // far, so keep the cached GALT floored to the granted time for the
+         // GALT based time advance requests.
+         if ( int64_time.get_base_time() > this->cached_GALT_base_time ) {
+            this->cached_GALT_base_time = int64_time.get_base_time();
+         }
 
-      this->granted_time.set( int64_time );
 
-      // Record the granted time in the HLA_time variable, so we can plot it
-      // in Trick data products.
-      this->HLA_time = this->granted_time.get_time_in_seconds();
+         this->granted_time.set( int64_time );
 
-      this->time_adv_state = TIME_ADVANCE_GRANTED;
+         // Record the granted time in the HLA_time variable, so we can plot it
+         // in Trick data products.
+         this->HLA_time = this->granted_time.get_time_in_seconds();
 
-      if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-         send_hs( stdout, "Federate::set_time_advance_granted():%d Granted-time:%f, Requested-time:%f.%c",
-                  __LINE__, this->HLA_time, this->requested_time.get_time_in_seconds(),
-                  THLA_NEWLINE );
-      }
-   } else {
-      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-         send_hs( stdout, "Federate::set_time_advance_granted():%d WARNING: Federate \"%s\" \
+         this->time_adv_state = TIME_ADVANCE_GRANTED;
+         granted              = true;
+
+         // Mark the start of the frame busy time for the adaptive
+         // lookahead manager.
+         if ( this->adaptive_lookahead_enabled ) {
+            this->adaptive_lookahead_grant_clock = clock_wall_time();
+         }
+
+         if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::set_time_advance_granted():%d Granted-time:%f, Requested-time:%f.%c",
+                     __LINE__, this->HLA_time, this->requested_time.get_time_in_seconds(),
+                     THLA_NEWLINE );
+         }
+      } else {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::set_time_advance_granted():%d WARNING: Federate \"%s\" \
 IGNORING GRANTED TIME %.12G because it is less then requested time %.12G.%c",
-                  __LINE__, get_federate_name(), int64_time.get_time_in_seconds(),
-                  this->requested_time.get_time_in_seconds(), THLA_NEWLINE );
+                     __LINE__, get_federate_name(), int64_time.get_time_in_seconds(),
+                     this->requested_time.get_time_in_seconds(), THLA_NEWLINE );
+         }
       }
    }
+
+   // Wake up the sim thread blocked in wait_for_time_advance_grant(). The
+   // time advance state mutex is not held here to avoid a lock order
+   // inversion with the waiter.
+   if ( granted && this->time_adv_grant_wakeup ) {
+      pthread_mutex_lock( &time_adv_cond_mutex );
+      pthread_cond_broadcast( &time_adv_cond );
+      pthread_mutex_unlock( &time_adv_cond_mutex );
+   }
 }
 
 void Federate::set_granted_time(
@@ -3448,43 +3798,183 @@ void Federate::refresh_lookahead()
    set_lookahead( this->lookahead_time );
 }
 
-void Federate::time_advance_request_to_GALT()
+/*!
+ * @details Renegotiates only the RTI registered lookahead through
+ * modifyLookahead(). The configured nominal lookahead is left untouched
+ * because it defines the cyclic time step and the timestamps of the data we
+ * send, and changing it at run time would break the alignment between the
+ * Trick job frame and the HLA logical time line. Shrinking the RTI
+ * registered lookahead still reduces the latency other federates see
+ * because the greatest available logical time they compute from our time
+ * advance requests moves closer to our requested time.
+ */
+void Federate::update_adaptive_lookahead()
 {
-   // Simply return if we are the master federate that created the federation,
-   // or if time management is not enabled.
-   if ( !this->time_management || ( execution_control->is_master() && !execution_control->is_late_joiner() ) ) {
+   // One time initialization and configuration validation.
+   if ( this->adaptive_lookahead_base_time < 0 ) {
+      if ( ( this->adaptive_lookahead_min_time <= 0.0 )
+           || ( this->adaptive_lookahead_min_time > this->lookahead_time ) ) {
+         ostringstream errmsg;
+         errmsg << "Federate::update_adaptive_lookahead():" << __LINE__
+                << " ERROR: The adaptive lookahead minimum time ("
+                << this->adaptive_lookahead_min_time
+                << " seconds) must be greater than zero and must not exceed"
+                << " the configured nominal lookahead time ("
+                << this->lookahead_time << " seconds)!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      // The RTI registered lookahead starts out at the nominal lookahead
+      // set when time regulation was enabled.
+      this->adaptive_lookahead_base_time  = this->lookahead.get_base_time();
+      this->adaptive_lookahead_adjust_time = this->HLA_time;
+      return;
+   }
+
+   // We can only measure the frame busy time once we have seen at least
+   // one time advance grant.
+   if ( this->adaptive_lookahead_grant_clock <= 0 ) {
+      return;
+   }
+
+   // Measure the busy time from the last time advance grant to this time
+   // advance request, which is the compute time this federate actually
+   // needed for the frame.
+   double const busy_seconds = ( clock_wall_time() - this->adaptive_lookahead_grant_clock ) * 0.000001;
+   this->adaptive_lookahead_stats.sample( busy_seconds * 1000.0 );
+   if ( busy_seconds > this->adaptive_lookahead_window_max ) {
+      this->adaptive_lookahead_window_max = busy_seconds;
+   }
+
+   // The lookahead we need is the worst busy time observed in the current
+   // decision window plus the configured guard band, clamped between the
+   // user specified floor and the nominal lookahead ceiling.
+   double needed_time = this->adaptive_lookahead_window_max + this->adaptive_lookahead_guard_band;
+   if ( needed_time < this->adaptive_lookahead_min_time ) {
+      needed_time = this->adaptive_lookahead_min_time;
+   }
+   if ( needed_time > this->lookahead_time ) {
+      needed_time = this->lookahead_time;
+   }
+   int64_t const desired_base_time = Int64BaseTime::to_base_time( needed_time );
+
+   // Increases are applied immediately for safety. Reductions are rate
+   // limited so one quiet stretch does not cause lookahead thrash.
+   bool const raise_needed   = ( desired_base_time > this->adaptive_lookahead_base_time );
+   bool const period_elapsed = ( ( this->HLA_time - this->adaptive_lookahead_adjust_time )
+                                 >= this->adaptive_lookahead_period );
+   if ( !raise_needed && !period_elapsed ) {
       return;
    }
 
+   if ( desired_base_time != this->adaptive_lookahead_base_time ) {
+
+      // Macro to save the FPU Control Word register value.
+      TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+      try {
+         Int64Interval const desired_lookahead( desired_base_time );
+
+         // This is called before the time advance request is issued, so
+         // the federate is not in a time advancing state and the new
+         // lookahead takes effect with the next request.
+         RTI_ambassador->modifyLookahead( desired_lookahead.get() );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::update_adaptive_lookahead():%d %s RTI lookahead from %.12G to %.12G seconds (worst busy time %.12G seconds).%c",
+                     __LINE__,
+                     ( desired_base_time > this->adaptive_lookahead_base_time ) ? "Raised" : "Reduced",
+                     Int64BaseTime::to_seconds( this->adaptive_lookahead_base_time ),
+                     Int64BaseTime::to_seconds( desired_base_time ),
+                     this->adaptive_lookahead_window_max, THLA_NEWLINE );
+         }
+         this->adaptive_lookahead_base_time = desired_base_time;
+
+      } catch ( InvalidLookahead const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: InvalidLookahead%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( InTimeAdvancingState const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: InTimeAdvancingState%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( FederateNotExecutionMember const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: FederateNotExecutionMember%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( SaveInProgress const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: SaveInProgress%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( RestoreInProgress const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: RestoreInProgress%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( NotConnected const &e ) {
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: NotConnected%c",
+                  __LINE__, THLA_NEWLINE );
+      } catch ( RTIinternalError const &e ) {
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         send_hs( stderr, "Federate::update_adaptive_lookahead():%d EXCEPTION: RTIinternalError: '%s'%c",
+                  __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
+      }
+
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+   }
+
+   // Start a new decision window.
+   this->adaptive_lookahead_window_max  = 0.0;
+   this->adaptive_lookahead_adjust_time = this->HLA_time;
+}
+
+bool Federate::query_GALT_base_time(
+   int64_t &galt_base_time )
+{
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+
+      if ( this->cached_GALT_fresh ) {
+         // Consume the cached query result so a later frame falls back to
+         // the query below unless the cache is refreshed again.
+         this->cached_GALT_fresh = false;
+         galt_base_time          = this->cached_GALT_base_time;
+         return true;
+      }
+   }
+
+   // The cache is stale so fall back to the queryGALT() RTI round trip.
+   bool have_GALT = false;
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
    try {
       HLAinteger64Time time;
       if ( RTI_ambassador->queryGALT( time ) ) {
-         int64_t L = lookahead.get_base_time();
-         if ( L > 0 ) {
-            int64_t GALT = time.getTime();
+         galt_base_time = time.getTime();
+         have_GALT      = true;
 
-            // Make sure the time is an integer multiple of the lookahead time.
-            time.setTime( ( ( GALT / L ) + 1 ) * L );
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+         if ( galt_base_time > this->cached_GALT_base_time ) {
+            this->cached_GALT_base_time = galt_base_time;
          }
-         set_requested_time( time );
       }
    } catch ( FederateNotExecutionMember const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT():%d Query-GALT EXCEPTION: FederateNotExecutionMember%c",
+      send_hs( stderr, "Federate::query_GALT_base_time():%d Query-GALT EXCEPTION: FederateNotExecutionMember%c",
                __LINE__, THLA_NEWLINE );
    } catch ( SaveInProgress const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT():%d Query-GALT EXCEPTION: SaveInProgress%c",
+      send_hs( stderr, "Federate::query_GALT_base_time():%d Query-GALT EXCEPTION: SaveInProgress%c",
                __LINE__, THLA_NEWLINE );
    } catch ( RestoreInProgress const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT():%d Query-GALT EXCEPTION: RestoreInProgress%c",
+      send_hs( stderr, "Federate::query_GALT_base_time():%d Query-GALT EXCEPTION: RestoreInProgress%c",
                __LINE__, THLA_NEWLINE );
    } catch ( NotConnected const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT():%d Query-GALT EXCEPTION: NotConnected%c",
+      send_hs( stderr, "Federate::query_GALT_base_time():%d Query-GALT EXCEPTION: NotConnected%c",
                __LINE__, THLA_NEWLINE );
    } catch ( RTIinternalError const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT():%d Query-GALT EXCEPTION: RTIinternalError%c",
+      send_hs( stderr, "Federate::query_GALT_base_time():%d Query-GALT EXCEPTION: RTIinternalError%c",
                __LINE__, THLA_NEWLINE );
    }
 
@@ -3492,63 +3982,105 @@ void Federate::time_advance_request_to_GALT()
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
-   if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-      send_hs( stdout, "Federate::time_advance_request_to_GALT():%d Requested-Time:%lf%c",
-               __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
-   }
-
-   // Perform the time-advance request to go to the requested time.
-   perform_time_advance_request();
+   return have_GALT;
 }
 
-void Federate::time_advance_request_to_GALT_LCTS_multiple()
+void Federate::refresh_GALT_cache()
 {
-   // Simply return if we are the master federate that created the federation,
-   // or if time management is not enabled.
-   if ( !this->time_management || ( execution_control->is_master() && !execution_control->is_late_joiner() ) ) {
+   // Nothing to cache if time management is not enabled.
+   if ( !this->time_management ) {
       return;
    }
 
-   // Setup the Least-Common-Time-Step time value.
-   int64_t LCTS = execution_control->get_least_common_time_step();
-   if ( LCTS <= 0 ) {
-      LCTS = lookahead.get_base_time();
-   }
-
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
    try {
       HLAinteger64Time time;
       if ( RTI_ambassador->queryGALT( time ) ) {
-         if ( LCTS > 0 ) {
-            int64_t GALT = time.getTime();
-
-            // Make sure the time is an integer multiple of the LCTS time.
-            time.setTime( ( ( GALT / LCTS ) + 1 ) * LCTS );
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+         if ( time.getTime() > this->cached_GALT_base_time ) {
+            this->cached_GALT_base_time = time.getTime();
          }
-         set_requested_time( time );
+         this->cached_GALT_fresh = true;
       }
    } catch ( FederateNotExecutionMember const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Query-GALT EXCEPTION: FederateNotExecutionMember%c",
+      send_hs( stderr, "Federate::refresh_GALT_cache():%d Query-GALT EXCEPTION: FederateNotExecutionMember%c",
                __LINE__, THLA_NEWLINE );
    } catch ( SaveInProgress const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Query-GALT EXCEPTION: SaveInProgress%c",
+      send_hs( stderr, "Federate::refresh_GALT_cache():%d Query-GALT EXCEPTION: SaveInProgress%c",
                __LINE__, THLA_NEWLINE );
    } catch ( RestoreInProgress const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Query-GALT EXCEPTION: RestoreInProgress%c",
+      send_hs( stderr, "Federate::refresh_GALT_cache():%d Query-GALT EXCEPTION: RestoreInProgress%c",
                __LINE__, THLA_NEWLINE );
    } catch ( NotConnected const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Query-GALT EXCEPTION: NotConnected%c",
+      send_hs( stderr, "Federate::refresh_GALT_cache():%d Query-GALT EXCEPTION: NotConnected%c",
                __LINE__, THLA_NEWLINE );
    } catch ( RTIinternalError const &e ) {
-      send_hs( stderr, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Query-GALT EXCEPTION: RTIinternalError%c",
+      send_hs( stderr, "Federate::refresh_GALT_cache():%d Query-GALT EXCEPTION: RTIinternalError%c",
                __LINE__, THLA_NEWLINE );
    }
 
    // Macro to restore the saved FPU Control Word register value.
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+void Federate::time_advance_request_to_GALT()
+{
+   // Simply return if we are the master federate that created the federation,
+   // or if time management is not enabled.
+   if ( !this->time_management || ( execution_control->is_master() && !execution_control->is_late_joiner() ) ) {
+      return;
+   }
+
+   int64_t GALT;
+   if ( query_GALT_base_time( GALT ) ) {
+      HLAinteger64Time time( GALT );
+
+      int64_t const L = lookahead.get_base_time();
+      if ( L > 0 ) {
+         // Make sure the time is an integer multiple of the lookahead time.
+         time.setTime( ( ( GALT / L ) + 1 ) * L );
+      }
+      set_requested_time( time );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::time_advance_request_to_GALT():%d Requested-Time:%lf%c",
+               __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
+   }
+
+   // Perform the time-advance request to go to the requested time.
+   perform_time_advance_request();
+}
+
+void Federate::time_advance_request_to_GALT_LCTS_multiple()
+{
+   // Simply return if we are the master federate that created the federation,
+   // or if time management is not enabled.
+   if ( !this->time_management || ( execution_control->is_master() && !execution_control->is_late_joiner() ) ) {
+      return;
+   }
+
+   // Setup the Least-Common-Time-Step time value.
+   int64_t LCTS = execution_control->get_least_common_time_step();
+   if ( LCTS <= 0 ) {
+      LCTS = lookahead.get_base_time();
+   }
+
+   int64_t GALT;
+   if ( query_GALT_base_time( GALT ) ) {
+      HLAinteger64Time time( GALT );
+
+      if ( LCTS > 0 ) {
+         // Make sure the time is an integer multiple of the LCTS time.
+         time.setTime( ( ( GALT / LCTS ) + 1 ) * LCTS );
+      }
+      set_requested_time( time );
+   }
 
    if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::time_advance_request_to_GALT_LCTS_multiple():%d Requested-Time:%lf%c",
@@ -3939,6 +4471,9 @@ void Federate::join_federation(
  */
 void Federate::create_and_join_federation()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Federate::create_and_join_federation" );
+
    if ( this->federation_joined ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
          ostringstream errmsg;
@@ -4077,6 +4612,79 @@ void Federate::enable_async_delivery()
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
+/*!
+ * @details Failure to enable the advisory switch is not fatal since the
+ * relevance advisory is an optimization. Without it, attributes default to
+ * having their updates turned on and are always sent.
+ * @job_class{initialization}
+ */
+void Federate::enable_attribute_relevance_advisory()
+{
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   // Sanity check.
+   if ( RTI_ambassador.get() == NULL ) {
+      DebugHandler::terminate_with_message( "Federate::enable_attribute_relevance_advisory() ERROR: NULL pointer to RTIambassador!" );
+   }
+
+   try {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::enable_attribute_relevance_advisory():%d Enabling Attribute Relevance Advisory %c",
+                  __LINE__, THLA_NEWLINE );
+      }
+
+      // Turn on attribute relevance advisories so the RTI will tell us with
+      // the turnUpdatesOnForObjectInstance() and
+      // turnUpdatesOffForObjectInstance() callbacks which of our published
+      // attributes actually have remote subscribers. Attributes with no
+      // remote subscribers are then skipped when sending cyclic updates.
+      RTI_ambassador->enableAttributeRelevanceAdvisorySwitch();
+   } catch ( AttributeRelevanceAdvisorySwitchIsOn const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d EXCEPTION: AttributeRelevanceAdvisorySwitchIsOn%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( SaveInProgress const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d EXCEPTION: SaveInProgress%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RestoreInProgress const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d EXCEPTION: RestoreInProgress%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( FederateNotExecutionMember const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d EXCEPTION: FederateNotExecutionMember%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( NotConnected const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d EXCEPTION: NotConnected%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "Federate::enable_attribute_relevance_advisory():%d \"%s\": Unexpected RTI exception!\nRTI Exception: RTIinternalError: '%s'\n%c",
+               __LINE__, get_federation_name(), rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
 /*!
  * @job_class{shutdown}
  */
@@ -4653,6 +5261,21 @@ void Federate::perform_time_advance_request()
       return;
    }
 
+   // Renegotiate the RTI registered lookahead from the achieved frame
+   // timing. This must happen before the time advance request below
+   // because modifyLookahead() is not allowed while the federate is in a
+   // time advancing state.
+   if ( this->adaptive_lookahead_enabled ) {
+      update_adaptive_lookahead();
+   }
+
+   // Make sure every queued outbound submission has been handed to the RTI
+   // before the time advance request so the Timestamp Order messages for
+   // the current logical time precede the advance.
+   if ( this->use_rti_submission_proxy ) {
+      this->rti_submitter.flush();
+   }
+
    // -- start of checkpoint additions --
    this->save_completed = false; // reset ONLY at the bottom of the frame...
    // -- end of checkpoint additions --
@@ -4680,8 +5303,16 @@ void Federate::perform_time_advance_request()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
+      // Zero-lookahead requires TARA, and the user can also select a
+      // TARA-first cyclic advance so the grant is not held up waiting for
+      // messages stamped exactly at the requested time. Those messages are
+      // delivered after the grant and get picked up by the blocking cyclic
+      // reads, overlapping the receive-side decode with the rest of the
+      // frame.
+      bool const use_TARA = is_zero_lookahead_time() || this->use_TARA_for_cyclic_advance;
+
       if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-         if ( is_zero_lookahead_time() ) {
+         if ( use_TARA ) {
             send_hs( stdout, "Federate::perform_time_advance_request():%d Time Advance Request Available (TARA) to %.12G seconds.%c",
                      __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
          } else {
@@ -4695,7 +5326,7 @@ void Federate::perform_time_advance_request()
          // the mutex even if there is an exception.
          MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
 
-         if ( is_zero_lookahead_time() ) {
+         if ( use_TARA ) {
             // Request that time be advanced to the new time, but still allow
             // TSO data for Treq = Tgrant
             RTI_ambassador->timeAdvanceRequestAvailable( requested_time.get() );
@@ -4907,14 +5538,23 @@ void Federate::wait_for_zero_lookahead_TARA_TAG()
 
       int64_t      wallclock_time;
       SleepTimeout print_timer( this->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      AdaptiveSleepTimeout sleep_timer( THLA_DEFAULT_SLEEP_TIMEOUT_IN_SEC,
+                                        THLA_LOW_LATENCY_MAX_BACKOFF_IN_MICROS,
+                                        THLA_DEFAULT_SPIN_BUDGET_IN_MICROS );
 
       // This spin lock waits for the time advance grant from the RTI.
       do {
          // Check for shutdown.
          check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         if ( this->time_adv_grant_wakeup ) {
+            // Wait for the FedAmb callback thread to signal the grant
+            // directly, with an optional bounded spin first for very low
+            // latency grants.
+            spin_then_block_for_time_adv_grant();
+         } else {
+            sleep_timer.sleep();
+         }
 
          {
             // When auto_unlock_mutex goes out of scope it automatically unlocks
@@ -4969,6 +5609,24 @@ void Federate::associate_to_trick_child_thread(
    this->thread_coordinator.associate_to_trick_child_thread( thread_id, data_cycle );
 }
 
+/*!
+ * @brief Associate a Trick child thread with TrickHLA, with optional CPU
+ * affinity pinning for NUMA node-local buffer placement.
+ */
+void Federate::associate_to_trick_child_thread(
+   unsigned int const thread_id,
+   double const       data_cycle,
+   int const          cpu_id )
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::associate_to_trick_child_thread():%d Trick child thread (id:%d, data_cycle:%.3f, cpu_id:%d).%c",
+               __LINE__, thread_id, data_cycle, cpu_id, THLA_NEWLINE );
+   }
+
+   // Delegate to the Trick child thread coordinator.
+   this->thread_coordinator.associate_to_trick_child_thread( thread_id, data_cycle, cpu_id );
+}
+
 /*!
  * @brief Disable the comma separated list of Trick child thread IDs associated to TrickHLA.
  */
@@ -5055,6 +5713,16 @@ int64_t const Federate::get_data_cycle_base_time_for_obj(
    return this->thread_coordinator.get_data_cycle_base_time_for_obj( obj_index, default_data_cycle_base_time );
 }
 
+/*! @brief Advance the precomputed per-object data cycle schedule tables to
+ * the specified simulation time. Must be called from the Trick main thread
+ * before the per-object boundary checks are made for the same time. */
+void Federate::advance_data_cycle_schedule(
+   int64_t const sim_time_in_base_time )
+{
+   // Delegate to the Trick child thread coordinator.
+   this->thread_coordinator.advance_data_cycle_schedule( sim_time_in_base_time );
+}
+
 /*! @brief Is the object for the given index on a data cycle boundary. */
 bool const Federate::on_data_cycle_boundary_for_obj(
    unsigned int const obj_index,
@@ -5064,6 +5732,54 @@ bool const Federate::on_data_cycle_boundary_for_obj(
    return this->thread_coordinator.on_receive_data_cycle_boundary_for_obj( obj_index, sim_time_in_base_time );
 }
 
+/*! @brief Is the object for the given index on a send data cycle boundary,
+ * which includes the object's configured send phase offset. */
+bool const Federate::on_send_data_cycle_boundary_for_obj(
+   unsigned int const obj_index,
+   int64_t const      sim_time_in_base_time ) const
+{
+   // Delegate to the Trick child thread coordinator.
+   return this->thread_coordinator.on_send_data_cycle_boundary_for_obj( obj_index, sim_time_in_base_time );
+}
+
+/*! @brief Initialize the pool of data job worker threads used to process
+ * per-object send and receive jobs in parallel. */
+void Federate::initialize_data_job_workers(
+   unsigned int const worker_count )
+{
+   // Delegate to the Trick child thread coordinator.
+   this->thread_coordinator.initialize_data_job_workers( worker_count );
+}
+
+/*! @brief Determine if the data job worker pool has been initialized. */
+bool Federate::is_data_job_workers_enabled() const
+{
+   // Delegate to the Trick child thread coordinator.
+   return this->thread_coordinator.is_data_job_workers_enabled();
+}
+
+/*! @brief Configure the adaptive, cost-driven scheduling of the parallel
+ * per-object data jobs. */
+void Federate::configure_adaptive_job_scheduling(
+   bool const         enable,
+   unsigned int const rebalance_period )
+{
+   // Delegate to the Trick child thread coordinator.
+   this->thread_coordinator.configure_adaptive_job_scheduling( enable, rebalance_period );
+}
+
+/*! @brief Execute the given job for all the object indices, distributing the
+ * work across the data job worker threads, and return once all the jobs have
+ * completed. */
+void Federate::execute_object_data_jobs(
+   TrickThreadCoordinator::ObjectJobFn job,
+   void                               *user_data,
+   unsigned int const                  job_count )
+{
+   // Delegate to the Trick child thread coordinator.
+   this->thread_coordinator.execute_object_jobs( job, user_data, job_count );
+}
+
 /*! @brief Send zero lookahead or requested data for the specified object instance. */
 void Federate::send_zero_lookahead_and_requested_data(
    string const &obj_instance_name )
@@ -5128,7 +5844,12 @@ void Federate::wait_to_receive_zero_lookahead_data(
 
       int64_t      wallclock_time; // cppcheck-suppress [variableScope]
       SleepTimeout print_timer( this->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout wait_timer;
+
+      // The bound on each data arrival wait so another TARA is issued and
+      // the shutdown and execution member checks run even if no data is
+      // ever reflected for this object.
+      double const data_arrival_wait_seconds = (double)THLA_DEFAULT_SLEEP_WAIT_IN_MICROS * 0.000001;
 
       // Block waiting for the named object instance data by repeatedly doing a
       // TARA and wait for TAG with a zero lookahead.
@@ -5137,13 +5858,16 @@ void Federate::wait_to_receive_zero_lookahead_data(
          // Check for shutdown.
          check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         // Block on the object's data arrival condition, which is signaled
+         // directly from the reflection callback, so the wake happens at
+         // thread notify cost instead of after a sleep quantum expires.
+         obj->wait_for_data_arrival( data_arrival_wait_seconds );
 
          // To be more efficient, we get the time once and share it.
-         wallclock_time = sleep_timer.time();
+         wallclock_time = wait_timer.time();
 
-         if ( sleep_timer.timeout( wallclock_time ) ) {
-            sleep_timer.reset();
+         if ( wait_timer.timeout( wallclock_time ) ) {
+            wait_timer.reset();
             if ( !is_execution_member() ) {
                ostringstream errmsg;
                errmsg << "Federate::wait_to_receive_zero_lookahead_data():" << __LINE__
@@ -5174,8 +5898,63 @@ void Federate::wait_to_receive_zero_lookahead_data(
 /*!
  *  @job_class{scheduled}
  */
+/*!
+ * @details The waiter holds the condition variable mutex across the time
+ * advance state check and the wait, and the FedAmb callback only broadcasts
+ * while holding the same mutex, so a grant signaled between the check and
+ * the wait cannot be missed. A bounded timed wait is still used so the
+ * caller can periodically check for shutdown. The caller is expected to
+ * re-check the time advance state after this function returns.
+ */
+void Federate::spin_then_block_for_time_adv_grant()
+{
+   // Optional bounded busy-spin before blocking, which avoids the wakeup
+   // latency of the condition variable when grants arrive within a few
+   // microseconds of the request.
+   if ( this->time_adv_grant_spin_micros > 0 ) {
+      SleepTimeout spin_timer( (double)this->time_adv_grant_spin_micros / 1000000.0, 0 );
+      while ( !spin_timer.timeout() ) {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+         if ( this->time_adv_state == TIME_ADVANCE_GRANTED ) {
+            return;
+         }
+      }
+   }
+
+   pthread_mutex_lock( &time_adv_cond_mutex );
+
+   bool granted;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+      granted = ( this->time_adv_state == TIME_ADVANCE_GRANTED );
+   }
+
+   if ( !granted ) {
+      // Bounded timed wait of 10 milliseconds so the caller can still
+      // periodically check for shutdown.
+      struct timespec abs_timeout;
+      clock_gettime( CLOCK_REALTIME, &abs_timeout );
+      abs_timeout.tv_nsec += 10000000L;
+      if ( abs_timeout.tv_nsec >= 1000000000L ) {
+         abs_timeout.tv_sec += 1;
+         abs_timeout.tv_nsec -= 1000000000L;
+      }
+      pthread_cond_timedwait( &time_adv_cond, &time_adv_cond_mutex, &abs_timeout );
+   }
+
+   pthread_mutex_unlock( &time_adv_cond_mutex );
+}
+
 void Federate::wait_for_time_advance_grant()
 {
+   // This job marks the start of a new data cycle frame, so close out and
+   // evaluate the previous frame against the declared budgets.
+   frame_watchdog.begin_frame();
+
    // Skip requesting time-advancement if time management is not enabled.
    if ( !this->time_management ) {
       return;
@@ -5190,6 +5969,21 @@ void Federate::wait_for_time_advance_grant()
       return;
    }
 
+#ifdef THLA_TIME_ADV_GRANT_TIME_STATS
+   // Measure the time spent waiting for the time advance grant.
+   ElapsedTimeStats::ScopedTimer grant_timer( time_adv_grant_stats );
+#endif
+
+   // Trace the grant wait stage.
+   THLA_TRACEPOINT_SCOPE( "Federate::wait_for_time_advance_grant" );
+
+   // Record the grant wait into the live performance counters.
+   Metrics::GrantWaitScope metrics_grant_scope;
+
+   // Measure the grant wait stage of the frame for the budget watchdog.
+   FrameBudgetWatchdog::ScopedStage watchdog_stage( frame_watchdog,
+                                                    FrameBudgetWatchdog::STAGE_WAIT_FOR_GRANT );
+
    unsigned short state;
    {
       // When auto_unlock_mutex goes out of scope it automatically unlocks the
@@ -5209,13 +6003,19 @@ void Federate::wait_for_time_advance_grant()
    if ( state != TIME_ADVANCE_GRANTED ) {
 
       if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-         send_hs( stdout, "Federate::wait_for_time_advance_grant():%d Waiting for Time Advance Grant (TAG) to %.12G seconds.%c",
-                  __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
+         ostringstream msg;
+         msg << "Federate::wait_for_time_advance_grant():" << __LINE__
+             << " Waiting for Time Advance Grant (TAG) to "
+             << requested_time.get_time_in_seconds() << " seconds."
+             << THLA_NEWLINE;
+         DebugHandler::print( msg.str() );
       }
 
       int64_t      wallclock_time;
       SleepTimeout print_timer( this->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      AdaptiveSleepTimeout sleep_timer( THLA_DEFAULT_SLEEP_TIMEOUT_IN_SEC,
+                                        THLA_LOW_LATENCY_MAX_BACKOFF_IN_MICROS,
+                                        THLA_DEFAULT_SPIN_BUDGET_IN_MICROS );
 
       // This spin lock waits for the time advance grant from the RTI.
       do {
@@ -5328,6 +6128,162 @@ void Federate::shutdown()
       }
 #endif
 
+#ifdef THLA_CYCLIC_SEND_TIME_STATS
+      for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Object[" << i << "]:'" << this->manager->objects[i].get_name() << "'"
+             << " send time "
+             << this->manager->objects[i].send_time_stats.to_string()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+#endif
+
+      // Summarize the one-way latency survey for the objects it was
+      // enabled on.
+      for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+         if ( this->manager->objects[i].latency_survey ) {
+            ostringstream msg;
+            msg << "Federate::shutdown():" << __LINE__
+                << " Object[" << i << "]:'" << this->manager->objects[i].get_name() << "'"
+                << " one-way latency "
+                << this->manager->objects[i].latency_stats.to_string()
+                << endl;
+            send_hs( stdout, msg.str().c_str() );
+         }
+      }
+
+#ifdef THLA_TIME_ADV_GRANT_TIME_STATS
+      {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Time advance grant wait "
+             << this->time_adv_grant_stats.to_string()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+#endif
+
+      if ( this->frame_watchdog.enabled ) {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Frame budget watchdog "
+             << this->frame_watchdog.to_string()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+
+      if ( this->send_pacer.enabled ) {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " " << this->send_pacer.to_string()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+
+#ifdef THLA_QUEUE_DEPTH_STATS
+      for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Object[" << i << "]:'" << this->manager->objects[i].get_name() << "'"
+             << " reflected attributes queue high-water mark:"
+             << this->manager->objects[i].get_reflected_attributes_queue_high_water_mark()
+             << " dropped:"
+             << this->manager->objects[i].get_reflected_attributes_queue_dropped_count()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+      {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Interactions queue high-water mark:"
+             << this->manager->get_interactions_queue_high_water_mark()
+             << " dropped:"
+             << this->manager->get_interactions_queue_dropped_count()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+#endif
+
+      // Dump the per-attribute wire-traffic top-talkers reports when the
+      // wire-traffic accounting mode is enabled.
+      if ( this->wire_traffic_report ) {
+
+         // Per-object top-talkers reports.
+         for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+            ostringstream msg;
+            msg << "Federate::shutdown():" << __LINE__ << " "
+                << this->manager->objects[i].wire_traffic_to_string()
+                << endl;
+            send_hs( stdout, msg.str().c_str() );
+         }
+
+         // Federation-wide top-talkers report across all the objects,
+         // sorted by total encoded bytes.
+         vector< pair< long long, string > > talkers;
+         for ( unsigned int i = 0; i < this->manager->obj_count; ++i ) {
+            Object const &obj = this->manager->objects[i];
+            for ( int k = 0; k < obj.attr_count; ++k ) {
+               Attribute const &attr = obj.attributes[k];
+               long long const  total_bytes =
+                  attr.bytes_sent_count + attr.bytes_received_count;
+               if ( ( attr.updates_sent_count > 0 )
+                    || ( attr.updates_received_count > 0 ) ) {
+                  ostringstream line;
+                  line << "\n   '" << obj.get_name_string() << "'.'"
+                       << attr.get_FOM_name() << "'"
+                       << " total:" << total_bytes << " bytes"
+                       << " sent:" << attr.updates_sent_count
+                       << " updates/" << attr.bytes_sent_count << " bytes"
+                       << " received:" << attr.updates_received_count
+                       << " updates/" << attr.bytes_received_count << " bytes";
+                  talkers.push_back( pair< long long, string >( total_bytes, line.str() ) );
+               }
+            }
+         }
+         sort( talkers.rbegin(), talkers.rend() );
+
+         // Only report the top talkers since large federations can have
+         // thousands of attributes.
+         unsigned int const max_talkers = 20;
+
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Federation-wide wire-traffic top talkers:";
+         if ( talkers.empty() ) {
+            msg << " no attribute traffic recorded.";
+         } else {
+            for ( unsigned int n = 0; ( n < talkers.size() ) && ( n < max_talkers ); ++n ) {
+               msg << talkers[n].second;
+            }
+            if ( talkers.size() > max_talkers ) {
+               msg << "\n   ... and " << ( talkers.size() - max_talkers )
+                   << " more attributes with traffic.";
+            }
+         }
+         msg << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+
+      {
+         ostringstream msg;
+         msg << "Federate::shutdown():" << __LINE__
+             << " Allocation accounting"
+             << AllocationTracker::to_string()
+             << endl;
+         send_hs( stdout, msg.str().c_str() );
+      }
+
+#ifdef THLA_MUTEX_LOCK_STATS
+      MutexLock::print_statistics();
+#endif
+
+#ifdef THLA_TRACEPOINTS
+      // Dump the recorded data path trace for chrome://tracing or Perfetto.
+      Tracepoint::dump( "trickhla_trace.json" );
+#endif
+
       // Macro to save the FPU Control Word register value.
       TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -5341,6 +6297,18 @@ void Federate::shutdown()
       // Disable Time Constrained and Time Regulation for this federate.
       this->shutdown_time_management();
 
+      // Activate the fast teardown mode when the federation is being
+      // abandoned. The resign below uses CANCEL_THEN_DELETE_THEN_DIVEST,
+      // which has the RTI do the per-object delete and divest work in one
+      // call, so the per-object deleteObjectInstance calls and the
+      // per-variable Trick memory frees in the destructors are skipped
+      // and the operating system reclaims the process memory in bulk at
+      // exit. Rejoining needs the orderly resign, so the flag is ignored
+      // when the federate can rejoin.
+      if ( this->fast_teardown && !this->can_rejoin_federation ) {
+         Federate::fast_teardown_active = true;
+      }
+
       // Resign from the federation.
       // If the federate can rejoin, resign in a way so we can rejoin later...
       if ( this->can_rejoin_federation ) {
@@ -5357,6 +6325,10 @@ void Federate::shutdown()
          this->execution_control->remove_execution_configuration();
       }
 
+      // Shutdown the background debug message logger, draining any queued
+      // debug messages.
+      DebugHandler::shutdown_async_logging();
+
       // Macro to restore the saved FPU Control Word register value.
       TRICKHLA_RESTORE_FPU_CONTROL_WORD;
 
@@ -6072,8 +7044,7 @@ void Federate::ask_MOM_for_auto_provide_setting()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      // Sleep a little while to wait for the information to update.
-      sleep_timer.sleep();
+      MOM_auto_provide_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( this->auto_provide_setting < 0 ) {
 
@@ -6135,6 +7106,9 @@ void Federate::enable_MOM_auto_provide_setting(
                __LINE__, ( enable ? "Yes" : "No" ), THLA_NEWLINE );
    }
 
+   // Make sure the MOM handles get initialized before we try to use them.
+   initialize_MOM_handles();
+
    publish_interaction_class( MOM_HLAsetSwitches_class_handle );
 
    ParameterHandleValueMap param_values_map;
@@ -6475,58 +7449,126 @@ void Federate::update_running_feds()
    }
 }
 
-void Federate::add_a_single_entry_into_running_feds()
+void Federate::add_or_update_a_single_entry_into_running_feds(
+   wstring const &mom_instance_name,
+   wstring const &fed_name )
 {
-   // Allocate a new structure to absorb the original values plus the new one.
+   string mom_instance_name_str;
+   string fed_name_str;
+   StringUtilities::to_string( mom_instance_name_str, mom_instance_name );
+   StringUtilities::to_string( fed_name_str, fed_name );
+
+   // Update the entry in place when the federate is already in the roster.
+   for ( unsigned int i = 0; i < running_feds_count; ++i ) {
+      if ( ( running_feds[i].name != NULL )
+           && ( fed_name_str.compare( running_feds[i].name ) == 0 ) ) {
+
+         if ( ( running_feds[i].MOM_instance_name == NULL )
+              || ( mom_instance_name_str.compare( running_feds[i].MOM_instance_name ) != 0 ) ) {
+            if ( running_feds[i].MOM_instance_name != NULL ) {
+               if ( trick_MM->delete_var( static_cast< void * >( running_feds[i].MOM_instance_name ) ) ) {
+                  send_hs( stderr, "Federate::add_or_update_a_single_entry_into_running_feds():%d ERROR deleting Trick Memory for 'running_feds[i].MOM_instance_name'%c",
+                           __LINE__, THLA_NEWLINE );
+               }
+            }
+            running_feds[i].MOM_instance_name = StringUtilities::ip_strdup_wstring( mom_instance_name );
+         }
+         return;
+      }
+   }
+
+   // Not in the roster, so allocate a new structure to absorb the original
+   // values plus the new one.
    KnownFederate *temp_feds;
    temp_feds = reinterpret_cast< KnownFederate * >(
       alloc_type( running_feds_count + 1, "TrickHLA::KnownFederate" ) );
 
    if ( temp_feds == NULL ) {
       ostringstream errmsg;
-      errmsg << "Federate::add_a_single_entry_into_running_feds():" << __LINE__
+      errmsg << "Federate::add_or_update_a_single_entry_into_running_feds():" << __LINE__
              << " ERROR: Could not allocate memory for temp_feds when attempting to add"
              << " an entry into running_feds!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
 
    } else {
 
-      // copy current running_feds entries into temporary structure...
+      // Move the current running_feds entries into the temporary structure.
+      // The entries keep their existing Trick memory strings, so growing the
+      // roster does not reallocate a string for every entry.
       for ( unsigned int i = 0; i < running_feds_count; ++i ) {
-         temp_feds[i].MOM_instance_name = trick_MM->mm_strdup( running_feds[i].MOM_instance_name );
-         temp_feds[i].name              = trick_MM->mm_strdup( running_feds[i].name );
+         temp_feds[i].MOM_instance_name = running_feds[i].MOM_instance_name;
+         temp_feds[i].name              = running_feds[i].name;
          temp_feds[i].required          = running_feds[i].required;
       }
 
-      TrickHLAObjInstanceNameMap::const_iterator map_iter;
-      map_iter                                        = joined_federate_name_map.begin();
-      temp_feds[running_feds_count].MOM_instance_name = StringUtilities::ip_strdup_wstring( mom_HLAfederate_inst_name_map[map_iter->first].c_str() );
-      temp_feds[running_feds_count].name              = StringUtilities::ip_strdup_wstring( map_iter->second.c_str() );
-      temp_feds[running_feds_count].required          = true;
+      temp_feds[running_feds_count].MOM_instance_name = StringUtilities::ip_strdup_wstring( mom_instance_name );
+      temp_feds[running_feds_count].name              = StringUtilities::ip_strdup_wstring( fed_name );
 
-      // delete running_feds data structure.
-      clear_running_feds();
+      // If the federate was running at the time of the checkpoint, it must be
+      // a 'required' federate in the restore, regardless if it is was required
+      // when the federation originally started up.
+      temp_feds[running_feds_count].required = true;
+
+      // Delete just the old running_feds array; the strings moved into the
+      // new array.
+      if ( this->running_feds != NULL ) {
+         if ( trick_MM->delete_var( static_cast< void * >( this->running_feds ) ) ) {
+            send_hs( stderr, "Federate::add_or_update_a_single_entry_into_running_feds():%d ERROR deleting Trick Memory for 'this->running_feds'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+      }
 
       // assign temp_feds into running_feds
       this->running_feds = temp_feds;
 
       ++running_feds_count; // make the new running_feds_count size permanent
    }
+}
 
-#if 0
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-      send_hs( stdout, "Federate::add_a_single_entry_into_running_feds():%d Exiting routine, here is what running_feds contains:%c",
-               __LINE__, THLA_NEWLINE);
-      for ( int t = 0; t < running_feds_count; t++) {
-         send_hs( stdout, "Federate::add_a_single_entry_into_running_feds():%d running_feds[%d].MOM_instance_name='%s'%c",
-                  __LINE__, t, running_feds[t].MOM_instance_name, THLA_NEWLINE);
-         send_hs( stdout, "Federate::add_a_single_entry_into_running_feds():%d running_feds[%d].name='%s'%c",
-                  __LINE__, t, running_feds[t].name, THLA_NEWLINE);
-         send_hs( stdout, "Federate::add_a_single_entry_into_running_feds():%d running_feds[%d].required=%d %c",
-                  __LINE__, t, running_feds[t].required, THLA_NEWLINE);
+void Federate::remove_a_single_entry_from_running_feds(
+   wstring const &mom_instance_name )
+{
+   string mom_instance_name_str;
+   StringUtilities::to_string( mom_instance_name_str, mom_instance_name );
+
+   for ( unsigned int i = 0; i < running_feds_count; ++i ) {
+      if ( ( running_feds[i].MOM_instance_name != NULL )
+           && ( mom_instance_name_str.compare( running_feds[i].MOM_instance_name ) == 0 ) ) {
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::remove_a_single_entry_from_running_feds():%d Removing resigned federate '%s' from running_feds.%c",
+                     __LINE__, ( running_feds[i].name != NULL ) ? running_feds[i].name : "", THLA_NEWLINE );
+         }
+
+         if ( trick_MM->delete_var( static_cast< void * >( running_feds[i].MOM_instance_name ) ) ) {
+            send_hs( stderr, "Federate::remove_a_single_entry_from_running_feds():%d ERROR deleting Trick Memory for 'running_feds[i].MOM_instance_name'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+         running_feds[i].MOM_instance_name = NULL;
+
+         if ( running_feds[i].name != NULL ) {
+            if ( trick_MM->delete_var( static_cast< void * >( running_feds[i].name ) ) ) {
+               send_hs( stderr, "Federate::remove_a_single_entry_from_running_feds():%d ERROR deleting Trick Memory for 'running_feds[i].name'%c",
+                        __LINE__, THLA_NEWLINE );
+            }
+            running_feds[i].name = NULL;
+         }
+
+         // Compact the roster in place. The trailing slot keeps the existing
+         // allocation, so removing an entry never reallocates the roster.
+         for ( unsigned int j = i; ( j + 1 ) < (unsigned int)running_feds_count; ++j ) {
+            running_feds[j].MOM_instance_name = running_feds[j + 1].MOM_instance_name;
+            running_feds[j].name              = running_feds[j + 1].name;
+            running_feds[j].required          = running_feds[j + 1].required;
+         }
+         running_feds[running_feds_count - 1].MOM_instance_name = NULL;
+         running_feds[running_feds_count - 1].name              = NULL;
+         running_feds[running_feds_count - 1].required          = false;
+
+         --running_feds_count;
+         return;
       }
    }
-#endif
 }
 
 void Federate::add_MOM_HLAfederate_instance_id(
@@ -6542,79 +7584,25 @@ void Federate::remove_MOM_HLAfederate_instance_id(
    remove_federate_instance_id( instance_hndl );
    remove_MOM_HLAfederation_instance_id( instance_hndl );
 
-   char const *tMOMName  = NULL;
-   char const *tFedName  = NULL;
-   bool        foundName = false;
-
    TrickHLAObjInstanceNameMap::iterator iter = mom_HLAfederate_inst_name_map.find( instance_hndl );
-   if ( iter != mom_HLAfederate_inst_name_map.end() ) {
-      tMOMName  = StringUtilities::ip_strdup_wstring( iter->second.c_str() );
-      foundName = true;
-      mom_HLAfederate_inst_name_map.erase( iter );
-   }
 
    // if the federate_id was not found, there is nothing else to do so exit the routine...
-   if ( !foundName ) {
-      return;
-   }
-
-   // search for the federate information from running_feds...
-   foundName = false;
-   for ( unsigned int i = 0; i < running_feds_count; ++i ) {
-      if ( !strcmp( running_feds[i].MOM_instance_name, tMOMName ) ) {
-         foundName = true;
-         tFedName  = trick_MM->mm_strdup( running_feds[i].name );
-      }
-   }
-
-   // if the name was not found, there is nothing else to do so exit the routine...
-   if ( !foundName ) {
+   if ( iter == mom_HLAfederate_inst_name_map.end() ) {
       return;
    }
 
-   // otherwise, the name was found. it needs to be deleted from the list of running_feds.
-   // since the memory is Trick-controlled and not random access, the only way to delete
-   // it is to copy the whole element list omitting the requested name...
-   KnownFederate *tmp_feds;
-
-   // allocate temporary list...
-   tmp_feds = reinterpret_cast< KnownFederate * >(
-      alloc_type( this->running_feds_count - 1, "TrickHLA::KnownFederate" ) );
-   if ( tmp_feds == NULL ) {
-      ostringstream errmsg;
-      errmsg << "Federate::remove_discovered_object_federate_instance_id():" << __LINE__
-             << " ERROR: Could not allocate memory for tmp_feds!" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
-   }
-   // now, copy everything minus the requested name from the original list...
-   int tmp_feds_cnt = 0;
-   for ( unsigned int i = 0; i < this->running_feds_count; ++i ) {
-      // if the name is not the one we are looking for...
-      if ( strcmp( this->running_feds[i].name, tFedName ) ) {
-         if ( this->running_feds[i].MOM_instance_name != NULL ) {
-            tmp_feds[tmp_feds_cnt].MOM_instance_name = trick_MM->mm_strdup( this->running_feds[i].MOM_instance_name );
-         }
-         tmp_feds[tmp_feds_cnt].name     = trick_MM->mm_strdup( this->running_feds[i].name );
-         tmp_feds[tmp_feds_cnt].required = this->running_feds[i].required;
-         ++tmp_feds_cnt;
-      }
-   }
-
-   // now, clear out the original memory...
-   clear_running_feds();
-
-   // assign the new element count into running_feds_count.
-   this->running_feds_count = tmp_feds_cnt;
+   // Drop the resigned federate from the running_feds roster in place
+   // instead of rebuilding the entire roster.
+   remove_a_single_entry_from_running_feds( iter->second );
 
-   // assign pointer from the temporary list to the permanent list...
-   this->running_feds = tmp_feds;
+   mom_HLAfederate_inst_name_map.erase( iter );
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       string id_str;
       StringUtilities::to_string( id_str, instance_hndl );
-      send_hs( stderr, "Federate::remove_discovered_object_federate_instance_id():%d \
-Removed Federate '%s' Instance-ID:%s Valid-ID:%s %c",
-               __LINE__, tFedName, id_str.c_str(),
+      send_hs( stderr, "Federate::remove_MOM_HLAfederate_instance_id():%d \
+Removed Federate Instance-ID:%s Valid-ID:%s %c",
+               __LINE__, id_str.c_str(),
                ( instance_hndl.isValid() ? "Yes" : "No" ), THLA_NEWLINE );
    }
 }
@@ -6640,34 +7628,6 @@ void Federate::remove_MOM_HLAfederation_instance_id(
    }
 }
 
-void Federate::write_running_feds_file(
-   string const &file_name )
-{
-   string   full_path;
-   ofstream file;
-
-   full_path = this->HLA_save_directory + "/" + file_name + ".running_feds";
-   file.open( full_path.c_str(), ios::out );
-   if ( file.is_open() ) {
-      file << this->running_feds_count << endl;
-
-      // echo the contents of running_feds into file...
-      for ( unsigned int i = 0; i < this->running_feds_count; ++i ) {
-         file << trick_MM->mm_strdup( this->running_feds[i].MOM_instance_name ) << endl;
-         file << trick_MM->mm_strdup( this->running_feds[i].name ) << endl;
-         file << this->running_feds[i].required << endl;
-      }
-
-      file.close(); // close the file.
-
-   } else {
-      ostringstream errmsg;
-      errmsg << "Federate::write_running_feds_file():" << __LINE__
-             << " ERROR: Failed to open file '" << full_path << "' for writing!" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
-   }
-}
-
 /*!
  *  @job_class{freeze}
  */
@@ -6832,6 +7792,147 @@ Unexpected restore process %d, which is not 'Restore_Complete' or 'Restore_Reque
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
+
+namespace
+{
+// Binary checkpoint blob layout: the 8 byte magic number and a version,
+// followed by the length prefixed federation name, the running federates
+// table, and the synchronization point table. Strings are length prefixed
+// and fields are in host byte order since the blob is restored on the same
+// machine that wrote it.
+char const     THLA_BINARY_CHECKPOINT_MAGIC[8] = { 'T', 'H', 'L', 'A', 'B', 'C', 'P', '1' };
+uint32_t const THLA_BINARY_CHECKPOINT_VERSION  = 1;
+
+/*! @brief Append a length prefixed string to the checkpoint blob.
+ *  @param blob The checkpoint blob.
+ *  @param text String to append, NULL is treated as an empty string. */
+void append_checkpoint_string(
+   vector< unsigned char > &blob,
+   char const              *text )
+{
+   uint16_t const length = ( text != NULL ) ? (uint16_t)strlen( text ) : 0;
+   size_t const   pos    = blob.size();
+   blob.resize( pos + sizeof( length ) + length );
+   memcpy( &blob[pos], &length, sizeof( length ) );
+   if ( length > 0 ) {
+      memcpy( &blob[pos + sizeof( length )], text, length );
+   }
+}
+
+/*! @brief Read a length prefixed string from a checkpoint blob.
+ *  @return True if the string was read, false if the blob is truncated.
+ *  @param input Current blob position, advanced past the string.
+ *  @param end   End of the blob.
+ *  @param text  Returned string value. */
+bool parse_checkpoint_string(
+   unsigned char const *&input,
+   unsigned char const  *end,
+   string               &text )
+{
+   uint16_t length;
+   if ( (size_t)( end - input ) < sizeof( length ) ) {
+      return false;
+   }
+   memcpy( &length, input, sizeof( length ) );
+   input += sizeof( length );
+   if ( (size_t)( end - input ) < length ) {
+      return false;
+   }
+   text.assign( reinterpret_cast< char const * >( input ), length );
+   input += length;
+   return true;
+}
+} // namespace
+
+/*!
+ * @details This blob is the only record of the running federates table
+ * written at save time, so a failure to write it is fatal just like the
+ * legacy text running-feds file writer was.
+ * @job_class{checkpoint}
+ */
+void Federate::write_binary_checkpoint(
+   string const &file_name )
+{
+   string const full_path = this->HLA_save_directory + "/" + file_name + ".thla_bin";
+
+   // Stage the versioned blob: header, federation name, the running
+   // federates table, and the synchronization point table.
+   vector< unsigned char > blob;
+
+   blob.resize( sizeof( THLA_BINARY_CHECKPOINT_MAGIC ) + sizeof( uint32_t ) );
+   memcpy( &blob[0], THLA_BINARY_CHECKPOINT_MAGIC, sizeof( THLA_BINARY_CHECKPOINT_MAGIC ) );
+   memcpy( &blob[sizeof( THLA_BINARY_CHECKPOINT_MAGIC )],
+           &THLA_BINARY_CHECKPOINT_VERSION, sizeof( uint32_t ) );
+
+   append_checkpoint_string( blob, get_federation_name() );
+
+   // Running federates table.
+   uint32_t const fed_count = (uint32_t)this->running_feds_count;
+   size_t         pos       = blob.size();
+   blob.resize( pos + sizeof( fed_count ) );
+   memcpy( &blob[pos], &fed_count, sizeof( fed_count ) );
+
+   for ( unsigned int i = 0; i < this->running_feds_count; ++i ) {
+      append_checkpoint_string( blob, this->running_feds[i].MOM_instance_name );
+      append_checkpoint_string( blob, this->running_feds[i].name );
+      blob.push_back( this->running_feds[i].required ? 1 : 0 );
+   }
+
+   // Synchronization point table, snapshotted through the same conversion
+   // used for the Trick checkpoint of the sync-point list.
+   uint32_t const sp_count = (uint32_t)execution_control->get_size();
+   pos                     = blob.size();
+   blob.resize( pos + sizeof( sp_count ) );
+   memcpy( &blob[pos], &sp_count, sizeof( sp_count ) );
+
+   if ( sp_count > 0 ) {
+      LoggableSyncPnt *logged_sync_pts = new LoggableSyncPnt[sp_count];
+      execution_control->convert_sync_points( logged_sync_pts );
+
+      for ( uint32_t i = 0; i < sp_count; ++i ) {
+         append_checkpoint_string( blob, logged_sync_pts[i].label );
+
+         int32_t const state = (int32_t)logged_sync_pts[i].state;
+         pos                 = blob.size();
+         blob.resize( pos + sizeof( state ) );
+         memcpy( &blob[pos], &state, sizeof( state ) );
+      }
+      delete[] logged_sync_pts;
+   }
+
+   // Write the blob through a memory mapping of the checkpoint file.
+   int const fd = ::open( full_path.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR );
+   if ( fd < 0 ) {
+      ostringstream errmsg;
+      errmsg << "Federate::write_binary_checkpoint():" << __LINE__
+             << " ERROR: Failed to create file '" << full_path << "' for writing!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ftruncate( fd, (off_t)blob.size() ) != 0 ) {
+      ::close( fd );
+      ostringstream errmsg;
+      errmsg << "Federate::write_binary_checkpoint():" << __LINE__
+             << " ERROR: Failed to size file '" << full_path << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   void *addr = mmap( NULL, blob.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   if ( addr == MAP_FAILED ) {
+      ::close( fd );
+      ostringstream errmsg;
+      errmsg << "Federate::write_binary_checkpoint():" << __LINE__
+             << " ERROR: Failed to map file '" << full_path << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   memcpy( addr, &blob[0], blob.size() );
+   munmap( addr, blob.size() );
+   ::close( fd );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::write_binary_checkpoint():%d Wrote %d bytes to '%s'.%c",
+               __LINE__, (int)blob.size(), full_path.c_str(), THLA_NEWLINE );
+   }
+}
+
 void Federate::read_running_feds_file(
    string const &file_name )
 {
@@ -6898,6 +7999,10 @@ void Federate::read_running_feds_file(
          this->known_feds[i].required = ( atoi( current_line.c_str() ) != 0 );
       }
 
+      // The known federates array was rebuilt, so rebuild the hashed
+      // required federate names on the next lookup.
+      invalidate_required_federate_name_set();
+
       file.close(); // Close the file before exiting
    } else {
       ostringstream errmsg;
@@ -6907,6 +8012,171 @@ void Federate::read_running_feds_file(
    }
 }
 
+
+/*!
+ * @details Restores the running federates table and the synchronization
+ * point states from the memory-mapped binary checkpoint blob written by
+ * write_binary_checkpoint(). Any validation failure just returns false so
+ * the caller can fall back to parsing the text running-feds file.
+ * @job_class{restart}
+ */
+bool Federate::read_binary_checkpoint(
+   string const &file_name )
+{
+   string full_path;
+
+   // Prepend the federation name to the filename (if it's not already
+   // prepended), like read_running_feds_file() does.
+   string const federation_name_str = string( get_federation_name() );
+   if ( file_name.compare( 0, federation_name_str.length(), federation_name_str ) == 0 ) {
+      full_path = this->HLA_save_directory + "/" + file_name + ".thla_bin";
+   } else {
+      full_path = this->HLA_save_directory + "/" + federation_name_str + "_" + file_name + ".thla_bin";
+   }
+
+   int const fd = ::open( full_path.c_str(), O_RDONLY );
+   if ( fd < 0 ) {
+      // No blob, likely a checkpoint from an older version.
+      return false;
+   }
+   struct stat file_stat;
+   if ( ( fstat( fd, &file_stat ) != 0 )
+        || ( (size_t)file_stat.st_size < ( sizeof( THLA_BINARY_CHECKPOINT_MAGIC ) + sizeof( uint32_t ) ) ) ) {
+      ::close( fd );
+      return false;
+   }
+   size_t const file_size = (size_t)file_stat.st_size;
+
+   void *addr = mmap( NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      return false;
+   }
+
+   unsigned char const *input = static_cast< unsigned char const * >( addr );
+   unsigned char const *end   = input + file_size;
+
+   // Validate the header.
+   uint32_t version;
+   memcpy( &version, input + sizeof( THLA_BINARY_CHECKPOINT_MAGIC ), sizeof( version ) );
+   if ( ( memcmp( input, THLA_BINARY_CHECKPOINT_MAGIC, sizeof( THLA_BINARY_CHECKPOINT_MAGIC ) ) != 0 )
+        || ( version != THLA_BINARY_CHECKPOINT_VERSION ) ) {
+      send_hs( stderr, "Federate::read_binary_checkpoint():%d File '%s' has an unexpected format or version, falling back to the text running-feds file.%c",
+               __LINE__, full_path.c_str(), THLA_NEWLINE );
+      munmap( addr, file_size );
+      return false;
+   }
+   input += sizeof( THLA_BINARY_CHECKPOINT_MAGIC ) + sizeof( version );
+
+   string text;
+   if ( !parse_checkpoint_string( input, end, text )
+        || ( text != federation_name_str ) ) {
+      send_hs( stderr, "Federate::read_binary_checkpoint():%d File '%s' is for federation '%s', not '%s', falling back to the text running-feds file.%c",
+               __LINE__, full_path.c_str(), text.c_str(),
+               federation_name_str.c_str(), THLA_NEWLINE );
+      munmap( addr, file_size );
+      return false;
+   }
+
+   uint32_t fed_count;
+   if ( (size_t)( end - input ) < sizeof( fed_count ) ) {
+      munmap( addr, file_size );
+      return false;
+   }
+   memcpy( &fed_count, input, sizeof( fed_count ) );
+   input += sizeof( fed_count );
+
+   // Clear out the known_feds from memory...
+   for ( unsigned int i = 0; i < known_feds_count; ++i ) {
+      if ( this->known_feds[i].MOM_instance_name != NULL ) {
+         if ( trick_MM->delete_var( static_cast< void * >( this->known_feds[i].MOM_instance_name ) ) ) {
+            send_hs( stderr, "Federate::read_binary_checkpoint():%d ERROR deleting Trick Memory for 'this->known_feds[i].MOM_instance_name'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+         this->known_feds[i].MOM_instance_name = NULL;
+      }
+      if ( this->known_feds[i].name != NULL ) {
+         if ( trick_MM->delete_var( static_cast< void * >( this->known_feds[i].name ) ) ) {
+            send_hs( stderr, "Federate::read_binary_checkpoint():%d ERROR deleting Trick Memory for 'this->known_feds[i].name'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+         this->known_feds[i].name = NULL;
+      }
+   }
+   if ( trick_MM->delete_var( static_cast< void * >( this->known_feds ) ) ) {
+      send_hs( stderr, "Federate::read_binary_checkpoint():%d ERROR deleting Trick Memory for 'this->known_feds'%c",
+               __LINE__, THLA_NEWLINE );
+   }
+   this->known_feds       = NULL;
+   this->known_feds_count = fed_count;
+
+   // Re-allocate it...
+   this->known_feds = reinterpret_cast< KnownFederate * >(
+      alloc_type( this->known_feds_count, "TrickHLA::KnownFederate" ) );
+   if ( this->known_feds == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Federate::read_binary_checkpoint():" << __LINE__
+             << " ERROR: Could not allocate memory for known_feds!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Fix up the known federates table directly from the mapped records.
+   for ( uint32_t i = 0; i < fed_count; ++i ) {
+      string mom_name;
+      string fed_name;
+      if ( !parse_checkpoint_string( input, end, mom_name )
+           || !parse_checkpoint_string( input, end, fed_name )
+           || ( (size_t)( end - input ) < 1 ) ) {
+         munmap( addr, file_size );
+         return false;
+      }
+      this->known_feds[i].MOM_instance_name = trick_MM->mm_strdup( const_cast< char * >( mom_name.c_str() ) );
+      this->known_feds[i].name              = trick_MM->mm_strdup( const_cast< char * >( fed_name.c_str() ) );
+      this->known_feds[i].required          = ( *input != 0 );
+      ++input;
+   }
+
+   // The known federates array was rebuilt, so rebuild the hashed required
+   // federate names on the next lookup.
+   invalidate_required_federate_name_set();
+
+   // Reinstate the synchronization point labels and states.
+   uint32_t sp_count;
+   if ( (size_t)( end - input ) >= sizeof( sp_count ) ) {
+      memcpy( &sp_count, input, sizeof( sp_count ) );
+      input += sizeof( sp_count );
+
+      for ( uint32_t i = 0; i < sp_count; ++i ) {
+         string  label;
+         int32_t state;
+         if ( !parse_checkpoint_string( input, end, label )
+              || ( (size_t)( end - input ) < sizeof( state ) ) ) {
+            break;
+         }
+         memcpy( &state, input, sizeof( state ) );
+         input += sizeof( state );
+
+         wstring ws_label;
+         StringUtilities::to_wstring( ws_label, label.c_str() );
+         if ( !execution_control->contains( ws_label ) ) {
+            execution_control->add_sync_point( ws_label );
+         }
+         SyncPnt *sp = execution_control->get_sync_point( ws_label );
+         if ( sp != NULL ) {
+            sp->set_state( (SyncPtStateEnum)state );
+         }
+      }
+   }
+
+   munmap( addr, file_size );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::read_binary_checkpoint():%d Restored %d federates from '%s'.%c",
+               __LINE__, (int)fed_count, full_path.c_str(), THLA_NEWLINE );
+   }
+   return true;
+}
+
 void Federate::copy_running_feds_into_known_feds()
 {
    // Clear out the known_feds from memory...
@@ -6949,6 +8219,10 @@ void Federate::copy_running_feds_into_known_feds()
       this->known_feds[this->known_feds_count].required          = running_feds[i].required;
       this->known_feds_count++;
    }
+
+   // The known federates array was rebuilt, so rebuild the hashed required
+   // federate names on the next lookup.
+   invalidate_required_federate_name_set();
 }
 
 /*!
@@ -7062,7 +8336,7 @@ void Federate::wait_for_federation_restore_begun()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !this->restore_begun ) {
 
@@ -7113,7 +8387,7 @@ void Federate::wait_until_federation_is_ready_to_restore()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !this->start_to_restore ) {
 
@@ -7199,7 +8473,7 @@ string Federate::wait_for_federation_restore_to_complete()
                          "completed!\nTERMINATING SIMULATION!";
          return return_string;
       } else {
-         sleep_timer.sleep(); // sleep until RTI responds...
+         save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
          if ( !this->restore_completed ) {
 
@@ -7265,7 +8539,7 @@ void Federate::wait_for_restore_request_callback()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !has_restore_process_restore_request_failed()
            && !has_restore_process_restore_request_succeeded() ) {
@@ -7317,7 +8591,7 @@ void Federate::wait_for_restore_status_to_complete()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !this->restore_request_complete ) {
 
@@ -7368,7 +8642,7 @@ void Federate::wait_for_save_status_to_complete()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !this->save_request_complete ) {
 
@@ -7428,7 +8702,7 @@ void Federate::wait_for_federation_restore_failed_callback_to_complete()
          }
          return;
       }
-      sleep_timer.sleep(); // sleep until RTI responds...
+      save_restore_event.wait(); // block until signaled or the bounded wait times out.
 
       if ( !this->federation_restore_failed_callback_complete ) {
 
@@ -7638,6 +8912,9 @@ void Federate::process_requested_federation_restore_status(
 
    // indicate that the request has completed...
    restore_request_complete = true;
+
+   // Wake the thread blocked waiting on the restore status.
+   save_restore_event.signal();
 }
 
 void Federate::process_requested_federation_save_status(
@@ -7661,6 +8938,9 @@ void Federate::process_requested_federation_save_status(
 
    // indicate that the request has completed...
    save_request_complete = true;
+
+   // Wake the thread blocked waiting on the save status.
+   save_restore_event.signal();
 }
 
 void Federate::print_restore_failure_reason(
@@ -7688,6 +8968,9 @@ void Federate::print_restore_failure_reason(
    send_hs( stdout, msg.str().c_str() );
 
    this->federation_restore_failed_callback_complete = true;
+
+   // Wake the thread blocked waiting on the restore failed callback.
+   save_restore_event.signal();
 }
 
 void Federate::print_save_failure_reason(
@@ -7855,6 +9138,9 @@ void Federate::complete_restore()
                   __LINE__, THLA_NEWLINE );
       }
       restore_completed = true;
+
+      // Wake the thread blocked waiting on the restore completion.
+      save_restore_event.signal();
    }
 }
 
@@ -7903,6 +9189,9 @@ void Federate::set_MOM_HLAfederation_instance_attributes(
 
          this->auto_provide_setting = auto_provide_state;
 
+         // Wake the thread blocked waiting on the auto-provide reply.
+         MOM_auto_provide_event.signal();
+
       } else if ( attr_iter->first == MOM_HLAfederatesInFederation_handle ) {
 
          // Extract the size of the data and the data bytes.
@@ -7999,12 +9288,13 @@ void Federate::restore_federate_handles_from_MOM()
 
       // Clear the list of joined federate names.
       joined_federate_names.clear();
+      joined_federate_name_set.clear();
    }
 
-   // Make sure we initialize the MOM handles we will use below. This should
-   // also handle the case if the handles change after a checkpoint restore or
-   // if this federate is now a master federate after the restore.
-   initialize_MOM_handles();
+   // Make sure we re-resolve the MOM handles we will use below. This handles
+   // the case if the handles change after a checkpoint restore or if this
+   // federate is now a master federate after the restore.
+   refresh_MOM_handles();
 
    AttributeHandleSet fedMomAttributes;
    fedMomAttributes.insert( MOM_HLAfederate_handle );
@@ -0,0 +1,272 @@
+/*!
+@file TrickHLA/FrameBudgetWatchdog.cpp
+@ingroup TrickHLA
+@brief This class monitors the real-time frame budget of the main data cycle
+by measuring the known frame stages each frame and recording an attributed
+incident into a low-overhead ring whenever the frame or a stage exceeds its
+declared budget.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ElapsedTimeStats.cpp}
+@trick_link_dependency{FrameBudgetWatchdog.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/FrameBudgetWatchdog.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Out of class definitions for the in class initialized static constants.
+int const FrameBudgetWatchdog::INCIDENT_RING_SIZE;
+
+/*!
+ * @job_class{initialization}
+ */
+FrameBudgetWatchdog::FrameBudgetWatchdog()
+   : enabled( false ),
+     frame_budget_ms( 0.0 ),
+     frame_active( false ),
+     frame_count( 0 ),
+     frame_start_time( 0 ),
+     stage_start_time( 0 ),
+     last_stage_end( 0 ),
+     current_stage( -1 ),
+     incident_index( 0 ),
+     incident_count( 0 )
+{
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      stage_budget_ms[s] = 0.0;
+      stage_time_ms[s]   = 0.0;
+   }
+   for ( int i = 0; i < INCIDENT_RING_SIZE; ++i ) {
+      incidents[i].frame            = 0;
+      incidents[i].timestamp        = 0;
+      incidents[i].total_ms         = 0.0;
+      incidents[i].excess_ms        = 0.0;
+      incidents[i].attributed_stage = -1;
+      for ( int s = 0; s < STAGE_COUNT; ++s ) {
+         incidents[i].stage_ms[s] = 0.0;
+      }
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+FrameBudgetWatchdog::~FrameBudgetWatchdog()
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameBudgetWatchdog::begin_frame()
+{
+   if ( !this->enabled ) {
+      return;
+   }
+
+   int64_t const time = clock_wall_time(); // in microseconds
+
+   // Close out and evaluate the previous frame, which ends where the new
+   // frame begins.
+   if ( this->frame_active ) {
+      evaluate_frame( time );
+   }
+
+   // Start the new frame measurement.
+   this->frame_active     = true;
+   this->frame_start_time = time;
+   this->last_stage_end   = time;
+   this->current_stage    = -1;
+   ++this->frame_count;
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      this->stage_time_ms[s] = 0.0;
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameBudgetWatchdog::start_stage(
+   FrameStageEnum const stage )
+{
+   if ( !this->enabled || !this->frame_active ) {
+      return;
+   }
+   this->current_stage    = stage;
+   this->stage_start_time = clock_wall_time(); // in microseconds
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameBudgetWatchdog::end_stage()
+{
+   if ( !this->enabled || !this->frame_active || ( this->current_stage < 0 ) ) {
+      return;
+   }
+   int64_t const time = clock_wall_time(); // in microseconds
+
+   this->stage_time_ms[this->current_stage] += ( time - this->stage_start_time ) * 0.001;
+   this->last_stage_end = time;
+   this->current_stage  = -1;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameBudgetWatchdog::evaluate_frame(
+   int64_t const end_time )
+{
+   double const total_ms = ( end_time - this->frame_start_time ) * 0.001;
+
+   // Attribute the frame time not spent in a measured stage to the
+   // other-jobs stage, so the whole frame is always accounted for.
+   double measured_ms = 0.0;
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      measured_ms += stage_time_ms[s];
+   }
+   if ( total_ms > measured_ms ) {
+      stage_time_ms[STAGE_OTHER_JOBS] += total_ms - measured_ms;
+   }
+
+   // Record the per-stage timing statistics for the frame.
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      stage_stats[s].sample( stage_time_ms[s] );
+   }
+
+   // Determine if the frame or any stage exceeded its declared budget, and
+   // which stage consumed the most time over its own budget. When no stage
+   // budgets are declared the largest stage takes the attribution for a
+   // whole frame overrun.
+   bool   overrun          = ( this->frame_budget_ms > 0.0 ) && ( total_ms > this->frame_budget_ms );
+   int    attributed_stage = 0;
+   double excess_ms        = 0.0;
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      double const budget = ( stage_budget_ms[s] > 0.0 ) ? stage_budget_ms[s] : 0.0;
+      double const excess = stage_time_ms[s] - budget;
+      if ( ( stage_budget_ms[s] > 0.0 ) && ( excess > 0.0 ) ) {
+         overrun = true;
+      }
+      if ( excess > excess_ms ) {
+         excess_ms        = excess;
+         attributed_stage = s;
+      }
+   }
+   if ( !overrun ) {
+      return;
+   }
+
+   // Record the overrun incident into the ring.
+   Incident &incident         = incidents[this->incident_index];
+   incident.frame             = this->frame_count;
+   incident.timestamp         = end_time;
+   incident.total_ms          = total_ms;
+   incident.excess_ms         = excess_ms;
+   incident.attributed_stage  = attributed_stage;
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      incident.stage_ms[s] = stage_time_ms[s];
+   }
+   this->incident_index = ( this->incident_index + 1 ) % INCIDENT_RING_SIZE;
+   ++this->incident_count;
+}
+
+char const *FrameBudgetWatchdog::stage_name(
+   int const stage )
+{
+   switch ( stage ) {
+      case STAGE_WAIT_FOR_GRANT:
+         return "wait-for-grant";
+      case STAGE_RECEIVE_DATA:
+         return "receive-data";
+      case STAGE_SEND_DATA:
+         return "send-data";
+      case STAGE_OTHER_JOBS:
+         return "other-jobs";
+      default:
+         return "unknown";
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+std::string const FrameBudgetWatchdog::to_string()
+{
+   stringstream msg;
+   msg << "FrameBudgetWatchdog::to_string():" << __LINE__ << endl
+       << "    frames-measured: " << this->frame_count << endl
+       << "    budget-overruns: " << this->incident_count << endl;
+
+   for ( int s = 0; s < STAGE_COUNT; ++s ) {
+      msg << "  Stage '" << stage_name( s ) << "'";
+      if ( stage_budget_ms[s] > 0.0 ) {
+         msg << " (budget " << stage_budget_ms[s] << " milliseconds)";
+      }
+      msg << " " << stage_stats[s].to_string() << endl;
+   }
+
+   // Show the retained incidents, oldest first.
+   int const retained = ( this->incident_count < (unsigned int)INCIDENT_RING_SIZE )
+                           ? (int)this->incident_count
+                           : INCIDENT_RING_SIZE;
+   for ( int i = 0; i < retained; ++i ) {
+      int const       index    = ( this->incident_index + INCIDENT_RING_SIZE - retained + i ) % INCIDENT_RING_SIZE;
+      Incident const &incident = incidents[index];
+
+      msg << "  Overrun frame:" << incident.frame
+          << " total:" << incident.total_ms << " milliseconds"
+          << " attributed to '" << stage_name( incident.attributed_stage )
+          << "' over budget by " << incident.excess_ms << " milliseconds (";
+      for ( int s = 0; s < STAGE_COUNT; ++s ) {
+         if ( s > 0 ) {
+            msg << " ";
+         }
+         msg << stage_name( s ) << ":" << incident.stage_ms[s];
+      }
+      msg << ")" << endl;
+   }
+   return msg.str();
+}
+
+FrameBudgetWatchdog::ScopedStage::ScopedStage(
+   FrameBudgetWatchdog                 &frame_watchdog,
+   FrameBudgetWatchdog::FrameStageEnum const stage )
+   : watchdog( &frame_watchdog )
+{
+   watchdog->start_stage( stage );
+}
+
+FrameBudgetWatchdog::ScopedStage::~ScopedStage()
+{
+   watchdog->end_stage();
+}
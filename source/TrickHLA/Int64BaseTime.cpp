@@ -43,10 +43,11 @@ using namespace std;
 using namespace TrickHLA;
 
 // Initialize the Int64BaseTime class variables.
-HLABaseTimeEnum Int64BaseTime::base_units               = HLA_BASE_TIME_MICROSECONDS;
-std::string     Int64BaseTime::units_string             = "microseconds";
-int64_t         Int64BaseTime::base_time_multiplier     = 1000000LL;
-double          Int64BaseTime::max_logical_time_seconds = ( (double)INT64_MAX / (double)Int64BaseTime::base_time_multiplier );
+HLABaseTimeEnum Int64BaseTime::base_units                      = HLA_BASE_TIME_MICROSECONDS;
+std::string     Int64BaseTime::units_string                    = "microseconds";
+int64_t         Int64BaseTime::base_time_multiplier            = 1000000LL;
+double          Int64BaseTime::base_time_multiplier_reciprocal = ( 1.0 / (double)Int64BaseTime::base_time_multiplier );
+double          Int64BaseTime::max_logical_time_seconds        = ( (double)INT64_MAX / (double)Int64BaseTime::base_time_multiplier );
 
 /*!
  * @brief Default constructor with microsecond base units_string.
@@ -165,8 +166,9 @@ void Int64BaseTime::set(
          DebugHandler::terminate_with_message( errmsg.str() );
          break;
    }
-   base_units               = units;
-   max_logical_time_seconds = ( (double)INT64_MAX / (double)base_time_multiplier );
+   base_units                      = units;
+   base_time_multiplier_reciprocal = ( 1.0 / (double)base_time_multiplier );
+   max_logical_time_seconds        = ( (double)INT64_MAX / (double)base_time_multiplier );
 }
 
 /*!
@@ -265,55 +267,3 @@ bool Int64BaseTime::exceeds_base_time_resolution(
    return ( modf( value * multiplier, &seconds ) != 0.0 );
 }
 
-/*!
- * @brief Converts the given floating point time to an integer representing
- *  the time in the HLA Logical base time.
- * @return Time value in the HLA Logical base time.
- * @param value Time value as a floating point double in seconds.
- */
-int64_t Int64BaseTime::to_base_time(
-   double const value )
-{
-   // Do a range check on the double value in seconds.
-   if ( value > max_logical_time_seconds ) {
-      return INT64_MAX;
-   } else if ( value < -max_logical_time_seconds ) {
-      return -INT64_MAX;
-   }
-
-   // A more efficient way to calculate the time in the base units_string by avoiding fmod().
-   double        seconds;
-   int64_t const fractional = (int64_t)round( modf( value, &seconds ) * base_time_multiplier );
-   return ( ( (int64_t)seconds * base_time_multiplier ) + fractional );
-
-   // TODO: Benchmark the new code against this previous implementation to see
-   // which is faster.
-   // int64_t const seconds    = (int64_t)trunc( value );
-   // int64_t const fractional = ( seconds >= 0 ) ? (int64_t)( fmod( value * MICROS_MULTIPLIER, MICROS_MULTIPLIER ) + 0.5 )
-   //                                             : (int64_t)( fmod( value * MICROS_MULTIPLIER, MICROS_MULTIPLIER ) - 0.5 );
-   // return ( ( seconds * MICROS_MULTIPLIER ) + fractional );
-}
-
-/*!
- * @brief Converts the given integer time to an floating-point time representing seconds.
- * @return Time value in seconds.
- * @param time_in_base_units Time value as a 64-bit integer in the units_string specified for this class.
- */
-double Int64BaseTime::to_seconds(
-   int64_t const time_in_base_units )
-{
-   double const seconds    = (double)( time_in_base_units / base_time_multiplier );
-   double const fractional = (double)( time_in_base_units % base_time_multiplier ) / (double)base_time_multiplier;
-   return ( seconds + fractional );
-}
-
-/*!
- * @brief Converts the given integer time to an integer time representing whole seconds.
- * @return Time value in whole seconds.
- * @param time_in_base_units Time value as a 64-bit integer in the units_string specified for this class.
- */
-int64_t Int64BaseTime::to_whole_seconds(
-   int64_t const time_in_base_units )
-{
-   return ( time_in_base_units / base_time_multiplier );
-}
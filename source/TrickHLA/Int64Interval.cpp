@@ -77,7 +77,7 @@ Int64Interval::Int64Interval(
  */
 Int64Interval::Int64Interval(
    RTI1516_NAMESPACE::HLAinteger64Interval const &value )
-   : hla_interval( value )
+   : base_time( value.getInterval() )
 {
    return;
 }
@@ -87,7 +87,7 @@ Int64Interval::Int64Interval(
  */
 Int64Interval::Int64Interval(
    Int64Interval const &value )
-   : hla_interval( value.get_base_time() )
+   : base_time( value.get_base_time() )
 {
    return;
 }
@@ -102,17 +102,12 @@ Int64Interval::~Int64Interval()
 
 int64_t Int64Interval::get_seconds() const
 {
-   return ( (int64_t)( this->hla_interval.getInterval() / Int64BaseTime::get_base_time_multiplier() ) );
+   return ( this->base_time / Int64BaseTime::get_base_time_multiplier() );
 }
 
 int64_t Int64Interval::get_fractional_seconds() const
 {
-   return ( (int64_t)( this->hla_interval.getInterval() % Int64BaseTime::get_base_time_multiplier() ) );
-}
-
-int64_t Int64Interval::get_base_time() const
-{
-   return ( this->hla_interval.getInterval() );
+   return ( this->base_time % Int64BaseTime::get_base_time_multiplier() );
 }
 
 double Int64Interval::get_time_in_seconds() const
@@ -122,11 +117,6 @@ double Int64Interval::get_time_in_seconds() const
    return ( seconds + fractional );
 }
 
-bool Int64Interval::is_zero() const
-{
-   return this->hla_interval.isZero();
-}
-
 wstring Int64Interval::to_wstring() const
 {
    ostringstream msg;
@@ -136,22 +126,10 @@ wstring Int64Interval::to_wstring() const
    return wstr;
 }
 
-void Int64Interval::set(
-   int64_t const value )
-{
-   this->hla_interval = value;
-}
-
-void Int64Interval::set(
-   double const value )
-{
-   this->hla_interval = Int64BaseTime::to_base_time( value );
-}
-
 void Int64Interval::set(
    RTI1516_NAMESPACE::LogicalTimeInterval const &value )
 {
    RTI1516_NAMESPACE::HLAinteger64Interval const &t = dynamic_cast< RTI1516_NAMESPACE::HLAinteger64Interval const & >( value );
 
-   this->hla_interval = t.getInterval();
+   this->base_time = t.getInterval();
 }
@@ -80,7 +80,7 @@ Int64Time::Int64Time(
  */
 Int64Time::Int64Time(
    RTI1516_NAMESPACE::HLAinteger64Time const &value )
-   : hla_time( value )
+   : base_time( value.getTime() )
 {
    return;
 }
@@ -90,7 +90,7 @@ Int64Time::Int64Time(
  */
 Int64Time::Int64Time(
    Int64Time const &value )
-   : hla_time( value.get_base_time() )
+   : base_time( value.get_base_time() )
 {
    return;
 }
@@ -106,22 +106,20 @@ Int64Time::~Int64Time()
 void Int64Time::decode(
    RTI1516_USERDATA const &user_supplied_tag )
 {
-   this->hla_time.decode( user_supplied_tag );
+   // Decode through the HLA representation at the ambassador boundary.
+   RTI1516_NAMESPACE::HLAinteger64Time hla_time;
+   hla_time.decode( user_supplied_tag );
+   this->base_time = hla_time.getTime();
 }
 
 int64_t Int64Time::get_seconds() const
 {
-   return ( (int64_t)( this->hla_time.getTime() / Int64BaseTime::get_base_time_multiplier() ) );
+   return ( this->base_time / Int64BaseTime::get_base_time_multiplier() );
 }
 
 int64_t Int64Time::get_fractional_seconds() const
 {
-   return ( (int64_t)( this->hla_time.getTime() % Int64BaseTime::get_base_time_multiplier() ) );
-}
-
-int64_t Int64Time::get_base_time() const
-{
-   return ( this->hla_time.getTime() );
+   return ( this->base_time % Int64BaseTime::get_base_time_multiplier() );
 }
 
 double Int64Time::get_time_in_seconds() const
@@ -140,28 +138,10 @@ wstring Int64Time::to_wstring() const
    return wstr;
 }
 
-void Int64Time::set(
-   int64_t const value )
-{
-   this->hla_time.setTime( value );
-}
-
-void Int64Time::set(
-   double const value )
-{
-   this->hla_time = Int64BaseTime::to_base_time( value );
-}
-
 void Int64Time::set(
    RTI1516_NAMESPACE::LogicalTime const &value )
 {
    RTI1516_NAMESPACE::HLAinteger64Time const &t = dynamic_cast< RTI1516_NAMESPACE::HLAinteger64Time const & >( value );
 
-   this->hla_time = t.getTime();
-}
-
-void Int64Time::set(
-   Int64Time const &value )
-{
-   this->hla_time = value.get_base_time();
+   this->base_time = t.getTime();
 }
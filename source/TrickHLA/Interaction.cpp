@@ -23,9 +23,11 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Interaction.cpp}
 @trick_link_dependency{InteractionHandler.cpp}
 @trick_link_dependency{InteractionItem.cpp}
+@trick_link_dependency{ItemQueue.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{OpaqueBuffer.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
 @trick_link_dependency{Types.cpp}
@@ -40,10 +42,14 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 // Trick include files.
 #include "trick/MemoryManager.hh"
@@ -60,11 +66,15 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionHandler.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/Metrics.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
+#include "TrickHLA/RTISubmitter.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
 
@@ -81,6 +91,45 @@ using namespace std;
 using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 
+namespace
+{
+
+// Leading magic marking a user supplied tag as a carrier interaction batch.
+char const BATCH_TAG_MAGIC[8] = { 'T', 'H', 'L', 'A', 'C', 'B', 'I', '1' };
+
+// Big-endian length prefix helpers so a batch is portable between federates
+// with different host byte orders.
+void push_uint32_be(
+   OpaqueBuffer  &buf,
+   uint32_t const value )
+{
+   unsigned char bytes[4];
+   bytes[0] = (unsigned char)( ( value >> 24 ) & 0xFF );
+   bytes[1] = (unsigned char)( ( value >> 16 ) & 0xFF );
+   bytes[2] = (unsigned char)( ( value >> 8 ) & 0xFF );
+   bytes[3] = (unsigned char)( value & 0xFF );
+   buf.push_to_buffer( bytes, sizeof( bytes ) );
+}
+
+bool read_uint32_be(
+   unsigned char const *data,
+   size_t const         size,
+   size_t              &pos,
+   uint32_t            &value )
+{
+   if ( ( pos + 4 ) > size ) {
+      return false;
+   }
+   value = ( (uint32_t)data[pos] << 24 )
+           | ( (uint32_t)data[pos + 1] << 16 )
+           | ( (uint32_t)data[pos + 2] << 8 )
+           | (uint32_t)data[pos + 3];
+   pos += 4;
+   return true;
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
@@ -92,14 +141,23 @@ Interaction::Interaction()
      param_count( 0 ),
      parameters( NULL ),
      handler( NULL ),
+     lazy_parameter_decode( false ),
+     receive_priority( 0 ),
+     batch_enabled( false ),
      mutex(),
      changed( false ),
      received_as_TSO( false ),
      time( 0.0 ),
+     deferred_queue(),
+     deferred_job_active( false ),
+     receive_queue(),
      manager( NULL ),
      user_supplied_tag_size( 0 ),
      user_supplied_tag_capacity( 0 ),
-     user_supplied_tag( NULL )
+     user_supplied_tag( NULL ),
+     send_param_values_map(),
+     batch_buffer(),
+     batch_count( 0 )
 {
    return;
 }
@@ -197,7 +255,10 @@ void Interaction::initialize(
       param_count = 0;
    }
 
-   // Verify parameter FOM names and also check for duplicate parameter FOM names.
+   // Verify parameter FOM names and also check for duplicate parameter FOM
+   // names. A hash set of the names seen so far folds the duplicate check
+   // into the same single pass.
+   unordered_map< string, unsigned int > parameter_names;
    for ( unsigned int i = 0; i < param_count; ++i ) {
       // Validate the FOM-name to make sure we don't have a problem with the
       // list of names as well as get a difficult to debug runtime error for
@@ -215,21 +276,18 @@ void Interaction::initialize(
 
       // Since Interaction updates are sent as a ParameterHandleValueMap there can be
       // no duplicate Parameters because the map only allows unique ParameterHandles.
-      for ( unsigned int k = i + 1; k < param_count; ++k ) {
-         if ( ( parameters[k].get_FOM_name() != NULL ) && ( *( parameters[k].get_FOM_name() ) != '\0' ) ) {
-
-            if ( fom_name_str == string( parameters[k].get_FOM_name() ) ) {
-               ostringstream errmsg;
-               errmsg << "Interaction::initialize():" << __LINE__
-                      << " ERROR: Interaction '" << FOM_name << "' has Parameters"
-                      << " at array indexes " << i << " and " << k
-                      << " that have the same FOM Name '" << fom_name_str
-                      << "'. Please check your input or modified-data files to"
-                      << " make sure the interaction parameters do not use"
-                      << " duplicate FOM names." << THLA_ENDL;
-               DebugHandler::terminate_with_message( errmsg.str() );
-            }
-         }
+      pair< unordered_map< string, unsigned int >::iterator, bool > insert_result =
+         parameter_names.insert( pair< string, unsigned int >( fom_name_str, i ) );
+      if ( !insert_result.second ) {
+         ostringstream errmsg;
+         errmsg << "Interaction::initialize():" << __LINE__
+                << " ERROR: Interaction '" << FOM_name << "' has Parameters"
+                << " at array indexes " << insert_result.first->second << " and " << i
+                << " that have the same FOM Name '" << fom_name_str
+                << "'. Please check your input or modified-data files to"
+                << " make sure the interaction parameters do not use"
+                << " duplicate FOM names." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
       }
    }
 
@@ -278,6 +336,13 @@ void Interaction::set_user_supplied_tag(
  */
 void Interaction::remove() // RETURN: -- None.
 {
+   // Fast teardown: the resign's implicit semantics released everything
+   // this federate published or subscribed, so skip the per-interaction
+   // unpublish and unsubscribe RTI calls.
+   if ( Federate::is_fast_teardown_active() ) {
+      return;
+   }
+
    // Only remove the Interaction if the manager has not been shutdown.
    if ( is_shutdown_called() ) {
 
@@ -869,6 +934,34 @@ void Interaction::unsubscribe_from_interaction()
    }
 }
 
+/*!
+ * @details The map nodes persist across sends keyed by the stable parameter
+ * handles, and each parameter value references the parameter's internal
+ * encode buffer, so a send rewrites the payload in place instead of
+ * allocating a fresh map with copied values every call.
+ * \par<b>Assumptions and Limitations:</b>
+ * - The filled in map must be handed to the RTI before the next send of
+ *   this interaction packs the parameter buffers again.
+ */
+void Interaction::fill_send_parameter_values()
+{
+   // Rebuild the map keys if the parameter handles changed, for example
+   // after a federation restore re-resolved the handles.
+   if ( send_param_values_map.size() != static_cast< size_t >( param_count ) ) {
+      send_param_values_map.clear();
+   }
+
+   // Add all the parameter values to the reusable map.
+   for ( int i = 0; i < param_count; ++i ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+         send_hs( stdout, "Interaction::fill_send_parameter_values():%d Adding '%s' to parameter map.%c",
+                  __LINE__, parameters[i].get_FOM_name(), THLA_NEWLINE );
+      }
+      parameters[i].get_encoded_parameter_value(
+         send_param_values_map[parameters[i].get_parameter_handle()] );
+   }
+}
+
 bool Interaction::send(
    RTI1516_USERDATA const &the_user_supplied_tag )
 {
@@ -891,8 +984,6 @@ bool Interaction::send(
       return ( false );
    }
 
-   ParameterHandleValueMap param_values_map;
-
    // For thread safety, lock here to avoid corrupting the parameters and use
    // braces to create scope for the mutex-protection to auto unlock the mutex.
    {
@@ -900,9 +991,19 @@ bool Interaction::send(
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &mutex );
 
-      // Add all the parameter values to the map.
-      for ( unsigned int i = 0; i < param_count; ++i ) {
-         param_values_map[parameters[i].get_parameter_handle()] = parameters[i].get_encoded_parameter_value();
+      // Rewrite the reusable parameter values map in place.
+      fill_send_parameter_values();
+
+      // When batching is enabled, pack this send into the frame's carrier
+      // batch instead of paying a full RTI send per interaction. The batch
+      // is flushed as one carrier interaction each data cycle.
+      if ( batch_enabled ) {
+         pack_into_batch( send_param_values_map, the_user_supplied_tag );
+
+         // Macro to restore the saved FPU Control Word register value.
+         TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+         TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+         return ( true );
       }
 
       // Release mutex lock as auto_unlock_mutex goes out of scope
@@ -920,11 +1021,23 @@ bool Interaction::send(
       // Do not send any interactions if federate save / restore has begun (see
       // IEEE-1516.1-2000 sections 4.12, 4.20)
       if ( federate->should_publish_data() ) {
+         // When the single-submitter proxy is enabled post the encoded
+         // interaction to it instead of contending on the RTI's internal
+         // lock with the data jobs on the other Trick child threads.
+         RTISubmitter *rti_submitter = get_federate()->get_rti_submission_proxy();
+
          // This call returns an event retraction handle but we
          // don't support event retraction so no need to store it.
-         rti_amb->sendInteraction( this->class_handle,
-                                   param_values_map,
-                                   the_user_supplied_tag );
+         if ( rti_submitter != NULL ) {
+            rti_submitter->post_interaction( rti_amb, this->class_handle,
+                                             send_param_values_map,
+                                             the_user_supplied_tag,
+                                             false, this->time, get_FOM_name() );
+         } else {
+            rti_amb->sendInteraction( this->class_handle,
+                                      send_param_values_map,
+                                      the_user_supplied_tag );
+         }
          successfuly_sent = true;
       }
    } catch ( RTI1516_EXCEPTION const &e ) {
@@ -938,8 +1051,10 @@ bool Interaction::send(
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
-   // Free the memory used in the parameter values map.
-   param_values_map.clear();
+   // Update the live performance counters.
+   if ( successfuly_sent ) {
+      Metrics::count_interaction_sent();
+   }
 
    return ( successfuly_sent );
 }
@@ -953,18 +1068,6 @@ bool Interaction::send(
       return ( false );
    }
 
-   // Macro to save the FPU Control Word register value.
-   TRICKHLA_SAVE_FPU_CONTROL_WORD;
-
-   RTIambassador *rti_amb = get_RTI_ambassador();
-   if ( rti_amb == NULL ) {
-      send_hs( stderr, "Interaction::send():%d Unexpected NULL RTIambassador.%c",
-               __LINE__, THLA_NEWLINE );
-      return ( false );
-   }
-
-   ParameterHandleValueMap param_values_map;
-
    // For thread safety, lock here to avoid corrupting the parameters and use
    // braces to create scope for the mutex-protection to auto unlock the mutex.
    {
@@ -972,18 +1075,41 @@ bool Interaction::send(
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &mutex );
 
-      // Add all the parameter values to the map.
-      for ( unsigned int i = 0; i < param_count; ++i ) {
-         if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
-            send_hs( stdout, "Interaction::send():%d Adding '%s' to parameter map.%c",
-                     __LINE__, parameters[i].get_FOM_name(), THLA_NEWLINE );
-         }
-         param_values_map[parameters[i].get_parameter_handle()] = parameters[i].get_encoded_parameter_value();
-      }
+      // Rewrite the reusable parameter values map in place.
+      fill_send_parameter_values();
 
       // auto_unlock_mutex unlocks the mutex here as it goes out of scope.
    }
 
+   return send( send_param_values_map, send_HLA_time, the_user_supplied_tag );
+}
+
+/*!
+ * @details The caller supplies the complete preencoded parameter value map,
+ * so this path does not touch the parameters and skips the per-parameter
+ * pack and encode. It is used by handlers that keep a preencoded payload
+ * template and only patch the fields that change between sends.
+ */
+bool Interaction::send(
+   ParameterHandleValueMap const &param_values_map,
+   double                         send_HLA_time,
+   RTI1516_USERDATA const        &the_user_supplied_tag )
+{
+   // RTI must be ready and the flag must be set to publish.
+   if ( !is_publish() ) {
+      return ( false );
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      send_hs( stderr, "Interaction::send():%d Unexpected NULL RTIambassador.%c",
+               __LINE__, THLA_NEWLINE );
+      return ( false );
+   }
+
    // Update the timestamp.
    time.set( send_HLA_time );
 
@@ -995,12 +1121,34 @@ bool Interaction::send(
    bool const send_with_timestamp = federate->in_time_regulating_state()
                                     && ( preferred_order != TRANSPORT_RECEIVE_ORDER );
 
+   // When batching is enabled, a send that resolves to Receive Order packs
+   // into the frame's carrier batch instead of paying a full RTI send per
+   // interaction. Timestamp Order sends are never batched since the carrier
+   // interaction is sent without a timestamp.
+   if ( batch_enabled && !send_with_timestamp ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      pack_into_batch( param_values_map, the_user_supplied_tag );
+
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      return ( true );
+   }
+
    bool successfuly_sent = false;
    try {
       // Do not send any interactions if federate save or restore has begun (see
       // IEEE-1516.1-2000 sections 4.12, 4.20)
       if ( federate->should_publish_data() ) {
 
+         // When the single-submitter proxy is enabled post the encoded
+         // interaction to it instead of contending on the RTI's internal
+         // lock with the data jobs on the other Trick child threads.
+         RTISubmitter *rti_submitter = get_federate()->get_rti_submission_proxy();
+
          // The message will only be sent as TSO if our Federate is in the HLA Time
          // Regulating state and the interaction prefers timestamp order.
          // See IEEE-1516.1-2000, Sections 6.6 and 8.1.1.
@@ -1014,10 +1162,17 @@ bool Interaction::send(
             // This call returns an event retraction handle but we
             // don't support event retraction so no need to store it.
             // Send in Timestamp Order.
-            rti_amb->sendInteraction( this->class_handle,
-                                      param_values_map,
-                                      the_user_supplied_tag,
-                                      time.get() );
+            if ( rti_submitter != NULL ) {
+               rti_submitter->post_interaction( rti_amb, this->class_handle,
+                                                param_values_map,
+                                                the_user_supplied_tag,
+                                                true, this->time, get_FOM_name() );
+            } else {
+               rti_amb->sendInteraction( this->class_handle,
+                                         param_values_map,
+                                         the_user_supplied_tag,
+                                         time.get() );
+            }
             successfuly_sent = true;
 
          } else {
@@ -1031,9 +1186,16 @@ Interaction '%s' is time-regulating:%s, preferred-order:%s.%c",
             }
 
             // Send in Receive Order (i.e. with no timestamp).
-            rti_amb->sendInteraction( this->class_handle,
-                                      param_values_map,
-                                      the_user_supplied_tag );
+            if ( rti_submitter != NULL ) {
+               rti_submitter->post_interaction( rti_amb, this->class_handle,
+                                                param_values_map,
+                                                the_user_supplied_tag,
+                                                false, this->time, get_FOM_name() );
+            } else {
+               rti_amb->sendInteraction( this->class_handle,
+                                         param_values_map,
+                                         the_user_supplied_tag );
+            }
             successfuly_sent = true;
          }
       }
@@ -1066,12 +1228,216 @@ Interaction '%s' is time-regulating:%s, preferred-order:%s.%c",
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
-   // Free the memory used in the parameter values map.
-   param_values_map.clear();
+   // Update the live performance counters.
+   if ( successfuly_sent ) {
+      Metrics::count_interaction_sent();
+   }
 
    return ( successfuly_sent );
 }
 
+/*!
+ * @details The caller must hold the interaction mutex. Each record packs the
+ * encoded parameter values keyed by their encoded RTI parameter handles,
+ * which are consistent federation wide, followed by the user supplied tag,
+ * all with big-endian length prefixes.
+ */
+void Interaction::pack_into_batch(
+   ParameterHandleValueMap const &param_values_map,
+   RTI1516_USERDATA const        &the_user_supplied_tag )
+{
+   // Start a new batch with the carrier magic.
+   if ( batch_count == 0 ) {
+      batch_buffer.reset_buffer_positions();
+      batch_buffer.push_to_buffer( BATCH_TAG_MAGIC, sizeof( BATCH_TAG_MAGIC ) );
+   }
+
+   push_uint32_be( batch_buffer, (uint32_t)param_values_map.size() );
+   for ( ParameterHandleValueMap::const_iterator iter = param_values_map.begin();
+         iter != param_values_map.end(); ++iter ) {
+      RTI1516_USERDATA const encoded_handle = iter->first.encode();
+      push_uint32_be( batch_buffer, (uint32_t)encoded_handle.size() );
+      batch_buffer.push_to_buffer( encoded_handle.data(), encoded_handle.size() );
+      push_uint32_be( batch_buffer, (uint32_t)iter->second.size() );
+      batch_buffer.push_to_buffer( iter->second.data(), iter->second.size() );
+   }
+   push_uint32_be( batch_buffer, (uint32_t)the_user_supplied_tag.size() );
+   if ( the_user_supplied_tag.size() > 0 ) {
+      batch_buffer.push_to_buffer( the_user_supplied_tag.data(), the_user_supplied_tag.size() );
+   }
+   ++batch_count;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+      send_hs( stdout, "Interaction::pack_into_batch():%d Interaction '%s' packed into batch, count:%u.%c",
+               __LINE__, get_FOM_name(), batch_count, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Interaction::send_interaction_batch()
+{
+   // RTI must be ready and the flag must be set to publish.
+   if ( !batch_enabled || !is_publish() ) {
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   // Get the RTI-Ambassador.
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      send_hs( stderr, "Interaction::send_interaction_batch():%d Unexpected NULL RTIambassador.%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   // Detach the packed batch as the carrier tag under the mutex so handlers
+   // packing sends for the next frame are not blocked by the RTI call.
+   RTI1516_USERDATA carrier_tag;
+   unsigned int     carrier_count;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      if ( batch_count == 0 ) {
+         // Macro to restore the saved FPU Control Word register value.
+         TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+         TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+         return;
+      }
+      carrier_tag   = RTI1516_USERDATA( batch_buffer.buffer, batch_buffer.push_pos );
+      carrier_count = batch_count;
+
+      batch_buffer.reset_buffer_positions();
+      batch_count = 0;
+
+      // Release mutex lock as auto_unlock_mutex goes out of scope
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+      send_hs( stdout, "Interaction::send_interaction_batch():%d As Receive-Order: Carrier interaction '%s' with %u batched interactions.%c",
+               __LINE__, get_FOM_name(), carrier_count, THLA_NEWLINE );
+   }
+
+   bool successfuly_sent = false;
+   try {
+      // Do not send any interactions if federate save / restore has begun (see
+      // IEEE-1516.1-2000 sections 4.12, 4.20)
+      if ( get_federate()->should_publish_data() ) {
+         // The carrier holds the whole batch in the user supplied tag and
+         // sends an empty parameter map in Receive Order.
+         ParameterHandleValueMap empty_param_values;
+
+         // When the single-submitter proxy is enabled post the encoded
+         // interaction to it instead of contending on the RTI's internal
+         // lock with the data jobs on the other Trick child threads.
+         RTISubmitter *rti_submitter = get_federate()->get_rti_submission_proxy();
+
+         if ( rti_submitter != NULL ) {
+            rti_submitter->post_interaction( rti_amb, this->class_handle,
+                                             empty_param_values,
+                                             carrier_tag,
+                                             false, this->time, get_FOM_name() );
+         } else {
+            rti_amb->sendInteraction( this->class_handle,
+                                      empty_param_values,
+                                      carrier_tag );
+         }
+         successfuly_sent = true;
+      }
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "Interaction::send_interaction_batch():%d As Receive-Order: Carrier interaction '%s' with exception '%s'%c",
+               __LINE__, get_FOM_name(), rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // Update the live performance counters.
+   if ( successfuly_sent ) {
+      Metrics::count_interaction_sent();
+   }
+}
+
+bool Interaction::is_batch_tag(
+   RTI1516_USERDATA const &the_user_supplied_tag )
+{
+   return ( ( the_user_supplied_tag.size() >= sizeof( BATCH_TAG_MAGIC ) )
+            && ( memcmp( the_user_supplied_tag.data(), BATCH_TAG_MAGIC, sizeof( BATCH_TAG_MAGIC ) ) == 0 ) );
+}
+
+/*!
+ * @details Walks the length-prefixed records packed by pack_into_batch()
+ * with a bounds check on every read, so a malformed or truncated batch
+ * returns false instead of reading past the tag.
+ */
+bool Interaction::unpack_batch(
+   RTIambassador              *rti_amb,
+   RTI1516_USERDATA const     &the_user_supplied_tag,
+   std::vector< BatchRecord > &records )
+{
+   records.clear();
+   if ( ( rti_amb == NULL ) || !is_batch_tag( the_user_supplied_tag ) ) {
+      return false;
+   }
+
+   unsigned char const *data = static_cast< unsigned char const * >( the_user_supplied_tag.data() );
+   size_t const         size = the_user_supplied_tag.size();
+   size_t               pos  = sizeof( BATCH_TAG_MAGIC );
+
+   try {
+      while ( pos < size ) {
+         BatchRecord record;
+
+         uint32_t map_cnt;
+         if ( !read_uint32_be( data, size, pos, map_cnt ) ) {
+            return false;
+         }
+         for ( uint32_t i = 0; i < map_cnt; ++i ) {
+            uint32_t handle_len;
+            if ( !read_uint32_be( data, size, pos, handle_len )
+                 || ( ( pos + handle_len ) > size ) ) {
+               return false;
+            }
+            RTI1516_USERDATA const encoded_handle( &data[pos], handle_len );
+            pos += handle_len;
+
+            uint32_t value_len;
+            if ( !read_uint32_be( data, size, pos, value_len )
+                 || ( ( pos + value_len ) > size ) ) {
+               return false;
+            }
+            record.param_values[rti_amb->decodeParameterHandle( encoded_handle )] =
+               RTI1516_USERDATA( &data[pos], value_len );
+            pos += value_len;
+         }
+
+         uint32_t tag_len;
+         if ( !read_uint32_be( data, size, pos, tag_len )
+              || ( ( pos + tag_len ) > size ) ) {
+            return false;
+         }
+         if ( tag_len > 0 ) {
+            record.user_supplied_tag = RTI1516_USERDATA( &data[pos], tag_len );
+            pos += tag_len;
+         }
+
+         records.push_back( record );
+      }
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      // A parameter handle that could not be decoded means a malformed batch.
+      return false;
+   }
+   return !records.empty();
+}
+
 void Interaction::process_interaction()
 {
    // The Interaction data must have changed and the RTI must be ready.
@@ -1104,9 +1470,16 @@ void Interaction::process_interaction()
          }
       }
 
-      // Unpack all the parameter data.
-      for ( unsigned int i = 0; i < param_count; ++i ) {
-         parameters[i].unpack_parameter_buffer();
+      if ( this->lazy_parameter_decode ) {
+         // Leave the received values encoded in the parameter buffers. The
+         // interaction handler decodes just the parameters it reads through
+         // InteractionHandler::decode_parameter(), so untouched parameters
+         // are never decoded.
+      } else {
+         // Unpack all the parameter data.
+         for ( unsigned int i = 0; i < param_count; ++i ) {
+            parameters[i].unpack_parameter_buffer();
+         }
       }
 
       mark_unchanged();
@@ -1125,6 +1498,49 @@ void Interaction::process_interaction()
    }
 }
 
+bool Interaction::decode_parameter(
+   char const *parameter_FOM_name )
+{
+   if ( parameter_FOM_name == NULL ) {
+      return false;
+   }
+
+   // For thread safety, lock here to avoid corrupting the parameters.
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   for ( unsigned int i = 0; i < param_count; ++i ) {
+      if ( ( parameters[i].get_FOM_name() != NULL )
+           && ( strcmp( parameters[i].get_FOM_name(), parameter_FOM_name ) == 0 ) ) {
+
+         // Only decode when a received value is still sitting encoded in
+         // the parameter buffer, so repeated accesses cost nothing.
+         if ( parameters[i].is_unpack_pending() ) {
+            parameters[i].unpack_parameter_buffer();
+         }
+         return true;
+      }
+   }
+   return false;
+}
+
+void Interaction::decode_all_parameters()
+{
+   // For thread safety, lock here to avoid corrupting the parameters.
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   for ( unsigned int i = 0; i < param_count; ++i ) {
+      if ( parameters[i].is_unpack_pending() ) {
+         parameters[i].unpack_parameter_buffer();
+      }
+   }
+}
+
 bool Interaction::extract_data(
    InteractionItem *interaction_item )
 {
@@ -1199,6 +1615,92 @@ bool Interaction::extract_data(
    return any_param_received;
 }
 
+bool Interaction::is_deferrable() const
+{
+   return ( ( handler != NULL ) && handler->is_deferrable() );
+}
+
+/*!
+ * @details The deferred dispatch queue and the job-in-flight flag are both
+ * protected by the queue mutex so that a newly queued item can never be
+ * missed: either the in-flight job is still draining and will see the item,
+ * or a new job is posted here.
+ * @job_class{scheduled}
+ */
+void Interaction::defer_interaction_item(
+   InteractionItem *interaction_item )
+{
+   bool post_job = false;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &deferred_queue.mutex );
+
+      // The item came from a detached drain chain, so make sure the stale
+      // chain link is cleared before the item is queued.
+      interaction_item->next = NULL;
+
+      deferred_queue.push( interaction_item );
+
+      if ( !this->deferred_job_active ) {
+         this->deferred_job_active = true;
+         post_job                  = true;
+      }
+   }
+
+   if ( post_job ) {
+      if ( ( manager == NULL )
+           || !manager->post_interaction_dispatch_job( process_deferred_items_job, this ) ) {
+         // The worker pool is not available, most likely because we are
+         // shutting down, so fall back to processing the item inline.
+         process_deferred_items();
+      }
+   }
+}
+
+/*!
+ * @details Runs on a worker pool thread. This is the only consumer of the
+ * deferred dispatch queue and at most one job per interaction is in flight,
+ * so the items are decoded and the users handler is called in receive order
+ * for this interaction class while other interaction classes are dispatched
+ * in parallel.
+ */
+void Interaction::process_deferred_items()
+{
+   while ( true ) {
+      InteractionItem *interaction_item;
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &deferred_queue.mutex );
+
+         if ( deferred_queue.empty() ) {
+            // Clear the job-in-flight flag while holding the mutex so a
+            // concurrent producer either sees the flag cleared and posts a
+            // new job or queued the item before we got the mutex.
+            this->deferred_job_active = false;
+            return;
+         }
+         interaction_item = static_cast< InteractionItem * >( deferred_queue.front() );
+      }
+
+      // Decode and process the item. The head item is safe to use outside
+      // the queue mutex because this job is the only consumer.
+      extract_data( interaction_item );
+      process_interaction();
+
+      // Remove and delete the processed head item.
+      deferred_queue.pop();
+   }
+}
+
+void *Interaction::process_deferred_items_job(
+   void *arg )
+{
+   static_cast< Interaction * >( arg )->process_deferred_items();
+   return NULL;
+}
+
 void Interaction::mark_unchanged()
 {
    this->changed = false;
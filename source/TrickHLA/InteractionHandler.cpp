@@ -56,7 +56,8 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 InteractionHandler::InteractionHandler() // RETURN: -- None.
-   : interaction( NULL )
+   : interaction( NULL ),
+     deferrable( false )
 {
    return;
 }
@@ -106,6 +107,20 @@ bool InteractionHandler::send_interaction(
                                     : false );
 }
 
+bool InteractionHandler::decode_parameter(
+   char const *parameter_FOM_name )
+{
+   return ( ( interaction != NULL ) ? interaction->decode_parameter( parameter_FOM_name )
+                                    : false );
+}
+
+void InteractionHandler::decode_all_parameters()
+{
+   if ( interaction != NULL ) {
+      interaction->decode_all_parameters();
+   }
+}
+
 void InteractionHandler::receive_interaction(
    RTI1516_USERDATA const &the_user_supplied_tag )
 {
@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
+@trick_link_dependency{ReceiveBufferPool.cpp}
 
 @revs_title
 @revs_begin
@@ -33,6 +34,7 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <new>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -47,10 +49,12 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/ItemPool.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
+#include "TrickHLA/ReceiveBufferPool.hh"
 
 using namespace std;
 using namespace TrickHLA;
@@ -66,6 +70,42 @@ extern ATTRIBUTES attrParameterItem[];
 }
 #endif
 
+// Fixed-size pool backing the class level new/delete operators below. The
+// pool is sized for the worst case number of in-flight received
+// interactions between two process_interactions() calls.
+#define THLA_INTERACTION_ITEM_POOL_COUNT 1024
+
+/*! @brief Get the InteractionItem pool, constructed on first use.
+ *  @return Reference to the InteractionItem pool. */
+static ItemPool &interaction_item_pool()
+{
+   static ItemPool pool( sizeof( InteractionItem ), THLA_INTERACTION_ITEM_POOL_COUNT );
+   return pool;
+}
+
+void *InteractionItem::operator new(
+   std::size_t size )
+{
+   // Only pool exactly sized allocations, a derived class goes to the heap.
+   if ( size == sizeof( InteractionItem ) ) {
+      void *ptr = interaction_item_pool().allocate();
+      if ( ptr != NULL ) {
+         return ptr;
+      }
+   }
+   // The pool is exhausted or this is a derived class.
+   return ::operator new( size );
+}
+
+void InteractionItem::operator delete(
+   void *ptr )
+{
+   // Recycle pooled items, anything else came from the heap.
+   if ( ( ptr != NULL ) && !interaction_item_pool().deallocate( ptr ) ) {
+      ::operator delete( ptr );
+   }
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -136,9 +176,13 @@ InteractionItem::InteractionItem(
 InteractionItem::~InteractionItem()
 {
    if ( user_supplied_tag != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( user_supplied_tag ) ) ) {
-         send_hs( stderr, "InteractionItem::~InteractionItem():%d ERROR deleting Trick Memory for 'user_supplied_tag'%c",
-                  __LINE__, THLA_NEWLINE );
+      // Recycle pooled tag buffers, anything else is Trick Memory Manager
+      // allocated.
+      if ( !ReceiveBufferPool::deallocate( user_supplied_tag ) ) {
+         if ( trick_MM->delete_var( static_cast< void * >( user_supplied_tag ) ) ) {
+            send_hs( stderr, "InteractionItem::~InteractionItem():%d ERROR deleting Trick Memory for 'user_supplied_tag'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
       }
       user_supplied_tag      = NULL;
       user_supplied_tag_size = 0;
@@ -174,24 +218,45 @@ void InteractionItem::initialize(
       }
    }
 
-   // Free the Trick allocated memory for the user supplied tag.
+   // Free the memory for any existing user supplied tag.
    if ( user_supplied_tag != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( user_supplied_tag ) ) ) {
-         send_hs( stderr, "InteractionItem::initialize():%d ERROR deleting Trick Memory for 'user_supplied_tag'%c",
-                  __LINE__, THLA_NEWLINE );
+      if ( !ReceiveBufferPool::deallocate( user_supplied_tag ) ) {
+         if ( trick_MM->delete_var( static_cast< void * >( user_supplied_tag ) ) ) {
+            send_hs( stderr, "InteractionItem::initialize():%d ERROR deleting Trick Memory for 'user_supplied_tag'%c",
+                     __LINE__, THLA_NEWLINE );
+         }
       }
       user_supplied_tag = NULL;
    }
 
-   // Put the user supplied tag into a buffer.
+   // Put the user supplied tag into a buffer. Recycle a buffer from the
+   // size-classed receive pool when one fits so this per callback path is
+   // allocation-free at steady state, otherwise fall back to a Trick
+   // Memory Manager allocation as before.
    user_supplied_tag_size = theUserSuppliedTag.size();
    if ( user_supplied_tag_size != 0 ) {
-      user_supplied_tag = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", user_supplied_tag_size ) );
+      user_supplied_tag = ReceiveBufferPool::allocate( user_supplied_tag_size );
+      if ( user_supplied_tag == NULL ) {
+         user_supplied_tag = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", user_supplied_tag_size ) );
+      }
       memcpy( user_supplied_tag, theUserSuppliedTag.data(), user_supplied_tag_size );
    }
 }
 
 void InteractionItem::checkpoint_queue()
+{
+   size_t unused_offset = 0;
+   checkpoint_queue( NULL, unused_offset );
+}
+
+/*!
+ * @details When no arena is supplied each non-empty payload gets its own
+ * Trick memory allocation, otherwise the payloads are staged contiguously
+ * into the arena.
+ */
+void InteractionItem::checkpoint_queue(
+   unsigned char *arena,
+   size_t        &arena_offset )
 {
    if ( parameter_queue.size() != 0 ) {
       parm_items_count = parameter_queue.size();
@@ -218,6 +283,10 @@ void InteractionItem::checkpoint_queue()
          parm_items[i].size  = item->size;
          if ( item->size == 0 ) {
             parm_items[i].data = NULL;
+         } else if ( arena != NULL ) {
+            parm_items[i].data = &arena[arena_offset];
+            memcpy( parm_items[i].data, item->data, item->size );
+            arena_offset += item->size;
          } else {
             parm_items[i].data = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", item->size ) );
             memcpy( parm_items[i].data, item->data, item->size );
@@ -232,11 +301,39 @@ void InteractionItem::checkpoint_queue()
    }
 }
 
-void InteractionItem::clear_parm_items()
+size_t InteractionItem::get_checkpoint_payload_size()
+{
+   size_t byte_count = user_supplied_tag_size;
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &parameter_queue.mutex );
+
+   int const item_count = parameter_queue.size();
+   for ( int i = 0; i < item_count; ++i ) {
+      ParameterItem *item = static_cast< ParameterItem * >( parameter_queue.front() );
+      byte_count += item->size;
+      parameter_queue.next( item );
+   }
+
+   // Re-establish the queue head for the checkpoint_queue() walk.
+   parameter_queue.rewind();
+
+   return byte_count;
+}
+
+void InteractionItem::clear_parm_items(
+   bool const free_parm_data )
 {
    if ( ( parm_items_count != 0 ) && ( parm_items != NULL ) ) {
       for ( int i = 0; i < parm_items_count; ++i ) {
-         parm_items[i].clear();
+         if ( free_parm_data ) {
+            parm_items[i].clear();
+         } else {
+            // The payload data is staged in an arena owned by the caller.
+            parm_items[i].data = NULL;
+            parm_items[i].size = 0;
+         }
       }
       if ( trick_MM->delete_var( static_cast< void * >( parm_items ) ) ) {
          send_hs( stderr, "InteractionItem::clear_parm_items():%d ERROR deleting Trick Memory for 'parm_items'%c",
@@ -0,0 +1,134 @@
+/*!
+@file TrickHLA/ItemPool.cpp
+@ingroup TrickHLA
+@brief Implementation of a fixed-size pool allocator for Items.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ItemPool.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdlib>
+
+// TrickHLA include files.
+#include "TrickHLA/ItemPool.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+ItemPool::ItemPool(
+   size_t const item_size,
+   size_t const item_count )
+   : mutex(),
+     item_size( item_size ),
+     item_count( item_count ),
+     slab( NULL ),
+     free_head( NULL )
+{
+   // Each free item holds the pointer to the next free item, so make sure
+   // an item is big enough to hold a pointer.
+   if ( this->item_size < sizeof( void * ) ) {
+      this->item_size = sizeof( void * );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ItemPool::~ItemPool()
+{
+   if ( slab != NULL ) {
+      free( slab );
+      slab      = NULL;
+      free_head = NULL;
+   }
+
+   // Make sure we destroy the mutex.
+   mutex.destroy();
+}
+
+void ItemPool::create_slab()
+{
+   slab = static_cast< unsigned char * >( malloc( item_size * item_count ) );
+   if ( slab == NULL ) {
+      // Leave the pool empty, allocate() will fall back to the heap.
+      return;
+   }
+
+   // Thread all the slab items onto the free-list.
+   for ( size_t i = 0; i < item_count; ++i ) {
+      void *item                       = slab + ( i * item_size );
+      *static_cast< void ** >( item )  = free_head;
+      free_head                        = item;
+   }
+}
+
+/*!
+ * @details Pop the next free item off the free-list. Returns NULL when the
+ * pool is exhausted so the caller can fall back to heap allocation.
+ */
+void *ItemPool::allocate()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // Lazily create the slab on the first allocation.
+   if ( slab == NULL ) {
+      create_slab();
+   }
+
+   void *item = free_head;
+   if ( item != NULL ) {
+      free_head = *static_cast< void ** >( item );
+   }
+   return item;
+}
+
+/*!
+ * @details Push the item back onto the free-list if it came from the pool
+ * slab. Returns false for items that did not come from the slab (i.e. heap
+ * fall back allocations), which the caller needs to free itself.
+ */
+bool ItemPool::deallocate(
+   void *item )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // Determine if the item came from the pool slab.
+   unsigned char *addr = static_cast< unsigned char * >( item );
+   if ( ( slab == NULL ) || ( addr < slab ) || ( addr >= ( slab + ( item_size * item_count ) ) ) ) {
+      return false;
+   }
+
+   *static_cast< void ** >( item ) = free_head;
+   free_head                       = item;
+   return true;
+}
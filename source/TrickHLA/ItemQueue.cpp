@@ -35,11 +35,14 @@ NASA, Johnson Space Center\n
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Item.hh"
 #include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/Utilities.hh"
 
 // using namespace std;
 using namespace TrickHLA;
@@ -50,6 +53,10 @@ using namespace TrickHLA;
 ItemQueue::ItemQueue()
    : mutex(),
      count( 0 ),
+     capacity( 0 ),
+     overflow_policy( QUEUE_OVERFLOW_BLOCK_PRODUCER ),
+     high_water_mark( 0 ),
+     dropped_count( 0 ),
      head( NULL ),
      tail( NULL ),
      original_head( NULL )
@@ -147,9 +154,41 @@ void ItemQueue::pop()
       // Make sure we delete the Item we created when it was pushed on the queue.
       delete item;
       --count;
+      AllocationTracker::record_free( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
    }
 }
 
+/*!
+ * @brief Atomically detach the entire linked-list of items from the queue.
+ * @return Head item of the detached linked-list, or NULL if the queue was
+ * empty.
+ */
+Item *ItemQueue::drain()
+{
+   // Detach the linked-list in a thread-safe way.
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   // If the next() routine was ever executed to walk thru the queue without
+   // popping, the original 'head' pointer is the true start of the chain.
+   Item *chain = ( original_head != NULL ) ? original_head : head;
+
+   // Ownership of the detached items transfers to the caller, so they leave
+   // the item-queue allocation accounting here.
+   for ( int i = 0; i < count; ++i ) {
+      AllocationTracker::record_free( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
+   }
+
+   head          = NULL;
+   tail          = NULL;
+   original_head = NULL;
+   count         = 0;
+
+   return chain;
+}
+
 /*!
  * @brief Push the item onto the queue.
  * @param item Item to put into the queue.
@@ -158,20 +197,113 @@ void ItemQueue::push( // RETURN: -- None.
    Item *item )       // IN: -- Item to put into the queue.
 {
    // Add the item to the queue in a thread-safe way.
+   for ( ;; ) {
+      bool wait_for_slot = false;
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &mutex );
+
+         // Apply the overflow policy when the bounded queue is full.
+         if ( ( capacity > 0 ) && ( count >= capacity ) ) {
+            switch ( overflow_policy ) {
+               case QUEUE_OVERFLOW_DROP_OLDEST: {
+                  // Drop the oldest queued item to make room. If a caller is
+                  // mid-walk through the queue with next() it is not safe to
+                  // remove items out from under the walk, so the incoming
+                  // item is dropped instead.
+                  if ( ( original_head == NULL ) && ( head != NULL ) ) {
+                     Item *oldest = head;
+                     if ( head == tail ) {
+                        head = NULL;
+                        tail = NULL;
+                     } else {
+                        head = oldest->next;
+                     }
+                     delete oldest;
+                     --count;
+                     ++dropped_count;
+                     AllocationTracker::record_free( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
+                  } else {
+                     delete item;
+                     ++dropped_count;
+                     return;
+                  }
+                  break;
+               }
+               case QUEUE_OVERFLOW_OVERWRITE_LATEST: {
+                  // Replace the newest queued item with the incoming one,
+                  // with the same mid-walk caveat as for drop-oldest.
+                  if ( ( original_head == NULL ) && ( tail != NULL ) ) {
+                     if ( head == tail ) {
+                        head = item;
+                     } else {
+                        Item *prev = head;
+                        while ( prev->next != tail ) {
+                           prev = prev->next;
+                        }
+                        prev->next = item;
+                     }
+                     delete tail;
+                     tail = item;
+                     // The replaced item leaves the accounting and the
+                     // incoming item takes its place.
+                     AllocationTracker::record_free( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
+                     AllocationTracker::record_alloc( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
+                  } else {
+                     delete item;
+                  }
+                  ++dropped_count;
+                  return;
+               }
+               case QUEUE_OVERFLOW_BLOCK_PRODUCER:
+               default: {
+                  // Wait for the consumer to pop an item and free up a slot.
+                  wait_for_slot = true;
+                  break;
+               }
+            }
+         }
+
+         if ( !wait_for_slot ) {
+            // Add the item to the tail-end of the linked list.
+            if ( tail == NULL ) {
+               head = item;
+               tail = item;
+            } else {
+               tail->next = item;
+               tail       = item;
+            }
+            ++count;
+            if ( count > high_water_mark ) {
+               high_water_mark = count;
+            }
+            AllocationTracker::record_alloc( AllocationTracker::SUBSYS_ITEM_QUEUES, 0 );
+            return;
+         }
+      }
+
+      // Block the producer, with the queue mutex released, until the
+      // consumer frees up a slot.
+      Utilities::micro_sleep( 10 );
+   }
+}
 
+/*!
+ * @brief Bound the queue capacity and set the overflow policy.
+ * @param queue_capacity Maximum number of queued items, 0 for unbounded.
+ * @param policy Overflow policy applied when the bounded queue is full.
+ */
+void ItemQueue::set_capacity(
+   int const                     queue_capacity,
+   QueueOverflowPolicyEnum const policy )
+{
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   // Add the item to the tail-end of the linked list.
-   if ( tail == NULL ) {
-      head = item;
-      tail = item;
-   } else {
-      tail->next = item;
-      tail       = item;
-   }
-   ++count;
+   this->capacity        = queue_capacity;
+   this->overflow_policy = policy;
 }
 
 /*!
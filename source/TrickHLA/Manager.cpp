@@ -17,9 +17,11 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{Attribute.cpp}
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{ElapsedTimeStats.cpp}
 @trick_link_dependency{ExecutionConfigurationBase.cpp}
 @trick_link_dependency{ExecutionControlBase.cpp}
 @trick_link_dependency{Federate.cpp}
+@trick_link_dependency{FrameBudgetWatchdog.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
 @trick_link_dependency{Int64Interval.cpp}
 @trick_link_dependency{Int64Time.cpp}
@@ -31,8 +33,12 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Object.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
+@trick_link_dependency{AdaptiveSleepTimeout.cpp}
+@trick_link_dependency{SendPacer.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{StartupProfiler.cpp}
 @trick_link_dependency{Types.cpp}
+@trick_link_dependency{WorkerThreadPool.cpp}
 
 @revs_title
 @revs_begin
@@ -45,36 +51,55 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <cstdint>
 #include <float.h>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <pthread.h>
+#include <set>
 #include <string>
+#include <time.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // Trick include files.
 #include "trick/Executive.hh"
 #include "trick/MemoryManager.hh"
+#include "trick/clock_proto.h"
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/ExecutionConfigurationBase.hh"
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/Federate.hh"
+#include "TrickHLA/FrameBudgetWatchdog.hh"
 #include "TrickHLA/Int64BaseTime.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionItem.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/Metrics.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
+#include "TrickHLA/AdaptiveSleepTimeout.hh"
+#include "TrickHLA/SendPacer.hh"
 #include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/StartupProfiler.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
+#include "TrickHLA/WorkerThreadPool.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -106,6 +131,84 @@ extern ATTRIBUTES attrTrickHLA__Parameter[];
 }
 #endif
 
+namespace
+{
+
+/*! @brief Process-global cache of the RTI handles resolved before a Trick
+ * checkpoint reload. The handle values are stable across a federation
+ * save/restore pair on the same RTI connection, so an incremental restore
+ * can reuse them instead of re-resolving every handle from its FOM name. */
+class RestartHandleCache
+{
+  public:
+   /*! @brief Constructor. */
+   RestartHandleCache()
+      : valid( false ),
+        class_handles(),
+        attr_handles(),
+        instance_handles()
+   {
+      return;
+   }
+
+   bool valid; ///< True when the probe validated the cache for a restart.
+
+   map< string, ObjectClassHandle >    class_handles;    ///< Class FOM name to class handle.
+   map< string, AttributeHandle >      attr_handles;     ///< "class.attribute" FOM name to attribute handle.
+   map< string, ObjectInstanceHandle > instance_handles; ///< Object instance name to instance handle.
+};
+
+/*! @brief Access the process-global restart handle cache, which is
+ * intentionally leaked so it is usable for the full life of the process.
+ *  @return Reference to the restart handle cache. */
+RestartHandleCache &restart_handle_cache()
+{
+   static RestartHandleCache *cache = new RestartHandleCache();
+   return *cache;
+}
+
+/*! @brief Validate the restart handle cache with a cheap probe: re-resolve
+ * a single cached class handle from its FOM name and compare. A mismatch
+ * clears the cache so the full re-resolution runs.
+ *  @return True if the cached handles can be reused for the restart.
+ *  @param rti_amb The RTI ambassador to probe with. */
+bool validate_restart_handle_cache(
+   RTIambassador *rti_amb )
+{
+   RestartHandleCache &cache = restart_handle_cache();
+
+   if ( ( rti_amb == NULL ) || cache.class_handles.empty() ) {
+      return false;
+   }
+
+   bool cache_is_valid = false;
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+   try {
+      map< string, ObjectClassHandle >::const_iterator iter = cache.class_handles.begin();
+
+      wstring ws_FOM_name;
+      StringUtilities::to_wstring( ws_FOM_name, iter->first.c_str() );
+
+      cache_is_valid = ( rti_amb->getObjectClassHandle( ws_FOM_name ) == iter->second );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      cache_is_valid = false;
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   if ( !cache_is_valid ) {
+      cache.class_handles.clear();
+      cache.attr_handles.clear();
+      cache.instance_handles.clear();
+   }
+   return cache_is_valid;
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
@@ -117,21 +220,49 @@ Manager::Manager()
      restore_federation( 0 ),
      restore_file_name( NULL ),
      initiated_a_federation_save( false ),
-     interactions_queue(),
+     data_job_worker_count( 0 ),
+     adaptive_data_job_scheduling( false ),
+     data_job_rebalance_period( 64 ),
+     auto_stagger_send_phase( false ),
+     warm_start_enabled( false ),
+     warm_start_cache_file( NULL ),
+     interactions_queue_capacity( 0 ),
+     interactions_queue_overflow_policy( QUEUE_OVERFLOW_BLOCK_PRODUCER ),
+     interaction_drain_order(),
+     object_receive_order(),
+     update_groups(),
+     update_groups_obj_count( -1 ),
+     pending_reconfigs(),
+     reconfig_mutex(),
+     ownership_job_pool(),
+     interaction_dispatch_pool(),
+     ownership_pending_objects(),
+     ownership_pending_mutex(),
      check_interactions_count( 0 ),
      check_interactions( NULL ),
+     check_interactions_arena_size( 0 ),
+     check_interactions_arena( NULL ),
      job_cycle_base_time( 0LL ),
+     send_cycle_groups(),
+     receive_cycle_groups(),
+     data_cycle_groups_built_for( 0LL ),
      rejoining_federate( false ),
      restore_determined( false ),
      restore_federate( false ),
      mgr_initialized( false ),
      obj_discovery_mutex(),
      object_map(),
+     object_hash_table(),
+     object_hash_mask( 0 ),
+     object_hash_count( 0 ),
+     interaction_route_table(),
+     interaction_route_mask( 0 ),
      obj_name_index_map(),
      federate_has_been_restored( false ),
      federate( NULL ),
      execution_control( NULL )
 {
+   pthread_cond_init( &obj_discovery_cond, NULL );
    return;
 }
 
@@ -142,11 +273,27 @@ Manager::Manager()
 Manager::~Manager()
 {
    object_map.clear();
+   object_hash_clear();
    obj_name_index_map.clear();
    clear_interactions();
 
-   // Make sure we destroy the mutex.
+   // The checkpoint payload arena is retained across checkpoints, so it is
+   // only freed here.
+   if ( check_interactions_arena != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( check_interactions_arena ) ) ) {
+         send_hs( stderr, "Manager::~Manager():%d ERROR deleting Trick Memory for 'check_interactions_arena'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      AllocationTracker::record_free( AllocationTracker::SUBSYS_CHECKPOINT_DATA,
+                                      (long long)check_interactions_arena_size );
+      check_interactions_arena      = NULL;
+      check_interactions_arena_size = 0;
+   }
+
+   // Make sure we destroy the mutexes.
+   pthread_cond_destroy( &obj_discovery_cond );
    obj_discovery_mutex.destroy();
+   ownership_pending_mutex.destroy();
 }
 
 /*!
@@ -205,6 +352,18 @@ void Manager::initialize()
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Create the pool of worker threads used to process the per-object
+   // cyclic data send and receive jobs in parallel, if configured.
+   if ( this->data_job_worker_count > 0 ) {
+      federate->initialize_data_job_workers( this->data_job_worker_count );
+
+      // Adaptive scheduling only matters when a worker pool exists to
+      // spread the per-object jobs across.
+      if ( this->adaptive_data_job_scheduling ) {
+         federate->configure_adaptive_job_scheduling( true, this->data_job_rebalance_period );
+      }
+   }
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 
@@ -256,6 +415,20 @@ void Manager::restart_initialization()
    bool master_flag = this->execution_control->is_master(); // cppcheck-suppress [nullPointerRedundantCheck,unmatchedSuppression]
    this->execution_control->set_master( master_flag );      // cppcheck-suppress [nullPointerRedundantCheck,unmatchedSuppression]
 
+   // Incremental restore fast path: the RTI handles resolved before the
+   // checkpoint reload are stable across a federation save/restore pair on
+   // the same RTI connection, so validate the process-global handle cache
+   // with a single probe query and let the handle setup below reuse the
+   // cached values. A failed probe clears the cache and the full
+   // string-keyed re-resolution runs instead.
+   restart_handle_cache().valid = validate_restart_handle_cache( get_RTI_ambassador() );
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::restart_initialization():%d Restart handle cache %s.%c",
+               __LINE__, ( restart_handle_cache().valid ? "validated, reusing cached RTI handles"
+                                                        : "not usable, performing full handle resolution" ),
+               THLA_NEWLINE );
+   }
+
    // Setup all the Trick Ref-Attributes for the user specified objects,
    // attributes, interactions and parameters.
    setup_all_ref_attributes();
@@ -267,8 +440,9 @@ void Manager::restart_initialization()
    // Set the object instance handles based on its name.
    set_all_object_instance_handles_by_name();
 
-   // Make sure we reinitialize the MOM interface handles.
-   federate->initialize_MOM_handles();
+   // Make sure we re-resolve the MOM interface handles, which may have
+   // changed after the checkpoint restore.
+   federate->refresh_MOM_handles();
 
    // Perform the next few steps if we are the Master federate.
    if ( this->execution_control->is_master() ) {
@@ -285,11 +459,18 @@ void Manager::restart_initialization()
    // Restore ownership_transfer data for all objects.
    for ( unsigned int n = 0; n < obj_count; ++n ) {
       objects[n].restore_ownership_transfer_checkpointed_data();
+
+      // The checkpoint reload may have reallocated the attribute arrays, so
+      // the cached resolved address records must be re-derived.
+      objects[n].invalidate_resolved_address_caches();
    }
 
    // Restore checkpointed interactions.
    restore_interactions();
 
+   // The incremental restore window is over.
+   restart_handle_cache().valid = false;
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 }
@@ -327,29 +508,29 @@ void Manager::verify_object_and_interaction_arrays()
       obj_count = 0;
    }
 
-   // Object instance names must be unique and can not be a duplicate.
-   for ( int n = 0; n < obj_count; ++n ) {
+   // Object instance names must be unique and can not be a duplicate. Use
+   // a hash set of the names seen so far so the check is a single pass
+   // over the object array instead of an O(N^2) comparison of the names.
+   unordered_map< string, int > object_names;
+   for ( int k = 0; k < obj_count; ++k ) {
 
-      if ( ( objects[n].name != NULL ) && ( *objects[n].name != '\0' ) ) {
-         string obj_name1 = objects[n].name;
+      if ( ( objects[k].name != NULL ) && ( *objects[k].name != '\0' ) ) {
+         string obj_name = objects[k].name;
 
-         for ( int k = n + 1; k < obj_count; ++k ) {
-            if ( ( objects[k].name != NULL ) && ( *objects[k].name != '\0' ) ) {
-               string obj_name2 = objects[k].name;
-
-               if ( obj_name1 == obj_name2 ) {
-                  ostringstream errmsg;
-                  errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
-                         << " ERROR: Object instance '" << obj_name1
-                         << "' at array index " << n << " has the same name as"
-                         << " object instance '" << obj_name2
-                         << "' at array index " << k << ". Please check your"
-                         << " input or modified-data files to make sure the"
-                         << " object instance names are unique with no duplicates."
-                         << THLA_ENDL;
-                  DebugHandler::terminate_with_message( errmsg.str() );
-               }
-            }
+         pair< unordered_map< string, int >::iterator, bool > insert_result =
+            object_names.insert( pair< string, int >( obj_name, k ) );
+         if ( !insert_result.second ) {
+            int const n = insert_result.first->second;
+            ostringstream errmsg;
+            errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+                   << " ERROR: Object instance '" << obj_name
+                   << "' at array index " << n << " has the same name as"
+                   << " object instance '" << obj_name
+                   << "' at array index " << k << ". Please check your"
+                   << " input or modified-data files to make sure the"
+                   << " object instance names are unique with no duplicates."
+                   << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
          }
       }
    }
@@ -526,7 +707,12 @@ federate so this call will be ignored.%c",
       return;
    }
 
-   // Go through the list of objects.
+   // Build the completion set of objects this phase must wait on, which is
+   // every REQUIRED object with at least one piece of data we can receive.
+   // The arrivals are flagged from the reflection callbacks through each
+   // object's changed flag, so one combined wait below covers the whole set
+   // instead of serializing a sleep-poll wait per object.
+   vector< unsigned int > pending;
    for ( unsigned int n = 0; n < obj_count; ++n ) {
 
       // Make sure we have at least one piece of data we can receive.
@@ -534,57 +720,82 @@ federate so this call will be ignored.%c",
 
          // Only wait for REQUIRED received init data and do not block waiting
          // to receive init data if we are using the simple init scheme.
-         bool obj_required = objects[n].is_required() && ( this->execution_control->wait_for_init_data() );
-
-         if ( obj_required ) {
+         if ( objects[n].is_required() && this->execution_control->wait_for_init_data() ) {
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-               send_hs( stdout, "Manager::receive_init_data():%d Waiting for '%s', and marked as %s.%c",
-                        __LINE__, objects[n].get_name(),
-                        ( objects[n].is_required() ? "REQUIRED" : "not required" ), THLA_NEWLINE );
+               send_hs( stdout, "Manager::receive_init_data():%d Waiting for '%s', and marked as REQUIRED.%c",
+                        __LINE__, objects[n].get_name(), THLA_NEWLINE );
             }
+            pending.push_back( n );
+         }
+      } else {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            send_hs( stdout, "Manager::receive_init_data():%d Nothing to receive for '%s'%c",
+                     __LINE__, objects[n].get_name(), THLA_NEWLINE );
+         }
+      }
+   }
 
-            int64_t      wallclock_time;
-            SleepTimeout print_timer( federate->wait_status_time );
-            SleepTimeout sleep_timer;
-
-            // Wait for the data to arrive.
-            while ( !objects[n].is_changed() ) {
+   if ( !pending.empty() ) {
+      int64_t      wallclock_time;
+      SleepTimeout print_timer( federate->wait_status_time );
+      SleepTimeout sleep_timer;
 
-               // Check for shutdown.
-               federate->check_for_shutdown_with_termination();
+      // Wait for the data of all the outstanding objects to arrive. Each
+      // object is removed from the completion set as its data shows up, so
+      // every sleep quantum is shared by all the objects still outstanding.
+      while ( !pending.empty() ) {
 
-               sleep_timer.sleep();
+         // Check for shutdown.
+         federate->check_for_shutdown_with_termination();
 
-               if ( !objects[n].is_changed() ) {
+         // Sweep the completion set for arrivals.
+         size_t k = 0;
+         while ( k < pending.size() ) {
+            if ( objects[pending[k]].is_changed() ) {
+               pending.erase( pending.begin() + k );
+            } else {
+               ++k;
+            }
+         }
+         if ( pending.empty() ) {
+            break;
+         }
 
-                  // To be more efficient, we get the time once and share it.
-                  wallclock_time = sleep_timer.time();
+         sleep_timer.sleep();
 
-                  if ( sleep_timer.timeout( wallclock_time ) ) {
-                     sleep_timer.reset();
-                     if ( !federate->is_execution_member() ) {
-                        ostringstream errmsg;
-                        errmsg << "Manager::receive_init_data():" << __LINE__
-                               << " ERROR: Unexpectedly the Federate is no longer an execution member."
-                               << " This means we are either not connected to the"
-                               << " RTI or we are no longer joined to the federation"
-                               << " execution because someone forced our resignation at"
-                               << " the Central RTI Component (CRC) level!"
-                               << THLA_ENDL;
-                        DebugHandler::terminate_with_message( errmsg.str() );
-                     }
-                  }
+         // To be more efficient, we get the time once and share it.
+         wallclock_time = sleep_timer.time();
 
-                  if ( print_timer.timeout( wallclock_time ) ) {
-                     print_timer.reset();
-                     send_hs( stdout, "Manager::receive_init_data():%d Waiting for '%s', and marked as %s.%c",
-                              __LINE__, objects[n].get_name(),
-                              ( objects[n].is_required() ? "REQUIRED" : "not required" ), THLA_NEWLINE );
-                  }
-               }
+         if ( sleep_timer.timeout( wallclock_time ) ) {
+            sleep_timer.reset();
+            if ( !federate->is_execution_member() ) {
+               ostringstream errmsg;
+               errmsg << "Manager::receive_init_data():" << __LINE__
+                      << " ERROR: Unexpectedly the Federate is no longer an execution member."
+                      << " This means we are either not connected to the"
+                      << " RTI or we are no longer joined to the federation"
+                      << " execution because someone forced our resignation at"
+                      << " the Central RTI Component (CRC) level!"
+                      << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
             }
          }
 
+         if ( print_timer.timeout( wallclock_time ) ) {
+            print_timer.reset();
+            send_hs( stdout, "Manager::receive_init_data():%d Waiting for %d objects, next is '%s', and marked as REQUIRED.%c",
+                     __LINE__, (int)pending.size(),
+                     objects[pending[0]].get_name(), THLA_NEWLINE );
+         }
+      }
+   }
+
+   // Now that the wait is over, receive the data for every object that has
+   // an update.
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+
+      if ( objects[n].any_remotely_owned_subscribed_init_attribute() ) {
+
          // Check for changed data which means we received something.
          if ( objects[n].is_changed() ) {
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
@@ -598,14 +809,9 @@ federate so this call will be ignored.%c",
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                send_hs( stdout, "Manager::receive_init_data():%d Received nothing for '%s', and marked as %s.%c",
                         __LINE__, objects[n].get_name(),
-                        ( obj_required ? "REQUIRED" : "not required" ), THLA_NEWLINE );
+                        ( objects[n].is_required() ? "REQUIRED" : "not required" ), THLA_NEWLINE );
             }
          }
-      } else {
-         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            send_hs( stdout, "Manager::receive_init_data():%d Nothing to receive for '%s'%c",
-                     __LINE__, objects[n].get_name(), THLA_NEWLINE );
-         }
       }
    }
 }
@@ -735,6 +941,9 @@ void Manager::receive_init_data(
  */
 void Manager::clear_init_sync_points()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::clear_init_sync_points" );
+
    // Clear the multiphase initalization synchronization points associated
    // with ExecutionControl initialization.
    this->execution_control->clear_multiphase_init_sync_points();
@@ -780,6 +989,10 @@ joining federate so this call will be ignored.%c",
    wstring ws_syc_point_label;
    StringUtilities::to_wstring( ws_syc_point_label, sync_point_label );
 
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( string( "Manager::wait_for_init_sync_point '" )
+                                         + sync_point_label + "'" );
+
    // Determine if the sync-point label is valid.
    if ( this->execution_control->contains( ws_syc_point_label ) ) {
 
@@ -802,6 +1015,75 @@ joining federate so this call will be ignored.%c",
    }
 }
 
+/*!
+ * @job_class{initialization}
+ */
+void Manager::wait_for_init_sync_points(
+   char const *sync_point_label_list )
+{
+   if ( !this->execution_control->wait_for_init_sync_point() ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         ostringstream errmsg;
+         errmsg << "Manager::wait_for_init_sync_points():" << __LINE__
+                << " This call will be ignored because the Simulation"
+                << " Initialization Scheme (Type:'"
+                << this->execution_control->get_type()
+                << "') does not support it." << THLA_ENDL;
+         send_hs( stdout, errmsg.str().c_str() );
+      }
+      return;
+   }
+
+   // Late joining federates do not get to participate in the multiphase
+   // initialization process so just return.
+   if ( is_late_joining_federate() ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, "Manager::wait_for_init_sync_points():%d Late \
+joining federate so this call will be ignored.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      return;
+   }
+
+   if ( sync_point_label_list == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::wait_for_init_sync_points():" << __LINE__
+             << " ERROR: Null Sync-Point Label List" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Parse the comma separated list of sync-point labels.
+   vector< wstring > ws_labels;
+   StringUtilities::tokenize( sync_point_label_list, ws_labels, "," );
+
+   // Determine if all the sync-point labels are valid.
+   for ( unsigned int i = 0; i < ws_labels.size(); ++i ) {
+      if ( !this->execution_control->contains( ws_labels.at( i ) ) ) {
+         string label;
+         StringUtilities::to_string( label, ws_labels.at( i ) );
+         ostringstream errmsg;
+         errmsg << "Manager::wait_for_init_sync_points():" << __LINE__
+                << " ERROR: The specified Initialization Synchronization-Point label '"
+                << label
+                << "' is not known. Please check your input or modified data files"
+                << " to make sure the 'THLA.federate.multiphase_init_sync_points'"
+                << " correctly specifies all the synchronization-point labels that"
+                << " will be used for multi-phase initialization." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( string( "Manager::wait_for_init_sync_points '" )
+                                         + sync_point_label_list + "'" );
+
+   // Achieve the whole batch of sync-points and then wait for the
+   // federation to be synchronized on them.
+   this->execution_control->achieve_and_wait_for_synchronization_list( *( this->get_RTI_ambassador() ),
+                                                                       this->federate,
+                                                                       ws_labels );
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -851,6 +1133,55 @@ void Manager::request_data_update(
    return request_data_update( ws_obj_instance_name );
 }
 
+/*!
+ * @details The object instances are grouped by object class and one
+ * class-level requestAttributeValueUpdate call is made per class with the
+ * union of the subscribed attribute handles, which asks the owners of every
+ * instance of that class for an update. This is much cheaper for a late
+ * joining federate than requesting an update from each object instance one
+ * at a time.
+ * @job_class{initialization}
+ */
+void Manager::request_data_update_for_all_objects()
+{
+   if ( !is_RTI_ready( "request_data_update_for_all_objects" ) ) {
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::request_data_update_for_all_objects():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      // Request an update for an object class only once, so see if an
+      // earlier object already covered this class.
+      bool already_requested = false;
+      for ( unsigned int k = 0; ( k < n ) && !already_requested; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            already_requested = true;
+         }
+      }
+      if ( already_requested ) {
+         continue;
+      }
+
+      // Union of the subscribed attribute handles across all the object
+      // instances of this class.
+      AttributeHandleSet attrs;
+      objects[n].add_subscribed_attribute_handles( attrs );
+      for ( unsigned int k = n + 1; k < obj_count; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            objects[k].add_subscribed_attribute_handles( attrs );
+         }
+      }
+
+      if ( !attrs.empty() ) {
+         objects[n].request_class_attribute_value_update( attrs );
+      }
+   }
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -948,7 +1279,179 @@ void Manager::add_object_to_map(
    if ( ( object->is_instance_handle_valid() )
         && ( object_map.find( object->get_instance_handle() ) == object_map.end() ) ) {
       object_map[object->get_instance_handle()] = object;
+
+      // Mirror the entry into the open-addressing hash table used for the
+      // instance handle lookups on the FedAmb callback path.
+      object_hash_insert( object->get_instance_handle(), object );
+   }
+}
+
+/*!
+ * @details The table is a power of two sized so the probe index can be
+ * masked instead of using a modulo.
+ * @job_class{initialization}
+ */
+void Manager::object_hash_initialize(
+   size_t const expected_count )
+{
+   // Size for at most a 50% load factor at the expected object count.
+   size_t table_size = 16;
+   while ( table_size < ( ( expected_count + 1 ) * 2 ) ) {
+      table_size <<= 1;
+   }
+
+   ObjectInstanceHashEntry const empty_entry = { RTI1516_NAMESPACE::ObjectInstanceHandle(), NULL };
+
+   object_hash_table.assign( table_size, empty_entry );
+   object_hash_mask  = table_size - 1;
+   object_hash_count = 0;
+
+   // Re-insert any entries that are already in the object map.
+   for ( ObjectInstanceMap::const_iterator iter = object_map.begin();
+         iter != object_map.end(); ++iter ) {
+      object_hash_insert( iter->first, iter->second );
+   }
+}
+
+void Manager::object_hash_insert(
+   RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id,
+   Object                                        *object )
+{
+   // Build the table on first use if it was not sized at initialization.
+   if ( object_hash_mask == 0 ) {
+      object_hash_initialize( ( obj_count > 0 ) ? (size_t)obj_count : 1 );
+   }
+
+   // Grow the table when it becomes half full to keep the probes short.
+   if ( ( ( object_hash_count + 1 ) * 2 ) > object_hash_table.size() ) {
+      object_hash_initialize( object_hash_table.size() );
+   }
+
+   // Mix the 64-bit encoded handle value so clustered handle values spread
+   // across the table, then linearly probe for a free or matching slot.
+   uint64_t key = (uint64_t)instance_id.hash();
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdULL;
+   key ^= key >> 33;
+
+   size_t index = (size_t)key & object_hash_mask;
+   while ( ( object_hash_table[index].object != NULL )
+           && !( object_hash_table[index].handle == instance_id ) ) {
+      index = ( index + 1 ) & object_hash_mask;
+   }
+   if ( object_hash_table[index].object == NULL ) {
+      ++object_hash_count;
+   }
+   object_hash_table[index].handle = instance_id;
+   object_hash_table[index].object = object;
+}
+
+void Manager::object_hash_clear()
+{
+   object_hash_table.clear();
+   object_hash_mask  = 0;
+   object_hash_count = 0;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+Object *Manager::object_hash_find(
+   RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id ) const
+{
+   if ( object_hash_mask == 0 ) {
+      return NULL;
+   }
+
+   uint64_t key = (uint64_t)instance_id.hash();
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdULL;
+   key ^= key >> 33;
+
+   size_t index = (size_t)key & object_hash_mask;
+   while ( object_hash_table[index].object != NULL ) {
+      if ( object_hash_table[index].handle == instance_id ) {
+         return object_hash_table[index].object;
+      }
+      index = ( index + 1 ) & object_hash_mask;
+   }
+   return NULL;
+}
+
+/*!
+ * @details The routing table is an open-addressing hash keyed on the
+ * interaction class handle hash, sized power of two so the probe index is
+ * masked instead of using a modulo. Only subscribed interactions are
+ * entered, keeping the first interaction for a class when more than one
+ * shares the same class handle, which matches the first-match semantics of
+ * the linear scan this table replaces. The table is rebuilt in full on
+ * every call, so re-subscribing after an unsubscribe just rebuilds it.
+ * @job_class{initialization}
+ */
+void Manager::build_interaction_routes()
+{
+   // Size for at most a 50% load factor at the subscribed interaction count.
+   size_t table_size = 16;
+   while ( table_size < ( ( (size_t)inter_count + 1 ) * 2 ) ) {
+      table_size <<= 1;
+   }
+
+   InteractionClassRoute const empty_entry = { RTI1516_NAMESPACE::InteractionClassHandle(), -1 };
+
+   interaction_route_table.assign( table_size, empty_entry );
+   interaction_route_mask = table_size - 1;
+
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      if ( !interactions[n].is_subscribe() ) {
+         continue;
+      }
+
+      // Mix the 64-bit encoded handle value so clustered handle values
+      // spread across the table, then linearly probe for a free or
+      // matching slot.
+      uint64_t key = (uint64_t)interactions[n].get_class_handle().hash();
+      key ^= key >> 33;
+      key *= 0xff51afd7ed558ccdULL;
+      key ^= key >> 33;
+
+      size_t index = (size_t)key & interaction_route_mask;
+      while ( ( interaction_route_table[index].index >= 0 )
+              && !( interaction_route_table[index].handle == interactions[n].get_class_handle() ) ) {
+         index = ( index + 1 ) & interaction_route_mask;
+      }
+      if ( interaction_route_table[index].index < 0 ) {
+         interaction_route_table[index].handle = interactions[n].get_class_handle();
+         interaction_route_table[index].index  = (int)n;
+      }
+   }
+}
+
+/*!
+ * @details Lock-free lookup consulted on the FedAmb callback thread for
+ * every received interaction. The table is built at subscribe time and not
+ * modified afterwards, so no mutex is needed here.
+ * @job_class{scheduled}
+ */
+int Manager::interaction_route_find(
+   RTI1516_NAMESPACE::InteractionClassHandle const &class_id ) const
+{
+   if ( interaction_route_mask == 0 ) {
+      return -1;
+   }
+
+   uint64_t key = (uint64_t)class_id.hash();
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdULL;
+   key ^= key >> 33;
+
+   size_t index = (size_t)key & interaction_route_mask;
+   while ( interaction_route_table[index].index >= 0 ) {
+      if ( interaction_route_table[index].handle == class_id ) {
+         return interaction_route_table[index].index;
+      }
+      index = ( index + 1 ) & interaction_route_mask;
    }
+   return -1;
 }
 
 /*!
@@ -956,19 +1459,29 @@ void Manager::add_object_to_map(
  */
 void Manager::setup_all_ref_attributes()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::setup_all_ref_attributes" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::setup_all_ref_attributes():%d%c",
                __LINE__, THLA_NEWLINE );
    }
 
-   // Create the map of object instance names to object array indexes.
+   // Create the hash index of object instance names to object array indexes,
+   // pre-sized for the known object count to avoid growth rehashes.
    obj_name_index_map.clear();
+   obj_name_index_map.reserve( obj_count );
    for ( unsigned int n = 0; n < obj_count; ++n ) {
       obj_name_index_map[objects[n].get_name_string()] = n;
    }
 
    // Make sure the object-map is empty/clear before we continue.
    object_map.clear();
+   object_hash_clear();
+
+   // Pre-size the instance handle hash table for the known object count so
+   // discovery storms do not pay for growth rehashes.
+   object_hash_initialize( (size_t)obj_count + 2 );
 
    if ( is_execution_configuration_used() ) {
       if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
@@ -991,12 +1504,80 @@ void Manager::setup_all_ref_attributes()
    setup_interaction_ref_attributes();
 }
 
-/*!
- * @job_class{initialization}
- */
-void Manager::setup_object_ref_attributes(
-   int const data_obj_count,
-   Object   *data_objects )
+namespace
+{
+
+/*! @brief Per-object argument for a concurrent ref-attributes setup job. */
+struct ObjectRefAttributesJob {
+   Manager     *manager;   ///< The manager initializing the object.
+   Object      *obj;       ///< The object to initialize.
+   unsigned int obj_index; ///< Index of the object in its object array.
+};
+
+/*! @brief Initialize one object and resolve the Trick ref-attributes for
+ * all of its attributes.
+ *  @return Always NULL.
+ *  @param arg Pointer to the ObjectRefAttributesJob to run. */
+void *setup_object_ref_attributes_job(
+   void *arg )
+{
+   ObjectRefAttributesJob *job = static_cast< ObjectRefAttributesJob * >( arg );
+   Object                 *obj = job->obj;
+
+   // Initialize the TrickHLA-Object before we use it.
+   obj->initialize( job->manager );
+
+   ostringstream msg;
+
+   int const  attr_count = obj->get_attribute_count();
+   Attribute *attrs      = obj->get_attributes();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      msg << "Manager::setup_object_ref_attributes()" << __LINE__ << endl
+          << "--------------- Trick REF-Attributes ---------------" << endl
+          << " Object:'" << obj->get_name() << "'"
+          << " FOM-Name:'" << obj->get_FOM_name() << "'"
+          << " Create HLA Instance:"
+          << ( obj->is_create_HLA_instance() ? "Yes" : "No" )
+          << " Attribute count:" << attr_count << endl;
+   }
+
+   // Process the attributes for this object.
+   for ( int i = 0; i < attr_count; ++i ) {
+
+      // Initialize the TrickHLA-Attribute before we use it.
+      attrs[i].initialize( obj->get_FOM_name(), job->obj_index, i );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         msg << "   " << ( i + 1 ) << "/" << attr_count
+             << " FOM-Attribute:'" << attrs[i].get_FOM_name() << "'"
+             << " Trick-Name:'" << attrs[i].get_trick_name() << "'"
+             << endl;
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, msg.str().c_str() );
+   }
+   return NULL;
+}
+
+} // namespace
+
+/*!
+ * @details The per-object initialization is distributed across a small
+ * worker thread pool. Resolving a trick_name is a parse over the static
+ * Trick attribute tables and the Trick memory manager serializes its own
+ * allocation bookkeeping, so the jobs only share read-only state and each
+ * job writes just its own object and attributes. A federate with thousands
+ * of attributes otherwise pays for this string parsing single-threaded at
+ * startup. Attributes that already hold their ref-attributes, such as after
+ * a checkpoint restart, skip the parse entirely in Attribute::initialize().
+ * @job_class{initialization}
+ */
+void Manager::setup_object_ref_attributes(
+   int const data_obj_count,
+   Object   *data_objects )
 {
    // Just return if we are already initialized.
    if ( this->mgr_initialized ) {
@@ -1010,46 +1591,20 @@ void Manager::setup_object_ref_attributes(
                __LINE__, THLA_NEWLINE );
    }
 
-   // Resolve all the Ref-Attributes for all the simulation initialization
-   // objects and attributes.
-   for ( unsigned int n = 0; n < data_obj_count; ++n ) {
-
-      // Initialize the TrickHLA-Object before we use it.
-      data_objects[n].initialize( this );
-
-      ostringstream msg;
-
-      int const  attr_count = data_objects[n].get_attribute_count();
-      Attribute *attrs      = data_objects[n].get_attributes();
-
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         msg << "Manager::setup_object_ref_attributes()" << __LINE__ << endl
-             << "--------------- Trick REF-Attributes ---------------" << endl
-             << " Object:'" << data_objects[n].get_name() << "'"
-             << " FOM-Name:'" << data_objects[n].get_FOM_name() << "'"
-             << " Create HLA Instance:"
-             << ( data_objects[n].is_create_HLA_instance() ? "Yes" : "No" )
-             << " Attribute count:" << attr_count << endl;
-      }
-
-      // Process the attributes for this object.
-      for ( unsigned int i = 0; i < attr_count; ++i ) {
-
-         // Initialize the TrickHLA-Attribute before we use it.
-         attrs[i].initialize( data_objects[n].get_FOM_name(), n, i );
+   // Resolve the Ref-Attributes for all the simulation initialization
+   // objects and attributes concurrently from a worker thread pool.
+   vector< ObjectRefAttributesJob > ref_jobs( data_obj_count );
 
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            msg << "   " << ( i + 1 ) << "/" << attr_count
-                << " FOM-Attribute:'" << attrs[i].get_FOM_name() << "'"
-                << " Trick-Name:'" << attrs[i].get_trick_name() << "'"
-                << endl;
-         }
-      }
-
-      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         send_hs( stdout, msg.str().c_str() );
-      }
+   WorkerThreadPool ref_attributes_pool;
+   for ( int n = 0; n < data_obj_count; ++n ) {
+      ref_jobs[n].manager   = this;
+      ref_jobs[n].obj       = &data_objects[n];
+      ref_jobs[n].obj_index = n;
+      ref_attributes_pool.post( setup_object_ref_attributes_job, &ref_jobs[n] );
    }
+
+   // Shutting down the pool waits for all the queued jobs to finish.
+   ref_attributes_pool.shutdown();
 }
 
 /*!
@@ -1083,6 +1638,11 @@ void Manager::setup_interaction_ref_attributes()
       // Initialize the TrickHLA Interaction before we use it.
       interactions[n].initialize( this );
 
+      // Apply any receive queue bound configured before the interactions
+      // were set up.
+      interactions[n].get_receive_queue().set_capacity( interactions_queue_capacity,
+                                                        interactions_queue_overflow_policy );
+
       int const  param_count = interactions[n].get_parameter_count();
       Parameter *params      = interactions[n].get_parameters();
 
@@ -1115,6 +1675,9 @@ void Manager::setup_interaction_ref_attributes()
  */
 void Manager::setup_all_RTI_handles()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::setup_all_RTI_handles" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::setup_all_RTI_handles():%d%c",
                __LINE__, THLA_NEWLINE );
@@ -1133,127 +1696,219 @@ void Manager::setup_all_RTI_handles()
    setup_interaction_RTI_handles( inter_count, interactions );
 }
 
-/*!
- * @job_class{initialization}
- */
-void Manager::setup_object_RTI_handles(
-   int const data_obj_count,
-   Object   *data_objects )
+
+namespace
 {
-   // Just return if we are already initialized.
-   if ( this->mgr_initialized ) {
-      send_hs( stdout, "Manager::setup_object_RTI_handles():%d Already initialized.%c",
-               __LINE__, THLA_NEWLINE );
+
+/*! @brief Handle caches and error state shared by the concurrent object
+ * handle resolution jobs posted in Manager::setup_object_RTI_handles(). */
+class ObjectHandleResolver
+{
+  public:
+   /*! @brief Constructor.
+    *  @param amb The RTI ambassador used to resolve the handles. */
+   explicit ObjectHandleResolver( RTIambassador *amb )
+      : rti_amb( amb ),
+        cache_mutex(),
+        class_handle_cache(),
+        attr_handle_cache(),
+        plan_cache(),
+        error_mutex(),
+        error_msg()
+   {
       return;
    }
 
-   if ( this->federate == NULL ) {
-      ostringstream errmsg;
-      errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
-             << " ERROR: Unexpected NULL 'federate' pointer!" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
+   /*! @brief Record a resolution error, keeping only the first one.
+    *  @param msg Error message. */
+   void record_error( string const &msg )
+   {
+      MutexProtection auto_unlock_mutex( &error_mutex );
+      if ( error_msg.empty() ) {
+         error_msg = msg;
+      }
    }
 
+   RTIambassador *rti_amb; ///< The RTI ambassador.
+
+   /*! @brief Shared per-class codec plan: the resolved class and attribute
+    * handles plus the handle-sorted attribute order, built once by the
+    * first object of a class and reused by every other object with the
+    * same attribute layout. */
+   struct ClassCodecPlan {
+      ObjectClassHandle           class_handle; ///< Resolved object class handle.
+      vector< string >            attr_names;   ///< Attribute FOM names in declared order, the layout signature.
+      vector< AttributeHandle >   attr_handles; ///< Resolved attribute handles aligned with attr_names.
+      vector< unsigned int >      sorted_order; ///< Attribute indices in handle-sorted order for the attribute index.
+   };
+
+   MutexLock                        cache_mutex;        ///< Protects the handle caches.
+   map< string, ObjectClassHandle > class_handle_cache; ///< Class FOM name to class handle.
+   map< string, AttributeHandle >   attr_handle_cache;  ///< "class.attribute" FOM name to attribute handle.
+   map< string, ClassCodecPlan >    plan_cache;         ///< Class FOM name to the shared per-class codec plan.
+
+   MutexLock error_mutex; ///< Protects the error message.
+   string    error_msg;   ///< First resolution error message.
+};
+
+/*! @brief Per-object argument for a concurrent handle resolution job. */
+struct ObjectHandleResolveJob {
+   ObjectHandleResolver *resolver; ///< Shared resolution state.
+   Object               *obj;      ///< The object to resolve handles for.
+};
+
+/*! @brief Resolve the class and attribute RTI handles for one object,
+ * sharing memoized results for objects of the same class.
+ *  @return Always NULL.
+ *  @param arg Pointer to the ObjectHandleResolveJob to run. */
+void *resolve_object_RTI_handles_job(
+   void *arg )
+{
+   ObjectHandleResolveJob *job      = static_cast< ObjectHandleResolveJob * >( arg );
+   ObjectHandleResolver   *resolver = job->resolver;
+   Object                 *obj      = job->obj;
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
-   RTIambassador *rti_amb = get_RTI_ambassador();
-   if ( rti_amb == NULL ) {
-      ostringstream errmsg;
-      errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
-             << " ERROR: Unexpected NULL RTIambassador!" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
-   }
-
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::setup_object_RTI_handles():%d%c",
-               __LINE__, THLA_NEWLINE );
-   }
-
-   char const *obj_FOM_name  = "";
+   char const *obj_FOM_name  = obj->get_FOM_name();
    char const *attr_FOM_name = "";
-   int         FOM_name_type = 0; // 0:N/A 1:Object 2:Attribute - What name are we dealing with.
+   int         FOM_name_type = 1; // 1:Object 2:Attribute - What name are we dealing with.
+
+   int const  attr_count = obj->get_attribute_count();
+   Attribute *attrs      = obj->get_attributes();
 
-   // Initialize the Object and Attribute RTI handles.
    try {
       wstring ws_FOM_name = L"";
 
-      // Resolve all the handles/ID's for the objects and attributes.
-      for ( unsigned int n = 0; n < data_obj_count; ++n ) {
-         ostringstream msg;
+      // Fast path: another object of this class already built the shared
+      // per-class codec plan. If this object has the same attribute layout
+      // then take the resolved handles and the handle-sorted attribute
+      // order straight from the plan, with no per-attribute cache keys and
+      // no re-sort.
+      {
+         MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
+
+         map< string, ObjectHandleResolver::ClassCodecPlan >::const_iterator plan_iter =
+            resolver->plan_cache.find( obj_FOM_name );
+         if ( plan_iter != resolver->plan_cache.end() ) {
+            ObjectHandleResolver::ClassCodecPlan const &plan = plan_iter->second;
+
+            bool layout_matches = ( (int)plan.attr_names.size() == attr_count );
+            for ( int i = 0; ( i < attr_count ) && layout_matches; ++i ) {
+               if ( ( attrs[i].get_FOM_name() == NULL )
+                    || ( plan.attr_names[i] != attrs[i].get_FOM_name() ) ) {
+                  layout_matches = false;
+               }
+            }
 
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            msg << "Manager::setup_object_RTI_handles()" << __LINE__ << endl
-                << "----------------- RTI Handles (Objects & Attributes) ---------------"
-                << endl
-                << "Getting RTI Object-Class-Handle for"
-                << " Object:'" << data_objects[n].get_name() << "'"
-                << " FOM-Name:'" << data_objects[n].get_FOM_name() << "'"
-                << endl;
+            if ( layout_matches ) {
+               obj->set_class_handle( plan.class_handle );
+               for ( int i = 0; i < attr_count; ++i ) {
+                  attrs[i].set_attribute_handle( plan.attr_handles[i] );
+               }
+               obj->build_attribute_map( plan.sorted_order );
+
+               if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+                  string handle_str;
+                  StringUtilities::to_string( handle_str, obj->get_class_handle() );
+                  send_hs( stdout, "Manager::setup_object_RTI_handles():%d Resolved handles for Object:'%s' FOM-Name:'%s' Class-ID:%s from the shared class plan.%c",
+                           __LINE__, obj->get_name(), obj->get_FOM_name(),
+                           handle_str.c_str(), THLA_NEWLINE );
+               }
+
+               // Macro to restore the saved FPU Control Word register value.
+               TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+               TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+               return NULL;
+            }
          }
+      }
 
-         // Create the wide-string object FOM name.
-         FOM_name_type = 1; // Object
-         obj_FOM_name  = data_objects[n].get_FOM_name();
+      // Get the class handle for the object FOM name, reusing a memoized
+      // result when another object of the same class already resolved it.
+      bool              cached = false;
+      ObjectClassHandle class_handle;
+      {
+         MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
+
+         map< string, ObjectClassHandle >::const_iterator iter =
+            resolver->class_handle_cache.find( obj_FOM_name );
+         if ( iter != resolver->class_handle_cache.end() ) {
+            class_handle = iter->second;
+            cached       = true;
+         }
+      }
+      if ( !cached ) {
          StringUtilities::to_wstring( ws_FOM_name, obj_FOM_name );
+         class_handle = resolver->rti_amb->getObjectClassHandle( ws_FOM_name );
 
-         // Get the class handle for the given object FOM name.
-         data_objects[n].set_class_handle( rti_amb->getObjectClassHandle( ws_FOM_name ) );
+         MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
+         resolver->class_handle_cache[obj_FOM_name] = class_handle;
+      }
+      obj->set_class_handle( class_handle );
 
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            string handle_str;
-            StringUtilities::to_string( handle_str, data_objects[n].get_class_handle() );
-            msg << "  Result for"
-                << " Object:'" << data_objects[n].get_name() << "'"
-                << " FOM-Name:'" << data_objects[n].get_FOM_name() << "'"
-                << " Class-ID:" << handle_str << endl;
-         }
+      // Resolve the handles/ID's for the attributes.
+      for ( int i = 0; i < attr_count; ++i ) {
 
-         int const  attr_count = data_objects[n].get_attribute_count();
-         Attribute *attrs      = data_objects[n].get_attributes();
+         FOM_name_type = 2; // Attribute
+         attr_FOM_name = attrs[i].get_FOM_name();
 
-         // Resolve the handles/ID's for the attributes.
-         for ( unsigned int i = 0; i < attr_count; ++i ) {
+         string const attr_key = string( obj_FOM_name ) + "." + attr_FOM_name;
 
-            if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-               msg << "\tGetting RTI Attribute-Handle for '"
-                   << data_objects[n].get_FOM_name() << "'->'"
-                   << attrs[i].get_FOM_name() << "'" << endl;
-            }
+         cached = false;
+         AttributeHandle attr_handle;
+         {
+            MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
 
-            // Create the wide-string Attribute FOM name.
-            FOM_name_type = 2; // Attribute
-            attr_FOM_name = attrs[i].get_FOM_name();
+            map< string, AttributeHandle >::const_iterator iter =
+               resolver->attr_handle_cache.find( attr_key );
+            if ( iter != resolver->attr_handle_cache.end() ) {
+               attr_handle = iter->second;
+               cached      = true;
+            }
+         }
+         if ( !cached ) {
             StringUtilities::to_wstring( ws_FOM_name, attr_FOM_name );
+            attr_handle = resolver->rti_amb->getAttributeHandle( class_handle, ws_FOM_name );
 
-            // Get the Attribute-Handle from the RTI.
-            attrs[i].set_attribute_handle(
-               rti_amb->getAttributeHandle( data_objects[n].get_class_handle(), ws_FOM_name ) );
-
-            if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-               string id_str;
-               StringUtilities::to_string( id_str,
-                                           attrs[i].get_attribute_handle() );
-               msg << "\t  Result for Attribute '"
-                   << data_objects[n].get_FOM_name() << "'->'"
-                   << attrs[i].get_FOM_name() << "'"
-                   << " Attribute-ID:" << id_str << endl;
-            }
+            MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
+            resolver->attr_handle_cache[attr_key] = attr_handle;
          }
+         attrs[i].set_attribute_handle( attr_handle );
+      }
 
-         // Make sure we build the attribute map now that the AttributeHandles
-         // have been set.
-         data_objects[n].build_attribute_map();
+      // Make sure we build the attribute map now that the AttributeHandles
+      // have been set. The map is per-object so this is thread safe.
+      obj->build_attribute_map();
 
-         if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            send_hs( stdout, msg.str().c_str() );
+      // Record the shared per-class codec plan so the other objects of
+      // this class can skip the per-attribute resolution and the re-sort.
+      {
+         MutexProtection auto_unlock_mutex( &resolver->cache_mutex );
+
+         if ( resolver->plan_cache.find( obj_FOM_name ) == resolver->plan_cache.end() ) {
+            ObjectHandleResolver::ClassCodecPlan &plan = resolver->plan_cache[obj_FOM_name];
+
+            plan.class_handle = class_handle;
+            plan.attr_names.reserve( attr_count );
+            plan.attr_handles.reserve( attr_count );
+            for ( int i = 0; i < attr_count; ++i ) {
+               plan.attr_names.push_back( ( attrs[i].get_FOM_name() != NULL ) ? attrs[i].get_FOM_name() : "" );
+               plan.attr_handles.push_back( attrs[i].get_attribute_handle() );
+            }
+            plan.sorted_order = obj->get_attribute_index_order();
          }
       }
-   } catch ( NameNotFound const &e ) {
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+      if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         string handle_str;
+         StringUtilities::to_string( handle_str, obj->get_class_handle() );
+         send_hs( stdout, "Manager::setup_object_RTI_handles():%d Resolved handles for Object:'%s' FOM-Name:'%s' Class-ID:%s%c",
+                  __LINE__, obj->get_name(), obj->get_FOM_name(),
+                  handle_str.c_str(), THLA_NEWLINE );
+      }
+   } catch ( NameNotFound const &e ) {
       switch ( FOM_name_type ) {
          case 1: { // Object
             ostringstream errmsg;
@@ -1261,74 +1916,139 @@ void Manager::setup_object_RTI_handles(
                    << " ERROR: Object FOM Name '" << obj_FOM_name << "' Not Found. Please check"
                    << " your input or modified-data files to make sure the"
                    << " Object FOM Name is correctly specified." << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
+            resolver->record_error( errmsg.str() );
             break;
          }
-         case 2: { // Attribute
+         case 2: // Attribute
+         default: {
             ostringstream errmsg;
             errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
                    << " ERROR: For Object FOM Name '" << obj_FOM_name << "', Attribute FOM Name '"
                    << attr_FOM_name << "' Not Found. Please check your input or"
                    << " modified-data files to make sure the Object Attribute"
                    << " FOM Name is correctly specified." << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
-            break;
-         }
-         default: { // FOM name we are working with is unknown.
-            ostringstream errmsg;
-            errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
-                   << " ERROR: Object or Attribute FOM Name Not Found. Please check your input or"
-                   << " modified-data files to make sure the FOM Name is"
-                   << " correctly specified." << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
+            resolver->record_error( errmsg.str() );
             break;
          }
       }
    } catch ( FederateNotExecutionMember const &e ) {
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
-
       ostringstream errmsg;
       errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
              << " ERROR: Federate Not Execution Member" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
+      resolver->record_error( errmsg.str() );
    } catch ( NotConnected const &e ) {
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
-
       ostringstream errmsg;
       errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
              << " ERROR: Not Connected" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
+      resolver->record_error( errmsg.str() );
    } catch ( RTIinternalError const &e ) {
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
-
       string rti_err_msg;
       StringUtilities::to_string( rti_err_msg, e.what() );
       ostringstream errmsg;
       errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
              << " ERROR: RTIinternalError: '"
              << rti_err_msg << "'" << THLA_ENDL;
-      DebugHandler::terminate_with_message( errmsg.str() );
+      resolver->record_error( errmsg.str() );
    } catch ( RTI1516_EXCEPTION const &e ) {
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
       string rti_err_msg;
       StringUtilities::to_string( rti_err_msg, e.what() );
       ostringstream errmsg;
       errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
              << " ERROR: RTI1516_EXCEPTION for '"
              << rti_err_msg << "'" << THLA_ENDL;
+      resolver->record_error( errmsg.str() );
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   return NULL;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::setup_object_RTI_handles(
+   int const data_obj_count,
+   Object   *data_objects )
+{
+   // Just return if we are already initialized.
+   if ( this->mgr_initialized ) {
+      send_hs( stdout, "Manager::setup_object_RTI_handles():%d Already initialized.%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   if ( this->federate == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
+             << " ERROR: Unexpected NULL 'federate' pointer!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::setup_object_RTI_handles():" << __LINE__
+             << " ERROR: Unexpected NULL RTIambassador!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::setup_object_RTI_handles():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // Handle caches shared across the resolution jobs so objects of the
+   // same class only pay for each string-keyed RTI query once.
+   ObjectHandleResolver resolver( rti_amb );
+
+   // Seed the resolver from the process-global restart cache when it has
+   // been validated after a checkpoint reload, so the resolution jobs below
+   // find every handle already cached and make no RTI queries at all.
+   if ( restart_handle_cache().valid ) {
+      resolver.class_handle_cache = restart_handle_cache().class_handles;
+      resolver.attr_handle_cache  = restart_handle_cache().attr_handles;
+   }
+
+   // Resolve the class and attribute handles for all the objects
+   // concurrently from a small worker thread pool. The IEEE 1516 handle
+   // query services are lookups on static FOM data and are thread safe
+   // for the supported RTIs.
+   vector< ObjectHandleResolveJob > resolve_jobs( data_obj_count );
+
+   WorkerThreadPool resolver_pool;
+   for ( int n = 0; n < data_obj_count; ++n ) {
+      resolve_jobs[n].resolver = &resolver;
+      resolve_jobs[n].obj      = &data_objects[n];
+      resolver_pool.post( resolve_object_RTI_handles_job, &resolve_jobs[n] );
+   }
+
+   // Shutting down the pool waits for all the queued jobs to finish.
+   resolver_pool.shutdown();
+
    // Macro to restore the saved FPU Control Word register value.
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // Report the first resolution error, which matches the serial behavior
+   // of terminating on the first handle that failed to resolve.
+   if ( !resolver.error_msg.empty() ) {
+      DebugHandler::terminate_with_message( resolver.error_msg );
+   }
+
+   // Keep the process-global restart cache warm with the resolved handles
+   // so an incremental restore after a future checkpoint reload can reuse
+   // them without re-resolving.
+   restart_handle_cache().class_handles.insert( resolver.class_handle_cache.begin(),
+                                                resolver.class_handle_cache.end() );
+   restart_handle_cache().attr_handles.insert( resolver.attr_handle_cache.begin(),
+                                               resolver.attr_handle_cache.end() );
 }
 
 /*!
@@ -1535,9 +2255,38 @@ void Manager::publish()
       return;
    }
 
-   // Publish attributes for all the Trick-HLA-Objects we know about.
+   // Publish attributes for all the Trick-HLA-Objects we know about. The
+   // object instances are grouped by object class so that only one publish
+   // call is made to the RTI per class, using the union of the published
+   // attribute handles across all the instances of that class. Publication
+   // is cumulative in the RTI so this is equivalent to publishing for each
+   // object instance one at a time.
    for ( n = 0; n < obj_count; ++n ) {
-      objects[n].publish_object_attributes();
+      // Publish an object class only once, so see if an earlier object
+      // already covered this class.
+      bool already_published = false;
+      for ( unsigned int k = 0; ( k < n ) && !already_published; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            already_published = true;
+         }
+      }
+      if ( already_published ) {
+         continue;
+      }
+
+      // Union of the published attribute handles across all the object
+      // instances of this class.
+      AttributeHandleSet attrs;
+      objects[n].add_published_attribute_handles( attrs );
+      for ( unsigned int k = n + 1; k < obj_count; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            objects[k].add_published_attribute_handles( attrs );
+         }
+      }
+
+      if ( !attrs.empty() ) {
+         objects[n].publish_object_class_attributes( attrs );
+      }
    }
 
    // Publish the interactions.
@@ -1616,8 +2365,37 @@ void Manager::subscribe()
    }
 
    // Subscribe to attributes for all the Trick-HLA-Objects we know about.
+   // The object instances are grouped by object class so that only one
+   // subscribe call is made to the RTI per class, using the union of the
+   // subscribed attribute handles across all the instances of that class.
+   // Subscription is cumulative in the RTI so this is equivalent to
+   // subscribing for each object instance one at a time.
    for ( n = 0; n < obj_count; ++n ) {
-      objects[n].subscribe_to_object_attributes();
+      // Subscribe to an object class only once, so see if an earlier object
+      // already covered this class.
+      bool already_subscribed = false;
+      for ( unsigned int k = 0; ( k < n ) && !already_subscribed; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            already_subscribed = true;
+         }
+      }
+      if ( already_subscribed ) {
+         continue;
+      }
+
+      // Union of the subscribed attribute handles across all the object
+      // instances of this class.
+      AttributeHandleSet attrs;
+      objects[n].add_subscribed_attribute_handles( attrs );
+      for ( unsigned int k = n + 1; k < obj_count; ++k ) {
+         if ( objects[n].get_class_handle() == objects[k].get_class_handle() ) {
+            objects[k].add_subscribed_attribute_handles( attrs );
+         }
+      }
+
+      if ( !attrs.empty() ) {
+         objects[n].subscribe_to_object_class_attributes( attrs );
+      }
    }
 
    // Subscribe to the interactions.
@@ -1625,6 +2403,11 @@ void Manager::subscribe()
       interactions[n].subscribe_to_interaction();
    }
 
+   // Build the interaction routing table now that the subscriptions and the
+   // RTI class handles are resolved, so the receive_interaction() callback
+   // path does a constant-cost lookup instead of a linear scan.
+   build_interaction_routes();
+
    // Subscribe to anything needed for the execution control mechanisms.
    this->execution_control->subscribe();
 }
@@ -1684,6 +2467,11 @@ void Manager::unsubscribe()
 
    // Unsubscribe to anything needed for the execution control mechanisms.
    this->execution_control->unsubscribe();
+
+   // The routing table only holds subscribed interactions, so drop it now
+   // that the subscriptions are gone.
+   interaction_route_table.clear();
+   interaction_route_mask = 0;
 }
 
 /*!
@@ -1704,6 +2492,9 @@ void Manager::publish_and_subscribe()
  */
 void Manager::reserve_object_names_with_RTI()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::reserve_object_names_with_RTI" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::reserve_object_names_with_RTI():%d%c",
                __LINE__, THLA_NEWLINE );
@@ -1718,11 +2509,19 @@ void Manager::reserve_object_names_with_RTI()
 
 /*!
  * @details Calling this function will block until all the object instances
- * names for the locally owned objects have been reserved.
+ * names for the locally owned objects have been reserved. The reservation
+ * requests were all made up front in reserve_object_names_with_RTI(), and
+ * the per object waits block on a condition variable shared by all the
+ * objects that is signaled from the RTI name reservation callbacks, so the
+ * total wait is driven by the slowest callback and not by a polling quantum
+ * per object.
  * @job_class{initialization}
  */
 void Manager::wait_for_reservation_of_object_names()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::wait_for_reservation_of_object_names" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::wait_for_reservation_of_object_names():%d%c",
                __LINE__, THLA_NEWLINE );
@@ -1753,6 +2552,9 @@ void Manager::wait_for_reservation_of_object_names()
  */
 void Manager::register_objects_with_RTI()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::register_objects_with_RTI" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::register_objects_with_RTI():%d%c",
                __LINE__, THLA_NEWLINE );
@@ -1768,10 +2570,7 @@ void Manager::register_objects_with_RTI()
 
       // Add the registered object instance to the map and only if it is
       // not already in it.
-      if ( ( objects[n].is_instance_handle_valid() )
-           && ( object_map.find( objects[n].get_instance_handle() ) == object_map.end() ) ) {
-         object_map[objects[n].get_instance_handle()] = &objects[n];
-      }
+      add_object_to_map( &objects[n] );
    }
 }
 
@@ -1802,33 +2601,241 @@ void Manager::setup_preferred_order_with_RTI()
 }
 
 /*!
- * @details Calling this function will block until all the required object
- * instances in the Federation have been registered.
+ * @details The cache records the federation name and the instance names of
+ * the objects that were registered once the federation reached steady
+ * state. A failure to write the cache is only reported as a warning since
+ * the cache is a restart optimization and not simulation state.
  * @job_class{initialization}
  */
-void Manager::wait_for_registration_of_required_objects()
+void Manager::write_warm_start_cache()
 {
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::wait_for_registration_of_required_objects():%d%c",
-               __LINE__, THLA_NEWLINE );
+   if ( !this->warm_start_enabled ) {
+      return;
    }
 
-   int  required_obj_cnt;
-   int  registered_obj_cnt;
-   int  current_registered_obj_cnt  = 0;
-   int  total_obj_cnt               = obj_count;
-   int  current_required_obj_cnt    = 0;
-   int  total_required_obj_cnt      = 0;
-   bool print_summary               = DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER );
-   bool print_only_unregistered_obj = false;
-   bool any_unregistered_required_obj;
-
-   if ( is_execution_configuration_used() ) {
-      // Make sure to count the exec-config object.
-      ++total_obj_cnt;
+   char const *path = ( this->warm_start_cache_file != NULL )
+                         ? this->warm_start_cache_file
+                         : "warm_start.cache";
 
-      // Determine if the Execution-Configuration object is required and it should be.
-      if ( get_execution_configuration()->is_required() ) {
+   // Collect the instance names of the objects that are actually
+   // registered, which is the discovery outcome a rejoining federate can
+   // validate with name probes.
+   vector< string > instance_names;
+   if ( is_execution_configuration_used()
+        && get_execution_configuration()->is_instance_handle_valid() ) {
+      instance_names.push_back( get_execution_configuration()->get_name_string() );
+   }
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      if ( objects[n].is_instance_handle_valid() ) {
+         instance_names.push_back( objects[n].get_name_string() );
+      }
+   }
+
+   ofstream file( path, ios::out );
+   if ( !file.is_open() ) {
+      send_hs( stderr, "Manager::write_warm_start_cache():%d WARNING: Failed \
+to open warm start cache file '%s' for writing!%c",
+               __LINE__, path, THLA_NEWLINE );
+      return;
+   }
+
+   file << "TrickHLA-warm-start-cache-v1" << endl;
+   file << federate->get_federation_name() << endl;
+   file << instance_names.size() << endl;
+   for ( size_t i = 0; i < instance_names.size(); ++i ) {
+      file << instance_names[i] << endl;
+   }
+   file.close();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::write_warm_start_cache():%d Cached the \
+discovery outcome for %d object instance(s) to '%s'.%c",
+               __LINE__, (int)instance_names.size(), path, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details The cached roster is only trusted after it is validated: the
+ * federation name must match and every required object instance must
+ * resolve with a getObjectInstanceHandle() name probe to the RTI. Any
+ * mismatch falls back to the normal blocking wait for the discovery
+ * callbacks, so a stale cache only costs the failed probe.
+ * @job_class{initialization}
+ */
+bool Manager::try_warm_start_discovery()
+{
+   if ( !this->warm_start_enabled ) {
+      return false;
+   }
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      return false;
+   }
+
+   char const *path = ( this->warm_start_cache_file != NULL )
+                         ? this->warm_start_cache_file
+                         : "warm_start.cache";
+
+   ifstream file( path, ios::in );
+   if ( !file.is_open() ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, "Manager::try_warm_start_discovery():%d No warm \
+start cache file '%s', using the normal discovery wait.%c",
+                  __LINE__, path, THLA_NEWLINE );
+      }
+      return false;
+   }
+
+   // Read and validate the cache header against this federation.
+   string format_tag;
+   string cached_federation;
+   getline( file, format_tag );
+   getline( file, cached_federation );
+   if ( ( format_tag != "TrickHLA-warm-start-cache-v1" )
+        || ( cached_federation != federate->get_federation_name() ) ) {
+      send_hs( stdout, "Manager::try_warm_start_discovery():%d Warm start \
+cache file '%s' is stale or for another federation, using the normal \
+discovery wait.%c",
+               __LINE__, path, THLA_NEWLINE );
+      return false;
+   }
+
+   // Read the cached instance name roster.
+   size_t cached_count = 0;
+   file >> cached_count;
+   file.ignore( numeric_limits< streamsize >::max(), '\n' );
+
+   set< string > cached_names;
+   for ( size_t i = 0; i < cached_count; ++i ) {
+      string instance_name;
+      getline( file, instance_name );
+      if ( !file.good() && ( i < ( cached_count - 1 ) ) ) {
+         return false;
+      }
+      cached_names.insert( instance_name );
+   }
+
+   // Every required object must be in the cached roster, otherwise the
+   // object configuration has changed since the cache was written.
+   if ( is_execution_configuration_used()
+        && get_execution_configuration()->is_required()
+        && ( cached_names.find( get_execution_configuration()->get_name_string() ) == cached_names.end() ) ) {
+      return false;
+   }
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      if ( objects[n].is_required()
+           && ( cached_names.find( objects[n].get_name_string() ) == cached_names.end() ) ) {
+         return false;
+      }
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   // Validate the cached roster with a name probe per object and resolve
+   // the instance handles, instead of waiting for discovery callbacks.
+   bool     probes_succeeded = true;
+   unsigned probed_cnt       = 0;
+   {
+      // Concurrency critical code section for discovered objects being set
+      // in FedAmb callback. When auto_unlock_mutex goes out of scope it
+      // automatically unlocks the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+      for ( unsigned int n = 0; ( n <= obj_count ) && probes_succeeded; ++n ) {
+
+         // Handle the execution configuration object with the last index.
+         Object *obj;
+         if ( n < obj_count ) {
+            obj = &objects[n];
+         } else if ( is_execution_configuration_used() ) {
+            obj = get_execution_configuration();
+         } else {
+            break;
+         }
+
+         // Skip objects already discovered through a callback and objects
+         // that were not registered when the cache was written.
+         if ( obj->is_instance_handle_valid() ) {
+            add_object_to_map( obj );
+            continue;
+         }
+         if ( cached_names.find( obj->get_name_string() ) == cached_names.end() ) {
+            continue;
+         }
+
+         try {
+            wstring ws_instance_name;
+            StringUtilities::to_wstring( ws_instance_name, obj->get_name() );
+            obj->set_instance_handle( rti_amb->getObjectInstanceHandle( ws_instance_name ) );
+            add_object_to_map( obj );
+            ++probed_cnt;
+         } catch ( RTI1516_EXCEPTION const &e ) {
+            // The cached instance does not exist in the rejoined federation,
+            // fall back to the normal discovery wait for a required object
+            // and just skip a non-required one.
+            if ( obj->is_required() ) {
+               probes_succeeded = false;
+            }
+         }
+      }
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   if ( !probes_succeeded ) {
+      send_hs( stdout, "Manager::try_warm_start_discovery():%d A required \
+cached object instance did not resolve, using the normal discovery wait.%c",
+               __LINE__, THLA_NEWLINE );
+      return false;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::try_warm_start_discovery():%d Warm started \
+the object discovery from cache file '%s' with %u name probe(s).%c",
+               __LINE__, path, probed_cnt, THLA_NEWLINE );
+   }
+   return true;
+}
+
+/*!
+ * @details Calling this function will block until all the required object
+ * instances in the Federation have been registered.
+ * @job_class{initialization}
+ */
+void Manager::wait_for_registration_of_required_objects()
+{
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::wait_for_registration_of_required_objects():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // A rejoining federate with a validated warm start cache resolves the
+   // instance handles with name probes instead of waiting for the
+   // discovery callbacks.
+   if ( try_warm_start_discovery() ) {
+      return;
+   }
+
+   int  required_obj_cnt;
+   int  registered_obj_cnt;
+   int  current_registered_obj_cnt  = 0;
+   int  total_obj_cnt               = obj_count;
+   int  current_required_obj_cnt    = 0;
+   int  total_required_obj_cnt      = 0;
+   bool print_summary               = DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER );
+   bool print_only_unregistered_obj = false;
+   bool any_unregistered_required_obj;
+
+   if ( is_execution_configuration_used() ) {
+      // Make sure to count the exec-config object.
+      ++total_obj_cnt;
+
+      // Determine if the Execution-Configuration object is required and it should be.
+      if ( get_execution_configuration()->is_required() ) {
          ++total_required_obj_cnt;
       }
    }
@@ -1841,15 +2848,18 @@ void Manager::wait_for_registration_of_required_objects()
       }
    }
 
-   int64_t      wallclock_time;
-   SleepTimeout print_timer( federate->wait_status_time );
-   SleepTimeout sleep_timer;
+   int64_t              wallclock_time;
+   SleepTimeout         print_timer( federate->wait_status_time );
+   AdaptiveSleepTimeout sleep_timer;
 
    do {
 
       // Check for shutdown.
       federate->check_for_shutdown_with_termination();
 
+      // Resolve any discovery callbacks queued on the FedAmb callback thread.
+      process_pending_discoveries();
+
       // Data objects.
       if ( current_required_obj_cnt < total_required_obj_cnt ) {
          required_obj_cnt   = 0;
@@ -2033,21 +3043,19 @@ void Manager::wait_for_registration_of_required_objects()
 
       if ( is_execution_configuration_used() ) {
          // Add the exec-config instance to the map if it is not already in it.
-         if ( ( get_execution_configuration()->is_instance_handle_valid() )
-              && ( object_map.find( get_execution_configuration()->get_instance_handle() ) == object_map.end() ) ) {
-            object_map[get_execution_configuration()->get_instance_handle()] = get_execution_configuration();
-         }
+         add_object_to_map( get_execution_configuration() );
       }
 
       // Add all valid, registered object instances to the map and only if they are
       // not already in it.
       for ( unsigned int n = 0; n < obj_count; ++n ) {
-         if ( ( objects[n].is_instance_handle_valid() )
-              && ( object_map.find( objects[n].get_instance_handle() ) == object_map.end() ) ) {
-            object_map[objects[n].get_instance_handle()] = &objects[n];
-         }
+         add_object_to_map( &objects[n] );
       }
    }
+
+   // All the required objects are registered, which is the steady state
+   // discovery outcome a rejoining federate can warm start from.
+   write_warm_start_cache();
 }
 
 /*!
@@ -2065,6 +3073,7 @@ void Manager::set_all_object_instance_handles_by_name()
    // Clear the map since we are going to rebuild it from the function
    // calls below.
    object_map.clear();
+   object_hash_clear();
 
    if ( is_execution_configuration_used() ) {
       // Execution Configuration object.
@@ -2123,6 +3132,27 @@ void Manager::set_object_instance_handles_by_name(
          char const *instance_name = data_objects[n].get_name();
          StringUtilities::to_wstring( ws_instance_name, instance_name );
 
+         // Reuse the instance handle from the validated restart cache,
+         // avoiding the per-object RTI name lookup.
+         if ( restart_handle_cache().valid ) {
+            map< string, ObjectInstanceHandle >::const_iterator iter =
+               restart_handle_cache().instance_handles.find( instance_name );
+            if ( iter != restart_handle_cache().instance_handles.end() ) {
+               data_objects[n].set_instance_handle( iter->second );
+               add_object_to_map( &data_objects[n] );
+
+               if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+                  string id_str;
+                  StringUtilities::to_string( id_str, data_objects[n].get_instance_handle() );
+                  summary << "\n    Object:'" << data_objects[n].get_name()
+                          << "'  ID:" << id_str << " (from restart cache)"
+                          << "  ID-Valid:" << ( data_objects[n].is_instance_handle_valid() ? "Yes" : "No" )
+                          << "  Obj-Required:" << ( data_objects[n].is_required() ? "Yes" : "No" );
+               }
+               continue;
+            }
+         }
+
          try {
             // Set the instance handle based on the instance name. We do this
             // even for objects that are not required because they may have
@@ -2131,10 +3161,11 @@ void Manager::set_object_instance_handles_by_name(
 
             // Now that we have an instance handle, add it to the object-map if
             // it is not already in it.
-            if ( ( data_objects[n].is_instance_handle_valid() )
-                 && ( object_map.find( data_objects[n].get_instance_handle() ) == object_map.end() ) ) {
-               object_map[data_objects[n].get_instance_handle()] = &data_objects[n];
-            }
+            add_object_to_map( &data_objects[n] );
+
+            // Keep the process-global restart cache warm so an incremental
+            // restore after a future checkpoint reload can reuse this handle.
+            restart_handle_cache().instance_handles[instance_name] = data_objects[n].get_instance_handle();
 
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                string id_str;
@@ -2234,6 +3265,22 @@ void Manager::provide_attribute_update(
    }
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::set_attribute_update_advisory(
+   ObjectInstanceHandle const &theObject,
+   AttributeHandleSet const   &theAttributes,
+   bool const                  updates_on )
+{
+   // Determine which data object the relevance advisory is for. Advisories
+   // for object instances we don't manage are simply ignored.
+   Object *trickhla_obj = get_trickhla_object( theObject );
+   if ( trickhla_obj != NULL ) {
+      trickhla_obj->set_attribute_update_advisory( theAttributes, updates_on );
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2271,22 +3318,238 @@ void Manager::determine_job_cycle_time()
                __LINE__, cycle_time, THLA_NEWLINE );
    }
 
+   // Automatically spread the send phase offsets across the data cycle to
+   // flatten the burst of per-object encode and send work at the start of
+   // the cycle. The multiples of the job cycle time are assigned round-robin
+   // among the objects sharing the same data cycle time. Objects with a data
+   // cycle time matching the job cycle time, objects with a manually
+   // configured phase offset, objects associated to a Trick child thread,
+   // and the members of an atomic update group, which must all send in the
+   // same frame at the same logical timestamp, are left alone.
+   if ( this->auto_stagger_send_phase ) {
+      map< int64_t, unsigned int > next_phase_slot;
+
+      for ( unsigned int n = 0; n < this->obj_count; ++n ) {
+         if ( ( objects[n].send_phase_offset_time == 0.0 )
+              && !objects[n].is_child_thread_associated()
+              && ( objects[n].get_update_group() < 0 ) ) {
+
+            int64_t const data_cycle_base_time = federate->get_data_cycle_base_time_for_obj( n, this->job_cycle_base_time );
+
+            if ( data_cycle_base_time > this->job_cycle_base_time ) {
+               int64_t const slot_count = data_cycle_base_time / this->job_cycle_base_time;
+               int64_t const slot       = next_phase_slot[data_cycle_base_time]++ % slot_count;
+
+               objects[n].send_phase_offset_time = Int64BaseTime::to_seconds( slot * this->job_cycle_base_time );
+
+               if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+                  send_hs( stdout, "Manager::determine_job_cycle_time():%d Object '%s' send phase offset auto-staggered to %f seconds.%c",
+                           __LINE__, objects[n].get_name(),
+                           objects[n].send_phase_offset_time, THLA_NEWLINE );
+               }
+            }
+         }
+      }
+   }
+
    // Set the core job cycle time now that we know what it is so that the
    // attribute cyclic ratios can now be calculated for any multi-rate
    // attributes.
    for ( unsigned int n = 0; n < this->obj_count; ++n ) {
       objects[n].set_core_job_cycle_time( cycle_time );
    }
+
+   // The job cycle time just changed, so the per cycle-time object iteration
+   // lists need to be rebuilt before the next cyclic data job uses them.
+   invalidate_data_cycle_groups();
 }
 
+namespace
+{
+
+/*! @brief Order object indices highest receive priority first. Used with a
+ * stable sort so objects with the same priority keep their input file
+ * declaration order. */
+class ObjectReceivePriorityGreater
+{
+  public:
+   explicit ObjectReceivePriorityGreater( Object const *objs )
+      : objects( objs )
+   {
+      return;
+   }
+
+   bool operator()( unsigned int const lhs, unsigned int const rhs ) const
+   {
+      return ( objects[lhs].get_receive_priority() > objects[rhs].get_receive_priority() );
+   }
+
+  private:
+   Object const *objects; ///< Object array the sorted indices refer into.
+};
+
+} // namespace
+
+/*!
+ * @details Groups the objects into per cycle-time iteration lists so that
+ * the cyclic data jobs only touch the lists that are due to fire on a given
+ * frame, instead of testing the cycle readiness of every object every frame.
+ * The send lists are additionally split by the send phase offset since
+ * objects sharing a cycle time can fire on different frames within that
+ * cycle. The object indices of each list are laid out contiguously in
+ * firing order for a cache friendly traversal.
+ * @job_class{scheduled}
+ */
+void Manager::rebuild_data_cycle_groups()
+{
+   // Group the object indices, keyed so the faster rates come first.
+   map< pair< int64_t, int64_t >, vector< unsigned int > > send_groups;
+   map< int64_t, vector< unsigned int > >                  receive_groups;
+
+   for ( unsigned int n = 0; n < this->obj_count; ++n ) {
+      int64_t cycle = federate->get_data_cycle_base_time_for_obj( n, this->job_cycle_base_time );
+      if ( cycle <= 0LL ) {
+         cycle = this->job_cycle_base_time;
+      }
+
+      // Reduce the phase offset modulo the data cycle time, matching the
+      // send data cycle boundary check.
+      int64_t const phase = ( cycle > 0LL )
+                               ? ( objects[n].get_send_phase_offset_base_time() % cycle )
+                               : 0LL;
+
+      send_groups[make_pair( cycle, phase )].push_back( n );
+      receive_groups[cycle].push_back( n );
+   }
+
+   send_cycle_groups.clear();
+   send_cycle_groups.reserve( send_groups.size() );
+   for ( map< pair< int64_t, int64_t >, vector< unsigned int > >::iterator iter = send_groups.begin();
+         iter != send_groups.end(); ++iter ) {
+      DataCycleGroup group;
+      group.cycle_base_time = iter->first.first;
+      group.phase_base_time = iter->first.second;
+      group.obj_indices.swap( iter->second );
+      send_cycle_groups.push_back( group );
+   }
+
+   receive_cycle_groups.clear();
+   receive_cycle_groups.reserve( receive_groups.size() );
+   for ( map< int64_t, vector< unsigned int > >::iterator iter = receive_groups.begin();
+         iter != receive_groups.end(); ++iter ) {
+      DataCycleGroup group;
+      group.cycle_base_time = iter->first;
+      group.phase_base_time = 0LL;
+      group.obj_indices.swap( iter->second );
+
+      // Process the higher receive priority objects of this list first so
+      // the critical data is decoded before the bulk objects each frame.
+      stable_sort( group.obj_indices.begin(), group.obj_indices.end(),
+                   ObjectReceivePriorityGreater( objects ) );
+
+      receive_cycle_groups.push_back( group );
+   }
+
+   this->data_cycle_groups_built_for = this->job_cycle_base_time;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::rebuild_data_cycle_groups():%d %d objects grouped \
+into %d send and %d receive cycle-time lists.%c",
+               __LINE__, (int)this->obj_count, (int)send_cycle_groups.size(),
+               (int)receive_cycle_groups.size(), THLA_NEWLINE );
+   }
+}
+
+namespace
+{
+
+/*! @brief Context shared by the parallel per-object cyclic data send jobs. */
+struct SendCyclicJobContext {
+   Manager      *manager;               ///< Manager owning the objects.
+   Federate     *federate;              ///< Federate for data cycle queries.
+   int64_t       sim_time_in_base_time; ///< Simulation time in base time.
+   int64_t       granted_base_time;     ///< HLA granted time in base time.
+   int64_t       lookahead_base_time;   ///< Lookahead in base time.
+   int64_t       job_cycle_base_time;   ///< Default job cycle in base time.
+};
+
+/*! @brief Send the cyclic and requested data for one object index. Each
+ * worker computes the per-object update time locally so no shared state is
+ * mutated. */
+void send_cyclic_data_job(
+   void              *user_data,
+   unsigned int const obj_index )
+{
+   SendCyclicJobContext const *ctx = static_cast< SendCyclicJobContext const * >( user_data );
+
+   // Only send data if we are on the send data cycle time boundary for this
+   // object, which includes the object's configured send phase offset.
+   if ( ctx->federate->on_send_data_cycle_boundary_for_obj( obj_index, ctx->sim_time_in_base_time ) ) {
+
+      // Get the cyclic data time for the object.
+      int64_t const dt = ctx->federate->get_data_cycle_base_time_for_obj( obj_index, ctx->job_cycle_base_time );
+
+      Int64Time update_time( ctx->granted_base_time + dt );
+
+      // Make sure the update time is not less than the granted time + lookahead,
+      // which happens if the delta-time step is less than the lookahead time.
+      if ( dt < ctx->lookahead_base_time ) {
+         update_time.set( ctx->granted_base_time + ctx->lookahead_base_time );
+      }
+
+      // Send the data for the object using the cycle time for this object.
+      ctx->manager->objects[obj_index].send_cyclic_and_requested_data( update_time );
+   }
+}
+
+/*! @brief Context shared by the parallel per-object cyclic data receive jobs. */
+struct ReceiveCyclicJobContext {
+   Manager            *manager;               ///< Manager owning the objects.
+   Federate           *federate;              ///< Federate for data cycle queries.
+   int64_t             sim_time_in_base_time; ///< Simulation time in base time.
+   unsigned int const *receive_order;         ///< Claim slot to object index mapping, highest receive priority first, NULL for index order.
+};
+
+/*! @brief Receive the cyclic data for one claim slot, mapped through the
+ * receive priority order when one is active so the high-priority objects
+ * are claimed and decoded first. */
+void receive_cyclic_data_job(
+   void              *user_data,
+   unsigned int const slot_index )
+{
+   ReceiveCyclicJobContext const *ctx = static_cast< ReceiveCyclicJobContext const * >( user_data );
+
+   unsigned int const obj_index = ( ctx->receive_order != NULL )
+                                     ? ctx->receive_order[slot_index]
+                                     : slot_index;
+
+   // Objects in an atomic update group are released together from the main
+   // thread after the worker jobs complete.
+   if ( ctx->manager->objects[obj_index].get_update_group() >= 0 ) {
+      return;
+   }
+
+   // Only receive data if we are on the data cycle time boundary for this object.
+   if ( ctx->federate->on_data_cycle_boundary_for_obj( obj_index, ctx->sim_time_in_base_time ) ) {
+      ctx->manager->objects[obj_index].receive_cyclic_data();
+   }
+}
+
+} // namespace
+
 /*!
  * @job_class{scheduled}
  */
 void Manager::send_cyclic_and_requested_data()
 {
+   // Measure the send stage of the frame for the budget watchdog.
+   FrameBudgetWatchdog::ScopedStage watchdog_stage( federate->frame_watchdog,
+                                                    FrameBudgetWatchdog::STAGE_SEND_DATA );
+
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::send_cyclic_and_requested_data():%d%c",
-               __LINE__, THLA_NEWLINE );
+      ostringstream msg;
+      msg << "Manager::send_cyclic_and_requested_data():" << __LINE__ << THLA_NEWLINE;
+      DebugHandler::print( msg.str() );
    }
 
    // Current time values.
@@ -2296,11 +3559,28 @@ void Manager::send_cyclic_and_requested_data()
                                             ? 0LL
                                             : federate->get_lookahead_in_base_time();
 
+   // Advance the precomputed per-object data cycle schedule tables to this
+   // simulation time from the main thread before any of the per-object data
+   // cycle boundary checks are made, possibly from the worker threads.
+   federate->advance_data_cycle_schedule( sim_time_in_base_time );
+
    // Determine the main thread cycle time for this job if it is not yet known.
    if ( this->job_cycle_base_time <= 0LL ) {
       determine_job_cycle_time();
    }
 
+   // Apply any queued runtime reconfigurations at this data cycle boundary,
+   // before any data jobs are dispatched for the frame.
+   apply_pending_reconfigurations();
+
+   // Start a new send pacing frame sized for this frame's objects, so the
+   // token bucket spreads the RTI call burst across the configured fraction
+   // of the data cycle instead of letting it leave the host back-to-back.
+   if ( federate->send_pacer.enabled ) {
+      federate->send_pacer.begin_frame( Int64BaseTime::to_seconds( this->job_cycle_base_time ),
+                                        this->obj_count );
+   }
+
    // The update_time should be the current granted time plus the data cycle
    // delta time for this job if HLA Time Management is enabled otherwise it
    // is the simulation time plus the cycle delta time for this job. Also, the
@@ -2340,14 +3620,43 @@ void Manager::send_cyclic_and_requested_data()
    // Send any ExecutionControl data requested.
    this->execution_control->send_requested_data( update_time );
 
-   // Send data to remote RTI federates for each of the objects.
-   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+   // Distribute the per-object sends across the data job worker threads
+   // when the worker pool is enabled. The jobs only call into the RTI
+   // through Object::send_cyclic_and_requested_data(), which the HLA-Evolved
+   // RTI API guarantees is thread safe.
+   if ( federate->is_data_job_workers_enabled() && ( this->obj_count > 1 ) ) {
+      SendCyclicJobContext ctx;
+      ctx.manager               = this;
+      ctx.federate              = this->federate;
+      ctx.sim_time_in_base_time = sim_time_in_base_time;
+      ctx.granted_base_time     = granted_base_time;
+      ctx.lookahead_base_time   = lookahead_base_time;
+      ctx.job_cycle_base_time   = this->job_cycle_base_time;
+      federate->execute_object_data_jobs( send_cyclic_data_job, &ctx, this->obj_count );
+
+      // Flush the carrier interaction batches packed this frame.
+      send_interaction_batches();
+      return;
+   }
+
+   // Rebuild the per cycle-time object iteration lists if they are stale.
+   if ( this->data_cycle_groups_built_for != this->job_cycle_base_time ) {
+      rebuild_data_cycle_groups();
+   }
+
+   // Send data to remote RTI federates, touching only the cycle-time lists
+   // that are on their send data cycle boundary for this frame. All the
+   // objects of a list share the same cycle time and send phase offset, so
+   // the boundary is checked once per list using its first object.
+   for ( unsigned int g = 0; g < send_cycle_groups.size(); ++g ) {
+      DataCycleGroup const &group = send_cycle_groups[g];
 
-      // Only send data if we are on the data cycle time boundary for this object.
-      if ( federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_in_base_time ) ) {
+      // Only send data if we are on the send data cycle time boundary for
+      // this list, which includes the configured send phase offset.
+      if ( federate->on_send_data_cycle_boundary_for_obj( group.obj_indices[0], sim_time_in_base_time ) ) {
 
-         // Get the cyclic data time for the object.
-         dt = federate->get_data_cycle_base_time_for_obj( obj_index, this->job_cycle_base_time );
+         // Get the cyclic data time for this list of objects.
+         dt = group.cycle_base_time;
 
          // Reuse the update_time if the data cycle time (dt) is the same.
          if ( dt != prev_dt ) {
@@ -2361,42 +3670,528 @@ void Manager::send_cyclic_and_requested_data()
             }
          }
 
-         // Send the data for the object using the cycle time for this object.
-         objects[obj_index].send_cyclic_and_requested_data( update_time );
+         // Send the data for the objects of this list in firing order.
+         for ( unsigned int k = 0; k < group.obj_indices.size(); ++k ) {
+            objects[group.obj_indices[k]].send_cyclic_and_requested_data( update_time );
+         }
+      }
+   }
+
+   // Flush the carrier interaction batches packed this frame.
+   send_interaction_batches();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::send_interaction_batches()
+{
+   for ( int i = 0; i < inter_count; ++i ) {
+      if ( interactions[i].is_batch_enabled() ) {
+         interactions[i].send_interaction_batch();
+      }
+   }
+}
+
+/*!
+ * @details If the object is owned remotely, this function copies its internal
+ * data into simulation object and marks the object as "unchanged". This data
+ * was deposited by the reflect callback and marked as "changed". By marking
+ * it as unchanged, we avoid copying the same data over and over. If the object
+ * is locally owned, we shouldn't be receiving any remote data anyway and if
+ * we were to -- bogusly -- copy it to the internal byte buffer, we'd
+ * continually reset our local simulation.
+ * @job_class{scheduled}
+ */
+void Manager::receive_cyclic_data()
+{
+   // Measure the receive stage of the frame for the budget watchdog.
+   FrameBudgetWatchdog::ScopedStage watchdog_stage( federate->frame_watchdog,
+                                                    FrameBudgetWatchdog::STAGE_RECEIVE_DATA );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      ostringstream msg;
+      msg << "Manager::receive_cyclic_data():" << __LINE__ << THLA_NEWLINE;
+      DebugHandler::print( msg.str() );
+   }
+
+   int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
+
+   // Advance the precomputed per-object data cycle schedule tables to this
+   // simulation time from the main thread before any of the per-object data
+   // cycle boundary checks are made, possibly from the worker threads.
+   federate->advance_data_cycle_schedule( sim_time_in_base_time );
+
+   // Receive and process any updates for ExecutionControl.
+   this->execution_control->receive_cyclic_data();
+
+   // Rebuild the cached atomic update group lists if the object count changed.
+   if ( this->update_groups_obj_count != this->obj_count ) {
+      rebuild_update_groups();
+   }
+
+   // Distribute the per-object receives across the data job worker threads
+   // when the worker pool is enabled. Each object only touches its own
+   // buffers so the jobs are independent.
+   if ( federate->is_data_job_workers_enabled() && ( obj_count > 1 ) ) {
+
+      // Rebuild the cached receive priority order if the object count changed.
+      if ( object_receive_order.size() != static_cast< size_t >( obj_count ) ) {
+         rebuild_object_receive_order();
+      }
+
+      ReceiveCyclicJobContext ctx;
+      ctx.manager               = this;
+      ctx.federate              = this->federate;
+      ctx.sim_time_in_base_time = sim_time_in_base_time;
+
+      // Claim the objects highest receive priority first. When the adaptive
+      // data job scheduling is enabled its cost-based claim schedule governs
+      // the dispatch order instead, so the priority order is not mapped on
+      // top of it.
+      ctx.receive_order = this->adaptive_data_job_scheduling
+                             ? NULL
+                             : &object_receive_order[0];
+
+      federate->execute_object_data_jobs( receive_cyclic_data_job, &ctx, obj_count );
+
+      // Release the atomic update groups from the main thread so all the
+      // members of a group are handed to the simulation together.
+      if ( !update_groups.empty() ) {
+         process_update_groups( sim_time_in_base_time );
+      }
+      return;
+   }
+
+   // Determine the main thread cycle time for this job if it is not yet known.
+   if ( this->job_cycle_base_time <= 0LL ) {
+      determine_job_cycle_time();
+   }
+
+   // Rebuild the per cycle-time object iteration lists if they are stale.
+   if ( this->data_cycle_groups_built_for != this->job_cycle_base_time ) {
+      rebuild_data_cycle_groups();
+   }
+
+   // Receive data from remote RTI federates, touching only the cycle-time
+   // lists that are on their data cycle boundary for this frame. All the
+   // objects of a list share the same cycle time, so the boundary is checked
+   // once per list using its first object.
+   for ( unsigned int g = 0; g < receive_cycle_groups.size(); ++g ) {
+      DataCycleGroup const &group = receive_cycle_groups[g];
+
+      // Only receive data if we are on the data cycle time boundary for this list.
+      if ( federate->on_data_cycle_boundary_for_obj( group.obj_indices[0], sim_time_in_base_time ) ) {
+         for ( unsigned int k = 0; k < group.obj_indices.size(); ++k ) {
+
+            // Objects in an atomic update group are released together below.
+            if ( objects[group.obj_indices[k]].get_update_group() >= 0 ) {
+               continue;
+            }
+            objects[group.obj_indices[k]].receive_cyclic_data();
+         }
+      }
+   }
+
+   // Release the atomic update groups so all the members of a group are
+   // handed to the simulation together.
+   if ( !update_groups.empty() ) {
+      process_update_groups( sim_time_in_base_time );
+   }
+}
+
+namespace
+{
+
+/*! @brief Order the {receive priority, interaction index} pairs highest
+ * priority first. Used with a stable sort so interactions with the same
+ * priority keep their input file declaration order. */
+bool compare_receive_priority(
+   std::pair< int, int > const &lhs,
+   std::pair< int, int > const &rhs )
+{
+   return ( lhs.first > rhs.first );
+}
+
+} // namespace
+
+void Manager::rebuild_interaction_drain_order()
+{
+   vector< pair< int, int > > priority_order;
+   priority_order.reserve( inter_count );
+
+   for ( int n = 0; n < inter_count; ++n ) {
+      priority_order.push_back( pair< int, int >( interactions[n].get_receive_priority(), n ) );
+   }
+
+   stable_sort( priority_order.begin(), priority_order.end(), compare_receive_priority );
+
+   interaction_drain_order.clear();
+   interaction_drain_order.reserve( priority_order.size() );
+   for ( unsigned int n = 0; n < priority_order.size(); ++n ) {
+      interaction_drain_order.push_back( priority_order[n].second );
+   }
+}
+
+void Manager::rebuild_object_receive_order()
+{
+   object_receive_order.clear();
+   object_receive_order.reserve( obj_count );
+   for ( unsigned int n = 0; n < static_cast< unsigned int >( obj_count ); ++n ) {
+      object_receive_order.push_back( n );
+   }
+
+   stable_sort( object_receive_order.begin(), object_receive_order.end(),
+                ObjectReceivePriorityGreater( objects ) );
+}
+
+void Manager::rebuild_update_groups()
+{
+   // Group the object indices by their assigned update group identifier.
+   map< int, vector< unsigned int > > groups;
+   for ( unsigned int n = 0; n < static_cast< unsigned int >( obj_count ); ++n ) {
+      if ( objects[n].get_update_group() >= 0 ) {
+         groups[objects[n].get_update_group()].push_back( n );
+      }
+   }
+
+   update_groups.clear();
+   update_groups.reserve( groups.size() );
+   for ( map< int, vector< unsigned int > >::iterator iter = groups.begin();
+         iter != groups.end(); ++iter ) {
+      update_groups.push_back( vector< unsigned int >() );
+      update_groups.back().swap( iter->second );
+   }
+
+   this->update_groups_obj_count = this->obj_count;
+}
+
+void Manager::process_update_groups(
+   int64_t const sim_time_in_base_time )
+{
+   for ( unsigned int g = 0; g < update_groups.size(); ++g ) {
+      vector< unsigned int > const &members = update_groups[g];
+
+      // The members of a group share the same data cycle time, so the
+      // boundary is checked once per group using its first member.
+      if ( !federate->on_data_cycle_boundary_for_obj( members[0], sim_time_in_base_time ) ) {
+         continue;
+      }
+
+      // Release the group only when every subscribed member has a new
+      // update pending. Members with no subscribed attributes, such as the
+      // locally owned producer side of the group, do not gate the release.
+      bool complete = true;
+      for ( unsigned int k = 0; k < members.size(); ++k ) {
+         Object *obj = &objects[members[k]];
+         if ( obj->any_remotely_owned_subscribed_attribute() && !obj->is_changed() ) {
+            complete = false;
+            break;
+         }
+      }
+
+      if ( !complete ) {
+         // Leave the pending member data buffered so a later frame releases
+         // the whole group at once, never a torn subset of it.
+         if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            send_hs( stdout, "Manager::process_update_groups():%d Holding back \
+incomplete update group containing object '%s'.%c",
+                     __LINE__, objects[members[0]].get_name(), THLA_NEWLINE );
+         }
+         continue;
+      }
+
+      for ( unsigned int k = 0; k < members.size(); ++k ) {
+         objects[members[k]].receive_cyclic_data();
+      }
+   }
+}
+
+void Manager::set_object_receive_priority(
+   unsigned int const obj_index,
+   int const          priority )
+{
+   if ( obj_index >= static_cast< unsigned int >( obj_count ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::set_object_receive_priority():" << __LINE__
+             << " ERROR: Object index " << obj_index
+             << " is out of range for the " << obj_count
+             << " objects!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   objects[obj_index].receive_priority = priority;
+
+   // Rebuild the cached receive processing orders so the new priority takes
+   // effect on the next cyclic receive job.
+   rebuild_object_receive_order();
+   invalidate_data_cycle_groups();
+}
+
+void Manager::set_attribute_cycle_time(
+   char const  *obj_instance_name,
+   char const  *attr_FOM_name,
+   double const cycle_time )
+{
+   if ( attr_FOM_name == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::set_attribute_cycle_time():" << __LINE__
+             << " ERROR: An attribute FOM name is required!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+   queue_reconfiguration( RECONFIG_CYCLE_TIME, obj_instance_name, attr_FOM_name, cycle_time, false );
+}
+
+void Manager::set_attribute_publish(
+   char const *obj_instance_name,
+   char const *attr_FOM_name,
+   bool const  enable )
+{
+   queue_reconfiguration( RECONFIG_PUBLISH, obj_instance_name, attr_FOM_name, 0.0, enable );
+}
+
+void Manager::set_attribute_subscribe(
+   char const *obj_instance_name,
+   char const *attr_FOM_name,
+   bool const  enable )
+{
+   queue_reconfiguration( RECONFIG_SUBSCRIBE, obj_instance_name, attr_FOM_name, 0.0, enable );
+}
+
+void Manager::set_object_subscribe(
+   char const *obj_instance_name,
+   bool const  enable )
+{
+   queue_reconfiguration( RECONFIG_OBJECT_SUBSCRIBE, obj_instance_name, NULL, 0.0, enable );
+}
+
+void Manager::queue_reconfiguration(
+   int const    kind,
+   char const  *obj_instance_name,
+   char const  *attr_FOM_name,
+   double const cycle_time,
+   bool const   enable )
+{
+   Object *obj = ( obj_instance_name != NULL )
+                    ? get_trickhla_object( string( obj_instance_name ) )
+                    : NULL;
+   if ( obj == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::queue_reconfiguration():" << __LINE__
+             << " ERROR: Unknown object instance name '"
+             << ( ( obj_instance_name != NULL ) ? obj_instance_name : "NULL" )
+             << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   Attribute *attr = NULL;
+   if ( attr_FOM_name != NULL ) {
+      attr = obj->get_attribute( attr_FOM_name );
+      if ( attr == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Manager::queue_reconfiguration():" << __LINE__
+                << " ERROR: Object '" << obj_instance_name
+                << "' has no attribute with FOM name '" << attr_FOM_name
+                << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         return;
+      }
+   }
+
+   PendingReconfig reconfig;
+   reconfig.kind       = kind;
+   reconfig.obj        = obj;
+   reconfig.attr       = attr;
+   reconfig.cycle_time = cycle_time;
+   reconfig.enable     = enable;
+
+   reconfig_mutex.lock();
+   pending_reconfigs.push_back( reconfig );
+   reconfig_mutex.unlock();
+}
+
+void Manager::apply_pending_reconfigurations()
+{
+   // Detach the queued reconfigurations under the lock and apply them
+   // outside it, so a caller queueing more work is never blocked on the
+   // schedule table rebuilds below.
+   reconfig_mutex.lock();
+   if ( pending_reconfigs.empty() ) {
+      reconfig_mutex.unlock();
+      return;
+   }
+   vector< PendingReconfig > reconfigs;
+   reconfigs.swap( pending_reconfigs );
+   reconfig_mutex.unlock();
+
+   // Object instances whose subscription switched this batch, so the
+   // class-scoped RTI subscription changes can be issued once per class.
+   vector< Object * > switched_objects;
+
+   for ( unsigned int n = 0; n < reconfigs.size(); ++n ) {
+      PendingReconfig const &reconfig = reconfigs[n];
+
+      switch ( reconfig.kind ) {
+         case RECONFIG_CYCLE_TIME: {
+            // Revalidate the new cycle time against the core job cycle
+            // time, which is known by the time this is called.
+            reconfig.attr->cycle_time = reconfig.cycle_time;
+            reconfig.attr->determine_cycle_ratio( Int64BaseTime::to_seconds( this->job_cycle_base_time ) );
+
+            // The send cycle wheel buckets the attributes by sub-rate, so
+            // rebuild it to match the new cycle ratio.
+            reconfig.obj->build_send_cycle_wheel();
+            break;
+         }
+         case RECONFIG_PUBLISH: {
+            if ( reconfig.attr != NULL ) {
+               reconfig.attr->set_publish( reconfig.enable );
+            } else {
+               for ( int i = 0; i < reconfig.obj->attr_count; ++i ) {
+                  reconfig.obj->attributes[i].set_publish( reconfig.enable );
+               }
+            }
+            reconfig.obj->invalidate_ownership_counts();
+            break;
+         }
+         case RECONFIG_SUBSCRIBE: {
+            if ( reconfig.attr != NULL ) {
+               reconfig.attr->set_subscribe( reconfig.enable );
+            } else {
+               for ( int i = 0; i < reconfig.obj->attr_count; ++i ) {
+                  reconfig.obj->attributes[i].set_subscribe( reconfig.enable );
+               }
+            }
+            reconfig.obj->invalidate_ownership_counts();
+            break;
+         }
+         case RECONFIG_OBJECT_SUBSCRIBE: {
+            if ( reconfig.obj->is_subscription_active() != reconfig.enable ) {
+               reconfig.obj->set_subscription_active( reconfig.enable );
+               switched_objects.push_back( reconfig.obj );
+            }
+            break;
+         }
+         default: {
+            break;
+         }
+      }
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, "Manager::apply_pending_reconfigurations():%d Applied \
+runtime reconfiguration %d of object '%s'.%c",
+                  __LINE__, reconfig.kind, reconfig.obj->get_name(), THLA_NEWLINE );
       }
    }
+
+   // Issue the class-scoped RTI subscription changes for the instances
+   // switched above, with at most one RTI call per affected object class.
+   if ( !switched_objects.empty() ) {
+      apply_subscription_switches( switched_objects );
+   }
 }
 
 /*!
- * @details If the object is owned remotely, this function copies its internal
- * data into simulation object and marks the object as "unchanged". This data
- * was deposited by the reflect callback and marked as "changed". By marking
- * it as unchanged, we avoid copying the same data over and over. If the object
- * is locally owned, we shouldn't be receiving any remote data anyway and if
- * we were to -- bogusly -- copy it to the internal byte buffer, we'd
- * continually reset our local simulation.
- * @job_class{scheduled}
+ * @details Shedding the subscriptions of hundreds of out-of-range object
+ * instances in one frame must not issue hundreds of serial RTI calls. The
+ * switched instances are grouped by object class and for each affected
+ * class the union of the subscribed attribute handles across the active
+ * instances is computed: an empty union sheds the class subscription with
+ * one unsubscribe call, otherwise the union is re-subscribed with one
+ * subscribe call, which is cumulative in the RTI so the class subscription
+ * is re-established after a shed without a window where reflections are
+ * lost. Instances switched off while other instances of their class stay
+ * active are filtered locally by Object::receive_cyclic_data() instead,
+ * because an HLA class subscription cannot exclude individual instances.
  */
-void Manager::receive_cyclic_data()
+void Manager::apply_subscription_switches(
+   vector< Object * > const &switched_objects )
 {
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::receive_cyclic_data():%d%c",
-               __LINE__, THLA_NEWLINE );
+   if ( !is_RTI_ready( "apply_subscription_switches" ) ) {
+      return;
    }
 
-   int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
+   for ( unsigned int n = 0; n < switched_objects.size(); ++n ) {
 
-   // Receive and process any updates for ExecutionControl.
-   this->execution_control->receive_cyclic_data();
+      // Handle each affected object class only once, so see if an earlier
+      // switched object already covered this class.
+      bool class_handled = false;
+      for ( unsigned int k = 0; ( k < n ) && !class_handled; ++k ) {
+         if ( switched_objects[n]->get_class_handle() == switched_objects[k]->get_class_handle() ) {
+            class_handled = true;
+         }
+      }
+      if ( class_handled ) {
+         continue;
+      }
 
-   // Receive data from remote RTI federates for each of the objects.
-   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      // Union of the subscribed attribute handles across the active object
+      // instances of this class.
+      AttributeHandleSet attrs;
+      for ( unsigned int i = 0; i < obj_count; ++i ) {
+         if ( ( objects[i].get_class_handle() == switched_objects[n]->get_class_handle() )
+              && objects[i].is_subscription_active() ) {
+            objects[i].add_subscribed_attribute_handles( attrs );
+         }
+      }
+
+      if ( attrs.empty() ) {
+         // No active instance of this class needs data any more, so shed
+         // the class subscription and the RTI stops delivering the
+         // reflections entirely.
+         switched_objects[n]->unsubscribe_all_object_attributes();
+      } else {
+         switched_objects[n]->subscribe_to_object_class_attributes( attrs );
+      }
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         send_hs( stdout, "Manager::apply_subscription_switches():%d %s for \
+the object class of instance '%s'.%c",
+                  __LINE__,
+                  ( attrs.empty() ? "Shed the class subscription"
+                                  : "Re-subscribed the active attribute union" ),
+                  switched_objects[n]->get_name(), THLA_NEWLINE );
+      }
+   }
+}
+
+void Manager::set_interactions_queue_capacity(
+   int const                     queue_capacity,
+   QueueOverflowPolicyEnum const policy )
+{
+   this->interactions_queue_capacity        = queue_capacity;
+   this->interactions_queue_overflow_policy = policy;
+
+   // Apply the bound to each per-interaction receive queue. The bound is
+   // also applied when an interaction is initialized, which covers the
+   // case where this is called from the input file before the interactions
+   // have been set up.
+   for ( int n = 0; n < inter_count; ++n ) {
+      interactions[n].get_receive_queue().set_capacity( queue_capacity, policy );
+   }
+}
 
-      // Only receive data if we are on the data cycle time boundary for this object.
-      if ( federate->on_data_cycle_boundary_for_obj( n, sim_time_in_base_time ) ) {
-         objects[n].receive_cyclic_data();
+int Manager::get_interactions_queue_high_water_mark() const
+{
+   int high_water_mark = 0;
+   for ( int n = 0; n < inter_count; ++n ) {
+      if ( interactions[n].get_receive_queue().get_high_water_mark() > high_water_mark ) {
+         high_water_mark = interactions[n].get_receive_queue().get_high_water_mark();
       }
    }
+   return high_water_mark;
+}
+
+long long Manager::get_interactions_queue_dropped_count() const
+{
+   long long dropped_count = 0;
+   for ( int n = 0; n < inter_count; ++n ) {
+      dropped_count += interactions[n].get_receive_queue().get_dropped_count();
+   }
+   return dropped_count;
 }
 
 /*!
@@ -2407,57 +4202,99 @@ void Manager::process_interactions()
    // Process any ExecutionControl mode transitions.
    this->execution_control->process_mode_interaction();
 
-   // Just return if the interaction queue is empty.
-   if ( interactions_queue.empty() ) {
-      return;
+   // Rebuild the cached drain order if the interaction count changed.
+   if ( interaction_drain_order.size() != static_cast< size_t >( inter_count ) ) {
+      rebuild_interaction_drain_order();
    }
 
-   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-      send_hs( stdout, "Manager::process_interactions():%d%c",
-               __LINE__, THLA_NEWLINE );
-   }
+   bool drained_an_item = false;
 
-   // Process all the interactions in the queue.
-   while ( !interactions_queue.empty() ) {
+   // Drain the per-interaction receive queues highest priority first, so a
+   // safety-critical interaction class is never queued behind a flood of
+   // low-priority items. Each drain() detaches that interaction's entire
+   // chain under a single lock acquisition and the detached chain is
+   // processed lock-free, so producers of the other interaction classes
+   // are never blocked by this drain loop.
+   for ( unsigned int n = 0; n < interaction_drain_order.size(); ++n ) {
 
-      // Get a reference to the first item on the queue.
-      InteractionItem *interaction_item =
-         static_cast< InteractionItem * >( interactions_queue.front() );
+      int const inter_index = interaction_drain_order[n];
+
+      if ( interactions[inter_index].get_receive_queue().empty() ) {
+         continue;
+      }
+
+      if ( !drained_an_item ) {
+         drained_an_item = true;
 
-      switch ( interaction_item->interaction_type ) {
-         case TRICKHLA_MANAGER_USER_DEFINED_INTERACTION: {
-            // Process the interaction if we subscribed to it and the interaction
-            // index is valid.
-            if ( ( interaction_item->index >= 0 )
-                 && ( interaction_item->index < inter_count )
-                 && interactions[interaction_item->index].is_subscribe() ) {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            send_hs( stdout, "Manager::process_interactions():%d%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+      }
 
-               interactions[interaction_item->index].extract_data( interaction_item );
+      InteractionItem *interaction_item =
+         static_cast< InteractionItem * >( interactions[inter_index].get_receive_queue().drain() );
+
+      // Process all the interactions in the detached chain.
+      while ( interaction_item != NULL ) {
+
+         bool item_deferred = false;
+
+         switch ( interaction_item->interaction_type ) {
+            case TRICKHLA_MANAGER_USER_DEFINED_INTERACTION: {
+               // Process the interaction if we subscribed to it and the interaction
+               // index is valid.
+               if ( ( interaction_item->index >= 0 )
+                    && ( interaction_item->index < inter_count )
+                    && interactions[interaction_item->index].is_subscribe() ) {
+
+                  if ( interactions[interaction_item->index].is_deferrable() ) {
+                     // A handler flagged as deferrable is dispatched on a
+                     // worker pool thread below so a slow handler does not
+                     // stall the drain loop for the other interactions.
+                     item_deferred = true;
+                  } else {
+                     interactions[interaction_item->index].extract_data( interaction_item );
+
+                     interactions[interaction_item->index].process_interaction();
+                  }
+               }
+               break;
+            }
 
-               interactions[interaction_item->index].process_interaction();
+            default: {
+               ostringstream errmsg;
+               errmsg << "Manager::process_interactions():" << __LINE__
+                      << " FATAL ERROR: encountered an invalid interaction type: "
+                      << interaction_item->interaction_type
+                      << ". Verify that you are specifying the correct interaction "
+                      << "type defined in 'ManagerTypeOfInteractionEnum' enum "
+                      << "found in 'Manager.hh' and re-run." << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
+               break;
             }
-            break;
          }
 
-         default: {
-            ostringstream errmsg;
-            errmsg << "Manager::process_interactions():" << __LINE__
-                   << " FATAL ERROR: encountered an invalid interaction type: "
-                   << interaction_item->interaction_type
-                   << ". Verify that you are specifying the correct interaction "
-                   << "type defined in 'ManagerTypeOfInteractionEnum' enum "
-                   << "found in 'Manager.hh' and re-run." << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
-            break;
+         // Now that we processed the interaction-item, advance to the next
+         // item in the chain and either hand the item off for deferred
+         // dispatch or delete it.
+         InteractionItem *processed_item = interaction_item;
+
+         interaction_item = static_cast< InteractionItem * >( processed_item->next );
+
+         if ( item_deferred ) {
+            // The deferred dispatch queue takes ownership of the item and
+            // deletes it once the item has been processed.
+            interactions[processed_item->index].defer_interaction_item( processed_item );
+         } else {
+            delete processed_item;
          }
       }
-
-      // Now that we processed the interaction-item remove it from the queue,
-      // which will result in the item being deleted and no longer valid.
-      interactions_queue.pop();
    }
 
-   clear_interactions();
+   if ( drained_an_item ) {
+      clear_interactions();
+   }
 }
 
 /*!
@@ -2470,55 +4307,100 @@ void Manager::receive_interaction(
    LogicalTime const             &theTime,
    bool const                     received_as_TSO )
 {
-   // Find the Interaction we have data for.
-   for ( unsigned int i = 0; i < inter_count; ++i ) {
-
-      // Process the interaction if we subscribed to it and we have the same class handle.
-      if ( interactions[i].is_subscribe()
-           && ( interactions[i].get_class_handle() == theInteraction ) ) {
-
-         InteractionItem *item;
-         if ( received_as_TSO ) {
-            item = new InteractionItem( i,
-                                        TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
-                                        interactions[i].get_parameter_count(),
-                                        interactions[i].get_parameters(),
-                                        theParameterValues,
-                                        theUserSuppliedTag,
-                                        theTime );
-         } else {
-            item = new InteractionItem( i,
-                                        TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
-                                        interactions[i].get_parameter_count(),
-                                        interactions[i].get_parameters(),
-                                        theParameterValues,
-                                        theUserSuppliedTag );
-         }
-
-         // Add the interaction item to the queue.
-         interactions_queue.push( item );
+   // Find the subscribed Interaction we have data for using the routing
+   // table resolved at subscribe time, so this RTI callback path does a
+   // constant-cost lookup with no mutex.
+   int const i = interaction_route_find( theInteraction );
+   if ( i >= 0 ) {
+
+      // A carrier interaction holds a whole frame of batched sends packed
+      // into the user supplied tag. Unpack it and queue one item per packed
+      // interaction so process_interactions() delivers each one to the
+      // interaction handler individually. A malformed batch falls through
+      // to the normal single item delivery.
+      if ( Interaction::is_batch_tag( theUserSuppliedTag ) ) {
+         vector< Interaction::BatchRecord > records;
+         if ( Interaction::unpack_batch( get_RTI_ambassador(), theUserSuppliedTag, records ) ) {
+            for ( unsigned int r = 0; r < records.size(); ++r ) {
+               InteractionItem *batched_item;
+               if ( received_as_TSO ) {
+                  batched_item = new InteractionItem( i,
+                                                      TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
+                                                      interactions[i].get_parameter_count(),
+                                                      interactions[i].get_parameters(),
+                                                      records[r].param_values,
+                                                      records[r].user_supplied_tag,
+                                                      theTime );
+               } else {
+                  batched_item = new InteractionItem( i,
+                                                      TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
+                                                      interactions[i].get_parameter_count(),
+                                                      interactions[i].get_parameters(),
+                                                      records[r].param_values,
+                                                      records[r].user_supplied_tag );
+               }
+               interactions[i].get_receive_queue().push( batched_item );
 
-         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            if ( received_as_TSO ) {
-               Int64Time _time;
-               _time.set( theTime );
+               // Update the live performance counters.
+               Metrics::count_interaction_received();
+            }
 
+            if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                string handle;
                StringUtilities::to_string( handle, theInteraction );
-               send_hs( stdout, "Manager::receive_interaction():%d ID:%s, HLA-time:%G%c",
-                        __LINE__, handle.c_str(), _time.get_time_in_seconds(),
-                        THLA_NEWLINE );
-            } else {
-               string handle;
-               StringUtilities::to_string( handle, theInteraction );
-               send_hs( stdout, "Manager::receive_interaction():%d ID:%s%c",
-                        __LINE__, handle.c_str(), THLA_NEWLINE );
+               send_hs( stdout, "Manager::receive_interaction():%d ID:%s, unpacked %d batched interactions%c",
+                        __LINE__, handle.c_str(), (int)records.size(), THLA_NEWLINE );
             }
+            return;
          }
+      }
 
-         // Return now that we put the interaction-item into the queue.
-         return;
+      InteractionItem *item;
+      if ( received_as_TSO ) {
+         item = new InteractionItem( i,
+                                     TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
+                                     interactions[i].get_parameter_count(),
+                                     interactions[i].get_parameters(),
+                                     theParameterValues,
+                                     theUserSuppliedTag,
+                                     theTime );
+      } else {
+         item = new InteractionItem( i,
+                                     TRICKHLA_MANAGER_USER_DEFINED_INTERACTION,
+                                     interactions[i].get_parameter_count(),
+                                     interactions[i].get_parameters(),
+                                     theParameterValues,
+                                     theUserSuppliedTag );
+      }
+
+      // Add the interaction item to the receive queue owned by this
+      // interaction class, so producers of different classes do not
+      // contend on a shared queue lock.
+      interactions[i].get_receive_queue().push( item );
+
+      // Update the live performance counters.
+      Metrics::count_interaction_received();
+
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         if ( received_as_TSO ) {
+            Int64Time _time;
+            _time.set( theTime );
+
+            string handle;
+            StringUtilities::to_string( handle, theInteraction );
+            send_hs( stdout, "Manager::receive_interaction():%d ID:%s, HLA-time:%G%c",
+                     __LINE__, handle.c_str(), _time.get_time_in_seconds(),
+                     THLA_NEWLINE );
+         } else {
+            string handle;
+            StringUtilities::to_string( handle, theInteraction );
+            send_hs( stdout, "Manager::receive_interaction():%d ID:%s%c",
+                     __LINE__, handle.c_str(), THLA_NEWLINE );
+         }
       }
+
+      // Return now that we put the interaction-item into the queue.
+      return;
    }
 
    // Let ExectionControl receive any interactions.
@@ -2535,8 +4417,31 @@ void Manager::receive_interaction(
 Object *Manager::get_trickhla_object(
    RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_id )
 {
-   // We use a map with the key being the ObjectIntanceHandle for fast lookups.
+   // Use the open-addressing hash table keyed on the instance handle hash
+   // for the lookup since this is called for every FedAmb discovery and
+   // reflection callback.
+   Object *obj = object_hash_find( instance_id );
+   if ( obj != NULL ) {
+      return obj;
+   }
+
+   // Fall back to the map for the case where the hash table has not been
+   // built yet.
    ObjectInstanceMap::const_iterator iter = object_map.find( instance_id );
+   if ( iter != object_map.end() ) {
+      return iter->second;
+   }
+
+   // A miss can mean the discovery callback for this instance is still
+   // queued for batch resolution, so resolve the pending discoveries and
+   // look one more time.
+   process_pending_discoveries();
+
+   obj = object_hash_find( instance_id );
+   if ( obj != NULL ) {
+      return obj;
+   }
+   iter = object_map.find( instance_id );
    return ( ( iter != object_map.end() ) ? iter->second : NULL );
 }
 
@@ -2582,45 +4487,34 @@ bool Manager::discover_object_instance(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
 
-   bool return_value = false;
-
-   // Get the unregistered TrickHLA Object for the given class handle and
-   // object instance name.
-   Object *trickhla_obj = get_unregistered_object( theObjectClass, theObjectInstanceName );
-
-   // If we did not find the object by class handle and instance name then
-   // get the first unregistered object that is remotely owned for the given
-   // object class type.
+   // Resolve the ExecutionControl objects (e.g. the ExCO) right away since
+   // the initialization process has waits that poll their instance handles
+   // directly and the check is only a name compare against a few objects.
+   Object *trickhla_obj = this->execution_control->get_unregistered_object( theObjectClass, theObjectInstanceName );
    if ( trickhla_obj == NULL ) {
-
-      // Get the first unregistered remotely owned object that has the
-      // given object class type and only if the object instance name is
-      // not required.
-      trickhla_obj = get_unregistered_remote_object( theObjectClass );
+      trickhla_obj = this->execution_control->get_unregistered_remote_object( theObjectClass );
    }
 
-   // Determine if the discovered instance was for a data object.
+   // Determine if the discovered instance was for an ExecutionControl object.
    if ( trickhla_obj != NULL ) {
       // Set the Instance ID for the discovered object.
       trickhla_obj->set_instance_handle_and_name( theObject, theObjectInstanceName );
 
       // Put this discovered instance in the map of object instance handles.
-      if ( object_map.find( trickhla_obj->get_instance_handle() ) == object_map.end() ) {
-         object_map[theObject] = trickhla_obj;
-      }
-
-      return_value = true;
+      add_object_to_map( trickhla_obj );
 
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
          string id_str;
          StringUtilities::to_string( id_str, theObject );
-         send_hs( stdout, "Manager::discover_object_instance():%d Data-Object '%s' Instance-ID:%s%c",
+         send_hs( stdout, "Manager::discover_object_instance():%d Execution-Control Object '%s' Instance-ID:%s%c",
                   __LINE__, trickhla_obj->get_name(), id_str.c_str(), THLA_NEWLINE );
       }
-   } else if ( ( federate != NULL ) && federate->is_MOM_HLAfederate_class( theObjectClass ) ) {
+      return true;
+   }
+
+   if ( ( federate != NULL ) && federate->is_MOM_HLAfederate_class( theObjectClass ) ) {
 
       federate->add_federate_instance_id( theObject );
-      return_value = true;
 
       // save into my federate's discovered federate storage area
       federate->add_MOM_HLAfederate_instance_id( theObject, theObjectInstanceName );
@@ -2632,10 +4526,12 @@ bool Manager::discover_object_instance(
          send_hs( stdout, "Manager::discover_object_instance():%d Discovered MOM HLA-Federate Object-Instance-ID:%s Name:'%s'%c",
                   __LINE__, id_str.c_str(), name_str.c_str(), THLA_NEWLINE );
       }
-   } else if ( ( federate != NULL ) && federate->is_MOM_HLAfederation_class( theObjectClass ) ) {
+      return true;
+   }
+
+   if ( ( federate != NULL ) && federate->is_MOM_HLAfederation_class( theObjectClass ) ) {
 
       federate->add_MOM_HLAfederation_instance_id( theObject );
-      return_value = true;
 
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
          string id_str, name_str;
@@ -2644,9 +4540,100 @@ bool Manager::discover_object_instance(
          send_hs( stdout, "Manager::discover_object_instance():%d MOM HLA-Federation '%s' Instance-ID:%s%c",
                   __LINE__, name_str.c_str(), id_str.c_str(), THLA_NEWLINE );
       }
+      return true;
+   }
+
+   // Everything else is a data object discovery. Just queue a record of the
+   // callback here and resolve it against the simulation data objects in a
+   // batch on the simulation thread (see process_pending_discoveries()). The
+   // name matching scans the object arrays per discovery, so doing it inline
+   // would stall the FedAmb callback queue and delay the time management
+   // callbacks behind a discovery storm when a federate with many object
+   // instances joins the federation.
+   PendingDiscoveryRecord record;
+   record.instance_handle = theObject;
+   record.class_handle    = theObjectClass;
+   record.instance_name   = theObjectInstanceName;
+   pending_discoveries.push_back( record );
+
+   // Wake the simulation thread if it is blocked in
+   // wait_for_discovery_of_objects() waiting on required objects.
+   pthread_cond_broadcast( &obj_discovery_cond );
+
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::process_pending_discoveries()
+{
+   // Move the queued discovery records to a local vector so that the FedAmb
+   // callback thread is never blocked behind the name matching below.
+   vector< PendingDiscoveryRecord > records;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+      if ( pending_discoveries.empty() ) {
+         return;
+      }
+      records.swap( pending_discoveries );
    }
 
-   return return_value;
+   for ( unsigned int i = 0; i < records.size(); ++i ) {
+
+      // Concurrency critical code section for discovered objects being set
+      // while the FedAmb callback queues more records.
+      //
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+      // Get the unregistered TrickHLA Object for the given class handle and
+      // object instance name.
+      Object *trickhla_obj = get_unregistered_object( records[i].class_handle,
+                                                      records[i].instance_name );
+
+      // If we did not find the object by class handle and instance name then
+      // get the first unregistered object that is remotely owned for the
+      // given object class type.
+      if ( trickhla_obj == NULL ) {
+
+         // Get the first unregistered remotely owned object that has the
+         // given object class type and only if the object instance name is
+         // not required.
+         trickhla_obj = get_unregistered_remote_object( records[i].class_handle );
+      }
+
+      // Determine if the discovered instance was for a data object.
+      if ( trickhla_obj != NULL ) {
+         // Set the Instance ID for the discovered object.
+         trickhla_obj->set_instance_handle_and_name( records[i].instance_handle,
+                                                     records[i].instance_name );
+
+         // Put this discovered instance in the map of object instance handles.
+         add_object_to_map( trickhla_obj );
+
+         // Record when this object instance was discovered so that slow
+         // discoveries can be diagnosed after a long startup.
+         trickhla_obj->set_discovery_wallclock_time( clock_wall_time() );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            string id_str;
+            StringUtilities::to_string( id_str, records[i].instance_handle );
+            send_hs( stdout, "Manager::process_pending_discoveries():%d Data-Object '%s' Instance-ID:%s%c",
+                     __LINE__, trickhla_obj->get_name(), id_str.c_str(), THLA_NEWLINE );
+         }
+      } else if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         string id_str, name_str;
+         StringUtilities::to_string( id_str, records[i].instance_handle );
+         StringUtilities::to_string( name_str, records[i].instance_name );
+         send_hs( stderr, "Manager::process_pending_discoveries():%d Object '%s' with Instance-ID:%s is UNKNOWN to me!%c",
+                  __LINE__, name_str.c_str(), id_str.c_str(), THLA_NEWLINE );
+      }
+   }
 }
 
 /*!
@@ -2715,19 +4702,58 @@ Object *Manager::get_unregistered_remote_object(
  */
 void Manager::process_ownership()
 {
-   // Push ownership to the other federates if the push ownership
-   // flag has been enabled.
-   push_ownership();
+   // Only the objects that registered pending ownership transfer work are
+   // processed, so a frame with no transfers in flight costs one empty
+   // list check instead of four request scans across every object.
+   vector< Object * > pending;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &ownership_pending_mutex );
+
+      if ( ownership_pending_objects.empty() ) {
+         return;
+      }
+      pending.swap( ownership_pending_objects );
+   }
 
-   // Release ownership if we have a request to divest.
-   release_ownership();
+   for ( size_t n = 0; n < pending.size(); ++n ) {
+      Object *obj = pending[n];
+
+      // Clear the registration before processing so an ownership event
+      // arriving while the object is processed registers it again.
+      obj->clear_ownership_work_registration();
+
+      // Push ownership to the other federates if the push ownership
+      // flag has been enabled.
+      obj->push_ownership();
+
+      // Release ownership if we have a request to divest.
+      obj->release_ownership();
+
+      // Pull ownership from the other federates if the pull ownership
+      // flag has been enabled.
+      obj->pull_ownership();
+
+      // Grant any request to pull the ownership.
+      obj->grant_pull_request();
+
+      // Requests scheduled for a future time stay in the request maps, so
+      // keep the object on the pending list until its work drains.
+      if ( obj->is_ownership_work_pending() ) {
+         obj->notify_ownership_work_pending();
+      }
+   }
+}
 
-   // Pull ownership from the other federates if the pull ownership
-   // flag has been enabled.
-   pull_ownership();
+void Manager::register_ownership_work(
+   Object *obj )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &ownership_pending_mutex );
 
-   // Grant any request to pull the ownership.
-   grant_pull_request();
+   ownership_pending_objects.push_back( obj );
 }
 
 void Manager::mark_object_as_deleted_from_federation(
@@ -2926,18 +4952,42 @@ void Manager::setup_checkpoint_interactions()
    // Clear the checkpoint for the interactions so that we don't leak memory.
    clear_interactions();
 
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &interactions_queue.mutex );
+   // Count the items queued across the per-interaction receive queues. The
+   // FedAmb callback thread can push new items after a queue is counted,
+   // but the copy pass below only walks the counted items, so a late
+   // arrival is simply left for the next checkpoint just as it would have
+   // been when the push blocked on a shared queue lock.
+   vector< int > queue_counts( static_cast< size_t >( inter_count ), 0 );
+   int           total_count = 0;
+   size_t        total_bytes = 0;
+   for ( int n = 0; n < inter_count; ++n ) {
+      ItemQueue &receive_queue = interactions[n].get_receive_queue();
+
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &receive_queue.mutex );
+
+      queue_counts[n] = receive_queue.size();
+      total_count += queue_counts[n];
+
+      // Total the payload bytes of the counted items so all the payload
+      // copies below can be staged into one contiguous arena allocation.
+      for ( int k = 0; k < queue_counts[n]; ++k ) {
+         InteractionItem *item = static_cast< InteractionItem * >( receive_queue.front() );
+         total_bytes += item->get_checkpoint_payload_size();
+         receive_queue.next( item );
+      }
+      receive_queue.rewind();
+   }
 
-   if ( !interactions_queue.empty() ) {
+   if ( total_count > 0 ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         send_hs( stdout, "Manager::setup_checkpoint_interactions():%d interactions_queue.size()=%d%c",
-                  __LINE__, interactions_queue.size(), THLA_NEWLINE );
+         send_hs( stdout, "Manager::setup_checkpoint_interactions():%d interaction receive queues hold %d items%c",
+                  __LINE__, total_count, THLA_NEWLINE );
       }
 
       // Get the count to use for the check.
-      check_interactions_count = interactions_queue.size();
+      check_interactions_count = total_count;
 
       // Allocate the interaction items base don the count.
       check_interactions = reinterpret_cast< InteractionItem * >(
@@ -2950,55 +5000,114 @@ void Manager::setup_checkpoint_interactions()
                 << THLA_ENDL;
          DebugHandler::terminate_with_message( errmsg.str() );
       }
+      AllocationTracker::record_alloc( AllocationTracker::SUBSYS_CHECKPOINT_DATA,
+                                       (long long)check_interactions_count * (long long)sizeof( InteractionItem ) );
+
+      // Grow the payload arena when this checkpoint needs more than the
+      // high-water mark of the previous checkpoints. The arena is one
+      // contiguous block holding every parameter payload and user supplied
+      // tag, replacing a Trick memory allocation per payload, and it is
+      // retained between checkpoints so a steady-state checkpoint only
+      // copies.
+      if ( total_bytes > check_interactions_arena_size ) {
+         if ( check_interactions_arena != NULL ) {
+            if ( trick_MM->delete_var( static_cast< void * >( check_interactions_arena ) ) ) {
+               send_hs( stderr, "Manager::setup_checkpoint_interactions():%d ERROR deleting Trick Memory for 'check_interactions_arena'%c",
+                        __LINE__, THLA_NEWLINE );
+            }
+            AllocationTracker::record_free( AllocationTracker::SUBSYS_CHECKPOINT_DATA,
+                                            (long long)check_interactions_arena_size );
+         }
+         check_interactions_arena = static_cast< unsigned char * >(
+            TMM_declare_var_1d( "unsigned char", total_bytes ) );
+         if ( check_interactions_arena == NULL ) {
+            ostringstream errmsg;
+            errmsg << "Manager::setup_checkpoint_interactions():" << __LINE__
+                   << " ERROR: Failed to allocate enough memory for a"
+                   << " check_interactions_arena of " << total_bytes
+                   << " bytes." << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
+         check_interactions_arena_size = total_bytes;
+         AllocationTracker::record_alloc( AllocationTracker::SUBSYS_CHECKPOINT_DATA,
+                                          (long long)check_interactions_arena_size );
+      }
+      size_t arena_offset = 0;
+
+      unsigned int i = 0;
+      for ( int n = 0; n < inter_count; ++n ) {
+         if ( queue_counts[n] == 0 ) {
+            continue;
+         }
 
-      // interactions_queue.dump_head_pointers("interactions_queue.dump");
+         ItemQueue &receive_queue = interactions[n].get_receive_queue();
 
-      for ( unsigned int i = 0; i < interactions_queue.size(); ++i ) {
+         // When auto_unlock_mutex goes out of scope it automatically
+         // unlocks the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &receive_queue.mutex );
 
-         InteractionItem *item = static_cast< InteractionItem * >( interactions_queue.front() );
+         for ( int k = 0; k < queue_counts[n]; ++k ) {
 
-         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-            send_hs( stdout, "Manager::setup_checkpoint_interactions():%d \
+            InteractionItem *item = static_cast< InteractionItem * >( receive_queue.front() );
+
+            if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+               send_hs( stdout, "Manager::setup_checkpoint_interactions():%d \
 Checkpointing into check_interactions[%d] from interaction index %d.%c",
-                     __LINE__, i, item->index, THLA_NEWLINE );
-         }
-         check_interactions[i].index            = item->index;
-         check_interactions[i].interaction_type = item->interaction_type;
-         item->checkpoint_queue();
-         check_interactions[i].parm_items_count       = item->parm_items_count;
-         check_interactions[i].parm_items             = item->parm_items;
-         check_interactions[i].user_supplied_tag_size = item->user_supplied_tag_size;
-         if ( item->user_supplied_tag_size == 0 ) {
-            check_interactions[i].user_supplied_tag = NULL;
-         } else {
-            check_interactions[i].user_supplied_tag =
-               static_cast< unsigned char * >( trick_MM->declare_var( "unsigned char", item->user_supplied_tag_size ) );
+                        __LINE__, i, item->index, THLA_NEWLINE );
+            }
+            check_interactions[i].index            = item->index;
+            check_interactions[i].interaction_type = item->interaction_type;
+            item->checkpoint_queue( check_interactions_arena, arena_offset );
+            check_interactions[i].parm_items_count = item->parm_items_count;
+            check_interactions[i].parm_items       = item->parm_items;
+
+            // The checkpoint copy owns the parm_items array from here on, so
+            // the queued item must not free it (or the arena staged payload
+            // data it points into) when the item is eventually consumed.
+            item->parm_items       = NULL;
+            item->parm_items_count = 0;
+
+            check_interactions[i].user_supplied_tag_size = item->user_supplied_tag_size;
+            if ( item->user_supplied_tag_size == 0 ) {
+               check_interactions[i].user_supplied_tag = NULL;
+            } else {
+               check_interactions[i].user_supplied_tag = &check_interactions_arena[arena_offset];
+               memcpy( check_interactions[i].user_supplied_tag, item->user_supplied_tag, item->user_supplied_tag_size );
+               arena_offset += item->user_supplied_tag_size;
+            }
+            check_interactions[i].order_is_TSO = item->order_is_TSO;
+            check_interactions[i].time         = item->time;
+            ++i;
 
-            memcpy( check_interactions[i].user_supplied_tag, item->user_supplied_tag, item->user_supplied_tag_size );
+            // Now that we extracted the data from the parameter-item, point to the
+            // next element in the queue, without popping!
+            receive_queue.next( item );
          }
-         check_interactions[i].order_is_TSO = item->order_is_TSO;
-         check_interactions[i].time         = item->time;
 
-         // Now that we extracted the data from the parameter-item, point to the
-         // next element in the queue, without popping!
-         interactions_queue.next( item );
-      }
+         receive_queue.rewind();
 
-      interactions_queue.rewind();
+         // auto_unlock_mutex unlocks the mutex lock here
+      }
    }
-   // auto_unlock_mutex unlocks the mutex lock here
 }
 
 void Manager::clear_interactions()
 {
    if ( check_interactions_count > 0 ) {
       for ( unsigned int i = 0; i < check_interactions_count; ++i ) {
-         check_interactions[i].clear_parm_items();
+         // The parameter payloads and the user supplied tags are staged in
+         // the retained checkpoint arena, so only the parm_items arrays are
+         // freed here.
+         check_interactions[i].clear_parm_items( false );
+         check_interactions[i].user_supplied_tag      = NULL;
+         check_interactions[i].user_supplied_tag_size = 0;
       }
       if ( trick_MM->delete_var( static_cast< void * >( check_interactions ) ) ) {
          send_hs( stderr, "Manager::clear_interactions():%d ERROR deleting Trick Memory for 'check_interactions'%c",
                   __LINE__, THLA_NEWLINE );
       }
+      AllocationTracker::record_free( AllocationTracker::SUBSYS_CHECKPOINT_DATA,
+                                      (long long)check_interactions_count * (long long)sizeof( InteractionItem ) );
       check_interactions       = NULL;
       check_interactions_count = 0;
    }
@@ -3071,7 +5180,19 @@ restoring check_interactions[%d] into interaction index %d, parm_count=%d%c",
          item->order_is_TSO = check_interactions[i].order_is_TSO;
          item->time         = check_interactions[i].time;
 
-         interactions_queue.push( item );
+         // Route the restored item back into the receive queue owned by
+         // its interaction class.
+         if ( ( item->index >= 0 ) && ( item->index < inter_count ) ) {
+            interactions[item->index].get_receive_queue().push( item );
+         } else {
+            ostringstream errmsg;
+            errmsg << "Manager::restore_interactions():" << __LINE__
+                   << " ERROR: check_interactions[" << i << "] has an invalid"
+                   << " interaction index " << item->index << ", expected a"
+                   << " value in the range 0 to " << ( inter_count - 1 )
+                   << "!" << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
       }
    }
 }
@@ -3081,11 +5202,100 @@ restoring check_interactions[%d] into interaction index %d, parm_count=%d%c",
  */
 void Manager::pull_ownership_upon_rejoin()
 {
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::pull_ownership_upon_rejoin():%d%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   // Completion set of the objects with an outstanding ownership
+   // reacquisition request.
+   vector< unsigned int > pending;
+
+   unsigned int requested_attr_count = 0;
+
+   SleepTimeout print_timer( federate->wait_status_time );
+   SleepTimeout sleep_timer;
+
+   // Instrument the total reacquisition latency, in microseconds.
+   int64_t const start_time = sleep_timer.time();
+
+   // Issue all the ownership reacquisition requests up front so the RTI can
+   // process them concurrently, instead of requesting and then blocking for
+   // one object at a time.
    for ( unsigned int n = 0; n < obj_count; ++n ) {
       if ( objects[n].is_create_HLA_instance() ) {
-         objects[n].pull_ownership_upon_rejoin();
+         unsigned int const attr_cnt = objects[n].pull_ownership_upon_rejoin_request();
+         if ( attr_cnt > 0 ) {
+            requested_attr_count += attr_cnt;
+            pending.push_back( n );
+         }
+      }
+   }
+
+   // Block once for all the objects. The grants arrive through the FedAmb
+   // ownership acquisition callbacks, which mark the acquired attributes as
+   // locally owned again. Each object is removed from the completion set as
+   // its grants show up, so every sleep quantum is shared by all the objects
+   // still outstanding.
+   if ( !pending.empty() ) {
+      int64_t wallclock_time;
+
+      while ( !pending.empty() ) {
+
+         // Check for shutdown.
+         federate->check_for_shutdown_with_termination();
+
+         // Sweep the completion set for granted requests.
+         size_t k = 0;
+         while ( k < pending.size() ) {
+            if ( objects[pending[k]].is_pull_ownership_upon_rejoin_complete() ) {
+               pending.erase( pending.begin() + k );
+            } else {
+               ++k;
+            }
+         }
+         if ( pending.empty() ) {
+            break;
+         }
+
+         sleep_timer.sleep();
+
+         // To be more efficient, we get the time once and share it.
+         wallclock_time = sleep_timer.time();
+
+         if ( sleep_timer.timeout( wallclock_time ) ) {
+            sleep_timer.reset();
+            if ( !federate->is_execution_member() ) {
+               ostringstream errmsg;
+               errmsg << "Manager::pull_ownership_upon_rejoin():" << __LINE__
+                      << " ERROR: Unexpectedly the Federate is no longer an execution member."
+                      << " This means we are either not connected to the"
+                      << " RTI or we are no longer joined to the federation"
+                      << " execution because someone forced our resignation at"
+                      << " the Central RTI Component (CRC) level!"
+                      << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
+            }
+         }
+
+         if ( print_timer.timeout( wallclock_time ) ) {
+            print_timer.reset();
+            send_hs( stdout, "Manager::pull_ownership_upon_rejoin():%d Waiting \
+on attribute ownership reacquisition for %d objects, next is '%s'.%c",
+                     __LINE__, (int)pending.size(),
+                     objects[pending[0]].get_name(), THLA_NEWLINE );
+         }
       }
    }
+
+   if ( ( requested_attr_count > 0 )
+        && DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::pull_ownership_upon_rejoin():%d Reacquired \
+ownership of %u attributes in %.3f seconds.%c",
+               __LINE__, requested_attr_count,
+               (double)( sleep_timer.time() - start_time ) / 1000000.0,
+               THLA_NEWLINE );
+   }
 }
 
 /*!
@@ -3095,6 +5305,9 @@ void Manager::pull_ownership_upon_rejoin()
  */
 void Manager::wait_for_discovery_of_objects()
 {
+   // Record this startup stage in the startup phase timing report.
+   StartupProfiler::Scope startup_stage( "Manager::wait_for_discovery_of_objects" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d%c",
                __LINE__, THLA_NEWLINE );
@@ -3103,6 +5316,9 @@ void Manager::wait_for_discovery_of_objects()
    // Do we have Simulation object(s) to interrogate?
    if ( obj_count > 0 ) {
 
+      // Resolve any discovery callbacks queued on the FedAmb callback thread.
+      process_pending_discoveries();
+
       // See if any object discoveries have occurred.
       int  required_count                   = 0;
       int  discovery_count                  = 0;
@@ -3140,15 +5356,37 @@ void Manager::wait_for_discovery_of_objects()
          SleepTimeout print_timer( federate->wait_status_time );
          SleepTimeout sleep_timer;
 
+         // Instrument the total discovery phase latency, in microseconds.
+         int64_t const start_time = sleep_timer.time();
+
          // Block until some or all objects arrive.
          do {
 
             // Check for shutdown.
             federate->check_for_shutdown_with_termination();
 
-            // Sleep for a little while to allow the RTI to trigger the object
-            // discovery callbacks.
-            sleep_timer.sleep();
+            // Block until the FedAmb callback thread signals that another
+            // discovery record was queued, with a timeout so the shutdown
+            // and execution member checks below still run periodically.
+            // Waiting on the condition instead of sleep polling means a
+            // discovery is processed as soon as it arrives instead of on
+            // the next poll quantum.
+            {
+               struct timespec cond_timeout;
+               clock_gettime( CLOCK_REALTIME, &cond_timeout );
+               cond_timeout.tv_nsec += THLA_DEFAULT_SLEEP_WAIT_IN_MICROS * 1000L;
+               if ( cond_timeout.tv_nsec >= 1000000000L ) {
+                  cond_timeout.tv_nsec -= 1000000000L;
+                  cond_timeout.tv_sec += 1;
+               }
+               obj_discovery_mutex.lock();
+               if ( pending_discoveries.empty() ) {
+                  pthread_cond_timedwait( &obj_discovery_cond,
+                                          &obj_discovery_mutex.mutex,
+                                          &cond_timeout );
+               }
+               obj_discovery_mutex.unlock();
+            }
 
             // To be more efficient, we get the time once and share it.
             wallclock_time = sleep_timer.time();
@@ -3170,10 +5408,33 @@ void Manager::wait_for_discovery_of_objects()
 
             if ( print_timer.timeout( wallclock_time ) ) {
                print_timer.reset();
-               send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d Waiting...%c",
-                        __LINE__, THLA_NEWLINE );
+
+               // Summarize which required objects are still missing so that
+               // a hung multi-federate startup is diagnosable from the logs.
+               ostringstream summary;
+               int           missing_count = 0;
+               for ( unsigned int n = 0; n < obj_count; ++n ) {
+                  if ( objects[n].is_required() && !objects[n].is_instance_handle_valid() ) {
+                     ++missing_count;
+                     if ( missing_count <= 10 ) {
+                        summary << ( ( missing_count > 1 ) ? ", '" : "'" )
+                                << objects[n].get_name() << "'";
+                     }
+                  }
+               }
+               if ( missing_count > 10 ) {
+                  summary << ", ...";
+               }
+               send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d Waiting \
+on the discovery of %d required objects: %s%c",
+                        __LINE__, missing_count, summary.str().c_str(),
+                        THLA_NEWLINE );
             }
 
+            // Resolve any discovery callbacks that were queued while we
+            // were sleeping.
+            process_pending_discoveries();
+
             // Check if any objects were discovered while we were sleeping.
             discovery_count                  = 0;
             create_HLA_instance_object_found = false;
@@ -3191,6 +5452,34 @@ void Manager::wait_for_discovery_of_objects()
                    ||                                    // the one for the rejoining federate, or
                    ( create_HLA_instance_object_found && // missing some other object(s) but
                      ( discovery_count < required_count ) ) ); // found the rejoining federate
+
+         // Record the total time this discovery phase spent waiting.
+         int64_t const elapsed_time = sleep_timer.time() - start_time;
+         obj_discovery_wait_stats.sample( (double)elapsed_time * 0.001 );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d Waited \
+%.3f seconds for the object discoveries.%c",
+                     __LINE__, (double)elapsed_time / 1000000.0, THLA_NEWLINE );
+         }
+
+         // Report when each object instance was discovered, relative to the
+         // start of this wait, to make slow federates easy to identify.
+         if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            for ( unsigned int n = 0; n < obj_count; ++n ) {
+               if ( objects[n].get_discovery_wallclock_time() >= 0 ) {
+                  send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d Object '%s' \
+discovered at %+.3f seconds.%c",
+                           __LINE__, objects[n].get_name(),
+                           (double)( objects[n].get_discovery_wallclock_time() - start_time ) / 1000000.0,
+                           THLA_NEWLINE );
+               }
+            }
+            send_hs( stdout, "Manager::wait_for_discovery_of_object_instance():%d Discovery wait \
+stats: %s%c",
+                     __LINE__, obj_discovery_wait_stats.to_string().c_str(),
+                     THLA_NEWLINE );
+         }
       }
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
@@ -3208,6 +5497,9 @@ void Manager::wait_for_discovery_of_objects()
  */
 bool Manager::is_this_a_rejoining_federate()
 {
+   // Resolve any discovery callbacks queued on the FedAmb callback thread.
+   process_pending_discoveries();
+
    for ( unsigned int n = 0; n < obj_count; ++n ) {
       // Was the required 'create_HLA_instance' object found?
       if ( objects[n].is_required()
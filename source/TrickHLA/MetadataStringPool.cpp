@@ -0,0 +1,138 @@
+/*!
+@file TrickHLA/MetadataStringPool.cpp
+@ingroup TrickHLA
+@brief Interned string pool the attribute and parameter metadata names are
+stored in.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{MetadataStringPool.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+#include <cstring>
+#include <set>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+
+// TrickHLA include files.
+#include "TrickHLA/MetadataStringPool.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+
+using namespace TrickHLA;
+
+// Declare the static class variables.
+size_t const MetadataStringPool::SLAB_SIZE = 16384;
+
+MutexLock      MetadataStringPool::pool_mutex;
+unsigned char *MetadataStringPool::slab           = NULL;
+size_t         MetadataStringPool::slab_offset    = 0;
+size_t         MetadataStringPool::slab_size      = 0;
+size_t         MetadataStringPool::interned_count = 0;
+size_t         MetadataStringPool::interned_bytes = 0;
+
+/*! @brief Orders the intern table entries by string contents so that equal
+ * strings map to the same entry. */
+struct InternTableLess {
+   bool operator()( char const *lhs, char const *rhs ) const
+   {
+      return ( strcmp( lhs, rhs ) < 0 );
+   }
+};
+
+/*!
+ * @details Assumptions and Limitations:
+ * - The intern table only stores pointers into the arena slabs, so the
+ *   deduplicated strings are stored exactly once.
+ * - The arena slabs are allocated through the Trick Memory Manager and are
+ *   never freed, so the interned strings live for the duration of the
+ *   federation execution.
+ */
+char *MetadataStringPool::intern(
+   char const *str )
+{
+   if ( str == NULL ) {
+      return NULL;
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   // The intern table lives in the translation unit so the container type
+   // is not exposed to Trick.
+   static std::set< char *, InternTableLess > intern_table;
+
+   std::set< char *, InternTableLess >::const_iterator entry =
+      intern_table.find( const_cast< char * >( str ) );
+   if ( entry != intern_table.end() ) {
+      return *entry;
+   }
+
+   // Carve the string storage from the current slab, allocating a new slab
+   // when the current one does not have enough room left.
+   size_t const length = strlen( str ) + 1;
+   if ( ( slab == NULL ) || ( ( slab_offset + length ) > slab_size ) ) {
+      // Strings larger than a slab get a dedicated slab.
+      size_t const new_slab_size = ( length > SLAB_SIZE ) ? length : SLAB_SIZE;
+
+      unsigned char *new_slab = static_cast< unsigned char * >(
+         TMM_declare_var_1d( "unsigned char", new_slab_size ) );
+      if ( new_slab == NULL ) {
+         return NULL;
+      }
+
+      slab        = new_slab;
+      slab_size   = new_slab_size;
+      slab_offset = 0;
+   }
+
+   char *interned = reinterpret_cast< char * >( slab + slab_offset );
+   memcpy( interned, str, length );
+   slab_offset += length;
+
+   intern_table.insert( interned );
+   ++interned_count;
+   interned_bytes += length;
+
+   return interned;
+}
+
+size_t MetadataStringPool::get_interned_count()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   return interned_count;
+}
+
+size_t MetadataStringPool::get_interned_bytes()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   return interned_bytes;
+}
@@ -0,0 +1,105 @@
+/*!
+@file TrickHLA/Metrics.cpp
+@ingroup TrickHLA
+@brief Live performance counters for the TrickHLA data path, streamable
+through the Trick variable server.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Metrics.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// Trick include files.
+#include "trick/clock_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Metrics.hh"
+
+using namespace TrickHLA;
+
+// Define the static class variables.
+Metrics *Metrics::active = NULL;
+
+/*!
+ * @job_class{initialization}
+ */
+Metrics::Metrics()
+   : attribute_updates_sent( 0 ),
+     attribute_bytes_sent( 0 ),
+     attribute_reflections_received( 0 ),
+     attribute_bytes_received( 0 ),
+     interactions_sent( 0 ),
+     interactions_received( 0 ),
+     time_advance_grants( 0 ),
+     last_grant_wait_time_ms( 0.0 ),
+     total_grant_wait_time_ms( 0.0 )
+{
+   // Register this instance as the metrics block the static counting
+   // functions update.
+   Metrics::active = this;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+Metrics::~Metrics()
+{
+   if ( Metrics::active == this ) {
+      Metrics::active = NULL;
+   }
+}
+
+void Metrics::reset()
+{
+   this->attribute_updates_sent         = 0;
+   this->attribute_bytes_sent           = 0;
+   this->attribute_reflections_received = 0;
+   this->attribute_bytes_received       = 0;
+   this->interactions_sent              = 0;
+   this->interactions_received          = 0;
+   this->time_advance_grants            = 0;
+   this->last_grant_wait_time_ms        = 0.0;
+   this->total_grant_wait_time_ms       = 0.0;
+}
+
+/*!
+ * @details The grant wait runs on the main thread only, so the double
+ * members are updated with plain stores while the grant counter stays a
+ * relaxed atomic for consistency with the other counters.
+ */
+void Metrics::record_grant_wait(
+   double const wait_time_ms )
+{
+   if ( active != NULL ) {
+      __atomic_fetch_add( &active->time_advance_grants, 1LL, __ATOMIC_RELAXED );
+      active->last_grant_wait_time_ms = wait_time_ms;
+      active->total_grant_wait_time_ms += wait_time_ms;
+   }
+}
+
+Metrics::GrantWaitScope::GrantWaitScope()
+   : start_time_us( clock_wall_time() ) // in microseconds
+{
+   return;
+}
+
+Metrics::GrantWaitScope::~GrantWaitScope()
+{
+   Metrics::record_grant_wait( (double)( clock_wall_time() - start_time_us ) * 0.001 );
+}
@@ -20,25 +20,91 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Adaptive spin and contention statistics.}
 @revs_end
 */
 
 // System include files.
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
 #include <pthread.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/MutexLock.hh"
 
+using namespace std;
 using namespace TrickHLA;
 
+// Define the static class variables.
+int const MutexLock::MAX_SPIN_COUNT;
+
+namespace
+{
+
+/*! @brief Processor hint that we are busy waiting in a spin loop. */
+inline void spin_pause()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+   __builtin_ia32_pause();
+#elif defined( __aarch64__ ) || defined( __arm__ )
+   asm volatile( "yield" );
+#endif
+}
+
+#if defined( THLA_MUTEX_LOCK_STATS )
+
+pthread_mutex_t registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*! @brief Registry of all the MutexLock instances. The vector is constructed
+ * on first use and intentionally leaked so that locks with static storage
+ * duration can deregister safely at program exit. */
+vector< MutexLock * > &lock_registry()
+{
+   static vector< MutexLock * > *registry = new vector< MutexLock * >();
+   return *registry;
+}
+
+/*! @brief Order locks by accumulated wait time, worst first. */
+bool wait_time_greater(
+   MutexLock const *lhs,
+   MutexLock const *rhs )
+{
+   return ( lhs->wait_time_us > rhs->wait_time_us );
+}
+
+#endif // THLA_MUTEX_LOCK_STATS
+
+} // namespace
+
 /*!
  * @details Default constructor for the TrickHLA MutexLock class with mutex
  * attribute PTHREAD_MUTEX_RECURSIVE.
  * @job_class{initialization}
  */
 MutexLock::MutexLock()
+#if defined( THLA_MUTEX_LOCK_STATS )
+   : lock_name(),
+     acquisition_count( 0 ),
+     contention_count( 0 ),
+     wait_time_us( 0 )
+#endif
 {
    initialize();
+
+#if defined( THLA_MUTEX_LOCK_STATS )
+   pthread_mutex_lock( &registry_mutex );
+   lock_registry().push_back( this );
+   pthread_mutex_unlock( &registry_mutex );
+#endif
 }
 
 /*!
@@ -48,6 +114,16 @@ MutexLock::MutexLock()
 MutexLock::~MutexLock()
 {
    destroy();
+
+#if defined( THLA_MUTEX_LOCK_STATS )
+   pthread_mutex_lock( &registry_mutex );
+   vector< MutexLock * >          &registry = lock_registry();
+   vector< MutexLock * >::iterator iter     = find( registry.begin(), registry.end(), this );
+   if ( iter != registry.end() ) {
+      registry.erase( iter );
+   }
+   pthread_mutex_unlock( &registry_mutex );
+#endif
 }
 
 /*!
@@ -63,12 +139,48 @@ int const MutexLock::initialize()
 }
 
 /*!
- * @brief Lock the mutex.
- * @return Integer value of 0 for success, otherwise non-zero for an error.
+ * @details The hot queue and coordination paths hold this lock for well under
+ * a microsecond, so a contended acquisition first spins briefly trying to
+ * grab the lock before paying for the blocking (futex) wait and the thread
+ * reschedule that comes with it. When THLA_MUTEX_LOCK_STATS is defined in
+ * TrickHLA/CompileConfig.hh the acquisition and contention counters and the
+ * contended wait time are also recorded, which is safe to do without atomics
+ * because they are only updated while holding the lock.
  */
 int const MutexLock::lock()
 {
-   return ( pthread_mutex_lock( &mutex ) );
+   if ( pthread_mutex_trylock( &mutex ) == 0 ) {
+#if defined( THLA_MUTEX_LOCK_STATS )
+      ++acquisition_count;
+#endif
+      return 0;
+   }
+
+#if defined( THLA_MUTEX_LOCK_STATS )
+   int64_t const wait_start = clock_wall_time(); // in microseconds
+#endif
+
+   for ( int i = 0; i < MAX_SPIN_COUNT; ++i ) {
+      spin_pause();
+      if ( pthread_mutex_trylock( &mutex ) == 0 ) {
+#if defined( THLA_MUTEX_LOCK_STATS )
+         ++acquisition_count;
+         ++contention_count;
+         wait_time_us += clock_wall_time() - wait_start;
+#endif
+         return 0;
+      }
+   }
+
+   int const error = pthread_mutex_lock( &mutex );
+#if defined( THLA_MUTEX_LOCK_STATS )
+   if ( error == 0 ) {
+      ++acquisition_count;
+      ++contention_count;
+      wait_time_us += clock_wall_time() - wait_start;
+   }
+#endif
+   return error;
 }
 
 /*!
@@ -91,3 +203,79 @@ int const MutexLock::destroy()
    }
    return ( pthread_mutex_destroy( &mutex ) );
 }
+
+/*!
+ * @details The label is only recorded when THLA_MUTEX_LOCK_STATS is defined
+ * in TrickHLA/CompileConfig.hh, otherwise this is a no-op so that call sites
+ * do not need to be conditionally compiled.
+ */
+void MutexLock::set_name(
+   std::string const &label )
+{
+#if defined( THLA_MUTEX_LOCK_STATS )
+   this->lock_name = label;
+#else
+   (void)label;
+#endif
+}
+
+/*!
+ * @details Locks that have never been acquired are counted but not listed.
+ * Unnamed locks are listed with their address so they can be identified
+ * with a debugger if they turn out to be a hotspot.
+ */
+std::string const MutexLock::statistics_to_string()
+{
+   ostringstream msg;
+#if defined( THLA_MUTEX_LOCK_STATS )
+   // Snapshot the registry so the locks can be examined and sorted without
+   // holding the registry mutex.
+   vector< MutexLock * > locks;
+   pthread_mutex_lock( &registry_mutex );
+   locks = lock_registry();
+   pthread_mutex_unlock( &registry_mutex );
+
+   sort( locks.begin(), locks.end(), wait_time_greater );
+
+   msg << "MutexLock statistics for " << locks.size() << " locks:";
+   for ( unsigned int i = 0; i < locks.size(); ++i ) {
+      MutexLock const *lck = locks[i];
+      if ( lck->acquisition_count == 0 ) {
+         continue;
+      }
+      double const contention_pct = 100.0 * (double)lck->contention_count
+                                    / (double)lck->acquisition_count;
+      msg << THLA_NEWLINE << "   ";
+      if ( lck->lock_name.empty() ) {
+         msg << "<unnamed " << static_cast< void const * >( lck ) << ">";
+      } else {
+         msg << lck->lock_name;
+      }
+      msg << ": acquisitions:" << lck->acquisition_count
+          << " contended:" << lck->contention_count
+          << " (" << setprecision( 3 ) << contention_pct << " %)"
+          << " wait-time:" << fixed << setprecision( 3 )
+          << ( (double)lck->wait_time_us * 0.001 ) << " ms";
+      if ( lck->contention_count > 0 ) {
+         msg << " avg-wait:" << fixed << setprecision( 3 )
+             << ( (double)lck->wait_time_us / (double)lck->contention_count )
+             << " us";
+      }
+      msg.unsetf( ios_base::fixed );
+   }
+#else
+   msg << "MutexLock statistics are not available, set THLA_MUTEX_LOCK_STATS"
+       << " in TrickHLA/CompileConfig.hh to enable them.";
+#endif
+   return msg.str();
+}
+
+/*!
+ * @brief Print the mutex statistics summary to the console.
+ */
+void MutexLock::print_statistics()
+{
+   string const stats = statistics_to_string();
+   send_hs( stdout, "MutexLock::print_statistics():%d%c%s%c",
+            __LINE__, THLA_NEWLINE, stats.c_str(), THLA_NEWLINE );
+}
@@ -31,8 +31,13 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{ObjectDeleted.cpp}
 @trick_link_dependency{OwnershipHandler.cpp}
 @trick_link_dependency{Packing.cpp}
+@trick_link_dependency{SendPacer.cpp}
+@trick_link_dependency{SharedMemoryRing.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{Tracepoint.cpp}
+@trick_link_dependency{TripleBuffer.cpp}
 @trick_link_dependency{Types.cpp}
+@trick_link_dependency{UpdateCapture.cpp}
 
 @revs_title
 @revs_begin
@@ -44,17 +49,25 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <pthread.h>
 #include <sstream>
 #include <string>
+#include <time.h>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Trick include files.
 #include "trick/MemoryManager.hh"
+#include "trick/clock_proto.h"
 #include "trick/exec_proto.h"
 #include "trick/message_proto.h"
 #include "trick/release.h"
@@ -71,15 +84,24 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/LagCompensation.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/Metrics.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/ObjectDeleted.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/OwnershipHandler.hh"
 #include "TrickHLA/Packing.hh"
+#include "TrickHLA/RTISubmitter.hh"
+#include "TrickHLA/SendPacer.hh"
+#include "TrickHLA/SharedMemoryRing.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Tracepoint.hh"
+#include "TrickHLA/TripleBuffer.hh"
 #include "TrickHLA/Types.hh"
+#include "TrickHLA/UpdateCapture.hh"
+#include "TrickHLA/Utilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -108,6 +130,69 @@ using namespace TrickHLA;
 //-----------------------------------------------------------------
 #define THLA_OBJ_DEBUG_VALID_OBJECT_RECEIVE 0
 
+// Class-level condition variable shared by all objects so that the name
+// reservation waits wake directly on the RTI callbacks instead of polling.
+pthread_mutex_t Object::name_reservation_cond_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t  Object::name_reservation_cond       = PTHREAD_COND_INITIALIZER;
+
+namespace
+{
+
+// Wire format of the latency survey stamp carried in the user-supplied tag
+// of an attribute update: a two character marker followed by the CTE time
+// in seconds as a big-endian IEEE-754 double.
+size_t const LATENCY_SURVEY_STAMP_SIZE = 10;
+
+/*! @brief Encode a latency survey stamp for the user-supplied tag.
+ *  @param stamp    Destination buffer of LATENCY_SURVEY_STAMP_SIZE bytes.
+ *  @param cte_time CTE time in seconds to stamp. */
+void encode_latency_survey_stamp(
+   unsigned char *stamp,
+   double const   cte_time )
+{
+   stamp[0] = 'L';
+   stamp[1] = 'S';
+
+   unsigned char const *src = reinterpret_cast< unsigned char const * >( &cte_time );
+   if ( Utilities::get_endianness() == TRICK_BIG_ENDIAN ) {
+      memcpy( &stamp[2], src, 8 );
+   } else {
+      for ( int i = 0; i < 8; ++i ) {
+         stamp[2 + i] = src[7 - i];
+      }
+   }
+}
+
+/*! @brief Decode a latency survey stamp from the user-supplied tag.
+ *  @return True if the tag carried a valid latency survey stamp.
+ *  @param stamp    Tag data.
+ *  @param size     Tag size in bytes.
+ *  @param cte_time Decoded CTE time in seconds. */
+bool decode_latency_survey_stamp(
+   unsigned char const *stamp,
+   size_t const         size,
+   double              &cte_time )
+{
+   if ( ( stamp == NULL )
+        || ( size != LATENCY_SURVEY_STAMP_SIZE )
+        || ( stamp[0] != 'L' )
+        || ( stamp[1] != 'S' ) ) {
+      return false;
+   }
+
+   unsigned char *dest = reinterpret_cast< unsigned char * >( &cte_time );
+   if ( Utilities::get_endianness() == TRICK_BIG_ENDIAN ) {
+      memcpy( dest, &stamp[2], 8 );
+   } else {
+      for ( int i = 0; i < 8; ++i ) {
+         dest[i] = stamp[2 + ( 7 - i )];
+      }
+   }
+   return true;
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
@@ -119,6 +204,13 @@ Object::Object()
      create_HLA_instance( false ),
      required( true ),
      blocking_cyclic_read( false ),
+     keep_latest_update_only( false ),
+     latency_survey( false ),
+     stale_data_threshold( 0.0 ),
+     send_phase_offset_time( 0.0 ),
+     parallel_codec_slices( 0 ),
+     receive_priority( 0 ),
+     update_group( -1 ),
      thread_ids( NULL ),
      attr_count( 0 ),
      attributes( NULL ),
@@ -140,23 +232,67 @@ Object::Object()
      name_registered( false ),
      changed( false ),
      attr_update_requested( false ),
+     attr_update_request_mask(),
      removed_instance( false ),
      first_blocking_cyclic_read( true ),
      any_attribute_FOM_specified_order( false ),
      any_attribute_timestamp_order( false ),
+     any_attribute_receive_order( false ),
      pull_requested( false ),
      divest_requested( false ),
+     ownership_work_registered( false ),
+     subscription_active( true ),
      attribute_FOM_names(),
      manager( NULL ),
      rti_ambassador( NULL ),
      thla_reflected_attributes_queue(),
-     thla_attribute_map(),
+     front_data_borrowed( false ),
+     latest_update_buffer(),
+     data_arrival_waiting( false ),
+     data_arrival_callback( NULL ),
+     data_arrival_user_arg( NULL ),
+     last_data_arrival_time_us( 0LL ),
+     stale_data_callback( NULL ),
+     stale_data_user_arg( NULL ),
+     shm_channel_name(),
+     shm_send_ring( NULL ),
+     shm_receive_ring( NULL ),
+     shm_transport_failed( false ),
+     shm_frame_buffer(),
+     thla_attribute_index(),
+     send_phase_offset_base_time( 0LL ),
+     send_wheel_ratio(),
+     send_wheel_count(),
+     send_wheel_due(),
+     send_wheel_attr_index(),
+     send_wheel_bucket_start(),
+     send_wheel_everyframe_index(),
+     attr_send_bucket(),
+     send_wheel_built( false ),
+     ownership_counts_valid( false ),
+     locally_owned_count( 0 ),
+     locally_owned_published_count( 0 ),
+     remotely_owned_subscribed_count( 0 ),
+     locally_owned_published_index(),
+     remotely_owned_subscribed_index(),
+     rejoin_pull_request_index(),
+     remotely_owned_subscribed_attr_handles(),
+     discovery_wallclock_time( -1 ),
      send_count( 0LL ),
      receive_count( 0LL ),
-     elapsed_time_stats()
+     elapsed_time_stats(),
+     send_wheel_stats(),
+     send_time_stats(),
+     latency_stats(),
+     update_interval_stats(),
+     consume_latency_stats()
 {
-   // Make sure we allocate the map.
-   this->attribute_values_map = new AttributeHandleValueMap();
+   // Make sure we allocate the maps.
+   this->attribute_values_map    = new AttributeHandleValueMap();
+   this->RO_attribute_values_map = new AttributeHandleValueMap();
+
+   pthread_mutex_init( &data_arrival_cond_mutex, NULL );
+   pthread_cond_init( &data_arrival_cond, NULL );
 }
 
 /*!
@@ -174,6 +310,14 @@ Object::~Object()
       // Remove this object from the federation execution.
       remove();
 
+      // Fast teardown: the process is exiting and the operating system
+      // reclaims the memory in bulk, so skip the per-variable Trick
+      // memory frees and the mutex destroys.
+      if ( Federate::is_fast_teardown_active() ) {
+         this->removed_instance = true;
+         return;
+      }
+
       if ( name != NULL ) {
          if ( trick_MM->delete_var( static_cast< void * >( name ) ) ) {
             send_hs( stderr, "Object::~Object():%d ERROR deleting Trick Memory for 'name'%c",
@@ -200,7 +344,29 @@ Object::~Object()
          attribute_values_map = NULL;
       }
 
-      thla_attribute_map.clear();
+      if ( RO_attribute_values_map != NULL ) {
+         if ( !RO_attribute_values_map->empty() ) {
+            RO_attribute_values_map->clear();
+         }
+         delete RO_attribute_values_map;
+         RO_attribute_values_map = NULL;
+      }
+
+      thla_attribute_index.clear();
+
+      // Tear down the shared-memory transport rings. The send ring also
+      // removes the underlying shared-memory segment.
+      if ( shm_send_ring != NULL ) {
+         delete shm_send_ring;
+         shm_send_ring = NULL;
+      }
+      if ( shm_receive_ring != NULL ) {
+         delete shm_receive_ring;
+         shm_receive_ring = NULL;
+      }
+
+      pthread_cond_destroy( &data_arrival_cond );
+      pthread_mutex_destroy( &data_arrival_cond_mutex );
 
       // Make sure we destroy the mutexs.
       push_mutex.destroy();
@@ -265,6 +431,12 @@ void Object::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   // Label the per-object locks for the mutex contention statistics dump.
+   push_mutex.set_name( string( name ) + ".push_mutex" );
+   ownership_mutex.set_name( string( name ) + ".ownership_mutex" );
+   send_mutex.set_name( string( name ) + ".send_mutex" );
+   receive_mutex.set_name( string( name ) + ".receive_mutex" );
+
    // Do a bounds check on the 'lag_comp_type' value.
    if ( ( lag_comp_type < LAG_COMPENSATION_FIRST_VALUE ) || ( lag_comp_type > LAG_COMPENSATION_LAST_VALUE ) ) {
       ostringstream errmsg;
@@ -419,8 +591,19 @@ void Object::initialize(
       }
    }
 
+   // Determine if any attribute is preferred Receive Order, which enables
+   // the receive-order fast path for mixed preferred-order updates.
+   this->any_attribute_receive_order = false;
+   for ( unsigned int i = 0; !any_attribute_receive_order && i < attr_count; ++i ) {
+      if ( attributes[i].get_preferred_order() == TRANSPORT_RECEIVE_ORDER ) {
+         this->any_attribute_receive_order = true;
+      }
+   }
+
    // Build the string array of valid attribute FOM names and also check for
-   // duplicate attribute FOM names.
+   // duplicate attribute FOM names. A hash set of the names seen so far
+   // folds the duplicate check into the same single pass.
+   unordered_map< string, unsigned int > attribute_names;
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       // Validate the FOM-name to make sure we don't have a problem with the
       // list of names as well as get a difficult to debug runtime error for
@@ -438,21 +621,18 @@ void Object::initialize(
 
       // Since Object updates are sent as a AttributeHandleValueMap there can be
       // no duplicate Attributes because the map only allows unique AttributeHandles.
-      for ( unsigned int k = i + 1; k < attr_count; ++k ) {
-         if ( ( attributes[k].get_FOM_name() != NULL ) && ( *( attributes[k].get_FOM_name() ) != '\0' ) ) {
-
-            if ( fom_name_str == string( attributes[k].get_FOM_name() ) ) {
-               ostringstream errmsg;
-               errmsg << "Object::initialize():" << __LINE__
-                      << " ERROR: Object '" << name << "' has Attributes at"
-                      << " array indexes " << i << " and " << k
-                      << " that have the same FOM Name '" << fom_name_str
-                      << "'. Please check your input or modified-data files to"
-                      << " make sure the object attributes do not use duplicate"
-                      << " FOM names." << THLA_ENDL;
-               DebugHandler::terminate_with_message( errmsg.str() );
-            }
-         }
+      pair< unordered_map< string, unsigned int >::iterator, bool > insert_result =
+         attribute_names.insert( pair< string, unsigned int >( fom_name_str, i ) );
+      if ( !insert_result.second ) {
+         ostringstream errmsg;
+         errmsg << "Object::initialize():" << __LINE__
+                << " ERROR: Object '" << name << "' has Attributes at"
+                << " array indexes " << insert_result.first->second << " and " << i
+                << " that have the same FOM Name '" << fom_name_str
+                << "'. Please check your input or modified-data files to"
+                << " make sure the object attributes do not use duplicate"
+                << " FOM names." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
       }
 
       // Add the unique attribute FOM name.
@@ -496,6 +676,13 @@ void Object::initialize(
       deleted->initialize_callback( this );
    }
 
+   // Ownership transfer requests restored from a checkpoint or scheduled
+   // before initialization need to get on the manager's pending ownership
+   // work list now that the manager is known.
+   if ( is_ownership_work_pending() ) {
+      notify_ownership_work_pending();
+   }
+
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
@@ -504,6 +691,14 @@ Federate *Object::get_federate()
    return ( ( this->manager != NULL ) ? this->manager->get_federate() : NULL );
 }
 
+double Object::get_cte_time()
+{
+   if ( ( this->manager != NULL ) && ( this->manager->get_execution_control() != NULL ) ) {
+      return this->manager->get_execution_control()->get_cte_time();
+   }
+   return -std::numeric_limits< double >::max();
+}
+
 RTI1516_NAMESPACE::RTIambassador *Object::get_RTI_ambassador()
 {
    if ( rti_ambassador == NULL ) {
@@ -529,6 +724,14 @@ RTI1516_NAMESPACE::RTIambassador *Object::get_RTI_ambassador()
  */
 void Object::remove()
 {
+   // Fast teardown: the resign's CANCEL_THEN_DELETE_THEN_DIVEST semantics
+   // already deleted every instance this federate held the delete
+   // privilege for, so skip the per-object deleteObjectInstance call.
+   if ( Federate::is_fast_teardown_active() ) {
+      this->removed_instance = true;
+      return;
+   }
+
    // Only delete it if we locally own it.
    if ( !removed_instance && is_create_HLA_instance() && is_shutdown_called() ) {
 
@@ -727,6 +930,10 @@ void Object::mark_all_attributes_as_nonlocal()
          }
       }
    }
+   // The cached ownership counts are stale now that the attributes are no
+   // longer locally owned.
+   invalidate_ownership_counts();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
       msg << THLA_ENDL;
       send_hs( stdout, msg.str().c_str() );
@@ -737,6 +944,38 @@ void Object::mark_all_attributes_as_nonlocal()
  * @job_class{initialization}
  */
 void Object::publish_object_attributes()
+{
+   AttributeHandleSet attrs;
+
+   // Publish only the attributes we have the publish flag set for.
+   add_published_attribute_handles( attrs );
+
+   if ( !attrs.empty() ) {
+      publish_object_class_attributes( attrs );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Object::add_published_attribute_handles(
+   AttributeHandleSet &attrs ) const
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_publish() ) {
+         attrs.insert( attributes[i].get_attribute_handle() );
+      }
+   }
+}
+
+/*!
+ * @details The publish call is made at the object class level, so the caller
+ * can group the object instances of a class together and publish the union
+ * of their attribute handles with a single call to the RTI.
+ * @job_class{initialization}
+ */
+void Object::publish_object_class_attributes(
+   AttributeHandleSet const &attrs )
 {
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
@@ -747,70 +986,61 @@ void Object::publish_object_attributes()
    // Publish our associated CLASS & attributes
    if ( rti_amb != NULL ) {
 
-      if ( ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) && any_attribute_published() ) {
-         send_hs( stdout, "Object::publish_object_attributes():%d For object '%s'.%c",
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+         send_hs( stdout, "Object::publish_object_class_attributes():%d For object '%s'.%c",
                   __LINE__, get_name(), THLA_NEWLINE );
       }
 
       try {
-         AttributeHandleSet attrs;
-
-         // Publish only the attributes we have the publish flag set for.
-         for ( unsigned int i = 0; i < attr_count; ++i ) {
-            if ( attributes[i].is_publish() ) {
-               attrs.insert( attributes[i].get_attribute_handle() );
-            }
-         }
-
          if ( !attrs.empty() ) {
             rti_amb->publishObjectClassAttributes( this->class_handle, attrs );
          }
       } catch ( ObjectClassNotDefined const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d ObjectClassNotDefined : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d ObjectClassNotDefined : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( AttributeNotDefined const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d ObjectClassNotDefined : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d ObjectClassNotDefined : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( FederateNotExecutionMember const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d FederateNotExecutionMember : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d FederateNotExecutionMember : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( SaveInProgress const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d SaveInProgress : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d SaveInProgress : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RestoreInProgress const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d RestoreInProgress : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d RestoreInProgress : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( NotConnected const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d NotConnected : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d NotConnected : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RTIinternalError const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d RTIinternalError : '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d RTIinternalError : '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RTI1516_EXCEPTION const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::publish_object_attributes():%d class attributes exception for '%s'%c",
+         send_hs( stderr, "Object::publish_object_class_attributes():%d class attributes exception for '%s'%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       }
       // Macro to restore the saved FPU Control Word register value.
       TRICKHLA_RESTORE_FPU_CONTROL_WORD;
       TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
    } else {
-      send_hs( stderr, "Object::publish_object_attributes():%d Unexpected NULL RTIambassador.%c",
+      send_hs( stderr, "Object::publish_object_class_attributes():%d Unexpected NULL RTIambassador.%c",
                __LINE__, THLA_NEWLINE );
    }
 }
@@ -892,6 +1122,40 @@ void Object::unpublish_all_object_attributes()
  * @job_class{initialization}
  */
 void Object::subscribe_to_object_attributes()
+{
+   // To actually subscribe we need to build an AttributeHandleSet
+   // that contains a list of attribute type ids (AttributeHandle).
+   AttributeHandleSet attrs;
+
+   // Subscribe only to the attributes we have the subscribe flag set for.
+   add_subscribed_attribute_handles( attrs );
+
+   if ( !attrs.empty() ) {
+      subscribe_to_object_class_attributes( attrs );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Object::add_subscribed_attribute_handles(
+   AttributeHandleSet &attrs ) const
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_subscribe() ) {
+         attrs.insert( attributes[i].get_attribute_handle() );
+      }
+   }
+}
+
+/*!
+ * @details The subscribe call is made at the object class level, so the
+ * caller can group the object instances of a class together and subscribe
+ * to the union of their attribute handles with a single call to the RTI.
+ * @job_class{initialization}
+ */
+void Object::subscribe_to_object_class_attributes(
+   AttributeHandleSet const &attrs )
 {
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
@@ -902,24 +1166,12 @@ void Object::subscribe_to_object_attributes()
    // Subscribe to CLASS & attributes
    if ( rti_amb != NULL ) {
 
-      if ( ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) && any_attribute_subscribed() ) {
-         send_hs( stdout, "Object::subscribe_to_object_attributes():%d For object '%s'.%c",
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+         send_hs( stdout, "Object::subscribe_to_object_class_attributes():%d For object '%s'.%c",
                   __LINE__, get_name(), THLA_NEWLINE );
       }
 
       try {
-         // To actually subscribe we need to build an AttributeHandleSet
-         // that contains a list of attribute type ids (AttributeHandle).
-
-         AttributeHandleSet attrs;
-
-         // Subscribe only to the attributes we have the subscribe flag set for.
-         for ( unsigned int i = 0; i < attr_count; ++i ) {
-            if ( attributes[i].is_subscribe() ) {
-               attrs.insert( attributes[i].get_attribute_handle() );
-            }
-         }
-
          if ( !attrs.empty() ) {
             rti_amb->subscribeObjectClassAttributes( this->class_handle,
                                                      attrs,
@@ -928,54 +1180,54 @@ void Object::subscribe_to_object_attributes()
       } catch ( ObjectClassNotDefined const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d ObjectClassNotDefined : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d ObjectClassNotDefined : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( AttributeNotDefined const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d AttributeNotDefined : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d AttributeNotDefined : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( FederateNotExecutionMember const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d FederateNotExecutionMember : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d FederateNotExecutionMember : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( SaveInProgress const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d SaveInProgress : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d SaveInProgress : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RestoreInProgress const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d RestoreInProgress : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d RestoreInProgress : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( InvalidUpdateRateDesignator const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d InvalidUpdateRateDesignator : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d InvalidUpdateRateDesignator : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( NotConnected const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d NotConnected : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d NotConnected : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RTIinternalError const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d RTIinternalError : '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d RTIinternalError : '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       } catch ( RTI1516_EXCEPTION const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::subscribe_to_object_attributes():%d exception '%s'.%c",
+         send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d exception '%s'.%c",
                   __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
       }
       // Macro to restore the saved FPU Control Word register value.
       TRICKHLA_RESTORE_FPU_CONTROL_WORD;
       TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
    } else {
-      send_hs( stderr, "Object::subscribe_to_object_attributes():%d Unexpected NULL RTIambassador.%c",
+      send_hs( stderr, "Object::subscribe_to_object_class_attributes():%d Unexpected NULL RTIambassador.%c",
                __LINE__, THLA_NEWLINE );
    }
 }
@@ -1175,7 +1427,9 @@ Waiting on reservation of Object Instance Name '%s'.%c",
       // Check for shutdown.
       federate->check_for_shutdown_with_termination();
 
-      sleep_timer.sleep();
+      // Block until a name reservation state change is signaled by the RTI
+      // callback or the bounded wait times out.
+      wait_for_name_reservation_change();
 
       if ( !name_registered ) { // cppcheck-suppress [knownConditionTrueFalse,unmatchedSuppression]
 
@@ -1213,6 +1467,46 @@ Object instance name '%s' is reserved.%c",
    }
 }
 
+/*!
+ * @details Broadcast so that every object blocked waiting on a name
+ * reservation wakes up and re-checks its own registration state. The name
+ * reservations are all requested up front, so a single condition variable
+ * shared by all objects lets the waits complete as the RTI callbacks
+ * arrive, in any order.
+ * @job_class{initialization}
+ */
+void Object::signal_name_reservation_change()
+{
+   pthread_mutex_lock( &name_reservation_cond_mutex );
+   pthread_cond_broadcast( &name_reservation_cond );
+   pthread_mutex_unlock( &name_reservation_cond_mutex );
+}
+
+/*!
+ * @details The wait is bounded to 10 milliseconds so that the caller can
+ * still run its periodic shutdown, execution member, and status print
+ * checks. The caller is responsible for re-checking the registration state
+ * after this function returns.
+ * @job_class{initialization}
+ */
+void Object::wait_for_name_reservation_change()
+{
+   pthread_mutex_lock( &name_reservation_cond_mutex );
+
+   struct timespec abs_timeout;
+   clock_gettime( CLOCK_REALTIME, &abs_timeout );
+   abs_timeout.tv_nsec += 10000000L;
+   if ( abs_timeout.tv_nsec >= 1000000000L ) {
+      abs_timeout.tv_sec += 1;
+      abs_timeout.tv_nsec -= 1000000000L;
+   }
+   pthread_cond_timedwait( &name_reservation_cond,
+                           &name_reservation_cond_mutex,
+                           &abs_timeout );
+
+   pthread_mutex_unlock( &name_reservation_cond_mutex );
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -1573,22 +1867,13 @@ void Object::request_attribute_value_update()
 
    RTIambassador *rti_amb = get_RTI_ambassador();
 
-   // Create the set of Attribute handles we need to request an update for.
-   AttributeHandleSet attr_handle_set = AttributeHandleSet();
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-      // Only include attributes that are remotely owned that are subscribed to.
-      if ( attributes[i].is_remotely_owned() && attributes[i].is_subscribe() ) {
-         attr_handle_set.insert( attributes[i].get_attribute_handle() );
-      }
-   }
-
    try {
+      // Use the cached handle set of the remotely owned attributes we are
+      // subscribed to, which the ownership count refresh keeps up to date,
+      // instead of rebuilding the set for every request.
       rti_amb->requestAttributeValueUpdate( this->instance_handle,
-                                            attr_handle_set,
+                                            remotely_owned_subscribed_attr_handles,
                                             RTI1516_USERDATA( 0, 0 ) );
-      // Must free the memory
-      attr_handle_set.clear();
-
    } catch ( AttributeNotDefined const &e ) {
       string id_str;
       StringUtilities::to_string( id_str, instance_handle );
@@ -1638,6 +1923,60 @@ void Object::request_attribute_value_update()
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
+/*!
+ * @details The request is made at the object class level, so the caller can
+ * group the object instances of a class together and ask the owners of
+ * every instance of that class for an update with a single call to the RTI.
+ * @job_class{scheduled}
+ */
+void Object::request_class_attribute_value_update(
+   AttributeHandleSet const &attrs )
+{
+   if ( attrs.empty() ) {
+      return;
+   }
+
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+
+   try {
+      rti_amb->requestAttributeValueUpdate( this->class_handle,
+                                            attrs,
+                                            RTI1516_USERDATA( 0, 0 ) );
+   } catch ( ObjectClassNotDefined const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d object class not defined for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( AttributeNotDefined const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d attribute not defined for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( FederateNotExecutionMember const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d federation not execution member for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( SaveInProgress const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d save in progress for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( RestoreInProgress const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d restore in progress for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( NotConnected const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d not connected error for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( RTIinternalError const &e ) {
+      send_hs( stderr, "Object::request_class_attribute_value_update():%d RTI internal error for '%s'%c",
+               __LINE__, get_name(), THLA_NEWLINE );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "Object.request_class_attribute_value_update():%d Exception: '%s' for '%s'%c",
+               __LINE__, rti_err_msg.c_str(), get_name(), THLA_NEWLINE );
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -1646,15 +1985,21 @@ void Object::provide_attribute_update(
 {
    bool any_attr_requested = false;
 
-   // Search the TrickHLA object attributes to see if any of them are
-   // part of the set of the attribute value update request.
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-
-      // Determine if this object attribute needs to provide an update.
-      if ( theAttributes.find( attributes[i].get_attribute_handle() ) != theAttributes.end() ) {
+   // Walk the requested handle set instead of scanning the whole attribute
+   // array, and record each request as a bit in the per-object requested
+   // update bitmask. The bits are set here on the FedAmb callback thread
+   // and drained wholesale on the send path, so any number of provide
+   // requests arriving within one data cycle coalesce into a single update.
+   for ( AttributeHandleSet::const_iterator iter = theAttributes.begin();
+         iter != theAttributes.end();
+         ++iter ) {
 
-         // Mark the attribute as having a request for an update.
-         attributes[i].set_update_requested( true );
+      Attribute const *attr = get_attribute( *iter );
+      if ( attr != NULL ) {
+         size_t const index = (size_t)( attr - attributes );
+         __atomic_fetch_or( &attr_update_request_mask[index / 64],
+                            1ULL << ( index % 64 ),
+                            __ATOMIC_RELAXED );
          any_attr_requested = true;
       }
    }
@@ -1671,6 +2016,50 @@ void Object::provide_attribute_update(
    }
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Object::set_attribute_update_advisory(
+   AttributeHandleSet const &theAttributes,
+   bool const                updates_on )
+{
+   // Search the TrickHLA object attributes to see if any of them are part
+   // of the set of attributes the relevance advisory applies to.
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+
+      if ( theAttributes.find( attributes[i].get_attribute_handle() ) != theAttributes.end() ) {
+
+         attributes[i].set_update_turned_on( updates_on );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+            send_hs( stdout, "Object::set_attribute_update_advisory():%d For object '%s', updates turned %s for attribute '%s'.%c",
+                     __LINE__, get_name(), ( updates_on ? "on" : "off" ),
+                     attributes[i].get_FOM_name(), THLA_NEWLINE );
+         }
+      }
+   }
+}
+
+/*!
+ * @details The bitmask words are atomically exchanged for zero, so provide
+ * requests arriving concurrently with the drain are kept for the next data
+ * cycle instead of being lost.
+ *
+ * @job_class{scheduled}
+ */
+void Object::consume_requested_update_mask()
+{
+   for ( size_t w = 0; w < attr_update_request_mask.size(); ++w ) {
+      unsigned long long bits = __atomic_exchange_n( &attr_update_request_mask[w],
+                                                     0ULL, __ATOMIC_RELAXED );
+      while ( bits != 0ULL ) {
+         int const b = __builtin_ctzll( bits );
+         bits &= ( bits - 1ULL );
+         attributes[( w * 64 ) + b].set_update_requested( true );
+      }
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -1697,6 +2086,10 @@ void Object::send_requested_data(
    // want to send data once per request.
    this->attr_update_requested = false;
 
+   // Translate the requested-update bitmask into the per-attribute request
+   // flags consumed below.
+   consume_requested_update_mask();
+
    // We can only send attribute updates for the attributes we own and are
    // configured to publish.
    if ( !any_locally_owned_published_requested_attribute() ) {
@@ -1962,12 +2355,24 @@ void Object::send_cyclic_and_requested_data(
    // want to send data once per request.
    this->attr_update_requested = false;
 
+   // Translate the requested-update bitmask into the per-attribute request
+   // flags consumed below.
+   consume_requested_update_mask();
+
    // We can only send cyclic attribute updates for the attributes we own, are
    // configured to publish and the cycle-time is ready for a send or was requested.
    if ( !any_locally_owned_published_cyclic_data_ready_or_requested_attribute() ) {
       return;
    }
 
+#ifdef THLA_CYCLIC_SEND_TIME_STATS
+   // Measure the time spent sending the cyclic and requested data.
+   ElapsedTimeStats::ScopedTimer send_timer( send_time_stats );
+#endif
+
+   // Trace the whole send stage, including the encode and the RTI call.
+   THLA_TRACEPOINT_SCOPE( "Object::send_cyclic_and_requested_data" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -2023,6 +2428,9 @@ void Object::send_cyclic_and_requested_data(
       return;
    }
 
+   // Lazily set up the optional shared-memory fast path for this object.
+   setup_shared_memory_transport();
+
    Federate const *federate = get_federate();
 
    // The message will only be sent as TSO if our Federate is in the HLA Time
@@ -2033,6 +2441,20 @@ void Object::send_cyclic_and_requested_data(
                                     && ( this->any_attribute_timestamp_order
                                          || this->any_attribute_FOM_specified_order );
 
+   // Stamp the outgoing update with the current CTE time in the
+   // user-supplied tag when the one-way latency survey is enabled, so the
+   // subscribing federates can measure the one-way delay against their
+   // own CTE timeline.
+   RTI1516_USERDATA update_tag( 0, 0 );
+   if ( this->latency_survey ) {
+      double const cte_time = get_cte_time();
+      if ( cte_time > -std::numeric_limits< double >::max() ) {
+         unsigned char stamp[LATENCY_SURVEY_STAMP_SIZE];
+         encode_latency_survey_stamp( stamp, cte_time );
+         update_tag = RTI1516_USERDATA( stamp, sizeof( stamp ) );
+      }
+   }
+
    try {
       // Do not send any data if federate save or restore has begun (see
       // IEEE-1516.1-2000 sections 4.12, 4.20)
@@ -2040,30 +2462,167 @@ void Object::send_cyclic_and_requested_data(
 
          RTIambassador *rti_amb = get_RTI_ambassador();
 
-         if ( send_with_timestamp ) {
+         // When the single-submitter proxy is enabled post the encoded
+         // updates to it instead of contending on the RTI's internal lock
+         // with the data jobs on the other Trick child threads.
+         RTISubmitter *rti_submitter = get_federate()->get_rti_submission_proxy();
+
+         // Take a send pacing token for this object's update, which delays
+         // the call when the frame's burst is ahead of the pacing window.
+         get_federate()->send_pacer.acquire();
+
+         // Receive-order fast path for a mixed preferred-order update: move
+         // the receive-order preferred attribute values into their own update
+         // and send them without a timestamp, so they bypass the RTI
+         // time-stamp-order queue and its lookahead of latency while the
+         // timestamp order attributes below stay TSO.
+         bool sent_receive_order_split = false;
+         if ( send_with_timestamp && this->any_attribute_receive_order ) {
+            // Make sure no stale values are left over from a previous cycle
+            // that ended in an exception before the merge back below.
+            RO_attribute_values_map->clear();
+
+            for ( unsigned int i = 0; i < attr_count; ++i ) {
+               if ( attributes[i].get_preferred_order() == TRANSPORT_RECEIVE_ORDER ) {
+                  AttributeHandleValueMap::iterator avm_iter =
+                     attribute_values_map->find( attributes[i].get_attribute_handle() );
+                  if ( avm_iter != attribute_values_map->end() ) {
+                     ( *RO_attribute_values_map )[avm_iter->first] = std::move( avm_iter->second );
+                     attribute_values_map->erase( avm_iter );
+                  }
+               }
+            }
+            if ( !RO_attribute_values_map->empty() ) {
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  ostringstream msg;
+                  msg << "Object::send_cyclic_and_requested_data():" << __LINE__
+                      << " Object '" << get_name()
+                      << "', Receive Order (RO) fast path Attribute update."
+                      << THLA_NEWLINE;
+                  DebugHandler::print( msg.str() );
+               }
 
-            if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_cyclic_and_requested_data():%d \
-Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds.%c",
-                        __LINE__, get_name(), update_time.get_time_in_seconds(),
-                        THLA_NEWLINE );
+               // Send as Receive Order (i.e. with no timestamp).
+               {
+                  THLA_TRACEPOINT_SCOPE( "Object::updateAttributeValues" );
+                  if ( rti_submitter != NULL ) {
+                     rti_submitter->post_attribute_update( rti_amb,
+                                                           this->instance_handle,
+                                                           *RO_attribute_values_map,
+                                                           update_tag,
+                                                           false, update_time, get_name() );
+                  } else {
+                     rti_amb->updateAttributeValues( this->instance_handle,
+                                                     *RO_attribute_values_map,
+                                                     update_tag );
+                  }
+               }
+               sent_receive_order_split = true;
             }
+         }
 
-            // Send as Timestamp Order
-            rti_amb->updateAttributeValues( this->instance_handle,
-                                            *attribute_values_map,
-                                            RTI1516_USERDATA( 0, 0 ),
-                                            update_time.get() );
-         } else {
-            if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
-                        __LINE__, get_name(), THLA_NEWLINE );
+         if ( !attribute_values_map->empty() ) {
+            if ( send_with_timestamp ) {
+
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  ostringstream msg;
+                  msg << "Object::send_cyclic_and_requested_data():" << __LINE__
+                      << " Object '" << get_name()
+                      << "', Timestamp Order (TSO) Attribute update, HLA Logical Time:"
+                      << update_time.get_time_in_seconds() << " seconds."
+                      << THLA_NEWLINE;
+                  DebugHandler::print( msg.str() );
+               }
+
+               // Send as Timestamp Order
+               {
+                  THLA_TRACEPOINT_SCOPE( "Object::updateAttributeValues" );
+                  if ( rti_submitter != NULL ) {
+                     rti_submitter->post_attribute_update( rti_amb,
+                                                           this->instance_handle,
+                                                           *attribute_values_map,
+                                                           update_tag,
+                                                           true, update_time, get_name() );
+                  } else {
+                     rti_amb->updateAttributeValues( this->instance_handle,
+                                                     *attribute_values_map,
+                                                     update_tag,
+                                                     update_time.get() );
+                  }
+               }
+            } else {
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  ostringstream msg;
+                  msg << "Object::send_cyclic_and_requested_data():" << __LINE__
+                      << " Object '" << get_name()
+                      << "', Receive Order (RO) Attribute update."
+                      << THLA_NEWLINE;
+                  DebugHandler::print( msg.str() );
+               }
+
+               // Send as Receive Order (i.e. with no timestamp).
+               {
+                  THLA_TRACEPOINT_SCOPE( "Object::updateAttributeValues" );
+                  if ( rti_submitter != NULL ) {
+                     rti_submitter->post_attribute_update( rti_amb,
+                                                           this->instance_handle,
+                                                           *attribute_values_map,
+                                                           update_tag,
+                                                           false, update_time, get_name() );
+                  } else {
+                     rti_amb->updateAttributeValues( this->instance_handle,
+                                                     *attribute_values_map,
+                                                     update_tag );
+                  }
+               }
             }
+         }
 
-            // Send as Receive Order (i.e. with no timestamp).
-            rti_amb->updateAttributeValues( this->instance_handle,
-                                            *attribute_values_map,
-                                            RTI1516_USERDATA( 0, 0 ) );
+         // Update the live performance counters before the receive-order
+         // values are merged back below. The byte sum only runs when a
+         // metrics block is registered.
+         if ( Metrics::is_active() ) {
+            long long update_count = 0;
+            long long byte_count   = 0;
+            AttributeHandleValueMap::const_iterator metrics_iter;
+            if ( sent_receive_order_split ) {
+               ++update_count;
+               for ( metrics_iter = RO_attribute_values_map->begin();
+                     metrics_iter != RO_attribute_values_map->end();
+                     ++metrics_iter ) {
+                  byte_count += (long long)metrics_iter->second.size();
+               }
+            }
+            if ( !attribute_values_map->empty() ) {
+               ++update_count;
+               for ( metrics_iter = attribute_values_map->begin();
+                     metrics_iter != attribute_values_map->end();
+                     ++metrics_iter ) {
+                  byte_count += (long long)metrics_iter->second.size();
+               }
+            }
+            Metrics::count_attribute_updates_sent( update_count, byte_count );
+         }
+
+         // Merge the receive-order values back so the shared-memory mirror
+         // below sees the complete update and the map nodes get recycled on
+         // the next data cycle.
+         if ( sent_receive_order_split ) {
+            AttributeHandleValueMap::iterator ro_iter;
+            for ( ro_iter = RO_attribute_values_map->begin();
+                  ro_iter != RO_attribute_values_map->end();
+                  ++ro_iter ) {
+               ( *attribute_values_map )[ro_iter->first] = std::move( ro_iter->second );
+            }
+            RO_attribute_values_map->clear();
+         }
+
+         // Mirror the update into the shared-memory fast path so any
+         // co-located subscribing federate can pick it up without a round
+         // trip through the RTI network stack. The RTI update sent above
+         // remains the authoritative and fallback channel.
+         if ( shm_send_ring != NULL ) {
+            mirror_cyclic_data_to_shared_memory();
          }
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
@@ -2228,6 +2787,10 @@ void Object::send_zero_lookahead_and_requested_data(
    // want to send data once per request.
    this->attr_update_requested = false;
 
+   // Translate the requested-update bitmask into the per-attribute request
+   // flags consumed below.
+   consume_requested_update_mask();
+
    // We can only send zero-lookahead attribute updates for the attributes we
    // own, are configured to publish.
    if ( !any_locally_owned_published_zero_lookahead_or_requested_attribute() ) {
@@ -2522,7 +3085,21 @@ void Object::receive_cyclic_data()
       return;
    }
 
-   // Block waiting for received data if the user has specified we must do so.
+   // Local instance filtering: while this instance's subscription is
+   // switched off, reflections may still be delivered because the class
+   // subscription covers the other instances, so just don't unpack them
+   // into the simulation.
+   if ( !this->subscription_active ) {
+      return;
+   }
+
+   // Poll the optional shared-memory fast path first so an update from a
+   // co-located owning federate is available without waiting on the RTI
+   // callback thread.
+   setup_shared_memory_transport();
+   receive_shared_memory_data();
+
+   // Block waiting for received data if the user has specified we must do so.
    if ( blocking_cyclic_read ) {
 
       // If we are doing blocking reads, we need to skip the first one since it
@@ -2596,6 +3173,12 @@ void Object::receive_cyclic_data()
          // Unpack the buffer and copy the values to the object attributes.
          unpack_cyclic_attribute_buffers();
 
+         // Initialization-only attributes are excluded from the cyclic
+         // iteration structures, so pick up any that arrived from an
+         // explicit attribute update request or the initial registration
+         // update.
+         unpack_received_init_only_attribute_buffers();
+
          // Unpack the data for the object if we have a packing object.
          if ( packing != NULL ) {
             packing->unpack();
@@ -2644,6 +3227,218 @@ void Object::receive_cyclic_data()
 #endif
 }
 
+/*!
+ * @details The shared-memory transport is an optional fast path for attribute
+ * updates between federates running on the same host, see the
+ * Federate::shared_memory_transport flag. The ring for this object can only
+ * be set up once the federation has been joined and the object instance name
+ * is known, so the setup is done lazily from the cyclic send and receive
+ * paths. The RTI remains the time management and fallback channel, so a
+ * failure to set up the ring only costs us the fast path.
+ * @job_class{scheduled}
+ */
+void Object::setup_shared_memory_transport()
+{
+   // Nothing to do if setup failed before or both rings already exist.
+   if ( shm_transport_failed
+        || ( ( shm_send_ring != NULL ) && ( shm_receive_ring != NULL ) ) ) {
+      return;
+   }
+
+   Federate *federate = get_federate();
+   if ( ( federate == NULL ) || !federate->is_shared_memory_transport_active() ) {
+      return;
+   }
+   if ( ( get_name() == NULL ) || ( federate->get_federation_name() == NULL ) ) {
+      return;
+   }
+
+   if ( shm_channel_name.empty() ) {
+      shm_channel_name = SharedMemoryRing::make_channel_name(
+         federate->get_federation_name(), get_name() );
+   }
+
+   // Writer role: we own and publish cyclic attributes for this object, so
+   // create the ring that co-located subscribers will poll. The fast path
+   // assumes whole-object ownership; for mixed attribute ownership the RTI
+   // reflections remain authoritative either way.
+   if ( ( shm_send_ring == NULL )
+        && any_locally_owned_published_attribute( CONFIG_CYCLIC ) ) {
+
+      // Size one ring frame from the current attribute buffer sizes with
+      // headroom for dynamically sized attribute arrays that may grow.
+      size_t frame_size = sizeof( uint32_t );
+      for ( int i = 0; i < attr_count; ++i ) {
+         frame_size += sizeof( uint64_t ) + sizeof( uint32_t )
+                       + attributes[i].get_attribute_size();
+      }
+      frame_size *= 2;
+      if ( frame_size < 4096 ) {
+         frame_size = 4096;
+      }
+
+      shm_send_ring = new SharedMemoryRing();
+      if ( shm_send_ring->create( shm_channel_name, frame_size, 8 ) ) {
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+            send_hs( stdout, "Object::setup_shared_memory_transport():%d Created shared-memory channel '%s' for object '%s'.%c",
+                     __LINE__, shm_channel_name.c_str(), get_name(), THLA_NEWLINE );
+         }
+      } else {
+         delete shm_send_ring;
+         shm_send_ring        = NULL;
+         shm_transport_failed = true;
+         send_hs( stderr, "Object::setup_shared_memory_transport():%d Failed to create shared-memory channel '%s' for object '%s', falling back to the RTI only.%c",
+                  __LINE__, shm_channel_name.c_str(), get_name(), THLA_NEWLINE );
+         return;
+      }
+   }
+
+   // Reader role: the cyclic attributes are owned by another federate, so
+   // poll the ring it publishes into. The ring is opened lazily from the
+   // receive path because the owning federate may not have created the
+   // shared-memory segment yet.
+   if ( ( shm_receive_ring == NULL )
+        && any_remotely_owned_subscribed_cyclic_attribute() ) {
+      shm_receive_ring = new SharedMemoryRing();
+   }
+}
+
+/*!
+ * @details Each published frame holds the same packed attribute values that
+ * were just sent through the RTI, so a co-located subscriber can pick the
+ * update up with a couple of memory copies instead of a round trip through
+ * the RTI network stack. The frame format is a record count followed by one
+ * record per attribute: the attribute handle hash, the encoded value size,
+ * and the encoded value bytes.
+ * @job_class{scheduled}
+ */
+void Object::mirror_cyclic_data_to_shared_memory()
+{
+   if ( ( shm_send_ring == NULL ) || !shm_send_ring->is_valid() ) {
+      return;
+   }
+
+   // Size the frame for the attribute values populated into the map by
+   // create_attribute_set().
+   size_t frame_size = sizeof( uint32_t );
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+      frame_size += sizeof( uint64_t ) + sizeof( uint32_t ) + iter->second.size();
+   }
+   if ( shm_frame_buffer.size() < frame_size ) {
+      shm_frame_buffer.resize( frame_size );
+   }
+
+   // Serialize the attribute values into the frame.
+   unsigned char *output = &shm_frame_buffer[0];
+
+   uint32_t const record_count = (uint32_t)attribute_values_map->size();
+   memcpy( output, &record_count, sizeof( record_count ) );
+   output += sizeof( record_count );
+
+   for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+      uint64_t const handle_hash = (uint64_t)iter->first.hash();
+      uint32_t const value_size  = (uint32_t)iter->second.size();
+      memcpy( output, &handle_hash, sizeof( handle_hash ) );
+      output += sizeof( handle_hash );
+      memcpy( output, &value_size, sizeof( value_size ) );
+      output += sizeof( value_size );
+      memcpy( output, iter->second.data(), value_size );
+      output += value_size;
+   }
+
+   // Publish the frame. The only failure is a frame larger than the ring
+   // slot payload, in which case the co-located subscriber still gets the
+   // update through the RTI fallback channel.
+   if ( !shm_send_ring->write( &shm_frame_buffer[0], frame_size )
+        && DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stderr, "Object::mirror_cyclic_data_to_shared_memory():%d Frame of %d bytes too large for shared-memory channel '%s', subscribers will use the RTI fallback.%c",
+               __LINE__, (int)frame_size, shm_channel_name.c_str(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details Any frame read from the ring is extracted through the same
+ * Object::extract_data() path used for RTI reflections, so the data shows up
+ * as changed and is unpacked by the normal cyclic receive processing. The
+ * matching RTI reflection that arrives later carries the same values and is
+ * simply processed as usual, keeping the RTI as the authoritative and
+ * fallback channel.
+ * @job_class{scheduled}
+ */
+void Object::receive_shared_memory_data()
+{
+   if ( shm_receive_ring == NULL ) {
+      return;
+   }
+
+   // The owning federate may not have created the shared-memory segment
+   // yet, so keep trying to open it until it shows up.
+   if ( !shm_receive_ring->is_valid()
+        && !shm_receive_ring->open( shm_channel_name ) ) {
+      return;
+   }
+
+   // Size the scratch buffer to hold the largest possible frame.
+   size_t const frame_capacity = shm_receive_ring->get_frame_size();
+   if ( shm_frame_buffer.size() < frame_capacity ) {
+      shm_frame_buffer.resize( frame_capacity );
+   }
+
+   size_t frame_size;
+   while ( shm_receive_ring->read( &shm_frame_buffer[0], frame_capacity, frame_size ) ) {
+
+      // Deserialize the frame into an attribute values map keyed by the
+      // attribute handles matching the published handle hashes.
+      unsigned char const *input     = &shm_frame_buffer[0];
+      unsigned char const *frame_end = input + frame_size;
+
+      if ( (size_t)( frame_end - input ) < sizeof( uint32_t ) ) {
+         continue;
+      }
+      uint32_t record_count;
+      memcpy( &record_count, input, sizeof( record_count ) );
+      input += sizeof( record_count );
+
+      AttributeHandleValueMap received_values;
+
+      for ( uint32_t record = 0; record < record_count; ++record ) {
+         if ( (size_t)( frame_end - input ) < ( sizeof( uint64_t ) + sizeof( uint32_t ) ) ) {
+            break; // Malformed frame, stop parsing it.
+         }
+         uint64_t handle_hash;
+         uint32_t value_size;
+         memcpy( &handle_hash, input, sizeof( handle_hash ) );
+         input += sizeof( handle_hash );
+         memcpy( &value_size, input, sizeof( value_size ) );
+         input += sizeof( value_size );
+         if ( (size_t)( frame_end - input ) < value_size ) {
+            break; // Malformed frame, stop parsing it.
+         }
+
+         // Find the attribute with the matching handle hash. Attribute
+         // handles are issued per object class by the RTI so they match
+         // across the federates of a federation execution.
+         for ( int i = 0; i < attr_count; ++i ) {
+            AttributeHandle const &handle = attributes[i].get_attribute_handle();
+            if ( (uint64_t)handle.hash() == handle_hash ) {
+               received_values[handle].setData( input, value_size );
+               break;
+            }
+         }
+         input += value_size;
+      }
+
+      if ( !received_values.empty() ) {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &receive_mutex );
+
+         extract_data( received_values );
+      }
+   }
+}
+
 /*!
  * @details If the object is owned remotely, this function copies its internal
  * data into simulation object and marks the object as "unchanged". This data
@@ -2675,6 +3470,12 @@ void Object::receive_zero_lookahead_data()
          // Unpack the buffer and copy the values to the object attributes.
          unpack_zero_lookahead_attribute_buffers();
 
+         // Initialization-only attributes are excluded from the
+         // zero-lookahead iteration structures, so pick up any that
+         // arrived from an explicit attribute update request or the
+         // initial registration update.
+         unpack_received_init_only_attribute_buffers();
+
          // Unpack the data for the object if we have a packing object.
          if ( packing != NULL ) {
             packing->unpack();
@@ -2728,6 +3529,89 @@ void Object::receive_zero_lookahead_data()
 #endif
 }
 
+bool Object::is_received_data_available()
+{
+#if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+   // Only reads the changed flag and the lock-free queue state, so this is
+   // safe to call while holding the data arrival condition mutex.
+   return ( this->changed
+            || latest_update_buffer.fresh()
+            || !thla_reflected_attributes_queue.empty() );
+#else
+   return this->changed;
+#endif
+}
+
+/*!
+ * @details The consumer blocks on a condition variable that is signaled
+ * directly from enqueue_data() when reflected attribute data arrives, so
+ * no polling quantum is added to the receive latency.
+ * @job_class{scheduled}
+ */
+bool Object::wait_for_data_arrival(
+   double const timeout_seconds )
+{
+   // Return right away if reflected attribute data is already available.
+   if ( is_received_data_available() ) {
+      return true;
+   }
+
+   bool const use_timeout = ( timeout_seconds > 0.0 );
+
+   struct timespec abs_timeout;
+   if ( use_timeout ) {
+      clock_gettime( CLOCK_REALTIME, &abs_timeout );
+      time_t const whole_seconds = (time_t)timeout_seconds;
+      abs_timeout.tv_sec += whole_seconds;
+      abs_timeout.tv_nsec += (long)( ( timeout_seconds - (double)whole_seconds ) * 1000000000.0 );
+      if ( abs_timeout.tv_nsec >= 1000000000L ) {
+         abs_timeout.tv_sec += 1;
+         abs_timeout.tv_nsec -= 1000000000L;
+      }
+   }
+
+   pthread_mutex_lock( &data_arrival_cond_mutex );
+   this->data_arrival_waiting = true;
+
+   while ( !is_received_data_available() ) {
+      if ( use_timeout ) {
+         if ( pthread_cond_timedwait( &data_arrival_cond,
+                                      &data_arrival_cond_mutex,
+                                      &abs_timeout ) != 0 ) {
+            // Timed out or failed, let the caller decide what to do next.
+            break;
+         }
+      } else {
+         pthread_cond_wait( &data_arrival_cond, &data_arrival_cond_mutex );
+      }
+   }
+
+   this->data_arrival_waiting = false;
+   pthread_mutex_unlock( &data_arrival_cond_mutex );
+
+   return is_received_data_available();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool Object::wait_and_receive_zero_lookahead_data(
+   double const timeout_seconds )
+{
+   // There must be some remotely owned attribute that we subscribe to in
+   // order for us to receive it.
+   if ( !any_remotely_owned_subscribed_zero_lookahead_attribute() ) {
+      return false;
+   }
+
+   if ( !wait_for_data_arrival( timeout_seconds ) ) {
+      return false;
+   }
+
+   receive_zero_lookahead_data();
+   return true;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -2979,22 +3863,80 @@ void Object::receive_init_data()
 #endif
 }
 
+/*!
+ * @job_class{initialization}
+ */
+void Object::invalidate_resolved_address_caches()
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      attributes[i].invalidate_resolved_address_cache();
+   }
+}
+
+/*!
+ * @details The attribute values map nodes and their VariableLengthData
+ * payloads are recycled from the previous data cycle instead of being torn
+ * down and reallocated every cycle, which removes all the per-cycle map
+ * allocator round trips for the steady-state case where the same set of
+ * attributes is sent each cycle.
+ */
+void Object::begin_populating_attribute_values()
+{
+   // Keep the existing map nodes, just track which ones get refreshed.
+   populated_attribute_handles.clear();
+}
+
+RTI1516_NAMESPACE::VariableLengthData &Object::get_attribute_value_slot(
+   RTI1516_NAMESPACE::AttributeHandle const &handle )
+{
+   populated_attribute_handles.push_back( handle );
+
+   // Reuses the existing map node for this handle when one exists from a
+   // previous data cycle, otherwise a new node is created.
+   return ( *attribute_values_map )[handle];
+}
+
+void Object::finish_populating_attribute_values()
+{
+   // Remove only the stale map entries left over from the previous data
+   // cycle that were not refreshed this cycle.
+   if ( attribute_values_map->size() > populated_attribute_handles.size() ) {
+      AttributeHandleValueMap::iterator iter = attribute_values_map->begin();
+      while ( iter != attribute_values_map->end() ) {
+         bool populated = false;
+         for ( unsigned int i = 0; i < populated_attribute_handles.size(); ++i ) {
+            if ( populated_attribute_handles[i] == iter->first ) {
+               populated = true;
+               break;
+            }
+         }
+         if ( populated ) {
+            ++iter;
+         } else {
+            attribute_values_map->erase( iter++ );
+         }
+      }
+   }
+}
+
 /*!
  * @job_class{scheduled}
  */
 void Object::create_requested_attribute_set()
 {
-   // Make sure we clear the map before we populate it.
-   if ( !attribute_values_map->empty() ) {
-      attribute_values_map->clear();
+   // Recycle the map nodes from the previous cycle instead of clearing.
+   begin_populating_attribute_values();
+
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
    }
 
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
+   for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+      unsigned int const i = locally_owned_published_index[n];
 
-      // Only include attributes that have been requested, we own, and we publish.
-      if ( attributes[i].is_update_requested()
-           && attributes[i].is_locally_owned()
-           && attributes[i].is_publish() ) {
+      // Only include attributes that have been requested. The index list
+      // already restricts this to the attributes we own and publish.
+      if ( attributes[i].is_update_requested() ) {
 
          // If there was a requested update for this attribute make sure
          // we clear the request flag.
@@ -3005,9 +3947,13 @@ void Object::create_requested_attribute_set()
                      __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
          }
          // Create the Attribute-Value from the buffered data.
-         ( *attribute_values_map )[attributes[i].get_attribute_handle()] = attributes[i].get_attribute_value();
+         attributes[i].get_attribute_value(
+            get_attribute_value_slot( attributes[i].get_attribute_handle() ) );
       }
    }
+
+   // Remove any stale map entries left over from the previous cycle.
+   finish_populating_attribute_values();
 }
 
 /*!
@@ -3017,25 +3963,48 @@ void Object::create_attribute_set(
    DataUpdateEnum const required_config,
    bool const           include_requested )
 {
-   // Make sure we clear the map before we populate it.
-   if ( !attribute_values_map->empty() ) {
-      attribute_values_map->clear();
+   // Recycle the map nodes from the previous cycle instead of clearing.
+   begin_populating_attribute_values();
+
+   // Keep the cached locally owned published attribute index list current
+   // so each branch below only visits the attributes it could actually send.
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+
+   // Let a batched conditional evaluate all of its change thresholds in one
+   // sweep, so the per-attribute should_send() calls below just consume the
+   // resulting send bitmask.
+   if ( conditional != NULL ) {
+      conditional->evaluate();
    }
 
    // If the cyclic bit is set in the required-configuration then we need
    // to check to make sure the sub-rate is ready to send flag is set for
    // each attribute.
    if ( ( required_config & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) {
-      for ( unsigned int i = 0; i < attr_count; ++i ) {
-
-         // Only include attributes that have the required configuration,
-         // we own, we publish, and the sub-rate says we are ready to
-         // send or the attribute has been requested.
-         if ( attributes[i].is_locally_owned()
-              && attributes[i].is_publish()
-              && ( ( include_requested && attributes[i].is_update_requested() )
-                   || ( attributes[i].is_data_cycle_ready()
-                        && ( ( attributes[i].get_configuration() & required_config ) == required_config ) ) ) ) {
+      for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+         unsigned int const i = locally_owned_published_index[n];
+
+         // Only include attributes that have the required configuration
+         // and the sub-rate says we are ready to send or the attribute
+         // has been requested. The index list already restricts this to
+         // the attributes we own and publish.
+         if ( ( include_requested && attributes[i].is_update_requested() )
+              || ( is_attribute_send_cycle_due( i )
+                   && ( ( attributes[i].get_configuration() & required_config ) == required_config ) ) ) {
+
+            // Skip the attribute when the attribute relevance advisory has
+            // told us no remote federate subscribes to it, unless another
+            // federate has explicitly requested an update.
+            if ( !attributes[i].is_update_turned_on()
+                 && !( include_requested && attributes[i].is_update_requested() ) ) {
+               if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                  send_hs( stdout, "Object::create_attribute_set():%d For cyclic object '%s', skipping '%s' with no remote subscribers.%c",
+                           __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
+               }
+               continue;
+            }
 
             // If there is no sub-classed TrickHLA-Conditional object for this
             // attribute or if the sub-classed Conditional object indicates that
@@ -3046,6 +4015,21 @@ void Object::create_attribute_set(
                  || conditional->should_send( &attributes[i] )
                  || ( include_requested && attributes[i].is_update_requested() ) ) {
 
+               // When configured to skip unchanged updates, suppress this
+               // cyclic update if the encoded data has not changed since the
+               // last sent update, unless another federate has requested an
+               // update which must always be honored.
+               if ( attributes[i].skip_unchanged_updates
+                    && !( include_requested && attributes[i].is_update_requested() )
+                    && !attributes[i].is_data_changed_since_last_sent() ) {
+                  ++attributes[i].updates_suppressed_count;
+                  if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+                     send_hs( stdout, "Object::create_attribute_set():%d For cyclic object '%s', skipping unchanged '%s'.%c",
+                              __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
+                  }
+                  continue;
+               }
+
                // If there was a requested update for this attribute make sure
                // we clear the request flag now since we are handling it here.
                attributes[i].set_update_requested( false );
@@ -3055,20 +4039,20 @@ void Object::create_attribute_set(
                            __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
                }
                // Create the Attribute-Value from the buffered data.
-               ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-                  attributes[i].get_attribute_value();
+               attributes[i].get_attribute_value(
+                  get_attribute_value_slot( attributes[i].get_attribute_handle() ) );
             }
          }
       }
    } else if ( ( required_config & CONFIG_ZERO_LOOKAHEAD ) == CONFIG_ZERO_LOOKAHEAD ) {
-      for ( unsigned int i = 0; i < attr_count; ++i ) {
+      for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+         unsigned int const i = locally_owned_published_index[n];
 
-         // Only include attributes that have the required configuration,
-         // we own, we publish, or the attribute has been requested.
-         if ( attributes[i].is_locally_owned()
-              && attributes[i].is_publish()
-              && ( ( include_requested && attributes[i].is_update_requested() )
-                   || ( ( attributes[i].get_configuration() & required_config ) == required_config ) ) ) {
+         // Only include attributes that have the required configuration
+         // or the attribute has been requested. The index list already
+         // restricts this to the attributes we own and publish.
+         if ( ( include_requested && attributes[i].is_update_requested() )
+              || ( ( attributes[i].get_configuration() & required_config ) == required_config ) ) {
 
             // If there is no sub-classed TrickHLA-Conditional object for this
             // attribute or if the sub-classed Conditional object indicates that
@@ -3088,19 +4072,19 @@ void Object::create_attribute_set(
                            __LINE__, get_name(), attributes[i].get_FOM_name(), THLA_NEWLINE );
                }
                // Create the Attribute-Value from the buffered data.
-               ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-                  attributes[i].get_attribute_value();
+               attributes[i].get_attribute_value(
+                  get_attribute_value_slot( attributes[i].get_attribute_handle() ) );
             }
          }
       }
    } else {
-      for ( unsigned int i = 0; i < attr_count; ++i ) {
+      for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+         unsigned int const i = locally_owned_published_index[n];
 
-         // Only include attributes that have the required configuration,
-         // we own, and we publish.
-         if ( attributes[i].is_locally_owned()
-              && attributes[i].is_publish()
-              && ( ( attributes[i].get_configuration() & required_config ) == required_config ) ) {
+         // Only include attributes that have the required configuration.
+         // The index list already restricts this to the attributes we own
+         // and publish.
+         if ( ( attributes[i].get_configuration() & required_config ) == required_config ) {
 
             // If there was a requested update for this attribute make
             // sure we clear the request flag now since we are handling
@@ -3108,11 +4092,14 @@ void Object::create_attribute_set(
             attributes[i].set_update_requested( false );
 
             // Create the Attribute-Value from the buffered data.
-            ( *attribute_values_map )[attributes[i].get_attribute_handle()] =
-               attributes[i].get_attribute_value();
+            attributes[i].get_attribute_value(
+               get_attribute_value_slot( attributes[i].get_attribute_handle() ) );
          }
       }
    }
+
+   // Remove any stale map entries left over from the previous cycle.
+   finish_populating_attribute_values();
 }
 
 #if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
@@ -3120,13 +4107,85 @@ void Object::create_attribute_set(
  * @job_class{scheduled}
  */
 void Object::enqueue_data(
-   AttributeHandleValueMap const &theAttributes )
+   AttributeHandleValueMap &theAttributes )
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &receive_mutex );
+   THLA_TRACEPOINT( "Object::enqueue_data" );
+
+   // Freshness bookkeeping: one clock read per reflection. The arrival
+   // time is published atomically so the data age queries and the
+   // consumption latency sample in extract_data() can read it from other
+   // threads, and the interval since the previous arrival feeds the
+   // update-interval statistics. Only this RTI callback thread writes the
+   // arrival time, so the previous value is read plainly.
+   {
+      int64_t const   arrival_time = clock_wall_time(); // in microseconds
+      long long const previous     = this->last_data_arrival_time_us;
+      if ( previous > 0 ) {
+         update_interval_stats.sample( (double)( arrival_time - previous ) * 0.001 );
+      }
+      __atomic_store_n( &this->last_data_arrival_time_us, (long long)arrival_time, __ATOMIC_RELEASE );
+   }
+
+   // Update the live performance counters. The byte sum only runs when a
+   // metrics block is registered.
+   if ( Metrics::is_active() ) {
+      long long byte_count = 0;
+      AttributeHandleValueMap::const_iterator metrics_iter;
+      for ( metrics_iter = theAttributes.begin();
+            metrics_iter != theAttributes.end();
+            ++metrics_iter ) {
+         byte_count += (long long)metrics_iter->second.size();
+      }
+      Metrics::count_attribute_reflection_received( byte_count );
+   }
+
+   // Append the reflected values to the capture file when a capture is
+   // active. All the reflectAttributeValues() callback variants funnel the
+   // received data through here, making this the one capture point. The
+   // capture must happen before the push or publish below moves the values
+   // out of the map.
+   if ( UpdateCapture::is_active() ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &receive_mutex );
+
+      UpdateCapture::record( this, theAttributes );
+   }
+
+   if ( keep_latest_update_only ) {
+      // Keep-latest decimation: publish this reflection as the latest
+      // snapshot, superseding any value not yet consumed. This bounds both
+      // the queue memory and the decode cost at the consumer's rate
+      // regardless of the publisher rate. The publish moves the attribute
+      // values into a wait-free triple buffer slot, so this per-reflection
+      // path takes no lock and never contends with the consumer. The
+      // decode happens at the consumer's cycle.
+      latest_update_buffer.publish( theAttributes );
+   } else {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &receive_mutex );
+
+      // The push moves the attribute values into the queue, which leaves
+      // the callers map empty, so the payload is not copied here.
+      thla_reflected_attributes_queue.push( theAttributes );
+   }
+
+   // Wake any consumer blocked in wait_for_data_arrival(). The receive
+   // mutex is not held here to avoid a lock order inversion with the
+   // waiter.
+   if ( this->data_arrival_waiting ) {
+      pthread_mutex_lock( &data_arrival_cond_mutex );
+      pthread_cond_broadcast( &data_arrival_cond );
+      pthread_mutex_unlock( &data_arrival_cond_mutex );
+   }
 
-   thla_reflected_attributes_queue.push( theAttributes );
+   // Notify the registered callback so the arrival of the data can
+   // directly trigger the consuming job without a poll cycle. The callback
+   // runs on the RTI callback thread and must be short and non-blocking.
+   if ( data_arrival_callback != NULL ) {
+      ( *data_arrival_callback )( this, data_arrival_user_arg );
+   }
 }
 #endif // THLA_QUEUE_REFLECTED_ATTRIBUTES
 
@@ -3136,8 +4195,12 @@ void Object::enqueue_data(
  * @job_class{scheduled}
  */
 bool Object::extract_data(
-   AttributeHandleValueMap &theAttributes )
+   AttributeHandleValueMap &theAttributes,
+   bool const               borrow_data )
 {
+   // Trace the decode stage of the receive path.
+   THLA_TRACEPOINT_SCOPE( "Object::extract_data" );
+
    // We need to iterate through the AttributeHandleValuePairSet
    // to extract each AttributeHandleValuePair. Based on the type
    // specified ( the value returned by getHandle() ) we need to
@@ -3164,7 +4227,7 @@ bool Object::extract_data(
       if ( attr != NULL ) {
 
          // Place the RTI AttributeValue into the TrickHLA Attribute.
-         if ( attr->extract_data( &( iter->second ) ) ) {
+         if ( attr->extract_data( &( iter->second ), borrow_data ) ) {
             any_attr_received = true;
          }
       } else if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
@@ -3185,10 +4248,193 @@ this attribute.%c",
 
       // Flag for user use to indicate the data changed.
       this->data_changed = true;
+
+      // Consumption latency bookkeeping: one clock read per consumed
+      // reflection, measured against the most recent arrival time stamped
+      // in enqueue_data(). When more than one update was queued since the
+      // last consume this under-reports the latency of the older entries,
+      // which keeps the bookkeeping to a single clock read here.
+      long long const arrival = __atomic_load_n( &this->last_data_arrival_time_us, __ATOMIC_ACQUIRE );
+      if ( arrival > 0 ) {
+         double const latency_ms = (double)( clock_wall_time() - arrival ) * 0.001;
+         if ( latency_ms >= 0.0 ) {
+            consume_latency_stats.sample( latency_ms );
+         }
+      }
    }
    return any_attr_received;
 }
 
+/*!
+ * @details Called from the federate ambassador callbacks with the
+ * user-supplied tag of a received attribute update. Updates from a
+ * publisher that does not have the latency survey enabled carry an empty
+ * tag and are ignored.
+ */
+void Object::record_latency_survey(
+   VariableLengthData const &user_supplied_tag )
+{
+   if ( !this->latency_survey ) {
+      return;
+   }
+
+   double sent_cte_time;
+   if ( !decode_latency_survey_stamp( static_cast< unsigned char const * >( user_supplied_tag.data() ),
+                                      user_supplied_tag.size(),
+                                      sent_cte_time ) ) {
+      return;
+   }
+
+   double const cte_time = get_cte_time();
+   if ( cte_time <= -std::numeric_limits< double >::max() ) {
+      return;
+   }
+
+   // Guard against CTE disagreement between the hosts placing the arrival
+   // before the send.
+   double const delay_ms = ( cte_time - sent_cte_time ) * 1000.0;
+   if ( delay_ms >= 0.0 ) {
+      latency_stats.sample( delay_ms );
+   }
+}
+
+void Object::print_latency_survey()
+{
+   ostringstream msg;
+   msg << "Object::print_latency_survey():" << __LINE__
+       << " Object '" << get_name() << "' one-way latency "
+       << latency_stats.to_string() << THLA_ENDL;
+   send_hs( stdout, msg.str().c_str() );
+}
+
+/*!
+ * @details The age is measured against the wall clock arrival time stamped
+ * in enqueue_data(), so it reflects how long ago the RTI delivered data
+ * for this object regardless of whether that data has been consumed yet.
+ */
+double Object::get_data_age() const
+{
+   long long const arrival = __atomic_load_n( &this->last_data_arrival_time_us, __ATOMIC_ACQUIRE );
+   if ( arrival <= 0 ) {
+      return -1.0;
+   }
+   return (double)( clock_wall_time() - arrival ) * 0.000001;
+}
+
+bool Object::is_data_stale() const
+{
+   if ( this->stale_data_threshold <= 0.0 ) {
+      return false;
+   }
+   return ( get_data_age() > this->stale_data_threshold );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool Object::check_data_staleness()
+{
+   if ( this->stale_data_threshold <= 0.0 ) {
+      return false;
+   }
+   double const age = get_data_age();
+   if ( age <= this->stale_data_threshold ) {
+      return false;
+   }
+   if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stdout, "Object::check_data_staleness():%d Object '%s' data is stale, age:%f seconds exceeds threshold:%f seconds.%c",
+               __LINE__, get_name(), age, stale_data_threshold, THLA_NEWLINE );
+   }
+   if ( stale_data_callback != NULL ) {
+      ( *stale_data_callback )( this, age, stale_data_user_arg );
+   }
+   return true;
+}
+
+namespace
+{
+
+/*! @brief Sort predicate ordering attribute indices by total encoded
+ * bytes, descending. */
+class WireTrafficBytesGreater
+{
+  public:
+   explicit WireTrafficBytesGreater( Attribute const *attrs )
+      : attributes( attrs )
+   {
+      return;
+   }
+
+   bool operator()( int const a, int const b ) const
+   {
+      return ( ( attributes[a].bytes_sent_count + attributes[a].bytes_received_count )
+               > ( attributes[b].bytes_sent_count + attributes[b].bytes_received_count ) );
+   }
+
+  private:
+   Attribute const *attributes; ///< @trick_io{**} Attribute array the indices refer to.
+};
+
+} // namespace
+
+string Object::wire_traffic_to_string()
+{
+   // Collect the attributes with any traffic, sorted by total encoded
+   // bytes so the top talkers lead the report.
+   vector< int > talker_index;
+   for ( int i = 0; i < attr_count; ++i ) {
+      if ( ( attributes[i].updates_sent_count > 0 )
+           || ( attributes[i].updates_received_count > 0 )
+           || ( attributes[i].updates_suppressed_count > 0 ) ) {
+         talker_index.push_back( i );
+      }
+   }
+   sort( talker_index.begin(), talker_index.end(),
+         WireTrafficBytesGreater( attributes ) );
+
+   ostringstream msg;
+   msg << "Object '" << get_name() << "' wire-traffic top talkers:";
+
+   if ( talker_index.empty() ) {
+      msg << " no attribute traffic recorded.";
+      return msg.str();
+   }
+
+   for ( unsigned int n = 0; n < talker_index.size(); ++n ) {
+      Attribute const &attr = attributes[talker_index[n]];
+
+      msg << "\n   '" << attr.get_FOM_name() << "'"
+          << " sent:" << attr.updates_sent_count
+          << " updates/" << attr.bytes_sent_count << " bytes"
+          << " received:" << attr.updates_received_count
+          << " updates/" << attr.bytes_received_count << " bytes";
+
+      // The suppression ratio is of the cyclic send opportunities, which
+      // are the sent updates plus the suppressed ones.
+      long long const send_opportunities = attr.updates_sent_count
+                                           + attr.updates_suppressed_count;
+      if ( attr.updates_suppressed_count > 0 ) {
+         msg << " suppressed:" << attr.updates_suppressed_count
+             << " (" << (int)( ( (double)attr.updates_suppressed_count
+                                 / (double)send_opportunities )
+                               * 100.0 )
+             << "% of send opportunities)";
+      }
+   }
+   return msg.str();
+}
+
+void Object::print_data_freshness_stats()
+{
+   ostringstream msg;
+   msg << "Object::print_data_freshness_stats():" << __LINE__
+       << " Object '" << get_name() << "' update interval "
+       << update_interval_stats.to_string() << THLA_NEWLINE
+       << " Object '" << get_name() << "' consumption latency "
+       << consume_latency_stats.to_string() << THLA_ENDL;
+   send_hs( stdout, msg.str().c_str() );
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -3301,6 +4547,10 @@ void Object::release_ownership()
             }
          }
       }
+
+      // The cached ownership counts are stale now that the divested
+      // attributes are remotely owned.
+      invalidate_ownership_counts();
    } catch ( ObjectInstanceNotKnown const &e ) {
       string rti_err_msg;
       StringUtilities::to_string( rti_err_msg, e.what() );
@@ -3380,13 +4630,40 @@ RTIAmbassador::confirmDivestiture() generated Exception: '%s'%c",
 /*!
  * @job_class{scheduled}
  */
-void Object::pull_ownership()
+void Object::notify_ownership_work_pending()
 {
-   // Just return if we don't have any pull requests or an ownership object.
-   if ( ( ownership == NULL ) || ownership->pull_requests.empty() ) {
+   if ( this->manager == NULL ) {
       return;
    }
-
+   // Register once; the registration is cleared when the manager processes
+   // this object, so an object is never on the pending list twice.
+   if ( !__atomic_exchange_n( &this->ownership_work_registered, true, __ATOMIC_ACQ_REL ) ) {
+      manager->register_ownership_work( this );
+   }
+}
+
+bool Object::is_ownership_work_pending()
+{
+   if ( this->pull_requested || this->divest_requested ) {
+      return true;
+   }
+   if ( ownership != NULL ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &ownership_mutex );
+
+      return ( !ownership->pull_requests.empty() || !ownership->push_requests.empty() );
+   }
+   return false;
+}
+
+void Object::pull_ownership()
+{
+   // Just return if we don't have any pull requests or an ownership object.
+   if ( ( ownership == NULL ) || ownership->pull_requests.empty() ) {
+      return;
+   }
+
    // Make sure we have an Instance ID for the object, otherwise just return.
    if ( !is_instance_handle_valid() ) {
       send_hs( stderr, "Object::pull_ownership():%d Object-Instance-Handle not set for '%s'.%c",
@@ -3414,32 +4691,11 @@ void Object::pull_ownership()
 
    // Use the HLA Federated Logical Time if time management is enabled.
    if ( federate->is_time_management_enabled() ) {
-
-      try {
-         HLAinteger64Time HLAtime;
-         rti_amb->queryLogicalTime( HLAtime );
-         Int64Time fedTime = Int64Time( (int64_t)HLAtime.getTime() );
-
-         // Get the current HLA logical time.
-         current_time = fedTime.get_time_in_seconds();
-      } catch ( FederateNotExecutionMember const &e ) {
-         send_hs( stderr, "Object::pull_ownership():%d EXCEPTION: FederateNotExecutionMember %c", __LINE__, THLA_NEWLINE );
-      } catch ( SaveInProgress const &e ) {
-         send_hs( stderr, "Object::pull_ownership():%d EXCEPTION: SaveInProgress %c", __LINE__, THLA_NEWLINE );
-      } catch ( RestoreInProgress const &e ) {
-         send_hs( stderr, "Object::pull_ownership():%d EXCEPTION: RestoreInProgress %c", __LINE__, THLA_NEWLINE );
-      } catch ( NotConnected const &e ) {
-         send_hs( stderr, "Object::pull_ownership():%d EXCEPTION: NotConnected %c", __LINE__, THLA_NEWLINE );
-      } catch ( RTIinternalError const &e ) {
-         string rti_err_msg;
-         StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::pull_ownership():%d EXCEPTION: RTIinternalError: '%s'.%c",
-                  __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
-      }
-
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      // Use the locally cached HLA granted time, which is what the RTI
+      // would report as the current logical time, instead of paying for a
+      // queryLogicalTime() round trip to the RTI every cycle a request is
+      // pending.
+      current_time = federate->get_granted_time().get_time_in_seconds();
    } else {
       // Use the simulation time for the current time.
       current_time = federate->get_execution_control()->get_sim_time();
@@ -3459,7 +4715,10 @@ void Object::pull_ownership()
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &ownership_mutex );
 
-      // Process the pull requests.
+      // Process the pull requests. The map is ordered by the scheduled pull
+      // time, so the earliest request is at the front and the scan can stop
+      // at the first request that is not due yet instead of walking every
+      // scheduled request each cycle.
       pull_ownership_iter = ownership->pull_requests.begin();
       while ( pull_ownership_iter != ownership->pull_requests.end() ) {
 
@@ -3513,8 +4772,9 @@ owned or is not configured to be published.%c",
             attr_map->clear();
             delete attr_map;
          } else {
-            // Point to the next item in the pull ownership iterator.
-            ++pull_ownership_iter;
+            // The map is time ordered, so no request after this one is due
+            // either and the scan can stop here.
+            break;
          }
       }
 
@@ -3647,6 +4907,10 @@ No attributes Divested since no federate wanted them for object '%s'.%c",
                   }
                }
             }
+
+            // The cached ownership counts are stale now that the divested
+            // attributes are remotely owned.
+            invalidate_ownership_counts();
          }
       } catch ( RTI1516_EXCEPTION const &e ) {
          send_hs( stderr, "Object::grant_pull_request():%d Unable to grant \
@@ -3676,7 +4940,6 @@ void *grant_push_pthread_function(
 {
    Object *pushThreadTHLAObj = static_cast< Object * >( arg );
    pushThreadTHLAObj->grant_push_request();
-   pthread_exit( NULL );
    return ( NULL );
 }
 
@@ -3685,6 +4948,13 @@ void *grant_push_pthread_function(
  */
 void Object::grant_push_request_pthread()
 {
+   // Post the grant job to the persistent worker thread pool instead of
+   // paying for a short-lived thread per ownership transaction.
+   if ( ( manager != NULL ) && manager->post_ownership_job( grant_push_pthread_function, this ) ) {
+      return;
+   }
+
+   // Fall back to a dedicated thread if no pool is available.
    pthread_t push;
 
    int ret = pthread_create( &push, NULL, grant_push_pthread_function, this );
@@ -3813,7 +5083,6 @@ returned from calling negotiated_attribute_ownership_divestiture()%c",
 
       delete divest_thread_args;
    }
-   pthread_exit( NULL );
    return ( NULL );
 }
 
@@ -3925,32 +5194,11 @@ void Object::push_ownership()
 
    // Use the HLA Federated Logical Time if time management is enabled.
    if ( federate->is_time_management_enabled() ) {
-
-      try {
-         HLAinteger64Time HLAtime;
-         rti_amb->queryLogicalTime( HLAtime );
-         Int64Time fedTime = Int64Time( (int64_t)HLAtime.getTime() );
-
-         // Get the current HLA time value.
-         current_time = fedTime.get_time_in_seconds();
-      } catch ( FederateNotExecutionMember const &e ) {
-         send_hs( stderr, "Object::push_ownership():%d EXCEPTION: FederateNotExecutionMember %c", __LINE__, THLA_NEWLINE );
-      } catch ( SaveInProgress const &e ) {
-         send_hs( stderr, "Object::push_ownership():%d EXCEPTION: SaveInProgress %c", __LINE__, THLA_NEWLINE );
-      } catch ( RestoreInProgress const &e ) {
-         send_hs( stderr, "Object::push_ownership():%d EXCEPTION: RestoreInProgress %c", __LINE__, THLA_NEWLINE );
-      } catch ( NotConnected const &e ) {
-         send_hs( stderr, "Object::push_ownership():%d EXCEPTION: NotConnected %c", __LINE__, THLA_NEWLINE );
-      } catch ( RTIinternalError const &e ) {
-         string rti_err_msg;
-         StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::push_ownership():%d EXCEPTION: RTIinternalError: '%s'.%c",
-                  __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
-      }
-
-      // Macro to restore the saved FPU Control Word register value.
-      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
-      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+      // Use the locally cached HLA granted time, which is what the RTI
+      // would report as the current logical time, instead of paying for a
+      // queryLogicalTime() round trip to the RTI every cycle a request is
+      // pending.
+      current_time = federate->get_granted_time().get_time_in_seconds();
    } else {
       // Use the simulation time for the current time.
       current_time = federate->get_execution_control()->get_sim_time();
@@ -3972,7 +5220,10 @@ void Object::push_ownership()
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &ownership_mutex );
 
-      // Process the push requests.
+      // Process the push requests. The map is ordered by the scheduled push
+      // time, so the earliest request is at the front and the scan can stop
+      // at the first request that is not due yet instead of walking every
+      // scheduled request each cycle.
       push_ownership_iter = ownership->push_requests.begin();
       while ( push_ownership_iter != ownership->push_requests.end() ) {
 
@@ -4025,8 +5276,9 @@ owned or is not configured to be published.%c",
             attr_map->clear();
             delete attr_map;
          } else {
-            // Point to the next item in the push iterator.
-            ++push_ownership_iter;
+            // The map is time ordered, so no request after this one is due
+            // either and the scan can stop here.
+            break;
          }
       }
       // Unlock the ownership mutex when auto_unlock_mutex goes out of scope.
@@ -4061,17 +5313,24 @@ for Attributes of object '%s'.%c",
       // function when it is done. This avoids a memory leak.
       divest_thread_args->handle_set = attr_hdl_set;
 
-      pthread_t divest;
-      int       ret = pthread_create( &divest,
-                                      NULL,
-                                      ownership_divestiture_pthread_function,
-                                      divest_thread_args );
-      if ( ret ) {
-         ostringstream errmsg;
-         errmsg << "Object::push_ownership():" << __LINE__
-                << " ERROR: Failed to create ownership divestiture pthread!"
-                << THLA_ENDL;
-         DebugHandler::terminate_with_message( errmsg.str() );
+      // Post the divestiture job to the persistent worker thread pool
+      // instead of paying for a short-lived thread per ownership
+      // transaction, with a dedicated thread as the fallback.
+      if ( ( manager == NULL )
+           || !manager->post_ownership_job( ownership_divestiture_pthread_function,
+                                            divest_thread_args ) ) {
+         pthread_t divest;
+         int       ret = pthread_create( &divest,
+                                         NULL,
+                                         ownership_divestiture_pthread_function,
+                                         divest_thread_args );
+         if ( ret ) {
+            ostringstream errmsg;
+            errmsg << "Object::push_ownership():" << __LINE__
+                   << " ERROR: Failed to create ownership divestiture pthread!"
+                   << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
       }
    }
 }
@@ -4098,12 +5357,153 @@ void Object::restore_ownership_transfer_checkpointed_data()
    }
 }
 
+void Object::reinstate_transient_buffers()
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      attributes[i].reinstate_transient_buffer();
+   }
+}
+
 void Object::set_core_job_cycle_time(
    double const cycle_time )
 {
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       attributes[i].determine_cycle_ratio( cycle_time );
    }
+
+   // The send cycle wheel depends on the attribute cycle ratios.
+   build_send_cycle_wheel();
+
+   // Now that the core job cycle time is known, validate the user configured
+   // send phase offset and convert it to base time for the send data cycle
+   // boundary checks.
+   if ( this->send_phase_offset_time < 0.0 ) {
+      ostringstream errmsg;
+      errmsg << "Object::set_core_job_cycle_time():" << __LINE__
+             << " ERROR: For object '" << get_name_string()
+             << "', the send phase offset time specified ("
+             << setprecision( 18 ) << this->send_phase_offset_time
+             << " seconds) cannot be negative!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } else if ( this->send_phase_offset_time > 0.0 ) {
+      int64_t const cycle_base_time = Int64BaseTime::to_base_time( cycle_time );
+
+      this->send_phase_offset_base_time = Int64BaseTime::to_base_time( this->send_phase_offset_time );
+
+      // The phase offset must land on a core job cycle boundary otherwise
+      // the send data cycle boundary check would never be true.
+      if ( ( cycle_base_time <= 0LL )
+           || ( ( this->send_phase_offset_base_time % cycle_base_time ) != 0LL ) ) {
+         ostringstream errmsg;
+         errmsg << "Object::set_core_job_cycle_time():" << __LINE__
+                << " ERROR: For object '" << get_name_string()
+                << "', the send phase offset time specified ("
+                << setprecision( 18 ) << this->send_phase_offset_time
+                << " seconds) must be an integer multiple of the core job"
+                << " cycle time (" << setprecision( 18 ) << cycle_time
+                << " seconds)!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+}
+
+/*!
+ * @details Buckets the cyclic attributes by their sub-rate cycle ratio so
+ * each data cycle advances one counter per distinct sub-rate instead of one
+ * counter per attribute, and only the attributes that are actually due get
+ * visited. Attributes of the same sub-rate share a bucket and are phase
+ * aligned, which matches how the per-attribute cycle counters start out.
+ * @job_class{initialization}
+ */
+void Object::build_send_cycle_wheel()
+{
+   send_wheel_ratio.clear();
+   send_wheel_count.clear();
+   send_wheel_due.clear();
+   send_wheel_attr_index.clear();
+   send_wheel_bucket_start.clear();
+   send_wheel_everyframe_index.clear();
+   attr_send_bucket.assign( attr_count, -1 );
+
+   // Determine the distinct sub-rate cycle ratios for the cyclic attributes.
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) {
+         int const ratio = attributes[i].get_cycle_ratio();
+         if ( ratio > 1 ) {
+            int bucket = -1;
+            for ( unsigned int b = 0; b < send_wheel_ratio.size(); ++b ) {
+               if ( send_wheel_ratio[b] == ratio ) {
+                  bucket = b;
+                  break;
+               }
+            }
+            if ( bucket < 0 ) {
+               bucket = send_wheel_ratio.size();
+               send_wheel_ratio.push_back( ratio );
+
+               // Start the counter at the ratio so the first data cycle is
+               // due, just like Attribute::determine_cycle_ratio() does for
+               // the per-attribute cycle counters.
+               send_wheel_count.push_back( ratio );
+               send_wheel_due.push_back( 0 );
+            }
+            attr_send_bucket[i] = bucket;
+         } else {
+            send_wheel_everyframe_index.push_back( i );
+         }
+      }
+   }
+
+   // Group the attribute indices by sub-rate bucket.
+   send_wheel_bucket_start.resize( send_wheel_ratio.size() + 1, 0 );
+   for ( unsigned int b = 0; b < send_wheel_ratio.size(); ++b ) {
+      send_wheel_bucket_start[b] = send_wheel_attr_index.size();
+      for ( unsigned int i = 0; i < attr_count; ++i ) {
+         if ( attr_send_bucket[i] == (int)b ) {
+            send_wheel_attr_index.push_back( i );
+         }
+      }
+   }
+   send_wheel_bucket_start[send_wheel_ratio.size()] = send_wheel_attr_index.size();
+
+   this->send_wheel_built = true;
+}
+
+/*!
+ * @details Only call this once per data cycle, it advances the counter of
+ * every sub-rate bucket by one data cycle.
+ * @job_class{scheduled}
+ */
+void Object::advance_send_cycle_wheel()
+{
+   bool any_subrate_due = false;
+   for ( unsigned int b = 0; b < send_wheel_ratio.size(); ++b ) {
+      if ( ++send_wheel_count[b] >= send_wheel_ratio[b] ) {
+         send_wheel_count[b] = 0;
+         send_wheel_due[b]   = 1;
+         any_subrate_due     = true;
+      } else {
+         send_wheel_due[b] = 0;
+      }
+   }
+
+   // Track the elapsed time between the data cycles where sub-rate
+   // attributes came due so the wheel behavior can be verified.
+   if ( any_subrate_due ) {
+      send_wheel_stats.measure();
+   }
+}
+
+bool Object::is_attribute_send_cycle_due(
+   unsigned int const attr_index ) const
+{
+   // Fall back to the per-attribute cycle counter if the send cycle wheel
+   // has not been built yet.
+   if ( !send_wheel_built ) {
+      return attributes[attr_index].is_data_cycle_ready();
+   }
+   int const bucket = attr_send_bucket[attr_index];
+   return ( bucket < 0 ) || ( send_wheel_due[bucket] != 0 );
 }
 
 void Object::set_name(
@@ -4125,12 +5525,89 @@ void Object::set_name(
    }
 }
 
+/*! @brief Compare two attribute index entries by their AttributeHandle.
+ *  @return True if the left entry's handle orders before the right entry's handle.
+ *  @param lhs Left hand side attribute index entry.
+ *  @param rhs Right hand side attribute index entry. */
+static bool attribute_index_compare(
+   std::pair< RTI1516_NAMESPACE::AttributeHandle, Attribute * > const &lhs,
+   std::pair< RTI1516_NAMESPACE::AttributeHandle, Attribute * > const &rhs )
+{
+   return ( lhs.first < rhs.first );
+}
+
 void Object::build_attribute_map()
 {
-   thla_attribute_map.clear();
+   // Build a flat index sorted by AttributeHandle. The index is searched
+   // with a binary search over contiguous memory, which avoids the pointer
+   // chasing cache misses of a tree-map on the receive-side decode path.
+   thla_attribute_index.clear();
+   thla_attribute_index.reserve( attr_count );
    for ( unsigned int i = 0; i < attr_count; ++i ) {
-      thla_attribute_map[attributes[i].get_attribute_handle()] = &attributes[i];
+      thla_attribute_index.push_back( make_pair( attributes[i].get_attribute_handle(), &attributes[i] ) );
    }
+   sort( thla_attribute_index.begin(), thla_attribute_index.end(), attribute_index_compare );
+
+   // Size the requested-update bitmask, one bit per attribute index, before
+   // the FedAmb callback thread can set bits in it.
+   attr_update_request_mask.assign( ( attr_count + 63 ) / 64, 0ULL );
+}
+
+void Object::build_attribute_map(
+   std::vector< unsigned int > const &sorted_order )
+{
+   // Fill the flat index from a handle-sorted order already computed by
+   // another object of this class with the same attribute layout, which
+   // avoids re-sorting the same order once per object instance.
+   thla_attribute_index.clear();
+   thla_attribute_index.reserve( attr_count );
+   for ( unsigned int n = 0; n < sorted_order.size(); ++n ) {
+      unsigned int const i = sorted_order[n];
+      if ( i < attr_count ) {
+         thla_attribute_index.push_back( make_pair( attributes[i].get_attribute_handle(), &attributes[i] ) );
+      }
+   }
+
+   // Size the requested-update bitmask, one bit per attribute index, before
+   // the FedAmb callback thread can set bits in it.
+   attr_update_request_mask.assign( ( attr_count + 63 ) / 64, 0ULL );
+}
+
+/*!
+ * @details Called from a Trick child thread, typically after it has been
+ * pinned to a CPU, so the staging buffers of this object's attributes are
+ * faulted in from that thread and the operating system places the pages on
+ * the thread's NUMA node under the default first-touch placement policy.
+ */
+void Object::first_touch_buffers()
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      attributes[i].first_touch_buffer();
+   }
+
+   // The packing and lag compensation handlers stage their encoded data
+   // through an OpaqueBuffer when they derive from one.
+   OpaqueBuffer *packing_buffer = dynamic_cast< OpaqueBuffer * >( packing );
+   if ( packing_buffer != NULL ) {
+      packing_buffer->first_touch_buffer();
+   }
+   OpaqueBuffer *lag_comp_buffer = dynamic_cast< OpaqueBuffer * >( lag_comp );
+   if ( lag_comp_buffer != NULL ) {
+      lag_comp_buffer->first_touch_buffer();
+   }
+}
+
+std::vector< unsigned int > Object::get_attribute_index_order() const
+{
+   // Translate the handle-sorted Attribute pointers of the flat index back
+   // into attribute array indices, which are valid for any object of this
+   // class with the same attribute layout.
+   std::vector< unsigned int > sorted_order;
+   sorted_order.reserve( thla_attribute_index.size() );
+   for ( unsigned int n = 0; n < thla_attribute_index.size(); ++n ) {
+      sorted_order.push_back( (unsigned int)( thla_attribute_index[n].second - attributes ) );
+   }
+   return sorted_order;
 }
 
 /*! @brief Return a copy of the federate's lookahead time.
@@ -4150,9 +5627,14 @@ Int64Time Object::get_granted_time() const
 Attribute *Object::get_attribute(
    RTI1516_NAMESPACE::AttributeHandle attr_handle )
 {
-   // We use a map with the key being the AttributeHandle for fast lookups.
-   AttributeMap::const_iterator iter = thla_attribute_map.find( attr_handle );
-   return ( ( iter != thla_attribute_map.end() ) ? iter->second : NULL );
+   // Binary search of the flat index sorted by the AttributeHandle.
+   AttributeHandleIndex::const_iterator iter = lower_bound( thla_attribute_index.begin(),
+                                                            thla_attribute_index.end(),
+                                                            make_pair( attr_handle, (Attribute *)NULL ),
+                                                            attribute_index_compare );
+   return ( ( ( iter != thla_attribute_index.end() ) && ( iter->first == attr_handle ) )
+               ? iter->second
+               : NULL );
 }
 
 Attribute *Object::get_attribute(
@@ -4211,33 +5693,58 @@ bool Object::any_attribute_subscribed()
    return false; // No attribute subscribed.
 }
 
-bool Object::any_locally_owned_attribute()
+void Object::refresh_ownership_counts()
 {
+   this->locally_owned_count             = 0;
+   this->locally_owned_published_count   = 0;
+   this->remotely_owned_subscribed_count = 0;
+   locally_owned_published_index.clear();
+   remotely_owned_subscribed_index.clear();
+   remotely_owned_subscribed_attr_handles.clear();
+
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( attributes[i].is_locally_owned() ) {
-         return true;
+         ++locally_owned_count;
+         if ( attributes[i].is_publish() ) {
+            ++locally_owned_published_count;
+            locally_owned_published_index.push_back( i );
+         }
+      } else if ( attributes[i].is_subscribe() ) {
+         ++remotely_owned_subscribed_count;
+         remotely_owned_subscribed_index.push_back( i );
+         remotely_owned_subscribed_attr_handles.insert( attributes[i].get_attribute_handle() );
       }
    }
-   return false; // No attribute locally owned.
+   this->ownership_counts_valid = true;
+}
+
+bool Object::any_locally_owned_attribute()
+{
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   return ( locally_owned_count > 0 );
 }
 
 bool Object::any_locally_owned_published_attribute()
 {
-   for ( int i = 0; i < attr_count; ++i ) {
-      if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
-         return true;
-      }
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
    }
-   return false; // No attribute locally owned and published.
+   return ( locally_owned_published_count > 0 );
 }
 
 bool Object::any_locally_owned_published_attribute(
    DataUpdateEnum const attr_config )
 {
-   for ( int i = 0; i < attr_count; ++i ) {
-      if ( attributes[i].is_locally_owned()
-           && attributes[i].is_publish()
-           && ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) ) {
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   // Only the locally owned and published attributes can match, so only
+   // visit those instead of scanning every attribute.
+   for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+      unsigned int const i = locally_owned_published_index[n];
+      if ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
          return true;
       }
    }
@@ -4248,33 +5755,74 @@ bool Object::any_locally_owned_published_attribute(
 // attribute data ready is determined per cycle.
 bool Object::any_locally_owned_published_cyclic_data_ready_or_requested_attribute()
 {
-   bool any_ready = false;
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
+   // Fall back to the per-attribute cycle counters if the send cycle wheel
+   // has not been built yet.
+   if ( !send_wheel_built ) {
+      bool any_ready = false;
+      for ( unsigned int i = 0; i < attr_count; ++i ) {
+
+         // We must check that a sub-rate is ready for every attribute to make sure
+         // all sub-rate counters get updated correctly.
+         bool data_cycle_ready = attributes[i].check_data_cycle_ready();
+
+         if ( !any_ready
+              && attributes[i].is_locally_owned()
+              && attributes[i].is_publish()
+              && ( attributes[i].is_update_requested()
+                   || ( ( data_cycle_ready
+                          && ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) ) ) ) ) {
+            any_ready = true;
+         }
+      }
+      return any_ready;
+   }
+
+   // One counter per distinct sub-rate instead of one per attribute.
+   advance_send_cycle_wheel();
+
+   // Only visit the cyclic attributes that are due every data cycle.
+   for ( unsigned int n = 0; n < send_wheel_everyframe_index.size(); ++n ) {
+      unsigned int const i = send_wheel_everyframe_index[n];
+      if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
+         return true;
+      }
+   }
 
-      // We must check that a sub-rate is ready for every attribute to make sure
-      // all sub-rate counters get updated correctly.
-      bool data_cycle_ready = attributes[i].check_data_cycle_ready();
+   // Only visit the sub-rate attributes in the buckets that are due.
+   for ( unsigned int b = 0; b < send_wheel_ratio.size(); ++b ) {
+      if ( send_wheel_due[b] != 0 ) {
+         for ( unsigned int n = send_wheel_bucket_start[b]; n < send_wheel_bucket_start[b + 1]; ++n ) {
+            unsigned int const i = send_wheel_attr_index[n];
+            if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
+               return true;
+            }
+         }
+      }
+   }
 
-      if ( !any_ready
-           && attributes[i].is_locally_owned()
-           && attributes[i].is_publish()
-           && ( attributes[i].is_update_requested()
-                || ( ( data_cycle_ready
-                       && ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) ) ) ) ) {
-         any_ready = true;
+   // Requested attribute updates are rare, so this scan of the update
+   // requested flags only runs when no cyclic attribute was due. Only the
+   // locally owned and published attributes can have a pending request.
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+      if ( attributes[locally_owned_published_index[n]].is_update_requested() ) {
+         return true;
       }
    }
-   return any_ready;
+   return false;
 }
 
 bool Object::any_locally_owned_published_zero_lookahead_or_requested_attribute()
 {
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-
-      if ( attributes[i].is_locally_owned()
-           && attributes[i].is_publish()
-           && ( attributes[i].is_update_requested()
-                || ( ( attributes[i].get_configuration() & CONFIG_ZERO_LOOKAHEAD ) == CONFIG_ZERO_LOOKAHEAD ) ) ) {
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+      unsigned int const i = locally_owned_published_index[n];
+      if ( attributes[i].is_update_requested()
+           || ( ( attributes[i].get_configuration() & CONFIG_ZERO_LOOKAHEAD ) == CONFIG_ZERO_LOOKAHEAD ) ) {
          return true;
       }
    }
@@ -4285,30 +5833,59 @@ bool Object::any_locally_owned_published_zero_lookahead_or_requested_attribute()
 // attribute data ready is determined per cycle.
 bool Object::any_locally_owned_published_cyclic_data_ready_attribute()
 {
-   bool any_ready = false;
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
+   // Fall back to the per-attribute cycle counters if the send cycle wheel
+   // has not been built yet.
+   if ( !send_wheel_built ) {
+      bool any_ready = false;
+      for ( unsigned int i = 0; i < attr_count; ++i ) {
 
-      // We must check that a sub-rate is ready for every attribute to make sure
-      // all sub-rate counters get updated correctly.
-      bool data_cycle_ready = attributes[i].check_data_cycle_ready();
+         // We must check that a sub-rate is ready for every attribute to make sure
+         // all sub-rate counters get updated correctly.
+         bool data_cycle_ready = attributes[i].check_data_cycle_ready();
 
-      if ( !any_ready
-           && attributes[i].is_locally_owned()
-           && attributes[i].is_publish()
-           && data_cycle_ready
-           && ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) ) {
-         any_ready = true;
+         if ( !any_ready
+              && attributes[i].is_locally_owned()
+              && attributes[i].is_publish()
+              && data_cycle_ready
+              && ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) ) {
+            any_ready = true;
+         }
       }
+      return any_ready;
    }
-   return any_ready;
+
+   // One counter per distinct sub-rate instead of one per attribute.
+   advance_send_cycle_wheel();
+
+   // Only visit the cyclic attributes that are due every data cycle.
+   for ( unsigned int n = 0; n < send_wheel_everyframe_index.size(); ++n ) {
+      unsigned int const i = send_wheel_everyframe_index[n];
+      if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
+         return true;
+      }
+   }
+
+   // Only visit the sub-rate attributes in the buckets that are due.
+   for ( unsigned int b = 0; b < send_wheel_ratio.size(); ++b ) {
+      if ( send_wheel_due[b] != 0 ) {
+         for ( unsigned int n = send_wheel_bucket_start[b]; n < send_wheel_bucket_start[b + 1]; ++n ) {
+            unsigned int const i = send_wheel_attr_index[n];
+            if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
+               return true;
+            }
+         }
+      }
+   }
+   return false;
 }
 
 bool Object::any_locally_owned_published_requested_attribute()
 {
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-      if ( attributes[i].is_locally_owned()
-           && attributes[i].is_publish()
-           && attributes[i].is_update_requested() ) {
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   for ( unsigned int n = 0; n < locally_owned_published_index.size(); ++n ) {
+      if ( attributes[locally_owned_published_index[n]].is_update_requested() ) {
          return true;
       }
    }
@@ -4317,21 +5894,23 @@ bool Object::any_locally_owned_published_requested_attribute()
 
 bool Object::any_remotely_owned_subscribed_attribute()
 {
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-      if ( attributes[i].is_remotely_owned() && attributes[i].is_subscribe() ) {
-         return true;
-      }
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
    }
-   return false; // No attribute remotely owned and subscribed.
+   return ( remotely_owned_subscribed_count > 0 );
 }
 
 bool Object::any_remotely_owned_subscribed_attribute(
    DataUpdateEnum const attr_config )
 {
-   for ( unsigned int i = 0; i < attr_count; ++i ) {
-      if ( attributes[i].is_remotely_owned()
-           && attributes[i].is_subscribe()
-           && ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) ) {
+   if ( !ownership_counts_valid ) {
+      refresh_ownership_counts();
+   }
+   // Only the remotely owned and subscribed attributes can match, so only
+   // visit those instead of scanning every attribute.
+   for ( unsigned int n = 0; n < remotely_owned_subscribed_index.size(); ++n ) {
+      unsigned int const i = remotely_owned_subscribed_index[n];
+      if ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
          return true;
       }
    }
@@ -4347,10 +5926,107 @@ void Object::pack_requested_attribute_buffers()
    }
 }
 
+namespace
+{
+
+// Per-batch context for fanning the attribute-range codec slices of one
+// wide object across the data job worker threads.
+struct CodecSliceContext {
+   Object        *object;            ///< Object whose attributes are sliced.
+   DataUpdateEnum attr_config;       ///< Attribute configuration to match.
+   bool           include_requested; ///< True to also include requested attributes.
+   unsigned int   slice_count;       ///< Total number of slices.
+};
+
+/*! @brief Data job function to pack one attribute-range slice.
+ *  @param user_data CodecSliceContext for this batch.
+ *  @param obj_index Slice index for this job. */
+void pack_attribute_slice_job(
+   void              *user_data,
+   unsigned int const obj_index )
+{
+   CodecSliceContext *ctx = static_cast< CodecSliceContext * >( user_data );
+   ctx->object->pack_attribute_buffer_slice( ctx->attr_config,
+                                             ctx->include_requested,
+                                             obj_index,
+                                             ctx->slice_count );
+}
+
+/*! @brief Data job function to unpack one attribute-range slice.
+ *  @param user_data CodecSliceContext for this batch.
+ *  @param obj_index Slice index for this job. */
+void unpack_attribute_slice_job(
+   void              *user_data,
+   unsigned int const obj_index )
+{
+   CodecSliceContext *ctx = static_cast< CodecSliceContext * >( user_data );
+   ctx->object->unpack_attribute_buffer_slice( ctx->attr_config,
+                                               obj_index,
+                                               ctx->slice_count );
+}
+
+} // namespace
+
+void Object::pack_attribute_buffer_slice(
+   DataUpdateEnum const attr_config,
+   bool const           include_requested,
+   unsigned int const   slice,
+   unsigned int const   slice_count )
+{
+   unsigned int const len   = ( (unsigned int)attr_count + slice_count - 1 ) / slice_count;
+   unsigned int const start = slice * len;
+   unsigned int const end   = ( ( start + len ) < (unsigned int)attr_count )
+                                 ? ( start + len )
+                                 : (unsigned int)attr_count;
+   for ( unsigned int i = start; i < end; ++i ) {
+      if ( ( include_requested && attributes[i].is_update_requested() )
+           || ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
+         attributes[i].pack_attribute_buffer();
+      }
+   }
+}
+
+void Object::unpack_attribute_buffer_slice(
+   DataUpdateEnum const attr_config,
+   unsigned int const   slice,
+   unsigned int const   slice_count )
+{
+   unsigned int const len   = ( (unsigned int)attr_count + slice_count - 1 ) / slice_count;
+   unsigned int const start = slice * len;
+   unsigned int const end   = ( ( start + len ) < (unsigned int)attr_count )
+                                 ? ( start + len )
+                                 : (unsigned int)attr_count;
+   for ( unsigned int i = start; i < end; ++i ) {
+      if ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
+         attributes[i].unpack_attribute_buffer();
+      }
+   }
+}
+
 void Object::pack_attribute_buffers(
    DataUpdateEnum const attr_config,
    bool const           include_requested )
 {
+   // Partition the encode loop into independent attribute-range slices
+   // across the data job worker threads for a wide object. Each attribute
+   // encodes only into its own buffer, so the slices share no state until
+   // the completion barrier.
+   if ( ( parallel_codec_slices > 1 )
+        && ( (unsigned int)attr_count > parallel_codec_slices )
+        && ( manager != NULL )
+        && ( get_federate() != NULL )
+        && get_federate()->is_data_job_workers_enabled() ) {
+      CodecSliceContext ctx;
+      ctx.object            = this;
+      ctx.attr_config       = attr_config;
+      ctx.include_requested = include_requested;
+      ctx.slice_count       = parallel_codec_slices;
+      get_federate()->execute_object_data_jobs( pack_attribute_slice_job,
+                                                &ctx,
+                                                parallel_codec_slices );
+      return;
+   }
+
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( ( include_requested && attributes[i].is_update_requested() )
            || ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
@@ -4362,6 +6038,23 @@ void Object::pack_attribute_buffers(
 void Object::unpack_attribute_buffers(
    DataUpdateEnum const attr_config )
 {
+   // Partition the decode loop the same way as the encode loop above.
+   if ( ( parallel_codec_slices > 1 )
+        && ( (unsigned int)attr_count > parallel_codec_slices )
+        && ( manager != NULL )
+        && ( get_federate() != NULL )
+        && get_federate()->is_data_job_workers_enabled() ) {
+      CodecSliceContext ctx;
+      ctx.object            = this;
+      ctx.attr_config       = attr_config;
+      ctx.include_requested = false;
+      ctx.slice_count       = parallel_codec_slices;
+      get_federate()->execute_object_data_jobs( unpack_attribute_slice_job,
+                                                &ctx,
+                                                parallel_codec_slices );
+      return;
+   }
+
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
          attributes[i].unpack_attribute_buffer();
@@ -4369,6 +6062,18 @@ void Object::unpack_attribute_buffers(
    }
 }
 
+void Object::unpack_received_init_only_attribute_buffers()
+{
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      // Only decode the initialization-only attributes that actually
+      // received new data, so this adds no decode work on the data
+      // cycles where none arrived.
+      if ( attributes[i].is_initialize_only() && attributes[i].is_received() ) {
+         attributes[i].unpack_attribute_buffer();
+      }
+   }
+}
+
 void Object::set_to_unblocking_cyclic_reads()
 {
    this->blocking_cyclic_read       = false;
@@ -4377,7 +6082,9 @@ void Object::set_to_unblocking_cyclic_reads()
 
 void Object::notify_attribute_ownership_changed()
 {
-   return;
+   // The cached ownership counts are stale now that at least one attribute
+   // changed ownership, recount them lazily on the next ownership query.
+   invalidate_ownership_counts();
 }
 
 void Object::mark_changed()
@@ -4401,13 +6108,13 @@ void Object::mark_unchanged()
    }
 }
 
-void Object::pull_ownership_upon_rejoin()
+unsigned int Object::pull_ownership_upon_rejoin_request()
 {
    // Make sure we have an Instance ID for the object, otherwise just return.
    if ( !is_instance_handle_valid() ) {
-      send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d Object-Instance-Handle not set for '%s'.%c",
+      send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d Object-Instance-Handle not set for '%s'.%c",
                __LINE__, get_name(), THLA_NEWLINE );
-      return;
+      return 0;
    }
 
    // Macro to save the FPU Control Word register value.
@@ -4417,7 +6124,7 @@ void Object::pull_ownership_upon_rejoin()
 
    // We need an RTI ambassador to be able to continue.
    if ( rti_amb == NULL ) {
-      return;
+      return 0;
    }
 
    // The Set of attribute handle to pull ownership of.
@@ -4429,6 +6136,9 @@ void Object::pull_ownership_upon_rejoin()
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &ownership_mutex );
 
+   // Start with an empty completion set for this reacquisition request.
+   rejoin_pull_request_index.clear();
+
    // Force the pull ownership of all attributes....
    for ( unsigned int i = 0; i < attr_count; ++i ) {
 
@@ -4442,42 +6152,47 @@ void Object::pull_ownership_upon_rejoin()
             // attribute handle to the collection for the impending ownership pull.
             attr_hdl_set.insert( attributes[i].get_attribute_handle() );
 
+            // Track this attribute in the completion set so that the grant,
+            // which arrives through the FedAmb ownership acquisition callback
+            // marking the attribute locally owned again, can be detected.
+            rejoin_pull_request_index.push_back( i );
+
             // Turn off the 'locally_owned' flag on this attribute since the RTI
             // just informed us that we do not own this attribute, regardless of
             // what the input.py file may have indicated.
             attributes[i].unmark_locally_owned();
 
             if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::pull_ownership_upon_rejoin():%d \
+               send_hs( stdout, "Object::pull_ownership_upon_rejoin_request():%d \
 Ownership check of Attribute '%s'->'%s' from object '%s' => RTI informed us that we DO NOT own it.%c",
                         __LINE__, get_FOM_name(), attributes[i].get_FOM_name(),
                         get_name(), THLA_NEWLINE );
             }
          }
       } catch ( ObjectInstanceNotKnown const &e ) {
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: ObjectInstanceNotKnown %c",
                   __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
       } catch ( AttributeNotDefined const &e ) {
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: AttributeNotDefined %c",
                   __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
       } catch ( FederateNotExecutionMember const &e ) {
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: FederateNotExecutionMember %c",
                   __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
       } catch ( SaveInProgress const &e ) {
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: SaveInProgress %c",
                   __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
       } catch ( RestoreInProgress const &e ) {
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: RestoreInProgress %c",
                   __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
       } catch ( RTIinternalError const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an RTIinternalError: %s%c",
                   __LINE__, attributes[i].get_FOM_name(), rti_err_msg.c_str(),
                   THLA_NEWLINE );
@@ -4488,16 +6203,20 @@ rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generate
       TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
    }
 
+   // The cached ownership counts could be stale if the RTI informed us that
+   // we no longer own an attribute, recount them on the next ownership query.
+   invalidate_ownership_counts();
+
    // Make the request only if we do have any attributes for which we need to pull ownership.
    if ( attr_hdl_set.empty() ) {
       if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-         send_hs( stdout, "Object::pull_ownership_upon_rejoin():%d No ownership \
+         send_hs( stdout, "Object::pull_ownership_upon_rejoin_request():%d No ownership \
 requests were added for object '%s'.%c",
                   __LINE__, get_name(), THLA_NEWLINE );
       }
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-         send_hs( stdout, "Object::pull_ownership_upon_rejoin():%d Pulling ownership \
+         send_hs( stdout, "Object::pull_ownership_upon_rejoin_request():%d Pulling ownership \
 for Attributes of object '%s'.%c",
                   __LINE__, get_name(), THLA_NEWLINE );
       }
@@ -4512,97 +6231,10 @@ for Attributes of object '%s'.%c",
       } catch ( RTI1516_EXCEPTION const &e ) {
          string rti_err_msg;
          StringUtilities::to_string( rti_err_msg, e.what() );
-         send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
+         send_hs( stderr, "Object::pull_ownership_upon_rejoin_request():%d \
 Unable to pull ownership for the attributes of object '%s' because of error: '%s'%c",
                   __LINE__, get_name(), rti_err_msg.c_str(), THLA_NEWLINE );
       }
-
-      Federate *federate = get_federate();
-
-      int          i;
-      int64_t      wallclock_time;
-      SleepTimeout print_timer( federate->wait_status_time );
-      SleepTimeout sleep_timer;
-
-      // Perform a blocking loop until ownership of all locally owned published
-      // attributes is restored...
-      unsigned int ownership_counter = 0;
-      while ( ownership_counter < attr_hdl_set.size() ) {
-
-         // reset ownership count for this loop through all the attributes
-         ownership_counter = 0;
-
-         for ( i = 0; i < attr_count; ++i ) {
-            try {
-               // IEEE 1516.1-2000 section 7.18
-               if ( attributes[i].is_publish()
-                    && attributes[i].is_locally_owned()
-                    && rti_amb->isAttributeOwnedByFederate( this->instance_handle, attributes[i].get_attribute_handle() ) ) {
-                  ++ownership_counter;
-               }
-            } catch ( ObjectInstanceNotKnown const &e ) {
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: ObjectInstanceNotKnown %c",
-                        __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
-            } catch ( AttributeNotDefined const &e ) {
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s'generated an EXCEPTION: AttributeNotDefined %c",
-                        __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
-            } catch ( FederateNotExecutionMember const &e ) {
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: FederateNotExecutionMember %c",
-                        __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
-            } catch ( SaveInProgress const &e ) {
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: SaveInProgress %c",
-                        __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
-            } catch ( RestoreInProgress const &e ) {
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an EXCEPTION: RestoreInProgress %c",
-                        __LINE__, attributes[i].get_FOM_name(), THLA_NEWLINE );
-            } catch ( RTIinternalError const &e ) {
-               string rti_err_msg;
-               StringUtilities::to_string( rti_err_msg, e.what() );
-               send_hs( stderr, "Object::pull_ownership_upon_rejoin():%d \
-rti_amb->isAttributeOwnedByFederate() call for published attribute '%s' generated an RTIinternalError: %s%c",
-                        __LINE__, attributes[i].get_FOM_name(),
-                        rti_err_msg.c_str(), THLA_NEWLINE );
-            }
-         } // end of 'for' loop
-
-         // Check for shutdown.
-         federate->check_for_shutdown_with_termination();
-
-         sleep_timer.sleep();
-
-         if ( ownership_counter < attr_hdl_set.size() ) {
-
-            // To be more efficient, we get the time once and share it.
-            wallclock_time = sleep_timer.time();
-
-            if ( sleep_timer.timeout( wallclock_time ) ) {
-               sleep_timer.reset();
-               if ( !federate->is_execution_member() ) {
-                  ostringstream errmsg;
-                  errmsg << "Object::pull_ownership_upon_rejoin():" << __LINE__
-                         << " ERROR: Unexpectedly the Federate is no longer an execution member."
-                         << " This means we are either not connected to the"
-                         << " RTI or we are no longer joined to the federation"
-                         << " execution because someone forced our resignation at"
-                         << " the Central RTI Component (CRC) level!"
-                         << THLA_ENDL;
-                  DebugHandler::terminate_with_message( errmsg.str() );
-               }
-            }
-
-            if ( print_timer.timeout( wallclock_time ) ) {
-               print_timer.reset();
-               send_hs( stdout, "Object::pull_ownership_upon_rejoin():%d Pulling ownership \
-for Attributes of object '%s', waiting...%c",
-                        __LINE__, get_name(), THLA_NEWLINE );
-            }
-         }
-      } // end of 'while' loop
    }
 
    // Macro to restore the saved FPU Control Word register value.
@@ -4610,6 +6242,32 @@ for Attributes of object '%s', waiting...%c",
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
    // Unlock the ownership mutex when auto_unlock_mutex goes out of scope.
+
+   return (unsigned int)rejoin_pull_request_index.size();
+}
+
+bool Object::is_pull_ownership_upon_rejoin_complete()
+{
+   // Lock the ownership mutex since we are reading the ownership state that
+   // the FedAmb ownership acquisition callback updates.
+   //
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &ownership_mutex );
+
+   // The FedAmb attributeOwnershipAcquisitionNotification() callback marks
+   // an attribute as locally owned when the RTI grants our reacquisition
+   // request, so the request is complete once every attribute in the
+   // completion set is locally owned again.
+   for ( unsigned int n = 0; n < rejoin_pull_request_index.size(); ++n ) {
+      if ( !attributes[rejoin_pull_request_index[n]].is_locally_owned() ) {
+         return false;
+      }
+   }
+
+   // All the requests have been granted so clear the completion set.
+   rejoin_pull_request_index.clear();
+   return true;
 }
 
 bool Object::is_shutdown_called() const
@@ -4718,3 +6376,19 @@ bool Object::is_thread_associated(
    }
    return ( this->thread_ids_array[thread_id] );
 }
+
+/*! @brief Determine if this object is associated to any Trick child thread.
+ * @return True if associated to a Trick child thread (thread-id > 0). */
+bool Object::is_child_thread_associated()
+{
+   if ( ( this->thread_ids_array_count == 0 ) && ( this->thread_ids != NULL ) ) {
+      // Initialize the array of thread IDs associated to this object.
+      initialize_thread_ID_array();
+   }
+   for ( unsigned int id = 1; id < this->thread_ids_array_count; ++id ) {
+      if ( this->thread_ids_array[id] ) {
+         return true;
+      }
+   }
+   return false;
+}
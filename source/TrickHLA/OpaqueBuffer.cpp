@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AttributeBufferPool.cpp}
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{OpaqueBuffer.cpp}
 @trick_link_dependency{Utilities.cpp}
@@ -33,6 +34,8 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <sstream>
 #include <string>
@@ -45,6 +48,8 @@ NASA, Johnson Space Center\n
 #include "trick/trick_byteswap.h"
 
 // TrickHLA model include files.
+#include "TrickHLA/AllocationTracker.hh"
+#include "TrickHLA/AttributeBufferPool.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/Utilities.hh"
@@ -52,6 +57,9 @@ NASA, Johnson Space Center\n
 using namespace std;
 using namespace TrickHLA;
 
+// Define the static class constants.
+size_t const OpaqueBuffer::BUFFER_BASE_ALIGNMENT;
+
 /*!
  * @job_class{initialization}
  */
@@ -60,7 +68,10 @@ OpaqueBuffer::OpaqueBuffer()
      push_pos( 0 ),
      pull_pos( 0 ),
      capacity( 0 ),
-     buffer( NULL )
+     buffer( NULL ),
+     buffer_base( NULL ),
+     buffer_checkpoint_required( true ),
+     buffer_pooled( false )
 {
    // Default to a buffer capacity of 1 for now just to make sure we have
    // a buffer allocated in Trick managed memory. This allows the buffer to
@@ -74,15 +85,19 @@ OpaqueBuffer::OpaqueBuffer()
  */
 OpaqueBuffer::~OpaqueBuffer() // RETURN: -- None.
 {
-   if ( buffer != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( buffer ) ) ) {
-         send_hs( stderr, "OpaqueBuffer::~OpaqueBuffer():%d ERROR deleting Trick Memory for 'buffer'%c",
+   if ( buffer_base != NULL ) {
+      // Pooled chunks belong to the AttributeBufferPool slab and are not
+      // individually freed.
+      if ( !this->buffer_pooled
+           && trick_MM->delete_var( static_cast< void * >( buffer_base ) ) ) {
+         send_hs( stderr, "OpaqueBuffer::~OpaqueBuffer():%d ERROR deleting Trick Memory for 'buffer_base'%c",
                   __LINE__, THLA_NEWLINE );
       }
-      buffer   = NULL;
-      capacity = 0;
-      push_pos = 0;
-      pull_pos = 0;
+      buffer_base = NULL;
+      buffer      = NULL;
+      capacity    = 0;
+      push_pos    = 0;
+      pull_pos    = 0;
    }
 }
 
@@ -127,28 +142,182 @@ void OpaqueBuffer::ensure_buffer_capacity(
    }
 
    if ( requested_size > capacity ) {
-      capacity = requested_size;
-      if ( buffer == NULL ) {
-         buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", capacity ) );
-      } else {
-         buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( buffer, capacity ) );
+      // Grow the capacity geometrically and keep the high-water mark so
+      // that a steadily growing variable length record settles into a
+      // stable allocation instead of reallocating on every small increase.
+      size_t new_capacity = ( capacity > 0 ) ? capacity : requested_size;
+      while ( new_capacity < requested_size ) {
+         new_capacity *= 2;
       }
+      reallocate_buffer( new_capacity );
    } else if ( buffer == NULL ) {
       // Handle the case where the buffer has not been created yet and we
       // might have an invalid user capacity specified.
 
       // Make sure the capacity is at least the same size as the byte alignment.
-      capacity = ( requested_size >= alignment ) ? requested_size : alignment;
-      buffer   = static_cast< unsigned char   *>( TMM_declare_var_1d( "unsigned char", capacity ) );
+      reallocate_buffer( ( requested_size >= alignment ) ? requested_size : alignment );
+   }
+}
+
+void OpaqueBuffer::reinstate_transient_buffer()
+{
+   if ( this->buffer_pooled ) {
+      // The pooled chunk was allocated outside checkpointed memory, so the
+      // restored pointers are stale. Drop them and rebuild the buffer at
+      // its checkpointed capacity. The contents are transient wire bytes,
+      // so only the capacity needs to be reconstructed.
+      size_t const restored_capacity = ( capacity > 0 ) ? capacity : alignment;
+
+      this->buffer_base   = NULL;
+      this->buffer        = NULL;
+      this->buffer_pooled = false;
+      this->capacity      = 0;
+      ensure_buffer_capacity( restored_capacity );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void OpaqueBuffer::reserve_buffer_capacity(
+   size_t const max_size )
+{
+   size_t requested_size = max_size;
+
+   // Make sure the requested capacity is a multiple of the byte alignment.
+   if ( alignment > 1 ) {
+      size_t pad_size = requested_size % alignment;
+      if ( pad_size > 0 ) {
+         requested_size += pad_size;
+      }
    }
 
-   if ( buffer == NULL ) {
+   // Reserve exactly the declared capacity, with no geometric growth, so a
+   // known maximum data size is allocated just once at initialization.
+   if ( ( requested_size > capacity ) || ( buffer == NULL ) ) {
+      reallocate_buffer( ( requested_size >= alignment ) ? requested_size : alignment );
+   }
+}
+
+/*!
+ * @details Writes one byte per page of the buffer, preserving the byte
+ * value, so the pages are faulted in from the calling thread and the
+ * operating system places them on the calling thread's NUMA node under the
+ * default first-touch placement policy. Only call this when the owning
+ * thread is not concurrently pushing to or pulling from the buffer.
+ */
+void OpaqueBuffer::first_touch_buffer()
+{
+   if ( ( buffer != NULL ) && ( capacity > 0 ) ) {
+      size_t const            page_size = 4096;
+      volatile unsigned char *bytes     = buffer;
+      for ( size_t pos = 0; pos < capacity; pos += page_size ) {
+         bytes[pos] = bytes[pos];
+      }
+      bytes[capacity - 1] = bytes[capacity - 1];
+   }
+}
+
+/*!
+ * @details The base allocation is over-allocated by BUFFER_BASE_ALIGNMENT
+ * bytes so that the buffer start can be placed on a BUFFER_BASE_ALIGNMENT
+ * byte boundary, which enables aligned SIMD loads and stores on the buffer
+ * contents.
+ * @job_class{initialization}
+ */
+void OpaqueBuffer::reallocate_buffer(
+   size_t const new_capacity )
+{
+   bool const   had_buffer   = ( buffer_base != NULL );
+   size_t const old_capacity = this->capacity;
+   size_t const old_offset   = had_buffer ? (size_t)( buffer - buffer_base ) : 0;
+   size_t const base_size    = new_capacity + BUFFER_BASE_ALIGNMENT;
+
+   // The transient buffer mode overrides the per-buffer checkpoint
+   // requirement, keeping the wire buffer out of the Trick checkpoint
+   // regardless of its size.
+   bool const checkpoint_required = this->buffer_checkpoint_required
+                                    && !AttributeBufferPool::is_transient_mode();
+
+   if ( this->buffer_pooled
+        || ( !checkpoint_required
+             && ( AttributeBufferPool::is_transient_mode()
+                  || AttributeBufferPool::is_huge_page_candidate( base_size ) ) ) ) {
+      // Carve the base allocation from the shared pool so a large buffer
+      // that does not need to be checkpointable lands in the huge-page
+      // backed slabs. A pooled chunk cannot be freed or resized in place,
+      // so each growth carves a new chunk and the old one stays with its
+      // slab; the geometric growth in ensure_buffer_capacity() keeps the
+      // number of migrations bounded.
+      unsigned char *new_base = AttributeBufferPool::allocate( base_size, checkpoint_required );
+      if ( new_base != NULL ) {
+         size_t const new_offset = ( BUFFER_BASE_ALIGNMENT - ( (uintptr_t)new_base % BUFFER_BASE_ALIGNMENT ) ) % BUFFER_BASE_ALIGNMENT;
+
+         // Preserve the existing buffer contents.
+         if ( had_buffer && ( old_capacity > 0 ) ) {
+            memcpy( new_base + new_offset, buffer_base + old_offset, old_capacity );
+         }
+
+         // Release the old Trick Memory Manager allocation when migrating
+         // from the TMM path into the pool.
+         if ( had_buffer && !this->buffer_pooled ) {
+            if ( trick_MM->delete_var( static_cast< void * >( buffer_base ) ) ) {
+               send_hs( stderr, "OpaqueBuffer::reallocate_buffer():%d ERROR deleting Trick Memory for 'buffer_base'%c",
+                        __LINE__, THLA_NEWLINE );
+            }
+         }
+
+         this->buffer_base   = new_base;
+         this->buffer_pooled = true;
+         this->buffer        = buffer_base + new_offset;
+         this->capacity      = new_capacity;
+         AllocationTracker::record_resize( AllocationTracker::SUBSYS_OPAQUE_BUFFERS,
+                                           had_buffer ? (long long)old_capacity : 0,
+                                           (long long)new_capacity );
+         return;
+      }
+
+      // The pool could not allocate a slab, which means the Trick Memory
+      // Manager is out of memory too, so fall through to the TMM path for
+      // its error handling. A previously pooled chunk cannot be resized by
+      // the TMM, so start a fresh allocation.
+      if ( this->buffer_pooled ) {
+         this->buffer_base   = NULL;
+         this->buffer_pooled = false;
+      }
+   }
+
+   if ( buffer_base == NULL ) {
+      buffer_base = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", base_size ) );
+   } else {
+      buffer_base = static_cast< unsigned char * >( TMM_resize_array_1d_a( buffer_base, base_size ) );
+   }
+
+   if ( buffer_base == NULL ) {
       ostringstream errmsg;
-      errmsg << "OpaqueBuffer::ensure_buffer_capacity():" << __LINE__
+      errmsg << "OpaqueBuffer::reallocate_buffer():" << __LINE__
              << " ERROR: Could not allocate memory for buffer for requested"
-             << " capacity " << capacity << "!" << THLA_ENDL;
+             << " capacity " << new_capacity << "!" << THLA_ENDL;
       DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   // Place the buffer start on the alignment boundary within the base
+   // allocation.
+   size_t const new_offset = ( BUFFER_BASE_ALIGNMENT - ( (uintptr_t)buffer_base % BUFFER_BASE_ALIGNMENT ) ) % BUFFER_BASE_ALIGNMENT;
+
+   // A resize preserves the base allocation contents, but the alignment
+   // offset can change when the allocation moves, so shift the existing
+   // buffer contents over to the new offset.
+   if ( had_buffer && ( old_capacity > 0 ) && ( new_offset != old_offset ) ) {
+      memmove( buffer_base + new_offset, buffer_base + old_offset, old_capacity );
    }
+
+   this->buffer   = buffer_base + new_offset;
+   this->capacity = new_capacity;
+   AllocationTracker::record_resize( AllocationTracker::SUBSYS_OPAQUE_BUFFERS,
+                                     had_buffer ? (long long)old_capacity : 0,
+                                     (long long)new_capacity );
 }
 
 void OpaqueBuffer::push_to_buffer(
@@ -156,11 +325,17 @@ void OpaqueBuffer::push_to_buffer(
    size_t const       size,
    EncodingEnum const encoding )
 {
+#ifdef THLA_ELIDE_HOT_PATH_CHECKS
+   // The size comes from the attribute type configuration, which does not
+   // change in steady state, so only validate it in a debug build.
+   assert( size > 0 );
+#else
    if ( size == 0 ) {
       send_hs( stderr, "OpaqueBuffer::push_to_buffer():%d WARNING: Unexpected zero number of bytes to push into buffer!%c",
                __LINE__, THLA_NEWLINE );
       return;
    }
+#endif
 
    // Determine if we need to add pad bytes to achieve the desired
    // byte alignment.
@@ -183,6 +358,13 @@ void OpaqueBuffer::push_to_buffer(
       ensure_buffer_capacity( push_pos + size );
    }
 
+#ifdef THLA_ELIDE_HOT_PATH_CHECKS
+   // The encoding is a per-field configuration constant, so only validate
+   // it in a debug build.
+   assert( ( encoding == ENCODING_LITTLE_ENDIAN )
+           || ( encoding == ENCODING_BIG_ENDIAN )
+           || ( encoding == ENCODING_NONE ) );
+#else
    // Display a warning if an unsupported encoding is used.
    if ( ( encoding != ENCODING_LITTLE_ENDIAN ) && ( encoding != ENCODING_BIG_ENDIAN ) && ( encoding != ENCODING_NONE ) ) {
       ostringstream errmsg;
@@ -193,6 +375,7 @@ void OpaqueBuffer::push_to_buffer(
              << ", or ENCODING_NONE:" << ENCODING_NONE << THLA_ENDL;
       send_hs( stderr, errmsg.str().c_str() );
    }
+#endif
 
    // Copy the source data into the buffer and do a byte-swap if needed.
    byteswap_buffer_copy( &buffer[push_pos], src, size, encoding );
@@ -210,11 +393,17 @@ void OpaqueBuffer::pull_from_buffer(
    size_t const       size,
    EncodingEnum const encoding )
 {
+#ifdef THLA_ELIDE_HOT_PATH_CHECKS
+   // The size comes from the attribute type configuration, which does not
+   // change in steady state, so only validate it in a debug build.
+   assert( size > 0 );
+#else
    if ( size == 0 ) {
       send_hs( stderr, "OpaqueBuffer::pull_from_buffer():%d WARNING: Unexpected zero number of bytes to pull from buffer!%c",
                __LINE__, THLA_NEWLINE );
       return;
    }
+#endif
 
    // Determine if we need to remove pad bytes which were added to achieve the
    // desired byte alignment.
@@ -235,6 +424,13 @@ void OpaqueBuffer::pull_from_buffer(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+#ifdef THLA_ELIDE_HOT_PATH_CHECKS
+   // The encoding is a per-field configuration constant, so only validate
+   // it in a debug build.
+   assert( ( encoding == ENCODING_LITTLE_ENDIAN )
+           || ( encoding == ENCODING_BIG_ENDIAN )
+           || ( encoding == ENCODING_NONE ) );
+#else
    // Display a warning if an unsupported encoding is used.
    if ( ( encoding != ENCODING_LITTLE_ENDIAN ) && ( encoding != ENCODING_BIG_ENDIAN ) && ( encoding != ENCODING_NONE ) ) {
       ostringstream errmsg;
@@ -245,6 +441,7 @@ void OpaqueBuffer::pull_from_buffer(
              << ", or ENCODING_NONE:" << ENCODING_NONE << THLA_ENDL;
       send_hs( stderr, errmsg.str().c_str() );
    }
+#endif
 
    // Copy the data from the buffer into the destination and do a byte-swap
    // if needed.
@@ -254,6 +451,210 @@ void OpaqueBuffer::pull_from_buffer(
    pull_pos += size;
 }
 
+/*!
+ * @job_class{initialization}
+ */
+void OpaqueBuffer::add_buffer_field(
+   size_t const       offset,
+   size_t const       element_size,
+   size_t const       element_count,
+   EncodingEnum const encoding )
+{
+   // The element size must be one of the scalar sizes the byteswap code
+   // supports so that the pack/unpack loops stay tight per-type loops.
+   if ( ( element_size != 1 ) && ( element_size != 2 )
+        && ( element_size != 4 ) && ( element_size != 8 ) ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::add_buffer_field():" << __LINE__
+             << " ERROR: Unsupported 'element_size' " << element_size
+             << " for the field at offset " << offset << ". It must be one"
+             << " of 1, 2, 4, or 8 bytes!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( element_count == 0 ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::add_buffer_field():" << __LINE__
+             << " ERROR: Unexpected zero 'element_count' for the field at"
+             << " offset " << offset << "!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( encoding != ENCODING_LITTLE_ENDIAN ) && ( encoding != ENCODING_BIG_ENDIAN ) && ( encoding != ENCODING_NONE ) ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::add_buffer_field():" << __LINE__
+             << " ERROR: Unsupported 'encoding' " << encoding << " for the"
+             << " field at offset " << offset << ". It must be one of"
+             << " ENCODING_LITTLE_ENDIAN:" << ENCODING_LITTLE_ENDIAN
+             << ", ENCODING_BIG_ENDIAN:" << ENCODING_BIG_ENDIAN
+             << ", or ENCODING_NONE:" << ENCODING_NONE << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   BufferField field;
+   field.offset        = offset;
+   field.element_size  = element_size;
+   field.element_count = element_count;
+   field.encoding      = encoding;
+
+   // Determine once at registration time if the field needs a transmission
+   // byteswap, single byte elements never do.
+   field.byteswap = ( element_size > 1 ) && Utilities::is_transmission_byteswap( encoding );
+
+   buffer_fields.push_back( field );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void OpaqueBuffer::clear_buffer_fields()
+{
+   buffer_fields.clear();
+}
+
+size_t OpaqueBuffer::calculate_buffer_fields_size() const
+{
+   size_t total_size = 0;
+   for ( size_t i = 0; i < buffer_fields.size(); ++i ) {
+      // Account for the pad bytes added to achieve the desired byte
+      // alignment, using the same padding the push_to_buffer() API uses.
+      if ( alignment > 1 ) {
+         total_size += total_size % alignment;
+      }
+      total_size += buffer_fields[i].element_size * buffer_fields[i].element_count;
+   }
+   return total_size;
+}
+
+void OpaqueBuffer::pack_buffer_fields(
+   void const *base_address )
+{
+   if ( buffer_fields.empty() ) {
+      send_hs( stderr, "OpaqueBuffer::pack_buffer_fields():%d WARNING: No buffer fields have been registered!%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   // One capacity check for the whole descriptor table.
+   size_t const total_size = calculate_buffer_fields_size();
+   if ( total_size > capacity ) {
+      ensure_buffer_capacity( total_size );
+   }
+
+   unsigned char const *base = static_cast< unsigned char const * >( base_address );
+
+   size_t pos = 0;
+   for ( size_t i = 0; i < buffer_fields.size(); ++i ) {
+      BufferField const &field = buffer_fields[i];
+
+      // Determine if we need to add pad bytes to achieve the desired
+      // byte alignment.
+      if ( alignment > 1 ) {
+         size_t const pad_size = pos % alignment;
+         if ( pad_size > 0 ) {
+            memset( &buffer[pos], '\0', pad_size );
+            pos += pad_size;
+         }
+      }
+
+      unsigned char const *src        = base + field.offset;
+      unsigned char       *dest       = &buffer[pos];
+      size_t const         field_size = field.element_size * field.element_count;
+
+      // Copy the field data into the buffer with a tight per-type loop.
+      if ( !field.byteswap ) {
+         memcpy( dest, src, field_size );
+      } else {
+         switch ( field.element_size ) {
+            case 2: {
+               Utilities::byteswap_2_byte_array( dest, src, field.element_count );
+               break;
+            }
+            case 4: {
+               Utilities::byteswap_4_byte_array( dest, src, field.element_count );
+               break;
+            }
+            case 8:
+            default: {
+               Utilities::byteswap_8_byte_array( dest, src, field.element_count );
+               break;
+            }
+         }
+      }
+      pos += field_size;
+   }
+
+   // Leave the push position at the end of the packed fields so that any
+   // additional push_to_buffer() calls append after the descriptor data.
+   push_pos = pos;
+}
+
+void OpaqueBuffer::unpack_buffer_fields(
+   void *base_address )
+{
+   if ( buffer_fields.empty() ) {
+      send_hs( stderr, "OpaqueBuffer::unpack_buffer_fields():%d WARNING: No buffer fields have been registered!%c",
+               __LINE__, THLA_NEWLINE );
+      return;
+   }
+
+   // One capacity check for the whole descriptor table.
+   size_t const total_size = calculate_buffer_fields_size();
+   if ( total_size > capacity ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::unpack_buffer_fields():" << __LINE__
+             << " ERROR: Trying to unpack " << total_size << " bytes of field"
+             << " data from the buffer, which exceeds the end of the buffer"
+             << " by " << ( total_size - capacity ) << " bytes!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   unsigned char *base = static_cast< unsigned char * >( base_address );
+
+   size_t pos = 0;
+   for ( size_t i = 0; i < buffer_fields.size(); ++i ) {
+      BufferField const &field = buffer_fields[i];
+
+      // Determine if we need to remove pad bytes which were added to
+      // achieve the desired byte alignment.
+      if ( alignment > 1 ) {
+         size_t const pad_size = pos % alignment;
+         if ( pad_size > 0 ) {
+            pos += pad_size;
+         }
+      }
+
+      unsigned char const *src        = &buffer[pos];
+      unsigned char       *dest       = base + field.offset;
+      size_t const         field_size = field.element_size * field.element_count;
+
+      // Copy the data from the buffer into the field with a tight
+      // per-type loop.
+      if ( !field.byteswap ) {
+         memcpy( dest, src, field_size );
+      } else {
+         switch ( field.element_size ) {
+            case 2: {
+               Utilities::byteswap_2_byte_array( dest, src, field.element_count );
+               break;
+            }
+            case 4: {
+               Utilities::byteswap_4_byte_array( dest, src, field.element_count );
+               break;
+            }
+            case 8:
+            default: {
+               Utilities::byteswap_8_byte_array( dest, src, field.element_count );
+               break;
+            }
+         }
+      }
+      pos += field_size;
+   }
+
+   // Leave the pull position at the end of the unpacked fields so that any
+   // additional pull_from_buffer() calls continue after the descriptor data.
+   pull_pos = pos;
+}
+
 void OpaqueBuffer::push_pad_to_buffer(
    size_t const pad_size )
 {
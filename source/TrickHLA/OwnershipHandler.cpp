@@ -278,6 +278,12 @@ void OwnershipHandler::restore_requests()
          }
       }
    }
+
+   // Get the object onto the manager's pending ownership work list for the
+   // restored requests.
+   if ( ( pull_items_cnt > 0 ) || ( push_items_cnt > 0 ) ) {
+      object->notify_ownership_work_pending();
+   }
 }
 
 void OwnershipHandler::initialize_callback(
@@ -390,6 +396,9 @@ void OwnershipHandler::pull_ownership(
       // Add the attribute to the map.
       attr_map->insert( make_pair( key, &attributes[i] ) );
    }
+
+   // Get the object onto the manager's pending ownership work list.
+   object->notify_ownership_work_pending();
 }
 
 void OwnershipHandler::pull_ownership( // RETURN: -- None.
@@ -441,6 +450,9 @@ void OwnershipHandler::pull_ownership(
 
    // Add the attribute to the map.
    attr_map->insert( make_pair( key, attribute ) );
+
+   // Get the object onto the manager's pending ownership work list.
+   object->notify_ownership_work_pending();
 }
 
 void OwnershipHandler::push_ownership()
@@ -493,6 +505,9 @@ void OwnershipHandler::push_ownership(
       // Add the attribute to the map.
       attr_map->insert( make_pair( key, &attributes[i] ) );
    }
+
+   // Get the object onto the manager's pending ownership work list.
+   object->notify_ownership_work_pending();
 }
 
 void OwnershipHandler::push_ownership(
@@ -544,6 +559,9 @@ void OwnershipHandler::push_ownership(
 
    // Add the attribute to the map.
    attr_map->insert( make_pair( key, attribute ) );
+
+   // Get the object onto the manager's pending ownership work list.
+   object->notify_ownership_work_pending();
 }
 
 /*!
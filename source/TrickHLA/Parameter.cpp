@@ -18,6 +18,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{MetadataStringPool.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
@@ -52,8 +53,11 @@ NASA, Johnson Space Center\n
 #include "trick/trick_byteswap.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Federate.hh"
 #include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/MetadataStringPool.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/StringUtilities.hh"
 #include "TrickHLA/Types.hh"
@@ -82,13 +86,17 @@ Parameter::Parameter()
      buffer( NULL ),
      buffer_capacity( 0 ),
      size_is_static( true ),
+     dynamic_primitive_array( false ),
      size( 0 ),
      num_items( 0 ),
      value_changed( false ),
+     unpack_pending( false ),
      byteswap( false ),
      address( NULL ),
      attr( NULL ),
-     interaction_FOM_name( NULL )
+     interaction_FOM_name( NULL ),
+     cached_decode_address( NULL ),
+     cached_decode_items( 0 )
 {
    // The value is set based on the Endianness of this computer.
    // HLAtrue is a value of 1 on a Big Endian computer.
@@ -101,6 +109,13 @@ Parameter::Parameter()
  */
 Parameter::~Parameter()
 {
+   // Fast teardown: the process is exiting and the operating system
+   // reclaims the memory in bulk, so skip the per-buffer Trick memory
+   // free.
+   if ( Federate::is_fast_teardown_active() ) {
+      return;
+   }
+
    if ( buffer != NULL ) {
       if ( trick_MM->delete_var( static_cast< void * >( buffer ) ) ) {
          send_hs( stderr, "Parameter::~Parameter():%d ERROR deleting Trick Memory for 'buffer'%c",
@@ -110,13 +125,9 @@ Parameter::~Parameter()
       buffer_capacity = 0;
    }
 
-   if ( interaction_FOM_name != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( interaction_FOM_name ) ) ) {
-         send_hs( stderr, "Parameter::~Parameter():%d ERROR deleting Trick Memory for 'interaction_FOM_name'%c",
-                  __LINE__, THLA_NEWLINE );
-      }
-      interaction_FOM_name = NULL;
-   }
+   // The interaction FOM name is interned in the shared MetadataStringPool
+   // and is not individually freed.
+   interaction_FOM_name = NULL;
 }
 
 /*!
@@ -190,7 +201,7 @@ void Parameter::initialize(
 
       address              = ref2->address;
       attr                 = ref2->attr;
-      interaction_FOM_name = trick_MM->mm_strdup( const_cast< char * >( interaction_fom_name ) );
+      interaction_FOM_name = MetadataStringPool::intern( interaction_fom_name );
 
       // Free the memory used by ref2.
       free( ref2 );
@@ -226,7 +237,7 @@ void Parameter::initialize(
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
-   interaction_FOM_name = trick_MM->mm_strdup( const_cast< char * >( interaction_fom_name ) );
+   interaction_FOM_name = MetadataStringPool::intern( interaction_fom_name );
 
    complete_initialization();
 }
@@ -238,6 +249,24 @@ void Parameter::complete_initialization()
 {
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+   // Intern the metadata name strings in the shared deduplicated pool and
+   // release the per-parameter allocations, so the common names across
+   // many interaction instances are stored exactly once.
+   char *interned_name = MetadataStringPool::intern( FOM_name );
+   if ( ( interned_name != NULL ) && ( interned_name != FOM_name ) ) {
+      if ( trick_MM->get_alloc_info_at( static_cast< void * >( FOM_name ) ) != NULL ) {
+         trick_MM->delete_var( static_cast< void * >( FOM_name ) );
+      }
+      FOM_name = interned_name;
+   }
+   interned_name = MetadataStringPool::intern( trick_name );
+   if ( ( interned_name != NULL ) && ( interned_name != trick_name ) ) {
+      if ( trick_MM->get_alloc_info_at( static_cast< void * >( trick_name ) ) != NULL ) {
+         trick_MM->delete_var( static_cast< void * >( trick_name ) );
+      }
+      trick_name = interned_name;
+   }
+
    // Verify that the rti_encoding value is valid given the ref-attributes type.
    switch ( attr->type ) {
       case TRICK_BOOLEAN: {
@@ -478,6 +507,24 @@ void Parameter::complete_initialization()
    // Get the parameter size and number of items.
    calculate_size_and_number_of_items();
 
+   // Classify a primitive pointer array whose length is only known at run
+   // time, and seed the decode size plan with the current allocation so
+   // that repeated decodes do not re-derive the allocation size from the
+   // Trick memory manager.
+   this->dynamic_primitive_array = !size_is_static
+                                   && ( ( rti_encoding == ENCODING_BIG_ENDIAN )
+                                        || ( rti_encoding == ENCODING_LITTLE_ENDIAN )
+                                        || ( rti_encoding == ENCODING_UNKNOWN ) )
+                                   && ( attr->type != TRICK_STRING )
+                                   && ( attr->type != TRICK_CHARACTER )
+                                   && ( attr->type != TRICK_UNSIGNED_CHARACTER )
+                                   && ( attr->num_index > 0 )
+                                   && ( attr->index[attr->num_index - 1].size == 0 );
+   if ( dynamic_primitive_array ) {
+      this->cached_decode_address = *( static_cast< void ** >( address ) );
+      this->cached_decode_items   = num_items;
+   }
+
    // Ensure enough buffer capacity for the parameter.
    ensure_buffer_capacity( size );
 
@@ -547,6 +594,27 @@ VariableLengthData Parameter::get_encoded_parameter_value()
    return VariableLengthData( buffer, size );
 }
 
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The filled in parameter value only references the internal encode
+ *   buffer and does not copy it, so the parameter value must be handed to
+ *   the RTI before the next send packs the buffer again.
+ */
+void Parameter::get_encoded_parameter_value(
+   VariableLengthData &param_value )
+{
+   // Pack the parameter buffer to encode the parameter.
+   pack_parameter_buffer();
+   if ( rti_encoding == ENCODING_BOOLEAN ) {
+      // The size is the number of 1-byte bool values in c++ and we need to
+      // map to a 4-byte HLAboolean type. The buffer already holds the
+      // encoded HLAboolean type.
+      param_value.setDataPointer( buffer, 4 * size );
+   } else {
+      param_value.setDataPointer( buffer, size );
+   }
+}
+
 bool Parameter::extract_data(
    size_t const         param_size,
    unsigned char const *param_data )
@@ -557,8 +625,12 @@ bool Parameter::extract_data(
    }
 
    // Determine the number of bytes we expect to receive based on how much
-   // memory the Trick simulation variable is using.
-   size_t expected_byte_count = get_parameter_size();
+   // memory the Trick simulation variable is using. For a dynamic primitive
+   // array the sender determines the element count, so skip the memory
+   // manager size lookup and treat the received size as the expected size.
+   size_t expected_byte_count = dynamic_primitive_array
+                                   ? param_size
+                                   : get_parameter_size();
 
    switch ( rti_encoding ) {
       case ENCODING_BOOLEAN: {
@@ -689,6 +761,27 @@ bool Parameter::extract_data(
          break;
       }
       default: {
+         // For a dynamic primitive array only require the received data to
+         // hold a whole number of elements, since the array is sized to the
+         // received data when it is decoded.
+         if ( dynamic_primitive_array
+              && ( attr->size > 0 )
+              && ( ( param_size % attr->size ) != 0 ) ) {
+            ostringstream errmsg;
+            errmsg << "Parameter::extract_data():"
+                   << __LINE__ << " WARNING: For Parameter '" << interaction_FOM_name
+                   << "'->'" << FOM_name << "' with Trick name '" << trick_name
+                   << "', the received FOM data size (" << param_size << " bytes) is"
+                   << " not a whole multiple of the " << attr->size << " byte element"
+                   << " size of the simulation variable array. Make sure your"
+                   << " simulation variable is the same type as what is defined in"
+                   << " the FOM." << THLA_ENDL;
+            send_hs( stderr, errmsg.str().c_str() );
+
+            // For now, we ignore this error by just returning here.
+            return false;
+         }
+
          if ( ( attr->type != TRICK_STRING )
               && ( param_size != expected_byte_count )
               && ( rti_encoding != ENCODING_UNICODE_STRING ) ) {
@@ -733,6 +826,11 @@ from parameter map, buffer-size:%d, expected-byte-count:%d.%c",
    // Mark the parameter value as changed.
    mark_changed();
 
+   // The received data now sits encoded in the buffer until it is decoded
+   // by unpack_parameter_buffer(), either eagerly for the whole interaction
+   // or lazily on first access per parameter.
+   this->unpack_pending = true;
+
    return true;
 }
 
@@ -740,12 +838,16 @@ void Parameter::ensure_buffer_capacity(
    size_t capacity )
 {
    if ( capacity > buffer_capacity ) {
+      size_t const old_capacity = buffer_capacity;
+
       buffer_capacity = capacity;
       if ( buffer == NULL ) {
          buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", buffer_capacity ) );
       } else {
          buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( buffer, buffer_capacity ) );
       }
+      AllocationTracker::record_resize( AllocationTracker::SUBSYS_PARAMETER_BUFFERS,
+                                        (long long)old_capacity, (long long)buffer_capacity );
    } else if ( buffer == NULL ) {
       // Handle the case where the buffer has not been created yet and we
       // might have an invalid capacity specified.
@@ -754,6 +856,8 @@ void Parameter::ensure_buffer_capacity(
       buffer_capacity = ( capacity > 0 ) ? capacity : 1;
 
       buffer = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", buffer_capacity ) );
+      AllocationTracker::record_alloc( AllocationTracker::SUBSYS_PARAMETER_BUFFERS,
+                                       (long long)buffer_capacity );
    }
 
    if ( buffer == NULL ) {
@@ -932,6 +1036,72 @@ void Parameter::calculate_static_number_of_items()
    this->num_items = length;
 }
 
+/*!
+ * @details On a receive the byte count in 'size' is authoritative, so the
+ * number of items is derived from it directly instead of re-reading the
+ * allocation size of the simulation variable from the Trick memory manager
+ * for every decode. The cached allocation capacity is only refreshed when
+ * the array address no longer matches the cached decode size plan, and the
+ * allocation is only resized when the received data does not fit the
+ * existing capacity, which lets steady state updates reuse the existing
+ * Trick allocation.
+ * @job_class{scheduled}
+ */
+void Parameter::update_dynamic_array_for_decode()
+{
+   // The number of items is driven by the received byte count.
+   if ( attr->size > 0 ) {
+      this->num_items = size / attr->size;
+   } else {
+      // Punt and set the number of items to equal the number of bytes.
+      this->num_items = size;
+   }
+
+   char *array_addr = *( static_cast< char ** >( address ) );
+
+   // Refresh the cached capacity if the simulation variable was reallocated
+   // since the decode size plan was last updated.
+   if ( ( array_addr != cached_decode_address ) && ( array_addr != NULL ) ) {
+      this->cached_decode_address = array_addr;
+      this->cached_decode_items   = get_size( array_addr );
+   }
+
+   // Fast path: the received data fits the existing allocation, so reuse
+   // the allocation as is.
+   if ( ( array_addr != NULL ) && ( num_items <= cached_decode_items ) ) {
+      return;
+   }
+
+   // Resize the allocation to fit the received data.
+   // WORKAROUND: Trick 10 can't handle a length of zero so to work
+   // around the memory manager problem use a size of 1 in the
+   // allocation.
+   if ( array_addr != NULL ) {
+      *( static_cast< char ** >( address ) ) =
+         static_cast< char * >( TMM_resize_array_1d_a(
+            *( static_cast< char ** >( address ) ),
+            ( ( num_items > 0 ) ? num_items : 1 ) ) );
+   } else {
+      // Allocate memory for the array.
+      *( static_cast< char ** >( address ) ) =
+         static_cast< char * >( TMM_declare_var_1d(
+            attr->type_name, ( ( num_items > 0 ) ? num_items : 1 ) ) );
+   }
+
+   if ( *( static_cast< char ** >( address ) ) == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Parameter::update_dynamic_array_for_decode():" << __LINE__
+             << " ERROR: Could not allocate memory for Parameter '"
+             << FOM_name << "' with Trick name '" << trick_name
+             << "' and length " << num_items << "!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Update the decode size plan to match the new allocation.
+   this->cached_decode_address = *( static_cast< void ** >( address ) );
+   this->cached_decode_items   = ( num_items > 0 ) ? num_items : 1;
+}
+
 void Parameter::pack_parameter_buffer()
 {
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_PARAMETER ) ) {
@@ -1212,7 +1382,14 @@ void Parameter::unpack_parameter_buffer()
 
             // Determine the number of items this parameter has (i.e. is it an array).
             if ( !size_is_static ) {
-               calculate_size_and_number_of_items();
+               if ( dynamic_primitive_array ) {
+                  // The received size is authoritative for a decode, so use
+                  // the cached size plan and only resize the array when the
+                  // received data does not fit the existing allocation.
+                  update_dynamic_array_for_decode();
+               } else {
+                  calculate_size_and_number_of_items();
+               }
             }
 
             // Determine if the users variable is a pointer.
@@ -1283,6 +1460,9 @@ void Parameter::unpack_parameter_buffer()
       }
       send_hs( stdout, msg.str().c_str() );
    }
+
+   // The buffer contents have been decoded into the simulation variable.
+   this->unpack_pending = false;
 }
 
 void Parameter::encode_boolean_to_buffer()
@@ -1751,11 +1931,9 @@ void Parameter::encode_string_to_buffer()
                // Get the length of the string.
                size_t length = strlen( s );
 
-               // Encode as UTF-16 characters in Big Endian
-               for ( size_t k = 0; k < length; ++k ) {
-                  *( output++ ) = '\0';
-                  *( output++ ) = (unsigned char)*( s++ );
-               }
+               // Encode as UTF-16 characters in Big Endian.
+               Utilities::ascii_to_utf16_be( output, s, length );
+               output += 2 * length;
                byte_count += 2 * length;
             }
 
@@ -1832,11 +2010,9 @@ void Parameter::encode_string_to_buffer()
                byte_count += 4;
 
                if ( s != NULL ) {
-                  // Encode as UTF-16 characters in Big Endian
-                  for ( size_t k = 0; k < length; ++k ) {
-                     *( output++ ) = '\0';
-                     *( output++ ) = (unsigned char)*( s++ );
-                  }
+                  // Encode as UTF-16 characters in Big Endian.
+                  Utilities::ascii_to_utf16_be( output, s, length );
+                  output += 2 * length;
                   byte_count += 2 * length;
                }
 
@@ -2354,10 +2530,8 @@ size %d, will use the data buffer size instead.%c",
             } else {
 
                // Decode the UTF-16 characters.
-               for ( size_t k = 0; k < length; ++k ) {
-                  input++; // skip the high-character of the UTF-16 encoding
-                  output[k] = *( input++ );
-               }
+               Utilities::utf16_be_to_ascii( output, input, length );
+               input += 2 * length;
 
                // Add the terminating null character '\0';
                output[length] = '\0';
@@ -2505,10 +2679,8 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                } else {
 
                   // Decode the UTF-16 characters.
-                  for ( size_t k = 0; k < length; ++k ) {
-                     input++; // skip the high-character of the UTF-16 encoding
-                     output[k] = *( input++ );
-                  }
+                  Utilities::utf16_be_to_ascii( output, input, length );
+                  input += 2 * length;
 
                   // Add the terminating null character '\0';
                   output[length] = '\0';
@@ -3174,9 +3346,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                d_dest[0] = Utilities::byteswap_double( d_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  d_dest[k] = Utilities::byteswap_double( d_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( d_dest, d_src, length );
             }
             break;
          }
@@ -3187,9 +3357,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                f_dest[0] = Utilities::byteswap_float( f_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  f_dest[k] = Utilities::byteswap_float( f_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( f_dest, f_src, length );
             }
             break;
          }
@@ -3206,9 +3374,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                s_dest[0] = Utilities::byteswap_short( s_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  s_dest[k] = Utilities::byteswap_short( s_src[k] );
-               }
+               Utilities::byteswap_2_byte_array( s_dest, s_src, length );
             }
             break;
          }
@@ -3218,9 +3384,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                us_dest[0] = Utilities::byteswap_unsigned_short( us_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  us_dest[k] = Utilities::byteswap_unsigned_short( us_src[k] );
-               }
+               Utilities::byteswap_2_byte_array( us_dest, us_src, length );
             }
             break;
          }
@@ -3230,9 +3394,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                i_dest[0] = Utilities::byteswap_int( i_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  i_dest[k] = Utilities::byteswap_int( i_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( i_dest, i_src, length );
             }
             break;
          }
@@ -3242,9 +3404,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                ui_dest[0] = Utilities::byteswap_unsigned_int( ui_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ui_dest[k] = Utilities::byteswap_unsigned_int( ui_src[k] );
-               }
+               Utilities::byteswap_4_byte_array( ui_dest, ui_src, length );
             }
             break;
          }
@@ -3254,8 +3414,10 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                l_dest[0] = Utilities::byteswap_long( l_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  l_dest[k] = Utilities::byteswap_long( l_src[k] );
+               if ( sizeof( long ) == 8 ) {
+                  Utilities::byteswap_8_byte_array( l_dest, l_src, length );
+               } else {
+                  Utilities::byteswap_4_byte_array( l_dest, l_src, length );
                }
             }
             break;
@@ -3266,8 +3428,10 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                ul_dest[0] = Utilities::byteswap_unsigned_long( ul_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ul_dest[k] = Utilities::byteswap_unsigned_long( ul_src[k] );
+               if ( sizeof( long ) == 8 ) {
+                  Utilities::byteswap_8_byte_array( ul_dest, ul_src, length );
+               } else {
+                  Utilities::byteswap_4_byte_array( ul_dest, ul_src, length );
                }
             }
             break;
@@ -3278,9 +3442,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                ll_dest[0] = Utilities::byteswap_long_long( ll_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ll_dest[k] = Utilities::byteswap_long_long( ll_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( ll_dest, ll_src, length );
             }
             break;
          }
@@ -3290,9 +3452,7 @@ void Parameter::byteswap_buffer_copy(
             if ( length == 1 ) {
                ull_dest[0] = Utilities::byteswap_unsigned_long_long( ull_src[0] );
             } else {
-               for ( size_t k = 0; k < length; ++k ) {
-                  ull_dest[k] = Utilities::byteswap_unsigned_long_long( ull_src[k] );
-               }
+               Utilities::byteswap_8_byte_array( ull_dest, ull_src, length );
             }
             break;
          }
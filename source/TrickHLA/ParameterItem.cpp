@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{Item.cpp}
 @trick_link_dependency{ParameterItem.cpp}
+@trick_link_dependency{ReceiveBufferPool.cpp}
 
 @revs_title
 @revs_begin
@@ -30,6 +31,7 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <cstdlib>
 #include <cstring>
+#include <new>
 #include <iostream>
 #include <sstream>
 
@@ -41,11 +43,48 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/Item.hh"
+#include "TrickHLA/ItemPool.hh"
 #include "TrickHLA/ParameterItem.hh"
+#include "TrickHLA/ReceiveBufferPool.hh"
 
 using namespace std;
 using namespace TrickHLA;
 
+// Fixed-size pool backing the class level new/delete operators below. Each
+// received interaction allocates one ParameterItem per decoded parameter.
+#define THLA_PARAMETER_ITEM_POOL_COUNT 4096
+
+/*! @brief Get the ParameterItem pool, constructed on first use.
+ *  @return Reference to the ParameterItem pool. */
+static ItemPool &parameter_item_pool()
+{
+   static ItemPool pool( sizeof( ParameterItem ), THLA_PARAMETER_ITEM_POOL_COUNT );
+   return pool;
+}
+
+void *ParameterItem::operator new(
+   std::size_t size )
+{
+   // Only pool exactly sized allocations, a derived class goes to the heap.
+   if ( size == sizeof( ParameterItem ) ) {
+      void *ptr = parameter_item_pool().allocate();
+      if ( ptr != NULL ) {
+         return ptr;
+      }
+   }
+   // The pool is exhausted or this is a derived class.
+   return ::operator new( size );
+}
+
+void ParameterItem::operator delete(
+   void *ptr )
+{
+   // Recycle pooled items, anything else came from the heap.
+   if ( ( ptr != NULL ) && !parameter_item_pool().deallocate( ptr ) ) {
+      ::operator delete( ptr );
+   }
+}
+
 /*!
 @job_class{initialization}
 */
@@ -68,12 +107,18 @@ ParameterItem::ParameterItem(
      data( NULL )
 {
    if ( param_value != NULL ) {
-      // Put the user supplied tag into a buffer.
+      // Put the encoded parameter value into a buffer. Recycle a buffer
+      // from the size-classed receive pool when one fits so this per
+      // callback path is allocation-free at steady state, otherwise fall
+      // back to a Trick Memory Manager allocation as before.
       size = param_value->size();
       if ( size == 0 ) {
          data = NULL;
       } else {
-         data = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", size ) );
+         data = ReceiveBufferPool::allocate( size );
+         if ( data == NULL ) {
+            data = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", size ) );
+         }
          memcpy( data, param_value->data(), size );
       }
    }
@@ -90,8 +135,13 @@ ParameterItem::~ParameterItem()
 void ParameterItem::clear()
 {
    if ( data != NULL ) {
-      if ( trick_MM->delete_var( static_cast< void * >( data ) ) ) {
-         send_hs( stderr, "ParameterItem::clear():%d ERROR deleting Trick Memory for 'data'\n", __LINE__ );
+      // Recycle pooled buffers back onto their size-class free list.
+      // Anything else (a pool fall back or a checkpoint-restored buffer)
+      // is Trick Memory Manager allocated.
+      if ( !ReceiveBufferPool::deallocate( data ) ) {
+         if ( trick_MM->delete_var( static_cast< void * >( data ) ) ) {
+            send_hs( stderr, "ParameterItem::clear():%d ERROR deleting Trick Memory for 'data'\n", __LINE__ );
+         }
       }
       data  = NULL;
       size  = 0;
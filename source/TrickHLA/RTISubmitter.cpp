@@ -0,0 +1,321 @@
+/*!
+@file TrickHLA/RTISubmitter.cpp
+@ingroup TrickHLA
+@brief A single-submitter proxy for the outbound RTI data calls.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{Int64Time.cpp}
+@trick_link_dependency{RTISubmitter.cpp}
+@trick_link_dependency{Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+// System include files.
+#include <pthread.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Int64BaseTime.hh"
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/RTISubmitter.hh"
+#include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Utilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+RTISubmitter::RTISubmitter()
+   : in_flight( false ),
+     thread_created( false ),
+     shutdown_requested( false )
+{
+   pthread_mutex_init( &mutex, NULL );
+   pthread_cond_init( &work_available, NULL );
+   pthread_cond_init( &queue_drained, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+RTISubmitter::~RTISubmitter()
+{
+   shutdown();
+   pthread_cond_destroy( &queue_drained );
+   pthread_cond_destroy( &work_available );
+   pthread_mutex_destroy( &mutex );
+}
+
+void RTISubmitter::post_attribute_update(
+   RTIambassador                 *rti_amb,
+   ObjectInstanceHandle const    &instance_handle,
+   AttributeHandleValueMap const &attribute_values,
+   RTI1516_USERDATA const        &tag,
+   bool const                     with_timestamp,
+   Int64Time const               &update_time,
+   char const                    *source_name )
+{
+   Submission submission;
+   submission.is_interaction   = false;
+   submission.rti_amb          = rti_amb;
+   submission.instance_handle  = instance_handle;
+   submission.attribute_values = attribute_values;
+   submission.tag              = tag;
+   submission.with_timestamp   = with_timestamp;
+   submission.time             = update_time;
+   submission.source_name      = ( ( source_name != NULL ) ? source_name : "" );
+
+   post( submission );
+}
+
+void RTISubmitter::post_interaction(
+   RTIambassador                 *rti_amb,
+   InteractionClassHandle const  &class_handle,
+   ParameterHandleValueMap const &parameter_values,
+   RTI1516_USERDATA const        &tag,
+   bool const                     with_timestamp,
+   Int64Time const               &send_time,
+   char const                    *source_name )
+{
+   Submission submission;
+   submission.is_interaction   = true;
+   submission.rti_amb          = rti_amb;
+   submission.class_handle     = class_handle;
+   submission.parameter_values = parameter_values;
+   submission.tag              = tag;
+   submission.with_timestamp   = with_timestamp;
+   submission.time             = send_time;
+   submission.source_name      = ( ( source_name != NULL ) ? source_name : "" );
+
+   post( submission );
+}
+
+/*!
+ * @details The submitter thread is created on the first post so an unused
+ * submitter costs nothing.
+ */
+void RTISubmitter::post(
+   Submission &submission )
+{
+   pthread_mutex_lock( &mutex );
+
+   if ( this->shutdown_requested ) {
+      pthread_mutex_unlock( &mutex );
+      return;
+   }
+
+   // Lazily create the dedicated submitter thread on the first post.
+   if ( !this->thread_created ) {
+      create_thread();
+   }
+
+   // Swap the record in so the encoded value maps are not copied again.
+   this->submission_queue.push_back( Submission() );
+   this->submission_queue.back().is_interaction = submission.is_interaction;
+   this->submission_queue.back().rti_amb        = submission.rti_amb;
+   this->submission_queue.back().instance_handle = submission.instance_handle;
+   this->submission_queue.back().class_handle    = submission.class_handle;
+   this->submission_queue.back().attribute_values.swap( submission.attribute_values );
+   this->submission_queue.back().parameter_values.swap( submission.parameter_values );
+   this->submission_queue.back().tag            = submission.tag;
+   this->submission_queue.back().with_timestamp = submission.with_timestamp;
+   this->submission_queue.back().time           = submission.time;
+   this->submission_queue.back().source_name.swap( submission.source_name );
+
+   pthread_cond_signal( &work_available );
+   pthread_mutex_unlock( &mutex );
+}
+
+void RTISubmitter::flush()
+{
+   pthread_mutex_lock( &mutex );
+   while ( ( !this->submission_queue.empty() || this->in_flight )
+           && this->thread_created
+           && !this->shutdown_requested ) {
+      pthread_cond_wait( &queue_drained, &mutex );
+   }
+   pthread_mutex_unlock( &mutex );
+}
+
+/*!
+ * @details The caller must hold the submitter mutex.
+ */
+void RTISubmitter::create_thread()
+{
+   int const ret = pthread_create( &this->thread, NULL,
+                                   submitter_entry, this );
+   if ( ret != 0 ) {
+      ostringstream errmsg;
+      errmsg << "RTISubmitter::create_thread():" << __LINE__
+             << " ERROR: Failed to create the RTI submitter thread,"
+             << " pthread_create() returned " << ret << "!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->thread_created = true;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void RTISubmitter::shutdown()
+{
+   pthread_mutex_lock( &mutex );
+   if ( !this->thread_created ) {
+      this->shutdown_requested = true;
+      pthread_mutex_unlock( &mutex );
+      return;
+   }
+   this->shutdown_requested = true;
+   pthread_cond_broadcast( &work_available );
+   pthread_cond_broadcast( &queue_drained );
+   pthread_mutex_unlock( &mutex );
+
+   pthread_join( this->thread, NULL );
+
+   pthread_mutex_lock( &mutex );
+   this->thread_created = false;
+   pthread_mutex_unlock( &mutex );
+}
+
+void *RTISubmitter::submitter_entry(
+   void *arg )
+{
+   static_cast< RTISubmitter * >( arg )->submitter_loop();
+   return NULL;
+}
+
+/*!
+ * @details The queued submissions are drained even when a shutdown was
+ * requested so posted updates always reach the RTI. Each queued batch is
+ * handed to the RTI ambassador back-to-back without releasing the
+ * ambassador between calls, which keeps the RTI's internal lock warm for
+ * this thread instead of contended across the Trick child threads.
+ */
+void RTISubmitter::submitter_loop()
+{
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   vector< Submission > batch;
+
+   while ( true ) {
+
+      pthread_mutex_lock( &mutex );
+
+      this->in_flight = false;
+      if ( this->submission_queue.empty() ) {
+         pthread_cond_broadcast( &queue_drained );
+      }
+      while ( this->submission_queue.empty() && !this->shutdown_requested ) {
+         pthread_cond_wait( &work_available, &mutex );
+      }
+      if ( this->submission_queue.empty() && this->shutdown_requested ) {
+         pthread_mutex_unlock( &mutex );
+         break;
+      }
+
+      // Take the whole queued batch so the submissions go out back-to-back.
+      batch.swap( this->submission_queue );
+      this->in_flight = true;
+
+      pthread_mutex_unlock( &mutex );
+
+      for ( unsigned int i = 0; i < batch.size(); ++i ) {
+         submit( batch[i] );
+      }
+      batch.clear();
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+void RTISubmitter::submit(
+   Submission const &submission )
+{
+   try {
+      if ( submission.is_interaction ) {
+         // This call returns an event retraction handle but we don't
+         // support event retraction so no need to store it.
+         if ( submission.with_timestamp ) {
+            submission.rti_amb->sendInteraction( submission.class_handle,
+                                                 submission.parameter_values,
+                                                 submission.tag,
+                                                 submission.time.get() );
+         } else {
+            submission.rti_amb->sendInteraction( submission.class_handle,
+                                                 submission.parameter_values,
+                                                 submission.tag );
+         }
+      } else {
+         // This call returns an event retraction handle but we don't
+         // support event retraction so no need to store it.
+         if ( submission.with_timestamp ) {
+            submission.rti_amb->updateAttributeValues( submission.instance_handle,
+                                                       submission.attribute_values,
+                                                       submission.tag,
+                                                       submission.time.get() );
+         } else {
+            submission.rti_amb->updateAttributeValues( submission.instance_handle,
+                                                       submission.attribute_values,
+                                                       submission.tag );
+         }
+      }
+   } catch ( InvalidLogicalTime const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "RTISubmitter::submit():" << __LINE__
+             << " InvalidLogicalTime exception for '" << submission.source_name
+             << "'  time=" << submission.time.get_time_in_seconds() << " ("
+             << submission.time.get_base_time() << " " << Int64BaseTime::get_units()
+             << ") error message:'" << rti_err_msg << "'" << THLA_ENDL;
+      send_hs( stderr, errmsg.str().c_str() );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "RTISubmitter::submit():%d %s '%s' with exception '%s'%c",
+               __LINE__,
+               ( submission.is_interaction ? "Interaction" : "Attribute update for" ),
+               submission.source_name.c_str(), rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+}
@@ -0,0 +1,122 @@
+/*!
+@file TrickHLA/ReceiveBufferPool.cpp
+@ingroup TrickHLA
+@brief Implementation of the size-classed recycling pool for the
+receive-side payload buffers.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ItemPool.cpp}
+@trick_link_dependency{ReceiveBufferPool.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+
+// TrickHLA include files.
+#include "TrickHLA/ItemPool.hh"
+#include "TrickHLA/ReceiveBufferPool.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Size classes for the receive payload buffers. The user-supplied tags
+// are usually small and the parameter payloads are the encoded parameter
+// values, so the classes span a few bytes up to tens of kilobytes. Each
+// class is backed by its own fixed-size ItemPool slab so each has its own
+// lock and the classes do not contend with each other. The slab counts
+// are sized for the worst case number of in-flight buffers per class
+// between two processing cycles, with smaller buffers expected to be far
+// more numerous.
+#define THLA_RECEIVE_BUFFER_CLASS_COUNT 6
+
+static size_t const receive_buffer_class_sizes[THLA_RECEIVE_BUFFER_CLASS_COUNT] = {
+   32, 128, 512, 2048, 8192, 32768
+};
+
+static size_t const receive_buffer_class_counts[THLA_RECEIVE_BUFFER_CLASS_COUNT] = {
+   4096, 2048, 1024, 512, 128, 32
+};
+
+/*! @brief Get the pool backing the given size class, constructed on first use.
+ *  @return Reference to the size class pool.
+ *  @param class_index Size class index. */
+static ItemPool &receive_buffer_class_pool( int const class_index )
+{
+   static ItemPool pool_0( receive_buffer_class_sizes[0], receive_buffer_class_counts[0] );
+   static ItemPool pool_1( receive_buffer_class_sizes[1], receive_buffer_class_counts[1] );
+   static ItemPool pool_2( receive_buffer_class_sizes[2], receive_buffer_class_counts[2] );
+   static ItemPool pool_3( receive_buffer_class_sizes[3], receive_buffer_class_counts[3] );
+   static ItemPool pool_4( receive_buffer_class_sizes[4], receive_buffer_class_counts[4] );
+   static ItemPool pool_5( receive_buffer_class_sizes[5], receive_buffer_class_counts[5] );
+
+   switch ( class_index ) {
+      case 0:
+         return pool_0;
+      case 1:
+         return pool_1;
+      case 2:
+         return pool_2;
+      case 3:
+         return pool_3;
+      case 4:
+         return pool_4;
+      default:
+         return pool_5;
+   }
+}
+
+/*!
+ * @details Pick the smallest size class that fits the requested size and
+ * pop a buffer from its free list. Returns NULL when the request is
+ * larger than the largest size class or the fitting class is exhausted,
+ * in which case the caller falls back to a Trick Memory Manager
+ * allocation exactly as before the pool existed.
+ */
+unsigned char *ReceiveBufferPool::allocate(
+   size_t const size )
+{
+   for ( int c = 0; c < THLA_RECEIVE_BUFFER_CLASS_COUNT; ++c ) {
+      if ( size <= receive_buffer_class_sizes[c] ) {
+         return static_cast< unsigned char * >( receive_buffer_class_pool( c ).allocate() );
+      }
+   }
+   return NULL;
+}
+
+/*!
+ * @details Each size class pool knows its own slab address range, so the
+ * buffer is offered to each class in turn and recycled by the one that
+ * owns it. Returns false for buffers that did not come from any of the
+ * slabs (i.e. the Trick Memory Manager fall back allocations and the
+ * checkpoint-restored buffers), which the caller needs to free itself.
+ */
+bool ReceiveBufferPool::deallocate(
+   void *data )
+{
+   if ( data == NULL ) {
+      return false;
+   }
+   for ( int c = 0; c < THLA_RECEIVE_BUFFER_CLASS_COUNT; ++c ) {
+      if ( receive_buffer_class_pool( c ).deallocate( data ) ) {
+         return true;
+      }
+   }
+   return false;
+}
@@ -16,8 +16,6 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{ReflectedAttributesQueue.cpp}
-@trick_link_dependency{MutexLock.cpp}
-@trick_link_dependency{MutexProtection.cpp}
 
 @revs_title
 @revs_begin
@@ -28,11 +26,13 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <atomic>
+#include <utility>
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationTracker.hh"
 #include "TrickHLA/ReflectedAttributesQueue.hh"
-#include "TrickHLA/MutexLock.hh"
-#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/Utilities.hh"
 
 using namespace std;
 using namespace RTI1516_NAMESPACE;
@@ -42,10 +42,15 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 ReflectedAttributesQueue::ReflectedAttributesQueue()
-   : queue_mutex(),
-     attribute_map_queue()
+   : head( 0 ),
+     tail( 0 ),
+     overflow_policy( QUEUE_OVERFLOW_BLOCK_PRODUCER ),
+     high_water_mark( 0 ),
+     dropped_count( 0 )
 {
-   return;
+   for ( size_t i = 0; i < QUEUE_CAPACITY; ++i ) {
+      slot_bytes[i] = 0;
+   }
 }
 
 /*!
@@ -54,60 +59,108 @@ ReflectedAttributesQueue::ReflectedAttributesQueue()
  */
 ReflectedAttributesQueue::~ReflectedAttributesQueue()
 {
-   // Empty the queue without using a queue_mutex lock.
-   while ( !attribute_map_queue.empty() ) {
-      attribute_map_queue.pop();
-   }
-
-   // Make sure we destroy the queue_mutex.
-   queue_mutex.destroy();
+   // Empty the queue, no thread coordination needed at shutdown.
+   clear();
 }
 
 bool ReflectedAttributesQueue::empty()
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &queue_mutex );
-
-   return attribute_map_queue.empty();
+   // The queue is empty when the consumer has caught up to the producer.
+   return ( head.load( memory_order_acquire ) == tail.load( memory_order_acquire ) );
 }
 
+/*!
+ * @details Only call this function from the single producer thread (the
+ * FedAmb callback thread). If the ring is full the overflow policy is
+ * applied: the default QUEUE_OVERFLOW_BLOCK_PRODUCER policy busy-waits for
+ * the consumer to free up a slot, any other policy discards the incoming
+ * reflection and counts the drop, because on this lock-free ring the
+ * producer must not touch slots already published to the consumer.
+ */
 void ReflectedAttributesQueue::push(
-   AttributeHandleValueMap const &theAttributes )
+   AttributeHandleValueMap &theAttributes )
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &queue_mutex );
+   size_t const t = tail.load( memory_order_relaxed );
+
+   if ( ( t - head.load( memory_order_acquire ) ) >= QUEUE_CAPACITY ) {
+
+      if ( overflow_policy != QUEUE_OVERFLOW_BLOCK_PRODUCER ) {
+         // Discard the incoming reflection, leaving the callers map empty
+         // just like the moved-from state of a successful push, and count
+         // the drop so stalled consumers show up in the queue telemetry.
+         theAttributes.clear();
+         dropped_count.fetch_add( 1, memory_order_relaxed );
+         return;
+      }
+
+      // Wait for a free slot if the consumer has fallen QUEUE_CAPACITY
+      // reflections behind the producer.
+      while ( ( t - head.load( memory_order_acquire ) ) >= QUEUE_CAPACITY ) {
+         Utilities::micro_sleep( 10 );
+      }
+   }
 
-   attribute_map_queue.push( theAttributes );
+   // Account the encoded bytes this reflection adds to the queue.
+   size_t byte_count = 0;
+   for ( AttributeHandleValueMap::const_iterator iter = theAttributes.begin();
+         iter != theAttributes.end();
+         ++iter ) {
+      byte_count += iter->second.size();
+   }
+   slot_bytes[t & ( QUEUE_CAPACITY - 1 )] = byte_count;
+   AllocationTracker::record_alloc( AllocationTracker::SUBSYS_REFLECTED_QUEUES,
+                                    (long long)byte_count );
+
+   // Move the attribute map into the ring slot so the attribute values are
+   // not copied, then publish the slot to the consumer by advancing the
+   // tail index. The callers map is left empty.
+   ring[t & ( QUEUE_CAPACITY - 1 )] = std::move( theAttributes );
+   tail.store( t + 1, memory_order_release );
+
+   // Track the deepest the ring has been. Only the producer writes the
+   // high-water mark so a plain load and store is safe.
+   size_t const depth = ( t + 1 ) - head.load( memory_order_relaxed );
+   if ( depth > high_water_mark.load( memory_order_relaxed ) ) {
+      high_water_mark.store( depth, memory_order_relaxed );
+   }
 }
 
+/*!
+ * @details Only call this function from the single consumer thread (the
+ * Trick simulation thread).
+ */
 void ReflectedAttributesQueue::pop()
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &queue_mutex );
-
-   attribute_map_queue.pop();
+   size_t const h = head.load( memory_order_relaxed );
+
+   if ( h != tail.load( memory_order_acquire ) ) {
+      // Release the attribute map memory held by the slot by move-assigning
+      // an empty map, then free up the slot by advancing the head index.
+      ring[h & ( QUEUE_CAPACITY - 1 )] = AttributeHandleValueMap();
+      AllocationTracker::record_free( AllocationTracker::SUBSYS_REFLECTED_QUEUES,
+                                      (long long)slot_bytes[h & ( QUEUE_CAPACITY - 1 )] );
+      slot_bytes[h & ( QUEUE_CAPACITY - 1 )] = 0;
+      head.store( h + 1, memory_order_release );
+   }
 }
 
-AttributeHandleValueMap const &ReflectedAttributesQueue::front()
+/*!
+ * @details Only call this function from the single consumer thread (the
+ * Trick simulation thread). The returned reference is valid until the next
+ * pop() or clear() call.
+ */
+AttributeHandleValueMap &ReflectedAttributesQueue::front()
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &queue_mutex );
-
-   AttributeHandleValueMap const &theAttributes = attribute_map_queue.front();
-   return theAttributes;
+   return ring[head.load( memory_order_relaxed ) & ( QUEUE_CAPACITY - 1 )];
 }
 
+/*!
+ * @details Only call this function from the single consumer thread (the
+ * Trick simulation thread).
+ */
 void ReflectedAttributesQueue::clear()
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &queue_mutex );
-
-   while ( !attribute_map_queue.empty() ) {
-      attribute_map_queue.pop();
+   while ( !empty() ) {
+      pop();
    }
 }
@@ -0,0 +1,287 @@
+/*!
+@file TrickHLA/SendPacer.cpp
+@ingroup TrickHLA
+@brief This class paces the send-side RTI calls of a data cycle frame with a
+token bucket so the frame's update burst is spread across a configured
+fraction of the frame instead of leaving the host back-to-back.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ElapsedTimeStats.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{SendPacer.cpp}
+@trick_link_dependency{Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/SendPacer.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Out of class definitions for the in class initialized static constants.
+int64_t const SendPacer::BURST_WINDOW_MICROS;
+int64_t const SendPacer::PACING_SLEEP_MICROS;
+
+/*!
+ * @job_class{initialization}
+ */
+SendPacer::SendPacer()
+   : enabled( false ),
+     frame_fraction( 0.5 ),
+     burst_tokens( 4.0 ),
+     mutex(),
+     frame_active( false ),
+     frame_count( 0 ),
+     tokens( 0.0 ),
+     refill_rate( 0.0 ),
+     last_refill_time( 0 ),
+     arrival_window_start( 0 ),
+     arrival_window_calls( 0 ),
+     arrival_frame_peak( 0 ),
+     release_window_start( 0 ),
+     release_window_calls( 0 ),
+     release_frame_peak( 0 ),
+     frame_call_count( 0 ),
+     frame_wait_time( 0 ),
+     total_call_count( 0 ),
+     profiled_frame_count( 0 ),
+     arrival_peak_sum( 0.0 ),
+     arrival_peak_max( 0 ),
+     release_peak_sum( 0.0 ),
+     release_peak_max( 0 ),
+     wait_time_stats()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SendPacer::~SendPacer()
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SendPacer::begin_frame(
+   double const       frame_time,
+   unsigned int const expected_calls )
+{
+   if ( !this->enabled ) {
+      return;
+   }
+
+   int64_t const time = clock_wall_time(); // in microseconds
+
+   mutex.lock();
+
+   // Close out the burst profile of the previous frame, which ends where
+   // the new frame begins.
+   if ( this->frame_active ) {
+      close_frame();
+   }
+
+   // Clamp the configured pacing window fraction to (0, 1].
+   double fraction = this->frame_fraction;
+   if ( ( fraction <= 0.0 ) || ( fraction > 1.0 ) ) {
+      fraction = 1.0;
+   }
+
+   // Size the token refill rate so the expected calls are spread across the
+   // pacing window. A degenerate frame time disables the throttle for the
+   // frame by leaving the refill rate at one token per sleep increment.
+   double const window = frame_time * fraction * 1000000.0; // in microseconds
+   if ( ( window > 0.0 ) && ( expected_calls > 0 ) ) {
+      this->refill_rate = (double)expected_calls / window;
+   } else {
+      this->refill_rate = 1.0 / (double)PACING_SLEEP_MICROS;
+   }
+
+   // Start the frame with a full bucket, at least one call deep.
+   this->tokens           = ( this->burst_tokens < 1.0 ) ? 1.0 : this->burst_tokens;
+   this->last_refill_time = time;
+
+   this->frame_active         = true;
+   this->arrival_window_start = time;
+   this->arrival_window_calls = 0;
+   this->arrival_frame_peak   = 0;
+   this->release_window_start = time;
+   this->release_window_calls = 0;
+   this->release_frame_peak   = 0;
+   this->frame_call_count     = 0;
+   this->frame_wait_time      = 0;
+   ++this->frame_count;
+
+   mutex.unlock();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SendPacer::acquire()
+{
+   if ( !this->enabled || !this->frame_active ) {
+      return;
+   }
+
+   int64_t const arrival_time = clock_wall_time(); // in microseconds
+   int64_t       time         = arrival_time;
+
+   mutex.lock();
+
+   // Record when the call wanted to leave, which is the un-paced demand
+   // profile the pacing is flattening.
+   record_burst( time, arrival_window_start, arrival_window_calls, arrival_frame_peak );
+
+   refill( time );
+
+   // Wait for a token, sleeping with the mutex released so the concurrent
+   // send jobs are not serialized behind this wait.
+   while ( this->tokens < 1.0 ) {
+      mutex.unlock();
+      Utilities::micro_sleep( PACING_SLEEP_MICROS );
+      time = clock_wall_time();
+      mutex.lock();
+      refill( time );
+   }
+   this->tokens -= 1.0;
+
+   // Record when the call actually left, which is the achieved profile.
+   record_burst( time, release_window_start, release_window_calls, release_frame_peak );
+
+   ++this->frame_call_count;
+   this->frame_wait_time += ( time - arrival_time );
+
+   mutex.unlock();
+}
+
+/*!
+ * @details Called with the mutex held.
+ */
+void SendPacer::refill(
+   int64_t const time )
+{
+   if ( time > this->last_refill_time ) {
+      this->tokens += this->refill_rate * (double)( time - this->last_refill_time );
+
+      // Cap the bucket so idle time does not bank an unbounded burst.
+      double const depth = ( this->burst_tokens < 1.0 ) ? 1.0 : this->burst_tokens;
+      if ( this->tokens > depth ) {
+         this->tokens = depth;
+      }
+   }
+   this->last_refill_time = time;
+}
+
+/*!
+ * @details Called with the mutex held.
+ */
+void SendPacer::record_burst(
+   int64_t const time,
+   int64_t      &window_start,
+   unsigned int &window_calls,
+   unsigned int &frame_peak )
+{
+   if ( ( time - window_start ) >= BURST_WINDOW_MICROS ) {
+      window_start = time;
+      window_calls = 0;
+   }
+   ++window_calls;
+   if ( window_calls > frame_peak ) {
+      frame_peak = window_calls;
+   }
+}
+
+/*!
+ * @details Called with the mutex held.
+ */
+void SendPacer::close_frame()
+{
+   this->frame_active = false;
+
+   // Only frames that actually made RTI calls contribute to the profiles.
+   if ( this->frame_call_count == 0 ) {
+      return;
+   }
+
+   this->total_call_count += this->frame_call_count;
+   ++this->profiled_frame_count;
+
+   this->arrival_peak_sum += (double)this->arrival_frame_peak;
+   if ( this->arrival_frame_peak > this->arrival_peak_max ) {
+      this->arrival_peak_max = this->arrival_frame_peak;
+   }
+
+   this->release_peak_sum += (double)this->release_frame_peak;
+   if ( this->release_frame_peak > this->release_peak_max ) {
+      this->release_peak_max = this->release_frame_peak;
+   }
+
+   wait_time_stats.sample( (double)this->frame_wait_time * 0.001 ); // in milliseconds
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+std::string const SendPacer::to_string()
+{
+   mutex.lock();
+
+   // Fold a still-open frame into the statistics before reporting.
+   if ( this->frame_active ) {
+      close_frame();
+   }
+
+   // The burst profile means are over the frames that made RTI calls.
+   double const divisor = ( this->profiled_frame_count > 0 )
+                             ? (double)this->profiled_frame_count
+                             : 1.0;
+
+   ostringstream msg;
+   msg << "Send pacer: frames:" << this->frame_count
+       << " profiled:" << this->profiled_frame_count
+       << " calls:" << this->total_call_count
+       << " window-fraction:" << this->frame_fraction
+       << " bucket-depth:" << this->burst_tokens << "\n"
+       << "  demand burst peak (calls per " << BURST_WINDOW_MICROS
+       << " usec window) mean:" << ( this->arrival_peak_sum / divisor )
+       << " max:" << this->arrival_peak_max << "\n"
+       << "  paced burst peak (calls per " << BURST_WINDOW_MICROS
+       << " usec window) mean:" << ( this->release_peak_sum / divisor )
+       << " max:" << this->release_peak_max << "\n"
+       << "  pacing wait per frame " << wait_time_stats.to_string();
+
+   mutex.unlock();
+
+   return msg.str();
+}
@@ -0,0 +1,344 @@
+/*!
+@file TrickHLA/SharedMemoryRing.cpp
+@ingroup TrickHLA
+@brief Shared-memory ring buffer used as an optional intra-host fast path for
+attribute updates between co-located federates.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{SharedMemoryRing.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/SharedMemoryRing.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Magic number identifying a fully initialized TrickHLA shared-memory ring.
+unsigned long const SHM_RING_MAGIC = 0x54484C4153484D31UL; // "THLASHM1"
+
+} // namespace
+
+/*! @brief Shared ring bookkeeping placed at the start of the segment. The
+ * writer publishes the magic number last so a reader that maps the segment
+ * mid-initialization simply fails to validate it and retries later. */
+struct SharedMemoryRing::RingHeader {
+   std::atomic< unsigned long > magic;       ///< Segment validity marker, written last.
+   unsigned long                frame_size;  ///< Payload capacity in bytes of one slot.
+   unsigned long                frame_count; ///< Number of ring slots, a power of two.
+   std::atomic< unsigned long > write_count; ///< Number of frames published so far.
+};
+
+/*! @brief Per slot bookkeeping preceding the slot payload. The stamp is a
+ * sequence-lock: it holds (2 * frame) once the frame contents are stable and
+ * an odd value while the writer is filling the slot. */
+struct SharedMemoryRingSlot {
+   std::atomic< unsigned long > stamp; ///< Sequence-lock stamp for this slot.
+   unsigned long                frame; ///< Frame number held by this slot.
+   unsigned long                size;  ///< Payload size in bytes of this frame.
+};
+
+/*!
+ * @job_class{initialization}
+ */
+SharedMemoryRing::SharedMemoryRing()
+   : channel_name(),
+     writer( false ),
+     mapped_memory( NULL ),
+     mapped_size( 0 ),
+     header( NULL ),
+     slot_size( 0 ),
+     next_frame( 0 ),
+     dropped_frame_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SharedMemoryRing::~SharedMemoryRing()
+{
+   close();
+}
+
+bool SharedMemoryRing::create(
+   string const &channel,
+   size_t const  frame_size,
+   size_t const  frame_count )
+{
+   // Release any ring we may already have mapped.
+   close();
+
+   // Round the slot count up to a power of two so frame numbers can be
+   // mapped to slots with a mask instead of a modulo.
+   size_t slots = 2;
+   while ( slots < frame_count ) {
+      slots <<= 1;
+   }
+
+   this->slot_size = sizeof( SharedMemoryRingSlot ) + frame_size;
+   size_t const total_size = sizeof( RingHeader ) + ( slots * slot_size );
+
+   // Remove any stale segment left over from a previous run so that we
+   // never inherit a ring with a different geometry.
+   shm_unlink( channel.c_str() );
+
+   int const fd = shm_open( channel.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR );
+   if ( fd < 0 ) {
+      send_hs( stderr, "SharedMemoryRing::create():%d Failed to create shared-memory segment '%s'.%c",
+               __LINE__, channel.c_str(), THLA_NEWLINE );
+      return false;
+   }
+   if ( ftruncate( fd, (off_t)total_size ) != 0 ) {
+      send_hs( stderr, "SharedMemoryRing::create():%d Failed to size shared-memory segment '%s' to %d bytes.%c",
+               __LINE__, channel.c_str(), (int)total_size, THLA_NEWLINE );
+      ::close( fd );
+      shm_unlink( channel.c_str() );
+      return false;
+   }
+
+   void *addr = mmap( NULL, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      send_hs( stderr, "SharedMemoryRing::create():%d Failed to map shared-memory segment '%s'.%c",
+               __LINE__, channel.c_str(), THLA_NEWLINE );
+      shm_unlink( channel.c_str() );
+      return false;
+   }
+
+   this->channel_name  = channel;
+   this->writer        = true;
+   this->mapped_memory = addr;
+   this->mapped_size   = total_size;
+   this->header        = static_cast< RingHeader * >( addr );
+
+   // Initialize the ring bookkeeping with no frames published yet.
+   memset( addr, 0, total_size );
+   header->frame_size  = (unsigned long)frame_size;
+   header->frame_count = (unsigned long)slots;
+   header->write_count.store( 0, memory_order_relaxed );
+
+   // Publish the magic number last so a reader never validates a segment
+   // that is only partially initialized.
+   header->magic.store( SHM_RING_MAGIC, memory_order_release );
+
+   return true;
+}
+
+bool SharedMemoryRing::open(
+   string const &channel )
+{
+   // Release any ring we may already have mapped.
+   close();
+
+   // The writer may not have created the segment yet, so failing to open
+   // it is not an error and the caller is expected to retry later.
+   int const fd = shm_open( channel.c_str(), O_RDWR, S_IRUSR | S_IWUSR );
+   if ( fd < 0 ) {
+      return false;
+   }
+
+   struct stat seg_stat;
+   if ( ( fstat( fd, &seg_stat ) != 0 )
+        || ( (size_t)seg_stat.st_size < sizeof( RingHeader ) ) ) {
+      ::close( fd );
+      return false;
+   }
+
+   void *addr = mmap( NULL, (size_t)seg_stat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      return false;
+   }
+
+   RingHeader *hdr = static_cast< RingHeader * >( addr );
+   if ( hdr->magic.load( memory_order_acquire ) != SHM_RING_MAGIC ) {
+      // The writer has not finished initializing the ring yet.
+      munmap( addr, (size_t)seg_stat.st_size );
+      return false;
+   }
+
+   this->channel_name  = channel;
+   this->writer        = false;
+   this->mapped_memory = addr;
+   this->mapped_size   = (size_t)seg_stat.st_size;
+   this->header        = hdr;
+   this->slot_size     = sizeof( SharedMemoryRingSlot ) + hdr->frame_size;
+
+   // Only consume frames published after we attached so a late joining
+   // reader does not replay stale data from earlier in the run.
+   this->next_frame = header->write_count.load( memory_order_acquire ) + 1;
+
+   return true;
+}
+
+void SharedMemoryRing::close()
+{
+   if ( mapped_memory != NULL ) {
+      munmap( mapped_memory, mapped_size );
+      mapped_memory = NULL;
+      mapped_size   = 0;
+      header        = NULL;
+   }
+   if ( writer && !channel_name.empty() ) {
+      shm_unlink( channel_name.c_str() );
+   }
+   writer = false;
+   channel_name.clear();
+}
+
+size_t SharedMemoryRing::get_frame_size() const
+{
+   return ( ( header != NULL ) ? (size_t)header->frame_size : 0 );
+}
+
+unsigned char *SharedMemoryRing::slot_address(
+   unsigned long const frame ) const
+{
+   unsigned long const index = frame & ( header->frame_count - 1 );
+   return ( static_cast< unsigned char * >( mapped_memory )
+            + sizeof( RingHeader ) + ( index * slot_size ) );
+}
+
+bool SharedMemoryRing::write(
+   unsigned char const *data,
+   size_t const         size )
+{
+   if ( ( header == NULL ) || ( size > header->frame_size ) ) {
+      return false;
+   }
+
+   unsigned long const frame = header->write_count.load( memory_order_relaxed ) + 1;
+
+   SharedMemoryRingSlot *slot = reinterpret_cast< SharedMemoryRingSlot * >( slot_address( frame ) );
+
+   // Mark the slot as being written with an odd stamp so a concurrent
+   // reader knows the contents are unstable, then fill it and release it
+   // with the even stamp for this frame.
+   slot->stamp.store( ( 2 * frame ) - 1, memory_order_relaxed );
+   atomic_thread_fence( memory_order_release );
+   slot->frame = frame;
+   slot->size  = (unsigned long)size;
+   memcpy( reinterpret_cast< unsigned char * >( slot ) + sizeof( SharedMemoryRingSlot ),
+           data, size );
+   slot->stamp.store( 2 * frame, memory_order_release );
+
+   header->write_count.store( frame, memory_order_release );
+   return true;
+}
+
+bool SharedMemoryRing::read(
+   unsigned char *dest,
+   size_t const   capacity,
+   size_t        &size )
+{
+   if ( header == NULL ) {
+      return false;
+   }
+
+   unsigned long const published = header->write_count.load( memory_order_acquire );
+   if ( next_frame > published ) {
+      return false; // No new frame is available.
+   }
+
+   // If the writer lapped us then the oldest unread frames have already
+   // been overwritten, so re-synchronize to the newest published frame and
+   // account for the frames we skipped.
+   if ( ( published - next_frame ) >= header->frame_count ) {
+      dropped_frame_count += ( published - next_frame );
+      next_frame = published;
+   }
+
+   SharedMemoryRingSlot *slot = reinterpret_cast< SharedMemoryRingSlot * >( slot_address( next_frame ) );
+
+   // Sequence-lock read: the copy is only valid if the slot stamp matches
+   // this frame both before and after the copy.
+   for ( int attempt = 0; attempt < 16; ++attempt ) {
+      unsigned long const stamp_before = slot->stamp.load( memory_order_acquire );
+      if ( stamp_before != ( 2 * next_frame ) ) {
+         // The writer overwrote this slot while we were behind; skip ahead
+         // to the newest published frame and try again from there.
+         unsigned long const newest = header->write_count.load( memory_order_acquire );
+         if ( newest <= next_frame ) {
+            return false;
+         }
+         dropped_frame_count += ( newest - next_frame );
+         next_frame = newest;
+         slot       = reinterpret_cast< SharedMemoryRingSlot * >( slot_address( next_frame ) );
+         continue;
+      }
+
+      size_t const frame_size = (size_t)slot->size;
+      if ( frame_size > capacity ) {
+         return false; // Caller buffer is too small for this frame.
+      }
+      memcpy( dest,
+              reinterpret_cast< unsigned char * >( slot ) + sizeof( SharedMemoryRingSlot ),
+              frame_size );
+
+      atomic_thread_fence( memory_order_acquire );
+      if ( slot->stamp.load( memory_order_relaxed ) == ( 2 * next_frame ) ) {
+         size = frame_size;
+         ++next_frame;
+         return true;
+      }
+   }
+   return false;
+}
+
+string SharedMemoryRing::make_channel_name(
+   string const &federation_name,
+   string const &instance_name )
+{
+   // POSIX shared-memory names must start with exactly one slash and
+   // contain no others, so map anything unsafe to an underscore.
+   string name = "/TrickHLA_" + federation_name + "_" + instance_name;
+   for ( size_t i = 1; i < name.length(); ++i ) {
+      char const c = name[i];
+      if ( !( ( ( c >= 'a' ) && ( c <= 'z' ) )
+              || ( ( c >= 'A' ) && ( c <= 'Z' ) )
+              || ( ( c >= '0' ) && ( c <= '9' ) )
+              || ( c == '_' ) || ( c == '-' ) || ( c == '.' ) ) ) {
+         name[i] = '_';
+      }
+   }
+   // POSIX also limits the name length, so truncate very long names.
+   if ( name.length() > 250 ) {
+      name.resize( 250 );
+   }
+   return name;
+}
@@ -0,0 +1,145 @@
+/*!
+@file TrickHLA/StartupProfiler.cpp
+@ingroup TrickHLA
+@brief Wall-clock timing of the major federate startup stages, reported
+as a per-stage startup report when the federate begins execution.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{StartupProfiler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/StartupProfiler.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Define the static class variables.
+std::vector< StartupProfiler::StageRecord > StartupProfiler::stages;
+
+int StartupProfiler::open_stage_count = 0;
+
+/*!
+ * @job_class{initialization}
+ */
+StartupProfiler::Scope::Scope(
+   std::string const &stage_name )
+   : stage_index( (int)StartupProfiler::stages.size() )
+{
+   StageRecord record;
+   record.name          = stage_name;
+   record.start_time_us = clock_wall_time(); // in microseconds
+   record.end_time_us   = -1;
+   record.depth         = StartupProfiler::open_stage_count;
+
+   StartupProfiler::stages.push_back( record );
+   ++StartupProfiler::open_stage_count;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+StartupProfiler::Scope::~Scope()
+{
+   StartupProfiler::stages[stage_index].end_time_us = clock_wall_time();
+   --StartupProfiler::open_stage_count;
+}
+
+bool StartupProfiler::has_stages()
+{
+   return ( !stages.empty() );
+}
+
+/*!
+ * @details The start offsets are relative to the begin time of the first
+ * recorded stage and the percentages are of the total startup time, which
+ * spans the first stage begin to the last stage end. Nested stages are
+ * indented under their parent stage and only top level stages count
+ * towards the total, so the percentages do not double count sub-stages.
+ */
+string StartupProfiler::to_string()
+{
+   ostringstream msg;
+   msg << "TrickHLA startup phase timing report:";
+
+   if ( stages.empty() ) {
+      msg << " no startup stages recorded.";
+      return msg.str();
+   }
+
+   // The total startup time spans the first stage begin to the last
+   // recorded stage end.
+   long long const first_start_us = stages[0].start_time_us;
+
+   long long last_end_us = first_start_us;
+   for ( unsigned int i = 0; i < stages.size(); ++i ) {
+      if ( stages[i].end_time_us > last_end_us ) {
+         last_end_us = stages[i].end_time_us;
+      }
+   }
+   double const total_sec = (double)( last_end_us - first_start_us ) / 1000000.0;
+
+   msg << fixed << setprecision( 3 )
+       << "\n      start     duration    startup stage"
+       << "\n   ---------  -----------   -------------";
+
+   for ( unsigned int i = 0; i < stages.size(); ++i ) {
+      StageRecord const &record = stages[i];
+
+      msg << "\n   " << setw( 7 )
+          << ( (double)( record.start_time_us - first_start_us ) / 1000000.0 )
+          << " s  ";
+
+      if ( record.end_time_us < record.start_time_us ) {
+         // The stage scope never closed, which only happens when the
+         // report is generated from inside an open stage.
+         msg << " (unfinished) ";
+      } else {
+         double const duration_sec = (double)( record.end_time_us - record.start_time_us ) / 1000000.0;
+
+         msg << setw( 7 ) << duration_sec << " s ";
+         if ( ( record.depth == 0 ) && ( total_sec > 0.0 ) ) {
+            msg << setw( 3 ) << (int)( ( duration_sec / total_sec ) * 100.0 ) << "%";
+         } else {
+            msg << "    ";
+         }
+      }
+
+      msg << "  ";
+      for ( int d = 0; d < record.depth; ++d ) {
+         msg << "   ";
+      }
+      msg << record.name;
+   }
+
+   msg << "\n   Total startup time: " << total_sec
+       << " seconds from the first stage begin to the last stage end.";
+
+   return msg.str();
+}
@@ -72,51 +72,57 @@ SyncPnt::~SyncPnt()
 
 bool SyncPnt::is_valid()
 {
-   return ( ( this->state == SYNC_PT_STATE_EXISTS )
-            || ( this->state == SYNC_PT_STATE_REGISTERED )
-            || ( this->state == SYNC_PT_STATE_ANNOUNCED )
-            || ( this->state == SYNC_PT_STATE_ACHIEVED )
-            || ( this->state == SYNC_PT_STATE_SYNCHRONIZED ) );
+   // Load the state once so the check is one wait-free atomic load and is
+   // consistent even when the state transitions mid check.
+   SyncPtStateEnum const s = get_state();
+   return ( ( s == SYNC_PT_STATE_EXISTS )
+            || ( s == SYNC_PT_STATE_REGISTERED )
+            || ( s == SYNC_PT_STATE_ANNOUNCED )
+            || ( s == SYNC_PT_STATE_ACHIEVED )
+            || ( s == SYNC_PT_STATE_SYNCHRONIZED ) );
 }
 
 bool SyncPnt::exists()
 {
-   return ( this->state == SYNC_PT_STATE_EXISTS );
+   return ( get_state() == SYNC_PT_STATE_EXISTS );
 }
 
 bool SyncPnt::is_registered()
 {
-   return ( this->state == SYNC_PT_STATE_REGISTERED );
+   return ( get_state() == SYNC_PT_STATE_REGISTERED );
 }
 
 bool SyncPnt::is_announced()
 {
-   return ( this->state == SYNC_PT_STATE_ANNOUNCED );
+   return ( get_state() == SYNC_PT_STATE_ANNOUNCED );
 }
 
 bool SyncPnt::is_achieved()
 {
-   return ( this->state == SYNC_PT_STATE_ACHIEVED );
+   return ( get_state() == SYNC_PT_STATE_ACHIEVED );
 }
 
 bool SyncPnt::is_synchronized()
 {
-   return ( this->state == SYNC_PT_STATE_SYNCHRONIZED );
+   return ( get_state() == SYNC_PT_STATE_SYNCHRONIZED );
 }
 
 bool SyncPnt::is_error()
 {
-   return ( ( this->state != SYNC_PT_STATE_EXISTS )
-            && ( this->state != SYNC_PT_STATE_REGISTERED )
-            && ( this->state != SYNC_PT_STATE_ANNOUNCED )
-            && ( this->state != SYNC_PT_STATE_ACHIEVED )
-            && ( this->state != SYNC_PT_STATE_SYNCHRONIZED ) );
+   // Load the state once so the check is one wait-free atomic load and is
+   // consistent even when the state transitions mid check.
+   SyncPtStateEnum const s = get_state();
+   return ( ( s != SYNC_PT_STATE_EXISTS )
+            && ( s != SYNC_PT_STATE_REGISTERED )
+            && ( s != SYNC_PT_STATE_ANNOUNCED )
+            && ( s != SYNC_PT_STATE_ACHIEVED )
+            && ( s != SYNC_PT_STATE_SYNCHRONIZED ) );
 }
 
 std::wstring SyncPnt::to_wstring()
 {
    wstring result = L"[" + label + L"] -- ";
-   switch ( this->state ) {
+   switch ( get_state() ) {
 
       case SYNC_PT_STATE_ERROR:
          result += L"SYNC_PT_STATE_ERROR";
@@ -151,6 +157,6 @@ std::wstring SyncPnt::to_wstring()
 void SyncPnt::convert( LoggableSyncPnt &log_sync_pnt )
 {
    log_sync_pnt.label = StringUtilities::ip_strdup_wstring( this->label );
-   log_sync_pnt.state = this->state;
+   log_sync_pnt.state = get_state();
    return;
 }
@@ -35,10 +35,15 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <cstdint>
+#include <ctime>
 #include <iostream>
+#include <pthread.h>
+#include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // Trick include files.
 #include "trick/exec_proto.h"
@@ -67,7 +72,8 @@ using namespace TrickHLA;
 SyncPntListBase::SyncPntListBase()
    : mutex()
 {
-   return;
+   pthread_mutex_init( &sync_pnt_cond_mutex, NULL );
+   pthread_cond_init( &sync_pnt_cond, NULL );
 }
 
 /*!
@@ -80,6 +86,9 @@ SyncPntListBase::~SyncPntListBase()
 
    // Make sure we destroy the mutex.
    mutex.destroy();
+
+   pthread_cond_destroy( &sync_pnt_cond );
+   pthread_mutex_destroy( &sync_pnt_cond_mutex );
 }
 
 void SyncPntListBase::add_sync_point(
@@ -91,6 +100,9 @@ void SyncPntListBase::add_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
    sync_point_list.push_back( sp );
+
+   // Intern the label so lookups avoid a linear wide string scan.
+   sync_point_map[label] = sp;
 }
 
 SyncPnt *SyncPntListBase::get_sync_point(
@@ -100,23 +112,10 @@ SyncPnt *SyncPntListBase::get_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-
-      // Find the sync-point.
-      vector< SyncPnt * >::const_iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt *sp = ( *i );
+   // Find the sync-point using the interned label table.
+   map< wstring, SyncPnt * >::const_iterator iter = sync_point_map.find( label );
 
-         // Check for a match.
-         if ( ( sp != NULL ) && ( sp->get_label().compare( label ) == 0 ) ) {
-            // Return the sync-point.
-            return sp;
-         }
-      }
-   }
-
-   // Must not have found the sync-point.
-   return NULL;
+   return ( iter != sync_point_map.end() ) ? iter->second : NULL;
 }
 
 SyncPnt *SyncPntListBase::register_sync_point(
@@ -196,9 +195,92 @@ void SyncPntListBase::register_all_sync_points(
    }
 }
 
+void SyncPntListBase::wait_for_all_registration_confirmations(
+   Federate *fed_ptr )
+{
+   bool pending;
+
+   // Critical code section.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+      pending = !pending_registrations.empty();
+   }
+
+   if ( pending && DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "SyncPntListBase::wait_for_all_registration_confirmations():%d Waiting...%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   int64_t      wallclock_time;
+   SleepTimeout print_timer( fed_ptr->wait_status_time );
+   SleepTimeout sleep_timer;
+
+   // Drain the pending registration completion set. All the registrations
+   // were fired off back to back, so the overall wait is bounded by the
+   // slowest confirmation instead of the sum of the round trips.
+   while ( pending ) {
+
+      // Always check to see is a shutdown was received.
+      fed_ptr->check_for_shutdown_with_termination();
+
+      // Block until a sync-point state change is signaled or the bounded
+      // wait times out.
+      wait_for_sync_point_state_change();
+
+      // Critical code section.
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &mutex );
+         pending = !pending_registrations.empty();
+      }
+
+      if ( pending ) {
+
+         // To be more efficient, we get the time once and share it.
+         wallclock_time = sleep_timer.time();
+
+         // Periodically check to make sure the federate is still part of
+         // the federation execution.
+         if ( sleep_timer.timeout( wallclock_time ) ) {
+            sleep_timer.reset();
+            if ( !fed_ptr->is_execution_member() ) {
+               ostringstream errmsg;
+               errmsg << "SyncPntListBase::wait_for_all_registration_confirmations():" << __LINE__
+                      << " ERROR: Unexpectedly the Federate is no longer an execution"
+                      << " member. This means we are either not connected to the"
+                      << " RTI or we are no longer joined to the federation"
+                      << " execution because someone forced our resignation at"
+                      << " the Central RTI Component (CRC) level!" << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
+            }
+         }
+
+         if ( print_timer.timeout( wallclock_time ) ) {
+            print_timer.reset();
+            send_hs( stdout, "SyncPntListBase::wait_for_all_registration_confirmations():%d Waiting...%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+      }
+   }
+}
+
 void SyncPntListBase::sync_point_registration_succeeded(
    wstring const &label )
 {
+   // Critical code section.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      // The RTI confirmed this registration so remove the label from the
+      // pending registration completion set.
+      pending_registrations.erase( label );
+   }
+
    if ( this->mark_registered( label ) ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
          send_hs( stdout, "SyncPntListBase::sync_point_registration_succeeded():%d Label:'%ls'%c",
@@ -214,6 +296,17 @@ void SyncPntListBase::sync_point_registration_failed(
    // Only handle the sync-points we know about.
    if ( this->contains( label ) ) {
 
+      // Critical code section.
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &mutex );
+
+         // The RTI responded to this registration so remove the label from
+         // the pending registration completion set.
+         pending_registrations.erase( label );
+      }
+
       // If the reason for the failure is that the label is not unique then
       // this means the sync-point is registered with the RTI it just means
       // we did not do it.
@@ -300,13 +393,9 @@ void SyncPntListBase::wait_for_list_synchronization(
    for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
       SyncPnt *sp = ( *i );
 
-      // Critical code section with a scope specific mutex lock.
-      {
-         // When auto_unlock_mutex goes out of scope it automatically unlocks the
-         // mutex even if there is an exception.
-         MutexProtection auto_unlock_mutex( &mutex );
-         valid_and_not_achieved = ( sp != NULL ) && sp->is_valid() && !sp->is_achieved();
-      }
+      // The per sync-point state is atomic, so the status checks are
+      // wait-free loads and the list mutex is not needed here.
+      valid_and_not_achieved = ( sp != NULL ) && sp->is_valid() && !sp->is_achieved();
 
       // Wait for a synchronization point if it is valid but not achieved.
       if ( valid_and_not_achieved ) {
@@ -314,20 +403,16 @@ void SyncPntListBase::wait_for_list_synchronization(
          // Wait for the federation to synchronized on the sync-point.
          do {
 
-            // Critical code section with a scope specific mutex lock.
-            {
-               // When auto_unlock_mutex goes out of scope it automatically
-               // unlocks the mutex even if there is an exception.
-               MutexProtection auto_unlock_mutex( &mutex );
-               achieved = sp->is_achieved();
-            }
+            // Wait-free atomic state check, no lock needed.
+            achieved = sp->is_achieved();
 
             if ( !achieved ) {
                // Always check to see is a shutdown was received.
                federate->check_for_shutdown_with_termination();
 
-               // Pause and release the processor for short sleep value.
-               sleep_timer.sleep();
+               // Block until a sync-point state change is signaled or the
+               // bounded wait times out.
+               wait_for_sync_point_state_change();
 
                // To be more efficient, we get the time once and share it.
                wallclock_time = sleep_timer.time();
@@ -362,16 +447,12 @@ void SyncPntListBase::wait_for_list_synchronization(
          } while ( !achieved );
       }
 
-      // Critical code section with a scope specific mutex lock.
-      {
-         // When auto_unlock_mutex goes out of scope it automatically unlocks the
-         // mutex even if there is an exception.
-         MutexProtection auto_unlock_mutex( &mutex );
-
-         // Now that the sync-point is achieved, reset the state to EXISTS.
-         if ( ( sp != NULL ) && !sp->is_achieved() ) {
-            sp->set_state( SYNC_PT_STATE_EXISTS );
-         }
+      // Now that the federation synchronized on the sync-point, reset the
+      // state to EXISTS. The compare-and-swap transition is safe against a
+      // concurrent state change from the FedAmb callback thread without
+      // taking the list mutex.
+      if ( sp != NULL ) {
+         sp->transition_state( SYNC_PT_STATE_SYNCHRONIZED, SYNC_PT_STATE_EXISTS );
       }
    }
 }
@@ -434,13 +515,10 @@ void SyncPntListBase::achieve_and_wait_for_synchronization(
          DebugHandler::terminate_with_message( errmsg.str() );
       }
 
-      bool achieved_and_not_synched;
-      {
-         // When auto_unlock_mutex goes out of scope it automatically unlocks the
-         // mutex even if there is an exception.
-         MutexProtection auto_unlock_mutex( &mutex );
-         achieved_and_not_synched = sp->is_achieved() && !sp->is_synchronized();
-      }
+      // The per sync-point state is atomic, so this status check is a
+      // wait-free load and the list mutex is not needed here.
+      bool const achieved_and_not_synched = ( sp->get_state() == SYNC_PT_STATE_ACHIEVED );
+
       // If achieved and not synchronized, then synchronize with the federation.
       if ( achieved_and_not_synched ) {
          // WARNING: Make sure we don't lock the mutex before we make this
@@ -462,6 +540,97 @@ void SyncPntListBase::achieve_and_wait_for_synchronization(
    }
 }
 
+void SyncPntListBase::achieve_and_wait_for_synchronization_list(
+   RTI1516_NAMESPACE::RTIambassador  &RTI_amb,
+   Federate                          *federate,
+   std::vector< std::wstring > const &labels )
+{
+   vector< SyncPnt * > wait_list;
+
+   // First pass: Achieve every announced sync-point in the batch before
+   // waiting on any of them, so the RTI overlaps the federation
+   // synchronization of the whole batch instead of paying a full
+   // federation round trip per label.
+   vector< wstring >::const_iterator l;
+   for ( l = labels.begin(); l != labels.end(); ++l ) {
+
+      string name;
+      StringUtilities::to_string( name, *l );
+
+      // Check for the synchronization point by label.
+      SyncPnt *sp = this->get_sync_point( *l );
+
+      if ( sp == NULL ) {
+         ostringstream errmsg;
+         errmsg << "SyncPntListBase::achieve_and_wait_for_synchronization_list():"
+                << __LINE__
+                << " ERROR: Synchronization-Point '" << name
+                << "' not found!";
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      // If the synchronization point is announced, then achieve it.
+      if ( sp->is_announced() ) {
+
+         // Achieve the synchronization point.
+         achieve_sync_point( RTI_amb, sp );
+
+      } else if ( sp->is_achieved() ) {
+
+         // If the synchronization point is already achieved then print out
+         // a message and move on to waiting for synchronization.
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            ostringstream errmsg;
+            errmsg << "SyncPntListBase::achieve_and_wait_for_synchronization_list():"
+                   << __LINE__
+                   << " Synchronization-Point '" << name
+                   << "' has already been achieved with the RTI!";
+            send_hs( stderr, errmsg.str().c_str() );
+         }
+
+      } else if ( sp->is_synchronized() ) {
+
+         // If the synchronization point is already synchronized, then print
+         // out a message and skip waiting on it.
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            ostringstream errmsg;
+            errmsg << "SyncPntListBase::achieve_and_wait_for_synchronization_list():"
+                   << __LINE__
+                   << " Synchronization-Point '" << name
+                   << "' has already been synchronized with the RTI!";
+            send_hs( stderr, errmsg.str().c_str() );
+         }
+         continue;
+
+      } else {
+
+         // Okay, something is wrong here. Print a message and exit.
+         ostringstream errmsg;
+         errmsg << "SyncPntListBase::achieve_and_wait_for_synchronization_list():"
+                << __LINE__
+                << " ERROR: Synchronization-Point '" << name
+                << "' has not been announced with the RTI!";
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      // The per sync-point state is atomic, so this status check is a
+      // wait-free load and the list mutex is not needed here.
+      if ( sp->get_state() == SYNC_PT_STATE_ACHIEVED ) {
+         wait_list.push_back( sp );
+      }
+   }
+
+   // Second pass: Wait for the federation to synchronize on every sync-point
+   // in the batch. The waits are callback driven, so the total wait is
+   // bounded by the slowest sync-point instead of the sum of them.
+   vector< SyncPnt * >::const_iterator i;
+   for ( i = wait_list.begin(); i != wait_list.end(); ++i ) {
+      // WARNING: Make sure we don't lock the mutex before we make this
+      // call otherwise it will block the FedAmb callbacks.
+      wait_for_synchronization( federate, *i );
+   }
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -517,21 +686,23 @@ bool SyncPntListBase::clear_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt *sp = ( *i );
-         if ( ( sp != NULL ) && ( sp->is_achieved() ) && ( label.compare( sp->get_label() ) == 0 ) ) {
+   // The interning map finds the synchronization point for the label
+   // without a linear scan over the list with wide string compares.
+   SyncPnt *sp = get_sync_point( label );
+   if ( ( sp != NULL ) && ( sp->is_achieved() ) ) {
 
-            // Extension class dependent code would go here.
+      // Extension class dependent code would go here.
 
-            sync_point_list.erase( i );
-            delete sp;
-            i = sync_point_list.end();
+      sync_point_map.erase( sp->get_label() );
 
-            return true;
-         }
+      vector< SyncPnt * >::iterator i =
+         find( sync_point_list.begin(), sync_point_list.end(), sp );
+      if ( i != sync_point_list.end() ) {
+         sync_point_list.erase( i );
       }
+      delete sp;
+
+      return true;
    }
    return false;
 }
@@ -549,6 +720,7 @@ void SyncPntListBase::reset()
       }
    }
    sync_point_list.clear();
+   sync_point_map.clear();
 }
 
 /*!
@@ -561,16 +733,7 @@ bool SyncPntListBase::contains(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::const_iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         SyncPnt const *sp = ( *i );
-         if ( ( sp != NULL ) && ( sp->get_label().compare( label ) == 0 ) ) {
-            return true;
-         }
-      }
-   }
-   return false;
+   return ( sync_point_map.find( label ) != sync_point_map.end() );
 }
 
 /*!
@@ -579,16 +742,27 @@ bool SyncPntListBase::contains(
 bool SyncPntListBase::mark_registered(
    wstring const &label )
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &mutex );
+   bool marked = false;
 
-   SyncPnt *sp = get_sync_point( label );
-   if ( sp != NULL ) {
-      sp->set_state( SYNC_PT_STATE_REGISTERED );
-      return true;
+   // Critical code section.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      SyncPnt *sp = get_sync_point( label );
+      if ( sp != NULL ) {
+         sp->set_state( SYNC_PT_STATE_REGISTERED );
+         marked = true;
+      }
    }
-   return false;
+
+   // Wake up any thread blocked waiting on a sync-point state change. The
+   // list mutex has been released so the waiter can re-check the state.
+   if ( marked ) {
+      signal_sync_point_state_change();
+   }
+   return marked;
 }
 
 /*!
@@ -597,16 +771,27 @@ bool SyncPntListBase::mark_registered(
 bool SyncPntListBase::mark_announced(
    wstring const &label )
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &mutex );
+   bool marked = false;
 
-   SyncPnt *sp = get_sync_point( label );
-   if ( sp != NULL ) {
-      sp->set_state( SYNC_PT_STATE_ANNOUNCED );
-      return true;
+   // Critical code section.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      SyncPnt *sp = get_sync_point( label );
+      if ( sp != NULL ) {
+         sp->set_state( SYNC_PT_STATE_ANNOUNCED );
+         marked = true;
+      }
    }
-   return false;
+
+   // Wake up any thread blocked waiting on a sync-point state change. The
+   // list mutex has been released so the waiter can re-check the state.
+   if ( marked ) {
+      signal_sync_point_state_change();
+   }
+   return marked;
 }
 
 /*!
@@ -615,19 +800,30 @@ bool SyncPntListBase::mark_announced(
 bool SyncPntListBase::mark_synchronized(
    wstring const &label )
 {
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &mutex );
+   bool marked = false;
 
-   SyncPnt *sp = get_sync_point( label );
-   if ( sp != NULL ) {
+   // Critical code section.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
 
-      // Mark the synchronization point at achieved which indicates the
-      // federation is synchronized on the synchronization point.
-      sp->set_state( SYNC_PT_STATE_SYNCHRONIZED );
-      return true;
+      SyncPnt *sp = get_sync_point( label );
+      if ( sp != NULL ) {
+
+         // Mark the synchronization point at achieved which indicates the
+         // federation is synchronized on the synchronization point.
+         sp->set_state( SYNC_PT_STATE_SYNCHRONIZED );
+         marked = true;
+      }
    }
-   return false;
+
+   // Wake up any thread blocked waiting on a sync-point state change. The
+   // list mutex has been released so the waiter can re-check the state.
+   if ( marked ) {
+      signal_sync_point_state_change();
+   }
+   return marked;
 }
 
 wstring SyncPntListBase::to_wstring()
@@ -713,6 +909,10 @@ void SyncPntListBase::register_sync_point(
       // Mark the sync-point as registered.
       sp->set_state( SYNC_PT_STATE_REGISTERED );
 
+      // The registration is confirmed asynchronously by the RTI callbacks,
+      // so track the label in the pending registration completion set.
+      pending_registrations.insert( sp->get_label() );
+
    } catch ( RTI1516_EXCEPTION const &e ) {
 
       // Macro to restore the saved FPU Control Word register value.
@@ -753,6 +953,10 @@ void SyncPntListBase::register_sync_point(
       // Mark the sync-point as registered.
       sp->set_state( SYNC_PT_STATE_REGISTERED );
 
+      // The registration is confirmed asynchronously by the RTI callbacks,
+      // so track the label in the pending registration completion set.
+      pending_registrations.insert( sp->get_label() );
+
    } catch ( RTI1516_EXCEPTION const &e ) {
 
       // Macro to restore the saved FPU Control Word register value.
@@ -786,26 +990,24 @@ bool SyncPntListBase::wait_for_sync_point_announcement(
 {
    if ( sp != NULL ) {
 
-      bool announced;
+      // The per sync-point state is atomic, so load it once for a
+      // consistent wait-free status check without the list mutex.
+      SyncPtStateEnum const initial_state = sp->get_state();
 
-      // Critical code section.
-      {
-         // When auto_unlock_mutex goes out of scope it automatically unlocks the
-         // mutex even if there is an exception.
-         MutexProtection auto_unlock_mutex( &mutex );
-         announced = sp->is_announced();
+      bool announced = ( initial_state == SYNC_PT_STATE_ANNOUNCED );
 
-         // The sync-point state must be SYNC_PT_STATE_REGISTERED.
-         if ( !sp->exists() && !sp->is_registered() && !announced ) {
-            string sp_status;
-            StringUtilities::to_string( sp_status, sp->to_wstring() );
+      // The sync-point state must be SYNC_PT_STATE_REGISTERED.
+      if ( ( initial_state != SYNC_PT_STATE_EXISTS )
+           && ( initial_state != SYNC_PT_STATE_REGISTERED )
+           && !announced ) {
+         string sp_status;
+         StringUtilities::to_string( sp_status, sp->to_wstring() );
 
-            ostringstream errmsg;
-            errmsg << "SyncPntListBase::wait_for_sync_point_announcement():" << __LINE__
-                   << " ERROR: Bad sync-point state for sync-point!"
-                   << " The sync-point state: " << sp_status << THLA_ENDL;
-            DebugHandler::terminate_with_message( errmsg.str() );
-         }
+         ostringstream errmsg;
+         errmsg << "SyncPntListBase::wait_for_sync_point_announcement():" << __LINE__
+                << " ERROR: Bad sync-point state for sync-point!"
+                << " The sync-point state: " << sp_status << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
       }
 
       bool         print_summary = DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE );
@@ -832,15 +1034,12 @@ bool SyncPntListBase::wait_for_sync_point_announcement(
          // Always check to see is a shutdown was received.
          federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         // Block until a sync-point state change is signaled or the bounded
+         // wait times out.
+         wait_for_sync_point_state_change();
 
-         // Critical code section.
-         {
-            // When auto_unlock_mutex goes out of scope it automatically unlocks the
-            // mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-            announced = sp->is_announced();
-         }
+         // Wait-free atomic state check, no lock needed.
+         announced = sp->is_announced();
 
          if ( !announced ) {
 
@@ -939,6 +1138,9 @@ bool SyncPntListBase::achieve_sync_point(
       TRICKHLA_RESTORE_FPU_CONTROL_WORD;
       TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+      // Wake up any thread blocked waiting on a sync-point state change.
+      signal_sync_point_state_change();
+
       return true;
    }
    return false;
@@ -967,26 +1169,22 @@ bool SyncPntListBase::wait_for_synchronization(
             send_hs( stdout, msg.str().c_str() );
          }
 
-         // Critical code section.
-         {
-            // When auto_unlock_mutex goes out of scope it automatically unlocks
-            // the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            synchronized = sp->is_synchronized();
-            if ( synchronized ) {
-               // Now that the federation is synchronized on the synchronization point,
-               // return to SYNC_PT_STATE_EXISTS state.
-               sp->set_state( SYNC_PT_STATE_EXISTS );
-            }
-         }
+         // Now that the federation is synchronized on the synchronization
+         // point, return to the SYNC_PT_STATE_EXISTS state. The
+         // compare-and-swap consumes the SYNCHRONIZED state in one atomic
+         // transition, so no lock is needed and a concurrent state change
+         // from the FedAmb callback thread cannot be lost.
+         synchronized = sp->transition_state( SYNC_PT_STATE_SYNCHRONIZED,
+                                              SYNC_PT_STATE_EXISTS );
 
          if ( !synchronized ) {
 
             // Always check to see is a shutdown was received.
             federate->check_for_shutdown_with_termination();
 
-            sleep_timer.sleep();
+            // Block until a sync-point state change is signaled or the
+            // bounded wait times out.
+            wait_for_sync_point_state_change();
 
             // To be more efficient, we get the time once and share it.
             wallclock_time = sleep_timer.time();
@@ -1019,3 +1217,39 @@ bool SyncPntListBase::wait_for_synchronization(
    }
    return false;
 }
+
+/*!
+ * @details The broadcast is done while holding the condition variable mutex,
+ * which pairs with the timed wait in wait_for_sync_point_state_change().
+ * Only call this after the sync-point list mutex has been released so a
+ * waiter woken here can immediately re-check the sync-point state.
+ */
+void SyncPntListBase::signal_sync_point_state_change()
+{
+   pthread_mutex_lock( &sync_pnt_cond_mutex );
+   pthread_cond_broadcast( &sync_pnt_cond );
+   pthread_mutex_unlock( &sync_pnt_cond_mutex );
+}
+
+/*!
+ * @details A bounded timed wait of 10 milliseconds is used instead of an
+ * unbounded wait so the caller can still periodically check for shutdown,
+ * check the federation execution membership and print a wait status
+ * summary. The caller is expected to re-check the sync-point state after
+ * this function returns.
+ */
+void SyncPntListBase::wait_for_sync_point_state_change()
+{
+   pthread_mutex_lock( &sync_pnt_cond_mutex );
+
+   struct timespec abs_timeout;
+   clock_gettime( CLOCK_REALTIME, &abs_timeout );
+   abs_timeout.tv_nsec += 10000000L;
+   if ( abs_timeout.tv_nsec >= 1000000000L ) {
+      abs_timeout.tv_sec += 1;
+      abs_timeout.tv_nsec -= 1000000000L;
+   }
+   pthread_cond_timedwait( &sync_pnt_cond, &sync_pnt_cond_mutex, &abs_timeout );
+
+   pthread_mutex_unlock( &sync_pnt_cond_mutex );
+}
@@ -83,7 +83,7 @@ TimedSyncPnt::~TimedSyncPnt()
 std::wstring TimedSyncPnt::to_wstring()
 {
    wstring result = L"[" + label + L"/" + time.to_wstring() + L"] -- ";
-   switch ( this->state ) {
+   switch ( get_state() ) {
 
       case SYNC_PT_STATE_ERROR:
          result += L"SYNC_PT_STATE_ERROR";
@@ -125,11 +125,11 @@ void TimedSyncPnt::convert( LoggableSyncPnt &log_sync_pnt )
          << ": Could not cast synchronization point to timed synchronization point!" << THLA_ENDL;
       send_hs( stderr, errmsg.str().c_str() );
       log_sync_pnt.label = StringUtilities::ip_strdup_wstring( this->label );
-      log_sync_pnt.state = this->state;
+      log_sync_pnt.state = get_state();
    } else {
       timed_log_sync_pnt->time  = this->time.get_base_time();
       timed_log_sync_pnt->label = StringUtilities::ip_strdup_wstring( this->label );
-      timed_log_sync_pnt->state = this->state;
+      timed_log_sync_pnt->state = get_state();
    }
 
    return;
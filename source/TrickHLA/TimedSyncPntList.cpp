@@ -33,9 +33,11 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // Trick include files.
 #include "trick/exec_proto.h"
@@ -62,6 +64,7 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 TimedSyncPntList::TimedSyncPntList()
+   : pending_sync_point_heap()
 {
    return;
 }
@@ -83,6 +86,40 @@ void TimedSyncPntList::add_sync_point(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
    sync_point_list.push_back( sp );
+
+   // Intern the label so lookups avoid a linear wide string scan.
+   sync_point_map[label] = sp;
+
+   // Add the point to the min-heap of pending points so the timed check
+   // and achieve paths only need to look at the front of the heap.
+   pending_sync_point_heap.push_back( sp );
+   push_heap( pending_sync_point_heap.begin(),
+              pending_sync_point_heap.end(),
+              later_action_time );
+}
+
+bool TimedSyncPntList::later_action_time(
+   TimedSyncPnt const *lhs,
+   TimedSyncPnt const *rhs )
+{
+   // std::push_heap and friends maintain a max-heap, so ordering the heap
+   // on the later action time puts the earliest pending point at the front.
+   return ( rhs->get_time() < lhs->get_time() );
+}
+
+void TimedSyncPntList::prune_achieved_heap_entries()
+{
+   // Points that were achieved through the label based base class paths are
+   // lazily dropped off the heap here, so the front entry is always the
+   // earliest point that is still pending. Points only ever move out of the
+   // pending (i.e. exists) state, never back into it.
+   while ( !pending_sync_point_heap.empty()
+           && ( pending_sync_point_heap.front()->get_state() != SYNC_PT_STATE_EXISTS ) ) {
+      pop_heap( pending_sync_point_heap.begin(),
+                pending_sync_point_heap.end(),
+                later_action_time );
+      pending_sync_point_heap.pop_back();
+   }
 }
 
 bool TimedSyncPntList::achieve_all_sync_points(
@@ -91,24 +128,40 @@ bool TimedSyncPntList::achieve_all_sync_points(
 {
    bool wasAcknowledged = false;
 
-   // When auto_unlock_mutex goes out of scope it automatically unlocks the
-   // mutex even if there is an exception.
-   MutexProtection auto_unlock_mutex( &mutex );
+   for ( ;; ) {
+      TimedSyncPnt *sp = NULL;
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::const_iterator i;
+      // Hold the mutex only long enough to pop the earliest pending point
+      // off the heap, the RTI achieve call below is made with it released.
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &mutex );
 
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         // Cast the SyncPnt pointer to a TimedSyncPnt pointer.
-         TimedSyncPnt *sp = dynamic_cast< TimedSyncPnt * >( *i );
+         prune_achieved_heap_entries();
 
-         if ( sp != NULL && sp->exists() && !sp->is_achieved() ) {
-            if ( sp->get_time() <= checkTime ) {
-               if ( this->achieve_sync_point( rti_ambassador, sp ) ) {
-                  wasAcknowledged = true;
-               }
-            }
+         if ( pending_sync_point_heap.empty()
+              || ( pending_sync_point_heap.front()->get_time() > checkTime ) ) {
+            break;
          }
+
+         sp = pending_sync_point_heap.front();
+         pop_heap( pending_sync_point_heap.begin(),
+                   pending_sync_point_heap.end(),
+                   later_action_time );
+         pending_sync_point_heap.pop_back();
+      }
+
+      if ( this->achieve_sync_point( rti_ambassador, sp ) ) {
+         wasAcknowledged = true;
+      } else if ( sp->exists() ) {
+         // The achieve did not go through and the point is still pending,
+         // so put it back on the heap to be retried on the next call.
+         MutexProtection auto_unlock_mutex( &mutex );
+         pending_sync_point_heap.push_back( sp );
+         push_heap( pending_sync_point_heap.begin(),
+                    pending_sync_point_heap.end(),
+                    later_action_time );
       }
    }
    return wasAcknowledged;
@@ -121,18 +174,54 @@ bool TimedSyncPntList::check_sync_points(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &mutex );
 
-   if ( !sync_point_list.empty() ) {
-      vector< SyncPnt * >::const_iterator i;
-      for ( i = sync_point_list.begin(); i != sync_point_list.end(); ++i ) {
-         // Cast the SyncPnt pointer to a TimedSyncPnt pointer.
-         TimedSyncPnt const *timed_i = dynamic_cast< TimedSyncPnt * >( *i );
-         if ( ( timed_i->get_state() == SYNC_PT_STATE_EXISTS )
-              && ( timed_i->get_time() <= checkTime ) ) {
-            return true;
+   prune_achieved_heap_entries();
+
+   // The heap keeps the earliest pending point at the front, so the check
+   // is a peek instead of a scan over every synchronization point.
+   return ( !pending_sync_point_heap.empty()
+            && ( pending_sync_point_heap.front()->get_time() <= checkTime ) );
+}
+
+bool TimedSyncPntList::clear_sync_point(
+   wstring const &label )
+{
+   // Purge the point from the pending heap before the base class deletes
+   // it, otherwise the heap would be left with a dangling pointer.
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      // Find the point through the interned label map so the heap entries
+      // can be matched with pointer compares instead of label compares.
+      SyncPnt const *sp = get_sync_point( label );
+      if ( sp != NULL ) {
+         vector< TimedSyncPnt * >::iterator i;
+         for ( i = pending_sync_point_heap.begin(); i != pending_sync_point_heap.end(); ++i ) {
+            if ( *i == sp ) {
+               pending_sync_point_heap.erase( i );
+               make_heap( pending_sync_point_heap.begin(),
+                          pending_sync_point_heap.end(),
+                          later_action_time );
+               break;
+            }
          }
       }
    }
-   return false;
+   return SyncPntListBase::clear_sync_point( label );
+}
+
+void TimedSyncPntList::reset()
+{
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      // The heap does not own the points, the base class reset deletes them.
+      pending_sync_point_heap.clear();
+   }
+   SyncPntListBase::reset();
 }
 
 void TimedSyncPntList::convert_sync_points( LoggableSyncPnt *sync_points )
@@ -0,0 +1,133 @@
+/*!
+@file TrickHLA/Tracepoint.cpp
+@ingroup TrickHLA
+@brief Compile-time-optional static tracepoints for the hot data path.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Tracepoint.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Tracepoint.hh"
+
+#if defined( THLA_TRACEPOINTS )
+
+// System include files.
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <pthread.h>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Define the static class variables.
+unsigned int const Tracepoint::RING_CAPACITY;
+
+namespace
+{
+
+/*! @brief One recorded trace event. The name is a string literal so only
+ * the pointer is stored. */
+struct TraceEvent {
+   int64_t       timestamp_us; ///< Wall-clock timestamp in microseconds.
+   char const   *name;         ///< Event name string literal.
+   unsigned long thread_id;    ///< Identifier of the recording thread.
+   char          phase;        ///< Chrome-tracing phase: 'B', 'E' or 'i'.
+};
+
+// The ring and its write index. The index grows without bound and is
+// masked into the ring, so the oldest events are overwritten once the
+// ring is full.
+TraceEvent                   trace_ring[Tracepoint::RING_CAPACITY];
+atomic< unsigned long long > trace_next_index( 0 );
+
+} // namespace
+
+/*!
+ * @details A torn event can be recorded if the ring wraps while another
+ * thread is still writing the same slot, which is acceptable for a
+ * diagnostic trace and keeps this a lock-free single atomic increment on
+ * the hot path.
+ */
+void Tracepoint::record(
+   char const *name,
+   char const  phase )
+{
+   unsigned long long const seq = trace_next_index.fetch_add( 1, memory_order_relaxed );
+
+   TraceEvent &event   = trace_ring[seq & (unsigned long long)( RING_CAPACITY - 1 )];
+   event.timestamp_us  = clock_wall_time(); // in microseconds
+   event.name          = name;
+   event.thread_id     = (unsigned long)pthread_self();
+   event.phase         = phase;
+}
+
+/*!
+ * @details The file uses the Chrome-tracing JSON array format, which both
+ * chrome://tracing and the Perfetto UI load directly.
+ */
+void Tracepoint::dump(
+   char const *path )
+{
+   ofstream trace_file( path );
+   if ( !trace_file.is_open() ) {
+      send_hs( stderr, "Tracepoint::dump():%d ERROR: Failed to open trace file '%s' for writing.%c",
+               __LINE__, path, THLA_NEWLINE );
+      return;
+   }
+
+   unsigned long long const total = trace_next_index.load( memory_order_relaxed );
+   unsigned long long const count = ( total < (unsigned long long)RING_CAPACITY )
+                                       ? total
+                                       : (unsigned long long)RING_CAPACITY;
+   unsigned long long const first = total - count;
+
+   trace_file << "{\"traceEvents\":[\n";
+   for ( unsigned long long i = 0; i < count; ++i ) {
+      TraceEvent const &event = trace_ring[( first + i ) & (unsigned long long)( RING_CAPACITY - 1 )];
+      if ( event.name == NULL ) {
+         continue;
+      }
+      if ( i > 0 ) {
+         trace_file << ",\n";
+      }
+      trace_file << "{\"cat\":\"trickhla\",\"pid\":1"
+                 << ",\"tid\":" << event.thread_id
+                 << ",\"ts\":" << event.timestamp_us
+                 << ",\"ph\":\"" << event.phase << "\"";
+      if ( event.phase == 'i' ) {
+         trace_file << ",\"s\":\"t\"";
+      }
+      trace_file << ",\"name\":\"" << event.name << "\"}";
+   }
+   trace_file << "\n]}\n";
+   trace_file.close();
+
+   send_hs( stdout, "Tracepoint::dump():%d Wrote %llu trace events to '%s'.%c",
+            __LINE__, count, path, THLA_NEWLINE );
+}
+
+#endif // THLA_TRACEPOINTS
@@ -23,8 +23,10 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Object.cpp}
+@trick_link_dependency{ShardedElapsedTimeStats.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
 @trick_link_dependency{TrickThreadCoordinator.cpp}
+@trick_link_dependency{Tracepoint.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -37,13 +39,26 @@ thread data cycle time being longer than the main thread data cycle time.}
 */
 
 // System include files.
+#include <algorithm>
+#include <atomic>
+#include <climits>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <new>
 #include <sstream>
 #include <string>
+#include <time.h>
+#include <vector>
+
+// System include files for the futex based thread state waits.
+#if defined( __linux__ )
+#   include <linux/futex.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
 
 // Trick include files.
 #include "trick/MemoryManager.hh"
@@ -61,8 +76,10 @@ thread data cycle time being longer than the main thread data cycle time.}
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/ShardedElapsedTimeStats.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Tracepoint.hh"
 #include "TrickHLA/TrickThreadCoordinator.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -70,6 +87,100 @@ thread data cycle time being longer than the main thread data cycle time.}
 using namespace std;
 using namespace TrickHLA;
 
+// Define the adaptive data job scheduling tuning constants. The filter gain
+// smooths the per-object job times so one noisy sample does not reorder the
+// schedule, and the hysteresis keeps a rebalance from being adopted unless
+// the predicted batch completion time improves by more than this fraction.
+double const TrickThreadCoordinator::JOB_COST_FILTER_GAIN     = 0.25;
+double const TrickThreadCoordinator::JOB_REBALANCE_HYSTERESIS = 0.10;
+
+namespace
+{
+
+// Bound each blocking thread state wait so the shutdown and execution
+// member checks in the wait loops stay responsive even if a wakeup is
+// somehow missed.
+long const THREAD_STATE_WAIT_TIMEOUT_MICROS = 10000;
+
+#if defined( __linux__ )
+
+// The per-thread coordination state words are 32-bit atomics in their own
+// cache lines, which is exactly the shape the Linux futex API operates on.
+// The wait functions below block in the kernel directly on the state word,
+// with no mutex and no fixed sleep quantum, and the announce side wakes
+// the blocked threads at kernel futex cost. The kernel atomically rechecks
+// the word against the last seen value before blocking, so a wake between
+// the caller's load and the wait call is never lost.
+static_assert( sizeof( std::atomic< unsigned int > ) == sizeof( uint32_t ),
+               "The futex thread state wait requires a 32-bit state word." );
+
+/*! @brief Block until the thread state word changes from the last seen
+ *  value, bounded by the timeout. Returns immediately if the word has
+ *  already changed, and spurious wakeups are fine because every caller
+ *  rechecks the state in a loop.
+ *  @param state          Thread coordination state word to wait on.
+ *  @param last_seen      State value the caller observed as not ready.
+ *  @param timeout_micros Maximum time to block in microseconds. */
+void thread_state_wait(
+   std::atomic< unsigned int > const &state,
+   unsigned int const                 last_seen,
+   long const                         timeout_micros )
+{
+   struct timespec timeout;
+   timeout.tv_sec  = timeout_micros / 1000000L;
+   timeout.tv_nsec = ( timeout_micros % 1000000L ) * 1000L;
+
+   syscall( SYS_futex,
+            reinterpret_cast< uint32_t const * >( &state ),
+            FUTEX_WAIT_PRIVATE,
+            last_seen,
+            &timeout,
+            NULL,
+            0 );
+}
+
+/*! @brief Wake threads blocked in thread_state_wait() on the state word.
+ *  @param state       Thread coordination state word that was updated.
+ *  @param max_waiters Maximum number of waiting threads to wake. */
+void thread_state_wake(
+   std::atomic< unsigned int > const &state,
+   int const                          max_waiters )
+{
+   syscall( SYS_futex,
+            reinterpret_cast< uint32_t const * >( &state ),
+            FUTEX_WAKE_PRIVATE,
+            max_waiters,
+            NULL,
+            NULL,
+            0 );
+}
+
+#else
+
+// Fallback for platforms without the futex API: the wait degrades to the
+// original low latency polling sleep and the wake is a no-op, which keeps
+// the handshake correct because every wait site rechecks the state word
+// in a loop.
+
+void thread_state_wait(
+   std::atomic< unsigned int > const &,
+   unsigned int const,
+   long const )
+{
+   Utilities::micro_sleep( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+}
+
+void thread_state_wake(
+   std::atomic< unsigned int > const &,
+   int const )
+{
+   return;
+}
+
+#endif // __linux__
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
@@ -80,12 +191,37 @@ TrickThreadCoordinator::TrickThreadCoordinator() // RETURN: -- None.
      any_child_thread_associated( false ),
      disable_thread_ids( NULL ),
      thread_cnt( 0 ),
+     first_touch_pending_per_thread( NULL ),
      thread_state( NULL ),
      data_cycle_base_time_per_thread( NULL ),
      data_cycle_base_time_per_obj( NULL ),
-     main_thread_data_cycle_base_time( 0LL )
+     time_in_cycle_per_obj( NULL ),
+     send_phase_in_cycle_per_obj( NULL ),
+     data_cycle_schedule_sim_time( -1LL ),
+     data_cycle_schedule_step( 0LL ),
+     main_thread_data_cycle_base_time( 0LL ),
+     worker_cnt( 0 ),
+     worker_threads( NULL ),
+     job_fn( NULL ),
+     job_user_data( NULL ),
+     job_count( 0 ),
+     job_next_index( 0 ),
+     job_remaining( 0 ),
+     job_generation( 0 ),
+     job_shutdown( false ),
+     job_batch_active( false ),
+     adaptive_job_scheduling( false ),
+     job_rebalance_period( 64 ),
+     job_batches_since_rebalance( 0 ),
+     job_schedule_active( false ),
+     job_schedule(),
+     job_cost_avg(),
+     job_time_stats()
 {
-   return;
+   // Initialize the data job dispatch synchronization primitives.
+   pthread_mutex_init( &job_mutex, NULL );
+   pthread_cond_init( &job_start_cond, NULL );
+   pthread_cond_init( &job_done_cond, NULL );
 }
 
 /*!
@@ -93,6 +229,12 @@ TrickThreadCoordinator::TrickThreadCoordinator() // RETURN: -- None.
  */
 TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
 {
+   // Shutdown the data job worker pool if it was created.
+   shutdown_data_job_workers();
+   pthread_cond_destroy( &job_done_cond );
+   pthread_cond_destroy( &job_start_cond );
+   pthread_mutex_destroy( &job_mutex );
+
    if ( this->disable_thread_ids != NULL ) {
       if ( trick_MM->delete_var( static_cast< void * >( this->disable_thread_ids ) ) ) {
          send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->disable_thread_ids'%c",
@@ -101,14 +243,19 @@ TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
       this->disable_thread_ids = NULL;
    }
 
-   // Release the arrays.
+   // Release the arrays. The thread state array is a plain heap allocation
+   // because the cache-line padded atomic states are not Trick checkpointable.
    if ( this->thread_state != NULL ) {
       this->thread_cnt = 0;
-      if ( trick_MM->delete_var( static_cast< void * >( this->thread_state ) ) ) {
-         send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->thread_state'%c",
+      delete[] this->thread_state;
+      this->thread_state = NULL;
+   }
+   if ( this->first_touch_pending_per_thread != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( this->first_touch_pending_per_thread ) ) ) {
+         send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->first_touch_pending_per_thread'%c",
                   __LINE__, THLA_NEWLINE );
       }
-      this->thread_state = NULL;
+      this->first_touch_pending_per_thread = NULL;
    }
    if ( this->data_cycle_base_time_per_thread != NULL ) {
       if ( trick_MM->delete_var( static_cast< void * >( this->data_cycle_base_time_per_thread ) ) ) {
@@ -124,6 +271,20 @@ TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
       }
       this->data_cycle_base_time_per_obj = NULL;
    }
+   if ( this->time_in_cycle_per_obj != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( this->time_in_cycle_per_obj ) ) ) {
+         send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->time_in_cycle_per_obj'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      this->time_in_cycle_per_obj = NULL;
+   }
+   if ( this->send_phase_in_cycle_per_obj != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( this->send_phase_in_cycle_per_obj ) ) ) {
+         send_hs( stderr, "TrickThreadCoordinator::~TrickThreadCoordinator():%d ERROR deleting Trick Memory for 'this->send_phase_in_cycle_per_obj'%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+      this->send_phase_in_cycle_per_obj = NULL;
+   }
 
    // Make sure we destroy the mutex.
    this->mutex.destroy();
@@ -229,8 +390,10 @@ void TrickThreadCoordinator::initialize(
       this->thread_cnt = 1;
    }
 
-   // Allocate the thread state array for all the Trick threads (main + child).
-   this->thread_state = static_cast< unsigned int * >( TMM_declare_var_1d( "unsigned int", this->thread_cnt ) );
+   // Allocate the thread state array for all the Trick threads (main + child)
+   // with each per-thread atomic state padded out to its own cache line so
+   // the threads don't false-share when polling each others state.
+   this->thread_state = new ( nothrow ) AlignedThreadState[this->thread_cnt];
    if ( this->thread_state == NULL ) {
       ostringstream errmsg;
       errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
@@ -244,7 +407,7 @@ void TrickThreadCoordinator::initialize(
    // We don't know if the Child threads are running TrickHLA jobs yet so
    // mark them all as not associated.
    for ( unsigned int thread_id = 0; thread_id < this->thread_cnt; ++thread_id ) {
-      this->thread_state[thread_id] = THREAD_STATE_NOT_ASSOCIATED;
+      this->thread_state[thread_id].state.store( THREAD_STATE_NOT_ASSOCIATED, std::memory_order_release );
    }
 
    // Disable Trick thread ID associations as configured in the input file.
@@ -268,7 +431,7 @@ void TrickThreadCoordinator::initialize(
          if ( ( thread_id >= 1 ) && ( thread_id < this->thread_cnt ) ) {
             // Disable any Trick child thread associations for this ID include
             // any API's for this child thread.
-            this->thread_state[thread_id] = THREAD_STATE_DISABLED;
+            this->thread_state[thread_id].state.store( THREAD_STATE_DISABLED, std::memory_order_release );
 
             if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
                send_hs( stdout, "TrickThreadCoordinator::initialize():%d Disabled Trick child thread association (thread-id:%d).%c",
@@ -311,6 +474,21 @@ void TrickThreadCoordinator::initialize(
       this->data_cycle_base_time_per_thread[thread_id] = 0LL;
    }
 
+   // Allocate memory for the per-thread pending NUMA first-touch flags.
+   this->first_touch_pending_per_thread = static_cast< bool * >( TMM_declare_var_1d( "bool", this->thread_cnt ) );
+   if ( this->first_touch_pending_per_thread == NULL ) {
+      ostringstream errmsg;
+      errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
+             << " ERROR: Could not allocate memory for 'first_touch_pending_per_thread'"
+             << " for requested size " << this->thread_cnt
+             << "!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      exit( 1 );
+   }
+   for ( unsigned int thread_id = 0; thread_id < this->thread_cnt; ++thread_id ) {
+      this->first_touch_pending_per_thread[thread_id] = false;
+   }
+
    // Allocate memory for the data cycle times per each object instance.
    if ( this->manager->obj_count > 0 ) {
       this->data_cycle_base_time_per_obj = static_cast< long long * >( TMM_declare_var_1d( "long long", this->manager->obj_count ) );
@@ -326,6 +504,33 @@ void TrickThreadCoordinator::initialize(
       for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
          this->data_cycle_base_time_per_obj[obj_index] = 0LL;
       }
+
+      // Allocate memory for the precomputed per-object data cycle schedule
+      // tables used by the data cycle boundary checks.
+      this->time_in_cycle_per_obj = static_cast< long long * >( TMM_declare_var_1d( "long long", this->manager->obj_count ) );
+      if ( this->time_in_cycle_per_obj == NULL ) {
+         ostringstream errmsg;
+         errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
+                << " ERROR: Could not allocate memory for 'time_in_cycle_per_obj'"
+                << " for requested size " << this->manager->obj_count
+                << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         exit( 1 );
+      }
+      this->send_phase_in_cycle_per_obj = static_cast< long long * >( TMM_declare_var_1d( "long long", this->manager->obj_count ) );
+      if ( this->send_phase_in_cycle_per_obj == NULL ) {
+         ostringstream errmsg;
+         errmsg << "TrickThreadCoordinator::initialize():" << __LINE__
+                << " ERROR: Could not allocate memory for 'send_phase_in_cycle_per_obj'"
+                << " for requested size " << this->manager->obj_count
+                << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         exit( 1 );
+      }
+      for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+         this->time_in_cycle_per_obj[obj_index]       = 0LL;
+         this->send_phase_in_cycle_per_obj[obj_index] = 0LL;
+      }
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
@@ -355,6 +560,18 @@ void TrickThreadCoordinator::disable_trick_thread_associations(
 void TrickThreadCoordinator::associate_to_trick_child_thread(
    unsigned int const thread_id,
    double const       data_cycle )
+{
+   associate_to_trick_child_thread( thread_id, data_cycle, -1 );
+}
+
+/*!
+ * @brief Associate a Trick child thread with TrickHLA, with optional CPU
+ * affinity pinning for NUMA node-local buffer placement.
+ */
+void TrickThreadCoordinator::associate_to_trick_child_thread(
+   unsigned int const thread_id,
+   double const       data_cycle,
+   int const          cpu_id )
 {
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
@@ -396,7 +613,7 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
    }
 
    // Just return if this trick child thread association has been disabled.
-   if ( this->thread_state[thread_id] == THREAD_STATE_DISABLED ) {
+   if ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) == THREAD_STATE_DISABLED ) {
       if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
          send_hs( stdout, "TrickThreadCoordinator::associate_to_trick_child_thread():%d Disabled thread_id:%d.%c",
                   __LINE__, thread_id, THLA_NEWLINE );
@@ -405,7 +622,7 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
    }
 
    // We do not support more than one thread association to the same thread-id.
-   if ( this->thread_state[thread_id] != THREAD_STATE_NOT_ASSOCIATED ) {
+   if ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) != THREAD_STATE_NOT_ASSOCIATED ) {
       ostringstream errmsg;
       errmsg << "TrickThreadCoordinator::associate_to_trick_child_thread():" << __LINE__
              << " ERROR: You can not associate the same Trick "
@@ -534,6 +751,26 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
                    << " ensure data coherency." << THLA_ENDL;
             DebugHandler::terminate_with_message( errmsg.str() );
 
+         } else if ( ( thread_id != 0 )
+                     && ( this->manager->objects[obj_index].send_phase_offset_time != 0.0 ) ) {
+            // Data for an object associated to a Trick child thread is only
+            // coherent on the child thread frame boundary, so a send phase
+            // offset cannot be used.
+            ostringstream errmsg;
+            errmsg << "TrickThreadCoordinator::associate_to_trick_child_thread():" << __LINE__
+                   << " ERROR: For the object instance name '"
+                   << this->manager->objects[obj_index].get_name()
+                   << "', a send phase offset time ("
+                   << setprecision( 18 )
+                   << this->manager->objects[obj_index].send_phase_offset_time
+                   << ") was specified for an object associated to a Trick"
+                   << " child thread (thread-id:" << thread_id << "). Send"
+                   << " phase staggering is only supported for objects"
+                   << " associated to the Trick main thread because child"
+                   << " thread data is only coherent on the child thread"
+                   << " frame boundary." << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+
          } else {
             summary << "  thread-id:" << thread_id
                     << "  data_cycle:" << setprecision( 18 ) << data_cycle
@@ -544,6 +781,14 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
 
             this->data_cycle_base_time_per_thread[thread_id] = data_cycle_base_time;
             this->data_cycle_base_time_per_obj[obj_index]    = data_cycle_base_time;
+
+            // The cycle time for this object changed, so force a rebuild of
+            // the precomputed data cycle schedule tables on the next advance.
+            this->data_cycle_schedule_sim_time = -1LL;
+
+            // The per cycle-time object iteration lists in the Manager are
+            // keyed on the object cycle times, so they are stale now too.
+            this->manager->invalidate_data_cycle_groups();
          }
       }
    }
@@ -579,7 +824,7 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
    }
 
    // Make sure we mark the thread state as reset now that we associated to it.
-   this->thread_state[thread_id] = THREAD_STATE_RESET;
+   this->thread_state[thread_id].state.store( THREAD_STATE_RESET, std::memory_order_release );
 
    if ( thread_id == 0 ) {
       // Ensure we set the data cycle time for the main thread even if no
@@ -662,6 +907,28 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
          }
       }
    }
+
+   // Optionally pin the Trick thread to the specified CPU so the thread
+   // stays on one NUMA node, and mark the thread to fault in the staging
+   // buffers of its associated objects on its first data cycle so the
+   // buffer pages are placed on that node by the operating system's
+   // first-touch placement policy.
+   if ( cpu_id >= 0 ) {
+      Trick::Threads *trick_thread = exec_get_exec_cpp()->get_thread( thread_id );
+      if ( trick_thread != NULL ) {
+         trick_thread->cpu_set( cpu_id );
+         trick_thread->execute_cpu_affinity();
+
+         if ( this->first_touch_pending_per_thread != NULL ) {
+            this->first_touch_pending_per_thread[thread_id] = true;
+         }
+
+         if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+            send_hs( stdout, "TrickThreadCoordinator::associate_to_trick_child_thread():%d Pinned thread-id:%d to CPU:%d.%c",
+                     __LINE__, thread_id, cpu_id, THLA_NEWLINE );
+         }
+      }
+   }
 }
 
 /*!
@@ -690,7 +957,7 @@ void TrickThreadCoordinator::verify_trick_thread_associations()
          for ( unsigned int thread_id = 0; thread_id < this->thread_cnt; ++thread_id ) {
             summary << thread_id << "\t  ";
 
-            switch ( this->thread_state[thread_id] ) {
+            switch ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) ) {
                case THREAD_STATE_DISABLED:
                   summary << "(Disabled thread associated to TrickHLA)";
                   break;
@@ -738,7 +1005,7 @@ void TrickThreadCoordinator::verify_trick_thread_associations()
    for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
       for ( unsigned int thread_id = 0; thread_id < this->manager->objects[obj_index].thread_ids_array_count; ++thread_id ) {
 
-         if ( ( this->thread_state[thread_id] != THREAD_STATE_DISABLED )
+         if ( ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) != THREAD_STATE_DISABLED )
               && this->manager->objects[obj_index].thread_ids_array[thread_id]
               && ( this->data_cycle_base_time_per_thread[thread_id] == 0LL ) ) {
             ostringstream errmsg;
@@ -769,23 +1036,29 @@ void TrickThreadCoordinator::announce_data_available()
 
       int64_t const sim_time_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
 
-      // When auto_unlock_mutex goes out of scope it automatically unlocks the
-      // mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
+      // Lock-free: each per-thread state is in its own cache line and is
+      // updated with a release store, so no mutex is needed and the waiting
+      // threads never block this announcement.
+      //
       // Process all the Trick child threads associated to TrickHLA first
       // and only for threads on the data cycle time boundary.
       for ( unsigned int thread_id = 1; thread_id < this->thread_cnt; ++thread_id ) {
-         if ( ( this->thread_state[thread_id] != THREAD_STATE_DISABLED )
-              && ( this->thread_state[thread_id] != THREAD_STATE_NOT_ASSOCIATED )
+         unsigned int const state = this->thread_state[thread_id].state.load( std::memory_order_relaxed );
+         if ( ( state != THREAD_STATE_DISABLED )
+              && ( state != THREAD_STATE_NOT_ASSOCIATED )
               && on_receive_data_cycle_boundary_for_thread( thread_id, sim_time_base_time ) ) {
 
-            this->thread_state[thread_id] = THREAD_STATE_READY_TO_RECEIVE;
+            this->thread_state[thread_id].state.store( THREAD_STATE_READY_TO_RECEIVE, std::memory_order_release );
          }
       }
 
-      // Set the state of the Trick main thread last.
-      this->thread_state[0] = THREAD_STATE_READY_TO_RECEIVE;
+      // Set the state of the Trick main thread last with a release store,
+      // which also publishes the child thread states set above to any thread
+      // that does an acquire load of the main thread state.
+      this->thread_state[0].state.store( THREAD_STATE_READY_TO_RECEIVE, std::memory_order_release );
+
+      // Wake every child thread blocked on the main thread state word.
+      thread_state_wake( this->thread_state[0].state, INT_MAX );
    }
 }
 
@@ -802,12 +1075,13 @@ void TrickThreadCoordinator::announce_data_sent()
    // Process Trick child thread states associated to TrickHLA.
    if ( this->any_child_thread_associated ) {
 
-      // When auto_unlock_mutex goes out of scope it automatically unlocks the
-      // mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
+      // Set the state of the main thread as ready to send. The release
+      // store pairs with the acquire loads in the child thread wait
+      // functions, so no mutex is needed.
+      this->thread_state[0].state.store( THREAD_STATE_READY_TO_SEND, std::memory_order_release );
 
-      // Set the state of the main thread as ready to send.
-      this->thread_state[0] = THREAD_STATE_READY_TO_SEND;
+      // Wake every child thread blocked on the main thread state word.
+      thread_state_wake( this->thread_state[0].state, INT_MAX );
    }
 }
 
@@ -818,6 +1092,9 @@ void TrickThreadCoordinator::announce_data_sent()
  */
 void TrickThreadCoordinator::wait_to_send_data()
 {
+   // Trace the send-side thread coordination barrier.
+   THLA_TRACEPOINT_SCOPE( "TrickThreadCoordinator::wait_to_send_data" );
+
 
    if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
       send_hs( stdout, "TrickThreadCoordinator::wait_to_send_data():%d%c",
@@ -865,13 +1142,11 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
    // Trick Main Thread: Take a quick first look to determine if all the
    // Trick child threads associated to TrickHLA are ready to send data.
    // If all the child threads are ready to send data then this quick look
-   // will return faster than the more involved spin-lock code section
-   // further below with the sleep code.
+   // will return faster than the blocking wait code section further below.
    bool all_ready_to_send = true;
    {
-      // When auto_unlock_mutex goes out of scope it automatically
-      // unlocks the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
+      // Lock-free: a single acquire load of each per-thread state, which
+      // pairs with the release stores in the child thread wait functions.
 
       // Check all the associated thread-id's.
       while ( ( thread_id < this->thread_cnt ) && all_ready_to_send ) {
@@ -884,9 +1159,10 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
          // from the current thread-id. Skip this child thread if it is not
          // scheduled to run at the same time as the main thread for this job.
          // Also skip if this thread is not on a data cycle boundary.
-         if ( ( this->thread_state[thread_id] == THREAD_STATE_READY_TO_SEND )
-              || ( this->thread_state[thread_id] == THREAD_STATE_DISABLED )
-              || ( this->thread_state[thread_id] == THREAD_STATE_NOT_ASSOCIATED )
+         unsigned int const state = this->thread_state[thread_id].state.load( std::memory_order_acquire );
+         if ( ( state == THREAD_STATE_READY_TO_SEND )
+              || ( state == THREAD_STATE_DISABLED )
+              || ( state == THREAD_STATE_NOT_ASSOCIATED )
               || !on_send_data_cycle_boundary_for_thread( thread_id, sim_time_in_base_time ) ) {
             // Move to the next thread-id because the current ID is
             // ready. This results in checking all the ID's just once.
@@ -898,13 +1174,13 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
       }
    }
 
-   // If the quick look was not successful do a more involved spin-lock with
-   // sleeps, which adds more wait latency.
+   // If the quick look was not successful then block on the state word of
+   // the child thread we are waiting on, waking as soon as it changes.
    if ( !all_ready_to_send ) {
 
       int64_t      wallclock_time;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout wait_timer;
 
       // Wait for all Trick child threads associated to TrickHLA to be
       // ready to send data.
@@ -913,15 +1189,20 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
+         // Block on the state word of the child thread that is not ready
+         // yet, with a bounded wait so the shutdown and execution member
+         // checks below stay responsive. Skip the wait if the state has
+         // already changed since the last scan.
+         unsigned int const last_seen = this->thread_state[thread_id].state.load( std::memory_order_acquire );
+         if ( last_seen != THREAD_STATE_READY_TO_SEND ) {
+            thread_state_wait( this->thread_state[thread_id].state,
+                               last_seen,
+                               THREAD_STATE_WAIT_TIMEOUT_MICROS );
+         }
 
          // Determine if all the Trick child threads are ready to send data.
          all_ready_to_send = true;
          {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
             // Check all the associated thread-id's.
             while ( ( thread_id < this->thread_cnt ) && all_ready_to_send ) {
 
@@ -934,9 +1215,10 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
                // thread if it is not scheduled to run at the same time as the
                // main thread for this job.
                // Also skip if this thread is not on a data cycle boundary.
-               if ( ( this->thread_state[thread_id] == THREAD_STATE_READY_TO_SEND )
-                    || ( this->thread_state[thread_id] == THREAD_STATE_DISABLED )
-                    || ( this->thread_state[thread_id] == THREAD_STATE_NOT_ASSOCIATED )
+               unsigned int const state = this->thread_state[thread_id].state.load( std::memory_order_acquire );
+               if ( ( state == THREAD_STATE_READY_TO_SEND )
+                    || ( state == THREAD_STATE_DISABLED )
+                    || ( state == THREAD_STATE_NOT_ASSOCIATED )
                     || !on_send_data_cycle_boundary_for_thread( thread_id, sim_time_in_base_time ) ) {
                   // Move to the next thread-id because the current ID is
                   // ready. This results in checking all the ID's just once.
@@ -951,10 +1233,10 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
          if ( !all_ready_to_send ) {
 
             // To be more efficient, we get the time once and share it.
-            wallclock_time = sleep_timer.time();
+            wallclock_time = wait_timer.time();
 
-            if ( sleep_timer.timeout( wallclock_time ) ) {
-               sleep_timer.reset();
+            if ( wait_timer.timeout( wallclock_time ) ) {
+               wait_timer.reset();
                if ( !this->federate->is_execution_member() ) {
                   ostringstream errmsg;
                   errmsg << "TrickThreadCoordinator::wait_to_send_data_for_main_thread():" << __LINE__
@@ -990,7 +1272,7 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
    unsigned int const thread_id )
 {
    // Just return if this thread association is disabled.
-   if ( this->thread_state[thread_id] == THREAD_STATE_DISABLED ) {
+   if ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) == THREAD_STATE_DISABLED ) {
       if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
          send_hs( stdout, "TrickThreadCoordinator::wait_to_send_data_for_child_thread():%d Child Thread:%d, Disabled, Done%c",
                   __LINE__, thread_id, THLA_NEWLINE );
@@ -1010,48 +1292,51 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
    // the HLA data.
    bool sent_data;
    {
-      // When auto_unlock_mutex goes out of scope it automatically unlocks
-      // the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
+      // Mark this child thread as ready to send. The release store pairs
+      // with the acquire loads in the main thread wait function, so no
+      // mutex is needed.
+      this->thread_state[thread_id].state.store( THREAD_STATE_READY_TO_SEND, std::memory_order_release );
 
-      // Mark this child thread as ready to send.
-      this->thread_state[thread_id] = THREAD_STATE_READY_TO_SEND;
+      // Wake the main thread if it is blocked on this thread's state word.
+      thread_state_wake( this->thread_state[thread_id].state, 1 );
 
-      // Determine if all the data has been sent by the main thread.
-      sent_data = ( this->thread_state[0] == THREAD_STATE_READY_TO_SEND );
+      // Determine if all the data has been sent by the main thread with a
+      // single acquire load of the main thread state.
+      sent_data = ( this->thread_state[0].state.load( std::memory_order_acquire ) == THREAD_STATE_READY_TO_SEND );
    }
 
    // If the quick look to see if the main thread has announced it has sent
-   // the data has not succeeded then do a more involved spin-lock with a
-   // sleep. This will have more wait latency.
+   // the data has not succeeded then block on the main thread state word,
+   // waking as soon as the announcement is made.
    if ( !sent_data ) {
 
       int64_t      wallclock_time;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout wait_timer;
 
       // Wait for the main thread to have sent the data.
       do {
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
-
-         {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            sent_data = ( this->thread_state[0] == THREAD_STATE_READY_TO_SEND );
+         // Block on the main thread state word, with a bounded wait so the
+         // shutdown and execution member checks below stay responsive.
+         unsigned int const last_seen = this->thread_state[0].state.load( std::memory_order_acquire );
+         if ( last_seen != THREAD_STATE_READY_TO_SEND ) {
+            thread_state_wait( this->thread_state[0].state,
+                               last_seen,
+                               THREAD_STATE_WAIT_TIMEOUT_MICROS );
          }
 
+         sent_data = ( this->thread_state[0].state.load( std::memory_order_acquire ) == THREAD_STATE_READY_TO_SEND );
+
          if ( !sent_data ) {
 
             // To be more efficient, we get the time once and share it.
-            wallclock_time = sleep_timer.time();
+            wallclock_time = wait_timer.time();
 
-            if ( sleep_timer.timeout( wallclock_time ) ) {
-               sleep_timer.reset();
+            if ( wait_timer.timeout( wallclock_time ) ) {
+               wait_timer.reset();
                if ( !this->federate->is_execution_member() ) {
                   ostringstream errmsg;
                   errmsg << "TrickThreadCoordinator::wait_to_send_data_for_child_thread():" << __LINE__
@@ -1080,9 +1365,27 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
    }
 }
 
+/*!
+ * @brief Fault in the staging buffers of the objects associated to the
+ * specified thread from the calling thread, for NUMA first-touch page
+ * placement.
+ */
+void TrickThreadCoordinator::first_touch_associated_object_buffers(
+   unsigned int const thread_id )
+{
+   for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+      if ( this->manager->objects[obj_index].is_thread_associated( thread_id ) ) {
+         this->manager->objects[obj_index].first_touch_buffers();
+      }
+   }
+}
+
 /*! @brief Wait to receive data when the Trick main thread is ready. */
 void TrickThreadCoordinator::wait_to_receive_data()
 {
+   // Trace the receive-side thread coordination barrier.
+   THLA_TRACEPOINT_SCOPE( "TrickThreadCoordinator::wait_to_receive_data" );
+
    // Don't process Trick child thread states associated to TrickHLA if none exist.
    if ( !this->any_child_thread_associated ) {
       if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
@@ -1096,7 +1399,7 @@ void TrickThreadCoordinator::wait_to_receive_data()
    unsigned int const thread_id = exec_get_process_id();
 
    // Just return if this thread association is disabled.
-   if ( this->thread_state[thread_id] == THREAD_STATE_DISABLED ) {
+   if ( this->thread_state[thread_id].state.load( std::memory_order_acquire ) == THREAD_STATE_DISABLED ) {
       if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
          send_hs( stdout, "TrickThreadCoordinator::wait_to_receive_data():%d %s Thread:%d, Disabled, Done%c",
                   __LINE__, ( ( thread_id == 0 ) ? "Main" : "Child" ),
@@ -1105,50 +1408,57 @@ void TrickThreadCoordinator::wait_to_receive_data()
       return;
    }
 
+   // One-time fault-in of the staging buffers of the objects associated to
+   // this pinned thread, so the operating system places the buffer pages on
+   // this thread's NUMA node under the first-touch placement policy.
+   if ( ( this->first_touch_pending_per_thread != NULL )
+        && this->first_touch_pending_per_thread[thread_id] ) {
+      this->first_touch_pending_per_thread[thread_id] = false;
+      first_touch_associated_object_buffers( thread_id );
+   }
+
    if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
       send_hs( stdout, "TrickThreadCoordinator::wait_to_receive_data():%d %s Thread:%d, waiting...%c",
                __LINE__, ( ( thread_id == 0 ) ? "Main" : "Child" ),
                thread_id, THLA_NEWLINE );
    }
 
-   bool ready_to_receive;
-   {
-      // When auto_unlock_mutex goes out of scope it automatically unlocks
-      // the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
-      ready_to_receive = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
-   }
+   // The common "data ready?" check is a single acquire load of the main
+   // thread state, which pairs with the release store made by the main
+   // thread in announce_data_available() and also publishes the per-thread
+   // states the main thread set before it.
+   bool ready_to_receive = ( this->thread_state[0].state.load( std::memory_order_acquire ) == THREAD_STATE_READY_TO_RECEIVE );
 
    // See if the main thread has announced it has received data.
    if ( !ready_to_receive ) {
 
       int64_t      wallclock_time;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout wait_timer;
 
       // Wait for the main thread to receive data.
       do {
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         sleep_timer.sleep();
-
-         {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            ready_to_receive = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
+         // Block on the main thread state word, with a bounded wait so the
+         // shutdown and execution member checks below stay responsive.
+         unsigned int const last_seen = this->thread_state[0].state.load( std::memory_order_acquire );
+         if ( last_seen != THREAD_STATE_READY_TO_RECEIVE ) {
+            thread_state_wait( this->thread_state[0].state,
+                               last_seen,
+                               THREAD_STATE_WAIT_TIMEOUT_MICROS );
          }
 
+         ready_to_receive = ( this->thread_state[0].state.load( std::memory_order_acquire ) == THREAD_STATE_READY_TO_RECEIVE );
+
          if ( !ready_to_receive ) {
 
             // To be more efficient, we get the time once and share it.
-            wallclock_time = sleep_timer.time();
+            wallclock_time = wait_timer.time();
 
-            if ( sleep_timer.timeout( wallclock_time ) ) {
-               sleep_timer.reset();
+            if ( wait_timer.timeout( wallclock_time ) ) {
+               wait_timer.reset();
                if ( !this->federate->is_execution_member() ) {
                   ostringstream errmsg;
                   errmsg << "TrickThreadCoordinator::wait_to_receive_data():" << __LINE__
@@ -1179,17 +1489,120 @@ void TrickThreadCoordinator::wait_to_receive_data()
    }
 }
 
+/*!
+ * @details Advances the precomputed per-object schedule tables so that the
+ * data cycle boundary checks answer with a table compare instead of a 64-bit
+ * modulo per object per frame. In steady state, where the simulation time
+ * advances by the same step as the previous call, each object's position
+ * within its data cycle is advanced with an increment-and-wrap and no
+ * divisions are performed. Any irregular step (the first call, a freeze, a
+ * checkpoint restore or a job rate change) rebuilds the tables with modulo
+ * arithmetic, which also refreshes the reduced per-object send phase
+ * offsets. Calling this again for the same simulation time is a no-op, so
+ * both the send and receive data jobs can advance the schedule for the same
+ * frame. This must be called from the Trick main thread before the data job
+ * worker threads make the boundary checks for the same simulation time.
+ */
+void TrickThreadCoordinator::advance_data_cycle_schedule(
+   int64_t const sim_time_in_base_time )
+{
+   // Nothing to advance when no objects are associated to Trick threads.
+   if ( !this->any_child_thread_associated
+        || ( this->data_cycle_base_time_per_obj == NULL )
+        || ( this->time_in_cycle_per_obj == NULL ) ) {
+      return;
+   }
+
+   // The schedule tables are already advanced to this simulation time.
+   if ( sim_time_in_base_time == this->data_cycle_schedule_sim_time ) {
+      return;
+   }
+
+   int64_t const step = sim_time_in_base_time - this->data_cycle_schedule_sim_time;
+
+   if ( ( step > 0LL ) && ( step == this->data_cycle_schedule_step ) ) {
+      // Steady state: advance the position of each object within its data
+      // cycle with an increment-and-wrap, zero divisions.
+      for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+         int64_t const data_cycle = this->data_cycle_base_time_per_obj[obj_index];
+         if ( data_cycle > 0LL ) {
+            long long time_in_cycle = this->time_in_cycle_per_obj[obj_index] + step;
+            while ( time_in_cycle >= data_cycle ) {
+               time_in_cycle -= data_cycle;
+            }
+            this->time_in_cycle_per_obj[obj_index] = time_in_cycle;
+         }
+      }
+   } else {
+      // Irregular simulation time step, rebuild the schedule tables.
+      for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+         int64_t const data_cycle = this->data_cycle_base_time_per_obj[obj_index];
+         if ( data_cycle > 0LL ) {
+            this->time_in_cycle_per_obj[obj_index] = sim_time_in_base_time % data_cycle;
+
+            // Reduce the phase offset modulo the data cycle time so that a
+            // configured offset can never starve the object of send boundaries.
+            this->send_phase_in_cycle_per_obj[obj_index] = this->manager->objects[obj_index].get_send_phase_offset_base_time()
+                                                           % data_cycle;
+         } else {
+            this->time_in_cycle_per_obj[obj_index]       = 0LL;
+            this->send_phase_in_cycle_per_obj[obj_index] = 0LL;
+         }
+      }
+   }
+   this->data_cycle_schedule_step     = step;
+   this->data_cycle_schedule_sim_time = sim_time_in_base_time;
+}
+
 /*! @brief On boundary if sim-time is an integer multiple of a valid cycle-time. */
 bool const TrickThreadCoordinator::on_receive_data_cycle_boundary_for_obj(
    unsigned int const obj_index,
    int64_t const      sim_time_in_base_time ) const
 {
    // On boundary if sim-time is an integer multiple of a valid cycle-time.
-   return ( ( this->any_child_thread_associated
-              && ( obj_index < this->manager->obj_count )
-              && ( this->data_cycle_base_time_per_obj[obj_index] > 0LL ) )
-               ? ( ( sim_time_in_base_time % this->data_cycle_base_time_per_obj[obj_index] ) == 0LL )
-               : true );
+   if ( this->any_child_thread_associated
+        && ( obj_index < this->manager->obj_count )
+        && ( this->data_cycle_base_time_per_obj[obj_index] > 0LL ) ) {
+
+      // Use the precomputed schedule table when it has been advanced to this
+      // simulation time, otherwise fall back to the modulo arithmetic.
+      return ( sim_time_in_base_time == this->data_cycle_schedule_sim_time )
+                ? ( this->time_in_cycle_per_obj[obj_index] == 0LL )
+                : ( ( sim_time_in_base_time % this->data_cycle_base_time_per_obj[obj_index] ) == 0LL );
+   }
+   return true;
+}
+
+/*! @brief On send boundary if sim-time is offset from an integer multiple of
+ * a valid cycle-time by the object's configured send phase offset, which
+ * staggers the per-object encode and send work across the data cycle. */
+bool const TrickThreadCoordinator::on_send_data_cycle_boundary_for_obj(
+   unsigned int const obj_index,
+   int64_t const      sim_time_in_base_time ) const
+{
+   if ( this->any_child_thread_associated
+        && ( obj_index < this->manager->obj_count )
+        && ( this->data_cycle_base_time_per_obj[obj_index] > 0LL ) ) {
+
+      // Use the precomputed schedule tables when they have been advanced to
+      // this simulation time, otherwise fall back to the modulo arithmetic.
+      if ( sim_time_in_base_time == this->data_cycle_schedule_sim_time ) {
+         return ( this->time_in_cycle_per_obj[obj_index]
+                  == this->send_phase_in_cycle_per_obj[obj_index] );
+      }
+
+      int64_t const data_cycle = this->data_cycle_base_time_per_obj[obj_index];
+
+      // Reduce the phase offset modulo the data cycle time so that a
+      // configured offset can never starve the object of send boundaries.
+      int64_t const phase = this->manager->objects[obj_index].get_send_phase_offset_base_time()
+                            % data_cycle;
+
+      // On boundary if sim-time is an integer multiple of a valid cycle-time
+      // shifted by the send phase offset for this object.
+      return ( ( sim_time_in_base_time % data_cycle ) == phase );
+   }
+   return true;
 }
 
 /*! @brief Get the data cycle time for the specified object index, otherwise
@@ -1247,3 +1660,319 @@ bool const TrickThreadCoordinator::on_send_data_cycle_boundary_for_thread(
                    == 0LL )
                : true );
 }
+
+/*!
+ * @details Create the pool of persistent data job worker threads. The
+ * workers sleep on a condition variable between batches, so an idle pool
+ * costs nothing on frames with no parallel work. Calling this more than
+ * once or with a zero worker count is a no-op.
+ * @job_class{initialization}
+ */
+void TrickThreadCoordinator::initialize_data_job_workers(
+   unsigned int const worker_count )
+{
+   if ( ( this->worker_cnt > 0 ) || ( worker_count == 0 ) ) {
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, "TrickThreadCoordinator::initialize_data_job_workers():%d Creating %u data job worker threads.%c",
+               __LINE__, worker_count, THLA_NEWLINE );
+   }
+
+   this->worker_threads = static_cast< pthread_t * >( malloc( worker_count * sizeof( pthread_t ) ) );
+   if ( this->worker_threads == NULL ) {
+      ostringstream errmsg;
+      errmsg << "TrickThreadCoordinator::initialize_data_job_workers():" << __LINE__
+             << " ERROR: Could not allocate memory for " << worker_count
+             << " data job worker thread handles!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   for ( unsigned int i = 0; i < worker_count; ++i ) {
+      int const ret = pthread_create( &this->worker_threads[i], NULL,
+                                      data_job_worker_entry, this );
+      if ( ret != 0 ) {
+         ostringstream errmsg;
+         errmsg << "TrickThreadCoordinator::initialize_data_job_workers():" << __LINE__
+                << " ERROR: Failed to create data job worker thread " << i
+                << " of " << worker_count << ", pthread_create() returned "
+                << ret << "!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         return;
+      }
+      ++this->worker_cnt;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void TrickThreadCoordinator::shutdown_data_job_workers()
+{
+   if ( this->worker_cnt == 0 ) {
+      return;
+   }
+
+   // Command the workers to exit and wake them all up.
+   pthread_mutex_lock( &job_mutex );
+   this->job_shutdown = true;
+   pthread_cond_broadcast( &job_start_cond );
+   pthread_mutex_unlock( &job_mutex );
+
+   for ( unsigned int i = 0; i < this->worker_cnt; ++i ) {
+      pthread_join( this->worker_threads[i], NULL );
+   }
+
+   // The workers have been joined so a merged snapshot of the sharded data
+   // job time statistics is exact here.
+   if ( this->adaptive_job_scheduling
+        && DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, "TrickThreadCoordinator::shutdown_data_job_workers():%d Data job execution time statistics:\n%s%c",
+               __LINE__, this->job_time_stats.to_string().c_str(), THLA_NEWLINE );
+   }
+
+   free( this->worker_threads );
+   this->worker_threads = NULL;
+   this->worker_cnt     = 0;
+}
+
+void *TrickThreadCoordinator::data_job_worker_entry(
+   void *arg )
+{
+   static_cast< TrickThreadCoordinator * >( arg )->data_job_worker_loop();
+   return NULL;
+}
+
+unsigned int TrickThreadCoordinator::process_claimed_jobs()
+{
+   unsigned int processed = 0;
+
+   // Claim object indices lock-free until the batch is exhausted. The
+   // per-index claim naturally load balances objects of different sizes
+   // across the threads, and the adaptive schedule maps the claim slots so
+   // that the objects predicted to take the longest are claimed first.
+   bool const schedule_active = this->job_schedule_active;
+   bool const record_costs    = this->adaptive_job_scheduling;
+
+   unsigned int slot;
+   while ( ( slot = this->job_next_index.fetch_add( 1 ) ) < this->job_count ) {
+      unsigned int const index = schedule_active ? this->job_schedule[slot] : slot;
+      if ( record_costs ) {
+         struct timespec start_time, end_time;
+         clock_gettime( CLOCK_MONOTONIC, &start_time );
+         ( *this->job_fn )( this->job_user_data, index );
+         clock_gettime( CLOCK_MONOTONIC, &end_time );
+
+         double const elapsed_ms = ( (double)( end_time.tv_sec - start_time.tv_sec ) * 1000.0 )
+                                   + ( (double)( end_time.tv_nsec - start_time.tv_nsec ) * 0.000001 );
+
+         // Low-pass filter the per-object cost estimate. Each object index
+         // is claimed by exactly one thread per batch so the per-index
+         // filter state update is race free.
+         this->job_cost_avg[index] += JOB_COST_FILTER_GAIN * ( elapsed_ms - this->job_cost_avg[index] );
+
+         // Accumulate the job time into the sharded statistics, which each
+         // thread updates through its own shard with zero contention.
+         this->job_time_stats.sample( elapsed_ms );
+      } else {
+         ( *this->job_fn )( this->job_user_data, index );
+      }
+      ++processed;
+   }
+   return processed;
+}
+
+/*!
+ * @details Called with the job mutex held before the batch is published so
+ * that no worker is claiming from the schedule while it changes.
+ */
+void TrickThreadCoordinator::update_job_schedule(
+   unsigned int const batch_job_count )
+{
+   // Grow the filtered cost state to cover this batch size. New objects
+   // start with a zero cost estimate and sort to the end of the schedule
+   // until they have been measured.
+   if ( this->job_cost_avg.size() < batch_job_count ) {
+      this->job_cost_avg.resize( batch_job_count, 0.0 );
+   }
+
+   // A schedule is only usable for the batch size it was built for.
+   if ( this->job_schedule.size() != batch_job_count ) {
+      this->job_schedule_active = false;
+   }
+
+   // Rebalance periodically instead of every batch so that the filtered
+   // costs can settle between schedule changes.
+   if ( ++this->job_batches_since_rebalance < this->job_rebalance_period ) {
+      return;
+   }
+   this->job_batches_since_rebalance = 0;
+
+   // Candidate schedule: heaviest objects first so that a large object is
+   // never claimed last, where it alone would extend the batch critical
+   // path. The sort is stable so equal-cost objects keep their index order.
+   vector< unsigned int > candidate( batch_job_count );
+   for ( unsigned int i = 0; i < batch_job_count; ++i ) {
+      candidate[i] = i;
+   }
+   vector< double > const &cost = this->job_cost_avg;
+   stable_sort( candidate.begin(), candidate.end(),
+                [&cost]( unsigned int const a, unsigned int const b ) {
+                   return cost[a] > cost[b];
+                } );
+
+   // Adopt the first schedule outright, otherwise require the predicted
+   // batch completion time to improve beyond the hysteresis band so that
+   // noisy timing does not thrash the schedule.
+   if ( this->job_schedule_active ) {
+      double const current_makespan  = estimate_batch_makespan( this->job_schedule );
+      double const proposed_makespan = estimate_batch_makespan( candidate );
+      if ( proposed_makespan >= ( current_makespan * ( 1.0 - JOB_REBALANCE_HYSTERESIS ) ) ) {
+         return;
+      }
+      if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+         ostringstream msg;
+         msg << "TrickThreadCoordinator::update_job_schedule():" << __LINE__
+             << " Rebalancing the data job schedule, predicted batch time "
+             << setprecision( 6 ) << current_makespan << " ms down to "
+             << proposed_makespan << " ms." << THLA_ENDL;
+         send_hs( stdout, msg.str().c_str() );
+      }
+   }
+   this->job_schedule.swap( candidate );
+   this->job_schedule_active = true;
+}
+
+double TrickThreadCoordinator::estimate_batch_makespan(
+   vector< unsigned int > const &order ) const
+{
+   // Greedily assign each claimed object to the soonest-free thread of the
+   // pool, which models the lock-free claim order of the batch. The main
+   // thread participates in the batch along with the workers.
+   vector< double > thread_busy_time( this->worker_cnt + 1, 0.0 );
+
+   double makespan = 0.0;
+   for ( size_t i = 0; i < order.size(); ++i ) {
+      size_t soonest_free = 0;
+      for ( size_t t = 1; t < thread_busy_time.size(); ++t ) {
+         if ( thread_busy_time[t] < thread_busy_time[soonest_free] ) {
+            soonest_free = t;
+         }
+      }
+      thread_busy_time[soonest_free] += this->job_cost_avg[order[i]];
+      if ( thread_busy_time[soonest_free] > makespan ) {
+         makespan = thread_busy_time[soonest_free];
+      }
+   }
+   return makespan;
+}
+
+void TrickThreadCoordinator::data_job_worker_loop()
+{
+   unsigned long long last_generation = 0;
+
+   while ( true ) {
+
+      // Wait for the next batch of data jobs or a shutdown command.
+      pthread_mutex_lock( &job_mutex );
+      while ( ( this->job_generation == last_generation ) && !this->job_shutdown ) {
+         pthread_cond_wait( &job_start_cond, &job_mutex );
+      }
+      if ( this->job_shutdown ) {
+         pthread_mutex_unlock( &job_mutex );
+         return;
+      }
+      last_generation = this->job_generation;
+      pthread_mutex_unlock( &job_mutex );
+
+      // Process object indices from this batch.
+      unsigned int const processed = process_claimed_jobs();
+
+      // Retire the processed indices and signal the barrier when this was
+      // the last of the batch.
+      pthread_mutex_lock( &job_mutex );
+      this->job_remaining -= processed;
+      if ( this->job_remaining == 0 ) {
+         pthread_cond_broadcast( &job_done_cond );
+      }
+      pthread_mutex_unlock( &job_mutex );
+   }
+}
+
+/*!
+ * @details The calling thread participates in the batch and then blocks on
+ * the completion barrier until all the object indices have been processed.
+ * If the worker pool has not been initialized the batch simply runs
+ * serially on the calling thread.
+ */
+void TrickThreadCoordinator::execute_object_jobs(
+   ObjectJobFn        job,
+   void              *user_data,
+   unsigned int const job_count )
+{
+   if ( job_count == 0 ) {
+      return;
+   }
+
+   // Run serially when there is no worker pool, only one job, or a batch is
+   // already in flight. There is only one batch slot, so a nested dispatch
+   // from within a job (e.g. an object partitioning its attribute codec
+   // across slices while the per-object jobs are being fanned out) must not
+   // touch the shared batch state.
+   if ( ( this->worker_cnt == 0 )
+        || ( job_count == 1 )
+        || __atomic_load_n( &this->job_batch_active, __ATOMIC_ACQUIRE ) ) {
+      for ( unsigned int i = 0; i < job_count; ++i ) {
+         ( *job )( user_data, i );
+      }
+      return;
+   }
+
+   // Publish the batch and wake up the workers.
+   pthread_mutex_lock( &job_mutex );
+   __atomic_store_n( &this->job_batch_active, true, __ATOMIC_RELEASE );
+   if ( this->adaptive_job_scheduling ) {
+      update_job_schedule( job_count );
+   }
+   this->job_fn        = job;
+   this->job_user_data = user_data;
+   this->job_count     = job_count;
+   this->job_remaining = job_count;
+   this->job_next_index.store( 0 );
+   ++this->job_generation;
+   pthread_cond_broadcast( &job_start_cond );
+   pthread_mutex_unlock( &job_mutex );
+
+   // Participate in the batch instead of just waiting.
+   unsigned int const processed = process_claimed_jobs();
+
+   // Completion barrier: wait for the workers to finish the rest.
+   pthread_mutex_lock( &job_mutex );
+   this->job_remaining -= processed;
+   if ( this->job_remaining == 0 ) {
+      pthread_cond_broadcast( &job_done_cond );
+   }
+   while ( this->job_remaining > 0 ) {
+      pthread_cond_wait( &job_done_cond, &job_mutex );
+   }
+   __atomic_store_n( &this->job_batch_active, false, __ATOMIC_RELEASE );
+   pthread_mutex_unlock( &job_mutex );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void TrickThreadCoordinator::configure_adaptive_job_scheduling(
+   bool const         enable,
+   unsigned int const rebalance_period )
+{
+   this->adaptive_job_scheduling = enable;
+   this->job_rebalance_period    = ( rebalance_period > 0 ) ? rebalance_period : 1;
+
+   if ( enable && DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
+      send_hs( stdout, "TrickThreadCoordinator::configure_adaptive_job_scheduling():%d Adaptive data job scheduling enabled, rebalancing every %u batches.%c",
+               __LINE__, this->job_rebalance_period, THLA_NEWLINE );
+   }
+}
@@ -0,0 +1,141 @@
+/*!
+@file TrickHLA/TripleBuffer.cpp
+@ingroup TrickHLA
+@brief Wait-free triple buffer holding the latest reflected attribute snapshot.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{TripleBuffer.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <atomic>
+#include <utility>
+
+// TrickHLA include files.
+#include "TrickHLA/TripleBuffer.hh"
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+// Declare the static class variables.
+unsigned int const TripleBuffer::FRESH_BIT  = 0x4;
+unsigned int const TripleBuffer::INDEX_MASK = 0x3;
+
+/*!
+ * @job_class{initialization}
+ */
+TripleBuffer::TripleBuffer()
+   : latest( 0 ),
+     write_index( 1 ),
+     read_index( 2 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TripleBuffer::~TripleBuffer()
+{
+   return;
+}
+
+bool TripleBuffer::fresh() const
+{
+   return ( ( latest.load( memory_order_acquire ) & FRESH_BIT ) != 0 );
+}
+
+/*!
+ * @details Only call this function from the single producer thread (the
+ * FedAmb callback thread). The publish never blocks on or contends with
+ * the consumer: it writes a slot the consumer can not hold and makes it
+ * the latest snapshot with a single atomic exchange.
+ */
+void TripleBuffer::publish(
+   AttributeHandleValueMap &values )
+{
+   AttributeHandleValueMap &slot = slots[write_index];
+
+   // The write slot holds a stale snapshot from two publishes ago, either
+   // already latched by the consumer or already carried forward below, so
+   // clear it before building the new snapshot.
+   slot.clear();
+
+   // Move the reflected values into the write slot so the attribute values
+   // are not copied. The callers map is left empty.
+   AttributeHandleValueMap::iterator iter;
+   for ( iter = values.begin(); iter != values.end(); ++iter ) {
+      slot[iter->first] = std::move( iter->second );
+   }
+
+   // Carry forward any published-but-unlatched value this reflection did
+   // not supersede so a slower attribute update is not lost when the
+   // consumer skips a snapshot. Reading the published slot here is safe
+   // because no thread writes a slot while it is published; at worst the
+   // consumer latches it concurrently and decodes a carried value twice,
+   // which is idempotent for last-value state data.
+   unsigned int const peek = latest.load( memory_order_acquire );
+   if ( ( peek & FRESH_BIT ) != 0 ) {
+      AttributeHandleValueMap const          &published = slots[peek & INDEX_MASK];
+      AttributeHandleValueMap::const_iterator pub_iter;
+      for ( pub_iter = published.begin(); pub_iter != published.end(); ++pub_iter ) {
+         if ( slot.find( pub_iter->first ) == slot.end() ) {
+            slot[pub_iter->first] = pub_iter->second;
+         }
+      }
+   }
+
+   // Publish the snapshot with an atomic index flip, taking back the slot
+   // that was published before as the next write slot.
+   unsigned int const old = latest.exchange( ( write_index | FRESH_BIT ),
+                                             memory_order_acq_rel );
+   write_index = ( old & INDEX_MASK );
+}
+
+/*!
+ * @details Only call this function from the single consumer thread (the
+ * Trick simulation thread) and only when fresh() returned true. The latch
+ * hands the previously latched slot back to the producer, so any value
+ * borrowed from it must have been dropped before this call.
+ */
+AttributeHandleValueMap &TripleBuffer::latch()
+{
+   // Take the published snapshot with an atomic index flip, handing the
+   // previously latched slot back to the producer. The fresh bit is left
+   // cleared so the producer knows the slot needs no carry forward.
+   unsigned int const old = latest.exchange( read_index, memory_order_acq_rel );
+   read_index             = ( old & INDEX_MASK );
+   return slots[read_index];
+}
+
+/*!
+ * @details Not thread safe, only call when neither the producer nor the
+ * consumer is active.
+ */
+void TripleBuffer::clear()
+{
+   for ( int i = 0; i < 3; ++i ) {
+      slots[i].clear();
+   }
+   latest.store( 0, memory_order_release );
+   write_index = 1;
+   read_index  = 2;
+}
@@ -0,0 +1,177 @@
+/*!
+@file TrickHLA/TscClock.cpp
+@ingroup TrickHLA
+@brief A fast clock source backed by the CPU invariant cycle counter and
+calibrated against CLOCK_MONOTONIC.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{TscClock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2025, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <time.h>
+
+// TrickHLA include files.
+#include "TrickHLA/TscClock.hh"
+
+// Determine the invariant cycle counter support for this architecture.
+#if defined( __x86_64__ ) || defined( __i386__ )
+#   include <cpuid.h>
+#   include <x86intrin.h>
+#   define THLA_TSC_X86
+#elif defined( __aarch64__ )
+#   define THLA_TSC_AARCH64
+#endif
+
+using namespace TrickHLA;
+
+namespace
+{
+
+// Calibration state, written once by TscClock::initialize() and read-only
+// on the query fast path afterwards.
+bool     tsc_calibrated  = false;
+uint64_t cal_base_ticks  = 0;
+int64_t  cal_base_mono_us = 0;
+int64_t  cal_base_real_us = 0;
+double   cal_us_per_tick  = 0.0;
+
+/*! @brief Read the CPU cycle counter.
+ *  @return Current cycle counter value, or zero if unsupported. */
+inline uint64_t read_cycle_counter()
+{
+#if defined( THLA_TSC_X86 )
+   return __rdtsc();
+#elif defined( THLA_TSC_AARCH64 )
+   uint64_t ticks;
+   asm volatile( "mrs %0, cntvct_el0" : "=r"( ticks ) );
+   return ticks;
+#else
+   return 0;
+#endif
+}
+
+/*! @brief Determine if this CPU has an invariant (constant rate across
+ * frequency scaling and sleep states) cycle counter.
+ *  @return True if the cycle counter is invariant. */
+bool cycle_counter_is_invariant()
+{
+#if defined( THLA_TSC_X86 )
+   // CPUID leaf 0x80000007 EDX bit 8 is the Invariant TSC flag.
+   unsigned int eax, ebx, ecx, edx;
+   if ( __get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx ) ) {
+      return ( ( edx & ( 1u << 8 ) ) != 0 );
+   }
+   return false;
+#elif defined( THLA_TSC_AARCH64 )
+   // The aarch64 generic counter is architecturally at a constant rate.
+   return true;
+#else
+   return false;
+#endif
+}
+
+/*! @brief Get the specified system clock time as a count of microseconds.
+ *  @return Time as a count of microseconds.
+ *  @param id System clock type. */
+inline int64_t gettime_in_microseconds( clockid_t const id )
+{
+   struct timespec ts;
+   clock_gettime( id, &ts );
+   return ( (int64_t)ts.tv_sec * 1000000LL ) + ( (int64_t)ts.tv_nsec / 1000LL );
+}
+
+} // namespace
+
+/*!
+ * @details The cycle counter rate is measured against CLOCK_MONOTONIC over
+ * a 20 millisecond window, which resolves the rate to well under a part per
+ * million with the nanosecond resolution clock samples. The realtime offset
+ * is captured at the same base sample so realtime queries track
+ * CLOCK_REALTIME as it was at calibration time.
+ * @job_class{initialization}
+ */
+bool TscClock::initialize()
+{
+   if ( !cycle_counter_is_invariant() ) {
+      tsc_calibrated = false;
+      return false;
+   }
+
+   // Base sample of the cycle counter and both system clocks.
+   uint64_t const base_ticks   = read_cycle_counter();
+   int64_t const  base_mono_us = gettime_in_microseconds( CLOCK_MONOTONIC );
+   int64_t const  base_real_us = gettime_in_microseconds( CLOCK_REALTIME );
+
+   // Let the counters run for the calibration window.
+   struct timespec const window = { 0, 20000000L }; // 20 milliseconds
+   nanosleep( &window, NULL );
+
+   // End sample of the cycle counter and the monotonic clock.
+   uint64_t const end_ticks   = read_cycle_counter();
+   int64_t const  end_mono_us = gettime_in_microseconds( CLOCK_MONOTONIC );
+
+   if ( ( end_ticks <= base_ticks ) || ( end_mono_us <= base_mono_us ) ) {
+      tsc_calibrated = false;
+      return false;
+   }
+
+   cal_base_ticks   = base_ticks;
+   cal_base_mono_us = base_mono_us;
+   cal_base_real_us = base_real_us;
+   cal_us_per_tick  = (double)( end_mono_us - base_mono_us )
+                      / (double)( end_ticks - base_ticks );
+   tsc_calibrated   = true;
+   return true;
+}
+
+bool TscClock::is_available()
+{
+   return tsc_calibrated;
+}
+
+int64_t TscClock::time_in_microseconds()
+{
+   if ( tsc_calibrated ) {
+      return cal_base_mono_us
+             + (int64_t)( (double)( read_cycle_counter() - cal_base_ticks ) * cal_us_per_tick );
+   }
+   return gettime_in_microseconds( CLOCK_MONOTONIC );
+}
+
+int64_t TscClock::realtime_in_microseconds()
+{
+   if ( tsc_calibrated ) {
+      return cal_base_real_us
+             + (int64_t)( (double)( read_cycle_counter() - cal_base_ticks ) * cal_us_per_tick );
+   }
+   return gettime_in_microseconds( CLOCK_REALTIME );
+}
+
+double TscClock::time_in_seconds()
+{
+   return ( (double)time_in_microseconds() * 0.000001 );
+}
+
+double TscClock::realtime_in_seconds()
+{
+   return ( (double)realtime_in_microseconds() * 0.000001 );
+}
@@ -0,0 +1,437 @@
+/*!
+@file TrickHLA/UpdateCapture.cpp
+@ingroup TrickHLA
+@brief Capture and replay engine for received attribute updates.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{UpdateCapture.cpp}
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{Object.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER6, TrickHLA, August 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/UpdateCapture.hh"
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+bool UpdateCapture::capture_active = false;
+
+/*!
+ * @details This constructor is private because all the functions and data of
+ * this class are static.
+ * @job_class{initialization}
+ */
+UpdateCapture::UpdateCapture()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+UpdateCapture::~UpdateCapture() // RETURN: -- None.
+{
+   return;
+}
+
+namespace
+{
+
+// Capture file layout: an 8-byte magic number followed by append-only
+// records. Each record is the capture wall-clock time in nanoseconds, the
+// length prefixed object instance name, the attribute count, and for each
+// attribute the length prefixed attribute FOM name and the length prefixed
+// raw attribute value bytes. All fields are in host byte order since the
+// capture is an offline analysis artifact, not a wire format.
+char const   CAPTURE_MAGIC[8]    = { 'T', 'H', 'L', 'A', 'C', 'A', 'P', '1' };
+size_t const CAPTURE_CHUNK_SIZE  = 4 * 1024 * 1024; // File growth increment.
+
+int            capture_fd     = -1;   // Capture file descriptor.
+unsigned char *capture_base   = NULL; // Memory mapped capture file.
+size_t         capture_size   = 0;    // Mapped capacity of the capture file.
+size_t         capture_offset = 0;    // Append position in the capture file.
+
+MutexLock capture_mutex; // Serializes appends from callback and worker threads.
+
+/*! @brief Append a length prefixed string to a record staging buffer.
+ *  @param staging Record staging buffer.
+ *  @param text    String to append, NULL is treated as an empty string. */
+void append_string(
+   vector< unsigned char > &staging,
+   char const              *text )
+{
+   uint16_t const length = ( text != NULL ) ? (uint16_t)strlen( text ) : 0;
+   size_t         pos    = staging.size();
+   staging.resize( pos + sizeof( length ) + length );
+   memcpy( &staging[pos], &length, sizeof( length ) );
+   if ( length > 0 ) {
+      memcpy( &staging[pos + sizeof( length )], text, length );
+   }
+}
+
+/*! @brief Read a length prefixed string from a capture stream.
+ *  @return True if the string was read, false if the stream is truncated.
+ *  @param input Current stream position, advanced past the string.
+ *  @param end   End of the stream.
+ *  @param text  Returned string value. */
+bool parse_string(
+   unsigned char const *&input,
+   unsigned char const  *end,
+   string               &text )
+{
+   uint16_t length;
+   if ( (size_t)( end - input ) < sizeof( length ) ) {
+      return false;
+   }
+   memcpy( &length, input, sizeof( length ) );
+   input += sizeof( length );
+   if ( (size_t)( end - input ) < length ) {
+      return false;
+   }
+   text.assign( reinterpret_cast< char const * >( input ), length );
+   input += length;
+   return true;
+}
+
+} // namespace
+
+bool UpdateCapture::start(
+   string const &file_name )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &capture_mutex );
+
+   if ( capture_active ) {
+      send_hs( stderr, "UpdateCapture::start():%d A capture is already active, ignoring request for file '%s'.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return false;
+   }
+
+   capture_fd = ::open( file_name.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR );
+   if ( capture_fd < 0 ) {
+      send_hs( stderr, "UpdateCapture::start():%d Failed to create capture file '%s'.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return false;
+   }
+
+   capture_size   = 0;
+   capture_offset = 0;
+   if ( !ensure_capture_capacity( sizeof( CAPTURE_MAGIC ) ) ) {
+      ::close( capture_fd );
+      capture_fd = -1;
+      return false;
+   }
+
+   // Write the file magic number.
+   memcpy( capture_base, CAPTURE_MAGIC, sizeof( CAPTURE_MAGIC ) );
+   capture_offset = sizeof( CAPTURE_MAGIC );
+
+   capture_active = true;
+
+   send_hs( stdout, "UpdateCapture::start():%d Capturing received attribute updates to file '%s'.%c",
+            __LINE__, file_name.c_str(), THLA_NEWLINE );
+   return true;
+}
+
+void UpdateCapture::stop()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &capture_mutex );
+
+   if ( !capture_active ) {
+      return;
+   }
+   capture_active = false;
+
+   if ( capture_base != NULL ) {
+      munmap( capture_base, capture_size );
+      capture_base = NULL;
+   }
+   if ( capture_fd >= 0 ) {
+      // Trim the pre-allocated growth chunk down to the captured data.
+      if ( ftruncate( capture_fd, (off_t)capture_offset ) != 0 ) {
+         send_hs( stderr, "UpdateCapture::stop():%d Failed to trim the capture file to %d bytes.%c",
+                  __LINE__, (int)capture_offset, THLA_NEWLINE );
+      }
+      ::close( capture_fd );
+      capture_fd = -1;
+   }
+
+   send_hs( stdout, "UpdateCapture::stop():%d Capture stopped with %d bytes recorded.%c",
+            __LINE__, (int)capture_offset, THLA_NEWLINE );
+
+   capture_size   = 0;
+   capture_offset = 0;
+}
+
+bool UpdateCapture::ensure_capture_capacity(
+   size_t const additional_bytes )
+{
+   if ( ( capture_offset + additional_bytes ) <= capture_size ) {
+      return true;
+   }
+
+   // Grow the file by whole chunks and remap it at the new capacity.
+   size_t new_size = ( capture_size > 0 ) ? capture_size : CAPTURE_CHUNK_SIZE;
+   while ( new_size < ( capture_offset + additional_bytes ) ) {
+      new_size += CAPTURE_CHUNK_SIZE;
+   }
+
+   if ( capture_base != NULL ) {
+      munmap( capture_base, capture_size );
+      capture_base = NULL;
+   }
+   if ( ftruncate( capture_fd, (off_t)new_size ) != 0 ) {
+      send_hs( stderr, "UpdateCapture::ensure_capture_capacity():%d Failed to grow the capture file to %d bytes, stopping the capture.%c",
+               __LINE__, (int)new_size, THLA_NEWLINE );
+      capture_active = false;
+      return false;
+   }
+   void *addr = mmap( NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, capture_fd, 0 );
+   if ( addr == MAP_FAILED ) {
+      send_hs( stderr, "UpdateCapture::ensure_capture_capacity():%d Failed to map the capture file at %d bytes, stopping the capture.%c",
+               __LINE__, (int)new_size, THLA_NEWLINE );
+      capture_active = false;
+      return false;
+   }
+   capture_base = static_cast< unsigned char * >( addr );
+   capture_size = new_size;
+   return true;
+}
+
+void UpdateCapture::record(
+   Object                        *obj,
+   AttributeHandleValueMap const &values )
+{
+   if ( !capture_active || ( obj == NULL ) ) {
+      return;
+   }
+
+   // Stage the record outside the capture file so a failed growth never
+   // leaves a partial record behind. The staging buffer is reused across
+   // records to avoid per-record allocations.
+   static vector< unsigned char > staging;
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &capture_mutex );
+
+   if ( !capture_active ) {
+      return; // The capture was stopped while we waited on the mutex.
+   }
+
+   staging.clear();
+
+   // Record the capture wall-clock time in nanoseconds.
+   struct timespec now;
+   clock_gettime( CLOCK_REALTIME, &now );
+   uint64_t const wall_time_ns = ( (uint64_t)now.tv_sec * 1000000000ULL )
+                                 + (uint64_t)now.tv_nsec;
+   size_t pos = staging.size();
+   staging.resize( pos + sizeof( wall_time_ns ) );
+   memcpy( &staging[pos], &wall_time_ns, sizeof( wall_time_ns ) );
+
+   // Record the object instance name the update was reflected for.
+   append_string( staging, obj->get_name() );
+
+   // Record each attribute as its FOM name and raw value bytes. Attribute
+   // handles are resolved to FOM names here so the stream can be replayed
+   // with no RTI present.
+   uint32_t attr_count = 0;
+   size_t const attr_count_pos = staging.size();
+   staging.resize( attr_count_pos + sizeof( attr_count ) );
+
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = values.begin(); iter != values.end(); ++iter ) {
+      Attribute const *attr = obj->get_attribute( iter->first );
+      if ( attr == NULL ) {
+         continue; // Not an attribute configured for this object.
+      }
+      append_string( staging, attr->get_FOM_name() );
+
+      uint32_t const value_size = (uint32_t)iter->second.size();
+      pos = staging.size();
+      staging.resize( pos + sizeof( value_size ) + value_size );
+      memcpy( &staging[pos], &value_size, sizeof( value_size ) );
+      if ( value_size > 0 ) {
+         memcpy( &staging[pos + sizeof( value_size )], iter->second.data(), value_size );
+      }
+      ++attr_count;
+   }
+   memcpy( &staging[attr_count_pos], &attr_count, sizeof( attr_count ) );
+
+   // Append the staged record to the memory-mapped capture file.
+   if ( ensure_capture_capacity( staging.size() ) ) {
+      memcpy( capture_base + capture_offset, &staging[0], staging.size() );
+      capture_offset += staging.size();
+   }
+}
+
+unsigned long UpdateCapture::replay(
+   string const &file_name,
+   Manager      *manager )
+{
+   if ( manager == NULL ) {
+      send_hs( stderr, "UpdateCapture::replay():%d Unexpected NULL Manager.%c",
+               __LINE__, THLA_NEWLINE );
+      return 0;
+   }
+
+   int const fd = ::open( file_name.c_str(), O_RDONLY );
+   if ( fd < 0 ) {
+      send_hs( stderr, "UpdateCapture::replay():%d Failed to open capture file '%s'.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return 0;
+   }
+   struct stat file_stat;
+   if ( ( fstat( fd, &file_stat ) != 0 )
+        || ( (size_t)file_stat.st_size < sizeof( CAPTURE_MAGIC ) ) ) {
+      send_hs( stderr, "UpdateCapture::replay():%d Capture file '%s' is empty or unreadable.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      ::close( fd );
+      return 0;
+   }
+   size_t const file_size = (size_t)file_stat.st_size;
+
+   void *addr = mmap( NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   ::close( fd );
+   if ( addr == MAP_FAILED ) {
+      send_hs( stderr, "UpdateCapture::replay():%d Failed to map capture file '%s'.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return 0;
+   }
+
+   unsigned char const *input = static_cast< unsigned char const * >( addr );
+   unsigned char const *end   = input + file_size;
+
+   if ( memcmp( input, CAPTURE_MAGIC, sizeof( CAPTURE_MAGIC ) ) != 0 ) {
+      send_hs( stderr, "UpdateCapture::replay():%d File '%s' is not a TrickHLA capture file.%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      munmap( addr, file_size );
+      return 0;
+   }
+   input += sizeof( CAPTURE_MAGIC );
+
+   unsigned long records_replayed = 0;
+   unsigned long records_skipped  = 0;
+
+   string object_name;
+   string attr_FOM_name;
+
+   while ( input < end ) {
+
+      // Parse the record header.
+      uint64_t wall_time_ns;
+      if ( (size_t)( end - input ) < sizeof( wall_time_ns ) ) {
+         break; // Truncated record at the end of the capture.
+      }
+      memcpy( &wall_time_ns, input, sizeof( wall_time_ns ) );
+      input += sizeof( wall_time_ns );
+
+      if ( !parse_string( input, end, object_name ) ) {
+         break;
+      }
+      uint32_t attr_count;
+      if ( (size_t)( end - input ) < sizeof( attr_count ) ) {
+         break;
+      }
+      memcpy( &attr_count, input, sizeof( attr_count ) );
+      input += sizeof( attr_count );
+
+      // Match the object by instance name, like discovery would have.
+      Object *obj            = manager->get_trickhla_object( object_name );
+      bool    any_extracted  = false;
+
+      for ( uint32_t i = 0; i < attr_count; ++i ) {
+         if ( !parse_string( input, end, attr_FOM_name ) ) {
+            input = end; // Truncated record, stop the replay.
+            break;
+         }
+         uint32_t value_size;
+         if ( (size_t)( end - input ) < sizeof( value_size ) ) {
+            input = end;
+            break;
+         }
+         memcpy( &value_size, input, sizeof( value_size ) );
+         input += sizeof( value_size );
+         if ( (size_t)( end - input ) < value_size ) {
+            input = end;
+            break;
+         }
+
+         if ( obj != NULL ) {
+            Attribute *attr = obj->get_attribute( attr_FOM_name );
+            if ( attr != NULL ) {
+               // Feed the raw value through the same decode path used for
+               // an RTI reflection, referencing the mapped bytes directly.
+               VariableLengthData value;
+               value.setDataPointer( const_cast< unsigned char * >( input ), value_size );
+               if ( attr->extract_data( &value ) ) {
+                  any_extracted = true;
+               }
+            }
+         }
+         input += value_size;
+      }
+
+      if ( any_extracted ) {
+         // Run the unpack half of the decode path as the cyclic receive
+         // processing would.
+         obj->unpack_cyclic_attribute_buffers();
+         ++records_replayed;
+      } else {
+         ++records_skipped;
+      }
+   }
+
+   munmap( addr, file_size );
+
+   send_hs( stdout, "UpdateCapture::replay():%d Replayed %lu update records from file '%s', skipped %lu records with no matching object or attributes.%c",
+            __LINE__, records_replayed, file_name.c_str(), records_skipped, THLA_NEWLINE );
+
+   return records_replayed;
+}
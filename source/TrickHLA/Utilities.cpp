@@ -15,6 +15,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
 
@@ -28,13 +29,28 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <algorithm>
+#include <cstring>
+#include <sstream>
 #include <string>
 #include <time.h>
 
+// SIMD intrinsic include files for the batch byteswap and UTF-16 string
+// conversion kernels. The kernel is selected at compile time based on the
+// instruction sets the compiler is targeting, with a scalar fallback for
+// everything else.
+#if defined( __AVX2__ ) || defined( __SSSE3__ ) || defined( __SSE2__ )
+#   include <immintrin.h>
+#elif defined( __ARM_NEON )
+#   include <arm_neon.h>
+#endif
+
 // Trick include files.
 #include "trick/trick_byteswap.h"
 
 // TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 #include "TrickHLA/Version.hh"
@@ -47,14 +63,23 @@ fpu_control_t __fpu_control;
 using namespace std;
 using namespace TrickHLA;
 
-bool Utilities::is_transmission_byteswap(
-   EncodingEnum const rti_encoding )
+/*!
+ * @details Called once at startup as a sanity check of the compile-time
+ * byte order that the encode and decode paths were collapsed against.
+ */
+void Utilities::verify_endianness()
 {
-   char const endianness = Utilities::get_endianness();
-
-   // Check encoding versus Endianness to determine if we need to byteswap.
-   return ( ( ( rti_encoding == ENCODING_BIG_ENDIAN ) && ( endianness == TRICK_LITTLE_ENDIAN ) )
-            || ( ( rti_encoding == ENCODING_LITTLE_ENDIAN ) && ( endianness == TRICK_BIG_ENDIAN ) ) );
+   char measured = (char)( std::max( TRICK_LITTLE_ENDIAN, TRICK_BIG_ENDIAN ) + 1 );
+   TRICK_GET_BYTE_ORDER( measured );
+
+   if ( measured != Utilities::get_endianness() ) {
+      ostringstream errmsg;
+      errmsg << "Utilities::verify_endianness():" << __LINE__
+             << " ERROR: The host byte order measured at runtime does not"
+             << " match the compile-time byte order used by the encode and"
+             << " decode paths!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
 }
 
 short Utilities::byteswap_short(
@@ -367,6 +392,342 @@ double Utilities::byteswap_double(
    return ( output );
 }
 
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least length elements.
+ * - The source and destination may be the same buffer for an in-place swap,
+ *   but must not otherwise overlap.
+ */
+void Utilities::byteswap_2_byte_array(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __AVX2__ )
+   // Process 16 elements (32 bytes) at a time, reversing the bytes within
+   // each 2-byte lane.
+   __m256i const swap_ctrl = _mm256_setr_epi8(
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+   for ( ; ( k + 16 ) <= length; k += 16 ) {
+      __m256i const chunk = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + ( k * 2 ) ) );
+      _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + ( k * 2 ) ),
+                           _mm256_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __SSSE3__ )
+   // Process 8 elements (16 bytes) at a time, reversing the bytes within
+   // each 2-byte lane.
+   __m128i const swap_ctrl = _mm_setr_epi8(
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      __m128i const chunk = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + ( k * 2 ) ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( k * 2 ) ),
+                        _mm_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __ARM_NEON )
+   // Process 8 elements (16 bytes) at a time, reversing the bytes within
+   // each 2-byte lane.
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      vst1q_u8( out + ( k * 2 ), vrev16q_u8( vld1q_u8( in + ( k * 2 ) ) ) );
+   }
+#endif
+
+   // Scalar loop for the remaining elements, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      unsigned short value;
+      memcpy( &value, in + ( k * 2 ), 2 );
+      value = Utilities::byteswap_unsigned_short( value );
+      memcpy( out + ( k * 2 ), &value, 2 );
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least length elements.
+ * - The source and destination may be the same buffer for an in-place swap,
+ *   but must not otherwise overlap.
+ */
+void Utilities::byteswap_4_byte_array(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __AVX2__ )
+   // Process 8 elements (32 bytes) at a time, reversing the bytes within
+   // each 4-byte lane.
+   __m256i const swap_ctrl = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      __m256i const chunk = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + ( k * 4 ) ) );
+      _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + ( k * 4 ) ),
+                           _mm256_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __SSSE3__ )
+   // Process 4 elements (16 bytes) at a time, reversing the bytes within
+   // each 4-byte lane.
+   __m128i const swap_ctrl = _mm_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+   for ( ; ( k + 4 ) <= length; k += 4 ) {
+      __m128i const chunk = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + ( k * 4 ) ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( k * 4 ) ),
+                        _mm_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __ARM_NEON )
+   // Process 4 elements (16 bytes) at a time, reversing the bytes within
+   // each 4-byte lane.
+   for ( ; ( k + 4 ) <= length; k += 4 ) {
+      vst1q_u8( out + ( k * 4 ), vrev32q_u8( vld1q_u8( in + ( k * 4 ) ) ) );
+   }
+#endif
+
+   // Scalar loop for the remaining elements, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      unsigned int value;
+      memcpy( &value, in + ( k * 4 ), 4 );
+      value = Utilities::byteswap_unsigned_int( value );
+      memcpy( out + ( k * 4 ), &value, 4 );
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least length elements.
+ * - The source and destination may be the same buffer for an in-place swap,
+ *   but must not otherwise overlap.
+ */
+void Utilities::byteswap_8_byte_array(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __AVX2__ )
+   // Process 4 elements (32 bytes) at a time, reversing the bytes within
+   // each 8-byte lane.
+   __m256i const swap_ctrl = _mm256_setr_epi8(
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+   for ( ; ( k + 4 ) <= length; k += 4 ) {
+      __m256i const chunk = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + ( k * 8 ) ) );
+      _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + ( k * 8 ) ),
+                           _mm256_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __SSSE3__ )
+   // Process 2 elements (16 bytes) at a time, reversing the bytes within
+   // each 8-byte lane.
+   __m128i const swap_ctrl = _mm_setr_epi8(
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+   for ( ; ( k + 2 ) <= length; k += 2 ) {
+      __m128i const chunk = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + ( k * 8 ) ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( k * 8 ) ),
+                        _mm_shuffle_epi8( chunk, swap_ctrl ) );
+   }
+#elif defined( __ARM_NEON )
+   // Process 2 elements (16 bytes) at a time, reversing the bytes within
+   // each 8-byte lane.
+   for ( ; ( k + 2 ) <= length; k += 2 ) {
+      vst1q_u8( out + ( k * 8 ), vrev64q_u8( vld1q_u8( in + ( k * 8 ) ) ) );
+   }
+#endif
+
+   // Scalar loop for the remaining elements, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      unsigned long long value;
+      memcpy( &value, in + ( k * 8 ), 8 );
+      value = Utilities::byteswap_unsigned_long_long( value );
+      memcpy( out + ( k * 8 ), &value, 8 );
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least ( length + 7 ) / 8 bytes.
+ * - The source and destination buffers must not overlap.
+ * - A bool is assumed to be 1 byte with zero meaning false.
+ */
+void Utilities::pack_bool_array_to_bits(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __AVX2__ )
+   // Process 32 bool elements (4 packed bytes) at a time by turning each
+   // non-zero byte into 0xFF and gathering the byte sign bits into a mask.
+   __m256i const zero = _mm256_setzero_si256();
+   for ( ; ( k + 32 ) <= length; k += 32 ) {
+      __m256i const chunk   = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + k ) );
+      __m256i const is_set  = _mm256_xor_si256( _mm256_cmpeq_epi8( chunk, zero ),
+                                                _mm256_set1_epi8( (char)0xFF ) );
+      unsigned int const mask = (unsigned int)_mm256_movemask_epi8( is_set );
+      memcpy( out + ( k / 8 ), &mask, 4 );
+   }
+#elif defined( __SSE2__ )
+   // Process 16 bool elements (2 packed bytes) at a time by turning each
+   // non-zero byte into 0xFF and gathering the byte sign bits into a mask.
+   __m128i const zero = _mm_setzero_si128();
+   for ( ; ( k + 16 ) <= length; k += 16 ) {
+      __m128i const chunk  = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + k ) );
+      __m128i const is_set = _mm_xor_si128( _mm_cmpeq_epi8( chunk, zero ),
+                                            _mm_set1_epi8( (char)0xFF ) );
+      unsigned int const mask = (unsigned int)_mm_movemask_epi8( is_set );
+      out[k / 8]       = (unsigned char)( mask & 0xFF );
+      out[( k / 8 ) + 1] = (unsigned char)( ( mask >> 8 ) & 0xFF );
+   }
+#endif
+
+   // Scalar loop for the remaining elements, or for CPUs without SIMD support.
+   // The mask accumulation only relies on the packed byte being cleared when
+   // its first bit is written, which holds because the SIMD loops leave k on
+   // a byte boundary.
+   for ( ; k < length; ++k ) {
+      if ( ( k % 8 ) == 0 ) {
+         out[k / 8] = 0;
+      }
+      if ( in[k] != 0 ) {
+         out[k / 8] |= (unsigned char)( 1u << ( k % 8 ) );
+      }
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least length bool elements.
+ * - The source buffer must hold at least ( length + 7 ) / 8 packed bytes.
+ * - The source and destination buffers must not overlap.
+ * - A bool is assumed to be 1 byte.
+ */
+void Utilities::unpack_bits_to_bool_array(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __SSE2__ )
+   // Process 8 bool elements (1 packed byte) at a time by broadcasting the
+   // packed byte across the lanes and testing each lane against its bit.
+   __m128i const bit_select = _mm_setr_epi8( 1, 2, 4, 8, 16, 32, 64, (char)128,
+                                             0, 0, 0, 0, 0, 0, 0, 0 );
+   __m128i const bool_true  = _mm_set1_epi8( 1 );
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      __m128i const packed = _mm_set1_epi8( (char)in[k / 8] );
+      __m128i const is_set = _mm_cmpeq_epi8( _mm_and_si128( packed, bit_select ),
+                                             bit_select );
+      _mm_storel_epi64( reinterpret_cast< __m128i * >( out + k ),
+                        _mm_and_si128( is_set, bool_true ) );
+   }
+#endif
+
+   // Scalar loop for the remaining elements, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      out[k] = (unsigned char)( ( in[k / 8] >> ( k % 8 ) ) & 1u );
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least 2 * length bytes.
+ * - The source and destination buffers must not overlap.
+ * - The characters are widened as is, so the source must hold 8-bit
+ *   characters for the UTF-16 code units to be valid.
+ */
+void Utilities::ascii_to_utf16_be(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __SSE2__ )
+   // Widen 16 characters (16 bytes) at a time to Big Endian UTF-16 code
+   // units by interleaving a zero high byte in front of each character.
+   __m128i const zero = _mm_setzero_si128();
+   for ( ; ( k + 16 ) <= length; k += 16 ) {
+      __m128i const chunk = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + k ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( k * 2 ) ),
+                        _mm_unpacklo_epi8( zero, chunk ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + ( k * 2 ) + 16 ),
+                        _mm_unpackhi_epi8( zero, chunk ) );
+   }
+#elif defined( __ARM_NEON )
+   // Widen 8 characters (8 bytes) at a time to Big Endian UTF-16 code
+   // units by shifting each character into the high byte of a 16-bit lane,
+   // which stores as a zero byte followed by the character.
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      vst1q_u16( reinterpret_cast< uint16_t * >( out + ( k * 2 ) ),
+                 vshll_n_u8( vld1_u8( in + k ), 8 ) );
+   }
+#endif
+
+   // Scalar loop for the remaining characters, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      out[k * 2]         = '\0';
+      out[( k * 2 ) + 1] = in[k];
+   }
+}
+
+/*! @details
+ * \par<b>Assumptions and Limitations:</b>
+ * - The destination buffer must be sized for at least length bytes.
+ * - The source and destination buffers must not overlap.
+ * - Only the low byte of each UTF-16 code unit is kept, so code points
+ *   above 255 are narrowed with loss.
+ */
+void Utilities::utf16_be_to_ascii(
+   void        *dest,
+   void const  *src,
+   size_t const length )
+{
+   unsigned char       *out = static_cast< unsigned char * >( dest );
+   unsigned char const *in  = static_cast< unsigned char const * >( src );
+   size_t               k   = 0;
+
+#if defined( __SSE2__ )
+   // Narrow 16 Big Endian UTF-16 code units (32 bytes) at a time by
+   // shifting the character out of the high byte of each 16-bit lane and
+   // packing the two halves back together into bytes.
+   for ( ; ( k + 16 ) <= length; k += 16 ) {
+      __m128i const lo = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + ( k * 2 ) ) );
+      __m128i const hi = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + ( k * 2 ) + 16 ) );
+      _mm_storeu_si128( reinterpret_cast< __m128i * >( out + k ),
+                        _mm_packus_epi16( _mm_srli_epi16( lo, 8 ),
+                                          _mm_srli_epi16( hi, 8 ) ) );
+   }
+#elif defined( __ARM_NEON )
+   // Narrow 8 Big Endian UTF-16 code units (16 bytes) at a time by
+   // shifting the character out of the high byte of each 16-bit lane.
+   for ( ; ( k + 8 ) <= length; k += 8 ) {
+      vst1_u8( out + k,
+               vshrn_n_u16( vld1q_u16( reinterpret_cast< uint16_t const * >( in + ( k * 2 ) ) ), 8 ) );
+   }
+#endif
+
+   // Scalar loop for the remaining characters, or for CPUs without SIMD support.
+   for ( ; k < length; ++k ) {
+      out[k] = in[( k * 2 ) + 1];
+   }
+}
+
 size_t Utilities::next_positive_multiple_of_8(
    size_t const value )
 {
@@ -401,6 +762,15 @@ int Utilities::micro_sleep(
    return nanosleep( &sleep_time, NULL );
 }
 
+void Utilities::processor_pause()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+   __builtin_ia32_pause();
+#elif defined( __aarch64__ ) || defined( __arm__ )
+   __asm__ __volatile__( "yield" ::: "memory" );
+#endif
+}
+
 string Utilities::get_version()
 {
    return TRICKHLA_VERSION;
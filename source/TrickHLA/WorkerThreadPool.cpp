@@ -0,0 +1,188 @@
+/*!
+@file TrickHLA/WorkerThreadPool.cpp
+@ingroup TrickHLA
+@brief A small persistent pool of worker threads that queued jobs are posted to.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{WorkerThreadPool.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@revs_end
+
+*/
+
+// System include files.
+#include <pthread.h>
+#include <sstream>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/WorkerThreadPool.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+WorkerThreadPool::WorkerThreadPool()
+   : job_head( 0 ),
+     job_count( 0 ),
+     thread_cnt( 0 ),
+     shutdown_requested( false )
+{
+   pthread_mutex_init( &mutex, NULL );
+   pthread_cond_init( &job_available, NULL );
+   pthread_cond_init( &slot_available, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+WorkerThreadPool::~WorkerThreadPool()
+{
+   shutdown();
+   pthread_cond_destroy( &slot_available );
+   pthread_cond_destroy( &job_available );
+   pthread_mutex_destroy( &mutex );
+}
+
+/*!
+ * @details The worker threads are created on the first job post so an
+ * unused pool costs nothing.
+ */
+bool WorkerThreadPool::post(
+   JobFn job,
+   void *arg )
+{
+   pthread_mutex_lock( &mutex );
+
+   if ( this->shutdown_requested ) {
+      pthread_mutex_unlock( &mutex );
+      return false;
+   }
+
+   // Lazily create the persistent worker threads on the first job.
+   if ( this->thread_cnt == 0 ) {
+      create_threads();
+   }
+
+   // The job queue is bounded, so wait for a slot to open up when full.
+   while ( ( this->job_count >= QUEUE_CAPACITY ) && !this->shutdown_requested ) {
+      pthread_cond_wait( &slot_available, &mutex );
+   }
+   if ( this->shutdown_requested ) {
+      pthread_mutex_unlock( &mutex );
+      return false;
+   }
+
+   unsigned int const slot = ( this->job_head + this->job_count ) % QUEUE_CAPACITY;
+
+   this->jobs[slot]     = job;
+   this->job_args[slot] = arg;
+   ++this->job_count;
+
+   pthread_cond_signal( &job_available );
+   pthread_mutex_unlock( &mutex );
+   return true;
+}
+
+/*!
+ * @details The caller must hold the pool mutex.
+ */
+void WorkerThreadPool::create_threads()
+{
+   for ( unsigned int i = 0; i < THREAD_COUNT; ++i ) {
+      int const ret = pthread_create( &this->threads[i], NULL,
+                                      worker_entry, this );
+      if ( ret != 0 ) {
+         ostringstream errmsg;
+         errmsg << "WorkerThreadPool::create_threads():" << __LINE__
+                << " ERROR: Failed to create worker thread " << i << " of "
+                << THREAD_COUNT << ", pthread_create() returned " << ret
+                << "!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      ++this->thread_cnt;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void WorkerThreadPool::shutdown()
+{
+   pthread_mutex_lock( &mutex );
+   if ( this->thread_cnt == 0 ) {
+      this->shutdown_requested = true;
+      pthread_mutex_unlock( &mutex );
+      return;
+   }
+   this->shutdown_requested = true;
+   pthread_cond_broadcast( &job_available );
+   pthread_cond_broadcast( &slot_available );
+   pthread_mutex_unlock( &mutex );
+
+   for ( unsigned int i = 0; i < this->thread_cnt; ++i ) {
+      pthread_join( this->threads[i], NULL );
+   }
+
+   pthread_mutex_lock( &mutex );
+   this->thread_cnt = 0;
+   pthread_mutex_unlock( &mutex );
+}
+
+void *WorkerThreadPool::worker_entry(
+   void *arg )
+{
+   static_cast< WorkerThreadPool * >( arg )->worker_loop();
+   return NULL;
+}
+
+/*!
+ * @details The queued jobs are drained even when a shutdown was requested
+ * so posted ownership transactions always complete.
+ */
+void WorkerThreadPool::worker_loop()
+{
+   while ( true ) {
+
+      pthread_mutex_lock( &mutex );
+      while ( ( this->job_count == 0 ) && !this->shutdown_requested ) {
+         pthread_cond_wait( &job_available, &mutex );
+      }
+      if ( ( this->job_count == 0 ) && this->shutdown_requested ) {
+         pthread_mutex_unlock( &mutex );
+         return;
+      }
+
+      // Take the next job off the ring.
+      JobFn job = this->jobs[this->job_head];
+      void *arg = this->job_args[this->job_head];
+
+      this->job_head = ( this->job_head + 1 ) % QUEUE_CAPACITY;
+      --this->job_count;
+
+      pthread_cond_signal( &slot_available );
+      pthread_mutex_unlock( &mutex );
+
+      // Run the job without holding the pool mutex.
+      ( *job )( arg );
+   }
+}